@@ -0,0 +1,55 @@
+#include "AllocationCounter.h"
+
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+static std::atomic<unsigned long long> allocationCount(0);
+static std::atomic<unsigned long long> allocationBytes(0);
+
+unsigned long long AllocationCounter::GetCount()
+{
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+unsigned long long AllocationCounter::GetBytes()
+{
+	return allocationBytes.load(std::memory_order_relaxed);
+}
+
+static void* CountedAllocate(size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	allocationBytes.fetch_add(size, std::memory_order_relaxed);
+	return malloc(size > 0 ? size : 1);
+}
+
+// --------------------------------------------------------
+// The replacements.  Throwing forms throw on failure as the
+// standard ones do; the rest return null.
+// --------------------------------------------------------
+void* operator new(size_t size)
+{
+	void* memory = CountedAllocate(size);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new[](size_t size)
+{
+	void* memory = CountedAllocate(size);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return CountedAllocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return CountedAllocate(size); }
+
+void operator delete(void* memory) noexcept { free(memory); }
+void operator delete[](void* memory) noexcept { free(memory); }
+void operator delete(void* memory, size_t) noexcept { free(memory); }
+void operator delete[](void* memory, size_t) noexcept { free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { free(memory); }
@@ -0,0 +1,21 @@
+#pragma once
+
+// --------------------------------------------------------
+// Counts the program's heap allocations: every call to the
+// global operator new, so every STL container and std::string
+// (LinearArena overflows go straight to malloc, and the arena
+// counts those).  Linking AllocationCounter.cpp replaces the
+// global operator new and delete with ones that count and
+// then use malloc / free.
+//
+// Frames in steady state shouldn't allocate at all (per-frame
+// memory comes from FrameArena); the benchmark reports this,
+// and FrameAllocationCheck fails if they do.
+// --------------------------------------------------------
+class AllocationCounter
+{
+public:
+	// Since the program started, on every thread
+	static unsigned long long GetCount();
+	static unsigned long long GetBytes();
+};
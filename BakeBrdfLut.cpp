@@ -0,0 +1,208 @@
+// --------------------------------------------------------
+// Offline tool: bakes the BRDF integration LUT into
+// BrdfLutData.h (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread BakeBrdfLut.cpp BrdfLut.cpp IBLPrefilter.cpp DDSFile.cpp CubemapImage.cpp -o BakeBrdfLut
+//   ./BakeBrdfLut .
+//
+// Before writing anything the table is validated:
+//  - Against an independent double precision reference with
+//    64x the samples; the baked table must stay within the
+//    BRDF_LUT_*TOLERANCE limits of it.  The bake itself uses 4x
+//    the shader's 1024 samples, since it's only paid offline
+//    (at 128x128, 1024 miss the reference by 0.04 at grazing NoV).
+//  - Single threaded and multithreaded results must match
+//    bit for bit
+//  - Quantizing to R16G16 must round trip to within half a step
+// A failed check exits with 1 and leaves the header alone.
+// --------------------------------------------------------
+
+#include "BrdfLut.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#define BRDF_LUT_SIZE				128
+#define BRDF_LUT_SAMPLES			4096
+#define BRDF_LUT_REFERENCE_SAMPLES	(BRDF_LUT_SAMPLES * 64)
+#define BRDF_LUT_TOLERANCE			0.02f	// Worst texel (the grazing NoV row is noisiest)
+#define BRDF_LUT_MEAN_TOLERANCE		0.0005f
+
+// An independent double precision version of IntegrateBRDF
+// (sampling directly in tangent space, with N = +Z), so float
+// accumulation over many samples doesn't limit the reference
+static void IntegrateReference(double roughness, double noV, unsigned int sampleCount, double result[2])
+{
+	const double pi = 3.14159265358979323846;
+	double vx = sqrt(1.0 - noV * noV);
+	double vz = noV;
+	double a = roughness * roughness;
+	double k = roughness * roughness / 2;	// G_Smith passes Roughness^2 to GGX
+
+	double sumA = 0;
+	double sumB = 0;
+	for (unsigned int i = 0; i < sampleCount; i++)
+	{
+		unsigned int bits = i;
+		bits = (bits << 16) | (bits >> 16);
+		bits = ((bits & 0x55555555u) << 1) | ((bits & 0xAAAAAAAAu) >> 1);
+		bits = ((bits & 0x33333333u) << 2) | ((bits & 0xCCCCCCCCu) >> 2);
+		bits = ((bits & 0x0F0F0F0Fu) << 4) | ((bits & 0xF0F0F0F0u) >> 4);
+		bits = ((bits & 0x00FF00FFu) << 8) | ((bits & 0xFF00FF00u) >> 8);
+		double u = (double)i / sampleCount;
+		double v = bits / 4294967296.0;
+
+		double phi = 2 * pi * u;
+		double cosTheta = sqrt((1 - v) / (1 + (a * a - 1) * v));
+		double sinTheta = sqrt(1 - cosTheta * cosTheta);
+		double hx = sinTheta * cos(phi);
+		double hz = cosTheta;
+
+		double voH = vx * hx + vz * hz;
+		double noL = 2 * voH * hz - vz;
+		if (noL <= 0)
+			continue;
+
+		voH = voH < 0 ? 0 : voH;
+		double g = (noL / (noL * (1 - k) + k)) * (noV / (noV * (1 - k) + k));
+		double gVis = g * voH / (hz * noV);
+		double fc = pow(1 - voH, 5);
+		sumA += (1 - fc) * gVis;
+		sumB += fc * gVis;
+	}
+
+	result[0] = sumA / sampleCount;
+	result[1] = sumB / sampleCount;
+}
+
+static bool Validate(const std::vector<float>& lut, const std::vector<uint32_t>& texels)
+{
+	bool ok = true;
+
+	// Convergence - how far the bake's samples are from (nearly) the true integral
+	std::vector<double> reference(lut.size());
+	for (int y = 0; y < BRDF_LUT_SIZE; y++)
+		for (int x = 0; x < BRDF_LUT_SIZE; x++)
+			IntegrateReference((x + 0.5) / BRDF_LUT_SIZE, (y + 0.5) / BRDF_LUT_SIZE, BRDF_LUT_REFERENCE_SAMPLES, &reference[(y * BRDF_LUT_SIZE + x) * 2]);
+
+	float maxError = 0;
+	double sumError = 0;
+	int worst = 0;
+	for (size_t i = 0; i < lut.size(); i++)
+	{
+		float error = (float)fabs(lut[i] - reference[i]);
+		sumError += error;
+		if (error > maxError)
+		{
+			maxError = error;
+			worst = (int)i / 2;
+		}
+	}
+	printf("Reference (%d samples): max error %.5f at roughness %.3f NoV %.3f, mean %.6f\n",
+		BRDF_LUT_REFERENCE_SAMPLES, maxError,
+		(worst % BRDF_LUT_SIZE + 0.5f) / BRDF_LUT_SIZE, (worst / BRDF_LUT_SIZE + 0.5f) / BRDF_LUT_SIZE,
+		sumError / lut.size());
+	if (maxError > BRDF_LUT_TOLERANCE || sumError / lut.size() > BRDF_LUT_MEAN_TOLERANCE)
+	{
+		printf("FAILED: error above %.3f (max) or %.4f (mean)\n", BRDF_LUT_TOLERANCE, BRDF_LUT_MEAN_TOLERANCE);
+		ok = false;
+	}
+
+	// Determinism - threading must not change a single bit
+	std::vector<float> singleThreaded;
+	BrdfLut::Generate(BRDF_LUT_SIZE, BRDF_LUT_SAMPLES, singleThreaded, 1);
+	if (memcmp(&singleThreaded[0], &lut[0], lut.size() * sizeof(float)) != 0)
+	{
+		printf("FAILED: single and multithreaded tables differ\n");
+		ok = false;
+	}
+
+	// Quantization
+	float maxQuantization = 0;
+	for (size_t i = 0; i < texels.size(); i++)
+	{
+		float rg[2];
+		BrdfLut::Unpack(texels[i], rg);
+		for (int c = 0; c < 2; c++)
+		{
+			float value = fminf(fmaxf(lut[i * 2 + c], 0.0f), 1.0f);
+			maxQuantization = fmaxf(maxQuantization, fabsf(rg[c] - value));
+		}
+	}
+	printf("R16G16 quantization: max error %.7f\n", maxQuantization);
+	if (maxQuantization > 0.5f / 65535.0f + 1e-7f)
+	{
+		printf("FAILED: quantization error above half a step\n");
+		ok = false;
+	}
+
+	return ok;
+}
+
+static bool WriteHeader(const std::string& path, const std::vector<uint32_t>& texels)
+{
+	std::string text;
+	char line[256];
+
+	text += "#pragma once\n\n";
+	text += "// --------------------------------------------------------\n";
+	text += "// GENERATED by BakeBrdfLut.cpp - don't edit by hand.\n";
+	text += "//\n";
+	text += "// Split-sum environment BRDF (IntegrateBRDF in BrdfPS.hlsl)\n";
+	text += "// as R16G16_UNORM texels: R = F0 scale, G = bias.  Columns\n";
+	text += "// are roughness, rows are NoV, both at texel centers.\n";
+	text += "// --------------------------------------------------------\n\n";
+	snprintf(line, sizeof(line), "#define BRDF_LUT_SIZE %d\n#define BRDF_LUT_SAMPLES %d\n\n", BRDF_LUT_SIZE, BRDF_LUT_SAMPLES);
+	text += line;
+	text += "static const unsigned int BrdfLutData[BRDF_LUT_SIZE * BRDF_LUT_SIZE] =\n{\n";
+	for (size_t i = 0; i < texels.size(); i++)
+	{
+		snprintf(line, sizeof(line), "%s0x%08x,%s",
+			i % 8 == 0 ? "\t" : "", texels[i], i % 8 == 7 ? "\n" : " ");
+		text += line;
+	}
+	text += "};\n";
+
+	// Only touch the file when it changes, so it doesn't trigger rebuilds
+	FILE* file = fopen(path.c_str(), "rb");
+	if (file)
+	{
+		std::string existing;
+		char buffer[4096];
+		size_t count;
+		while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+			existing.append(buffer, count);
+		fclose(file);
+		if (existing == text)
+		{
+			printf("%s is up to date\n", path.c_str());
+			return true;
+		}
+	}
+
+	file = fopen(path.c_str(), "wb");
+	if (!file)
+		return false;
+	bool ok = fwrite(text.data(), 1, text.size(), file) == text.size();
+	fclose(file);
+	printf("Wrote %s\n", path.c_str());
+	return ok;
+}
+
+int main(int argc, char* argv[])
+{
+	std::string directory = argc > 1 ? argv[1] : ".";
+
+	std::vector<float> lut;
+	std::vector<uint32_t> texels;
+	BrdfLut::Generate(BRDF_LUT_SIZE, BRDF_LUT_SAMPLES, lut);
+	BrdfLut::Quantize(lut, texels);
+
+	if (!Validate(lut, texels))
+		return 1;
+
+	return WriteHeader(directory + "/BrdfLutData.h", texels) ? 0 : 1;
+}
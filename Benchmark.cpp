@@ -0,0 +1,337 @@
+#include "Benchmark.h"
+#include "AllocationCounter.h"
+#include "Profiler.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+BenchmarkSettings::BenchmarkSettings()
+{
+	Enabled = false;
+	Scene = "demo";
+	Frames = 1000;
+	WarmupFrames = 60;
+	StressEntities = -1;
+	TimeStep = 1.0f / 60.0f;
+	Threads = 0;
+	Output = "Benchmark";
+	Backend = "null";
+	Width = 1280;
+	Height = 720;
+}
+
+// --------------------------------------------------------
+// Reads the benchmark's arguments (see BenchmarkSettings).
+// Anything it doesn't know is an error, so a typo can't
+// quietly give a different run.
+// --------------------------------------------------------
+bool ParseBenchmarkArguments(int argc, char* argv[], BenchmarkSettings& settings, std::string& error)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "--benchmark")
+		{
+			settings.Enabled = true;
+			if (hasValue && strncmp(argv[i + 1], "--", 2) != 0)
+				settings.Scene = argv[++i];
+		}
+		else if (arg == "--frames" && hasValue)
+			settings.Frames = atoi(argv[++i]);
+		else if (arg == "--warmup" && hasValue)
+			settings.WarmupFrames = atoi(argv[++i]);
+		else if (arg == "--stress" && hasValue)
+			settings.StressEntities = atoi(argv[++i]);
+		else if (arg == "--path" && hasValue)
+			settings.CameraPath = argv[++i];
+		else if (arg == "--timestep" && hasValue)
+			settings.TimeStep = (float)atof(argv[++i]);
+		else if (arg == "--threads" && hasValue)
+			settings.Threads = atoi(argv[++i]);
+		else if (arg == "--out" && hasValue)
+			settings.Output = argv[++i];
+		else if (arg == "--backend" && hasValue)
+			settings.Backend = argv[++i];
+		else if (arg == "--size" && hasValue)
+		{
+			if (sscanf(argv[++i], "%dx%d", &settings.Width, &settings.Height) != 2)
+			{
+				error = "--size needs WxH";
+				return false;
+			}
+		}
+		else
+		{
+			error = "Unknown argument (or missing value): " + arg;
+			return false;
+		}
+	}
+
+	if (!FindBenchmarkScene(settings.Scene.c_str()))
+	{
+		error = "No benchmark scene called " + settings.Scene;
+		return false;
+	}
+	if (settings.Frames <= 0 || settings.WarmupFrames < 0 || settings.TimeStep <= 0 || settings.Threads < 0 || settings.Width <= 0 || settings.Height <= 0)
+	{
+		error = "Frames, timestep, threads and size must be positive";
+		return false;
+	}
+	return true;
+}
+
+static const BenchmarkScene scenes[] =
+{
+	{ "demo",	"The demo scene as it is",							0,		12 },
+	{ "crowd",	"The demo scene and 1000 spinning cubes",			1000,	12 },
+	{ "lights",	"The demo scene with a 32x32 grid of small lights",	0,		32 },
+};
+
+const BenchmarkScene* FindBenchmarkScene(const char* name)
+{
+	for (int s = 0; s < (int)(sizeof(scenes) / sizeof(scenes[0])); s++)
+	{
+		if (strcmp(scenes[s].Name, name) == 0)
+			return &scenes[s];
+	}
+	return 0;
+}
+
+const BenchmarkScene* GetBenchmarkScenes(int& count)
+{
+	count = (int)(sizeof(scenes) / sizeof(scenes[0]));
+	return scenes;
+}
+
+void GetStressEntityTransform(int index, float totalTime, float position[3], float& rotationZ, float& scale)
+{
+	// Rings of cubes round the middle, each twice as far out
+	// holding twice as many, over (and past) the ground
+	float ring = floorf(sqrtf(index / 6.0f + 1.0f));
+	float firstInRing = 6.0f * (ring * ring - 1.0f);
+	float perRing = 6.0f * (2.0f * ring + 1.0f);
+	float angle = 6.2831853f * (index - firstInRing) / perRing + ring * 0.5f;
+	float radius = 1.5f + ring * 0.6f;
+
+	position[0] = radius * cosf(angle);
+	position[1] = -1.0f + 0.25f * (sinf(totalTime * 2.0f + index * 0.37f) + 1.0f);
+	position[2] = radius * sinf(angle);
+	rotationZ = totalTime * (0.5f + (index % 5) * 0.25f);
+	scale = 0.15f;
+}
+
+BenchmarkRun::BenchmarkRun(const BenchmarkSettings& settings)
+{
+	this->settings = settings;
+	nextFrame = Profiler::GetFrameIndex() + settings.WarmupFrames;
+	endFrame = nextFrame + settings.Frames;
+	frameMs.reserve(settings.Frames);
+	gpuFrameMs.reserve(settings.Frames);
+	heapStarted = false;
+	heapEnded = false;
+	heapStartFrame = 0;
+	heapEndFrame = 0;
+	heapStartCount = 0;
+	heapEndCount = 0;
+}
+
+BenchmarkRun::Series& BenchmarkRun::FindSeries(const char* name, bool gpu)
+{
+	for (size_t s = 0; s < series.size(); s++)
+	{
+		if (series[s].Gpu == gpu && strcmp(series[s].Name, name) == 0)
+			return series[s];
+	}
+
+	Series added;
+	added.Name = name;
+	added.Gpu = gpu;
+	added.Ms.reserve(settings.Frames);
+	series.push_back(added);
+	return series.back();
+}
+
+// --------------------------------------------------------
+// Takes every ended frame that's ready.  A frame that's
+// dropped out of the Profiler (it was never Update()d in
+// time) is skipped.
+// --------------------------------------------------------
+void BenchmarkRun::Update()
+{
+	unsigned long long ended = Profiler::GetFrameIndex();
+
+	// Once the frame before the first measured one has ended,
+	// and again once the last one has
+	unsigned long long firstFrame = endFrame - settings.Frames;
+	if (!heapStarted && ended >= firstFrame)
+	{
+		heapStarted = true;
+		heapStartFrame = ended;
+		heapStartCount = AllocationCounter::GetCount();
+	}
+	if (heapStarted && !heapEnded && ended >= endFrame && ended > heapStartFrame)
+	{
+		heapEnded = true;
+		heapEndFrame = ended;
+		heapEndCount = AllocationCounter::GetCount();
+	}
+
+	while (nextFrame < endFrame && nextFrame < ended)
+	{
+		const ProfileFrame* frame = Profiler::GetFrame(nextFrame);
+		if (frame && frame->GpuMs < 0 && ended - nextFrame <= (unsigned long long)GpuLatency)
+			break;	// Its GPU time may still be coming
+		nextFrame++;
+		if (!frame)
+			continue;
+
+		frameMs.push_back(frame->GetMs());
+		if (frame->GpuMs >= 0)
+			gpuFrameMs.push_back(frame->GpuMs);
+
+		// Every series gets a value for every frame
+		size_t count = frameMs.size();
+		for (size_t s = 0; s < series.size(); s++)
+			series[s].Ms.resize(count, 0.0);
+		for (size_t n = 0; n < frame->Nodes.size(); n++)
+		{
+			const ProfileNode& node = frame->Nodes[n];
+			Series& nodeSeries = FindSeries(node.Name, node.Track < 0);
+			nodeSeries.Ms.resize(count, 0.0);
+			nodeSeries.Ms[count - 1] += node.Ms;
+		}
+	}
+}
+
+void BenchmarkRun::Summarize(const char* name, bool gpu, const std::vector<double>& values, BenchmarkStats& stats)
+{
+	std::vector<double> sorted(values);
+	std::sort(sorted.begin(), sorted.end());
+
+	stats.Name = name;
+	stats.Gpu = gpu;
+	stats.Frames = (int)sorted.size();
+	stats.MeanMs = stats.P50Ms = stats.P90Ms = stats.P99Ms = stats.MaxMs = 0;
+	if (sorted.empty())
+		return;
+
+	double total = 0;
+	for (size_t v = 0; v < sorted.size(); v++)
+		total += sorted[v];
+	stats.MeanMs = total / sorted.size();
+
+	// Nearest rank
+	double ranks[3] = { 0.5, 0.9, 0.99 };
+	double* results[3] = { &stats.P50Ms, &stats.P90Ms, &stats.P99Ms };
+	for (int r = 0; r < 3; r++)
+	{
+		size_t rank = (size_t)ceil(ranks[r] * sorted.size());
+		*results[r] = sorted[rank > 0 ? rank - 1 : 0];
+	}
+	stats.MaxMs = sorted.back();
+}
+
+double BenchmarkRun::GetHeapAllocationsPerFrame()
+{
+	if (!heapEnded)
+		return 0.0;
+	return (double)(heapEndCount - heapStartCount) / (double)(heapEndFrame - heapStartFrame);
+}
+
+void BenchmarkRun::GetStats(std::vector<BenchmarkStats>& stats)
+{
+	stats.clear();
+	BenchmarkStats row;
+	Summarize("Frame", false, frameMs, row);
+	stats.push_back(row);
+	if (!gpuFrameMs.empty())
+	{
+		Summarize("Frame", true, gpuFrameMs, row);
+		stats.push_back(row);
+	}
+
+	for (size_t s = 0; s < series.size(); s++)
+	{
+		// Series found late were only padded up to their last frame
+		std::vector<double> values(series[s].Ms);
+		values.resize(frameMs.size(), 0.0);
+		Summarize(series[s].Name, series[s].Gpu, values, row);
+		stats.push_back(row);
+	}
+}
+
+bool BenchmarkRun::WriteResults(const char* name)
+{
+	std::vector<BenchmarkStats> stats;
+	GetStats(stats);
+
+	std::string csvPath = std::string(name) + ".csv";
+	std::string jsonPath = std::string(name) + ".json";
+	FILE* csv = 0;
+	FILE* json = 0;
+#ifdef _WIN32
+	fopen_s(&csv, csvPath.c_str(), "w");
+	fopen_s(&json, jsonPath.c_str(), "w");
+#else
+	csv = fopen(csvPath.c_str(), "w");
+	json = fopen(jsonPath.c_str(), "w");
+#endif
+	if (!csv || !json)
+	{
+		if (csv) fclose(csv);
+		if (json) fclose(json);
+		return false;
+	}
+
+	fprintf(csv, "name,track,frames,mean_ms,p50_ms,p90_ms,p99_ms,max_ms\n");
+	for (size_t s = 0; s < stats.size(); s++)
+	{
+		const BenchmarkStats& row = stats[s];
+		fprintf(csv, "%s,%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+			row.Name.c_str(), row.Gpu ? "gpu" : "cpu", row.Frames, row.MeanMs, row.P50Ms, row.P90Ms, row.P99Ms, row.MaxMs);
+	}
+	fclose(csv);
+
+	fprintf(json, "{\n\"scene\":\"%s\",\n\"backend\":\"%s\",\n\"frames\":%d,\n\"warmup_frames\":%d,\n\"stress_entities\":%d,\n\"camera_path\":\"%s\",\n\"time_step\":%.6f,\n\"threads\":%d,\n\"width\":%d,\n\"height\":%d,\n\"heap_allocations_per_frame\":%.3f,\n",
+		settings.Scene.c_str(), settings.Backend.c_str(), settings.Frames, settings.WarmupFrames, settings.StressEntities,
+		settings.CameraPath.c_str(), settings.TimeStep, settings.Threads, settings.Width, settings.Height, GetHeapAllocationsPerFrame());
+
+	fprintf(json, "\"series\":[");
+	for (size_t s = 0; s < stats.size(); s++)
+	{
+		const BenchmarkStats& row = stats[s];
+		fprintf(json, "%s\n{\"name\":\"%s\",\"track\":\"%s\",\"frames\":%d,\"mean_ms\":%.4f,\"p50_ms\":%.4f,\"p90_ms\":%.4f,\"p99_ms\":%.4f,\"max_ms\":%.4f}",
+			s > 0 ? "," : "", row.Name.c_str(), row.Gpu ? "gpu" : "cpu", row.Frames, row.MeanMs, row.P50Ms, row.P90Ms, row.P99Ms, row.MaxMs);
+	}
+
+	const std::vector<double>* frameSeries[2] = { &frameMs, &gpuFrameMs };
+	const char* frameNames[2] = { "frame_ms", "gpu_frame_ms" };
+	for (int f = 0; f < 2; f++)
+	{
+		fprintf(json, "\n],\n\"%s\":[", frameNames[f]);
+		for (size_t v = 0; v < frameSeries[f]->size(); v++)
+			fprintf(json, "%s%.4f", v > 0 ? "," : "", (*frameSeries[f])[v]);
+	}
+	fprintf(json, "]\n}\n");
+	fclose(json);
+	return true;
+}
+
+void BenchmarkRun::PrintSummary()
+{
+	std::vector<BenchmarkStats> stats;
+	GetStats(stats);
+
+	printf("%-28s %-4s %9s %9s %9s %9s %9s\n", "", "", "mean", "p50", "p90", "p99", "max");
+	for (size_t s = 0; s < stats.size(); s++)
+	{
+		const BenchmarkStats& row = stats[s];
+		printf("%-28s %-4s %8.3fms %8.3fms %8.3fms %8.3fms %8.3fms\n",
+			row.Name.c_str(), row.Gpu ? "gpu" : "cpu", row.MeanMs, row.P50Ms, row.P90Ms, row.P99Ms, row.MaxMs);
+	}
+	printf("Heap allocations: %.3f per frame\n", GetHeapAllocationsPerFrame());
+}
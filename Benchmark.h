@@ -0,0 +1,135 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------
+// How a benchmark run is set up, from the command line:
+//
+//   --benchmark [scene]   Run one (scene default "demo")
+//   --frames N            Frames measured (default 1000)
+//   --warmup N            Frames run first and not measured (default 60)
+//   --stress N            Extra spinning cubes (default: the scene's)
+//   --path FILE           Camera path to fly (default: an orbit)
+//   --timestep S          Simulated seconds a frame (default 1/60)
+//   --threads N           Job system threads, the main one included (default: one per core)
+//   --out NAME            Writes NAME.csv and NAME.json (default "Benchmark")
+//   --backend NAME        Headless tool only: null or software
+//   --size WxH            Headless tool only: render size
+// --------------------------------------------------------
+struct BenchmarkSettings
+{
+	bool Enabled;
+	std::string Scene;
+	int Frames;
+	int WarmupFrames;
+	int StressEntities;		// -1 = the scene's
+	std::string CameraPath;	// Empty = CameraPath::MakeOrbit
+	float TimeStep;
+	int Threads;			// 0 = one per core
+	std::string Output;
+	std::string Backend;
+	int Width;
+	int Height;
+
+	BenchmarkSettings();
+};
+
+// Fills in settings from the arguments it knows.  Returns false
+// (with why in error) on one it doesn't, or a bad value.
+bool ParseBenchmarkArguments(int argc, char* argv[], BenchmarkSettings& settings, std::string& error);
+
+// --------------------------------------------------------
+// The scenes a benchmark can run, by name.  They're all the
+// demo scene, made heavier in different ways.
+// --------------------------------------------------------
+struct BenchmarkScene
+{
+	const char* Name;
+	const char* Description;
+	int StressEntities;		// Spinning cubes added (see GetStressEntityTransform)
+	int LightsPerSide;		// Of the grid of clustered lights (the demo has 12)
+};
+
+// Null if there's no scene of that name
+const BenchmarkScene* FindBenchmarkScene(const char* name);
+const BenchmarkScene* GetBenchmarkScenes(int& count);
+
+// Where stress cube index is at a time: a spiral of rows out
+// from the middle of the ground, each cube bobbing and spinning
+void GetStressEntityTransform(int index, float totalTime, float position[3], float& rotationZ, float& scale);
+
+// One measured quantity over the run
+struct BenchmarkStats
+{
+	std::string Name;
+	bool Gpu;
+	int Frames;			// Frames it was measured in
+	double MeanMs;
+	double P50Ms;
+	double P90Ms;
+	double P99Ms;
+	double MaxMs;
+};
+
+// --------------------------------------------------------
+// Collects a run's frames from the Profiler: whole frame
+// times (CPU, and GPU where there's one) and every scope's,
+// by name.  Call Update() once a frame, after
+// Profiler::EndFrame(); it takes each frame once its GPU time
+// is in (or has had long enough to arrive), so the run needs
+// a few frames past the last measured one to finish.
+// --------------------------------------------------------
+class BenchmarkRun
+{
+public:
+	// Starts measuring after settings.WarmupFrames more frames
+	BenchmarkRun(const BenchmarkSettings& settings);
+
+	void Update();
+	bool IsFinished() { return nextFrame >= endFrame; }
+	int GetMeasuredCount() { return (int)frameMs.size(); }
+
+	// Heap allocations (see AllocationCounter) per frame over the
+	// measured frames, counted as they're made rather than as
+	// they come back from the Profiler; 0 until they're done
+	double GetHeapAllocationsPerFrame();
+
+	// Every series, frame times first
+	void GetStats(std::vector<BenchmarkStats>& stats);
+
+	// NAME.csv (a row per series) and NAME.json (settings,
+	// the series, and every frame's time)
+	bool WriteResults(const char* name);
+	void PrintSummary();
+
+private:
+	struct Series
+	{
+		const char* Name;
+		bool Gpu;
+		std::vector<double> Ms;		// One per measured frame (0 where it didn't run)
+	};
+
+	// Frames the GPU's timings may take to come back
+	static const int GpuLatency = 8;
+
+	BenchmarkSettings settings;
+	unsigned long long nextFrame;
+	unsigned long long endFrame;
+	std::vector<double> frameMs;
+	std::vector<double> gpuFrameMs;
+	std::vector<Series> series;
+
+	// AllocationCounter at the first measured frame's start and
+	// the last one's end
+	bool heapStarted;
+	bool heapEnded;
+	unsigned long long heapStartFrame;
+	unsigned long long heapEndFrame;
+	unsigned long long heapStartCount;
+	unsigned long long heapEndCount;
+
+	Series& FindSeries(const char* name, bool gpu);
+	static void Summarize(const char* name, bool gpu, const std::vector<double>& values, BenchmarkStats& stats);
+};
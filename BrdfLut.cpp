@@ -0,0 +1,142 @@
+#include "BrdfLut.h"
+#include "IBLPrefilter.h"
+
+#include <atomic>
+#include <math.h>
+#include <thread>
+
+static const float Pi = 3.141592654f;
+
+// Just enough of HLSL's float3 to keep the port readable
+struct float3
+{
+	float x, y, z;
+};
+
+static float3 Make(float x, float y, float z) { float3 v = { x, y, z }; return v; }
+static float3 Add(float3 a, float3 b) { return Make(a.x + b.x, a.y + b.y, a.z + b.z); }
+static float3 Mul(float3 a, float s) { return Make(a.x * s, a.y * s, a.z * s); }
+static float Dot(float3 a, float3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static float3 Cross(float3 a, float3 b) { return Make(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+static float3 Normalize(float3 v) { return Mul(v, 1.0f / sqrtf(Dot(v, v))); }
+static float Saturate(float v) { return v < 0 ? 0 : (v > 1 ? 1 : v); }
+
+// CommonVars.hlsli
+static float GGX(float NdotV, float a)
+{
+	float k = a / 2;
+	return NdotV / (NdotV * (1.0f - k) + k);
+}
+
+static float G_Smith(float a, float nDotV, float nDotL)
+{
+	return GGX(nDotL, a * a) * GGX(nDotV, a * a);
+}
+
+static float3 ImportanceSampleGGX(const float Xi[2], float Roughness, float3 N)
+{
+	float a = Roughness * Roughness;
+
+	float Phi = 2 * Pi * Xi[0];
+	float CosTheta = sqrtf((1 - Xi[1]) / (1 + (a * a - 1) * Xi[1]));
+	float SinTheta = sqrtf(1 - CosTheta * CosTheta);
+
+	float3 H = Make(SinTheta * cosf(Phi), SinTheta * sinf(Phi), CosTheta);
+
+	float3 UpVector = fabsf(N.z) < 0.999f ? Make(0, 0, 1) : Make(1, 0, 0);
+	float3 TangentX = Normalize(Cross(UpVector, N));
+	float3 TangentY = Cross(N, TangentX);
+
+	return Add(Add(Mul(TangentX, H.x), Mul(TangentY, H.y)), Mul(N, H.z));
+}
+
+// --------------------------------------------------------
+// IntegrateBRDF() from BrdfPS.hlsl
+// --------------------------------------------------------
+void BrdfLut::IntegrateBRDF(float roughness, float noV, unsigned int sampleCount, float result[2])
+{
+	float3 V = Make(sqrtf(1.0f - noV * noV), 0, noV);
+	float3 N = Make(0.0f, 0.0f, 1.0f);
+
+	float A = 0;
+	float B = 0;
+
+	for (unsigned int i = 0; i < sampleCount; i++)
+	{
+		float Xi[2];
+		IBLPrefilter::Hammersley(i, sampleCount, Xi);
+		float3 H = ImportanceSampleGGX(Xi, roughness, N);
+		float3 L = Add(Mul(H, 2.0f * Dot(V, H)), Mul(V, -1.0f));
+
+		float NoL = Saturate(L.z);
+		float NoH = Saturate(H.z);
+		float VoH = Saturate(Dot(V, H));
+
+		if (NoL > 0)
+		{
+			float G = G_Smith(roughness, noV, NoL);
+			float G_Vis = G * VoH / (NoH * noV);
+
+			float Fc = powf(1 - VoH, 5);
+
+			A += (1 - Fc) * G_Vis;
+			B += Fc * G_Vis;
+		}
+	}
+
+	result[0] = A / sampleCount;
+	result[1] = B / sampleCount;
+}
+
+// --------------------------------------------------------
+// Fills the table, rows shared out between threads.  Every
+// texel is independent, so the result doesn't depend on the
+// thread count.
+// --------------------------------------------------------
+void BrdfLut::Generate(int size, unsigned int sampleCount, std::vector<float>& lut, unsigned int threadCount)
+{
+	lut.resize(size * size * 2);
+
+	if (threadCount == 0)
+		threadCount = std::thread::hardware_concurrency();
+	if (threadCount == 0)
+		threadCount = 1;
+
+	std::atomic<int> nextRow(0);
+	auto work = [&]()
+	{
+		for (int y = nextRow++; y < size; y = nextRow++)
+		{
+			float noV = (y + 0.5f) / size;
+			for (int x = 0; x < size; x++)
+			{
+				float roughness = (x + 0.5f) / size;
+				IntegrateBRDF(roughness, noV, sampleCount, &lut[(y * size + x) * 2]);
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned int t = 1; t < threadCount && t < (unsigned int)size; t++)
+		threads.push_back(std::thread(work));
+	work();
+	for (unsigned int t = 0; t < threads.size(); t++)
+		threads[t].join();
+}
+
+void BrdfLut::Quantize(const std::vector<float>& lut, std::vector<uint32_t>& texels)
+{
+	texels.resize(lut.size() / 2);
+	for (size_t i = 0; i < texels.size(); i++)
+	{
+		uint32_t r = (uint32_t)(Saturate(lut[i * 2 + 0]) * 65535.0f + 0.5f);
+		uint32_t g = (uint32_t)(Saturate(lut[i * 2 + 1]) * 65535.0f + 0.5f);
+		texels[i] = r | (g << 16);
+	}
+}
+
+void BrdfLut::Unpack(uint32_t texel, float rg[2])
+{
+	rg[0] = (texel & 0xFFFF) / 65535.0f;
+	rg[1] = (texel >> 16) / 65535.0f;
+}
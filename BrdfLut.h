@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// --------------------------------------------------------
+// The split-sum environment BRDF lookup table: for each
+// (roughness, NoV) the scale and bias applied to F0, as in
+// IntegrateBRDF() in BrdfPS.hlsl.
+//
+// This is a line-by-line port of the HLSL (Hammersley, GGX,
+// G_Smith and ImportanceSampleGGX from CommonVars.hlsli) in
+// 32-bit floats with the same operation order, so the table
+// can be baked offline instead of rendered every launch.  The
+// baked copy lives in BrdfLutData.h (see BakeBrdfLut.cpp).
+//
+// Layout: u = roughness, v = NoV, sampled at texel centers.
+// --------------------------------------------------------
+class BrdfLut
+{
+public:
+	// One texel: result[0] = F0 scale, result[1] = bias
+	static void IntegrateBRDF(float roughness, float noV, unsigned int sampleCount, float result[2]);
+
+	// The whole table as RG float pairs, row by row (rows are NoV)
+	//
+	// threadCount - 0 = one per hardware thread
+	static void Generate(int size, unsigned int sampleCount, std::vector<float>& lut, unsigned int threadCount = 0);
+
+	// Packs RG floats into R16G16_UNORM texels
+	static void Quantize(const std::vector<float>& lut, std::vector<uint32_t>& texels);
+	static void Unpack(uint32_t texel, float rg[2]);
+};
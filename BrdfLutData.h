@@ -0,0 +1,2064 @@
+#pragma once
+
+// --------------------------------------------------------
+// GENERATED by BakeBrdfLut.cpp - don't edit by hand.
+//
+// Split-sum environment BRDF (IntegrateBRDF in BrdfPS.hlsl)
+// as R16G16_UNORM texels: R = F0 scale, G = bias.  Columns
+// are roughness, rows are NoV, both at texel centers.
+// --------------------------------------------------------
+
+#define BRDF_LUT_SIZE 128
+#define BRDF_LUT_SAMPLES 4096
+
+static const unsigned int BrdfLutData[BRDF_LUT_SIZE * BRDF_LUT_SIZE] =
+{
+	0xfa0f04f1, 0xf27b04cb, 0xe39704a0, 0xcfbf0496, 0xbb3104da, 0xaa070579, 0x9e5f069e, 0x97310839,
+	0x931a0a49, 0x90f20ccb, 0x8fc30fb0, 0x8ef112e8, 0x8e3b166c, 0x8d661a2a, 0x8c611e19, 0x8b1e222e,
+	0x899b265f, 0x87db2aa4, 0x85e42ef6, 0x83bd334f, 0x816b37ab, 0x7ef73c05, 0x7c644059, 0x79bb44a5,
+	0x76ff48e5, 0x74374d18, 0x7164513b, 0x6e8d554e, 0x6bb3594e, 0x68da5d3b, 0x66046113, 0x633364d7,
+	0x60696885, 0x5da76c1d, 0x5af06f9e, 0x58437308, 0x55a3765c, 0x530f7997, 0x50887cbc, 0x4e107fc9,
+	0x4ba582be, 0x494a859c, 0x46fd8863, 0x44bf8b12, 0x42908daa, 0x4070902b, 0x3e5f9295, 0x3c5c94e9,
+	0x3a699726, 0x3884994d, 0x36ad9b5e, 0x34e49d5a, 0x332a9f40, 0x317da111, 0x2fdda2cd, 0x2e4ba475,
+	0x2cc5a609, 0x2b4ca789, 0x29dfa8f5, 0x287eaa4e, 0x2729ab95, 0x25dfacc9, 0x24a0adeb, 0x236baefb,
+	0x2241aff9, 0x2121b0e7, 0x200bb1c4, 0x1efeb291, 0x1dfbb34d, 0x1d00b3fa, 0x1c0eb497, 0x1b25b526,
+	0x1a43b5a6, 0x1969b617, 0x1897b67b, 0x17ccb6d1, 0x1708b719, 0x164bb755, 0x1594b784, 0x14e4b7a6,
+	0x143ab7bc, 0x1396b7c7, 0x12f7b7c5, 0x125eb7b9, 0x11cab7a2, 0x113cb780, 0x10b2b753, 0x102db71c,
+	0x0fadb6dc, 0x0f31b692, 0x0eb9b63e, 0x0e46b5e1, 0x0dd6b57c, 0x0d6ab50d, 0x0d02b496, 0x0c9eb417,
+	0x0c3db390, 0x0bdfb302, 0x0b84b26b, 0x0b2db1ce, 0x0ad8b129, 0x0a86b07e, 0x0a37afcb, 0x09ebaf13,
+	0x09a1ae53, 0x0959ad8e, 0x0914acc3, 0x08d2abf2, 0x0891ab1c, 0x0852aa40, 0x0816a95f, 0x07dba87a,
+	0x07a3a78f, 0x076ca6a0, 0x0737a5ac, 0x0704a4b4, 0x06d2a3b8, 0x06a2a2b8, 0x0673a1b4, 0x0646a0ac,
+	0x061a9fa1, 0x05f09e93, 0x05c79d82, 0x059f9c6d, 0x05799b56, 0x05539a3c, 0x052f991f, 0x050c9801,
+	0xf10b0ea2, 0xee900e7c, 0xe9990e3b, 0xe2520def, 0xd8ed0daf, 0xcddd0d87, 0xc1cb0d99, 0xb5bd0df1,
+	0xaa790ea2, 0xa0930fb8, 0x984b1131, 0x917f1309, 0x8c05153e, 0x878e17c4, 0x83de1a95, 0x80bd1da7,
+	0x7dfe20f0, 0x7b832469, 0x7931280a, 0x76f72bcc, 0x74c92fa8, 0x72a03399, 0x70733798, 0x6e413ba1,
+	0x6c0a3faf, 0x69ca43be, 0x678447cb, 0x65384bd3, 0x62e74fd2, 0x609353c7, 0x5e3c57af, 0x5be55b89,
+	0x59905f52, 0x573c630a, 0x54ec66af, 0x52a06a41, 0x505b6dbf, 0x4e1d7127, 0x4be67479, 0x49b877b5,
+	0x47937adb, 0x45787dea, 0x436780e2, 0x416183c2, 0x3f67868c, 0x3d77893e, 0x3b948bd9, 0x39bb8e5c,
+	0x37ef90c9, 0x362f931f, 0x347a955f, 0x32d29787, 0x3135999a, 0x2fa39b96, 0x2e1d9d7d, 0x2ca39f4e,
+	0x2b34a10a, 0x29d0a2b2, 0x2877a444, 0x2728a5c3, 0x25e4a72e, 0x24aaa885, 0x237aa9c9, 0x2254aafa,
+	0x2137ac19, 0x2024ad25, 0x1f19ae20, 0x1e17af0a, 0x1d1eafe3, 0x1c2db0ab, 0x1b45b163, 0x1a63b20b,
+	0x198ab2a3, 0x18b8b32c, 0x17edb3a7, 0x1729b412, 0x166bb470, 0x15b4b4c0, 0x1504b503, 0x1459b538,
+	0x13b4b560, 0x1315b57c, 0x127bb58c, 0x11e6b590, 0x1157b588, 0x10ccb575, 0x1046b557, 0x0fc5b52e,
+	0x0f48b4fb, 0x0ed0b4bd, 0x0e5bb476, 0x0debb425, 0x0d7eb3ca, 0x0d15b367, 0x0cb0b2fa, 0x0c4eb285,
+	0x0befb207, 0x0b93b181, 0x0b3bb0f4, 0x0ae5b05e, 0x0a93afc1, 0x0a43af1d, 0x09f6ae72, 0x09abadc0,
+	0x0963ad07, 0x091dac48, 0x08daab82, 0x0898aab7, 0x0859a9e6, 0x081ca90f, 0x07e1a833, 0x07a8a751,
+	0x0770a66b, 0x073ba57f, 0x0707a48f, 0x06d5a39b, 0x06a4a2a2, 0x0675a1a5, 0x0647a0a4, 0x061b9f9f,
+	0x05f09e96, 0x05c79d8a, 0x059f9c7b, 0x05789b68, 0x05529a53, 0x052d993a, 0x050a981f, 0x04e89702,
+	0xe7c31806, 0xe65e17e0, 0xe383179c, 0xdf3e1743, 0xd99916e3, 0xd2b51686, 0xcab71642, 0xc1d71622,
+	0xb8781638, 0xaf171693, 0xa5fe173b, 0x9d8e1835, 0x95ea1985, 0x8f281b28, 0x89391d1a, 0x840e1f55,
+	0x7f8a21d3, 0x7b89248c, 0x77f82779, 0x74bb2a94, 0x71c12dd7, 0x6efa313b, 0x6c5934bb, 0x69d53850,
+	0x67643bf8, 0x65043fad, 0x62af4369, 0x6064472c, 0x5e1d4aef, 0x5bdc4eb2, 0x59a15270, 0x576b5628,
+	0x553859d6, 0x530b5d7a, 0x50e36111, 0x4ec16499, 0x4ca56812, 0x4a8f6b7b, 0x48816ed1, 0x467b7215,
+	0x447d7545, 0x42877861, 0x409a7b69, 0x3eb77e5b, 0x3cde8138, 0x3b0e83ff, 0x394886b0, 0x378d894c,
+	0x35dc8bd1, 0x34368e40, 0x329a9099, 0x310892db, 0x2f819508, 0x2e05971f, 0x2c939920, 0x2b2b9b0c,
+	0x29ce9ce2, 0x287a9ea4, 0x2731a050, 0x25f1a1e9, 0x24bba36d, 0x238fa4dd, 0x226ba639, 0x2151a782,
+	0x2040a8b9, 0x1f37a9dd, 0x1e37aaee, 0x1d3eabee, 0x1c4eacdc, 0x1b66adb9, 0x1a85ae86, 0x19acaf42,
+	0x18daafed, 0x180fb089, 0x174ab116, 0x168cb194, 0x15d5b202, 0x1523b263, 0x1478b2b6, 0x13d2b2fb,
+	0x1332b332, 0x1298b35d, 0x1202b37a, 0x1172b38c, 0x10e6b391, 0x105fb38b, 0x0fddb379, 0x0f5fb35c,
+	0x0ee6b334, 0x0e70b301, 0x0dffb2c4, 0x0d91b27d, 0x0d27b22c, 0x0cc1b1d2, 0x0c5eb16e, 0x0bffb101,
+	0x0ba2b08c, 0x0b49b00e, 0x0af3af88, 0x0a9faef9, 0x0a4eae63, 0x0a00adc5, 0x09b5ad20, 0x096cac74,
+	0x0926abc1, 0x08e1ab07, 0x089faa47, 0x0860a980, 0x0822a8b3, 0x07e6a7e1, 0x07aca709, 0x0774a62b,
+	0x073ea548, 0x070aa460, 0x06d7a373, 0x06a6a282, 0x0676a18c, 0x0648a091, 0x061c9f92, 0x05f19e90,
+	0x05c79d89, 0x059e9c7f, 0x05779b72, 0x05519a61, 0x052c994d, 0x05089836, 0x04e6971c, 0x04c49600,
+	0xdebe211e, 0xddc420fa, 0xdbd720b5, 0xd8e82056, 0xd5001fea, 0xd0281f75, 0xca661f0a, 0xc3df1eb2,
+	0xbca81e79, 0xb4f31e6d, 0xad051e99, 0xa5201f04, 0x9d701fb6, 0x962d20b1, 0x8f6c21f6, 0x893e2384,
+	0x83a52556, 0x7e9a276a, 0x7a0b29b8, 0x75e92c3b, 0x72212eee, 0x6eaa31cb, 0x6b7534cb, 0x687337eb,
+	0x659e3b25, 0x62ec3e75, 0x605741d5, 0x5dda4542, 0x5b7148b9, 0x59184c36, 0x56ce4fb6, 0x54905336,
+	0x525d56b4, 0x50345a2d, 0x4e145d9e, 0x4bfe6107, 0x49f16466, 0x47ec67b7, 0x45f16afc, 0x43fe6e32,
+	0x42147157, 0x4033746c, 0x3e5b776f, 0x3c8d7a60, 0x3ac87d3e, 0x390d8009, 0x375c82bf, 0x35b48562,
+	0x341687ef, 0x32828a69, 0x30f88ccd, 0x2f788f1c, 0x2e029156, 0x2c96937b, 0x2b33958b, 0x29da9786,
+	0x288b996c, 0x27459b3e, 0x26089cfb, 0x24d59ea4, 0x23aaa039, 0x2289a1ba, 0x2170a327, 0x2060a481,
+	0x1f58a5c9, 0x1e59a6fd, 0x1d61a81f, 0x1c71a92f, 0x1b89aa2e, 0x1aa9ab1b, 0x19cfabf6, 0x18fdacc2,
+	0x1831ad7c, 0x176cae27, 0x16aeaec2, 0x15f6af4e, 0x1543afca, 0x1497b038, 0x13f1b098, 0x1350b0e9,
+	0x12b4b12d, 0x121eb164, 0x118cb18d, 0x1100b1aa, 0x1078b1ba, 0x0ff5b1be, 0x0f76b1b6, 0x0efcb1a3,
+	0x0e85b184, 0x0e13b15b, 0x0da4b127, 0x0d3ab0e8, 0x0cd2b0a0, 0x0c6eb04d, 0x0c0eaff1, 0x0bb1af8c,
+	0x0b57af1d, 0x0affaea6, 0x0aabae26, 0x0a5aad9e, 0x0a0bad0e, 0x09bfac76, 0x0975abd6, 0x092eab2f,
+	0x08e9aa81, 0x08a6a9cb, 0x0866a90f, 0x0828a84d, 0x07eba784, 0x07b1a6b6, 0x0779a5e1, 0x0742a507,
+	0x070da427, 0x06daa342, 0x06a8a258, 0x0678a169, 0x064aa075, 0x061d9f7d, 0x05f19e81, 0x05c79d80,
+	0x059e9c7b, 0x05769b73, 0x05509a67, 0x052b9958, 0x05079845, 0x04e4972f, 0x04c29616, 0x04a194fb,
+	0xd5f429ed, 0xd53f29c9, 0xd3cf2985, 0xd1a32925, 0xceae28b1, 0xcb192833, 0xc6b227b1, 0xc1a42738,
+	0xbbfc26d2, 0xb5c72689, 0xaf1f2666, 0xa83c2672, 0xa14c26b7, 0x9a682738, 0x93b927f9, 0x8d5928fd,
+	0x875d2a42, 0x81cd2bc8, 0x7caa2d8a, 0x77ef2f85, 0x739731b5, 0x6f953413, 0x6be0369c, 0x686b394a,
+	0x65313c18, 0x62283f03, 0x5f494204, 0x5c8e451a, 0x59f2483f, 0x57714b70, 0x55064eaa, 0x52b051ea,
+	0x506a552d, 0x4e355871, 0x4c0f5bb2, 0x49f65ef0, 0x47e96227, 0x45e86557, 0x43f1687d, 0x42066b98,
+	0x40256ea7, 0x3e4f71a8, 0x3c83749b, 0x3ac1777e, 0x39097a52, 0x375b7d14, 0x35b77fc4, 0x341c8262,
+	0x328c84ee, 0x31058767, 0x2f8889cc, 0x2e158c1e, 0x2cac8e5c, 0x2b4c9086, 0x29f5929c, 0x28a8949e,
+	0x2764968c, 0x26299867, 0x24f79a2d, 0x23ce9be0, 0x22ad9d7e, 0x21959f0a, 0x2086a082, 0x1f7ea1e7,
+	0x1e7fa33a, 0x1d87a47a, 0x1c97a5a7, 0x1bafa6c3, 0x1acea7cd, 0x19f4a8c5, 0x1921a9ac, 0x1855aa83,
+	0x178fab49, 0x16d0abff, 0x1617aca5, 0x1564ad3b, 0x14b7adc2, 0x1410ae3b, 0x136eaea5, 0x12d1af00,
+	0x123aaf4e, 0x11a7af8e, 0x111aafc1, 0x1091afe7, 0x100db000, 0x0f8db00c, 0x0f12b00d, 0x0e9bb002,
+	0x0e27afeb, 0x0db8afca, 0x0d4caf9d, 0x0ce4af66, 0x0c7faf24, 0x0c1eaed8, 0x0bbfae82, 0x0b64ae23,
+	0x0b0dadbb, 0x0ab8ad49, 0x0a65accf, 0x0a16ac4c, 0x09c9abc1, 0x097fab2e, 0x0937aa92, 0x08f1a9f0,
+	0x08aea946, 0x086da895, 0x082ea7dc, 0x07f1a71e, 0x07b6a658, 0x077da58d, 0x0746a4bb, 0x0710a3e4,
+	0x06dda307, 0x06aba225, 0x067aa13d, 0x064ba050, 0x061e9f5f, 0x05f29e69, 0x05c79d6e, 0x059e9c6f,
+	0x05769b6c, 0x054f9a66, 0x052a995b, 0x0505984d, 0x04e2973b, 0x04c09627, 0x049f950f, 0x047f93f4,
+	0xcd733274, 0xcce43251, 0xcbc7320d, 0xca1131ad, 0xc7c43137, 0xc4e930b1, 0xc1793024, 0xbd6a2f96,
+	0xb8db2f13, 0xb3c92ea3, 0xae472e4d, 0xa85f2e18, 0xa2452e0f, 0x9c0c2e36, 0x95d82e94, 0x8fb22f2a,
+	0x89cb2ffd, 0x8425310c, 0x7ecc3255, 0x79c633d8, 0x75173590, 0x70bc377b, 0x6cab3994, 0x68e23bd6,
+	0x65573e3e, 0x620140c6, 0x5ee0436b, 0x5bea4628, 0x591a48fb, 0x566d4bde, 0x53dd4ed0, 0x516751cc,
+	0x4f0a54d0, 0x4cc257da, 0x4a8c5ae6, 0x48685df2, 0x465360fc, 0x444e6402, 0x42576702, 0x406c69fb,
+	0x3e8f6cec, 0x3cbc6fd2, 0x3af572ac, 0x3939757a, 0x3789783a, 0x35e37aec, 0x34487d8f, 0x32b78021,
+	0x313082a3, 0x2fb38514, 0x2e408773, 0x2cd689c0, 0x2b778bfb, 0x2a208e24, 0x28d3903a, 0x278f923c,
+	0x2655942c, 0x25239609, 0x23f997d3, 0x22d99989, 0x21c19b2d, 0x20b19cbe, 0x1fa99e3c, 0x1ea99fa8,
+	0x1db1a101, 0x1cc1a247, 0x1bd8a37c, 0x1af6a49f, 0x1a1ba5b1, 0x1947a6b1, 0x187aa7a0, 0x17b4a87f,
+	0x16f3a94d, 0x1639aa0b, 0x1586aab9, 0x14d7ab57, 0x142fabe7, 0x138cac67, 0x12efacd9, 0x1256ad3c,
+	0x11c3ad91, 0x1134add9, 0x10abae13, 0x1025ae40, 0x0fa5ae60, 0x0f28ae74, 0x0eb0ae7c, 0x0e3cae77,
+	0x0dcbae67, 0x0d5eae4c, 0x0cf5ae25, 0x0c90adf4, 0x0c2eadb8, 0x0bcfad71, 0x0b73ad21, 0x0b1aacc7,
+	0x0ac4ac64, 0x0a71abf7, 0x0a21ab81, 0x09d3ab03, 0x0988aa7c, 0x0940a9ed, 0x08f9a956, 0x08b6a8b7,
+	0x0874a811, 0x0834a763, 0x07f7a6ae, 0x07bba5f3, 0x0782a530, 0x074aa468, 0x0714a399, 0x06e0a2c4,
+	0x06aea1e9, 0x067da109, 0x064da024, 0x061f9f39, 0x05f39e49, 0x05c89d55, 0x059f9c5c, 0x05769b5e,
+	0x054f9a5d, 0x05299957, 0x0505984e, 0x04e19741, 0x04bf9631, 0x049d951d, 0x047d9407, 0x045e92ed,
+	0xc5343ab5, 0xc4c33a94, 0xc3dc3a50, 0xc27939f0, 0xc0a6397a, 0xbe4d38ef, 0xbb86385b, 0xb83537c1,
+	0xb472372a, 0xb040369f, 0xab983625, 0xa69735c3, 0xa1413581, 0x9bc03566, 0x961c3577, 0x907135b9,
+	0x8ad5362f, 0x855a36db, 0x800e37bd, 0x7afc38d7, 0x762e3a25, 0x71a93ba8, 0x6d603d59, 0x69603f36,
+	0x659b413c, 0x62114367, 0x5ebc45b2, 0x5b924819, 0x58974a9a, 0x55c04d30, 0x530f4fd9, 0x507b5290,
+	0x4e045554, 0x4ba55821, 0x495e5af4, 0x472c5dcb, 0x450d60a4, 0x4300637d, 0x41036653, 0x3f146926,
+	0x3d356bf2, 0x3b646eb8, 0x399f7175, 0x37e77428, 0x363a76d0, 0x3499796c, 0x33037bfb, 0x31787e7c,
+	0x2ff880ef, 0x2e828353, 0x2d1685a7, 0x2bb487ea, 0x2a5c8a1d, 0x290d8c3e, 0x27c88e4e, 0x268c904d,
+	0x2559923a, 0x242e9414, 0x230d95dd, 0x21f39793, 0x20e29937, 0x1fda9ac9, 0x1ed99c49, 0x1ddf9db7,
+	0x1cee9f13, 0x1c04a05d, 0x1b21a196, 0x1a45a2bd, 0x1970a3d3, 0x18a2a4d8, 0x17daa5cc, 0x1719a6af,
+	0x165da783, 0x15a8a846, 0x14f9a8fa, 0x1450a99e, 0x13acaa33, 0x130daab9, 0x1273ab30, 0x11dfab99,
+	0x114fabf4, 0x10c5ac42, 0x103eac82, 0x0fbdacb4, 0x0f3facda, 0x0ec6acf3, 0x0e50ad00, 0x0ddfad01,
+	0x0d71acf6, 0x0d07acdf, 0x0ca1acbd, 0x0c3eac91, 0x0bdeac59, 0x0b81ac18, 0x0b28abcc, 0x0ad1ab77,
+	0x0a7dab18, 0x0a2caaaf, 0x09deaa3d, 0x0992a9c3, 0x0949a93f, 0x0902a8b4, 0x08bea820, 0x087ba784,
+	0x083ba6e1, 0x07fda636, 0x07c1a584, 0x0787a4cb, 0x074fa40b, 0x0718a345, 0x06e4a278, 0x06b1a1a6,
+	0x0680a0ce, 0x06509ff0, 0x06229f0c, 0x05f59e24, 0x05ca9d36, 0x05a09c43, 0x05779b4c, 0x05509a50,
+	0x0529994f, 0x0504984b, 0x04e19743, 0x04be9636, 0x049c9527, 0x047c9414, 0x045c92fe, 0x043e91e5,
+	0xbd3f42b1, 0xbcdf4290, 0xbc1f424e, 0xbaff41f0, 0xb9794179, 0xb78140ec, 0xb5334054, 0xb2783fb2,
+	0xaf4b3f0d, 0xabbb3e6e, 0xa7d73ddd, 0xa3863d59, 0x9eec3cee, 0x9a093ca0, 0x95013c76, 0x8fd53c75,
+	0x8aa43ca0, 0x857a3cfb, 0x80643d87, 0x7b713e46, 0x76af3f38, 0x7220405c, 0x6dc741af, 0x69ac4330,
+	0x65c444da, 0x621746ac, 0x5e9c48a0, 0x5b524ab5, 0x58354ce7, 0x553d4f31, 0x526d5191, 0x4fbe5404,
+	0x4d315686, 0x4abe5915, 0x48665bae, 0x46245e4f, 0x43fa60f5, 0x41e3639e, 0x3fdf6648, 0x3dec68f1,
+	0x3c0a6b97, 0x3a366e38, 0x387070d4, 0x36b97369, 0x350f75f5, 0x33717877, 0x31df7aef, 0x30587d5b,
+	0x2edc7fba, 0x2d6b820d, 0x2c058451, 0x2aa98686, 0x295788ac, 0x280e8ac3, 0x26cf8cca, 0x259a8ec0,
+	0x246d90a6, 0x2349927b, 0x222e943e, 0x211b95f0, 0x20109792, 0x1f0e9921, 0x1e139aa0, 0x1d1f9c0d,
+	0x1c349d68, 0x1b4f9eb3, 0x1a729fec, 0x199ba114, 0x18cba22c, 0x1802a333, 0x1740a429, 0x1683a510,
+	0x15cda5e6, 0x151ca6ac, 0x1471a763, 0x13cca80b, 0x132ca8a4, 0x1292a92e, 0x11fca9a9, 0x116baa16,
+	0x10dfaa75, 0x1058aac6, 0x0fd5ab0a, 0x0f56ab41, 0x0edcab6a, 0x0e66ab88, 0x0df3ab98, 0x0d85ab9d,
+	0x0d1aab97, 0x0cb2ab84, 0x0c4eab67, 0x0beeab3e, 0x0b90ab0a, 0x0b36aacc, 0x0adfaa84, 0x0a8aaa32,
+	0x0a38a9d6, 0x09e9a970, 0x099da902, 0x0953a88a, 0x090ba80a, 0x08c6a781, 0x0883a6f0, 0x0842a657,
+	0x0804a5b7, 0x07c7a50f, 0x078da460, 0x0754a3a9, 0x071da2ec, 0x06e8a228, 0x06b5a15e, 0x0683a08d,
+	0x06539fb6, 0x06249eda, 0x05f79df7, 0x05cb9d10, 0x05a19c23, 0x05789b32, 0x05509a3c, 0x052a9941,
+	0x05059842, 0x04e0973f, 0x04be9637, 0x049c952d, 0x047b941f, 0x045b930d, 0x043c91f8, 0x041e90e0,
+	0xb5854a6b, 0xb5354a4b, 0xb4964a0a, 0xb3a349ad, 0xb25a4937, 0xb0ba48aa, 0xaec2480f, 0xac754768,
+	0xa9c146ba, 0xa6b8460d, 0xa3554566, 0x9fa644cc, 0x9ba64442, 0x976043ce, 0x92dd4376, 0x8e33433f,
+	0x8972432d, 0x84a94346, 0x7fdf438a, 0x7b2443fb, 0x768a449d, 0x7211456d, 0x6dc3466c, 0x69a04797,
+	0x65b448ed, 0x61f34a6b, 0x5e644c0e, 0x5b024dd4, 0x57cf4fb9, 0x54c251b9, 0x51dd53d3, 0x4f185601,
+	0x4c775843, 0x49f35a94, 0x478c5cf3, 0x453e5f5d, 0x430861ce, 0x40e76446, 0x3edc66c2, 0x3ce3693f,
+	0x3afd6bbc, 0x39276e38, 0x376070b0, 0x35a87324, 0x33fe7591, 0x326177f7, 0x30d27a54, 0x2f4f7ca8,
+	0x2dd77ef1, 0x2c6a812f, 0x2b088360, 0x29b08585, 0x2863879c, 0x272089a4, 0x25e68b9e, 0x24b58d89,
+	0x238f8f65, 0x22709131, 0x215b92ec, 0x204d9498, 0x1f489633, 0x1e4b97bd, 0x1d569937, 0x1c689aa0,
+	0x1b819bf9, 0x1aa29d41, 0x19ca9e79, 0x18f89fa0, 0x182da0b7, 0x1769a1be, 0x16aba2b4, 0x15f3a39b,
+	0x1541a472, 0x1495a53a, 0x13eea5f2, 0x134da69b, 0x12b1a736, 0x121aa7c2, 0x1188a83f, 0x10fba8ae,
+	0x1072a910, 0x0feea964, 0x0f6ea9ab, 0x0ef3a9e4, 0x0e7caa11, 0x0e08aa31, 0x0d99aa45, 0x0d2daa4d,
+	0x0cc5aa49, 0x0c60aa39, 0x0bfeaa1e, 0x0ba0a9f8, 0x0b44a9c7, 0x0aeca98c, 0x0a97a946, 0x0a44a8f7,
+	0x09f4a89d, 0x09a7a83b, 0x095da7d0, 0x0915a75b, 0x08cfa6de, 0x088ba658, 0x084aa5c9, 0x080ba533,
+	0x07cea494, 0x0793a3ee, 0x0759a341, 0x0722a28c, 0x06eda1d0, 0x06b9a10e, 0x0687a045, 0x06569f76,
+	0x06279ea1, 0x05f99dc6, 0x05cd9ce5, 0x05a39bff, 0x05799b15, 0x05519a26, 0x052b9932, 0x05059839,
+	0x04e1973b, 0x04bd9639, 0x049b9533, 0x047a9429, 0x045a931d, 0x043b920e, 0x041d90fd, 0x04008fe8,
+	0xae0f51e5, 0xadcb51c5, 0xad425185, 0xac745129, 0xab5a50b4, 0xa9f95027, 0xa8444f89, 0xa64e4ee0,
+	0xa4044e2d, 0xa1634d76, 0x9e774cc2, 0x9b474c16, 0x97c14b73, 0x94014ae2, 0x90004a65, 0x8bce4a03,
+	0x877749c0, 0x831349a2, 0x7ea249aa, 0x7a2e49da, 0x75c84a35, 0x717c4abd, 0x6d494b6f, 0x693a4c4e,
+	0x65514d56, 0x61934e87, 0x5e004fde, 0x5a925158, 0x575352f3, 0x543854ac, 0x51465681, 0x4e75586e,
+	0x4bc55a70, 0x49335c84, 0x46c15ea9, 0x446860db, 0x42296318, 0x4001655d, 0x3def67aa, 0x3bf069fa,
+	0x3a066c4e, 0x382d6ea2, 0x366570f5, 0x34ac7345, 0x33027592, 0x316777da, 0x2fd87a1b, 0x2e567c54,
+	0x2ce27e84, 0x2b7980ab, 0x2a1b82c8, 0x28c784d9, 0x277e86dd, 0x263f88d5, 0x250a8ac0, 0x23de8c9d,
+	0x22bb8e6c, 0x21a2902c, 0x209191de, 0x1f899380, 0x1e899513, 0x1d919696, 0x1ca09809, 0x1bb7996c,
+	0x1ad69ac0, 0x19fb9c03, 0x19289d37, 0x185b9e5b, 0x17959f6f, 0x16d5a074, 0x161ba168, 0x1567a24e,
+	0x14b9a324, 0x1411a3eb, 0x136ea4a3, 0x12d1a54c, 0x1238a5e6, 0x11a5a673, 0x1117a6f1, 0x108da762,
+	0x1008a7c5, 0x0f88a81a, 0x0f0ba863, 0x0e93a89e, 0x0e1ea8cc, 0x0dada8ed, 0x0d40a903, 0x0cd7a90c,
+	0x0c71a90a, 0x0c0ea8fc, 0x0bafa8e3, 0x0b53a8bf, 0x0afaa891, 0x0aa4a859, 0x0a51a816, 0x0a00a7c9,
+	0x09b3a772, 0x0967a712, 0x091fa6a8, 0x08d8a635, 0x0894a5b9, 0x0852a535, 0x0812a4a8, 0x07d5a413,
+	0x0799a377, 0x075fa2d2, 0x0728a227, 0x06f2a174, 0x06bda0b9, 0x068b9ff8, 0x065a9f33, 0x062a9e66,
+	0x05fc9d94, 0x05d09cbb, 0x05a59bdc, 0x057b9af8, 0x05539a0e, 0x052c9920, 0x05069830, 0x04e1973b,
+	0x04bd9642, 0x049b9544, 0x047a9441, 0x0459933b, 0x043a9230, 0x041c9122, 0x03fe9010, 0x03e28efb,
+	0xa6d5591d, 0xa69e58ff, 0xa62858c0, 0xa5765866, 0xa48157f1, 0xa3575768, 0xa1d756c8, 0xa02b561e,
+	0x9e325568, 0x9be554a8, 0x995953ea, 0x9688532e, 0x9381527c, 0x902751d2, 0x8c9a513a, 0x88d550b5,
+	0x84eb504a, 0x80e04ffd, 0x7cca4fd3, 0x78a54fcb, 0x74824feb, 0x70665032, 0x6c6250a3, 0x6871513b,
+	0x64a051fe, 0x60ee52e7, 0x5d6053f6, 0x59f9552a, 0x56b4567f, 0x539757f5, 0x509b5987, 0x4dc55b33,
+	0x4b0d5cf7, 0x48755ed0, 0x45f760bb, 0x439862b6, 0x415364be, 0x3f2466d2, 0x3d0e68ee, 0x3b0b6b12,
+	0x391d6d3a, 0x37416f66, 0x35787192, 0x33be73bf, 0x321575ea, 0x307a7811, 0x2eed7a34, 0x2d6d7c51,
+	0x2bfb7e67, 0x2a948075, 0x2939827b, 0x27e98476, 0x26a48667, 0x2569884d, 0x24388a27, 0x23108bf4,
+	0x21f28db4, 0x20dd8f66, 0x1fd0910b, 0x1ecc92a2, 0x1dd1942a, 0x1cdd95a4, 0x1bf2970e, 0x1b0e986a,
+	0x1a3199b6, 0x195b9af4, 0x188c9c22, 0x17c39d41, 0x17019e50, 0x16469f51, 0x1590a042, 0x14e0a124,
+	0x1436a1f7, 0x1391a2bc, 0x12f2a373, 0x1259a41b, 0x11c4a4b5, 0x1135a540, 0x10aaa5be, 0x1023a62e,
+	0x0fa1a691, 0x0f23a6e6, 0x0eaaa72e, 0x0e34a76a, 0x0dc2a798, 0x0d54a7bb, 0x0ceaa7d1, 0x0c83a7db,
+	0x0c20a7db, 0x0bc0a7d0, 0x0b63a7b9, 0x0b09a797, 0x0ab2a76a, 0x0a5ea733, 0x0a0da6f1, 0x09bea6a5,
+	0x0972a64f, 0x0929a5f0, 0x08e1a588, 0x089da516, 0x085aa49c, 0x081aa41a, 0x07dca38e, 0x07a0a2fb,
+	0x0766a260, 0x072da1bf, 0x06f7a116, 0x06c2a066, 0x068f9fae, 0x065d9eef, 0x062e9e2a, 0x05ff9d5e,
+	0x05d29c90, 0x05a79bbc, 0x057d9ae3, 0x05549a03, 0x052d991f, 0x05079834, 0x04e29744, 0x04be964f,
+	0x049b9556, 0x047a9457, 0x04599355, 0x043a924e, 0x041b9143, 0x03fe9034, 0x03e18f21, 0x03c58e0b,
+	0x9fde6018, 0x9faa5ffa, 0x9f445fbe, 0x9eaa5f65, 0x9dd55ef2, 0x9cd25e69, 0x9b895dcb, 0x9a0d5d1f,
+	0x98525c65, 0x96565ba3, 0x941a5adc, 0x91a25a16, 0x8eef5955, 0x8bfc5899, 0x88d457eb, 0x8575574b,
+	0x81e556be, 0x7e3e564d, 0x7a7455f6, 0x76a055c0, 0x72c655ad, 0x6ee855bc, 0x6b1155f1, 0x674e564d,
+	0x639b56cf, 0x60045778, 0x5c875845, 0x59295937, 0x55ef5a4b, 0x52d45b80, 0x4fd95cd2, 0x4d015e41,
+	0x4a455fc8, 0x47ab6167, 0x452b6319, 0x42c864de, 0x407c66b2, 0x3e4c6894, 0x3c316a81, 0x3a2d6c77,
+	0x383d6e74, 0x365f7076, 0x3494727c, 0x32db7483, 0x3132768b, 0x2f977891, 0x2e0c7a95, 0x2c8e7c95,
+	0x2b1e7e8f, 0x29ba8083, 0x28618270, 0x27148455, 0x25d28630, 0x249c8802, 0x236f89c9, 0x224b8b85,
+	0x21318d34, 0x201f8ed8, 0x1f17906e, 0x1e1791f8, 0x1d1f9374, 0x1c3094e2, 0x1b499642, 0x1a6a9795,
+	0x199198d9, 0x18c09a0e, 0x17f59b35, 0x17309c4d, 0x16729d56, 0x15ba9e51, 0x15089f3d, 0x145da01b,
+	0x13b7a0eb, 0x1316a1ad, 0x127ba260, 0x11e5a305, 0x1154a39d, 0x10c7a426, 0x103fa4a2, 0x0fbca510,
+	0x0f3ca571, 0x0ec2a5c5, 0x0e4ba60d, 0x0dd8a648, 0x0d69a677, 0x0cfea69b, 0x0c96a6b2, 0x0c32a6be,
+	0x0bd1a6be, 0x0b73a6b2, 0x0b18a69c, 0x0ac0a67a, 0x0a6ba64d, 0x0a19a616, 0x09caa5d5, 0x097da58b,
+	0x0933a536, 0x08eba4d8, 0x08a6a471, 0x0863a400, 0x0822a389, 0x07e3a30a, 0x07a7a281, 0x076ca1f0,
+	0x0733a157, 0x06fca0b6, 0x06c7a00e, 0x06939f62, 0x06619eb1, 0x06319df8, 0x06029d39, 0x05d59c72,
+	0x05aa9ba5, 0x057f9ad2, 0x055699f8, 0x052f9918, 0x05089833, 0x04e39748, 0x04bf9658, 0x049c9563,
+	0x047a9468, 0x04599369, 0x04399266, 0x041b915e, 0x03fd9052, 0x03e08f43, 0x03c48e30, 0x03a98d1a,
+	0x991f66d7, 0x98f166b8, 0x9899667f, 0x98136628, 0x975d65b7, 0x9675652f, 0x955b6493, 0x940463e4,
+	0x9285632b, 0x90ce6268, 0x8ed0619a, 0x8ca060cb, 0x8a385ffe, 0x87a45f37, 0x84cb5e75, 0x81c65dbf,
+	0x7e925d18, 0x7b3a5c86, 0x77c95c0d, 0x74395bad, 0x70a55b6d, 0x6d0b5b4e, 0x696d5b4f, 0x65d45b74,
+	0x624c5bbd, 0x5ed45c2b, 0x5b735cbc, 0x58285d70, 0x54fa5e47, 0x51ec5f3f, 0x4efa6055, 0x4c226187,
+	0x496d62d5, 0x46d1643b, 0x445465b7, 0x41ef6746, 0x3fa568e8, 0x3d716a98, 0x3b556c55, 0x39506e1e,
+	0x375e6ff0, 0x358271c9, 0x33b773a7, 0x31fe7589, 0x3055776d, 0x2ebc7951, 0x2d327b35, 0x2bb67d16,
+	0x2a497ef4, 0x28e780cd, 0x279282a0, 0x2648846d, 0x25098632, 0x23d587ee, 0x22ab89a0, 0x218c8b49,
+	0x20768ce7, 0x1f698e7a, 0x1e649001, 0x1d68917c, 0x1c7492ea, 0x1b89944c, 0x1aa695a1, 0x19cb96e8,
+	0x18f69822, 0x1829994e, 0x17629a6c, 0x16a19b7b, 0x15e79c7e, 0x15349d72, 0x14869e59, 0x13de9f31,
+	0x133b9ffc, 0x129ea0b9, 0x1206a168, 0x1173a209, 0x10e5a29c, 0x105ca322, 0x0fd7a39b, 0x0f56a407,
+	0x0edaa466, 0x0e62a4ba, 0x0deea501, 0x0d7ea53c, 0x0d12a56a, 0x0ca9a58d, 0x0c44a5a3, 0x0be2a5ad,
+	0x0b83a5ac, 0x0b27a5a0, 0x0acfa589, 0x0a79a568, 0x0a26a53c, 0x09d6a505, 0x0989a4c5, 0x093ea47a,
+	0x08f6a429, 0x08b0a3ce, 0x086ca369, 0x082aa2fb, 0x07eba284, 0x07aea204, 0x0772a17d, 0x0739a0f3,
+	0x0702a061, 0x06cc9fc7, 0x06989f25, 0x06669e7b, 0x06359dc9, 0x06069d10, 0x05d89c50, 0x05ac9b89,
+	0x05829abc, 0x055899e8, 0x0530990d, 0x050a982d, 0x04e49747, 0x04c0965b, 0x049d956a, 0x047a9474,
+	0x0459937a, 0x0439927b, 0x041a9177, 0x03fc9070, 0x03df8f65, 0x03c38e56, 0x03a88d42, 0x038d8c2c,
+	0x929a6d5a, 0x92756d3f, 0x92266d05, 0x91b06cb0, 0x91116c41, 0x90436bbb, 0x8f4d6b20, 0x8e1d6a72,
+	0x8cce69b9, 0x8b4868f3, 0x89846821, 0x8791674c, 0x85716677, 0x831f65a4, 0x809864d4, 0x7de2640c,
+	0x7afe6350, 0x77f662a4, 0x74cf620d, 0x718c618b, 0x6e3a6125, 0x6add60db, 0x677c60b1, 0x641760a5,
+	0x60b760ba, 0x5d6660f3, 0x5a24614d, 0x56f761ca, 0x53dc6267, 0x50dc6325, 0x4df76402, 0x4b2e64fd,
+	0x487b6612, 0x45e76742, 0x436c6888, 0x410b69e5, 0x3ec26b54, 0x3c916cd3, 0x3a776e62, 0x38716ffe,
+	0x368271a4, 0x34a57354, 0x32db750a, 0x312476c7, 0x2f7d7887, 0x2de67a49, 0x2c5e7c0c, 0x2ae47dce,
+	0x29787f8e, 0x281a814b, 0x26c88304, 0x258184b7, 0x24468664, 0x2315880a, 0x21ef89a7, 0x20d38b3c,
+	0x1fc08cc7, 0x1eb68e48, 0x1db68fbf, 0x1cbf912a, 0x1bd0928a, 0x1ae893de, 0x1a089525, 0x19309660,
+	0x185f978e, 0x179698af, 0x16d399c4, 0x16179acb, 0x15619bc6, 0x14b19cb2, 0x14079d91, 0x13629e63,
+	0x12c39f27, 0x12299fdd, 0x1194a086, 0x1104a122, 0x107aa1b1, 0x0ff3a234, 0x0f72a2ab, 0x0ef4a315,
+	0x0e7ba373, 0x0e06a3c3, 0x0d94a408, 0x0d26a440, 0x0cbda46b, 0x0c56a48b, 0x0bf3a4a0, 0x0b94a4a9,
+	0x0b37a4a8, 0x0adea49b, 0x0a87a484, 0x0a34a461, 0x09e3a437, 0x0995a404, 0x0949a3c5, 0x0900a37d,
+	0x08b9a32b, 0x0875a2cf, 0x0833a26a, 0x07f3a204, 0x07b5a194, 0x0779a11c, 0x073fa09b, 0x0708a011,
+	0x06d19f7e, 0x069d9ee3, 0x066a9e40, 0x06399d96, 0x060a9ce3, 0x05dc9c2a, 0x05b09b69, 0x05859aa1,
+	0x055b99d2, 0x053298fd, 0x050b9822, 0x04e59741, 0x04c1965b, 0x049d956f, 0x047b947f, 0x045a9389,
+	0x043a928f, 0x041a918f, 0x03fc908c, 0x03df8f84, 0x03c28e78, 0x03a78d6a, 0x038c8c58, 0x03728b43,
+	0x8c5073a7, 0x8c2f7389, 0x8bea7351, 0x8b8272fe, 0x8af57292, 0x8a3e720d, 0x89677176, 0x885770c7,
+	0x872e700e, 0x85d16f47, 0x84476e75, 0x828e6d9c, 0x80a46cbf, 0x7e8c6be2, 0x7c526b0a, 0x79da6a31,
+	0x773e6963, 0x748268a3, 0x719c67f0, 0x6ea16752, 0x6b8e66cb, 0x6872665e, 0x6549660c, 0x621b65d6,
+	0x5eeb65be, 0x5bc065c5, 0x58a365ee, 0x55936637, 0x529566a0, 0x4fa86728, 0x4cd467d0, 0x4a186895,
+	0x47766977, 0x44e76a71, 0x42746b85, 0x401a6caf, 0x3dd56ded, 0x3ba96f3e, 0x3992709e, 0x3791720e,
+	0x35a27389, 0x33c87510, 0x3201769f, 0x304a7835, 0x2ea779d1, 0x2d137b71, 0x2b8d7d12, 0x2a167eb5,
+	0x28ad8057, 0x275181f8, 0x26028395, 0x24be852f, 0x238786c3, 0x22598851, 0x213789d9, 0x201e8b58,
+	0x1f0f8cd0, 0x1e098e3e, 0x1d0d8fa3, 0x1c1990fe, 0x1b2e924e, 0x1a4b9393, 0x196f94cc, 0x189a95fa,
+	0x17cd971c, 0x17079832, 0x1648993c, 0x15909a39, 0x14de9b29, 0x14319c0d, 0x138b9ce3, 0x12e99dac,
+	0x124d9e69, 0x11b79f18, 0x11259fbb, 0x1099a053, 0x1011a0df, 0x0f8ea15e, 0x0f0fa1d0, 0x0e94a236,
+	0x0e1ea28f, 0x0daba2db, 0x0d3ca31c, 0x0cd1a350, 0x0c69a37a, 0x0c05a399, 0x0ba5a3ac, 0x0b47a3b3,
+	0x0aeda3b0, 0x0a96a3a5, 0x0a42a390, 0x09f0a370, 0x09a1a345, 0x0955a310, 0x090ba2d0, 0x08c3a28b,
+	0x087ea241, 0x083ba1ee, 0x07fba190, 0x07bda129, 0x0780a0b9, 0x0746a040, 0x070e9fbd, 0x06d79f32,
+	0x06a29e9e, 0x066f9e02, 0x063e9d5e, 0x060e9cb2, 0x05e09bff, 0x05b39b44, 0x05879a82, 0x055d99b9,
+	0x053598ea, 0x050d9815, 0x04e7973a, 0x04c2965a, 0x049e9573, 0x047c9487, 0x045a9396, 0x043a92a0,
+	0x041b91a6, 0x03fc90a8, 0x03df8fa5, 0x03c28e9e, 0x03a68d93, 0x038c8c84, 0x03728b73, 0x03588a5e,
+	0x863f79b8, 0x8620799e, 0x85e47967, 0x85867915, 0x850978ab, 0x84677828, 0x83a87793, 0x82ba76e6,
+	0x81ab762c, 0x80797566, 0x7f1e7495, 0x7d8d73b6, 0x7bd472d3, 0x79fa71f1, 0x77f6710f, 0x75c1702c,
+	0x73666f4f, 0x70e96e7d, 0x6e486db7, 0x6b876cfe, 0x68b86c5d, 0x65cf6bce, 0x62e26b5b, 0x5fe96b00,
+	0x5ceb6ac0, 0x59eb6a9c, 0x56f26a97, 0x54056ab1, 0x51246aea, 0x4e546b41, 0x4b936bb6, 0x48e86c49,
+	0x46536cf8, 0x43d76dc2, 0x416b6ea3, 0x3f186f9c, 0x3cdd70ac, 0x3ab571ce, 0x38a67303, 0x36a97446,
+	0x34bf7598, 0x32e976f6, 0x3124785d, 0x2f7379ce, 0x2dd07b45, 0x2c3f7cc2, 0x2abe7e43, 0x294b7fc6,
+	0x27e4814a, 0x268c82cd, 0x253f844f, 0x240085ce, 0x22cb8749, 0x21a288c0, 0x20828a30, 0x1f6d8b9a,
+	0x1e628cfd, 0x1d608e58, 0x1c688faa, 0x1b7890f3, 0x1a909232, 0x19b09367, 0x18d99492, 0x180995b3,
+	0x174096c8, 0x167d97d1, 0x15c198cf, 0x150c99c1, 0x145d9aa6, 0x13b49b7f, 0x13119c4c, 0x12739d0d,
+	0x11db9dc2, 0x11489e6c, 0x10b99f0b, 0x10309f9c, 0x0faba021, 0x0f2aa09a, 0x0eaea106, 0x0e36a166,
+	0x0dc2a1ba, 0x0d52a202, 0x0ce6a240, 0x0c7da272, 0x0c18a299, 0x0bb7a2b4, 0x0b58a2c8, 0x0afda2d1,
+	0x0aa5a2cf, 0x0a50a2c2, 0x09fda2aa, 0x09aea287, 0x0960a262, 0x0916a235, 0x08cea1fe, 0x0888a1bc,
+	0x0845a171, 0x0804a11c, 0x07c5a0bd, 0x0788a054, 0x074d9fe2, 0x07149f67, 0x06dd9ee3, 0x06a89e56,
+	0x06749dc1, 0x06439d23, 0x06129c7e, 0x05e49bd0, 0x05b69b1c, 0x058b9a61, 0x0560999f, 0x053798d7,
+	0x050f9808, 0x04e99732, 0x04c49656, 0x04a09575, 0x047d948f, 0x045b93a4, 0x043b92b4, 0x041b91bf,
+	0x03fc90c4, 0x03df8fc6, 0x03c28ec4, 0x03a68dbd, 0x038b8cb3, 0x03718ba4, 0x03588a91, 0x033f897b,
+	0x80617f97, 0x80477f79, 0x80107f45, 0x7fbe7ef6, 0x7f4f7e8d, 0x7ebd7e0c, 0x7e147d79, 0x7d447cd1,
+	0x7c4d7c16, 0x7b3d7b51, 0x7a077a7f, 0x78a0799f, 0x771a78ba, 0x756d77d2, 0x739676e5, 0x71a475fe,
+	0x6f797511, 0x6d397432, 0x6ad6735a, 0x684f728c, 0x65b971d3, 0x630e712b, 0x604e7096, 0x5d89701b,
+	0x5abe6fb9, 0x57ed6f6f, 0x551a6f40, 0x52506f30, 0x4f906f3d, 0x4cdb6f66, 0x4a356fad, 0x479e7010,
+	0x451a7090, 0x42ac712a, 0x405371de, 0x3e0972a8, 0x3bd67389, 0x39b9747f, 0x37ae7588, 0x35ba76a2,
+	0x33d677ca, 0x32057900, 0x30477a41, 0x2e977b8c, 0x2cfa7cdf, 0x2b6d7e39, 0x29ee7f98, 0x288080fc,
+	0x271e8262, 0x25c883c7, 0x2480852d, 0x23448691, 0x221287f2, 0x20ed8950, 0x1fd18aa9, 0x1ec08bfd,
+	0x1db98d4b, 0x1cbb8e92, 0x1bc68fd1, 0x1ad99107, 0x19f69235, 0x191a935b, 0x18469476, 0x17799588,
+	0x16b4968e, 0x15f6978b, 0x153e987b, 0x148c9960, 0x13df9a3a, 0x133a9b08, 0x129a9bcc, 0x12009c87,
+	0x116b9d35, 0x10db9dd7, 0x10509e6d, 0x0fc99ef6, 0x0f479f73, 0x0ec99fe5, 0x0e4fa04a, 0x0ddaa0a6,
+	0x0d69a0f6, 0x0cfba13a, 0x0c91a173, 0x0c2ca1a3, 0x0bc9a1cb, 0x0b6aa1e7, 0x0b0ea1f7, 0x0ab4a1fd,
+	0x0a5ea1f7, 0x0a0ba1ed, 0x09baa1de, 0x096ca1c5, 0x0921a1a0, 0x08d8a172, 0x0892a138, 0x084ea0f5,
+	0x080ca0a7, 0x07cda050, 0x07909fee, 0x07549f83, 0x071b9f0f, 0x06e39e92, 0x06ae9e0c, 0x067a9d7d,
+	0x06479ce6, 0x06179c48, 0x05e89ba1, 0x05ba9af4, 0x058e9a40, 0x05639984, 0x053a98c1, 0x051297f7,
+	0x04eb9727, 0x04c69653, 0x04a19579, 0x047e9498, 0x045c93b2, 0x043b92c7, 0x041c91d7, 0x03fd90e2,
+	0x03df8fe8, 0x03c28eea, 0x03a68de6, 0x038b8cdf, 0x03718bd3, 0x03578ac5, 0x033f89b2, 0x0327889d,
+	0x7aba853f, 0x7aa28521, 0x7a7284ef, 0x7a2884a1, 0x79c5843b, 0x794583bd, 0x78ab832b, 0x77f28285,
+	0x771381cb, 0x76238109, 0x75088035, 0x73cd7f56, 0x726c7e6f, 0x70e77d81, 0x6f417c91, 0x6d7c7ba0,
+	0x6b897aab, 0x697e79c0, 0x675178da, 0x650477fb, 0x629f772b, 0x602a766d, 0x5da075be, 0x5b0d7527,
+	0x586d74a3, 0x55ca7439, 0x532073e6, 0x507873ad, 0x4ddc7392, 0x4b467393, 0x48ba73ae, 0x463b73e6,
+	0x43cc7438, 0x416e74a5, 0x3f24752d, 0x3cec75cc, 0x3ac37681, 0x38af774b, 0x36af7829, 0x34c17919,
+	0x32e77a1a, 0x311d7b29, 0x2f637c43, 0x2dbb7d6a, 0x2c217e99, 0x2a987fd1, 0x291f810f, 0x27b38252,
+	0x26568399, 0x250784e2, 0x23c2862b, 0x22898774, 0x215c88bb, 0x203a8a00, 0x1f228b41, 0x1e158c7e,
+	0x1d128db7, 0x1c198ee9, 0x1b279013, 0x1a3f9138, 0x195f9254, 0x18879369, 0x17b79474, 0x16ee9575,
+	0x162c966d, 0x1571975b, 0x14bc983e, 0x140e9916, 0x136699e5, 0x12c39aab, 0x12269b66, 0x118f9c16,
+	0x10fe9cba, 0x10719d52, 0x0fe89ddf, 0x0f659e60, 0x0ee59ed5, 0x0e6a9f41, 0x0df39fa1, 0x0d809ff6,
+	0x0d11a03f, 0x0ca6a083, 0x0c3fa0bd, 0x0bdca0ea, 0x0b7ba10d, 0x0b1ea124, 0x0ac4a131, 0x0a6da141,
+	0x0a19a144, 0x09c8a13d, 0x0979a12c, 0x092da10f, 0x08e3a0e7, 0x089ca0b5, 0x0857a079, 0x0815a033,
+	0x07d59fe2, 0x07979f88, 0x075c9f24, 0x07229eb6, 0x06ea9e3f, 0x06b49dc0, 0x067f9d39, 0x064c9ca9,
+	0x061b9c12, 0x05ec9b73, 0x05be9acb, 0x05919a1c, 0x05669966, 0x053d98aa, 0x051497e9, 0x04ed9721,
+	0x04c89651, 0x04a3957b, 0x048094a1, 0x045e93c1, 0x043c92db, 0x041c91f0, 0x03fd90ff, 0x03df9009,
+	0x03c28f0e, 0x03a68e0f, 0x038b8d0c, 0x03708c05, 0x03578af9, 0x033e89ea, 0x032688d6, 0x030f87be,
+	0x75488ab1, 0x75308a98, 0x75068a65, 0x74c48a19, 0x746b89b5, 0x73fa893a, 0x736d88aa, 0x72cb8808,
+	0x71ff874e, 0x7126868c, 0x702b85ba, 0x6f1584de, 0x6dd183f2, 0x6c718301, 0x6af9820f, 0x69578115,
+	0x67a0801e, 0x65bc7f25, 0x63c17e33, 0x61a87d47, 0x5f767c65, 0x5d327b93, 0x5adc7acf, 0x58717a1b,
+	0x5604797e, 0x538a78f5, 0x510c7882, 0x4e897826, 0x4c0a77e5, 0x499677c0, 0x472777b4, 0x44c277c3,
+	0x426977eb, 0x401f782f, 0x3de5788b, 0x3bbd7900, 0x39a6798d, 0x379c7a2c, 0x35a47ae1, 0x33c27baa,
+	0x31ef7c83, 0x302e7d6c, 0x2e7d7e62, 0x2cda7f63, 0x2b488070, 0x29c48185, 0x284e82a2, 0x26e883c5,
+	0x259084ed, 0x24438618, 0x23058746, 0x21d18873, 0x20a789a0, 0x1f8a8acc, 0x1e768bf5, 0x1d6d8d1b,
+	0x1c6e8e3d, 0x1b788f59, 0x1a8b9071, 0x19a79183, 0x18cb928c, 0x17f6938e, 0x17299488, 0x16649579,
+	0x15a69662, 0x14ef9740, 0x143d9815, 0x139398e4, 0x12ee99a9, 0x124f9a63, 0x11b69b12, 0x11219bb6,
+	0x10929c4f, 0x10089cdd, 0x0f829d60, 0x0f029dda, 0x0e859e49, 0x0e0d9eac, 0x0d999f05, 0x0d289f5a,
+	0x0cbc9fa3, 0x0c539fe1, 0x0beea014, 0x0b8da03c, 0x0b2fa060, 0x0ad4a081, 0x0a7ca097, 0x0a27a0a2,
+	0x09d5a0a2, 0x0986a097, 0x0939a081, 0x08efa060, 0x08a7a035, 0x08619fff, 0x081f9fbf, 0x07de9f75,
+	0x079f9f21, 0x07639ec4, 0x07299e5d, 0x06f09ded, 0x06ba9d75, 0x06859cf5, 0x06529c6d, 0x06209bdc,
+	0x05f09b42, 0x05c29aa1, 0x059599f9, 0x056a994c, 0x05409897, 0x051797db, 0x04f09717, 0x04ca964f,
+	0x04a59580, 0x048194ab, 0x045f93d0, 0x043e92ee, 0x041d9207, 0x03fe911a, 0x03e09029, 0x03c38f33,
+	0x03a68e39, 0x038b8d39, 0x03708c35, 0x03578b2c, 0x033e8a1f, 0x0325890f, 0x030e87fd, 0x02f786e7,
+	0x70068ff5, 0x6ff18fda, 0x6fca8fa9, 0x6f8f8f5f, 0x6f3f8efd, 0x6edb8e85, 0x6e5b8df6, 0x6dca8d57,
+	0x6d168ca1, 0x6c4d8bde, 0x6b6d8b0e, 0x6a748a34, 0x69508947, 0x68188857, 0x66bf875f, 0x65458661,
+	0x63b48563, 0x61fe8463, 0x60318367, 0x5e46826e, 0x5c458180, 0x5a2b809a, 0x58037fc3, 0x55c97efa,
+	0x53807e42, 0x51327d9e, 0x4ede7d10, 0x4c847c96, 0x4a267c33, 0x47ce7be9, 0x457e7bb9, 0x43337ba3,
+	0x40f37ba5, 0x3ebe7bc0, 0x3c987bf5, 0x3a7f7c42, 0x38777ca6, 0x367f7d20, 0x34937dac, 0x32b97e4d,
+	0x30f27f01, 0x2f397fc4, 0x2d908096, 0x2bf68175, 0x2a6a825e, 0x28ed8352, 0x277e844e, 0x261c8551,
+	0x24c9865b, 0x23828769, 0x22478879, 0x2119898c, 0x1ff58a9e, 0x1eda8bb0, 0x1dcc8cc2, 0x1cc78dd0,
+	0x1bcc8edb, 0x1ada8fe4, 0x19f190e7, 0x191191e4, 0x183992da, 0x176893ca, 0x169f94b2, 0x15dd9592,
+	0x15229669, 0x146f973d, 0x13c29807, 0x131a98c8, 0x1279997f, 0x11dd9a2c, 0x11479ace, 0x10b69b66,
+	0x10299bf3, 0x0fa19c78, 0x0f1f9cf3, 0x0ea09d63, 0x0e279dc9, 0x0db29e2c, 0x0d419e84, 0x0cd39ed1,
+	0x0c699f12, 0x0c029f49, 0x0b9f9f80, 0x0b409fb2, 0x0ae49fd9, 0x0a8c9ff5, 0x0a36a006, 0x09e3a00d,
+	0x0993a008, 0x09459ff8, 0x08fa9fdd, 0x08b29fb8, 0x086c9f88, 0x08289f4f, 0x07e79f0b, 0x07a89ebc,
+	0x076b9e66, 0x07309e06, 0x06f79d9d, 0x06c09d2d, 0x068b9cb3, 0x06579c30, 0x06259ba5, 0x05f59b12,
+	0x05c69a7b, 0x059999db, 0x056d9933, 0x05439883, 0x051a97ce, 0x04f29711, 0x04cc964e, 0x04a79584,
+	0x048394b4, 0x046093dd, 0x043f9300, 0x041f921f, 0x03ff9137, 0x03e1904b, 0x03c38f59, 0x03a78e62,
+	0x038b8d65, 0x03708c64, 0x03568b60, 0x033d8a58, 0x0325894c, 0x030d883c, 0x02f68727, 0x02e0860f,
+	0x6af59506, 0x6ae294ef, 0x6abf94bd, 0x6a8a9474, 0x6a429414, 0x69e7939e, 0x69749312, 0x68f29276,
+	0x685491c4, 0x679b9101, 0x66d59035, 0x65ee8f58, 0x64eb8e6e, 0x63cf8d7c, 0x62938c80, 0x61418b81,
+	0x5fcf8a7c, 0x5e4e897c, 0x5ca18873, 0x5adf8770, 0x590c8677, 0x571d8582, 0x551e849a, 0x531283bf,
+	0x50f282f1, 0x4ecd8236, 0x4c9b818c, 0x4a6880f7, 0x482f8076, 0x45f6800c, 0x43c27fbb, 0x41947f82,
+	0x3f6c7f60, 0x3d4e7f56, 0x3b3b7f66, 0x39367f8d, 0x373e7fca, 0x3555801f, 0x337a8087, 0x31aa8101,
+	0x2feb818f, 0x2e3f8230, 0x2c9f82de, 0x2b0d839a, 0x298a8462, 0x28138534, 0x26ab8610, 0x255086f4,
+	0x240087df, 0x22c088cf, 0x218b89c4, 0x20608aba, 0x1f428bb3, 0x1e2e8cac, 0x1d238da4, 0x1c228e9c,
+	0x1b2c8f91, 0x1a3e9083, 0x19599171, 0x187d925a, 0x17a8933c, 0x16dc9419, 0x161694ef, 0x155895be,
+	0x14a1968b, 0x13f2974f, 0x1348980a, 0x12a498bc, 0x12069965, 0x116d9a03, 0x10d99a99, 0x104b9b26,
+	0x0fc29baa, 0x0f3e9c24, 0x0ebd9c93, 0x0e429d01, 0x0dcb9d65, 0x0d589dbe, 0x0cea9e0e, 0x0c7f9e52,
+	0x0c179e98, 0x0bb39ed9, 0x0b529f0f, 0x0af59f3b, 0x0a9b9f5c, 0x0a459f73, 0x09f19f7e, 0x09a09f7f,
+	0x09529f74, 0x09069f5f, 0x08bd9f40, 0x08779f16, 0x08329ee1, 0x07f09ea3, 0x07b09e5c, 0x07739e0b,
+	0x07379db3, 0x06fe9d51, 0x06c69ce6, 0x06909c71, 0x065c9bf4, 0x062a9b72, 0x05fa9ae9, 0x05cb9a56,
+	0x059d99bb, 0x0571991a, 0x05469872, 0x051d97c2, 0x04f5970b, 0x04ce964d, 0x04a99587, 0x048594bb,
+	0x046293eb, 0x04419314, 0x04209237, 0x04009155, 0x03e2906c, 0x03c48f7d, 0x03a88e89, 0x038c8d93,
+	0x03718c97, 0x03578b97, 0x033d8a91, 0x03258987, 0x030d887a, 0x02f68769, 0x02df8654, 0x02ca853d,
+	0x661299e9, 0x660299d0, 0x65e299a0, 0x65b3995a, 0x657298fc, 0x65219888, 0x64b897ff, 0x64439765,
+	0x63b596b6, 0x630d95f5, 0x625a952b, 0x618a944f, 0x60a7936a, 0x5f9e9274, 0x5e829177, 0x5d519077,
+	0x5bfd8f6c, 0x5aa08e68, 0x591a8d5a, 0x57808c4e, 0x55d38b4a, 0x54108a4b, 0x52358952, 0x504f8867,
+	0x4e5b8788, 0x4c5586b4, 0x4a4f85f6, 0x483e8548, 0x462784ad, 0x440c8424, 0x41f683b4, 0x3fe5835c,
+	0x3dd88319, 0x3bd182ed, 0x39d382d9, 0x37e182dd, 0x35fb82f7, 0x34208326, 0x3254836b, 0x309583c3,
+	0x2ee1842d, 0x2d3d84a9, 0x2ba98536, 0x2a2185d0, 0x28a58677, 0x27388729, 0x25d687e5, 0x248188aa,
+	0x23398977, 0x21fc8a49, 0x20cd8b22, 0x1fa98bfd, 0x1e8f8cdb, 0x1d808dbb, 0x1c7c8e9c, 0x1b808f7d,
+	0x1a8d905b, 0x19a49136, 0x18c3920e, 0x17ea92e1, 0x171a93b0, 0x1651947a, 0x15909540, 0x14d69603,
+	0x142396be, 0x13769771, 0x12d0981c, 0x122f98be, 0x11959958, 0x10ff99ea, 0x106f9a74, 0x0fe39af5,
+	0x0f5d9b6c, 0x0edb9be1, 0x0e5e9c4e, 0x0de59cb2, 0x0d719d0b, 0x0d009d5b, 0x0c949dad, 0x0c2c9dfc,
+	0x0bc69e40, 0x0b659e7a, 0x0b079ea9, 0x0aac9ecf, 0x0a549ee9, 0x09ff9ef9, 0x09ad9efd, 0x095e9ef8,
+	0x09129ee7, 0x08c99ecd, 0x08829ea8, 0x083d9e78, 0x07fa9e41, 0x07b99dff, 0x077b9db6, 0x073f9d63,
+	0x07059d06, 0x06cd9ca0, 0x06969c31, 0x06629bbf, 0x06309b43, 0x05ff9abf, 0x05cf9a32, 0x05a1999f,
+	0x05759904, 0x054a9861, 0x052097b7, 0x04f89704, 0x04d1964a, 0x04ac958b, 0x048794c6, 0x046493fa,
+	0x04429328, 0x0421924f, 0x04029170, 0x03e3908b, 0x03c58fa3, 0x03a88eb5, 0x038c8dc2, 0x03718cca,
+	0x03578bcc, 0x033d8ac9, 0x032489c3, 0x030d88ba, 0x02f587ac, 0x02df869a, 0x02c98583, 0x02b48469,
+	0x615f9e9e, 0x61509e85, 0x61339e56, 0x61089e11, 0x60ce9db6, 0x60849d45, 0x60259cbd, 0x5fbc9c26,
+	0x5f3c9b7a, 0x5ea29aba, 0x5e0199f3, 0x5d47991a, 0x5c7a9837, 0x5b8b9741, 0x5a8d9647, 0x59749542,
+	0x583f9435, 0x56fe932b, 0x55a2921c, 0x54269107, 0x529c8ff9, 0x51018ef2, 0x4f4b8dec, 0x4d898cf1,
+	0x4bbb8c03, 0x49dc8b1e, 0x47f58a4a, 0x46058984, 0x441388d3, 0x421a8831, 0x402087a5, 0x3e28872d,
+	0x3c3686cd, 0x3a488682, 0x3860864d, 0x36828630, 0x34ae8628, 0x32e48635, 0x31278657, 0x2f76868d,
+	0x2dd286d6, 0x2c37872f, 0x2aac8799, 0x29318814, 0x27bf889b, 0x2659892d, 0x250089cb, 0x23b18a71,
+	0x22708b20, 0x213a8bd5, 0x200f8c90, 0x1ef28d52, 0x1dde8e16, 0x1cd48edd, 0x1bd48fa6, 0x1adf906f,
+	0x19f19136, 0x190b91fa, 0x182e92bc, 0x175a937b, 0x168d9435, 0x15c994f0, 0x150c95a6, 0x14569656,
+	0x13a79700, 0x12fd97a2, 0x125a983c, 0x11bc98cf, 0x1125995b, 0x109399e0, 0x10069a5d, 0x0f7d9ad4,
+	0x0efa9b48, 0x0e7a9bb2, 0x0e009c14, 0x0d8b9c6d, 0x0d199cc4, 0x0cab9d1f, 0x0c419d6f, 0x0bda9db5,
+	0x0b779df1, 0x0b199e24, 0x0abd9e4d, 0x0a649e6a, 0x0a0f9e7d, 0x09bc9e86, 0x096c9e84, 0x091e9e77,
+	0x08d49e60, 0x088c9e40, 0x08479e17, 0x08049de4, 0x07c39da9, 0x07849d65, 0x07479d16, 0x070c9cbe,
+	0x06d49c5f, 0x069d9bfb, 0x06689b8d, 0x06359b16, 0x06039a98, 0x05d49a13, 0x05a59985, 0x057998ef,
+	0x054d9851, 0x052397ab, 0x04fb96fd, 0x04d4964b, 0x04ae9591, 0x048a94d1, 0x0466940a, 0x0444933c,
+	0x04239266, 0x0403918d, 0x03e490af, 0x03c68fcb, 0x03a98ee1, 0x038d8df1, 0x03718cfb, 0x03578c01,
+	0x033d8b04, 0x03258a01, 0x030c88fa, 0x02f587ee, 0x02df86dd, 0x02c985c9, 0x02b484b2, 0x029f8398,
+	0x5cd8a324, 0x5ccaa30e, 0x5cb0a2df, 0x5c89a29c, 0x5c54a242, 0x5c12a1d4, 0x5bbca14e, 0x5b5da0ba,
+	0x5aeca013, 0x5a609f55, 0x59cb9e8e, 0x59239db8, 0x586a9cd6, 0x57949be3, 0x56ac9ae8, 0x55a999e1,
+	0x549598d5, 0x536b97c5, 0x523496b6, 0x50d8959a, 0x4f6f9486, 0x4df69376, 0x4c679268, 0x4ac4915f,
+	0x49189062, 0x475f8f70, 0x45958e85, 0x43cb8db0, 0x41f68ce6, 0x401d8c2e, 0x3e408b88, 0x3c648af6,
+	0x3a8a8a79, 0x38b48a11, 0x36e389be, 0x35198980, 0x3359895a, 0x31a18947, 0x2ff38948, 0x2e51895d,
+	0x2cbb8986, 0x2b2f89bf, 0x29ad8a08, 0x283a8a62, 0x26d58acb, 0x25788b3f, 0x24268bbd, 0x22e18c46,
+	0x21a68cd7, 0x20768d70, 0x1f538e10, 0x1e3a8eb6, 0x1d2c8f61, 0x1c299010, 0x1b2f90c0, 0x1a3d9170,
+	0x19559220, 0x187492ce, 0x179b9379, 0x16cb9423, 0x160394cf, 0x15429577, 0x148a961a, 0x13d896b8,
+	0x132b974f, 0x128697df, 0x11e69869, 0x114c98ee, 0x10b7996c, 0x102899e2, 0x0f9e9a59, 0x0f199ac9,
+	0x0e989b30, 0x0e1c9b8e, 0x0da49be6, 0x0d319c49, 0x0cc29ca3, 0x0c579cf4, 0x0bef9d3b, 0x0b8b9d79,
+	0x0b2b9dad, 0x0ace9dd8, 0x0a749df7, 0x0a1e9e0d, 0x09ca9e18, 0x09799e19, 0x092b9e10, 0x08e09dfc,
+	0x08979de1, 0x08519dbc, 0x080d9d8f, 0x07cc9d59, 0x078c9d18, 0x074f9cce, 0x07149c7d, 0x06db9c27,
+	0x06a49bc7, 0x066e9b5e, 0x063b9aed, 0x06099a76, 0x05d899f5, 0x05aa996d, 0x057d98db, 0x05519841,
+	0x052797a1, 0x04fe96fb, 0x04d7964e, 0x04b19599, 0x048c94dd, 0x04689419, 0x0446934f, 0x04259282,
+	0x040491ae, 0x03e590d3, 0x03c78ff3, 0x03aa8f0b, 0x038d8e1f, 0x03728d2e, 0x03578c39, 0x033e8b3e,
+	0x03258a3e, 0x030d8939, 0x02f5882f, 0x02df8722, 0x02c98611, 0x02b384fc, 0x029f83e3, 0x028b82c6,
+	0x587ba77f, 0x5870a76a, 0x5858a73d, 0x5835a6fb, 0x5805a6a3, 0x57c9a637, 0x577ea5b6, 0x5725a523,
+	0x56c0a47f, 0x5643a3c5, 0x55b8a2fd, 0x5525a22e, 0x5478a14a, 0x53bca05c, 0x52e49f5f, 0x51fa9e58,
+	0x51019d4d, 0x4ff19c3b, 0x4ed59b28, 0x4d979a09, 0x4c4d98ef, 0x4af097d6, 0x498596c2, 0x480395ae,
+	0x467494a3, 0x44de93a4, 0x433792ac, 0x418791c1, 0x3fd390e6, 0x3e19901a, 0x3c588f5d, 0x3a958eb2,
+	0x38d68e1b, 0x371a8d99, 0x355f8d2a, 0x33a98cce, 0x31fc8c89, 0x30578c59, 0x2eba8c3b, 0x2d268c31,
+	0x2b9e8c3a, 0x2a208c55, 0x28ac8c80, 0x27428cba, 0x25e68d04, 0x24958d5b, 0x234c8dbc, 0x220e8e27,
+	0x20db8e9c, 0x1fb28f18, 0x1e958f9d, 0x1d839028, 0x1c7b90ba, 0x1b7e9151, 0x1a8991e8, 0x199d9281,
+	0x18b99318, 0x17dd93af, 0x170a9447, 0x163e94e0, 0x157a9578, 0x14be960c, 0x1408969b, 0x135a9726,
+	0x12b297aa, 0x12109829, 0x117398a5, 0x10dd991a, 0x104c998c, 0x0fbf99fd, 0x0f389a66, 0x0eb69ac8,
+	0x0e389b22, 0x0dbf9b82, 0x0d4a9be4, 0x0cd99c3d, 0x0c6c9c8c, 0x0c049cd3, 0x0b9f9d12, 0x0b3e9d47,
+	0x0adf9d71, 0x0a859d92, 0x0a2d9da9, 0x09d89db6, 0x09879db9, 0x09389db2, 0x08ec9da4, 0x08a39d8b,
+	0x085c9d6b, 0x08179d42, 0x07d59d0e, 0x07959cd1, 0x07579c8d, 0x071c9c45, 0x06e29bf3, 0x06aa9b97,
+	0x06759b34, 0x06409aca, 0x060e9a56, 0x05dd99db, 0x05ae9956, 0x058198c9, 0x05559835, 0x052a979b,
+	0x050296fa, 0x04da9652, 0x04b495a1, 0x048f94e8, 0x046b942a, 0x04489368, 0x0426929f, 0x040691cf,
+	0x03e790f7, 0x03c8901a, 0x03ab8f37, 0x038e8e50, 0x03728d63, 0x03588c70, 0x033e8b78, 0x03258a7a,
+	0x030d8978, 0x02f58873, 0x02de8768, 0x02c88658, 0x02b38545, 0x029e842f, 0x028b8317, 0x027781fc,
+	0x544aabb0, 0x5440ab9b, 0x542aab70, 0x540aab2f, 0x53dfaada, 0x53a9aa70, 0x5366a9f3, 0x5314a961,
+	0x52b9a8c1, 0x524ba80b, 0x51cba746, 0x5144a677, 0x50a8a596, 0x4fffa4ac, 0x4f3aa3af, 0x4e69a2ab,
+	0x4d82a19c, 0x4c8ba089, 0x4b839f72, 0x4a6b9e57, 0x49379d34, 0x47f99c17, 0x46ab9afb, 0x454999e0,
+	0x43d898c9, 0x425e97bd, 0x40d996ba, 0x3f4495bd, 0x3daf94d2, 0x3c0e93f1, 0x3a6c9321, 0x38c69261,
+	0x371e91b2, 0x35769115, 0x33d4908d, 0x32349018, 0x309a8fb6, 0x2f078f69, 0x2d7b8f2f, 0x2bf88f07,
+	0x2a7d8ef2, 0x290d8ef0, 0x27a68efd, 0x26488f1a, 0x24f48f45, 0x23ad8f7f, 0x22708fc4, 0x213a9012,
+	0x200f906b, 0x1eee90cd, 0x1dd79135, 0x1ccc91a8, 0x1bcb9221, 0x1ad3929d, 0x19e4931d, 0x18fd939d,
+	0x181e941d, 0x1747949e, 0x16799525, 0x15b395aa, 0x14f3962d, 0x143b96ac, 0x138a9727, 0x12de979e,
+	0x123a9812, 0x119b9882, 0x110298ec, 0x106f9958, 0x0fe199c0, 0x0f589a22, 0x0ed49a7c, 0x0e549ad2,
+	0x0dda9b37, 0x0d649b96, 0x0cf29bec, 0x0c839c39, 0x0c199c7f, 0x0bb39cbc, 0x0b509cf0, 0x0af19d1b,
+	0x0a959d3c, 0x0a3d9d54, 0x09e79d62, 0x09959d66, 0x09459d61, 0x08f89d55, 0x08ae9d40, 0x08679d23,
+	0x08229cfd, 0x07df9ccc, 0x079e9c94, 0x07609c58, 0x07239c12, 0x06e99bc3, 0x06b19b6e, 0x067b9b11,
+	0x06469aaa, 0x06149a3b, 0x05e299c3, 0x05b39942, 0x058598bb, 0x0559982d, 0x052e9798, 0x050596fc,
+	0x04dd9657, 0x04b795aa, 0x049194f8, 0x046d9441, 0x044a9382, 0x042892bc, 0x040891ef, 0x03e8911c,
+	0x03c99044, 0x03ac8f66, 0x038f8e82, 0x03738d98, 0x03588ca7, 0x033e8bb2, 0x03258ab8, 0x030d89ba,
+	0x02f588b6, 0x02de87ad, 0x02c886a1, 0x02b38591, 0x029e847f, 0x028a836a, 0x02778251, 0x02648135,
+	0x5042afba, 0x5038afa4, 0x5025af7a, 0x5008af3b, 0x4fe1aee7, 0x4fb0ae80, 0x4f73ae05, 0x4f28ad76,
+	0x4ed6acd9, 0x4e73ac27, 0x4dfdab63, 0x4d84aa97, 0x4cf7a9ba, 0x4c5fa8d3, 0x4baca7d7, 0x4aeea6d5,
+	0x4a17a5c3, 0x493ba4b3, 0x4847a398, 0x4749a27c, 0x4631a157, 0x450ca034, 0x43d89f12, 0x42969df1,
+	0x41419cd1, 0x3fe19bb9, 0x3e7b9aab, 0x3d0599a3, 0x3b8698a5, 0x3a0597b6, 0x387d96d4, 0x36f095ff,
+	0x3561953b, 0x33d39488, 0x324593e7, 0x30ba9358, 0x2f3392dd, 0x2db39275, 0x2c399221, 0x2ac491dc,
+	0x295891ab, 0x27f6918c, 0x269d917e, 0x254b917e, 0x2402918c, 0x22c391a8, 0x219191d3, 0x20669207,
+	0x1f419242, 0x1e299289, 0x1d1a92da, 0x1c159332, 0x1b1a9391, 0x1a2993f5, 0x193f945b, 0x185e94c3,
+	0x1785952e, 0x16b3959e, 0x15ea960f, 0x1528967f, 0x146e96ec, 0x13b99757, 0x130b97bd, 0x12659823,
+	0x11c49885, 0x112998e3, 0x10939947, 0x100399a5, 0x0f7899fe, 0x0ef39a50, 0x0e729aa7, 0x0df59b07,
+	0x0d7d9b61, 0x0d0a9bb3, 0x0c9a9bfd, 0x0c2f9c40, 0x0bc79c7b, 0x0b639cad, 0x0b039cd6, 0x0aa69cf6,
+	0x0a4c9d0e, 0x09f69d1c, 0x09a39d20, 0x09529d1e, 0x09059d13, 0x08ba9d01, 0x08719ce6, 0x082b9cc1,
+	0x07e89c92, 0x07a79c62, 0x07699c29, 0x072c9be7, 0x06f19b9c, 0x06b89b4c, 0x06819af2, 0x064c9a90,
+	0x06199a24, 0x05e899b0, 0x05b89934, 0x058998b2, 0x055d9829, 0x05329799, 0x050896ff, 0x04e0965e,
+	0x04b995b8, 0x0494950c, 0x04709459, 0x044c939e, 0x042a92db, 0x04099212, 0x03e99144, 0x03cb906f,
+	0x03ad8f95, 0x03908eb4, 0x03748dcc, 0x03598ce0, 0x033f8bee, 0x03258af7, 0x030d89fb, 0x02f588f9,
+	0x02de87f4, 0x02c886ec, 0x02b385e1, 0x029e84d2, 0x028a83bf, 0x027682a8, 0x0263818d, 0x02518071,
+	0x4c62b39b, 0x4c58b384, 0x4c48b35d, 0x4c2db31e, 0x4c0ab2cd, 0x4bddb268, 0x4ba6b1f0, 0x4b62b163,
+	0x4b18b0c9, 0x4abeb01a, 0x4a52af58, 0x49e4ae90, 0x4965adb6, 0x48dbacd1, 0x483babd8, 0x478caad6,
+	0x46c8a9c5, 0x4601a8b7, 0x4523a79c, 0x4439a67d, 0x433ea55a, 0x422ea430, 0x4115a30a, 0x3feda1e4,
+	0x3eb3a0bd, 0x3d6d9f9b, 0x3c209e82, 0x3ac99d70, 0x39629c62, 0x37fc9b65, 0x368b9a71, 0x351a998d,
+	0x33a298b5, 0x322997ed, 0x30b29736, 0x2f3d9691, 0x2dc995fd, 0x2c5b957c, 0x2af2950d, 0x298f94b0,
+	0x28329464, 0x26dc9429, 0x25909400, 0x244c93e5, 0x230f93d9, 0x21da93d9, 0x20af93e6, 0x1f8f9401,
+	0x1e759423, 0x1d63944f, 0x1c5d9487, 0x1b5f94c5, 0x1a6a950b, 0x197f9555, 0x189c95a4, 0x17c095f5,
+	0x16ec964d, 0x162096a8, 0x155c9703, 0x149f975d, 0x13e897b4, 0x1339980a, 0x128f9860, 0x11ec98b3,
+	0x114f9904, 0x10b7995b, 0x102599ae, 0x0f9899fb, 0x0f119a42, 0x0e8f9a9a, 0x0e119af4, 0x0d989b47,
+	0x0d229b93, 0x0cb29bd9, 0x0c459c18, 0x0bdc9c4f, 0x0b779c7e, 0x0b159ca5, 0x0ab79cc3, 0x0a5d9cd9,
+	0x0a059ce5, 0x09b19cea, 0x09609ce9, 0x09129cdf, 0x08c69cce, 0x087d9cb3, 0x08369c8f, 0x07f29c67,
+	0x07b09c39, 0x07719c03, 0x07349bc3, 0x06f99b7f, 0x06bf9b31, 0x06889ada, 0x06529a7b, 0x061f9a12,
+	0x05ed99a2, 0x05bc992c, 0x058e98ae, 0x05619829, 0x0536979b, 0x050c9705, 0x04e4966b, 0x04bc95cb,
+	0x04979522, 0x04729472, 0x044f93ba, 0x042c92fc, 0x040b9238, 0x03eb916e, 0x03cc909d, 0x03ae8fc5,
+	0x03918ee6, 0x03758e03, 0x035a8d1a, 0x033f8c2b, 0x03268b36, 0x030d8a3c, 0x02f6893f, 0x02df883f,
+	0x02c8873b, 0x02b38632, 0x029e8525, 0x028a8414, 0x02768300, 0x026381e9, 0x025180ce, 0x023f7fb0,
+	0x48a8b753, 0x48a0b73f, 0x4890b718, 0x4878b6db, 0x4858b68c, 0x4830b629, 0x47feb5b3, 0x47c0b529,
+	0x477cb492, 0x472bb3e7, 0x46cbb329, 0x4664b261, 0x45f5b18d, 0x4573b0a8, 0x44e7afb6, 0x4444aeb2,
+	0x4395ada5, 0x42deac97, 0x4213ab7b, 0x4139aa58, 0x405ba939, 0x3f61a80c, 0x3e5ea6e1, 0x3d4da5b6,
+	0x3c2fa48b, 0x3b01a360, 0x39cba23c, 0x388fa122, 0x3744a00b, 0x35f29efd, 0x349e9dfd, 0x33429d07,
+	0x31e39c1f, 0x30829b44, 0x2f1f9a79, 0x2dbc99bd, 0x2c5c9913, 0x2b01987b, 0x29a997f5, 0x2856977f,
+	0x2709971a, 0x25c296c6, 0x24829682, 0x234a964e, 0x221a9627, 0x20f1960e, 0x1fce9600, 0x1eb695fe,
+	0x1da79609, 0x1ca0961e, 0x1b9f963a, 0x1aa89660, 0x19bb968c, 0x18d596bd, 0x17f896f4, 0x17239734,
+	0x16559776, 0x158e97ba, 0x14cf97ff, 0x14179843, 0x13649885, 0x12b998c8, 0x1215990b, 0x1175994e,
+	0x10dc9997, 0x104799dc, 0x0fb99a1c, 0x0f2f9a59, 0x0eab9aac, 0x0e2c9afd, 0x0db19b49, 0x0d3b9b8e,
+	0x0cc99bce, 0x0c5b9c08, 0x0bf19c3a, 0x0b8a9c65, 0x0b289c88, 0x0ac99ca3, 0x0a6d9cb6, 0x0a159cc1,
+	0x09bf9cc6, 0x096d9cc2, 0x091e9cba, 0x08d29ca8, 0x08889c8e, 0x08419c6b, 0x07fc9c47, 0x07ba9c1b,
+	0x07799be6, 0x073c9bab, 0x07009b69, 0x06c69b1d, 0x068f9ac9, 0x06599a6c, 0x06259a06, 0x05f2999c,
+	0x05c29928, 0x059398af, 0x0565982d, 0x053a97a2, 0x050f9711, 0x04e7967d, 0x04bf95e0, 0x0499953b,
+	0x0475948e, 0x045193db, 0x042f9320, 0x040d9260, 0x03ed9199, 0x03ce90cb, 0x03af8ff6, 0x03928f1b,
+	0x03768e3b, 0x035a8d55, 0x03408c68, 0x03268b76, 0x030e8a81, 0x02f68989, 0x02df888c, 0x02c8878a,
+	0x02b38684, 0x029e857a, 0x0289846c, 0x0276835b, 0x02638246, 0x0250812d, 0x023e8011, 0x022d7ef2,
+	0x4514baea, 0x450dbad3, 0x44ffbaad, 0x44e9ba72, 0x44cbba25, 0x44a7b9c4, 0x447ab951, 0x4441b8ca,
+	0x4404b836, 0x43bdb790, 0x4363b6d3, 0x4305b60e, 0x42a2b53e, 0x422cb45b, 0x41aeb36e, 0x411ab26c,
+	0x407cb162, 0x3fd0b050, 0x3f1baf38, 0x3e52ae13, 0x3d88acf5, 0x3ca3abc5, 0x3bb5aa98, 0x3abca969,
+	0x39b6a83b, 0x38a0a70a, 0x3781a5de, 0x365ba4ba, 0x352ca39b, 0x33eea27f, 0x32b1a172, 0x316ca06d,
+	0x30269f78, 0x2ed99e8b, 0x2d8a9dad, 0x2c3d9cdf, 0x2af09c20, 0x29a59b71, 0x28609ad6, 0x271d9a49,
+	0x25df99cc, 0x24a5995f, 0x23749903, 0x224898b6, 0x21239876, 0x20059844, 0x1eed981c, 0x1ddd9800,
+	0x1cd797f2, 0x1bdb97f1, 0x1ae397f5, 0x19f197ff, 0x190b9814, 0x182c982d, 0x17559851, 0x16869879,
+	0x15bf98a6, 0x14fd98d4, 0x14439902, 0x13909930, 0x12e2995f, 0x123b998f, 0x119a99c2, 0x110099fb,
+	0x106a9a31, 0x0fd99a63, 0x0f4e9a96, 0x0ec89adf, 0x0e479b26, 0x0dcb9b68, 0x0d539ba5, 0x0ce09bde,
+	0x0c719c11, 0x0c069c3e, 0x0b9f9c64, 0x0b3b9c82, 0x0ada9c98, 0x0a7d9ca7, 0x0a249caf, 0x09ce9cb2,
+	0x097b9cae, 0x092b9ca4, 0x08de9c91, 0x08939c75, 0x084b9c57, 0x08069c33, 0x07c39c08, 0x07839bd5,
+	0x07449b9d, 0x07089b5c, 0x06cd9b12, 0x06959ac0, 0x065f9a65, 0x062a9a04, 0x05f8999c, 0x05c7992c,
+	0x059798b5, 0x056a9835, 0x053e97ae, 0x05139725, 0x04ea9693, 0x04c295f9, 0x049c9556, 0x047794ae,
+	0x045393fe, 0x04319348, 0x040f928b, 0x03ef91c7, 0x03cf90fb, 0x03b1902a, 0x03938f53, 0x03778e75,
+	0x035b8d91, 0x03418ca8, 0x03278bbb, 0x030e8aca, 0x02f689d5, 0x02df88da, 0x02c987dc, 0x02b386d8,
+	0x029e85d1, 0x028984c7, 0x027583b7, 0x026282a3, 0x0250818e, 0x023e8074, 0x022c7f55, 0x021c7e33,
+	0x41a4be5a, 0x419fbe44, 0x4191be1e, 0x417dbde5, 0x4163bd99, 0x4141bd3b, 0x4119bccb, 0x40e4bc46,
+	0x40adbbb5, 0x406ebb13, 0x401fba5c, 0x3fc7b997, 0x3f6cb8ca, 0x3f02b7ea, 0x3e90b701, 0x3e09b601,
+	0x3d78b4f7, 0x3cdab3e6, 0x3c39b2d3, 0x3b81b1ae, 0x3ac7b08e, 0x39fcaf64, 0x391cae2e, 0x3839acff,
+	0x3749abcd, 0x3649aa97, 0x353fa964, 0x342ea837, 0x3317a711, 0x31f3a5ed, 0x30c8a4d1, 0x2f9ca3c2,
+	0x2e68a2bc, 0x2d32a1c2, 0x2bf9a0d5, 0x2abe9ff4, 0x29829f21, 0x284a9e5f, 0x27159dae, 0x25e29d0c,
+	0x24b39c79, 0x23899bf6, 0x22639b82, 0x21449b1c, 0x202b9ac5, 0x1f199a7a, 0x1e0c9a3a, 0x1d069a05,
+	0x1c0899df, 0x1b1399c5, 0x1a2699b3, 0x193d99a6, 0x185c999f, 0x178599a7, 0x16b399b3, 0x15eb99c6,
+	0x152999dc, 0x146e99f4, 0x13b89a0b, 0x130a9a25, 0x12619a41, 0x11bf9a61, 0x11229a88, 0x108b9aad,
+	0x0ff99ad0, 0x0f6d9af8, 0x0ee49b34, 0x0e619b6e, 0x0de49ba7, 0x0d6b9bda, 0x0cf79c09, 0x0c869c35,
+	0x0c1b9c5b, 0x0bb29c7b, 0x0b4e9c93, 0x0aec9ca4, 0x0a8e9cae, 0x0a339cb2, 0x09dc9cb1, 0x09889cab,
+	0x09379c9e, 0x08ea9c8a, 0x089f9c6d, 0x08569c51, 0x08109c2d, 0x07cc9c01, 0x078b9bd1, 0x074d9b9a,
+	0x07109b59, 0x06d59b11, 0x069c9ac0, 0x06659a66, 0x06309a09, 0x05fd99a3, 0x05cc9937, 0x059c98c1,
+	0x056e9844, 0x054297c4, 0x0517973d, 0x04ee96ad, 0x04c69615, 0x049f9577, 0x047a94d1, 0x04569425,
+	0x04339373, 0x041192b8, 0x03f191f7, 0x03d1912f, 0x03b29061, 0x03958f8d, 0x03788eb1, 0x035c8dd0,
+	0x03428ceb, 0x03288c02, 0x030f8b15, 0x02f78a22, 0x02df892b, 0x02c9882e, 0x02b3872f, 0x029e862b,
+	0x02898522, 0x02758414, 0x02628304, 0x024f81f0, 0x023d80d6, 0x022c7fb9, 0x021b7e97, 0x020b7d72,
+	0x3e58c1a3, 0x3e53c190, 0x3e47c16d, 0x3e34c134, 0x3e1cc0ea, 0x3dfec08e, 0x3dd9c020, 0x3daabf9e,
+	0x3d78bf10, 0x3d3ebe71, 0x3cf8bdbf, 0x3ca6bcfc, 0x3c53bc32, 0x3bf4bb56, 0x3b8cba6f, 0x3b13b974,
+	0x3a8db86a, 0x3a00b75d, 0x396cb64b, 0x38c4b527, 0x3816b403, 0x3762b2df, 0x3697b1a9, 0x35c5b076,
+	0x34e6af3f, 0x3400ae09, 0x330aacd0, 0x320dab9b, 0x310baa6e, 0x2ffea944, 0x2ee5a81b, 0x2dcda700,
+	0x2cafa5ee, 0x2b8fa4e9, 0x2a68a3ea, 0x2940a2fa, 0x2818a217, 0x26efa141, 0x25c9a07c, 0x24a99fc8,
+	0x23889f1f, 0x226b9e86, 0x21549dfc, 0x20429d81, 0x1f349d11, 0x1e2c9caf, 0x1d2b9c58, 0x1c2f9c0d,
+	0x1b3a9bd0, 0x1a4d9b9c, 0x19689b73, 0x18899b4f, 0x17af9b35, 0x16dd9b25, 0x16139b1c, 0x15509b18,
+	0x14949b17, 0x13de9b18, 0x132f9b1b, 0x12859b21, 0x11e19b2d, 0x11439b41, 0x10ab9b54, 0x10189b65,
+	0x0f8a9b7f, 0x0f019baf, 0x0e7d9bdb, 0x0dfd9c06, 0x0d829c2e, 0x0d0d9c53, 0x0c9c9c76, 0x0c2f9c93,
+	0x0bc59cab, 0x0b609cbd, 0x0afe9cc8, 0x0a9f9ccc, 0x0a439ccc, 0x09eb9cc5, 0x09959cbb, 0x09449caa,
+	0x08f59c93, 0x08aa9c77, 0x08619c5a, 0x081a9c35, 0x07d69c09, 0x07949bda, 0x07559ba2, 0x07179b62,
+	0x06dc9b1a, 0x06a39ac9, 0x066c9a73, 0x06369a16, 0x060299b3, 0x05d19948, 0x05a198d5, 0x0573985b,
+	0x054697df, 0x051b975a, 0x04f196cd, 0x04c99637, 0x04a2959c, 0x047c94fa, 0x04589451, 0x043593a1,
+	0x041392e9, 0x03f2922b, 0x03d29166, 0x03b4909b, 0x03968fc9, 0x03798eef, 0x035d8e13, 0x03438d33,
+	0x03298c4e, 0x030f8b62, 0x02f78a72, 0x02e0897d, 0x02c98885, 0x02b38788, 0x029e8686, 0x0289857e,
+	0x02758475, 0x02628366, 0x024f8253, 0x023d813a, 0x022c801d, 0x021b7efc, 0x020a7dd8, 0x01fa7cb2,
+	0x3b2fc4cf, 0x3b29c4be, 0x3b1ec498, 0x3b0ec461, 0x3af8c419, 0x3adcc3bf, 0x3abbc354, 0x3a92c2d7,
+	0x3a62c249, 0x3a2ec1ae, 0x39efc0ff, 0x39a3c03e, 0x3958bf77, 0x3901be9e, 0x38a4bdbb, 0x3839bcc6,
+	0x37bdbbbd, 0x3740bab5, 0x36b5b9a1, 0x361eb880, 0x357eb75d, 0x34dbb639, 0x3421b504, 0x3360b3cd,
+	0x3297b297, 0x31c2b15f, 0x30e0b021, 0x2ff6aee7, 0x2f06adb2, 0x2e0fac81, 0x2d0cab52, 0x2c04aa29,
+	0x2afda910, 0x29eda7fb, 0x28dba6f1, 0x27c5a5f2, 0x26ada4fe, 0x2596a418, 0x2481a340, 0x236ea279,
+	0x225ea1be, 0x214fa110, 0x2044a071, 0x1f3f9fe0, 0x1e3d9f5c, 0x1d409ee2, 0x1c499e74, 0x1b599e16,
+	0x1a6d9dc1, 0x19889d76, 0x18aa9d33, 0x17d49cfc, 0x17039ccf, 0x16379ca7, 0x15739c87, 0x14b79c6e,
+	0x14009c56, 0x13509c40, 0x12a69c30, 0x12029c27, 0x11639c26, 0x10c99c26, 0x10359c24, 0x0fa69c2d,
+	0x0f1c9c4d, 0x0e969c6b, 0x0e169c88, 0x0d9a9ca3, 0x0d239cbc, 0x0cb09cd3, 0x0c439ce8, 0x0bd89cf7,
+	0x0b719d00, 0x0b0e9d03, 0x0aaf9d02, 0x0a539cfc, 0x09fa9cf0, 0x09a39ce1, 0x09519ccb, 0x09019caf,
+	0x08b49c92, 0x086b9c72, 0x08249c4b, 0x07e09c20, 0x079d9bf0, 0x075d9bb7, 0x071f9b77, 0x06e39b2f,
+	0x06aa9ade, 0x06729a8a, 0x063c9a2e, 0x060899cc, 0x05d69962, 0x05a698f0, 0x0577987c, 0x054a9801,
+	0x051e977e, 0x04f496f2, 0x04cc965f, 0x04a595c7, 0x047f9528, 0x045b9481, 0x043793d4, 0x0415931e,
+	0x03f49264, 0x03d491a1, 0x03b590d8, 0x03979007, 0x037a8f32, 0x035e8e5a, 0x03438d7d, 0x03298c9b,
+	0x03108bb2, 0x02f88ac5, 0x02e089d4, 0x02c988de, 0x02b387e3, 0x029e86e2, 0x028985df, 0x027584d7,
+	0x026283c9, 0x024f82b6, 0x023d819f, 0x022b8083, 0x021a7f63, 0x020a7e41, 0x01fa7d1e, 0x01ea7bf8,
+	0x3825c7d4, 0x3820c7c3, 0x3817c7a1, 0x3808c76d, 0x37f4c726, 0x37dbc6ce, 0x37bdc666, 0x3798c5ec,
+	0x376cc560, 0x373dc4c8, 0x3704c41d, 0x36bfc35f, 0x367ac29b, 0x3630c1ca, 0x35d7c0e6, 0x3578bff7,
+	0x3507bef1, 0x3496bdeb, 0x3414bcd6, 0x338ebbbb, 0x32fcba98, 0x3266b974, 0x31c2b845, 0x310cb709,
+	0x3054b5d2, 0x2f90b495, 0x2ec1b356, 0x2deab218, 0x2d0bb0db, 0x2c28afa7, 0x2b3bae72, 0x2a43ad3f,
+	0x294cac1a, 0x2850aafc, 0x2752a9e8, 0x264da8da, 0x2548a7d9, 0x2440a6e3, 0x2339a5f9, 0x2236a520,
+	0x2135a455, 0x2034a394, 0x1f36a2e1, 0x1e3da23c, 0x1d47a1a1, 0x1c55a112, 0x1b68a08f, 0x1a82a01d,
+	0x19a19fb2, 0x18c49f4f, 0x17ee9ef5, 0x171f9eac, 0x16579e6b, 0x15939e2e, 0x14d59df7, 0x141e9dc5,
+	0x136e9d98, 0x12c39d6f, 0x121f9d4d, 0x117f9d38, 0x10e69d24, 0x10509d0d, 0x0fc09d03, 0x0f359d11,
+	0x0eaf9d20, 0x0e2e9d2e, 0x0db09d3a, 0x0d389d46, 0x0cc59d51, 0x0c559d5a, 0x0bea9d5f, 0x0b839d5f,
+	0x0b1f9d5a, 0x0abf9d50, 0x0a629d43, 0x0a089d32, 0x09b19d1d, 0x095e9d00, 0x090d9cdf, 0x08c09cc0,
+	0x08759c9c, 0x082d9c72, 0x07e89c47, 0x07a69c15, 0x07659bdb, 0x07279b9a, 0x06eb9b50, 0x06b19b01,
+	0x06789aac, 0x06429a51, 0x060e99ef, 0x05db9985, 0x05aa9916, 0x057c98a5, 0x054e982b, 0x052297a8,
+	0x04f8971d, 0x04cf968e, 0x04a895f8, 0x0482955b, 0x045d94b7, 0x043a940b, 0x04179359, 0x03f692a0,
+	0x03d691e0, 0x03b79118, 0x0398904a, 0x037b8f79, 0x035f8ea5, 0x03448dcb, 0x032a8cea, 0x03118c05,
+	0x02f88b1b, 0x02e18a2e, 0x02ca893a, 0x02b3883f, 0x029e8743, 0x02898641, 0x0275853a, 0x0262842d,
+	0x024f831b, 0x023d8205, 0x022b80ea, 0x021a7fcd, 0x02097eae, 0x01f97d8c, 0x01ea7c67, 0x01db7b42,
+	0x353dcabf, 0x3538caaf, 0x3530ca8c, 0x3522ca58, 0x3510ca13, 0x34f9c9bd, 0x34dec957, 0x34bdc8e0,
+	0x3494c857, 0x346ac7c3, 0x3436c71b, 0x33f9c661, 0x33b8c59e, 0x3376c4d3, 0x3326c3f2, 0x32d2c308,
+	0x326ac204, 0x3201c0ff, 0x318cbfed, 0x3113bed5, 0x308ebdb4, 0x3001bc8d, 0x2f70bb64, 0x2ec9ba28,
+	0x2e21b8f0, 0x2d6db7b2, 0x2cb2b673, 0x2bebb530, 0x2b1db3f0, 0x2a4ab2b5, 0x2970b17b, 0x288cb041,
+	0x27a2af0f, 0x26bcadec, 0x25ccacca, 0x24daabb3, 0x23e4aaa4, 0x22eca99f, 0x21f5a8a7, 0x2100a7bd,
+	0x200ca6e0, 0x1f1ba610, 0x1e29a549, 0x1d3ca490, 0x1c52a3e3, 0x1b6ba33f, 0x1a88a2a9, 0x19ada221,
+	0x18d5a1a2, 0x1801a128, 0x1734a0bd, 0x166ca05e, 0x15aba006, 0x14f09fb6, 0x14399f69, 0x13879f1f,
+	0x12dc9edd, 0x12399ea2, 0x11989e75, 0x10fe9e4c, 0x106a9e22, 0x0fda9e03, 0x0f4d9dfd, 0x0ec59dfa,
+	0x0e439df8, 0x0dc69df6, 0x0d4d9df3, 0x0cd89def, 0x0c689dec, 0x0bfc9de5, 0x0b949ddb, 0x0b2f9dcb,
+	0x0ace9db9, 0x0a709da4, 0x0a169d8b, 0x09bf9d6f, 0x096a9d4d, 0x09199d25, 0x08cb9d02, 0x087f9cda,
+	0x08379cab, 0x07f19c7e, 0x07ae9c4a, 0x076d9c0d, 0x072e9bca, 0x06f29b7f, 0x06b79b30, 0x067f9ada,
+	0x06489a7f, 0x06139a1d, 0x05e099b2, 0x05af9947, 0x058098d6, 0x0552985c, 0x052697db, 0x04fb9752,
+	0x04d296c4, 0x04ab962f, 0x04849594, 0x046094f1, 0x043c9448, 0x04199399, 0x03f892e2, 0x03d89223,
+	0x03b8915d, 0x039a9093, 0x037d8fc6, 0x03608ef4, 0x03458e1c, 0x032b8d3e, 0x03118c5b, 0x02f98b75,
+	0x02e18a8a, 0x02ca8997, 0x02b488a0, 0x029e87a6, 0x028986a5, 0x0275859f, 0x02618493, 0x024f8382,
+	0x023c826d, 0x022b8154, 0x021a803a, 0x02097f1d, 0x01f97dfd, 0x01ea7cdc, 0x01db7bb8, 0x01cc7a92,
+	0x3274cd8b, 0x3270cd7a, 0x3267cd55, 0x325bcd24, 0x324bcce1, 0x3236cc8d, 0x321dcc2a, 0x3200cbb6,
+	0x31dacb2f, 0x31b4ca9e, 0x3187c9fb, 0x314ec944, 0x3114c885, 0x30d7c7bb, 0x308fc6e0, 0x3043c5f8,
+	0x2fe5c4f8, 0x2f84c3f5, 0x2f1cc2e8, 0x2eadc1d1, 0x2e34c0b2, 0x2db3bf8c, 0x2d30be67, 0x2c9abd2c,
+	0x2bfdbbf1, 0x2b5bbab6, 0x2aafb975, 0x29f7b82e, 0x293ab6eb, 0x2876b5a9, 0x27afb46d, 0x26dcb32f,
+	0x2602b1f2, 0x252bb0c6, 0x244caf9c, 0x236cae7b, 0x2285ad60, 0x219eac50, 0x20b5ab48, 0x1fccaa4d,
+	0x1ee7a962, 0x1e03a882, 0x1d1fa7ab, 0x1c3da6df, 0x1b5ea61e, 0x1a82a567, 0x19aba4c0, 0x18d8a422,
+	0x180aa38e, 0x1740a302, 0x167aa284, 0x15bba210, 0x1500a1a2, 0x144da13d, 0x139ea0dc, 0x12f2a07c,
+	0x124ca024, 0x11ad9fe0, 0x11149fa1, 0x107e9f61, 0x0fee9f2b, 0x0f639f12, 0x0edc9efd, 0x0e579ee7,
+	0x0dd99ed4, 0x0d5f9ec1, 0x0cea9eb0, 0x0c799e9e, 0x0c0c9e8a, 0x0ba39e75, 0x0b3e9e5b, 0x0add9e3d,
+	0x0a7e9e1f, 0x0a239dfd, 0x09cb9dda, 0x09769db0, 0x09249d82, 0x08d59d59, 0x088a9d2b, 0x08419cf8,
+	0x07fa9cc7, 0x07b69c8f, 0x07759c4f, 0x07369c09, 0x06f99bbc, 0x06be9b6c, 0x06859b15, 0x064e9aba,
+	0x06199a56, 0x05e699ec, 0x05b49982, 0x05849911, 0x05569897, 0x052a9815, 0x04ff978f, 0x04d69702,
+	0x04ae966e, 0x048795d4, 0x04629533, 0x043e948c, 0x041b93de, 0x03fa9329, 0x03d9926b, 0x03ba91a7,
+	0x039b90e1, 0x037e9018, 0x03618f48, 0x03468e71, 0x032b8d95, 0x03128cb6, 0x02f98bd2, 0x02e18ae8,
+	0x02ca89f8, 0x02b48904, 0x029e880b, 0x0289870c, 0x02758607, 0x026184fc, 0x024e83ec, 0x023c82d8,
+	0x022a81c2, 0x021980aa, 0x02097f8e, 0x01f97e71, 0x01e97d53, 0x01da7c30, 0x01cb7b0a, 0x01bd79e0,
+	0x2fc8d033, 0x2fc4d023, 0x2fbdd002, 0x2fb2cfd2, 0x2fa3cf90, 0x2f90cf3f, 0x2f7acedd, 0x2f5fce6c,
+	0x2f3dcde8, 0x2f1acd5a, 0x2ef2ccbc, 0x2ec1cc0a, 0x2e8acb4b, 0x2e52ca85, 0x2e11c9ad, 0x2dccc8c9,
+	0x2d7ac7d0, 0x2d20c6ce, 0x2cc3c5c6, 0x2c5bc4ae, 0x2bf0c396, 0x2b7ac270, 0x2b02c14b, 0x2a7dc017,
+	0x29ebbed9, 0x2957bd9d, 0x28b7bc5a, 0x2811bb14, 0x2764b9cf, 0x26aeb889, 0x25f6b748, 0x2535b606,
+	0x246cb4c4, 0x23a0b38b, 0x22d5b25e, 0x2201b131, 0x212cb00d, 0x2053aef1, 0x1f77addc, 0x1e9eacd4,
+	0x1dc5abd9, 0x1cedaae9, 0x1c17aa04, 0x1b40a925, 0x1a6da853, 0x199ca78b, 0x18cfa6d1, 0x1806a61f,
+	0x1741a577, 0x1680a4dc, 0x15c2a44a, 0x150aa3c0, 0x1458a33f, 0x13aaa2c3, 0x1303a24d, 0x125fa1dc,
+	0x11bea179, 0x1123a120, 0x1090a0cc, 0x1000a07c, 0x0f75a04c, 0x0eeda025, 0x0e6b9fff, 0x0dec9fd9,
+	0x0d709fb4, 0x0cfb9f92, 0x0c899f72, 0x0c1c9f50, 0x0bb29f2d, 0x0b4c9f07, 0x0aea9ede, 0x0a8c9eb6,
+	0x0a309e8a, 0x09d79e5d, 0x09829e2b, 0x092f9df7, 0x08e09dc6, 0x08939d91, 0x084a9d5a, 0x08039d23,
+	0x07be9ce6, 0x077d9ca3, 0x073d9c59, 0x06ff9c09, 0x06c49bb7, 0x068b9b5e, 0x06549b01, 0x061e9a9c,
+	0x05eb9a32, 0x05b999c8, 0x05899956, 0x055a98dc, 0x052d985a, 0x050297d4, 0x04d89748, 0x04b196b5,
+	0x048a961c, 0x0465957b, 0x044094d7, 0x041d942a, 0x03fc9375, 0x03db92b9, 0x03bb91f8, 0x039d9135,
+	0x037f906e, 0x03638f9f, 0x03478ecb, 0x032c8df1, 0x03138d15, 0x02fa8c33, 0x02e28b4a, 0x02cb8a5d,
+	0x02b4896b, 0x029f8873, 0x028a8775, 0x02758670, 0x02628567, 0x024e8458, 0x023c8347, 0x022a8234,
+	0x0219811d, 0x02088004, 0x01f87eea, 0x01e97dcc, 0x01d97caa, 0x01cb7b84, 0x01bd7a5c, 0x01af7932,
+	0x2d3bd2c0, 0x2d37d2b0, 0x2d30d291, 0x2d26d262, 0x2d18d223, 0x2d07d1d3, 0x2cf3d174, 0x2cdbd105,
+	0x2cbcd084, 0x2c9ccff9, 0x2c79cf5f, 0x2c4dceb2, 0x2c19cdf4, 0x2be7cd31, 0x2badcc5e, 0x2b6dcb7c,
+	0x2b24ca88, 0x2ad4c98b, 0x2a80c886, 0x2a1ec76e, 0x29c0c65c, 0x2954c538, 0x28e4c412, 0x286fc2e5,
+	0x27e9c1a6, 0x2761c06b, 0x26d1bf28, 0x263abde3, 0x2599bc9a, 0x24f3bb52, 0x2447ba0b, 0x2397b8c8,
+	0x22ddb780, 0x221eb63e, 0x2163b50b, 0x209eb3d7, 0x1fd8b2aa, 0x1f0db183, 0x1e41b064, 0x1d73af4e,
+	0x1ca6ae44, 0x1bdbad47, 0x1b11ac53, 0x1a47ab66, 0x197eaa81, 0x18b8a9a9, 0x17f5a8dd, 0x1736a819,
+	0x1679a75f, 0x15c1a6b3, 0x150da60e, 0x145ca56f, 0x13b1a4d9, 0x130aa447, 0x1269a3be, 0x11cda342,
+	0x1132a2d0, 0x109da260, 0x100da1f5, 0x0f84a1b0, 0x0efda174, 0x0e7aa13b, 0x0dfba103, 0x0d81a0ce,
+	0x0d0aa099, 0x0c97a067, 0x0c29a037, 0x0bbfa005, 0x0b599fd2, 0x0af69f9d, 0x0a979f68, 0x0a3c9f32,
+	0x09e39efc, 0x098d9ec1, 0x093a9e83, 0x08ea9e4a, 0x089d9e0e, 0x08529dd0, 0x080b9d93, 0x07c69d51,
+	0x07849d08, 0x07449cbb, 0x07069c68, 0x06ca9c12, 0x06919bb7, 0x06599b57, 0x06239aef, 0x05ef9a86,
+	0x05bd9a1b, 0x058d99a7, 0x055e992c, 0x053198aa, 0x05069823, 0x04dc9797, 0x04b39705, 0x048c966b,
+	0x046795cd, 0x04439529, 0x041f947d, 0x03fd93c9, 0x03dd930d, 0x03bd9250, 0x039e918f, 0x038090c9,
+	0x03648ffc, 0x03488f2a, 0x032d8e54, 0x03138d79, 0x02fa8c98, 0x02e28bb0, 0x02cb8ac6, 0x02b489d5,
+	0x029f88de, 0x028a87e1, 0x027586dd, 0x026185d4, 0x024e84c8, 0x023c83ba, 0x022a82a8, 0x02198193,
+	0x0208807d, 0x01f87f65, 0x01e87e48, 0x01d97d26, 0x01ca7c01, 0x01bc7adb, 0x01ae79b1, 0x01a17884,
+	0x2ac8d533, 0x2ac5d523, 0x2ac0d504, 0x2ab6d4d6, 0x2aaad498, 0x2a9ad44b, 0x2a88d3ee, 0x2a72d382,
+	0x2a56d303, 0x2a39d27b, 0x2a19d1e5, 0x29f2d13c, 0x29c2d080, 0x2994cfc1, 0x2964cef5, 0x2928ce15,
+	0x28e7cd26, 0x289ecc2c, 0x2850cb28, 0x27f8ca14, 0x27a4c906, 0x2742c7e6, 0x26dac6bf, 0x2672c597,
+	0x25f9c45a, 0x257bc31d, 0x24f9c1de, 0x246ec098, 0x23dabf4c, 0x2342be04, 0x22a4bcb9, 0x2202bb73,
+	0x2158ba2a, 0x20a7b8e1, 0x1ff6b7a3, 0x1f44b66e, 0x1e89b535, 0x1dcdb407, 0x1d0db2dd, 0x1c4cb1bb,
+	0x1b8cb0a5, 0x1acdaf99, 0x1a0eae97, 0x1950ad9c, 0x1891aca7, 0x17d6abc1, 0x171eaae3, 0x1667aa0c,
+	0x15b4a945, 0x1504a886, 0x1458a7ce, 0x13b0a71d, 0x130ba671, 0x126ca5cb, 0x11d1a531, 0x113ba4ab,
+	0x10a8a426, 0x1018a3a1, 0x0f8ca339, 0x0f07a2ea, 0x0e86a29f, 0x0e08a254, 0x0d8da20b, 0x0d17a1c4,
+	0x0ca5a182, 0x0c36a141, 0x0bcba0ff, 0x0b64a0bd, 0x0b01a07a, 0x0aa2a038, 0x0a469ff6, 0x09ed9fb5,
+	0x09979f70, 0x09449f2a, 0x08f39ee7, 0x08a59ea1, 0x085b9e5c, 0x08139e19, 0x07cd9dd0, 0x078a9d81,
+	0x074a9d2e, 0x070c9cd7, 0x06d09c7d, 0x06969c1f, 0x065e9bbc, 0x06289b51, 0x05f49ae7, 0x05c19a79,
+	0x05919a04, 0x05629988, 0x05359905, 0x0509987d, 0x04df97f1, 0x04b6975e, 0x048f96c4, 0x04699627,
+	0x04449583, 0x042194d7, 0x03ff9423, 0x03de936a, 0x03be92af, 0x039f91f0, 0x0381912a, 0x0365905e,
+	0x03498f8d, 0x032e8ebb, 0x03148de1, 0x02fb8d01, 0x02e38c1c, 0x02cb8b32, 0x02b58a43, 0x029f894d,
+	0x028a8850, 0x0275874d, 0x02618646, 0x024e853d, 0x023c8430, 0x022a831f, 0x0218820e, 0x020880fa,
+	0x01f87fe2, 0x01e87ec6, 0x01d87da5, 0x01ca7c82, 0x01bb7b5c, 0x01ae7a32, 0x01a07905, 0x019477d6,
+	0x2873d78c, 0x2870d77e, 0x286ad75d, 0x2862d72f, 0x2856d6f3, 0x2848d6a7, 0x2837d64c, 0x2824d5e3,
+	0x280ad567, 0x27f0d4e2, 0x27d4d44f, 0x27b0d3a9, 0x2785d2f2, 0x275bd235, 0x2730d16f, 0x26fad092,
+	0x26c0cfa8, 0x267eceb2, 0x2636cdaf, 0x25e9cca2, 0x259acb94, 0x2543ca79, 0x24e5c953, 0x2486c82f,
+	0x241ac6f7, 0x23a6c5b9, 0x232fc47b, 0x22afc333, 0x2229c1e9, 0x219fc0a0, 0x210dbf53, 0x2077be09,
+	0x1fdcbcbe, 0x1f38bb70, 0x1e92ba2a, 0x1deeb8f0, 0x1d41b7b2, 0x1c93b67b, 0x1be0b548, 0x1b2cb41d,
+	0x1a76b2f8, 0x19c2b1e1, 0x190fb0d1, 0x185cafc9, 0x17a9aec8, 0x16f7add0, 0x1648ace2, 0x159cabfe,
+	0x14f1ab26, 0x144aaa55, 0x13a6a98b, 0x1305a8c6, 0x1267a805, 0x11cfa74e, 0x113ba6ad, 0x10aba612,
+	0x101fa579, 0x0f95a4f1, 0x0f0ea487, 0x0e8ca425, 0x0e10a3c9, 0x0d98a36f, 0x0d21a314, 0x0cafa2bf,
+	0x0c41a26d, 0x0bd6a21d, 0x0b6ea1ca, 0x0b0aa177, 0x0aaba126, 0x0a4fa0d8, 0x09f6a08b, 0x09a0a03b,
+	0x094c9fea, 0x08fc9f9d, 0x08ae9f4f, 0x08629f00, 0x081a9eb4, 0x07d49e63, 0x07919e0e, 0x07509db5,
+	0x07129d59, 0x06d59cfa, 0x069b9c97, 0x06639c31, 0x062d9bc3, 0x05f89b57, 0x05c59ae6, 0x05949a6e,
+	0x056599ef, 0x0538996b, 0x050c98e2, 0x04e29855, 0x04b997c2, 0x04919727, 0x046b968a, 0x044695e5,
+	0x04239539, 0x04019486, 0x03e093ce, 0x03c09315, 0x03a09257, 0x03829191, 0x036590c7, 0x03498ff8,
+	0x032f8f27, 0x03158e4e, 0x02fc8d6f, 0x02e38c8c, 0x02cc8ba3, 0x02b58ab4, 0x029f89bf, 0x028a88c3,
+	0x027587c2, 0x026186bc, 0x024e85b5, 0x023b84aa, 0x0229839b, 0x0218828c, 0x0207817a, 0x01f78063,
+	0x01e77f47, 0x01d87e27, 0x01c97d05, 0x01bb7bdf, 0x01ad7ab6, 0x01a07989, 0x0193785b, 0x01867729,
+	0x2637d9c4, 0x2634d9ba, 0x262fd99b, 0x2627d96e, 0x261dd932, 0x2610d8e9, 0x2601d890, 0x25efd82a,
+	0x25d7d7b0, 0x25c0d72e, 0x25a7d69e, 0x2587d5fc, 0x2561d549, 0x253bd490, 0x2513d3cc, 0x24e3d2f5,
+	0x24aed20e, 0x2475d11e, 0x2431d01c, 0x23eecf15, 0x23a4ce07, 0x2358ccf3, 0x2301cbcf, 0x22aacaaa,
+	0x224ac979, 0x21e0c83c, 0x2174c6fe, 0x2100c5b9, 0x2086c470, 0x2006c324, 0x1f81c1d7, 0x1ef6c089,
+	0x1e69bf3e, 0x1dd3bdee, 0x1d38bca1, 0x1c9fbb5f, 0x1c02ba20, 0x1b5db8de, 0x1ab8b7a5, 0x1a0fb670,
+	0x1965b541, 0x18bdb41e, 0x1813b300, 0x176cb1eb, 0x16c4b0df, 0x161cafd8, 0x1576aedb, 0x14d2adea,
+	0x1431ad02, 0x1392ac1f, 0x12f5ab42, 0x125daa6b, 0x11c6a997, 0x1135a8d8, 0x10a7a826, 0x101da776,
+	0x0f96a6d2, 0x0f13a650, 0x0e92a5d6, 0x0e14a562, 0x0d9ca4f4, 0x0d28a48a, 0x0cb6a420, 0x0c48a3bb,
+	0x0bdea35b, 0x0b77a2fa, 0x0b14a297, 0x0ab2a233, 0x0a56a1d6, 0x09fea17d, 0x09a7a121, 0x0954a0c5,
+	0x0903a06d, 0x08b5a014, 0x086a9fbd, 0x08219f68, 0x07da9f0e, 0x07979eb0, 0x07569e50, 0x07179dee,
+	0x06da9d89, 0x06a09d22, 0x06689cb6, 0x06319c45, 0x05fd9bd7, 0x05ca9b63, 0x05989ae7, 0x05689a65,
+	0x053a99de, 0x050e9953, 0x04e498c4, 0x04bb9830, 0x04949795, 0x046e96f7, 0x04499652, 0x042595a5,
+	0x040294f0, 0x03e1943b, 0x03c19383, 0x03a292c5, 0x03839200, 0x03669136, 0x034a906a, 0x032f8f99,
+	0x03158ec0, 0x02fc8de3, 0x02e48d01, 0x02cc8c19, 0x02b58b2b, 0x029f8a36, 0x028a893b, 0x0275883a,
+	0x02618738, 0x024e8632, 0x023b8527, 0x0229841b, 0x0218830e, 0x020781fd, 0x01f780e6, 0x01e77fcb,
+	0x01d87ead, 0x01c97d8b, 0x01bb7c66, 0x01ad7b3d, 0x019f7a11, 0x019278e2, 0x018677b2, 0x017a767f,
+	0x2414dbeb, 0x2412dbdc, 0x240ddbbe, 0x2406db92, 0x23fddb59, 0x23f1db11, 0x23e4dabb, 0x23d4da56,
+	0x23c0d9e3, 0x23a9d960, 0x2392d8d4, 0x2375d835, 0x2353d786, 0x2331d6d0, 0x230dd610, 0x22e2d53d,
+	0x22b2d459, 0x2280d36f, 0x2244d273, 0x2205d16c, 0x21c1d060, 0x217ecf52, 0x2130ce32, 0x20dfcd0c,
+	0x208ccbe4, 0x202bcaa7, 0x1fc7c96a, 0x1f5fc829, 0x1eefc6de, 0x1e7ac593, 0x1e01c447, 0x1d81c2f7,
+	0x1d00c1aa, 0x1c76c058, 0x1be8bf07, 0x1b57bdbc, 0x1ac9bc7c, 0x1a30bb34, 0x1997b9f4, 0x18f9b8b5,
+	0x185bb77e, 0x17bbb64e, 0x171db526, 0x167fb404, 0x15e2b2ec, 0x1544b1d9, 0x14a7b0ce, 0x140cafd0,
+	0x1373aed8, 0x12dbade2, 0x1248acf5, 0x11b6ac0a, 0x1127ab2a, 0x109caa60, 0x1015a99a, 0x0f91a8d8,
+	0x0f0fa83a, 0x0e92a7ae, 0x0e17a726, 0x0d9ea6a1, 0x0d29a620, 0x0cb9a5a5, 0x0c4da52e, 0x0be4a4bb,
+	0x0b7da449, 0x0b1aa3d8, 0x0abaa364, 0x0a5ca2f6, 0x0a03a28b, 0x09ada224, 0x095aa1bb, 0x0909a158,
+	0x08bba0f5, 0x0870a092, 0x0827a032, 0x07e09fd1, 0x079c9f6b, 0x075b9f01, 0x071b9e97, 0x06df9e2c,
+	0x06a49dbf, 0x066c9d4d, 0x06359cd8, 0x06009c66, 0x05cd9bee, 0x059c9b6f, 0x056c9ae9, 0x053e9a61,
+	0x051199d1, 0x04e6993f, 0x04bd98a9, 0x0496980e, 0x0470976f, 0x044b96c9, 0x0427961b, 0x04049566,
+	0x03e294b1, 0x03c293f9, 0x03a3933b, 0x03849276, 0x036791ad, 0x034b90e2, 0x03309011, 0x03168f39,
+	0x02fc8e5d, 0x02e48d7b, 0x02cc8c94, 0x02b58ba6, 0x029f8ab2, 0x028a89b7, 0x027588b8, 0x026187b7,
+	0x024e86b3, 0x023b85aa, 0x022984a0, 0x02178394, 0x02068283, 0x01f6816c, 0x01e78053, 0x01d77f36,
+	0x01c87e14, 0x01ba7cf0, 0x01ac7bc7, 0x019f7a9c, 0x0192796e, 0x0185783e, 0x0179770b, 0x016d75d8,
+	0x220addf0, 0x2208dde3, 0x2204ddc9, 0x21fedd9e, 0x21f5dd66, 0x21ebdd20, 0x21dedccc, 0x21d0dc6a,
+	0x21bfdbfa, 0x21aadb7a, 0x2195daf0, 0x217dda58, 0x215ed9ac, 0x213dd8f7, 0x211dd83a, 0x20f6d76b,
+	0x20cbd68b, 0x209ed5a6, 0x206ad4b0, 0x2030d3ab, 0x1ff3d2a3, 0x1fb7d19a, 0x1f71d07d, 0x1f26cf5a,
+	0x1eddce36, 0x1e87ccfe, 0x1e2acbc0, 0x1dccca82, 0x1d65c937, 0x1cfcc7ee, 0x1c8dc6a2, 0x1c18c550,
+	0x1b9fc3ff, 0x1b23c2af, 0x1aa0c15b, 0x1a19c00a, 0x1994bec3, 0x190bbd7c, 0x187abc31, 0x17e8baed,
+	0x1754b9ad, 0x16bfb872, 0x162cb740, 0x1596b613, 0x1503b4ef, 0x1470b3cf, 0x13dcb2bc, 0x1349b1af,
+	0x12b8b0a6, 0x1229afa1, 0x119caea1, 0x1112ada5, 0x108bacc1, 0x1006abe4, 0x0f85ab0a, 0x0f06aa4b,
+	0x0e8ba9a8, 0x0e13a90b, 0x0d9da874, 0x0d2aa7e0, 0x0cb9a74d, 0x0c4da6c0, 0x0be5a63c, 0x0b81a5bb,
+	0x0b1ea539, 0x0abea4b6, 0x0a61a437, 0x0a08a3bb, 0x09b1a344, 0x095ea2cc, 0x090ea25f, 0x08c0a1ef,
+	0x0875a180, 0x082ca117, 0x07e5a0ab, 0x07a1a03b, 0x075f9fc9, 0x07209f57, 0x06e39ee4, 0x06a79e6e,
+	0x066f9df7, 0x06399d7d, 0x06039d06, 0x05d09c89, 0x059f9c07, 0x056e9b7c, 0x05409af0, 0x05149a5e,
+	0x04e999c8, 0x04bf992f, 0x04979892, 0x047197f2, 0x044c974a, 0x0428969b, 0x040695e6, 0x03e49531,
+	0x03c39478, 0x03a393b9, 0x038592f4, 0x0368922d, 0x034c9162, 0x03309090, 0x03168fb9, 0x02fd8edd,
+	0x02e48dfc, 0x02cc8d15, 0x02b58c27, 0x029f8b33, 0x028a8a39, 0x0275893c, 0x0261883c, 0x024d8738,
+	0x023b8632, 0x02298529, 0x0217841d, 0x0206830d, 0x01f681f8, 0x01e680df, 0x01d77fc2, 0x01c87ea1,
+	0x01ba7d7c, 0x01ac7c55, 0x019e7b2a, 0x019179fd, 0x018578cd, 0x0178779b, 0x016d7668, 0x01617533,
+	0x2018dfe3, 0x2016dfd4, 0x2013dfbc, 0x200ddf92, 0x2005df5c, 0x1ffcdf17, 0x1ff1dec5, 0x1fe4de66,
+	0x1fd5ddf9, 0x1fc1dd7b, 0x1faedcf5, 0x1f99dc61, 0x1f7fdbbb, 0x1f5fdb06, 0x1f42da4c, 0x1f23d985,
+	0x1efad8a6, 0x1ed2d7c6, 0x1ea3d6d5, 0x1e6dd5d0, 0x1e39d4d1, 0x1e01d3c8, 0x1dc4d2b3, 0x1d80d190,
+	0x1d3cd06e, 0x1cefcf3c, 0x1c9cce00, 0x1c46ccc3, 0x1beacb7d, 0x1b89ca33, 0x1b24c8e6, 0x1abac795,
+	0x1a4bc644, 0x19dac4f2, 0x1962c39e, 0x18e6c24a, 0x1869c0fb, 0x17ecbfb3, 0x1765be62, 0x16dfbd18,
+	0x1655bbd0, 0x15c9ba8b, 0x153eb94d, 0x14b4b818, 0x1429b6e8, 0x139fb5bf, 0x1314b4a1, 0x1289b386,
+	0x1201b26e, 0x1179b157, 0x10f4b046, 0x1071af45, 0x0ff0ae52, 0x0f72ad63, 0x0ef7ac82, 0x0e7fabc5,
+	0x0e09ab13, 0x0d95aa67, 0x0d26a9c1, 0x0cb8a91d, 0x0c4ca87c, 0x0be2a7dd, 0x0b7fa74b, 0x0b1ea6bb,
+	0x0ac0a62a, 0x0a63a598, 0x0a0aa509, 0x09b4a484, 0x0961a3fd, 0x0910a380, 0x08c3a303, 0x0878a289,
+	0x0830a215, 0x07e9a19e, 0x07a5a125, 0x0763a0a8, 0x0723a02d, 0x06e69fb2, 0x06ab9f34, 0x06729eb5,
+	0x063b9e34, 0x06069db8, 0x05d39d36, 0x05a19caf, 0x05719c21, 0x05429b8f, 0x05169af9, 0x04eb9a60,
+	0x04c199c4, 0x04999924, 0x04729880, 0x044d97d6, 0x04299725, 0x04079670, 0x03e595bb, 0x03c49502,
+	0x03a49441, 0x0386937b, 0x036892b4, 0x034c91e9, 0x03319117, 0x03169040, 0x02fd8f64, 0x02e48e83,
+	0x02cc8d9c, 0x02b68cae, 0x029f8bba, 0x028a8ac0, 0x027589c5, 0x026188c7, 0x024d87c3, 0x023a86bf,
+	0x022885b7, 0x021784ab, 0x0206839b, 0x01f58287, 0x01e6816f, 0x01d68052, 0x01c77f32, 0x01b97e0d,
+	0x01ab7ce6, 0x019e7bbc, 0x01917a8f, 0x01847960, 0x0178782f, 0x016c76fc, 0x016075c7, 0x0155748f,
+	0x1e3ee1bf, 0x1e3ce1b0, 0x1e38e198, 0x1e33e16f, 0x1e2ce13a, 0x1e24e0f7, 0x1e1ae0a8, 0x1e0ee04a,
+	0x1e00dfe0, 0x1defdf65, 0x1ddedee2, 0x1dccde51, 0x1db4ddb0, 0x1d97dcfd, 0x1d7ddc47, 0x1d62db86,
+	0x1d3ddaab, 0x1d1ad9d0, 0x1cefd8e2, 0x1cbdd7e0, 0x1c91d6e7, 0x1c5dd5de, 0x1c27d4cf, 0x1bead3b1,
+	0x1baad28e, 0x1b69d164, 0x1b1dd02b, 0x1aceceee, 0x1a7ccdad, 0x1a22cc60, 0x19c7cb17, 0x1967c9c9,
+	0x1902c875, 0x1899c722, 0x182cc5ce, 0x17bac476, 0x1745c322, 0x16d2c1d7, 0x1658c086, 0x15dabf33,
+	0x155bbde5, 0x14d8bc97, 0x1456bb4f, 0x13d5ba13, 0x1352b8d5, 0x12d2b7a8, 0x1250b67e, 0x11ceb555,
+	0x114cb42d, 0x10ccb307, 0x104eb1e6, 0x0fd2b0e0, 0x0f59afde, 0x0ee1aede, 0x0e6bae04, 0x0df9ad3e,
+	0x0d88ac7d, 0x0d1aabc2, 0x0cafab0c, 0x0c46aa5a, 0x0bdfa9a9, 0x0b7ba8fd, 0x0b1aa85a, 0x0abea7b9,
+	0x0a64a71a, 0x0a0ba67d, 0x09b4a5e2, 0x0962a54c, 0x0912a4bf, 0x08c4a434, 0x087aa3ac, 0x0831a32b,
+	0x07eba2ab, 0x07a8a228, 0x0765a1a0, 0x0726a11a, 0x06e8a095, 0x06ada00e, 0x06749f88, 0x063d9eff,
+	0x06089e7b, 0x05d59df5, 0x05a39d68, 0x05739cd5, 0x05459c3f, 0x05189ba4, 0x04ec9b06, 0x04c29a65,
+	0x049a99c3, 0x0474991d, 0x044e986f, 0x042a97bb, 0x04079704, 0x03e6964f, 0x03c59595, 0x03a594d3,
+	0x0387940c, 0x03699345, 0x034c9278, 0x033191a5, 0x031790d0, 0x02fd8ff3, 0x02e48f11, 0x02cc8e29,
+	0x02b58d3b, 0x029f8c47, 0x028a8b4f, 0x02758a54, 0x02618956, 0x024d8854, 0x023a8751, 0x0228864a,
+	0x0216853e, 0x0205842e, 0x01f5831a, 0x01e58202, 0x01d680e6, 0x01c77fc6, 0x01b97ea2, 0x01ab7d7b,
+	0x019d7c52, 0x01907b25, 0x018379f6, 0x017778c6, 0x016b7794, 0x0160765e, 0x01557526, 0x014a73ed,
+	0x1c79e383, 0x1c78e374, 0x1c74e35e, 0x1c70e336, 0x1c69e302, 0x1c62e2c1, 0x1c59e273, 0x1c4ee219,
+	0x1c42e1b1, 0x1c32e138, 0x1c23e0b8, 0x1c13e02c, 0x1bfedf8d, 0x1be3dede, 0x1bcbde2b, 0x1bb4dd6f,
+	0x1b93dc98, 0x1b74dbc1, 0x1b50dada, 0x1b22d9dc, 0x1af9d8e5, 0x1ac9d7de, 0x1a9bd6d6, 0x1a64d5bc,
+	0x1a2bd49b, 0x19f0d377, 0x19aed243, 0x1965d106, 0x191bcfc8, 0x18c8ce7c, 0x1878cd37, 0x1820cbe9,
+	0x17c2ca94, 0x1762c940, 0x1700c7ed, 0x1698c695, 0x162dc53d, 0x15c1c3eb, 0x1553c29b, 0x14ddc141,
+	0x1467bfed, 0x13eebe98, 0x1373bd46, 0x12fbbc00, 0x1282babc, 0x1209b986, 0x1190b851, 0x1115b71b,
+	0x109bb5e3, 0x1023b4b0, 0x0fabb38a, 0x0f37b276, 0x0ec4b162, 0x0e52b065, 0x0de2af87, 0x0d75aeb2,
+	0x0d0aade4, 0x0ca1ad1a, 0x0c3bac56, 0x0bd7ab94, 0x0b75aad6, 0x0b15aa1d, 0x0ab7a968, 0x0a5fa8b7,
+	0x0a08a80c, 0x09b4a762, 0x0961a6bb, 0x0911a61b, 0x08c4a583, 0x0879a4eb, 0x0832a45e, 0x07eca3d0,
+	0x07a8a342, 0x0767a2b2, 0x0728a21f, 0x06eaa191, 0x06afa0ff, 0x0675a06f, 0x063f9fde, 0x060a9f54,
+	0x05d69ec6, 0x05a49e33, 0x05749d9a, 0x05469d00, 0x05199c60, 0x04ee9bbd, 0x04c49b16, 0x049b9a70,
+	0x047499c5, 0x044f9915, 0x042b985f, 0x040897a5, 0x03e696ee, 0x03c59632, 0x03a6956f, 0x038794a7,
+	0x036a93df, 0x034d9311, 0x0331923d, 0x03179167, 0x02fd9089, 0x02e48fa6, 0x02cc8ebd, 0x02b58dcf,
+	0x029f8cda, 0x02898be3, 0x02758aea, 0x026089ec, 0x024d88eb, 0x023a87e8, 0x022886e1, 0x021685d6,
+	0x020584c6, 0x01f483b3, 0x01e4829a, 0x01d5817e, 0x01c6805e, 0x01b87f3b, 0x01aa7e15, 0x019d7cec,
+	0x018f7bc0, 0x01837a91, 0x01767961, 0x016b782f, 0x015f76f9, 0x015475c1, 0x01497488, 0x013f734c,
+	0x1acae532, 0x1ac8e524, 0x1ac6e50e, 0x1ac1e4e8, 0x1abce4b5, 0x1ab5e475, 0x1aace42a, 0x1aa3e3d1,
+	0x1a98e36c, 0x1a89e2f6, 0x1a7ce279, 0x1a6ee1f0, 0x1a5be155, 0x1a44e0aa, 0x1a2fdffc, 0x1a19df42,
+	0x19fcde6f, 0x19e0dd9c, 0x19c0dcba, 0x1999dbc2, 0x1972dacb, 0x1948d9cb, 0x1920d8c8, 0x18eed7b1,
+	0x18bad693, 0x1886d572, 0x184bd444, 0x1809d30a, 0x17c6d1ce, 0x177dd087, 0x1732cf41, 0x16e2cdf3,
+	0x168ecca2, 0x1637cb4d, 0x15ddc9fa, 0x157ec8a1, 0x151bc746, 0x14b6c5ef, 0x1452c49d, 0x13e7c343,
+	0x1378c1e6, 0x1309c08c, 0x1296bf32, 0x1226bde3, 0x11b6bc9b, 0x1144bb59, 0x10d3ba1a, 0x1061b8d8,
+	0x0feeb793, 0x0f7cb650, 0x0f0cb529, 0x0e9eb403, 0x0e31b2e8, 0x0dc6b1f1, 0x0d5bb107, 0x0cf4b025,
+	0x0c8eaf49, 0x0c2aae71, 0x0bc9ad9e, 0x0b69accd, 0x0b0cac02, 0x0ab1ab3c, 0x0a58aa77, 0x0a01a9b7,
+	0x09afa8fe, 0x095ea849, 0x090fa797, 0x08c2a6ee, 0x0878a648, 0x0830a5aa, 0x07eba510, 0x07a8a477,
+	0x0767a3da, 0x0728a33c, 0x06eba2a5, 0x06b0a209, 0x0676a16e, 0x063fa0d2, 0x060aa03e, 0x05d79fab,
+	0x05a69f12, 0x05759e73, 0x05479dd1, 0x051a9d2b, 0x04ee9c83, 0x04c59bd7, 0x049c9b2d, 0x04759a7d,
+	0x044f99c8, 0x042b990f, 0x04099854, 0x03e7979a, 0x03c696dc, 0x03a69616, 0x0387954c, 0x036a9484,
+	0x034d93b4, 0x033192de, 0x03179207, 0x02fd9128, 0x02e49044, 0x02cc8f5a, 0x02b58e6b, 0x029f8d76,
+	0x02898c7f, 0x02748b86, 0x02608a88, 0x024c8988, 0x023a8886, 0x0227877f, 0x02158673, 0x02048563,
+	0x01f48450, 0x01e48337, 0x01d4821b, 0x01c680fc, 0x01b77fd8, 0x01a97eb3, 0x019c7d8a, 0x018f7c5f,
+	0x01827b30, 0x01767a00, 0x016a78cd, 0x015e7797, 0x0153765f, 0x01497526, 0x013e73eb, 0x013472ae,
+	0x1930e6cf, 0x192ee6c0, 0x192ce6aa, 0x1928e684, 0x1923e653, 0x191ce615, 0x1915e5cb, 0x190ce575,
+	0x1903e512, 0x18f5e49e, 0x18eae425, 0x18dde39f, 0x18cce308, 0x18b8e261, 0x18a5e1b6, 0x1891e0ff,
+	0x1877e030, 0x185edf61, 0x1843de86, 0x1820dd92, 0x17fcdc9d, 0x17d9dba4, 0x17b3daa2, 0x1789d994,
+	0x1759d876, 0x1729d758, 0x16f6d631, 0x16bbd4fa, 0x167ed3bf, 0x163dd27e, 0x15f7d135, 0x15b1cfed,
+	0x1566ce9e, 0x1515cd48, 0x14c2cbf3, 0x146dca9d, 0x1412c941, 0x13b5c7e6, 0x1359c691, 0x12f8c537,
+	0x1291c3d3, 0x122ac274, 0x11c0c113, 0x1157bfb9, 0x10eebe6e, 0x1085bd24, 0x101bbbd9, 0x0fb1ba8c,
+	0x0f44b937, 0x0edab7f5, 0x0e71b6c1, 0x0e07b588, 0x0da2b475, 0x0d3cb379, 0x0cd7b283, 0x0c75b194,
+	0x0c14b0aa, 0x0bb6afc5, 0x0b58aee2, 0x0afeae05, 0x0aa5ad2c, 0x0a4eac58, 0x09f9ab85, 0x09a6aab7,
+	0x0956a9f1, 0x090aa930, 0x08bea879, 0x0875a7c2, 0x082da712, 0x07e8a66b, 0x07a6a5c4, 0x0766a51e,
+	0x0727a473, 0x06eaa3cf, 0x06b0a32b, 0x0677a285, 0x063fa1de, 0x060aa13f, 0x05d7a0a3, 0x05a5a003,
+	0x05769f5e, 0x05479eb7, 0x051a9e0a, 0x04ee9d5a, 0x04c59ca8, 0x049d9bf9, 0x04769b45, 0x04509a8c,
+	0x042b99cc, 0x0408990e, 0x03e79851, 0x03c69791, 0x03a796ca, 0x038895fe, 0x036a9532, 0x034d9461,
+	0x0331938a, 0x031792b0, 0x02fd91d0, 0x02e490eb, 0x02cc8fff, 0x02b58f0e, 0x029e8e18, 0x02898d23,
+	0x02748c29, 0x02608b2b, 0x024c8a2c, 0x0239892a, 0x02278822, 0x02158716, 0x02048606, 0x01f384f3,
+	0x01e383da, 0x01d482bd, 0x01c5819e, 0x01b7807b, 0x01a97f56, 0x019b7e2d, 0x018e7d01, 0x01817bd4,
+	0x01757aa3, 0x01697970, 0x015e783a, 0x01537702, 0x014875c8, 0x013e748d, 0x01347350, 0x012a7211,
+	0x17a9e853, 0x17a8e84b, 0x17a5e830, 0x17a2e80d, 0x179de7dd, 0x1797e7a1, 0x1791e759, 0x1789e704,
+	0x1781e6a4, 0x1774e633, 0x176ae5bc, 0x175fe53a, 0x1750e4a6, 0x173ee402, 0x172de35b, 0x171ce2a8,
+	0x1706e1e0, 0x16efe113, 0x16d7e03c, 0x16b9df4e, 0x1697de5a, 0x167add6a, 0x1656dc68, 0x1632db60,
+	0x1608da49, 0x15dcd92b, 0x15b0d80b, 0x157cd6d9, 0x1543d59f, 0x150ad463, 0x14c9d318, 0x148cd1d7,
+	0x1447d088, 0x13fdcf33, 0x13b2cdde, 0x1365cc89, 0x1313cb2d, 0x12bdc9d0, 0x1267c875, 0x120fc71a,
+	0x11b1c5b4, 0x1150c44c, 0x10efc2e8, 0x108cc186, 0x102cc036, 0x0fcabee5, 0x0f66bd8e, 0x0f04bc35,
+	0x0e9fbad5, 0x0e3bb992, 0x0dd8b84d, 0x0d75b717, 0x0d14b603, 0x0cb5b4fc, 0x0c57b3fb, 0x0bf8b2fe,
+	0x0b9db209, 0x0b43b115, 0x0aebb025, 0x0a94af3a, 0x0a40ae55, 0x09edad72, 0x099cac94, 0x094dabb9,
+	0x0900aae4, 0x08b7aa1e, 0x086fa959, 0x0829a899, 0x07e4a7e3, 0x07a1a72b, 0x0762a678, 0x0724a5c4,
+	0x06e8a513, 0x06aea464, 0x0675a3b2, 0x063ea302, 0x0609a257, 0x05d6a1b1, 0x05a4a109, 0x0574a05b,
+	0x05479fae, 0x051a9efc, 0x04ef9e45, 0x04c49d8b, 0x049c9cd4, 0x04759c1c, 0x04509b5f, 0x042b9a9a,
+	0x040899d6, 0x03e69915, 0x03c59852, 0x03a69789, 0x038896bb, 0x036a95ee, 0x034d951a, 0x03319440,
+	0x03169363, 0x02fc9282, 0x02e3919b, 0x02cb90ad, 0x02b48fbb, 0x029e8ec4, 0x02888dce, 0x02738cd3,
+	0x025f8bd6, 0x024b8ad6, 0x023989d4, 0x022688cc, 0x021487c0, 0x020386b0, 0x01f2859b, 0x01e28481,
+	0x01d38364, 0x01c48245, 0x01b68122, 0x01a87ffe, 0x019a7ed5, 0x018d7da9, 0x01817c7c, 0x01747b4b,
+	0x01687a17, 0x015d78e0, 0x015277a8, 0x0147766e, 0x013d7533, 0x013373f5, 0x012972b6, 0x01207176,
+	0x1635e9cb, 0x1634e9be, 0x1632e9a4, 0x162fe982, 0x162be953, 0x1626e919, 0x1620e8d3, 0x1619e881,
+	0x1611e823, 0x1606e7b4, 0x15fde741, 0x15f3e6c1, 0x15e7e632, 0x15d8e596, 0x15c7e4ec, 0x15b8e43d,
+	0x15a6e37c, 0x1591e2b2, 0x157be1de, 0x1561e0f7, 0x1544e008, 0x1529df1a, 0x1509de1b, 0x14eadd1a,
+	0x14c4dc07, 0x149ddaed, 0x1476d9d1, 0x1449d8a5, 0x1416d76d, 0x13e2d633, 0x13a8d4ec, 0x1370d3ac,
+	0x1332d25f, 0x12f0d10e, 0x12accfb8, 0x1265ce64, 0x121bcd09, 0x11cdcbaa, 0x117dca4b, 0x112dc8ef,
+	0x10d8c789, 0x107dc619, 0x1024c4b1, 0x0fc8c34a, 0x0f6fc1f4, 0x0f14c09a, 0x0eb8bf39, 0x0e5bbdd2,
+	0x0dfebc76, 0x0d9fbb25, 0x0d43b9d2, 0x0ce6b8a4, 0x0c8ab78b, 0x0c31b67c, 0x0bd7b56d, 0x0b7fb466,
+	0x0b28b362, 0x0ad3b263, 0x0a7fb166, 0x0a2db06e, 0x09ddaf7c, 0x098eae8c, 0x0941ada1, 0x08f6acbb,
+	0x08acabdd, 0x0865ab0a, 0x0821aa39, 0x07dea976, 0x079ca8b2, 0x075ca7ee, 0x071fa72c, 0x06e4a66e,
+	0x06aba5b4, 0x0673a4f8, 0x063ca43d, 0x0607a386, 0x05d4a2d6, 0x05a3a225, 0x0573a16f, 0x0545a0b7,
+	0x05199ffe, 0x04ee9f43, 0x04c49e81, 0x049b9dc2, 0x04749d04, 0x044f9c41, 0x042b9b78, 0x04089aae,
+	0x03e699e9, 0x03c59921, 0x03a59853, 0x03879783, 0x036996b4, 0x034d95de, 0x03319503, 0x03169423,
+	0x02fc933e, 0x02e39254, 0x02cb9165, 0x02b39070, 0x029d8f78, 0x02888e82, 0x02738d86, 0x025e8c88,
+	0x024b8b88, 0x02388a85, 0x0225897d, 0x02148870, 0x02038760, 0x01f2864b, 0x01e2852f, 0x01d28412,
+	0x01c382f1, 0x01b581cf, 0x01a780aa, 0x019a7f82, 0x018d7e56, 0x01807d29, 0x01747bf7, 0x01687ac2,
+	0x015c798b, 0x01517853, 0x01467718, 0x013c75dd, 0x0132749f, 0x0129735f, 0x011f721f, 0x011670de,
+	0x14d4eb2b, 0x14d3eb1f, 0x14d1eb08, 0x14cfeae5, 0x14cbeab8, 0x14c6ea7f, 0x14c1ea3a, 0x14bbe9ea,
+	0x14b4e98f, 0x14ace926, 0x14a2e8b2, 0x1499e836, 0x1490e7ac, 0x1483e713, 0x1472e66b, 0x1464e5bf,
+	0x1455e504, 0x1444e43f, 0x1430e36d, 0x141ae28e, 0x1400e1a2, 0x13e7e0b6, 0x13cbdfbc, 0x13b1dec1,
+	0x1390ddb2, 0x136cdc9b, 0x1349db82, 0x1321da5c, 0x12f4d928, 0x12c5d7f0, 0x1293d6b0, 0x125ed56d,
+	0x1228d427, 0x11edd2d8, 0x11aed182, 0x116ed02e, 0x112cced5, 0x10e5cd77, 0x109ccc16, 0x1051cab5,
+	0x1005c94f, 0x0fb1c7dd, 0x0f5ec66c, 0x0f0ac505, 0x0eb6c3a5, 0x0e63c244, 0x0e0dc0da, 0x0db5bf65,
+	0x0d60be0c, 0x0d08bcae, 0x0cb1bb61, 0x0c5aba31, 0x0c04b90f, 0x0bafb7f4, 0x0b5bb6dc, 0x0b08b5c9,
+	0x0ab6b4b8, 0x0a66b3ad, 0x0a16b2a3, 0x09c8b1a0, 0x097cb09e, 0x0931afa6, 0x08e7aead, 0x08a0adbc,
+	0x085aacd8, 0x0816abf6, 0x07d4ab21, 0x0795aa53, 0x0756a981, 0x0719a8b0, 0x06dea7e0, 0x06a5a71b,
+	0x066fa656, 0x0639a58f, 0x0604a4cd, 0x05d1a410, 0x05a0a354, 0x0571a298, 0x0543a1d6, 0x0516a114,
+	0x04eca051, 0x04c29f8a, 0x049a9ec3, 0x04739dfd, 0x044e9d34, 0x04299c65, 0x04069b95, 0x03e59acb,
+	0x03c49a00, 0x03a4992e, 0x03869858, 0x03689786, 0x034c96ad, 0x033095d0, 0x031594ee, 0x02fb9406,
+	0x02e29319, 0x02ca9227, 0x02b2912f, 0x029c9035, 0x02878f3e, 0x02728e42, 0x025e8d43, 0x024a8c42,
+	0x02378b3e, 0x02258a35, 0x02138927, 0x02028816, 0x01f18700, 0x01e185e5, 0x01d184c6, 0x01c283a4,
+	0x01b48282, 0x01a6815c, 0x01998034, 0x018c7f08, 0x017f7dda, 0x01737ca8, 0x01677b73, 0x015b7a3c,
+	0x01507903, 0x014677c8, 0x013b768b, 0x0131754c, 0x0128740d, 0x011e72cc, 0x0115718a, 0x010d7045,
+	0x1385ec7b, 0x1384ec6f, 0x1382ec58, 0x1380ec36, 0x137cec0a, 0x1378ebd2, 0x1374eb90, 0x136eeb42,
+	0x1368eae9, 0x1361ea84, 0x1358ea11, 0x1351e998, 0x1348e913, 0x133de87d, 0x132ee7d7, 0x1322e72f,
+	0x1315e678, 0x1305e5b8, 0x12f5e4eb, 0x12e1e40f, 0x12cbe32b, 0x12b4e23e, 0x129de14d, 0x1285e054,
+	0x1269df4d, 0x1248de36, 0x1228dd1f, 0x1207dc03, 0x11e0dad5, 0x11b5d99d, 0x1188d862, 0x1158d71f,
+	0x112ad5e1, 0x10f4d492, 0x10bbd33d, 0x1081d1eb, 0x1045d093, 0x1005cf35, 0x0fc1cdd2, 0x0f7ccc6d,
+	0x0f37cb06, 0x0eedc995, 0x0e9ec81d, 0x0e52c6b5, 0x0e03c54c, 0x0db6c3e3, 0x0d67c26e, 0x0d16c0fb,
+	0x0cc6bf98, 0x0c75be32, 0x0c23bce9, 0x0bd2bbb9, 0x0b81ba8d, 0x0b31b967, 0x0ae3b847, 0x0a93b725,
+	0x0a46b60c, 0x09fab4f1, 0x09afb3df, 0x0965b2ce, 0x091db1c2, 0x08d6b0bb, 0x0890afb9, 0x084caec3,
+	0x0809add2, 0x07c8ace6, 0x078aac09, 0x074dab2e, 0x0712aa50, 0x06d7a972, 0x069ea89d, 0x0667a7c9,
+	0x0633a6f8, 0x0600a62a, 0x05cea564, 0x059da49d, 0x056da3d4, 0x0540a30a, 0x0514a241, 0x04e9a173,
+	0x04c0a0a4, 0x04989fd5, 0x04729f08, 0x044c9e39, 0x04289d64, 0x04059c8c, 0x03e39bbc, 0x03c29aeb,
+	0x03a39a16, 0x0385993c, 0x03679866, 0x034a9789, 0x032f96a8, 0x031495c3, 0x02fb94d9, 0x02e193eb,
+	0x02c992f6, 0x02b291fa, 0x029b90fc, 0x02859002, 0x02718f06, 0x025d8e06, 0x02498d05, 0x02368bff,
+	0x02248af5, 0x021289e6, 0x020188d4, 0x01f087bd, 0x01e086a0, 0x01d18581, 0x01c2845e, 0x01b3833b,
+	0x01a58215, 0x019880ec, 0x018b7fc0, 0x017e7e91, 0x01727d5f, 0x01667c29, 0x015b7af1, 0x015079b8,
+	0x0145787c, 0x013a773e, 0x013075fe, 0x012774be, 0x011e737e, 0x0115723b, 0x010c70f5, 0x01036fb1,
+	0x1247edb3, 0x1246edae, 0x1245ed95, 0x1242ed76, 0x123fed4b, 0x123bed15, 0x1237ecd4, 0x1232ec88,
+	0x122dec32, 0x1227ebcf, 0x121feb5f, 0x1218eae9, 0x1211ea67, 0x1208e9d5, 0x11fbe934, 0x11f0e890,
+	0x11e4e7db, 0x11d7e71e, 0x11c8e657, 0x11b8e581, 0x11a5e4a1, 0x118ee3b4, 0x117de2ce, 0x1166e1d5,
+	0x114fe0d4, 0x1132dfc4, 0x1115deaf, 0x10fadd99, 0x10d7dc71, 0x10b0db3c, 0x1089da04, 0x105ed8c3,
+	0x1034d787, 0x1003d63a, 0x0fd1d4ea, 0x0f9dd398, 0x0f66d240, 0x0f2cd0e5, 0x0eefcf80, 0x0eb0ce1a,
+	0x0e70ccaf, 0x0e2ecb40, 0x0de5c9c6, 0x0d9ec858, 0x0d56c6e8, 0x0d0ec576, 0x0cc5c3f7, 0x0c7bc288,
+	0x0c2fc118, 0x0be5bfba, 0x0b98be72, 0x0b4dbd3a, 0x0b01bc05, 0x0ab6bad6, 0x0a6cb9aa, 0x0a22b880,
+	0x09d9b759, 0x0991b634, 0x094ab516, 0x0904b3f7, 0x08c0b2e4, 0x087db1d1, 0x083bb0c8, 0x07faafc8,
+	0x07bbaeca, 0x077caddb, 0x0740acf0, 0x0706ac07, 0x06ceab1e, 0x0696aa38, 0x0660a958, 0x062ca877,
+	0x05f9a79b, 0x05c9a6cc, 0x0599a5fc, 0x056aa529, 0x053ca454, 0x0510a380, 0x04e6a2ab, 0x04bda1d4,
+	0x0495a0fa, 0x046ea025, 0x044a9f4f, 0x04269e75, 0x04039d96, 0x03e19cbe, 0x03c19be7, 0x03a19b0d,
+	0x03839a2e, 0x03669953, 0x03499873, 0x032d978e, 0x031396a5, 0x02f995b8, 0x02e094c6, 0x02c893cf,
+	0x02b192d0, 0x029a91cf, 0x028490d2, 0x026f8fd2, 0x025b8ed2, 0x02488dcf, 0x02358cc9, 0x02238bbd,
+	0x02118aad, 0x02008999, 0x01ef8880, 0x01df8762, 0x01d08643, 0x01c1851f, 0x01b283fb, 0x01a482d4,
+	0x019781aa, 0x018a807d, 0x017d7f4e, 0x01717e1a, 0x01657ce3, 0x015a7bac, 0x014f7a71, 0x01447935,
+	0x013a77f6, 0x013076b6, 0x01267575, 0x011d7434, 0x011472ef, 0x010b71aa, 0x01027065, 0x00fa6f1d,
+	0x1119eee2, 0x1119eedc, 0x1117eec4, 0x1115eea5, 0x1112ee7c, 0x110fee47, 0x110bee08, 0x1107edbe,
+	0x1102ed6a, 0x10fded0a, 0x10f5ec9c, 0x10f0ec29, 0x10eaebab, 0x10e2eb1c, 0x10d6ea7f, 0x10cde9de,
+	0x10c2e92c, 0x10b7e875, 0x10abe7b1, 0x109de6e0, 0x108ce606, 0x1078e51b, 0x106ae43b, 0x1055e344,
+	0x1042e24c, 0x1029e140, 0x100fe02d, 0x0ff7df1d, 0x0fd9ddfa, 0x0fb7dcc9, 0x0f93db93, 0x0f6dda57,
+	0x0f47d91b, 0x0f1dd7d5, 0x0ef0d688, 0x0ec1d536, 0x0e8fd3e0, 0x0e5cd286, 0x0e25d123, 0x0debcfba,
+	0x0db0ce4a, 0x0d74ccda, 0x0d33cb65, 0x0cf0c9ed, 0x0cafc87a, 0x0c6cc6fc, 0x0c29c57e, 0x0be4c40a,
+	0x0b9ec293, 0x0b59c13c, 0x0b12bff5, 0x0acbbeb4, 0x0a85bd78, 0x0a3ebc3e, 0x09f8bb08, 0x09b3b9d4,
+	0x096eb8a1, 0x092bb773, 0x08e8b648, 0x08a6b522, 0x0866b402, 0x0826b2e6, 0x07e7b1d7, 0x07aab0cb,
+	0x076dafc8, 0x0733aecf, 0x06f9add6, 0x06c2ace0, 0x068cabeb, 0x0657ab00, 0x0623aa12, 0x05f1a927,
+	0x05c1a847, 0x0592a76e, 0x0564a695, 0x0537a5b5, 0x050ca4d7, 0x04e1a3f7, 0x04b9a317, 0x0491a234,
+	0x046ba156, 0x0446a077, 0x04239f95, 0x04019eb0, 0x03df9dd2, 0x03bf9cf4, 0x039f9c13, 0x03819b2f,
+	0x03649a4f, 0x0347996b, 0x032c9881, 0x03119795, 0x02f796a4, 0x02de95ad, 0x02c794b3, 0x02af93b2,
+	0x029992ae, 0x028391ac, 0x026e90aa, 0x025a8fa7, 0x02468ea2, 0x02348d9a, 0x02228c8d, 0x02108b7d,
+	0x01ff8a67, 0x01ee894c, 0x01de882c, 0x01ce870b, 0x01c085e7, 0x01b184c2, 0x01a3839a, 0x0196826f,
+	0x01898141, 0x017c8010, 0x01707edc, 0x01647da4, 0x01597c6c, 0x014e7b30, 0x014379f3, 0x013978b3,
+	0x012f7772, 0x01257630, 0x011c74ee, 0x011373a9, 0x010a7264, 0x0101711e, 0x00f96fd4, 0x00f16e8a,
+	0x0ffbf000, 0x0ffbeffb, 0x0ff9efe3, 0x0ff7efc5, 0x0ff5ef9c, 0x0ff2ef69, 0x0feeef2c, 0x0febeee4,
+	0x0fe7ee92, 0x0fe2ee35, 0x0fdbedc9, 0x0fd7ed59, 0x0fd2ecde, 0x0fcaec53, 0x0fc1ebb9, 0x0fb9eb1c,
+	0x0fafea6d, 0x0fa7e9be, 0x0f9be8fc, 0x0f8fe82e, 0x0f82e75c, 0x0f71e677, 0x0f63e597, 0x0f51e4a5,
+	0x0f42e3b3, 0x0f2ce2ad, 0x0f15e19b, 0x0effe08d, 0x0ee7df73, 0x0ec9de48, 0x0ea8dd14, 0x0e88dbdd,
+	0x0e65daa1, 0x0e42d964, 0x0e18d815, 0x0deed6c6, 0x0dc2d573, 0x0d93d419, 0x0d62d2b8, 0x0d2dd14d,
+	0x0cf6cfd9, 0x0cc1ce6b, 0x0c87ccf9, 0x0c48cb79, 0x0c0dca00, 0x0bcfc878, 0x0b91c6fb, 0x0b52c581,
+	0x0b11c412, 0x0ad0c2bb, 0x0a8fc16f, 0x0a4dc026, 0x0a0bbee4, 0x09c9bda0, 0x0988bc63, 0x0947bb22,
+	0x0906b9e6, 0x08c7b8ae, 0x0888b777, 0x084ab647, 0x080db51e, 0x07d1b3ff, 0x0795b2e4, 0x075bb1cd,
+	0x0722b0c6, 0x06eaafc0, 0x06b4aebb, 0x067fadb7, 0x064bacbe, 0x0619abc6, 0x05e8aace, 0x05b8a9dc,
+	0x058aa8f8, 0x055ca812, 0x0531a72c, 0x0507a643, 0x04dda55b, 0x04b4a46f, 0x048da383, 0x0467a29a,
+	0x0442a1b2, 0x041fa0c9, 0x03fd9fdc, 0x03dc9ef5, 0x03bc9e11, 0x039d9d2b, 0x037e9c40, 0x03619b58,
+	0x03459a71, 0x032a9982, 0x030f9892, 0x02f6979d, 0x02dd96a2, 0x02c595a4, 0x02ae949f, 0x02979397,
+	0x02829292, 0x026d918d, 0x02599087, 0x02458f81, 0x02328e76, 0x02208d66, 0x020e8c54, 0x01fe8b3d,
+	0x01ed8a22, 0x01dd88ff, 0x01cd87db, 0x01be86b6, 0x01b08590, 0x01a28467, 0x0195833a, 0x0188820c,
+	0x017b80da, 0x016f7fa4, 0x01637e6c, 0x01587d32, 0x014c7bf5, 0x01427ab6, 0x01387976, 0x012e7833,
+	0x012476f1, 0x011b75ae, 0x01127468, 0x01097322, 0x010171db, 0x00f87090, 0x00f06f44, 0x00e96df5,
+	0x0eecf110, 0x0eecf10b, 0x0eebf0f3, 0x0ee9f0d6, 0x0ee7f0ae, 0x0ee4f07c, 0x0ee1f041, 0x0edeeffb,
+	0x0edaefab, 0x0ed6ef50, 0x0ed0eee7, 0x0eccee7a, 0x0ec8ee02, 0x0ec2ed7a, 0x0eb9ece3, 0x0eb2ec49,
+	0x0eaaeb9e, 0x0ea4eaf5, 0x0e9bea39, 0x0e8fe96b, 0x0e85e8a1, 0x0e76e7c0, 0x0e69e6e2, 0x0e5be5f7,
+	0x0e4de508, 0x0e3ce40a, 0x0e26e2fa, 0x0e13e1ef, 0x0dffe0dd, 0x0de6dfb9, 0x0dc9de87, 0x0dabdd52,
+	0x0d8ddc1a, 0x0d6edae1, 0x0d49d995, 0x0d24d84a, 0x0cfcd6f7, 0x0cd1d59d, 0x0ca6d440, 0x0c76d2d2,
+	0x0c45d160, 0x0c13cfef, 0x0be0ce7f, 0x0ba6ccfa, 0x0b6fcb78, 0x0b37c9f0, 0x0afdc86e, 0x0ac4c6f0,
+	0x0a88c587, 0x0a4cc434, 0x0a10c2e2, 0x09d3c194, 0x0995c048, 0x0958bf00, 0x091abdb5, 0x08ddbc6b,
+	0x08a1bb26, 0x0865b9e3, 0x082bb8a5, 0x07f0b76a, 0x07b7b63b, 0x077eb515, 0x0746b3ef, 0x070eb2d4,
+	0x06d8b1c2, 0x06a3b0af, 0x0670af9d, 0x063dae92, 0x060cad8f, 0x05ddac8a, 0x05aeab8b, 0x0580aa98,
+	0x0554a9a8, 0x0529a8b6, 0x04ffa7c2, 0x04d6a6d2, 0x04afa5de, 0x0488a4e8, 0x0462a3f4, 0x043da301,
+	0x041aa20e, 0x03f9a11b, 0x03d8a02a, 0x03b89f3d, 0x03999e53, 0x037c9d62, 0x035e9c73, 0x03429b86,
+	0x03279a92, 0x030d999d, 0x02f398a3, 0x02db97a5, 0x02c396a2, 0x02ac959a, 0x0295948d, 0x02809384,
+	0x026b927a, 0x02579171, 0x02449068, 0x02318f5c, 0x021f8e4a, 0x020d8d35, 0x01fc8c1c, 0x01eb8afe,
+	0x01dc89da, 0x01cc88b5, 0x01bd878d, 0x01af8665, 0x01a1853b, 0x0194840d, 0x018782dd, 0x017a81a9,
+	0x016e8073, 0x01627f39, 0x01577dfe, 0x014c7cc1, 0x01417b80, 0x01367a3d, 0x012d78fa, 0x012377b7,
+	0x011a7673, 0x0111752c, 0x010873e6, 0x0100729d, 0x00f87151, 0x00f07002, 0x00e86eb3, 0x00e06d63,
+	0x0decf210, 0x0decf20b, 0x0deaf1f4, 0x0de9f1d8, 0x0de7f1b1, 0x0de5f181, 0x0de2f147, 0x0ddff102,
+	0x0ddcf0b4, 0x0dd9f05c, 0x0dd3eff5, 0x0dd0ef8b, 0x0dccef16, 0x0dc7ee92, 0x0dc1ee04, 0x0dbaed68,
+	0x0db3ecc0, 0x0daeec1d, 0x0da6eb65, 0x0d9cea9a, 0x0d94e9d6, 0x0d88e8fc, 0x0d7be81c, 0x0d71e73b,
+	0x0d64e64e, 0x0d56e556, 0x0d43e44c, 0x0d33e344, 0x0d23e238, 0x0d0de119, 0x0cf3dfeb, 0x0cd9deb9,
+	0x0cbedd85, 0x0ca2dc4d, 0x0c82db07, 0x0c62d9c0, 0x0c3ed86e, 0x0c18d717, 0x0bf1d5ba, 0x0bc6d44d,
+	0x0b9ad2d8, 0x0b6cd167, 0x0b3ecff7, 0x0b0bce73, 0x0ad7cce4, 0x0aa4cb5e, 0x0a6fc9d8, 0x0a3ac861,
+	0x0a04c6fd, 0x09ccc5a5, 0x0994c44d, 0x095bc2f9, 0x0922c1a7, 0x08eac057, 0x08b0bf02, 0x0877bdb0,
+	0x083ebc5f, 0x0807bb14, 0x07cfb9cd, 0x0799b88c, 0x0762b758, 0x072db628, 0x06f8b4fc, 0x06c3b3da,
+	0x0690b2ba, 0x065eb19d, 0x062db07f, 0x05feaf6f, 0x05cfae5f, 0x05a2ad50, 0x0575ac4e, 0x054aab54,
+	0x051faa57, 0x04f6a959, 0x04cea85c, 0x04a7a75f, 0x0482a663, 0x045ca564, 0x0438a467, 0x0415a369,
+	0x03f3a26a, 0x03d3a170, 0x03b4a07e, 0x03969f8b, 0x03789e94, 0x035b9d9e, 0x033f9caa, 0x03249bb3,
+	0x030a9ab8, 0x02f099b7, 0x02d898b4, 0x02c197ae, 0x02aa96a2, 0x02939591, 0x027e9483, 0x02699375,
+	0x02559267, 0x0241915a, 0x022f904b, 0x021d8f38, 0x020b8e21, 0x01fb8d06, 0x01ea8be5, 0x01da8abe,
+	0x01cb8996, 0x01bc886d, 0x01ae8743, 0x01a08617, 0x019284e7, 0x018583b6, 0x01798280, 0x016d8148,
+	0x0161800e, 0x01567ed1, 0x014b7d92, 0x01407c51, 0x01357b0c, 0x012b79c6, 0x01227882, 0x0119773c,
+	0x011075f6, 0x010774ae, 0x00ff7364, 0x00f77217, 0x00ef70c6, 0x00e76f75, 0x00e06e24, 0x00d86cd3,
+	0x0cfaf302, 0x0cf9f2fc, 0x0cf8f2e9, 0x0cf7f2cc, 0x0cf5f2a6, 0x0cf3f277, 0x0cf1f23e, 0x0ceef1fc,
+	0x0cebf1b0, 0x0ce9f15b, 0x0ce4f0f6, 0x0ce1f08e, 0x0cdef01d, 0x0cdaef9c, 0x0cd6ef14, 0x0cceee78,
+	0x0cc8edd4, 0x0cc5ed35, 0x0cbeec81, 0x0cb5ebb9, 0x0cb0eafc, 0x0ca6ea28, 0x0c9ae948, 0x0c93e871,
+	0x0c87e785, 0x0c7ce695, 0x0c6ce590, 0x0c5ee48a, 0x0c50e382, 0x0c3ee26a, 0x0c28e142, 0x0c10e011,
+	0x0bf9dee3, 0x0be0ddad, 0x0bc6dc70, 0x0ba7db25, 0x0b88d9d9, 0x0b67d884, 0x0b43d725, 0x0b1ed5bc,
+	0x0af5d444, 0x0accd2d6, 0x0aa2d163, 0x0a75cfde, 0x0a45ce48, 0x0a15ccc0, 0x09e6cb36, 0x09b5c9c7,
+	0x0984c86b, 0x0950c70d, 0x091cc5b2, 0x08e8c458, 0x08b4c300, 0x087ec1a6, 0x0849c04c, 0x0813beed,
+	0x07debd94, 0x07abbc42, 0x0777baf1, 0x0744b9b0, 0x0710b871, 0x06deb738, 0x06acb60a, 0x067bb4dd,
+	0x064ab3b0, 0x061bb286, 0x05edb164, 0x05c0b04a, 0x0593af2e, 0x0568ae1a, 0x053ead15, 0x0515ac0f,
+	0x04ecab06, 0x04c5a9fd, 0x049ea8f5, 0x0479a7ed, 0x0455a6e7, 0x0432a5e3, 0x040fa4da, 0x03eda3d0,
+	0x03cda2c9, 0x03afa1cd, 0x0391a0d4, 0x03749fd8, 0x03579eda, 0x033b9ddf, 0x03219ce1, 0x03079be2,
+	0x02ee9add, 0x02d599d2, 0x02bd98c6, 0x02a797b6, 0x029196a1, 0x027c958e, 0x0267947c, 0x02539369,
+	0x023f9258, 0x022d9145, 0x021b902f, 0x020a8f16, 0x01f98df9, 0x01e88cd6, 0x01d98bad, 0x01c98a81,
+	0x01ba8954, 0x01ac8828, 0x019e86fb, 0x019185ca, 0x01848496, 0x0177835f, 0x016b8225, 0x016080e9,
+	0x01547fab, 0x01497e6a, 0x013f7d28, 0x01347be1, 0x012b7a9a, 0x01217953, 0x0117780c, 0x010f76c4,
+	0x0106757c, 0x00fe7430, 0x00f672e1, 0x00ee7190, 0x00e6703e, 0x00df6eeb, 0x00d86d97, 0x00d16c45,
+	0x0c15f3ec, 0x0c14f3df, 0x0c13f3ce, 0x0c12f3b2, 0x0c11f38e, 0x0c0ff360, 0x0c0df329, 0x0c0af2e8,
+	0x0c08f29f, 0x0c06f24b, 0x0c01f1e9, 0x0bfff184, 0x0bfdf116, 0x0bfbf09b, 0x0bf7f014, 0x0befef7a,
+	0x0bebeedc, 0x0be8ee3f, 0x0be3ed8f, 0x0bdbeccd, 0x0bd7ec14, 0x0bcfeb46, 0x0bc4ea67, 0x0bbfe997,
+	0x0bb5e8ae, 0x0bade7c5, 0x0ba0e6c7, 0x0b92e5c1, 0x0b86e4bd, 0x0b79e3af, 0x0b67e28d, 0x0b51e15d,
+	0x0b3de032, 0x0b27df00, 0x0b11ddc9, 0x0af5dc80, 0x0adadb37, 0x0abcd9e3, 0x0a9cd884, 0x0a7cd71e,
+	0x0a57d5a8, 0x0a32d43a, 0x0a0cd2c2, 0x09e4d13c, 0x09b9cfab, 0x098cce18, 0x0962cc9b, 0x0934cb2d,
+	0x0907c9cf, 0x08d9c86f, 0x08a9c70f, 0x0878c5af, 0x0848c450, 0x0816c2f0, 0x07e5c18f, 0x07b2c025,
+	0x0782bec5, 0x0751bd6a, 0x0721bc14, 0x06f1bad0, 0x06c1b989, 0x0691b84a, 0x0663b716, 0x0634b5dd,
+	0x0606b4a4, 0x05d9b370, 0x05aeb24a, 0x0583b122, 0x0559b000, 0x0530aee8, 0x0508adda, 0x04e1acc8,
+	0x04baabb5, 0x0495aaa3, 0x0470a98e, 0x044ca87c, 0x042aa76f, 0x0409a661, 0x03e8a54e, 0x03c7a437,
+	0x03a8a32e, 0x038ba22c, 0x036ea12b, 0x0353a027, 0x03379f25, 0x031d9e21, 0x03039d1a, 0x02ea9c11,
+	0x02d29b02, 0x02bb99ee, 0x02a498d8, 0x028e97bf, 0x027996a6, 0x02659590, 0x02519479, 0x023d9363,
+	0x022a924b, 0x02199131, 0x02079015, 0x01f78ef5, 0x01e78dd0, 0x01d78ca5, 0x01c88b77, 0x01b98a47,
+	0x01aa8917, 0x019c87e7, 0x018f86b3, 0x0182857f, 0x01768445, 0x016a830a, 0x015e81cc, 0x0153808b,
+	0x01487f49, 0x013d7e05, 0x01337cbd, 0x01297b74, 0x01207a2c, 0x011778e2, 0x010e7799, 0x0105764f,
+	0x00fc7501, 0x00f573b1, 0x00ed725e, 0x00e5710b, 0x00de6fb7, 0x00d76e62, 0x00d06d0d, 0x00c96bb8,
+	0x0b3df4c0, 0x0b3cf4bb, 0x0b3bf4a5, 0x0b3af48c, 0x0b39f469, 0x0b37f43c, 0x0b35f406, 0x0b33f3c8,
+	0x0b31f380, 0x0b2ff32f, 0x0b2cf2ce, 0x0b2af26d, 0x0b28f201, 0x0b27f18b, 0x0b23f106, 0x0b1ef072,
+	0x0b1aefd6, 0x0b17ef3b, 0x0b13ee91, 0x0b0dedd4, 0x0b0aed1d, 0x0b05ec57, 0x0afaeb7c, 0x0af6eaad,
+	0x0aeee9cb, 0x0ae8e8e6, 0x0adee7ef, 0x0ad1e6ea, 0x0ac7e5ec, 0x0abde4e4, 0x0aaee3c9, 0x0a9be29d,
+	0x0a89e173, 0x0a76e046, 0x0a63df11, 0x0a4bddcd, 0x0a34dc8a, 0x0a1adb36, 0x09fdd9d9, 0x09e0d873,
+	0x09bfd702, 0x099ed591, 0x097bd414, 0x0958d28b, 0x0932d101, 0x0908cf66, 0x08e1cdf3, 0x08b9cc8b,
+	0x088fcb28, 0x0865c9ca, 0x0839c864, 0x080cc6ff, 0x07dfc59a, 0x07b2c434, 0x0784c2c9, 0x0755c15b,
+	0x0727bff0, 0x06fabe8e, 0x06cdbd3a, 0x06a0bbec, 0x0674ba9e, 0x0647b95b, 0x061bb81d, 0x05efb6da,
+	0x05c3b594, 0x0599b45b, 0x0570b32b, 0x0548b1fa, 0x0520b0d3, 0x04f9afb9, 0x04d3ae9d, 0x04aead81,
+	0x048aac65, 0x0466ab47, 0x0443aa28, 0x0421a90e, 0x0400a7f8, 0x03e0a6de, 0x03c1a5c0, 0x03a2a4a8,
+	0x0384a396, 0x0368a28e, 0x034da182, 0x0332a07b, 0x03189f72, 0x02ff9e64, 0x02e69d54, 0x02ce9c3e,
+	0x02b79b26, 0x02a19a0b, 0x028b98eb, 0x027697ca, 0x026296b1, 0x024e9596, 0x023b947b, 0x0228935e,
+	0x0216923f, 0x02059120, 0x01f48ffd, 0x01e48ed4, 0x01d58da6, 0x01c68c77, 0x01b78b43, 0x01a98a10,
+	0x019b88dd, 0x018d87a6, 0x0181866f, 0x01748534, 0x016883f6, 0x015d82b7, 0x01528175, 0x01478030,
+	0x013c7ee9, 0x01327d9e, 0x01287c54, 0x011f7b0b, 0x011579bf, 0x010d7875, 0x01047729, 0x00fb75d9,
+	0x00f37486, 0x00ec7332, 0x00e471dc, 0x00dd7087, 0x00d66f31, 0x00cf6ddb, 0x00c86c85, 0x00c26b2e,
+	0x0a71f58f, 0x0a70f582, 0x0a70f573, 0x0a6ff55a, 0x0a6df537, 0x0a6cf50c, 0x0a6af4d8, 0x0a69f49a,
+	0x0a67f455, 0x0a65f406, 0x0a63f3ac, 0x0a60f348, 0x0a5ff2e0, 0x0a5ef26d, 0x0a5cf1ec, 0x0a57f15b,
+	0x0a53f0c2, 0x0a52f02b, 0x0a50ef88, 0x0a4beecf, 0x0a47ee19, 0x0a44ed5b, 0x0a3cec85, 0x0a38ebb6,
+	0x0a32eadc, 0x0a2de9f9, 0x0a25e90a, 0x0a1ae809, 0x0a12e70f, 0x0a0ae60c, 0x09fee4f6, 0x09ede3d0,
+	0x09dde2a7, 0x09cfe181, 0x09bde04d, 0x09aadf12, 0x0995ddcc, 0x097edc7f, 0x0965db23, 0x094bd9b9,
+	0x092fd852, 0x0910d6dd, 0x08f1d55f, 0x08d1d3d5, 0x08afd249, 0x088ad0b7, 0x0865cf41, 0x0842cde3,
+	0x081bcc7d, 0x07f5cb1a, 0x07cdc9b2, 0x07a3c848, 0x077ac6dd, 0x0750c571, 0x0726c3fe, 0x06fbc289,
+	0x06cfc116, 0x06a6bfb0, 0x067cbe5a, 0x0652bd03, 0x0628bbb4, 0x05feba6b, 0x05d5b920, 0x05acb7d4,
+	0x0583b686, 0x055bb545, 0x0534b409, 0x050fb2d6, 0x04e9b1ac, 0x04c4b087, 0x04a0af5f, 0x047dae39,
+	0x045aad14, 0x0438abeb, 0x0417aac3, 0x03f6a9a1, 0x03d7a87f, 0x03b9a75a, 0x039ba636, 0x037ea51b,
+	0x0361a404, 0x0346a2ee, 0x032ca1e0, 0x0313a0d2, 0x02fa9fbf, 0x02e29ea9, 0x02ca9d8d, 0x02b29c6c,
+	0x029d9b4b, 0x02879a27, 0x02729900, 0x025e97de, 0x024b96be, 0x0238959f, 0x0226947e, 0x0214935b,
+	0x02029237, 0x01f2910f, 0x01e28fe4, 0x01d28eb3, 0x01c38d7f, 0x01b58c49, 0x01a78b15, 0x019989dd,
+	0x018c88a3, 0x017f8769, 0x0173862b, 0x016784ea, 0x015b83a9, 0x01508266, 0x0145811f, 0x013b7fd6,
+	0x01317e89, 0x01277d3b, 0x011d7bef, 0x01147aa2, 0x010b7957, 0x0103780a, 0x00fa76b8, 0x00f27563,
+	0x00ea740b, 0x00e372b4, 0x00dc715d, 0x00d57005, 0x00ce6ead, 0x00c76d56, 0x00c16bfd, 0x00bb6aa6,
+	0x09b0f64f, 0x09b0f643, 0x09aff634, 0x09aff61b, 0x09adf5fa, 0x09acf5cf, 0x09abf59d, 0x09a9f562,
+	0x09a8f51e, 0x09a7f4d1, 0x09a5f47a, 0x09a3f418, 0x09a2f3b2, 0x09a1f343, 0x099ff2c5, 0x099bf238,
+	0x0998f1a1, 0x0997f10e, 0x0997f071, 0x0993efbc, 0x0990ef08, 0x098eee50, 0x0988ed80, 0x0983ecb1,
+	0x0981ebe0, 0x097beb00, 0x0976ea18, 0x096de91b, 0x0967e825, 0x0960e726, 0x0957e619, 0x094ae4f9,
+	0x093ae3d0, 0x092ee2af, 0x091fe17f, 0x0910e04a, 0x08fddf06, 0x08eaddbc, 0x08d3dc60, 0x08bcdaf6,
+	0x08a4d997, 0x0888d81e, 0x086dd69b, 0x0850d515, 0x0832d386, 0x0812d205, 0x07efd090, 0x07cfcf31,
+	0x07accdc9, 0x0788cc61, 0x0765cafb, 0x073ec98a, 0x0718c81a, 0x06f2c6a6, 0x06cbc52d, 0x06a3c3b1,
+	0x067bc239, 0x0654c0d4, 0x062dbf77, 0x0606be1a, 0x05dfbcc7, 0x05b8bb76, 0x0591ba20, 0x056bb8c9,
+	0x0544b777, 0x051eb62d, 0x04fab4e9, 0x04d6b3b3, 0x04b3b285, 0x0490b153, 0x046eb020, 0x044caef2,
+	0x042cadc1, 0x040cac8e, 0x03ecab60, 0x03cdaa34, 0x03afa905, 0x0393a7d7, 0x0376a6b1, 0x035ba591,
+	0x0340a472, 0x0325a353, 0x030ca240, 0x02f4a129, 0x02dda00f, 0x02c59eed, 0x02ae9dc6, 0x02989c9a,
+	0x02839b70, 0x026f9a45, 0x025b991c, 0x024797f6, 0x023596d0, 0x022295aa, 0x02119483, 0x0200935b,
+	0x01ef922f, 0x01df90ff, 0x01d08fca, 0x01c18e93, 0x01b38d59, 0x01a58c21, 0x01978ae8, 0x018a89aa,
+	0x017d886d, 0x0171872b, 0x016585e8, 0x015984a4, 0x014e835e, 0x01448214, 0x013980ca, 0x012f7f7c,
+	0x01257e2c, 0x011c7cdc, 0x01137b8c, 0x010a7a3e, 0x010278f0, 0x00f9779d, 0x00f17645, 0x00ea74ed,
+	0x00e27393, 0x00db7239, 0x00d470e0, 0x00cd6f85, 0x00c66e2b, 0x00c06cd1, 0x00ba6b79, 0x00b46a21,
+	0x08fbf700, 0x08fbf6fc, 0x08fbf6eb, 0x08faf6d1, 0x08f9f6b1, 0x08f8f688, 0x08f6f657, 0x08f5f61d,
+	0x08f4f5db, 0x08f3f590, 0x08f2f53d, 0x08f0f4dc, 0x08eff479, 0x08eff40d, 0x08eef392, 0x08eaf308,
+	0x08e8f275, 0x08e7f1e5, 0x08e8f14e, 0x08e4f09c, 0x08e2efeb, 0x08e2ef3a, 0x08ddee70, 0x08d8eda0,
+	0x08d8ecd9, 0x08d4ebfb, 0x08d1eb1a, 0x08caea23, 0x08c4e92d, 0x08bee833, 0x08b8e730, 0x08aee617,
+	0x08a0e4ef, 0x0896e3d0, 0x088ae2a6, 0x087ce173, 0x086ce034, 0x085cdeee, 0x0848dd93, 0x0834dc2c,
+	0x081fdace, 0x0807d955, 0x07eed7cc, 0x07d4d64a, 0x07bad4be, 0x079dd347, 0x077dd1d7, 0x075fd072,
+	0x0741cf0d, 0x0720cda1, 0x0700cc3a, 0x06ddcac5, 0x06bac94f, 0x0696c7d5, 0x0673c656, 0x064ec4d5,
+	0x0629c359, 0x0604c1f1, 0x05e1c08e, 0x05bcbf30, 0x0598bdd7, 0x0574bc7d, 0x054fbb1d, 0x052bb9bf,
+	0x0507b866, 0x04e4b712, 0x04c1b5cc, 0x04a0b492, 0x047fb35a, 0x045eb21d, 0x043db0e2, 0x041eafa9,
+	0x03ffae6d, 0x03e0ad35, 0x03c2abfd, 0x03a5aac5, 0x0389a98c, 0x036da859, 0x0353a72f, 0x0338a607,
+	0x031fa4e0, 0x0305a3bf, 0x02eda2a0, 0x02d6a181, 0x02c0a05d, 0x02a99f30, 0x02949dfd, 0x027e9cca,
+	0x026a9b96, 0x02569a66, 0x0244993b, 0x02319810, 0x021f96e5, 0x020d95b7, 0x01fd948a, 0x01ed935c,
+	0x01dd9227, 0x01cd90ee, 0x01be8fb2, 0x01b08e74, 0x01a28d39, 0x01958bfc, 0x01888abb, 0x017b897a,
+	0x016f8836, 0x016386f0, 0x015885a8, 0x014d845f, 0x01428313, 0x013881c6, 0x012e8076, 0x01247f24,
+	0x011a7dd1, 0x01117c7f, 0x01087b2e, 0x010079dc, 0x00f87887, 0x00f0772f, 0x00e875d4, 0x00e17479,
+	0x00da731c, 0x00d271c0, 0x00cc7064, 0x00c56f07, 0x00bf6daa, 0x00b96c50, 0x00b36af6, 0x00ad699a,
+	0x0851f7ae, 0x0851f7a2, 0x0850f794, 0x0850f77d, 0x084ff75d, 0x084ef736, 0x084df706, 0x084cf6ce,
+	0x084bf68e, 0x084af645, 0x0849f5f4, 0x0847f596, 0x0847f535, 0x0847f4cc, 0x0846f454, 0x0844f3cf,
+	0x0842f33d, 0x0841f2b0, 0x0843f21e, 0x0840f170, 0x083ef0c2, 0x083ff018, 0x083cef55, 0x0838ee86,
+	0x0839edc4, 0x0835ecea, 0x0834ec10, 0x082feb1f, 0x0829ea2a, 0x0826e936, 0x0822e83a, 0x081ae726,
+	0x080ee603, 0x0804e4e4, 0x07fbe3c1, 0x07efe290, 0x07e3e158, 0x07d4e011, 0x07c4debb, 0x07b2dd58,
+	0x079fdbf9, 0x078bda82, 0x0774d8f9, 0x075ed774, 0x0746d5f3, 0x072dd483, 0x0711d318, 0x06f4d1ac,
+	0x06dad04a, 0x06bccedc, 0x069fcd71, 0x0680cbfc, 0x065fca7e, 0x063ec8fd, 0x061dc776, 0x05fcc5f4,
+	0x05dac47a, 0x05b8c30c, 0x0597c1a5, 0x0575c041, 0x0553bee2, 0x0532bd81, 0x0510bc18, 0x04edbab2,
+	0x04ccb951, 0x04abb7fa, 0x048ab6af, 0x046bb570, 0x044cb42d, 0x042db2e7, 0x040eb1a3, 0x03f1b05f,
+	0x03d3af1b, 0x03b6addb, 0x039aac9a, 0x037eab56, 0x0363aa17, 0x0349a8de, 0x0330a7af, 0x0317a67d,
+	0x02fea554, 0x02e6a42b, 0x02cfa302, 0x02b9a1d9, 0x02a4a0aa, 0x028f9f72, 0x027a9e36, 0x02659cf9,
+	0x02529bc1, 0x023f9a8d, 0x022d995d, 0x021c982e, 0x020a96fc, 0x01f995c7, 0x01e99493, 0x01da935c,
+	0x01ca921e, 0x01bc90de, 0x01ad8f9c, 0x01a08e5a, 0x01928d1b, 0x01868bd7, 0x01798a92, 0x016d894a,
+	0x01618802, 0x015686b7, 0x014b856a, 0x0140841a, 0x013682ca, 0x012c8177, 0x01228023, 0x01197ece,
+	0x01107d79, 0x01077c26, 0x00ff7ad1, 0x00f67979, 0x00ef781e, 0x00e776c2, 0x00e07565, 0x00d97406,
+	0x00d272a8, 0x00cb7149, 0x00c46fe9, 0x00be6e8a, 0x00b86d2d, 0x00b26bd1, 0x00ac6a73, 0x00a76915,
+	0x07b1f84e, 0x07b1f843, 0x07b0f835, 0x07b0f81f, 0x07aff800, 0x07aef7d9, 0x07adf7aa, 0x07acf774,
+	0x07acf736, 0x07abf6ef, 0x07abf6a0, 0x07a9f644, 0x07a9f5e7, 0x07aaf581, 0x07a9f50b, 0x07a9f48f,
+	0x07a5f3fa, 0x07a6f372, 0x07a7f2e3, 0x07a5f239, 0x07a4f18f, 0x07a6f0ea, 0x07a5f02f, 0x07a1ef61,
+	0x07a2eea2, 0x07a0edd0, 0x079fecf8, 0x079cec0e, 0x0797eb1d, 0x0795ea2f, 0x0793e936, 0x078ce829,
+	0x0783e70c, 0x077ae5ec, 0x0774e4d2, 0x076ae3a4, 0x0760e271, 0x0753e12c, 0x0746dfd9, 0x0736de79,
+	0x0726dd1a, 0x0715dba4, 0x0700da1d, 0x06ecd891, 0x06d7d71e, 0x06c2d5b9, 0x06a9d452, 0x068ed2e0,
+	0x0676d17d, 0x065cd00f, 0x0641ce9e, 0x0626cd2a, 0x0607cba5, 0x05e9ca1d, 0x05cbc894, 0x05adc70d,
+	0x058dc595, 0x056ec420, 0x054fc2b8, 0x0530c151, 0x0511bfe9, 0x04f2be7e, 0x04d2bd12, 0x04b2bba2,
+	0x0492ba38, 0x0474b8e3, 0x0455b793, 0x0438b649, 0x041bb4fd, 0x03fdb3b0, 0x03e1b263, 0x03c4b114,
+	0x03a9afcb, 0x038dae7f, 0x0373ad34, 0x0358abe8, 0x033faaa3, 0x0326a966, 0x030da82d, 0x02f6a6f8,
+	0x02dfa5c9, 0x02c8a498, 0x02b2a366, 0x029da230, 0x0288a0f4, 0x02749fb3, 0x02619e6f, 0x024d9d2b,
+	0x023a9bf0, 0x02289ab8, 0x02179982, 0x0206984c, 0x01f69713, 0x01e695da, 0x01d6949d, 0x01c7935b,
+	0x01b99216, 0x01ab90cf, 0x019d8f89, 0x01908e45, 0x01838cfe, 0x01778bb4, 0x016b8a69, 0x015f891d,
+	0x015487cf, 0x0149867f, 0x013e852c, 0x013483d7, 0x012a8282, 0x0121812b, 0x01177fd3, 0x010e7e7b,
+	0x01067d25, 0x00fd7bce, 0x00f57a73, 0x00ed7915, 0x00e677b6, 0x00de7656, 0x00d774f6, 0x00d07396,
+	0x00ca7235, 0x00c370d3, 0x00bd6f70, 0x00b76e10, 0x00b16cb1, 0x00ab6b51, 0x00a669f1, 0x00a1688f,
+	0x071bf8e2, 0x071bf8de, 0x071af8cd, 0x071af8b6, 0x0719f898, 0x0718f873, 0x0718f845, 0x0717f811,
+	0x0716f7d4, 0x0716f78f, 0x0716f743, 0x0714f6e9, 0x0714f68e, 0x0715f62b, 0x0715f5b8, 0x0716f541,
+	0x0712f4ad, 0x0713f42b, 0x0715f39e, 0x0714f2fa, 0x0713f253, 0x0715f1b1, 0x0716f0fe, 0x0712f033,
+	0x0713ef75, 0x0714eead, 0x0713edd7, 0x0711ecf4, 0x070eec07, 0x070deb1c, 0x070bea26, 0x0708e925,
+	0x0701e80e, 0x06f8e6ec, 0x06f3e5d7, 0x06ece4ae, 0x06e3e37e, 0x06d9e23c, 0x06cee0eb, 0x06c0df90,
+	0x06b2de31, 0x06a3dcb7, 0x0692db37, 0x0680d9b3, 0x066dd842, 0x065ad6e5, 0x0645d580, 0x062dd40f,
+	0x0617d2a6, 0x0600d13b, 0x05e7cfc7, 0x05cfce4e, 0x05b4ccc8, 0x0598cb36, 0x057cc9ab, 0x0560c82a,
+	0x0543c6ad, 0x0527c535, 0x050ac3c8, 0x04edc25c, 0x04d1c0ec, 0x04b3bf7a, 0x0496be09, 0x0478bc90,
+	0x045bbb26, 0x043eb9cc, 0x0422b876, 0x0406b722, 0x03ebb5cd, 0x03cfb477, 0x03b4b31f, 0x0399b1cd,
+	0x037fb078, 0x0365af23, 0x034cadcb, 0x0334ac7f, 0x031bab32, 0x0303a9f0, 0x02eca8ae, 0x02d6a777,
+	0x02c0a63f, 0x02aba506, 0x0296a3c9, 0x0281a286, 0x026ea13e, 0x025b9ff5, 0x02489eaa, 0x02359d64,
+	0x02239c23, 0x02129ae7, 0x020299a8, 0x01f2986b, 0x01e2972f, 0x01d395ee, 0x01c494a6, 0x01b5935b,
+	0x01a7920e, 0x019a90c3, 0x018d8f7a, 0x01808e31, 0x01748ce2, 0x01688b92, 0x015c8a42, 0x015188f1,
+	0x0147879e, 0x013c8648, 0x013284ef, 0x01288396, 0x011f823b, 0x011680e1, 0x010d7f86, 0x01047e2d,
+	0x00fc7cd2, 0x00f37b75, 0x00ec7a14, 0x00e478b3, 0x00dd774f, 0x00d675ec, 0x00cf748a, 0x00c87327,
+	0x00c271c3, 0x00bc705e, 0x00b66efa, 0x00b06d98, 0x00aa6c35, 0x00a56ad2, 0x009f696e, 0x009a6809,
+	0x068ef96f, 0x068ef96b, 0x068df95b, 0x068df944, 0x068cf927, 0x068cf903, 0x068bf8d7, 0x068af8a4,
+	0x068af869, 0x068af826, 0x068af7dc, 0x0688f784, 0x0689f72c, 0x068af6cb, 0x068bf65f, 0x068bf5e9,
+	0x0688f55a, 0x068af4d9, 0x068bf44e, 0x068cf3b2, 0x068cf310, 0x068df26d, 0x068ff1c1, 0x068cf0fb,
+	0x068df03e, 0x068fef7d, 0x068feeaa, 0x068fedd0, 0x068dece7, 0x068bebfd, 0x068aeb0c, 0x068aea15,
+	0x0685e904, 0x067de7e4, 0x0679e6d1, 0x0674e5ae, 0x066de480, 0x0665e345, 0x065be1f1, 0x0650e09e,
+	0x0644df3c, 0x0637ddc6, 0x0628dc46, 0x0618dacd, 0x0608d962, 0x05f7d808, 0x05e6d6a7, 0x05d1d539,
+	0x05bbd3c8, 0x05a7d25d, 0x0591d0e9, 0x057acf6a, 0x0563cde2, 0x0549cc49, 0x0530cabc, 0x0517c940,
+	0x04fcc7bc, 0x04e2c647, 0x04c8c4d4, 0x04adc361, 0x0492c1ea, 0x0477c073, 0x045cbef9, 0x0440bd7b,
+	0x0425bc11, 0x040abab2, 0x03f0b956, 0x03d6b7f8, 0x03bcb69b, 0x03a3b53d, 0x0389b3dd, 0x0370b285,
+	0x0357b124, 0x033fafc5, 0x0327ae69, 0x0310ad14, 0x02f9abc4, 0x02e2aa78, 0x02cca935, 0x02b7a7f4,
+	0x02a3a6b6, 0x028ea573, 0x027aa42a, 0x0267a2db, 0x0254a188, 0x0242a037, 0x02309ee9, 0x021f9da1,
+	0x020d9c5a, 0x01fd9b16, 0x01ed99d1, 0x01de988f, 0x01cf974a, 0x01c09600, 0x01b294af, 0x01a4935c,
+	0x01969209, 0x018a90b8, 0x017e8f6e, 0x01718e1c, 0x01668cc9, 0x015a8b73, 0x014f8a1c, 0x014488c7,
+	0x013a876e, 0x01308611, 0x012684b3, 0x011d8356, 0x011481f8, 0x010b8099, 0x01027f3d, 0x00fa7de0,
+	0x00f27c7f, 0x00ea7b1b, 0x00e379b7, 0x00db7851, 0x00d476ea, 0x00ce7585, 0x00c77420, 0x00c172ba,
+	0x00bb7151, 0x00b56fec, 0x00af6e86, 0x00a96d20, 0x00a46bbb, 0x009e6a54, 0x009968ec, 0x00946787,
+	0x060af9f2, 0x060af9ef, 0x0609f9df, 0x0609f9ca, 0x0609f9ad, 0x0608f98a, 0x0607f95f, 0x0607f92d,
+	0x0607f8f4, 0x0606f8b4, 0x0607f86b, 0x0605f816, 0x0606f7c0, 0x0607f762, 0x0609f6fb, 0x0609f686,
+	0x0607f5fb, 0x0608f57c, 0x060af4f5, 0x060bf45f, 0x060cf3c2, 0x060df31f, 0x0610f27b, 0x060ef1b8,
+	0x060ff0fd, 0x0612f043, 0x0612ef74, 0x0614eea2, 0x0612edbe, 0x0611ecd5, 0x0612ebec, 0x0612eaf9,
+	0x060fe9ec, 0x0609e8d2, 0x0606e7c0, 0x0602e6a4, 0x05fde57a, 0x05f7e441, 0x05eee2f0, 0x05e6e1a5,
+	0x05dbe03b, 0x05d0decd, 0x05c4dd4d, 0x05b6dbde, 0x05a8da7c, 0x0599d923, 0x058ad7c5, 0x0578d658,
+	0x0564d4e3, 0x0552d378, 0x053fd204, 0x052ad080, 0x0515cef4, 0x04fecd5a, 0x04e7cbd0, 0x04d0ca50,
+	0x04b7c8cb, 0x04a0c754, 0x0487c5db, 0x046fc463, 0x0456c2e6, 0x043dc169, 0x0424bfe7, 0x040bbe6c,
+	0x03f1bcfd, 0x03d8bb97, 0x03c0ba32, 0x03a7b8cd, 0x038fb768, 0x0377b600, 0x035fb49d, 0x0348b339,
+	0x0330b1cf, 0x0319b064, 0x0303af08, 0x02edadab, 0x02d7ac57, 0x02c2ab06, 0x02ada9bc, 0x0299a874,
+	0x0286a72c, 0x0273a5df, 0x0260a48b, 0x024da32f, 0x023ba1d4, 0x022aa07c, 0x02199f2c, 0x02089de0,
+	0x01f89c94, 0x01e89b46, 0x01d999fc, 0x01ca98b2, 0x01bc9765, 0x01ae9611, 0x01a194ba, 0x0193935f,
+	0x01869205, 0x017a90b5, 0x016e8f60, 0x01638e0b, 0x01588cb0, 0x014c8b55, 0x014289fa, 0x0137889c,
+	0x012e873d, 0x012485dc, 0x011b8479, 0x01128318, 0x010981b5, 0x01008056, 0x00f87ef6, 0x00f07d92,
+	0x00e87c2b, 0x00e17ac3, 0x00da795a, 0x00d377f0, 0x00cc7688, 0x00c67520, 0x00bf73b7, 0x00b9724c,
+	0x00b370e3, 0x00ae6f7b, 0x00a86e12, 0x00a36caa, 0x009d6b3f, 0x009869d6, 0x0093686e, 0x008f6706,
+	0x058efa6f, 0x058efa6b, 0x058efa5c, 0x058efa46, 0x058dfa2b, 0x058dfa09, 0x058cf9df, 0x058cf9af,
+	0x058bf977, 0x058bf939, 0x058cf8f2, 0x058bf89f, 0x058cf84b, 0x058df7f1, 0x058ff78d, 0x058ff71b,
+	0x058df692, 0x058ff617, 0x0591f593, 0x0593f502, 0x0594f469, 0x0595f3c8, 0x0599f32b, 0x0598f270,
+	0x0598f1b4, 0x059cf0ff, 0x059df035, 0x059fef68, 0x059fee89, 0x059feda4, 0x05a1ecc1, 0x05a1ebd2,
+	0x059feacc, 0x059ce9ba, 0x0598e8a6, 0x0596e790, 0x0592e66a, 0x058ee533, 0x0587e3e8, 0x0581e29f,
+	0x0577e131, 0x056fdfc9, 0x0564de52, 0x0558dce7, 0x054cdb8e, 0x053fda37, 0x0532d8d9, 0x0523d770,
+	0x0511d5fc, 0x0500d48a, 0x04f0d316, 0x04ddd190, 0x04cacffb, 0x04b6ce65, 0x04a0ccde, 0x048bcb59,
+	0x0475c9d7, 0x0460c85b, 0x0449c6dd, 0x0433c55f, 0x041cc3df, 0x0405c259, 0x03eec0d3, 0x03d7bf59,
+	0x03bfbde8, 0x03a7bc79, 0x0391bb0a, 0x037ab9a1, 0x0364b833, 0x034db6c5, 0x0337b55b, 0x0320b3eb,
+	0x030bb278, 0x02f5b10b, 0x02e0afa5, 0x02cbae44, 0x02b7acea, 0x02a3ab97, 0x028faa43, 0x027ca8f4,
+	0x026aa7a2, 0x0257a649, 0x0246a4e9, 0x0234a383, 0x0223a221, 0x0212a0c6, 0x02029f73, 0x01f39e21,
+	0x01e39ccd, 0x01d49b79, 0x01c59a28, 0x01b798d6, 0x01aa977f, 0x019d9624, 0x019094c5, 0x01839365,
+	0x01769209, 0x016b90af, 0x015f8f55, 0x01558df8, 0x014a8c9a, 0x013f8b3a, 0x013589d9, 0x012b8872,
+	0x0121870d, 0x011885a6, 0x01108442, 0x010782dc, 0x00fe8179, 0x00f68015, 0x00ee7eae, 0x00e77d43,
+	0x00df7bd8, 0x00d87a6c, 0x00d178fd, 0x00cb7792, 0x00c47628, 0x00be74bd, 0x00b8734f, 0x00b271e1,
+	0x00ac7076, 0x00a76f0a, 0x00a16da0, 0x009c6c33, 0x00976ac6, 0x0092695b, 0x008e67ef, 0x00896685,
+	0x051bfae2, 0x051bfade, 0x051afad0, 0x051afabc, 0x051afaa1, 0x0519fa7f, 0x0519fa57, 0x0519fa28,
+	0x0518f9f2, 0x0518f9b5, 0x0519f971, 0x0518f91f, 0x0519f8cf, 0x051af876, 0x051cf816, 0x051df7a7,
+	0x051cf721, 0x051df6a8, 0x051ff627, 0x0522f59b, 0x0523f506, 0x0524f468, 0x0529f3d0, 0x052af31f,
+	0x0529f263, 0x052df1b1, 0x0530f0f0, 0x0532f025, 0x0533ef4b, 0x0533ee6b, 0x0535ed8c, 0x0536eca0,
+	0x0537eba7, 0x0535ea9b, 0x0531e982, 0x0530e872, 0x052ee751, 0x052ae61a, 0x0526e4d9, 0x0520e38c,
+	0x0519e225, 0x0511e0b7, 0x0509df50, 0x04ffddf0, 0x04f4dc96, 0x04eadb42, 0x04ded9e5, 0x04d1d87f,
+	0x04c2d70e, 0x04b2d595, 0x04a4d41f, 0x0494d299, 0x0482d0fe, 0x0471cf70, 0x045dcde8, 0x044acc60,
+	0x0436cade, 0x0422c95d, 0x040ec7dd, 0x03f9c658, 0x03e5c4d4, 0x03cfc345, 0x03bac1c1, 0x03a4c046,
+	0x038fbed0, 0x0379bd57, 0x0363bbe3, 0x034eba71, 0x0339b8fa, 0x0324b78b, 0x030fb615, 0x02fbb49b,
+	0x02e6b322, 0x02d2b1b2, 0x02beb043, 0x02abaede, 0x0297ad82, 0x0285ac26, 0x0272aacd, 0x0260a973,
+	0x024ea815, 0x023da6b1, 0x022ca545, 0x021ca3db, 0x020ba272, 0x01fba115, 0x01ec9fbc, 0x01dd9e62,
+	0x01cf9d08, 0x01c19bb0, 0x01b29a57, 0x01a598f9, 0x01989799, 0x018c9637, 0x017f94d2, 0x0173936f,
+	0x0167920d, 0x015c90ab, 0x01518f4a, 0x01478de8, 0x013d8c86, 0x01338b21, 0x012989b7, 0x011f884b,
+	0x011686de, 0x010d8576, 0x0105840c, 0x00fd82a5, 0x00f4813e, 0x00ec7fd3, 0x00e57e65, 0x00de7cf6,
+	0x00d67b86, 0x00d07a14, 0x00c978a5, 0x00c37737, 0x00bc75c9, 0x00b67458, 0x00b172e7, 0x00ab7179,
+	0x00a5700a, 0x00a06e9c, 0x009b6d2c, 0x00966bbc, 0x00916a4f, 0x008d68e0, 0x00886773, 0x00846607,
+	0x04affb4f, 0x04affb4b, 0x04affb3d, 0x04aefb29, 0x04aefb0f, 0x04adfaee, 0x04adfac7, 0x04adfa9a,
+	0x04adfa65, 0x04adfa2a, 0x04aef9e8, 0x04aef99c, 0x04aef94a, 0x04aff8f4, 0x04b1f897, 0x04b2f82a,
+	0x04b1f7a7, 0x04b3f732, 0x04b5f6b4, 0x04b8f62b, 0x04b9f59c, 0x04bbf501, 0x04bff46d, 0x04c2f3c5,
+	0x04c1f309, 0x04c5f25a, 0x04c9f1a2, 0x04cbf0d8, 0x04cdf005, 0x04ceef2c, 0x04d0ee4d, 0x04d2ed65,
+	0x04d4ec76, 0x04d3eb6f, 0x04d0ea57, 0x04d0e94b, 0x04cfe830, 0x04cce6f8, 0x04cae5bf, 0x04c5e470,
+	0x04c0e313, 0x04b9e1a2, 0x04b2e047, 0x04abdef0, 0x04a1dd98, 0x0498dc46, 0x048edaeb, 0x0483d987,
+	0x0476d816, 0x0468d699, 0x045bd520, 0x044ed39a, 0x043dd1fc, 0x042ed076, 0x041dceec, 0x040acd63,
+	0x03f9cbe0, 0x03e7ca5b, 0x03d5c8d6, 0x03c2c74f, 0x03afc5c4, 0x039bc431, 0x0388c2ad, 0x0374c131,
+	0x0360bfb3, 0x034bbe34, 0x0338bcb9, 0x0324bb3f, 0x0311b9c6, 0x02fdb84e, 0x02e9b6cc, 0x02d6b549,
+	0x02c3b3cf, 0x02b0b257, 0x029db0e3, 0x028baf7a, 0x0279ae1a, 0x0267acb6, 0x0256ab56, 0x0245a9f2,
+	0x0234a887, 0x0224a717, 0x0214a5a3, 0x0204a433, 0x01f4a2c9, 0x01e5a166, 0x01d7a006, 0x01c99ea4,
+	0x01bb9d46, 0x01ae9be8, 0x01a09a84, 0x0193991c, 0x018797b2, 0x017b964c, 0x016f94e3, 0x0164937a,
+	0x01589212, 0x014d90a9, 0x01438f41, 0x01398ddb, 0x01308c73, 0x01268b07, 0x011d8996, 0x01138823,
+	0x010a86b3, 0x01028545, 0x00fa83d9, 0x00f28271, 0x00eb8103, 0x00e37f91, 0x00dc7e1e, 0x00d57ca9,
+	0x00ce7b33, 0x00c779bf, 0x00c1784f, 0x00bb76de, 0x00b5756a, 0x00af73f5, 0x00aa7283, 0x00a47111,
+	0x009f6f9f, 0x009a6e2c, 0x00956cb9, 0x00906b49, 0x008c69d7, 0x00876867, 0x008366f7, 0x007f658b,
+	0x044afbb2, 0x044afbaf, 0x044afba1, 0x044afb8f, 0x0449fb75, 0x0449fb56, 0x0449fb30, 0x0449fb04,
+	0x0449fad1, 0x0449fa98, 0x0449fa57, 0x044afa0f, 0x044af9be, 0x044bf96b, 0x044df910, 0x044ff8a6,
+	0x044ef829, 0x044ff7b3, 0x0452f73c, 0x0454f6b4, 0x0457f62a, 0x0459f594, 0x045df501, 0x0460f460,
+	0x0460f3a7, 0x0463f2fa, 0x0468f249, 0x046af184, 0x046df0b8, 0x046fefe3, 0x0471ef05, 0x0474ee26,
+	0x0477ed3c, 0x0477ec39, 0x0474eb25, 0x0475ea1a, 0x0476e904, 0x0474e7d1, 0x0472e69a, 0x046fe549,
+	0x046ce3f4, 0x0465e28b, 0x0461e134, 0x045adfe6, 0x0452de93, 0x044add41, 0x0442dbea, 0x0439da86,
+	0x042ed917, 0x0422d79d, 0x0416d61c, 0x040ad490, 0x03fcd2fa, 0x03eed175, 0x03dfcfed, 0x03cece62,
+	0x03beccdb, 0x03aecb54, 0x039ec9cb, 0x038dc843, 0x037bc6ae, 0x0369c51e, 0x0357c399, 0x0345c217,
+	0x0332c093, 0x0320bf10, 0x030dbd8d, 0x02fbbc0a, 0x02e9ba8f, 0x02d7b90d, 0x02c5b783, 0x02b3b5fb,
+	0x02a1b47b, 0x028fb2fc, 0x027eb185, 0x026cb01a, 0x025baeb0, 0x024bad48, 0x023aabdd, 0x022aaa6e,
+	0x021aa8f8, 0x020ba77b, 0x01fca603, 0x01eda48e, 0x01dea323, 0x01d0a1b9, 0x01c2a04f, 0x01b59ee9,
+	0x01a89d86, 0x019b9c1e, 0x018e9ab0, 0x0182993f, 0x017697d0, 0x016b9662, 0x016094f6, 0x01559387,
+	0x014a9218, 0x014090a8, 0x01368f3b, 0x012c8dcf, 0x01238c60, 0x011a8aed, 0x01118975, 0x010887fe,
+	0x0100868a, 0x00f88518, 0x00f083ab, 0x00e9823c, 0x00e180c7, 0x00da7f50, 0x00d37dd7, 0x00cc7c5c,
+	0x00c57ae3, 0x00bf796f, 0x00b977fb, 0x00b37684, 0x00ae750c, 0x00a87395, 0x00a3721f, 0x009e70aa,
+	0x00996f34, 0x00946dbe, 0x008f6c4a, 0x008b6ad5, 0x00866962, 0x008267f0, 0x007e667f, 0x007a650f,
+	0x03ecfc10, 0x03ecfc0e, 0x03ecfbff, 0x03ecfbee, 0x03ecfbd5, 0x03ebfbb6, 0x03ebfb92, 0x03ebfb67,
+	0x03ebfb36, 0x03ebfafe, 0x03ecfac0, 0x03edfa7a, 0x03edfa2a, 0x03eef9d9, 0x03f0f981, 0x03f2f91a,
+	0x03f2f8a5, 0x03f3f82d, 0x03f6f7ba, 0x03f8f735, 0x03fbf6b1, 0x03fdf61f, 0x0401f58d, 0x0405f4f3,
+	0x0405f43d, 0x0408f393, 0x040df2e7, 0x0410f226, 0x0413f161, 0x0416f090, 0x0418efb7, 0x041ceede,
+	0x041fedf7, 0x0420ecfc, 0x041febee, 0x041feae2, 0x0421e9cf, 0x0421e8a3, 0x0420e76d, 0x041ee621,
+	0x041be4c8, 0x0416e36d, 0x0413e21f, 0x040de0d5, 0x0408df88, 0x0401de35, 0x03fadce1, 0x03f2db7d,
+	0x03e9da12, 0x03dfd897, 0x03d3d70f, 0x03c9d580, 0x03bed3f6, 0x03b1d26e, 0x03a4d0eb, 0x0395cf5e,
+	0x0386cdd0, 0x0378cc47, 0x0369cabd, 0x035ac930, 0x0349c796, 0x0339c60a, 0x0328c482, 0x0318c2f9,
+	0x0307c171, 0x02f6bfe8, 0x02e5be5d, 0x02d4bcd8, 0x02c3bb55, 0x02b2b9c8, 0x02a1b837, 0x0290b6ac,
+	0x0280b526, 0x026fb3a2, 0x025fb229, 0x024fb0ba, 0x023faf48, 0x022fadd9, 0x0220ac62, 0x0211aae8,
+	0x0202a967, 0x01f3a7e3, 0x01e5a665, 0x01d7a4ef, 0x01c9a37e, 0x01bca20c, 0x01aea09b, 0x01a29f31,
+	0x01959dc6, 0x01899c53, 0x017d9adc, 0x01729964, 0x016697ee, 0x015b967c, 0x01519509, 0x01469395,
+	0x013c9220, 0x013290aa, 0x01298f37, 0x01208dc4, 0x01178c4e, 0x010e8ad3, 0x01068956, 0x00fd87dc,
+	0x00f58664, 0x00ed84f0, 0x00e6837c, 0x00df8206, 0x00d8808c, 0x00d17f10, 0x00ca7d91, 0x00c47c10,
+	0x00bd7a96, 0x00b87920, 0x00b277a7, 0x00ac762b, 0x00a774b1, 0x00a17337, 0x009c71bd, 0x00977043,
+	0x00926eca, 0x008e6d52, 0x00896bda, 0x00856a63, 0x008168ee, 0x007d677a, 0x00786607, 0x00756495,
+	0x0395fc6c, 0x0395fc62, 0x0395fc59, 0x0395fc46, 0x0394fc2e, 0x0394fc11, 0x0394fbed, 0x0394fbc3,
+	0x0394fb94, 0x0394fb5e, 0x0395fb21, 0x0396fade, 0x0396fa90, 0x0398fa41, 0x039af9ec, 0x039bf988,
+	0x039cf917, 0x039df8a3, 0x039ff831, 0x03a2f7af, 0x03a5f731, 0x03a7f6a1, 0x03abf612, 0x03aff57f,
+	0x03b0f4cd, 0x03b3f425, 0x03b8f37e, 0x03bcf2c5, 0x03bff202, 0x03c2f135, 0x03c5f061, 0x03c9ef8d,
+	0x03cceea9, 0x03cfedb8, 0x03cfecb2, 0x03cfeba1, 0x03d1ea92, 0x03d2e96d, 0x03d2e836, 0x03d1e6f2,
+	0x03cfe59b, 0x03cce44b, 0x03c9e303, 0x03c5e1be, 0x03c1e075, 0x03bbdf22, 0x03b6ddd2, 0x03afdc6e,
+	0x03a8db04, 0x039fd98a, 0x0394d7fc, 0x038bd66c, 0x0382d4ec, 0x0376d363, 0x036ad1e1, 0x035ed054,
+	0x0350cec1, 0x0344cd35, 0x0336cbac, 0x0329ca17, 0x031ac880, 0x030bc6f4, 0x02fcc568, 0x02ecc3d8,
+	0x02ddc24c, 0x02cdc0bc, 0x02bebf2d, 0x02aebda4, 0x029fbc18, 0x028fba83, 0x027fb8f0, 0x026fb75d,
+	0x0260b5d0, 0x0251b44b, 0x0241b2cf, 0x0232b158, 0x0223afe0, 0x0215ae67, 0x0206ace6, 0x01f8ab5f,
+	0x01eaa9d6, 0x01dca84d, 0x01cea6cb, 0x01c1a553, 0x01b4a3da, 0x01a8a260, 0x019ba0ea, 0x018f9f79,
+	0x01839e04, 0x01789c89, 0x016c9b09, 0x0161998b, 0x01579811, 0x014c9696, 0x0142951e, 0x013893a3,
+	0x012f9229, 0x012590ae, 0x011c8f33, 0x01138db9, 0x010b8c3b, 0x01038aba, 0x00fb893a, 0x00f387bb,
+	0x00eb8641, 0x00e484c9, 0x00dc834d, 0x00d681d1, 0x00cf8052, 0x00c87ed0, 0x00c27d4a, 0x00bc7bc9,
+	0x00b67a4d, 0x00b078d0, 0x00ab7752, 0x00a575d5, 0x00a07458, 0x009b72da, 0x0096715a, 0x00916fdd,
+	0x008c6e62, 0x00886ce6, 0x00846b6c, 0x008069f4, 0x007c687d, 0x00776705, 0x00746590, 0x0070641c,
+	0x0344fcbc, 0x0344fcb2, 0x0344fcaa, 0x0344fc98, 0x0343fc81, 0x0343fc64, 0x0343fc42, 0x0343fc19,
+	0x0343fbeb, 0x0344fbb7, 0x0344fb7c, 0x0345fb3b, 0x0345faef, 0x0347faa3, 0x0349fa50, 0x034af9ef,
+	0x034cf982, 0x034df911, 0x034ff8a1, 0x0351f821, 0x0355f7a9, 0x0357f71b, 0x035af68f, 0x035ff603,
+	0x0361f558, 0x0364f4b1, 0x0369f40d, 0x036df35c, 0x0370f29a, 0x0374f1d4, 0x0377f107, 0x037bf032,
+	0x037fef54, 0x0383ee6d, 0x0383ed6a, 0x0383ec59, 0x0386eb4c, 0x0388ea2e, 0x0388e8f6, 0x0389e7b6,
+	0x0388e66c, 0x0386e51f, 0x0383e3df, 0x0381e2a0, 0x037de158, 0x0379e00a, 0x0374deb9, 0x036fdd59,
+	0x0369dbee, 0x0362da76, 0x0359d8e4, 0x0351d756, 0x0349d5da, 0x033fd45a, 0x0334d2d4, 0x0329d143,
+	0x031dcfb0, 0x0311ce21, 0x0306cc95, 0x02f9cafb, 0x02ecc967, 0x02dfc7db, 0x02d1c64a, 0x02c3c4b4,
+	0x02b5c323, 0x02a6c18e, 0x0298bffd, 0x028abe6e, 0x027bbcd6, 0x026dbb3d, 0x025eb9a5, 0x0250b80e,
+	0x0241b67a, 0x0233b4f7, 0x0224b375, 0x0216b1f7, 0x0209b078, 0x01fbaef3, 0x01edad68, 0x01e0abd5,
+	0x01d3aa45, 0x01c6a8b9, 0x01b9a734, 0x01aca5b7, 0x01a0a434, 0x0194a2b6, 0x0188a13c, 0x017d9fc1,
+	0x01729e42, 0x01679cbd, 0x015c9b38, 0x015299b4, 0x01489834, 0x013e96b3, 0x01349533, 0x012b93b3,
+	0x01229234, 0x011990b3, 0x01108f30, 0x01078dae, 0x01008c27, 0x00f88aa4, 0x00f08920, 0x00e8879e,
+	0x00e18621, 0x00da84a1, 0x00d3831f, 0x00cd819c, 0x00c68018, 0x00c07e8e, 0x00ba7d09, 0x00b47b85,
+	0x00ae7a03, 0x00a97880, 0x00a376ff, 0x009e7580, 0x009973ff, 0x0094727c, 0x009070f9, 0x008b6f79,
+	0x00876df9, 0x00826c7b, 0x007e6aff, 0x007a6986, 0x0076680c, 0x00736693, 0x006f651a, 0x006b63a2,
+	0x02f9fd03, 0x02f9fcff, 0x02f9fcf4, 0x02f8fce4, 0x02f8fcce, 0x02f8fcb2, 0x02f8fc91, 0x02f8fc6a,
+	0x02f8fc3d, 0x02f9fc0a, 0x02f9fbd1, 0x02fafb92, 0x02fafb48, 0x02fcfafe, 0x02fefaae, 0x0300fa52,
+	0x0301f9e6, 0x0302f977, 0x0304f90a, 0x0306f88d, 0x030bf81a, 0x030df790, 0x0310f706, 0x0315f67f,
+	0x0318f5de, 0x031af536, 0x031ef494, 0x0324f3eb, 0x0327f32c, 0x032bf26e, 0x032ff1a5, 0x0332f0d1,
+	0x0336effa, 0x033bef17, 0x033cee1a, 0x033ded0b, 0x033febfd, 0x0342eae5, 0x0343e9ad, 0x0344e871,
+	0x0344e737, 0x0344e5ef, 0x0341e4b4, 0x0340e37a, 0x033de236, 0x033be0ed, 0x0337df9a, 0x0333de3e,
+	0x032edcd2, 0x0328db58, 0x0321d9c6, 0x0319d83c, 0x0312d6c0, 0x030ad54a, 0x0301d3c1, 0x02f6d22b,
+	0x02ecd097, 0x02e1cf07, 0x02d8cd78, 0x02cccbdf, 0x02c1ca50, 0x02b4c8c0, 0x02a8c727, 0x029bc58f,
+	0x028ec3f6, 0x0281c25f, 0x0274c0cb, 0x0267bf35, 0x0259bd92, 0x024cbbf9, 0x023eba58, 0x0231b8bd,
+	0x0223b729, 0x0216b5a2, 0x0209b41b, 0x01fcb295, 0x01efb10d, 0x01e2af7e, 0x01d5ade7, 0x01c9ac4d,
+	0x01bcaab7, 0x01b0a929, 0x01a4a7a2, 0x0198a619, 0x018da492, 0x0181a30e, 0x0176a18d, 0x016ca008,
+	0x01619e80, 0x01579cf3, 0x014c9b68, 0x014399e0, 0x01399856, 0x013096d2, 0x0126954b, 0x011e93c6,
+	0x01159241, 0x010c90b8, 0x01048f2e, 0x00fc8da2, 0x00f48c19, 0x00ed8a90, 0x00e68909, 0x00de8785,
+	0x00d785ff, 0x00d18479, 0x00ca82f2, 0x00c48169, 0x00be7fdc, 0x00b87e51, 0x00b27cca, 0x00ac7b42,
+	0x00a779ba, 0x00a17832, 0x009d76af, 0x0098752c, 0x009373a6, 0x008e7220, 0x008a709b, 0x00856f15,
+	0x00816d92, 0x007d6c12, 0x00796a95, 0x00756918, 0x0072679d, 0x006e6620, 0x006a64a4, 0x00676328,
+	0x02b3fd4e, 0x02b3fd43, 0x02b3fd3c, 0x02b3fd2b, 0x02b3fd15, 0x02b2fcfb, 0x02b2fcda, 0x02b2fcb4,
+	0x02b3fc89, 0x02b3fc57, 0x02b4fc21, 0x02b5fbe4, 0x02b5fb9b, 0x02b6fb54, 0x02b9fb06, 0x02bbfaaf,
+	0x02bcfa44, 0x02bdf9d7, 0x02bff96d, 0x02c1f8f3, 0x02c5f884, 0x02c8f801, 0x02cbf778, 0x02d0f6f4,
+	0x02d3f65c, 0x02d5f5b3, 0x02d9f514, 0x02dff472, 0x02e2f3b7, 0x02e7f2ff, 0x02ebf23a, 0x02eef16b,
+	0x02f3f099, 0x02f7efb8, 0x02faeec6, 0x02fbedba, 0x02fdeca7, 0x0301eb93, 0x0303ea64, 0x0304e92c,
+	0x0305e7fb, 0x0305e6bb, 0x0304e586, 0x0303e44e, 0x0301e30d, 0x02ffe1c7, 0x02fce076, 0x02fadf1b,
+	0x02f5ddae, 0x02f1dc34, 0x02ebdaa9, 0x02e4d920, 0x02ded7a6, 0x02d8d632, 0x02d0d4a9, 0x02c7d310,
+	0x02bed17f, 0x02b4cfec, 0x02abce56, 0x02a1ccc0, 0x0297cb33, 0x028cc99e, 0x0280c801, 0x0274c666,
+	0x0269c4c7, 0x025dc32f, 0x0251c197, 0x0245bff6, 0x0239be52, 0x022cbcb1, 0x0220bb0c, 0x0213b96c,
+	0x0207b7da, 0x01fab64c, 0x01eeb4c1, 0x01e2b332, 0x01d6b19f, 0x01cab006, 0x01beae65, 0x01b2acc5,
+	0x01a6ab2d, 0x019ba99c, 0x0190a80e, 0x0185a67b, 0x017aa4f1, 0x016fa369, 0x0165a1dc, 0x015ba050,
+	0x01519ebe, 0x01479d2b, 0x013d9b9b, 0x01349a0b, 0x012b987d, 0x012296f0, 0x01199566, 0x011193da,
+	0x0109924d, 0x010090be, 0x00f98f2b, 0x00f18d9a, 0x00ea8c0b, 0x00e38a7f, 0x00dc88f5, 0x00d5876a,
+	0x00ce85de, 0x00c88453, 0x00c182c5, 0x00bc8135, 0x00b67fa4, 0x00b07e18, 0x00aa7c8c, 0x00a57afe,
+	0x00a07971, 0x009b77e7, 0x00967661, 0x009174d8, 0x008d734e, 0x008871c6, 0x0084703c, 0x00806eb3,
+	0x007b6d2d, 0x00786bac, 0x00746a2b, 0x007068ad, 0x006d672d, 0x006965ad, 0x0066642e, 0x006362b3,
+	0x0272fd8e, 0x0272fd83, 0x0272fd7d, 0x0272fd6d, 0x0272fd58, 0x0272fd3e, 0x0272fd1e, 0x0272fcf9,
+	0x0272fccf, 0x0273fca0, 0x0273fc6b, 0x0274fc30, 0x0275fbe8, 0x0276fba3, 0x0278fb58, 0x027afb05,
+	0x027bfa9b, 0x027cfa32, 0x027ff9ca, 0x0281f955, 0x0285f8e8, 0x0288f86b, 0x028bf7e7, 0x028ff763,
+	0x0293f6d2, 0x0295f62a, 0x0299f590, 0x029ef4f1, 0x02a2f43c, 0x02a7f38a, 0x02abf2c8, 0x02aff1fe,
+	0x02b4f130, 0x02b8f052, 0x02bcef69, 0x02bdee63, 0x02bfed4d, 0x02c3ec39, 0x02c6eb13, 0x02c8e9e4,
+	0x02cae8b4, 0x02cae780, 0x02cae652, 0x02c9e51a, 0x02c9e3df, 0x02c7e29a, 0x02c6e14c, 0x02c3dff0,
+	0x02c0de85, 0x02bddd07, 0x02b8db86, 0x02b2d9fe, 0x02add889, 0x02a7d713, 0x02a1d58d, 0x0299d3f0,
+	0x0291d25f, 0x0289d0ca, 0x0280cf32, 0x0278cda3, 0x026fcc14, 0x0265ca79, 0x025ac8db, 0x0250c739,
+	0x0245c598, 0x023ac3fc, 0x0230c25d, 0x0224c0b2, 0x0219bf12, 0x020ebd66, 0x0202bbbf, 0x01f7ba1e,
+	0x01ebb88a, 0x01e0b6f7, 0x01d4b564, 0x01c9b3ce, 0x01beb22f, 0x01b3b08c, 0x01a7aee3, 0x019cad3f,
+	0x0192aba5, 0x0187aa0f, 0x017ca878, 0x0172a6e4, 0x0168a551, 0x015ea3c1, 0x0154a22d, 0x014aa095,
+	0x01419efe, 0x01389d66, 0x012e9bce, 0x01269a36, 0x011d98a4, 0x01159711, 0x010d9581, 0x010593ef,
+	0x00fd925a, 0x00f590c2, 0x00ed8f29, 0x00e68d94, 0x00df8c01, 0x00d88a70, 0x00d288e2, 0x00cb8750,
+	0x00c585c0, 0x00bf842c, 0x00b98297, 0x00b38101, 0x00ae7f70, 0x00a87de0, 0x00a37c4e, 0x009e7aba,
+	0x0099792b, 0x0094779e, 0x008f7612, 0x008b7484, 0x008772f8, 0x0082716a, 0x007e6fdd, 0x007a6e52,
+	0x00766ccc, 0x00736b45, 0x006f69c4, 0x006c6841, 0x006866bd, 0x0065653a, 0x006263bc, 0x005e623e,
+	0x0237fdcb, 0x0237fdc0, 0x0237fdb9, 0x0237fda9, 0x0237fd95, 0x0236fd7c, 0x0236fd5d, 0x0237fd3a,
+	0x0237fd11, 0x0237fce3, 0x0238fcaf, 0x0239fc76, 0x0239fc31, 0x023bfbee, 0x023dfba6, 0x023ffb55,
+	0x0240faee, 0x0241fa8a, 0x0243fa21, 0x0246f9b2, 0x0249f946, 0x024cf8ce, 0x024ff84d, 0x0253f7cb,
+	0x0258f743, 0x0259f69d, 0x025ef606, 0x0263f56b, 0x0267f4c0, 0x026cf40d, 0x0270f34f, 0x0274f28c,
+	0x0278f1c0, 0x027df0e7, 0x0282f007, 0x0284ef01, 0x0286edee, 0x0289ecd8, 0x028debb8, 0x0290ea97,
+	0x0291e964, 0x0293e840, 0x0293e714, 0x0293e5e0, 0x0293e4a9, 0x0293e367, 0x0292e21c, 0x0290e0bf,
+	0x028edf54, 0x028bddd6, 0x0288dc5b, 0x0283dadc, 0x027ed966, 0x027ad7ef, 0x0275d668, 0x026dd4cd,
+	0x0266d33a, 0x025fd1a2, 0x0258d00c, 0x0250ce81, 0x0248ccef, 0x023fcb50, 0x0236c9b0, 0x022cc808,
+	0x0223c666, 0x0219c4c6, 0x020fc320, 0x0205c176, 0x01fbbfcd, 0x01f1be1c, 0x01e6bc70, 0x01dbbad3,
+	0x01d1b939, 0x01c6b7a2, 0x01bcb607, 0x01b1b466, 0x01a7b2be, 0x019cb111, 0x0192af62, 0x0188adbf,
+	0x017dac1f, 0x0173aa82, 0x0169a8e3, 0x0160a74a, 0x0156a5b4, 0x014da418, 0x0144a27c, 0x013ba0dd,
+	0x01329f40, 0x01299da1, 0x01209c00, 0x01189a65, 0x011098cc, 0x01089736, 0x0100959e, 0x00f99404,
+	0x00f19266, 0x00ea90c6, 0x00e38f29, 0x00dc8d92, 0x00d58bf9, 0x00cf8a64, 0x00c888ce, 0x00c28738,
+	0x00bc85a0, 0x00b78406, 0x00b18269, 0x00ab80d3, 0x00a67f3e, 0x00a17da8, 0x009c7c10, 0x00977a79,
+	0x009278e7, 0x008e7755, 0x008975c3, 0x00857434, 0x008172a1, 0x007d7110, 0x00796f81, 0x00756df5,
+	0x00716c6a, 0x006e6ae2, 0x006a695c, 0x006767d4, 0x0064664e, 0x006164cb, 0x005d634a, 0x005a61cc,
+	0x0200fdff, 0x0200fdfc, 0x0200fdef, 0x0200fde1, 0x0200fdce, 0x0200fdb5, 0x0200fd98, 0x0200fd75,
+	0x0200fd4e, 0x0200fd21, 0x0201fcef, 0x0202fcb8, 0x0202fc74, 0x0204fc34, 0x0206fbed, 0x0208fba0,
+	0x0209fb3b, 0x020afadb, 0x020cfa74, 0x020ffa08, 0x0212f99e, 0x0216f92e, 0x0218f8ae, 0x021cf82e,
+	0x0221f7ac, 0x0223f70d, 0x0227f677, 0x022cf5df, 0x0231f53c, 0x0234f48b, 0x0238f3d1, 0x023ef316,
+	0x0241f24a, 0x0246f178, 0x024bf09b, 0x024def99, 0x0250ee87, 0x0254ed6e, 0x0258ec57, 0x025beb44,
+	0x025dea18, 0x025fe8fa, 0x0260e7d2, 0x0260e6a1, 0x0261e56e, 0x0261e42e, 0x0261e2e3, 0x0260e188,
+	0x025fe01c, 0x025cdea5, 0x025add2b, 0x0256dbb7, 0x0252da3f, 0x024ed8c4, 0x024ad73e, 0x0244d5aa,
+	0x023ed411, 0x0238d27a, 0x0232d0e8, 0x022bcf5a, 0x0224cdc7, 0x021ccc25, 0x0214ca81, 0x020bc8d9,
+	0x0202c732, 0x01f9c58d, 0x01f0c3de, 0x01e7c236, 0x01dec084, 0x01d4bed2, 0x01cbbd25, 0x01c1bb87,
+	0x01b7b9e8, 0x01aeb84a, 0x01a4b6a7, 0x019ab4fb, 0x0190b34c, 0x0186b195, 0x017dafe5, 0x0174ae40,
+	0x016aac9a, 0x0161aaf3, 0x0157a951, 0x014ea7b3, 0x0145a614, 0x013ca470, 0x0134a2cb, 0x012ba126,
+	0x01239f82, 0x011b9ddc, 0x01139c36, 0x010b9a94, 0x010398f7, 0x00fc975b, 0x00f495ba, 0x00ed9419,
+	0x00e69272, 0x00df90cd, 0x00d88f2e, 0x00d28d8f, 0x00cc8bf2, 0x00c58a58, 0x00bf88bc, 0x00ba8720,
+	0x00b48581, 0x00ae83de, 0x00a98241, 0x00a480a6, 0x009f7f0c, 0x009a7d70, 0x00957bd3, 0x00907a3b,
+	0x008c78a4, 0x0087770c, 0x00837578, 0x007f73e2, 0x007b724b, 0x007770b7, 0x00746f27, 0x00706d97,
+	0x006c6c0b, 0x00696a7f, 0x006668f2, 0x00626768, 0x005f65e2, 0x005c645c, 0x005962da, 0x00576159,
+	0x01cdfe30, 0x01cdfe2e, 0x01cdfe23, 0x01cdfe15, 0x01cdfe02, 0x01cdfdea, 0x01cdfdce, 0x01cdfdac,
+	0x01cdfd86, 0x01cefd5b, 0x01cefd2b, 0x01cffcf5, 0x01d0fcb6, 0x01d1fc75, 0x01d3fc31, 0x01d5fbe5,
+	0x01d6fb83, 0x01d8fb29, 0x01dafac5, 0x01dcfa59, 0x01dff9f2, 0x01e3f987, 0x01e5f908, 0x01e9f88c,
+	0x01eef810, 0x01f0f777, 0x01f4f6e2, 0x01f8f64d, 0x01fdf5b1, 0x0201f502, 0x0206f451, 0x020bf398,
+	0x020ef2d0, 0x0213f203, 0x0218f127, 0x021bf02d, 0x021def1a, 0x0221ee03, 0x0226ecf9, 0x0229ebe9,
+	0x022ceac6, 0x022ee9ac, 0x0230e889, 0x0231e75e, 0x0232e62c, 0x0232e4ef, 0x0232e3a5, 0x0232e24c,
+	0x0231e0db, 0x0230df6f, 0x022eddf8, 0x022cdc8c, 0x0228db13, 0x0225d994, 0x0222d80e, 0x021dd67f,
+	0x0218d4e2, 0x0212d34d, 0x020dd1c0, 0x0207d031, 0x0201ce98, 0x01faccf8, 0x01f2cb4d, 0x01ebc9a5,
+	0x01e3c7fa, 0x01dbc64f, 0x01d3c4a0, 0x01cbc2f2, 0x01c2c13c, 0x01babf87, 0x01b1bddd, 0x01a8bc37,
+	0x019fba95, 0x0196b8f1, 0x018db744, 0x0184b590, 0x017bb3d8, 0x0172b21b, 0x0169b06a, 0x0160aec0,
+	0x0157ad15, 0x014eab68, 0x0146a9be, 0x013da81c, 0x0135a675, 0x012da4c8, 0x0124a31a, 0x011da172,
+	0x01159fc5, 0x010d9e17, 0x01059c6d, 0x00fe9ac7, 0x00f79923, 0x00f0977f, 0x00e995d8, 0x00e2942c,
+	0x00db9280, 0x00d590d8, 0x00ce8f34, 0x00c88d90, 0x00c28bed, 0x00bc8a4c, 0x00b788ab, 0x00b18707,
+	0x00ac855f, 0x00a683bc, 0x00a1821a, 0x009c807a, 0x00987ed9, 0x00937d38, 0x008e7b9a, 0x008a79fe,
+	0x00867860, 0x008176c6, 0x007d752b, 0x007a7390, 0x007671f7, 0x00727063, 0x006e6ecd, 0x006b6d3c,
+	0x00686bac, 0x00646a1a, 0x0061688a, 0x005e6700, 0x005b6577, 0x005863f0, 0x0056626b, 0x005360e7,
+	0x019ffe5f, 0x019ffe5e, 0x019ffe51, 0x019ffe44, 0x019efe32, 0x019efe1b, 0x019efdff, 0x019ffddf,
+	0x019ffdba, 0x019ffd90, 0x01a0fd62, 0x01a1fd2e, 0x01a2fcf4, 0x01a2fcb1, 0x01a4fc70, 0x01a6fc27,
+	0x01a7fbc7, 0x01aafb72, 0x01abfb0f, 0x01adfaa5, 0x01b0fa41, 0x01b4f9da, 0x01b6f95e, 0x01b9f8e4,
+	0x01bef86d, 0x01c1f7dc, 0x01c4f747, 0x01c9f6b5, 0x01cef61e, 0x01d2f573, 0x01d7f4ca, 0x01dbf413,
+	0x01dff350, 0x01e4f286, 0x01e9f1ae, 0x01edf0b9, 0x01efefaa, 0x01f2ee91, 0x01f7ed93, 0x01fbec86,
+	0x01feeb70, 0x0200ea58, 0x0202e93b, 0x0204e813, 0x0205e6e4, 0x0206e5a9, 0x0207e462, 0x0208e30a,
+	0x0207e19a, 0x0207e034, 0x0205dec4, 0x0204dd5c, 0x0201dbe4, 0x01feda5f, 0x01fbd8dc, 0x01f8d74f,
+	0x01f3d5b6, 0x01eed41c, 0x01ead293, 0x01e5d104, 0x01dfcf64, 0x01dacdc7, 0x01d3cc1b, 0x01ccca6f,
+	0x01c5c8c1, 0x01bec70e, 0x01b7c561, 0x01afc3aa, 0x01a8c1f2, 0x01a0c03d, 0x0198be94, 0x018fbcea,
+	0x0187bb40, 0x017fb994, 0x0177b7de, 0x016fb624, 0x0166b462, 0x015eb2a6, 0x0155b0f1, 0x014daf41,
+	0x0145ad8e, 0x013dabdb, 0x0135aa2e, 0x012da885, 0x0125a6d4, 0x011da520, 0x0116a36d, 0x010ea1bb,
+	0x0107a008, 0x01009e54, 0x00f89ca4, 0x00f29afb, 0x00eb9951, 0x00e497a5, 0x00dd95f4, 0x00d79441,
+	0x00d19290, 0x00cb90e5, 0x00c58f3b, 0x00bf8d90, 0x00b98be9, 0x00b48a42, 0x00ae8899, 0x00a986ed,
+	0x00a48542, 0x009f839b, 0x009a81f4, 0x0095804e, 0x00917ea8, 0x008c7d04, 0x00887b62, 0x008479c0,
+	0x00807820, 0x007c767f, 0x007874de, 0x00747340, 0x007171a7, 0x006d700e, 0x006a6e77, 0x00666ce1,
+	0x00636b4b, 0x006069b6, 0x005d6826, 0x005a6699, 0x0057650e, 0x00546384, 0x005261fb, 0x004f6076,
+	0x0174fe8c, 0x0174fe83, 0x0174fe7e, 0x0174fe70, 0x0174fe5e, 0x0174fe48, 0x0174fe2d, 0x0174fe0e,
+	0x0174fdea, 0x0175fdc2, 0x0175fd95, 0x0176fd63, 0x0177fd2b, 0x0178fcea, 0x0179fcaa, 0x017bfc64,
+	0x017cfc06, 0x017ffbb5, 0x0180fb54, 0x0182faec, 0x0185fa8b, 0x0188fa28, 0x018bf9b1, 0x018ef93c,
+	0x0193f8c6, 0x0196f83c, 0x0198f7a7, 0x019df71a, 0x01a2f686, 0x01a6f5e2, 0x01abf53d, 0x01aff489,
+	0x01b3f3cc, 0x01b8f302, 0x01bdf230, 0x01c1f13d, 0x01c4f030, 0x01c7ef1a, 0x01ccee27, 0x01d0ed1e,
+	0x01d3ec15, 0x01d6eb00, 0x01d8e9e9, 0x01dae8c5, 0x01dce797, 0x01dde660, 0x01dee517, 0x01dfe3bd,
+	0x01e0e257, 0x01e0e0f0, 0x01dfdf8b, 0x01dede25, 0x01dcdcae, 0x01d9db24, 0x01d7d9a6, 0x01d5d817,
+	0x01d1d686, 0x01cdd4ee, 0x01c9d361, 0x01c5d1d2, 0x01c0d031, 0x01bbce91, 0x01b5cce6, 0x01afcb35,
+	0x01a9c983, 0x01a2c7ce, 0x019cc61e, 0x0195c461, 0x018ec2a7, 0x0187c0f7, 0x0180bf49, 0x0178bd9a,
+	0x0171bbe9, 0x0169ba34, 0x0162b877, 0x015ab6b4, 0x0153b4f0, 0x014bb331, 0x0143b178, 0x013bafc0,
+	0x0134ae0a, 0x012cac51, 0x0125aa9d, 0x011da8ec, 0x0116a734, 0x010fa578, 0x0108a3c1, 0x0100a205,
+	0x00faa04d, 0x00f39e93, 0x00ec9ce0, 0x00e69b30, 0x00df997f, 0x00d997c9, 0x00d39610, 0x00cd9457,
+	0x00c792a5, 0x00c190f3, 0x00bb8f42, 0x00b68d92, 0x00b08be7, 0x00ab8a38, 0x00a68887, 0x00a186d5,
+	0x009c8528, 0x0097837b, 0x009381cf, 0x008e8022, 0x008a7e78, 0x00867cd1, 0x00827b2a, 0x007e7984,
+	0x007a77df, 0x00767637, 0x00727493, 0x006f72f3, 0x006b7156, 0x00686fbb, 0x00656e21, 0x00626c85,
+	0x005f6aeb, 0x005c6955, 0x005967c3, 0x00566633, 0x005364a5, 0x00516317, 0x004e618e, 0x004c6004,
+	0x014dfeb0, 0x014dfeaf, 0x014dfea4, 0x014dfe98, 0x014dfe87, 0x014dfe71, 0x014dfe58, 0x014dfe39,
+	0x014dfe17, 0x014efdf0, 0x014efdc4, 0x014ffd94, 0x0150fd5e, 0x0151fd1f, 0x0152fce1, 0x0154fc9d,
+	0x0155fc41, 0x0157fbf4, 0x0158fb95, 0x015afb2f, 0x015dfad1, 0x0161fa72, 0x0163f9ff, 0x0167f98f,
+	0x016af919, 0x016ef897, 0x0170f802, 0x0175f77a, 0x0179f6e9, 0x017ef64e, 0x0182f5aa, 0x0186f4f8,
+	0x018bf445, 0x018ff37b, 0x0194f2ae, 0x0198f1be, 0x019cf0af, 0x019fefa6, 0x01a3eeb6, 0x01a8edb4,
+	0x01abecb5, 0x01aeeba2, 0x01b1ea8e, 0x01b3e96e, 0x01b5e846, 0x01b7e70f, 0x01b8e5c6, 0x01b9e46a,
+	0x01bae311, 0x01bbe1aa, 0x01bbe050, 0x01badee9, 0x01b9dd72, 0x01b7dbeb, 0x01b5da6a, 0x01b3d8de,
+	0x01b1d74e, 0x01add5be, 0x01a9d42d, 0x01a6d29a, 0x01a2d0fc, 0x019dcf58, 0x0199cdad, 0x0193cbf8,
+	0x018dca40, 0x0188c88f, 0x0182c6d6, 0x017cc518, 0x0176c35c, 0x0170c1ad, 0x0169bffe, 0x0162be49,
+	0x015bbc8f, 0x0154bad2, 0x014eb90e, 0x0146b745, 0x0140b580, 0x0138b3bf, 0x0131b1fe, 0x012ab040,
+	0x0123ae83, 0x011cacc7, 0x0115ab0e, 0x010ea952, 0x0108a794, 0x0101a5d4, 0x00faa412, 0x00f3a251,
+	0x00eda091, 0x00e69ed5, 0x00e09d1c, 0x00da9b64, 0x00d499ac, 0x00ce97ed, 0x00c8962d, 0x00c29470,
+	0x00bd92ba, 0x00b89103, 0x00b28f4a, 0x00ad8d97, 0x00a88be4, 0x00a38a2d, 0x009e8873, 0x009986c2,
+	0x0095850f, 0x0090835c, 0x008c81a9, 0x00887ff8, 0x00847e4b, 0x00807c9e, 0x007c7af3, 0x00787949,
+	0x0074779d, 0x007175f2, 0x006d744b, 0x006a72a8, 0x00667107, 0x00636f69, 0x00606dc9, 0x005d6c29,
+	0x005a6a8d, 0x005868f5, 0x00556761, 0x005265cd, 0x0050643c, 0x004d62ae, 0x004b611f, 0x00485f95,
+	0x0129fed3, 0x0129fed0, 0x0129feca, 0x0129febd, 0x0129feac, 0x0129fe97, 0x0129fe7e, 0x0129fe61,
+	0x0129fe40, 0x012afe1a, 0x012afdf0, 0x012bfdc1, 0x012cfd8e, 0x012dfd4f, 0x012efd14, 0x0130fcd3,
+	0x0131fc7c, 0x0133fc2f, 0x0134fbd1, 0x0136fb6e, 0x0139fb16, 0x013cfab7, 0x013efa48, 0x0142f9dc,
+	0x0145f968, 0x0149f8ed, 0x014cf85c, 0x0150f7d7, 0x0154f749, 0x0159f6b4, 0x015df613, 0x0161f565,
+	0x0166f4b7, 0x0169f3f1, 0x016ef325, 0x0173f238, 0x0176f12e, 0x0179f02f, 0x017def3e, 0x0182ee45,
+	0x0186ed4e, 0x0189ec41, 0x018ceb2c, 0x018fea15, 0x0191e8ed, 0x0193e7b9, 0x0194e66e, 0x0196e519,
+	0x0197e3c3, 0x0198e264, 0x0199e10f, 0x0198dfa8, 0x0198de2f, 0x0196dcaf, 0x0195db28, 0x0193d9a0,
+	0x0192d816, 0x018fd689, 0x018bd4f4, 0x0189d35e, 0x0186d1c2, 0x0182d01e, 0x017dce71, 0x0179ccb6,
+	0x0173cafe, 0x016fc94b, 0x016ac78b, 0x0164c5cf, 0x015fc415, 0x0159c264, 0x0153c0b1, 0x014dbef3,
+	0x0146bd34, 0x0140bb6e, 0x013ab9a3, 0x0134b7d9, 0x012db611, 0x0127b44c, 0x0120b282, 0x0119b0c1,
+	0x0113aeff, 0x010cad3c, 0x0106ab7d, 0x0100a9b8, 0x00f9a7f5, 0x00f3a630, 0x00eda463, 0x00e7a29e,
+	0x00e0a0d8, 0x00db9f18, 0x00d59d58, 0x00cf9b9b, 0x00c999d7, 0x00c49813, 0x00be964d, 0x00b9948d,
+	0x00b492d0, 0x00ae9111, 0x00a98f55, 0x00a48d9c, 0x00a08be1, 0x009b8a21, 0x00968866, 0x009286ae,
+	0x008e84f6, 0x0089833d, 0x00858186, 0x00817fd1, 0x007d7e1e, 0x007a7c6d, 0x00767abf, 0x0072790c,
+	0x006f775b, 0x006b75ae, 0x00687406, 0x0065725e, 0x006270ba, 0x005f6f16, 0x005c6d71, 0x00596bcf,
+	0x00566a31, 0x00546898, 0x005166ff, 0x004e6568, 0x004c63d5, 0x004a6243, 0x004760b4, 0x00455f26,
+	0x0108fef3, 0x0108fef0, 0x0108feeb, 0x0108fede, 0x0108fece, 0x0108feba, 0x0108fea2, 0x0109fe86,
+	0x0109fe65, 0x0109fe41, 0x010afe18, 0x010bfdeb, 0x010cfdba, 0x010cfd7d, 0x010dfd44, 0x010ffd04,
+	0x0111fcb2, 0x0112fc65, 0x0114fc0d, 0x0115fba9, 0x0118fb56, 0x011bfaf9, 0x011dfa91, 0x0120fa25,
+	0x0123f9b3, 0x0128f93f, 0x012af8b4, 0x012ef82f, 0x0132f7a3, 0x0136f713, 0x013af675, 0x013ef5cf,
+	0x0143f523, 0x0147f462, 0x014bf395, 0x0150f2ac, 0x0154f1a4, 0x0157f0b3, 0x015befc3, 0x015feed2,
+	0x0163ede1, 0x0167ecdc, 0x0169ebc8, 0x016deab7, 0x016fe992, 0x0171e85e, 0x0173e713, 0x0175e5c2,
+	0x0177e46e, 0x0177e31b, 0x0178e1c8, 0x0179e062, 0x0178dee6, 0x0178dd6d, 0x0176dbe4, 0x0175da5f,
+	0x0174d8db, 0x0172d750, 0x016fd5b8, 0x016dd41f, 0x016bd287, 0x0167d0e1, 0x0163cf2f, 0x015fcd74,
+	0x015bcbbd, 0x0157ca03, 0x0152c843, 0x014dc683, 0x0149c4cd, 0x0143c31a, 0x013ec161, 0x0138bf9c,
+	0x0133bdd5, 0x012dbc09, 0x0127ba37, 0x0122b86d, 0x011cb6a3, 0x0116b4d8, 0x010fb309, 0x0109b140,
+	0x0104af79, 0x00fdadb3, 0x00f8abec, 0x00f2aa20, 0x00eca856, 0x00e6a688, 0x00e0a4b8, 0x00daa2eb,
+	0x00d5a123, 0x00cf9f5b, 0x00ca9d96, 0x00c49bcf, 0x00bf9a04, 0x00ba9839, 0x00b59671, 0x00af94aa,
+	0x00aa92e5, 0x00a69122, 0x00a18f63, 0x009c8da1, 0x00988bdc, 0x00938a19, 0x008f885a, 0x008b869b,
+	0x008784dd, 0x00838320, 0x007f8164, 0x007b7faa, 0x00777df2, 0x00747c3e, 0x00707a88, 0x006d78d0,
+	0x006a771c, 0x0066756d, 0x006373c1, 0x00607217, 0x005d706d, 0x005a6ec2, 0x00576d1a, 0x00556b77,
+	0x005269d7, 0x0050683a, 0x004d669e, 0x004b6505, 0x0048636d, 0x004661db, 0x00446047, 0x00425eb8,
+	0x00ebff12, 0x00ebff0f, 0x00ebff09, 0x00ebfefd, 0x00ebfeed, 0x00ebfeda, 0x00ebfec3, 0x00ebfea7,
+	0x00ebfe88, 0x00ecfe65, 0x00ecfe3e, 0x00edfe12, 0x00eefde2, 0x00eefda7, 0x00effd70, 0x00f1fd33,
+	0x00f3fce4, 0x00f4fc99, 0x00f6fc45, 0x00f6fbe2, 0x00f9fb91, 0x00fcfb37, 0x00fffad5, 0x0101fa69,
+	0x0104f9fa, 0x0109f98c, 0x010bf907, 0x010ef881, 0x0112f7fb, 0x0117f76d, 0x011bf6d5, 0x011ff636,
+	0x0123f58b, 0x0127f4cf, 0x012bf3ff, 0x0130f31a, 0x0134f21b, 0x0137f134, 0x013bf044, 0x013fef5a,
+	0x0143ee6f, 0x0147ed72, 0x0149ec5e, 0x014deb53, 0x014fea2e, 0x0152e8fe, 0x0154e7b1, 0x0156e668,
+	0x0158e51a, 0x0159e3cf, 0x015ae27b, 0x015be118, 0x015bdf9f, 0x015bde26, 0x015adca1, 0x0159db19,
+	0x0159d99d, 0x0157d812, 0x0155d678, 0x0153d4dd, 0x0151d347, 0x014ed1a1, 0x014bcfe9, 0x0147ce30,
+	0x0144cc78, 0x0140cab4, 0x013cc8f9, 0x0138c739, 0x0133c585, 0x012fc3cc, 0x012ac20e, 0x0125c043,
+	0x0120be73, 0x011bbca2, 0x0115bacf, 0x0110b903, 0x010bb735, 0x0105b562, 0x0100b392, 0x00fab1c0,
+	0x00f5aff5, 0x00efae29, 0x00eaac59, 0x00e4aa8a, 0x00dfa8b7, 0x00d9a6e0, 0x00d4a50d, 0x00cea33a,
+	0x00c9a16d, 0x00c49f9f, 0x00bf9dd3, 0x00ba9c02, 0x00b59a32, 0x00b09861, 0x00ab9695, 0x00a694c9,
+	0x00a292fb, 0x009d9135, 0x00998f6f, 0x00958da4, 0x00908bd9, 0x008c8a15, 0x0088884e, 0x00848689,
+	0x008084c5, 0x007c8303, 0x00798144, 0x00757f84, 0x00727dc9, 0x006e7c0d, 0x006b7a51, 0x00687896,
+	0x006476df, 0x0061752d, 0x005e737e, 0x005c71cf, 0x0059701e, 0x00566e70, 0x00536cc6, 0x00516b21,
+	0x004e697e, 0x004c67dd, 0x004a663f, 0x004764a1, 0x00456309, 0x00436171, 0x00415fdb, 0x003f5e4d,
+	0x00d0ff2f, 0x00d0ff2e, 0x00d0ff23, 0x00d0ff18, 0x00d0ff09, 0x00d0fef7, 0x00d0fee0, 0x00d0fec6,
+	0x00d0fea8, 0x00d1fe86, 0x00d1fe60, 0x00d2fe36, 0x00d3fe08, 0x00d3fdcf, 0x00d4fd99, 0x00d6fd5e,
+	0x00d7fd12, 0x00d9fcc9, 0x00dafc78, 0x00dbfc1a, 0x00defbc9, 0x00e0fb71, 0x00e3fb15, 0x00e5faaa,
+	0x00e8fa3f, 0x00ecf9d4, 0x00eff954, 0x00f2f8d0, 0x00f5f84e, 0x00f9f7c3, 0x00fef733, 0x0102f696,
+	0x0106f5ed, 0x010af538, 0x010df463, 0x0112f380, 0x0116f28f, 0x011af1b1, 0x011df0c3, 0x0121efde,
+	0x0125eef9, 0x0129ee02, 0x012becf0, 0x012febe7, 0x0132eaca, 0x0134e997, 0x0137e850, 0x0139e708,
+	0x013be5c5, 0x013de47d, 0x013ee329, 0x013fe1c7, 0x013fe053, 0x0140ded7, 0x013fdd57, 0x013fdbd3,
+	0x013fda5a, 0x013ed8cf, 0x013cd736, 0x013ad59b, 0x0139d403, 0x0137d25d, 0x0134d0a2, 0x0131ceea,
+	0x012ecd30, 0x012acb68, 0x0127c9ac, 0x0123c7f1, 0x011fc639, 0x011bc47d, 0x0117c2b8, 0x0112c0e7,
+	0x010ebf11, 0x0109bd3a, 0x0104bb67, 0x0100b997, 0x00fbb7c6, 0x00f6b5ee, 0x00f1b418, 0x00ebb23f,
+	0x00e6b06f, 0x00e1ae9e, 0x00dcacc8, 0x00d7aaf3, 0x00d2a916, 0x00cda73b, 0x00c8a563, 0x00c3a38d,
+	0x00bea1b8, 0x00b99fe5, 0x00b59e0e, 0x00b09c37, 0x00ab9a60, 0x00a7988d, 0x00a296b9, 0x009e94e7,
+	0x00999314, 0x00959149, 0x00918f7a, 0x008d8da8, 0x00898bdb, 0x00858a0f, 0x00818843, 0x007d8678,
+	0x007a84af, 0x007682e9, 0x00738124, 0x006f7f61, 0x006c7d9f, 0x00697bdc, 0x00667a1b, 0x0063785e,
+	0x006076a5, 0x005d74f0, 0x005a733a, 0x00577185, 0x00556fd2, 0x00526e21, 0x004f6c74, 0x004d6acb,
+	0x004b6924, 0x00486781, 0x004665de, 0x00446441, 0x004262a3, 0x00406107, 0x003e5f73, 0x003c5de4,
+	0x00b7ff4b, 0x00b7ff42, 0x00b7ff3d, 0x00b7ff32, 0x00b7ff23, 0x00b7ff11, 0x00b7fefc, 0x00b8fee2,
+	0x00b8fec5, 0x00b8fea5, 0x00b9fe80, 0x00b9fe58, 0x00bafe2b, 0x00bafdf3, 0x00bcfdc0, 0x00bdfd87,
+	0x00befd3d, 0x00c0fcf6, 0x00c1fca7, 0x00c2fc4d, 0x00c4fbfd, 0x00c7fba8, 0x00cafb51, 0x00ccfaea,
+	0x00cffa84, 0x00d2fa19, 0x00d5f9a1, 0x00d7f91b, 0x00dbf89e, 0x00dff815, 0x00e3f78e, 0x00e7f6f3,
+	0x00ebf64a, 0x00eff59c, 0x00f2f4c5, 0x00f7f3e5, 0x00faf2ff, 0x00fef22a, 0x0101f13f, 0x0105f060,
+	0x010aef7d, 0x010eee8d, 0x0110ed83, 0x0114ec77, 0x0117eb5f, 0x0119ea2b, 0x011ce8e9, 0x011ee7a3,
+	0x0120e669, 0x0122e526, 0x0124e3d5, 0x0125e271, 0x0126e102, 0x0126df8a, 0x0126de0b, 0x0126dc8c,
+	0x0126db13, 0x0126d987, 0x0124d7f0, 0x0123d658, 0x0121d4b9, 0x0120d312, 0x011ed15b, 0x011bcfa0,
+	0x0119cde2, 0x0116cc1d, 0x0113ca5d, 0x0110c8aa, 0x010cc6ec, 0x0109c52b, 0x0105c35f, 0x0101c188,
+	0x00fdbfae, 0x00f8bdd4, 0x00f4bc01, 0x00f0ba2c, 0x00ebb855, 0x00e7b67a, 0x00e2b49c, 0x00ddb2c2,
+	0x00d9b0ea, 0x00d4af12, 0x00d0ad38, 0x00cbab59, 0x00c6a977, 0x00c2a797, 0x00bda5bb, 0x00b8a3de,
+	0x00b4a203, 0x00afa028, 0x00ab9e4b, 0x00a69c6e, 0x00a29a93, 0x009e98b9, 0x009a96de, 0x00959506,
+	0x00919331, 0x008d915b, 0x00898f83, 0x00868db0, 0x00828bde, 0x007e8a0a, 0x007b8838, 0x00778668,
+	0x0074849b, 0x007082cf, 0x006d8106, 0x006a7f3e, 0x00677d75, 0x00647bad, 0x006179e8, 0x005e7827,
+	0x005b766e, 0x005874b1, 0x005572f5, 0x0053713c, 0x00506f86, 0x004e6dd3, 0x004c6c22, 0x00496a75,
+	0x004768cd, 0x00456724, 0x00436581, 0x004163df, 0x003f623d, 0x003d60a2, 0x003b5f0d, 0x00395d7a,
+	0x00a1ff5f, 0x00a1ff5c, 0x00a1ff52, 0x00a1ff49, 0x00a1ff3b, 0x00a1ff29, 0x00a1ff14, 0x00a2fefc,
+	0x00a2fee0, 0x00a2fec1, 0x00a2fe9d, 0x00a3fe76, 0x00a4fe4b, 0x00a4fe15, 0x00a5fde3, 0x00a7fdad,
+	0x00a8fd65, 0x00a9fd20, 0x00abfcd8, 0x00acfc7c, 0x00aefc2e, 0x00b0fbdc, 0x00b3fb89, 0x00b5fb25,
+	0x00b8fac3, 0x00bbfa5a, 0x00bef9e9, 0x00c0f964, 0x00c3f8ed, 0x00c6f863, 0x00cbf7e3, 0x00cef74b,
+	0x00d2f6a6, 0x00d6f5fb, 0x00d9f523, 0x00def443, 0x00e1f36d, 0x00e5f29b, 0x00e8f1b7, 0x00ecf0de,
+	0x00f0effb, 0x00f4ef12, 0x00f7ee10, 0x00faed02, 0x00fdebed, 0x0100eaba, 0x0102e97d, 0x0105e83e,
+	0x0107e70b, 0x0109e5cb, 0x010be47a, 0x010de319, 0x010ee1ae, 0x010ee038, 0x010fdebb, 0x010fdd42,
+	0x010fdbc6, 0x010fda3c, 0x010ed8a8, 0x010dd70f, 0x010cd56e, 0x010bd3c4, 0x0109d213, 0x0107d054,
+	0x0105ce91, 0x0102ccd1, 0x00ffcb10, 0x00fdc95e, 0x00fac79e, 0x00f7c5d5, 0x00f3c403, 0x00f0c228,
+	0x00ecc04a, 0x00e8be70, 0x00e5bc98, 0x00e1babf, 0x00ddb8e3, 0x00d9b705, 0x00d4b523, 0x00d0b341,
+	0x00ccb164, 0x00c8af88, 0x00c3ada5, 0x00bfabbf, 0x00bba9d9, 0x00b6a7f5, 0x00b2a614, 0x00aea430,
+	0x00aaa24f, 0x00a5a06a, 0x00a19e88, 0x009d9ca6, 0x00999ac5, 0x009598e5, 0x00919704, 0x008d9527,
+	0x008a934d, 0x0086916c, 0x00828f90, 0x007f8db9, 0x007b8be0, 0x00788a05, 0x0074882e, 0x00718659,
+	0x006e8488, 0x006a82b7, 0x006780e9, 0x00647f18, 0x00617d4b, 0x005f7b80, 0x005c79b6, 0x005977f4,
+	0x00567635, 0x00547472, 0x005172b2, 0x004f70f5, 0x004c6f3c, 0x004a6d85, 0x00486bd1, 0x00466a23,
+	0x00446874, 0x004166ca, 0x003f6523, 0x003e637c, 0x003c61db, 0x003a603f, 0x00385ea6, 0x00365d10,
+	0x008dff70, 0x008dff6f, 0x008dff68, 0x008dff5d, 0x008dff50, 0x008dff3f, 0x008eff2b, 0x008eff13,
+	0x008efef9, 0x008efeda, 0x008efeb8, 0x008ffe93, 0x0090fe6a, 0x0091fe39, 0x0091fe05, 0x0093fdd0,
+	0x0094fd8b, 0x0095fd47, 0x0097fd04, 0x0097fca8, 0x0099fc5d, 0x009bfc11, 0x009efbbe, 0x00a0fb5d,
+	0x00a2faff, 0x00a5fa97, 0x00a8fa2b, 0x00aaf9ac, 0x00aef936, 0x00b0f8b0, 0x00b5f833, 0x00b8f79f,
+	0x00bcf701, 0x00c0f656, 0x00c3f57f, 0x00c6f4a7, 0x00caf3d9, 0x00cef306, 0x00d1f22c, 0x00d5f157,
+	0x00d8f077, 0x00ddef94, 0x00e0ee99, 0x00e2ed88, 0x00e6ec74, 0x00e9eb4c, 0x00ebea0e, 0x00eee8da,
+	0x00f0e7a8, 0x00f2e66c, 0x00f4e51a, 0x00f6e3be, 0x00f7e256, 0x00f8e0e2, 0x00f9df69, 0x00f9ddf4,
+	0x00f9dc76, 0x00f9daee, 0x00f9d95f, 0x00f8d7c5, 0x00f8d623, 0x00f7d475, 0x00f6d2c5, 0x00f4d107,
+	0x00f2cf42, 0x00f0cd82, 0x00edcbc6, 0x00ebca0e, 0x00e9c84d, 0x00e6c67c, 0x00e3c4a6, 0x00e0c2c5,
+	0x00ddc0e7, 0x00d9bf0a, 0x00d6bd31, 0x00d2bb54, 0x00cfb972, 0x00cbb78f, 0x00c7b5a8, 0x00c3b3c1,
+	0x00bfb1df, 0x00bcaffe, 0x00b8ae12, 0x00b4ac26, 0x00b0aa3d, 0x00aca855, 0x00a8a66c, 0x00a4a483,
+	0x00a0a298, 0x009ca0ae, 0x00989ec7, 0x00959ce1, 0x00919afa, 0x008d9910, 0x0089972c, 0x0086954a,
+	0x00829366, 0x007f917f, 0x007b8fa1, 0x00788dc2, 0x00748be2, 0x00718a02, 0x006e8826, 0x006b864b,
+	0x00688475, 0x006582a2, 0x006280c9, 0x005f7ef4, 0x005c7d22, 0x005a7b54, 0x00577988, 0x005477c2,
+	0x005275fa, 0x00507433, 0x004d7270, 0x004b70b0, 0x00496ef3, 0x00466d37, 0x00446b83, 0x004269cf,
+	0x0040681e, 0x003e6671, 0x003c64c3, 0x003b631c, 0x0039617b, 0x00375fdc, 0x00355e40, 0x00345ca6,
+	0x007cff82, 0x007cff7f, 0x007cff7a, 0x007cff70, 0x007cff63, 0x007cff53, 0x007cff3f, 0x007cff29,
+	0x007cff0f, 0x007cfef2, 0x007dfed1, 0x007dfead, 0x007efe85, 0x007ffe58, 0x007ffe24, 0x0080fdf1,
+	0x0081fdae, 0x0082fd6c, 0x0084fd2c, 0x0085fcd2, 0x0086fc89, 0x0088fc41, 0x008bfbef, 0x008dfb94,
+	0x008ffb37, 0x0092fad2, 0x0095fa6a, 0x0097f9f3, 0x009af97b, 0x009df8fb, 0x00a0f87f, 0x00a4f7f2,
+	0x00a7f756, 0x00abf6aa, 0x00aef5d3, 0x00b1f506, 0x00b5f442, 0x00b9f371, 0x00bcf29f, 0x00bff1cc,
+	0x00c3f0ee, 0x00c7f010, 0x00caef1c, 0x00cdee0f, 0x00d0ecf8, 0x00d3ebd9, 0x00d5ea9b, 0x00d8e970,
+	0x00dae841, 0x00dde705, 0x00dfe5b7, 0x00e1e460, 0x00e2e2fe, 0x00e3e189, 0x00e4e013, 0x00e5dea2,
+	0x00e5dd21, 0x00e5db9a, 0x00e6da11, 0x00e5d876, 0x00e5d6d1, 0x00e4d524, 0x00e3d373, 0x00e2d1b6,
+	0x00e0cff2, 0x00dece30, 0x00dccc78, 0x00dbcabc, 0x00d9c8f8, 0x00d6c723, 0x00d3c544, 0x00d1c363,
+	0x00cec186, 0x00cbbfa4, 0x00c8bdc8, 0x00c5bbe4, 0x00c1ba00, 0x00beb81a, 0x00bab62d, 0x00b7b441,
+	0x00b3b25c, 0x00b0b071, 0x00acae7d, 0x00a9ac8f, 0x00a5aaa3, 0x00a1a8b3, 0x009ea6c6, 0x009aa4d4,
+	0x0097a2e2, 0x0093a0f4, 0x00909f08, 0x008c9d1b, 0x00889b2c, 0x0085993e, 0x00829754, 0x007e956b,
+	0x007b937f, 0x00789196, 0x00748fb2, 0x00718dca, 0x006e8be4, 0x006b8a00, 0x0068881f, 0x00658640,
+	0x00628466, 0x0060828a, 0x005d80aa, 0x005a7ed1, 0x00587cfb, 0x00557b2a, 0x0053795d, 0x0050778e,
+	0x004e75c0, 0x004b73f5, 0x00497230, 0x0047706c, 0x00456eaa, 0x00436ced, 0x00416b34, 0x003f697e,
+	0x003d67c9, 0x003b6615, 0x00396467, 0x003862bf, 0x0036611b, 0x00345f79, 0x00335dda, 0x00315c3d,
+	0x006cff92, 0x006cff8f, 0x006cff8a, 0x006cff80, 0x006cff74, 0x006cff65, 0x006cff52, 0x006cff3c,
+	0x006cff23, 0x006cff07, 0x006cfee8, 0x006dfec5, 0x006efe9f, 0x006efe74, 0x006ffe41, 0x0070fe10,
+	0x0071fdcf, 0x0072fd8f, 0x0074fd52, 0x0074fcfc, 0x0075fcb2, 0x0078fc6e, 0x007afc1f, 0x007cfbc8,
+	0x007efb6c, 0x0080fb0a, 0x0083faa6, 0x0085fa35, 0x0088f9bd, 0x008af942, 0x008ef8c7, 0x0092f843,
+	0x0095f7a9, 0x0098f6fa, 0x009bf621, 0x009ef566, 0x00a2f4a4, 0x00a5f3da, 0x00a9f310, 0x00acf23e,
+	0x00aff165, 0x00b3f087, 0x00b6ef9a, 0x00b9ee92, 0x00bced76, 0x00bfec5e, 0x00c1eb29, 0x00c4ea01,
+	0x00c6e8d6, 0x00c9e799, 0x00cbe654, 0x00cde4fc, 0x00cee39f, 0x00cfe22e, 0x00d0e0ba, 0x00d1df4b,
+	0x00d2ddcd, 0x00d3dc49, 0x00d3dabe, 0x00d3d924, 0x00d3d77f, 0x00d2d5d2, 0x00d2d41c, 0x00d1d265,
+	0x00cfd0a2, 0x00cecee1, 0x00cccd27, 0x00cbcb68, 0x00c9c99e, 0x00c7c7c9, 0x00c4c5e2, 0x00c2c402,
+	0x00c0c223, 0x00bdc03d, 0x00babe5e, 0x00b8bc77, 0x00b5ba8e, 0x00b2b8a2, 0x00aeb6b0, 0x00abb4c3,
+	0x00a8b2d7, 0x00a5b0e1, 0x00a2aeeb, 0x009eacfa, 0x009bab08, 0x0098a912, 0x0094a71f, 0x0091a524,
+	0x008ea32d, 0x008aa13a, 0x00879f4a, 0x00849d57, 0x00819b61, 0x007d996e, 0x007a977d, 0x0077958a,
+	0x0074939c, 0x007191af, 0x006e8fc2, 0x006b8dd3, 0x00688be8, 0x00658a00, 0x00638819, 0x00608638,
+	0x005d8456, 0x005a8271, 0x0058808e, 0x00557eaf, 0x00537cd6, 0x00517b03, 0x004e792f, 0x004c775a,
+	0x004a7587, 0x004773b9, 0x004571f1, 0x00437028, 0x00416e62, 0x003f6ca3, 0x003d6ae6, 0x003c692c,
+	0x003a6773, 0x003865bd, 0x0036640d, 0x00356263, 0x003360bb, 0x00325f17, 0x00305d74, 0x002f5bd7,
+	0x005dffa0, 0x005dff9f, 0x005dff99, 0x005dff90, 0x005dff84, 0x005dff75, 0x005dff63, 0x005dff4e,
+	0x005eff36, 0x005eff1b, 0x005efefd, 0x005ffedb, 0x005ffeb7, 0x0060fe8e, 0x0060fe5c, 0x0061fe2c,
+	0x0062fdee, 0x0063fdb3, 0x0065fd75, 0x0065fd24, 0x0066fcdc, 0x0068fc98, 0x006afc4b, 0x006cfbf8,
+	0x006efba1, 0x0071fb43, 0x0073fadf, 0x0076fa75, 0x0077f9fe, 0x007af988, 0x007df90c, 0x0081f890,
+	0x0084f7f7, 0x0087f746, 0x008af676, 0x008df5c2, 0x0090f500, 0x0094f440, 0x0097f37d, 0x009af2af,
+	0x009df1d7, 0x00a0f0fb, 0x00a4f015, 0x00a7ef0f, 0x00a9edf4, 0x00adecdd, 0x00afebb8, 0x00b1ea8f,
+	0x00b4e967, 0x00b6e82c, 0x00b9e6ea, 0x00bbe59a, 0x00bce43d, 0x00bde2cf, 0x00bee15e, 0x00c0dfef,
+	0x00c1de76, 0x00c1dcf4, 0x00c2db66, 0x00c2d9cd, 0x00c2d82c, 0x00c1d67d, 0x00c1d4c1, 0x00c1d313,
+	0x00c0d151, 0x00becf90, 0x00bdcdd2, 0x00bccc12, 0x00baca42, 0x00b9c86a, 0x00b7c682, 0x00b4c4a0,
+	0x00b2c2bf, 0x00b0c0d8, 0x00aebef1, 0x00abbd09, 0x00a8bb1b, 0x00a6b92a, 0x00a3b734, 0x00a0b544,
+	0x009db350, 0x009ab152, 0x0097af5d, 0x0094ad66, 0x0091ab6b, 0x008ea974, 0x008ba776, 0x0088a576,
+	0x0085a37a, 0x0082a182, 0x007f9f8d, 0x007c9d91, 0x00799b96, 0x0076999f, 0x007397a4, 0x007095ad,
+	0x006d93bc, 0x006b91c7, 0x00688fd2, 0x00658ddd, 0x00628bee, 0x00608a01, 0x005d8816, 0x005b862f,
+	0x00588443, 0x0056825a, 0x00538072, 0x00517e8f, 0x004e7cb5, 0x004c7adb, 0x004a7900, 0x00487727,
+	0x00467551, 0x0044737f, 0x004271b1, 0x00406fe4, 0x003e6e1d, 0x003c6c59, 0x003a6a99, 0x003968d9,
+	0x0037671e, 0x00356567, 0x003463b5, 0x00326206, 0x0031605c, 0x002f5eb4, 0x002e5d10, 0x002c5b72,
+	0x0050ffaf, 0x0050ffae, 0x0050ffa4, 0x0050ff9d, 0x0050ff92, 0x0050ff83, 0x0051ff72, 0x0051ff5e,
+	0x0051ff47, 0x0051ff2d, 0x0051ff10, 0x0052fef0, 0x0052fecd, 0x0053fea6, 0x0053fe75, 0x0054fe47,
+	0x0055fe0a, 0x0056fdd4, 0x0057fd97, 0x0058fd48, 0x0059fd03, 0x005bfcc0, 0x005cfc76, 0x005efc26,
+	0x0060fbd2, 0x0063fb7a, 0x0065fb17, 0x0067fab1, 0x0069fa3b, 0x006cf9cb, 0x006ef94e, 0x0072f8d7,
+	0x0074f841, 0x0077f790, 0x007af6cd, 0x007df61d, 0x0080f556, 0x0084f4a3, 0x0087f3e4, 0x008af31c,
+	0x008cf246, 0x0090f16a, 0x0093f08a, 0x0096ef86, 0x0098ee72, 0x009ced5b, 0x009eec43, 0x00a0eb19,
+	0x00a3e9f3, 0x00a5e8bd, 0x00a7e77a, 0x00aae634, 0x00abe4d8, 0x00ade36f, 0x00aee200, 0x00afe090,
+	0x00b0df1c, 0x00b1dd9c, 0x00b1dc0a, 0x00b2da76, 0x00b2d8d6, 0x00b2d722, 0x00b2d569, 0x00b2d3bd,
+	0x00b1d200, 0x00b0d03f, 0x00afce7a, 0x00aeccb8, 0x00accae6, 0x00abc907, 0x00a9c723, 0x00a7c53c,
+	0x00a6c358, 0x00a4c171, 0x00a2bf85, 0x009fbd9b, 0x009dbba9, 0x009bb9b0, 0x0098b7ba, 0x0096b5c2,
+	0x0093b3c5, 0x0090b1c7, 0x008eafce, 0x008badd1, 0x0088abd0, 0x0085a9d2, 0x0083a7cf, 0x0080a5c8,
+	0x007da3c8, 0x007aa1cc, 0x00779fce, 0x00759dcf, 0x00729bce, 0x006f99cd, 0x006c97cc, 0x006a95d3,
+	0x006793d9, 0x006491de, 0x00628fe3, 0x005f8de8, 0x005d8bf4, 0x005a8a03, 0x00588815, 0x00558623,
+	0x00538432, 0x00518244, 0x004e8057, 0x004c7e73, 0x004a7c94, 0x00487ab2, 0x004678d3, 0x004476f4,
+	0x0042751c, 0x00407346, 0x003e7171, 0x003c6fa3, 0x003b6dd8, 0x00396c11, 0x00376a4a, 0x00366888,
+	0x003466cb, 0x00326512, 0x0031635c, 0x002f61ab, 0x002e5ffc, 0x002d5e52, 0x002b5cad, 0x002a5b0e,
+	0x0045ffbc, 0x0045ffb3, 0x0045ffb1, 0x0045ffa9, 0x0045ff9e, 0x0045ff90, 0x0045ff80, 0x0045ff6d,
+	0x0045ff56, 0x0046ff3d, 0x0046ff22, 0x0046ff03, 0x0047fee1, 0x0047febc, 0x0048fe8c, 0x0049fe60,
+	0x0049fe26, 0x004bfdf3, 0x004bfdb6, 0x004cfd69, 0x004dfd28, 0x004ffce6, 0x0050fc9f, 0x0052fc51,
+	0x0054fc01, 0x0056fbac, 0x0058fb4c, 0x005afaeb, 0x005cfa79, 0x005efa0a, 0x0061f991, 0x0064f91c,
+	0x0067f88a, 0x0069f7d3, 0x006cf71e, 0x006ff674, 0x0071f5b0, 0x0075f502, 0x0078f448, 0x007bf387,
+	0x007df2b1, 0x0080f1d8, 0x0084f0fa, 0x0087eff9, 0x0089eeee, 0x008cedd9, 0x008fecc8, 0x0090eba0,
+	0x0093ea79, 0x0096e94b, 0x0098e80a, 0x009ae6cb, 0x009be570, 0x009de40a, 0x009ee29d, 0x009fe12e,
+	0x00a1dfc0, 0x00a2de40, 0x00a2dcad, 0x00a3db1c, 0x00a3d97c, 0x00a3d7c4, 0x00a3d611, 0x00a3d463,
+	0x00a3d2ae, 0x00a2d0eb, 0x00a1cf1f, 0x00a0cd5a, 0x00a0cb87, 0x009ec9a5, 0x009dc7c3, 0x009bc5d8,
+	0x009ac3f1, 0x0098c208, 0x0096c01a, 0x0094be2b, 0x0092bc36, 0x0090ba38, 0x008eb83e, 0x008bb63f,
+	0x0089b43a, 0x0087b23e, 0x0084b040, 0x0082ae39, 0x007fac36, 0x007daa2f, 0x007aa826, 0x0078a61e,
+	0x0075a417, 0x0073a215, 0x0070a011, 0x006d9e0a, 0x006b9c05, 0x006899fb, 0x006697f8, 0x006395fa,
+	0x006193f8, 0x005e91f5, 0x005c8ff5, 0x005a8df7, 0x00578bfb, 0x00558a09, 0x00538811, 0x00518617,
+	0x004e8422, 0x004c822f, 0x004a8040, 0x00487e59, 0x00467c70, 0x00447a8b, 0x004278a5, 0x004076c4,
+	0x003e74e6, 0x003d730d, 0x003b7135, 0x00396f62, 0x00376d95, 0x00366bc7, 0x003469fd, 0x0033683a,
+	0x0031667a, 0x003064bd, 0x002e6304, 0x002d614f, 0x002c5f9e, 0x002a5df2, 0x00295c4c, 0x00285aaa,
+	0x003bffc2, 0x003bffbf, 0x003bffbd, 0x003bffb4, 0x003bffa9, 0x003bff9c, 0x003bff8c, 0x003bff7a,
+	0x003bff64, 0x003cff4c, 0x003cff32, 0x003cff14, 0x003dfef4, 0x003dfed0, 0x003dfea2, 0x003efe78,
+	0x003ffe3f, 0x0040fe0e, 0x0041fdd3, 0x0042fd89, 0x0043fd4a, 0x0044fd09, 0x0045fcc9, 0x0047fc7b,
+	0x0049fc2d, 0x004bfbdc, 0x004cfb7e, 0x004ffb22, 0x0050fab4, 0x0052fa46, 0x0055f9d0, 0x0058f95c,
+	0x005af8d1, 0x005df80c, 0x005ff76d, 0x0062f6c6, 0x0064f60b, 0x0067f55c, 0x006af4a9, 0x006df3ee,
+	0x0070f31b, 0x0072f241, 0x0076f165, 0x0079f06e, 0x007bef62, 0x007dee51, 0x0080ed49, 0x0082ec27,
+	0x0085eafd, 0x0087e9d4, 0x0089e89b, 0x008be75b, 0x008de604, 0x008ee4a2, 0x0090e336, 0x0091e1c9,
+	0x0092e05f, 0x0094dee0, 0x0094dd4f, 0x0095dbc0, 0x0095da1d, 0x0096d868, 0x0096d6b9, 0x0096d50b,
+	0x0096d358, 0x0095d193, 0x0094cfc3, 0x0094cdfa, 0x0093cc27, 0x0092ca45, 0x0091c860, 0x0090c674,
+	0x008ec489, 0x008dc29c, 0x008bc0b0, 0x008abeba, 0x0088bcbf, 0x0086bac3, 0x0084b8be, 0x0082b6b8,
+	0x0080b4b5, 0x007eb2b6, 0x007cb0b1, 0x0079aea3, 0x0077ac9a, 0x0075aa8d, 0x0072a87f, 0x0070a672,
+	0x006ea468, 0x006ba25e, 0x0069a055, 0x00679e47, 0x00649c39, 0x00629a2e, 0x00609825, 0x005d961f,
+	0x005b9416, 0x0059920d, 0x00579007, 0x00548e05, 0x00528c08, 0x00508a0c, 0x004e880c, 0x004c860e,
+	0x004a8413, 0x0048821c, 0x0046802c, 0x00447e3d, 0x00427c4e, 0x00407a63, 0x003e787b, 0x003d7694,
+	0x003b74b2, 0x003972d4, 0x003870f9, 0x00366f24, 0x00346d4f, 0x00336b7d, 0x003169b2, 0x003067ed,
+	0x002f6629, 0x002d6469, 0x002c62ad, 0x002b60f4, 0x00295f41, 0x00285d94, 0x00275beb, 0x00265a46,
+	0x0032ffce, 0x0032ffcc, 0x0032ffc4, 0x0032ffbd, 0x0032ffb3, 0x0032ffa6, 0x0032ff97, 0x0032ff85,
+	0x0033ff71, 0x0033ff5a, 0x0033ff41, 0x0033ff24, 0x0034ff05, 0x0034fee3, 0x0034feb6, 0x0035fe8e,
+	0x0036fe57, 0x0037fe29, 0x0038fdef, 0x0038fdab, 0x0039fd6a, 0x003afd2b, 0x003cfcee, 0x003dfca5,
+	0x003ffc5a, 0x0040fc09, 0x0042fbb0, 0x0044fb56, 0x0046faed, 0x0048fa80, 0x004afa0e, 0x004cf999,
+	0x004ff913, 0x0051f850, 0x0054f7bb, 0x0056f715, 0x0059f663, 0x005bf5b1, 0x005ef50a, 0x0061f450,
+	0x0063f383, 0x0066f2a9, 0x0069f1cb, 0x006cf0de, 0x006eefd3, 0x0070eecb, 0x0073edc7, 0x0075eca7,
+	0x0077eb7f, 0x007aea56, 0x007ce929, 0x007ee7e8, 0x0080e69b, 0x0081e535, 0x0082e3cd, 0x0084e265,
+	0x0085e0fb, 0x0086df7b, 0x0087ddef, 0x0088dc60, 0x0088dab7, 0x0089d90a, 0x0089d75c, 0x0089d5b2,
+	0x0089d3fe, 0x0089d238, 0x0088d068, 0x0088ce95, 0x0088ccc4, 0x0087cae6, 0x0086c8fa, 0x0085c70e,
+	0x0084c521, 0x0082c330, 0x0081c143, 0x0080bf49, 0x007ebd49, 0x007cbb4a, 0x007ab93e, 0x0079b733,
+	0x0077b531, 0x0075b32d, 0x0073b120, 0x0071af0e, 0x006facfd, 0x006daaea, 0x006ba8da, 0x0069a6c9,
+	0x0067a4b9, 0x0064a2a9, 0x0062a098, 0x00609e82, 0x005e9c6f, 0x005c9a62, 0x005a9854, 0x00589644,
+	0x00559436, 0x00539226, 0x0051901b, 0x004f8e18, 0x004d8c14, 0x004b8a0e, 0x00498809, 0x00478605,
+	0x00468405, 0x0044820c, 0x00428016, 0x00407e22, 0x003e7c2d, 0x003c7a3d, 0x003b784f, 0x00397665,
+	0x0038747f, 0x0036729d, 0x003470bf, 0x00336ee5, 0x00316d0b, 0x00306b36, 0x002f6969, 0x002d67a0,
+	0x002c65d9, 0x002b6415, 0x00296256, 0x0028609a, 0x00275ee6, 0x00265d37, 0x00255b8b, 0x002459e2,
+	0x002bffd2, 0x002bffd0, 0x002bffcd, 0x002bffc5, 0x002bffbc, 0x002bffb0, 0x002bffa1, 0x002bff90,
+	0x002bff7d, 0x002bff67, 0x002bff4e, 0x002bff33, 0x002cff16, 0x002cfef5, 0x002dfec9, 0x002dfea3,
+	0x002efe6d, 0x002ffe41, 0x002ffe09, 0x0030fdc9, 0x0031fd88, 0x0032fd4c, 0x0033fd12, 0x0034fccb,
+	0x0036fc84, 0x0038fc37, 0x0039fbe0, 0x003bfb87, 0x003dfb26, 0x003efab8, 0x0040fa4b, 0x0042f9d4,
+	0x0045f950, 0x0047f896, 0x0049f806, 0x004cf75f, 0x004ef6b8, 0x0050f604, 0x0053f568, 0x0056f4af,
+	0x0058f3e7, 0x005af30e, 0x005df230, 0x0060f148, 0x0062f048, 0x0064ef47, 0x0067ee40, 0x0069ed20,
+	0x006bec01, 0x006deadc, 0x006fe9b3, 0x0071e875, 0x0073e72c, 0x0075e5c4, 0x0076e462, 0x0077e2ff,
+	0x0079e193, 0x007ae015, 0x007bde8f, 0x007cdcfc, 0x007cdb51, 0x007dd9ac, 0x007dd802, 0x007ed656,
+	0x007ed4a0, 0x007ed2d9, 0x007dd10a, 0x007dcf31, 0x007dcd60, 0x007ccb84, 0x007bc996, 0x007ac7a6,
+	0x007ac5b9, 0x0078c3c7, 0x0077c1d3, 0x0076bfd7, 0x0075bdd6, 0x0073bbce, 0x0072b9bb, 0x0070b7b1,
+	0x006fb5af, 0x006db3a2, 0x006bb18f, 0x0069af78, 0x0067ad60, 0x0065ab4b, 0x0064a933, 0x0062a720,
+	0x0060a50a, 0x005ea2f5, 0x005ca0da, 0x005a9ebd, 0x00589ca9, 0x00569a96, 0x00549881, 0x0052966b,
+	0x00509454, 0x004e9240, 0x004c9031, 0x004a8e29, 0x00498c1f, 0x00478a11, 0x00458805, 0x004385fd,
+	0x004183fa, 0x004081fe, 0x003e7fff, 0x003c7e06, 0x003b7c0f, 0x00397a17, 0x00377824, 0x00367638,
+	0x0034744d, 0x00337268, 0x00317085, 0x00306ea4, 0x002f6cc9, 0x002d6af2, 0x002c6920, 0x002b6753,
+	0x002a6589, 0x002863c2, 0x002761fe, 0x00266042, 0x00255e8d, 0x00245cda, 0x00235b2a, 0x0022597f,
+	0x0024ffdc, 0x0024ffdb, 0x0024ffd3, 0x0024ffcd, 0x0024ffc4, 0x0024ffb8, 0x0024ffaa, 0x0024ff9a,
+	0x0024ff87, 0x0024ff72, 0x0024ff5b, 0x0025ff41, 0x0025ff25, 0x0025ff06, 0x0026fedf, 0x0026feb6,
+	0x0027fe82, 0x0028fe59, 0x0028fe22, 0x0029fde5, 0x002afdaa, 0x002afd6b, 0x002cfd34, 0x002dfcf0,
+	0x002efcac, 0x0030fc62, 0x0031fc10, 0x0033fbb6, 0x0034fb5b, 0x0036faed, 0x0038fa84, 0x003afa0e,
+	0x003cf985, 0x003ef8df, 0x0040f84e, 0x0042f7a8, 0x0044f70a, 0x0046f65a, 0x0049f5c1, 0x004cf50c,
+	0x004ef448, 0x0050f370, 0x0052f295, 0x0055f1af, 0x0058f0bc, 0x005aefbe, 0x005beeb3, 0x005eed96,
+	0x0060ec80, 0x0062eb60, 0x0064ea38, 0x0066e8fd, 0x0068e7b7, 0x0069e651, 0x006be4f7, 0x006ce393,
+	0x006de226, 0x006fe0af, 0x0070df2a, 0x0071dd94, 0x0071dbed, 0x0072da4a, 0x0072d8a6, 0x0073d6f8,
+	0x0073d53e, 0x0073d379, 0x0073d1a9, 0x0072cfce, 0x0072cdfd, 0x0072cc1d, 0x0071ca33, 0x0071c83c,
+	0x0070c64f, 0x006fc45c, 0x006ec262, 0x006dc066, 0x006cbe5f, 0x006bbc4e, 0x0069ba3c, 0x0068b832,
+	0x0066b629, 0x0065b418, 0x0063b1fd, 0x0062afe1, 0x0060adc6, 0x005eaba8, 0x005da991, 0x005ba777,
+	0x0059a55c, 0x0058a33e, 0x0056a11b, 0x00549efc, 0x00529ce4, 0x00509acb, 0x004f98ae, 0x004d9692,
+	0x004b9474, 0x0049925a, 0x0047904c, 0x00468e3a, 0x00448c28, 0x00428a16, 0x00418803, 0x003f85f6,
+	0x003d83f1, 0x003c81ee, 0x003a7feb, 0x00397dec, 0x00377bef, 0x003679f2, 0x003477fb, 0x00337609,
+	0x0031741e, 0x00307233, 0x002f7049, 0x002d6e65, 0x002c6c89, 0x002b6aae, 0x002968d7, 0x00286706,
+	0x0027653a, 0x0026636f, 0x002561aa, 0x00245fec, 0x00235e33, 0x00225c7c, 0x00215acb, 0x0020591e,
+	0x001effdf, 0x001effdf, 0x001effdb, 0x001effd3, 0x001effcb, 0x001effc0, 0x001effb2, 0x001effa3,
+	0x001eff91, 0x001eff7d, 0x001eff67, 0x001fff4e, 0x001fff33, 0x001fff15, 0x0020fef2, 0x0020fec8,
+	0x0021fe96, 0x0021fe6f, 0x0022fe3a, 0x0023fe00, 0x0023fdc7, 0x0024fd8d, 0x0025fd54, 0x0026fd13,
+	0x0027fcd1, 0x0029fc8a, 0x002afc3d, 0x002bfbe3, 0x002dfb8c, 0x002efb25, 0x0030faba, 0x0032fa44,
+	0x0034f9b2, 0x0036f925, 0x0038f895, 0x003af7f1, 0x003cf758, 0x003ef6af, 0x0040f615, 0x0042f567,
+	0x0045f4a5, 0x0047f3d0, 0x0049f2f7, 0x004bf210, 0x004ef12a, 0x0050f032, 0x0051ef26, 0x0054ee0c,
+	0x0056ecfb, 0x0058ebe1, 0x005aeabc, 0x005ce985, 0x005de83c, 0x005fe6df, 0x0060e588, 0x0061e424,
+	0x0063e2b8, 0x0064e147, 0x0065dfc1, 0x0066de2a, 0x0067dc88, 0x0068dae8, 0x0068d948, 0x0068d797,
+	0x0069d5d8, 0x0069d415, 0x0069d246, 0x0069d06c, 0x0069ce96, 0x0069ccb6, 0x0068cacb, 0x0068c8d3,
+	0x0067c6e4, 0x0066c4f0, 0x0065c2f2, 0x0065c0f3, 0x0064bee6, 0x0062bccd, 0x0061babd, 0x0060b8b4,
+	0x005fb6a1, 0x005eb48d, 0x005cb26b, 0x005bb04a, 0x0059ae2c, 0x0058ac08, 0x0056a9ed, 0x0055a7d0,
+	0x0053a5ae, 0x0051a386, 0x0050a15e, 0x004e9f3d, 0x004d9d1e, 0x004b9afe, 0x004998dc, 0x004896ba,
+	0x00469496, 0x0044927a, 0x00439064, 0x00418e4a, 0x00408c32, 0x003e8a1a, 0x003d8805, 0x003b85f3,
+	0x003a83e7, 0x003881df, 0x00377fd7, 0x00357dd2, 0x00347bce, 0x003279d1, 0x003177d2, 0x003075de,
+	0x002e73ee, 0x002d71fc, 0x002c700f, 0x002b6e29, 0x00296c48, 0x00286a6b, 0x00276890, 0x002666bb,
+	0x002564e9, 0x0024631d, 0x00236158, 0x00225f97, 0x00215dd9, 0x00205c1f, 0x001f5a6d, 0x001e58be,
+	0x0019ffe3, 0x0019ffe2, 0x0019ffdf, 0x0019ffd9, 0x0019ffd1, 0x0019ffc6, 0x0019ffba, 0x0019ffab,
+	0x0019ff9a, 0x0019ff87, 0x0019ff71, 0x001aff5a, 0x001aff40, 0x001aff23, 0x001bff03, 0x001bfeda,
+	0x001bfea9, 0x001cfe83, 0x001cfe50, 0x001dfe18, 0x001efde2, 0x001efdab, 0x001ffd73, 0x0020fd37,
+	0x0021fcf5, 0x0023fcb1, 0x0024fc67, 0x0025fc0e, 0x0027fbbc, 0x0028fb5a, 0x0029faed, 0x002bfa7a,
+	0x002df9e4, 0x002ff968, 0x0031f8d8, 0x0032f83a, 0x0034f7a5, 0x0036f703, 0x0038f665, 0x003af5c1,
+	0x003cf4fe, 0x003ef42c, 0x0040f355, 0x0043f276, 0x0045f193, 0x0047f0a3, 0x0048ef97, 0x004aee7e,
+	0x004ced75, 0x004eec5f, 0x0050eb3d, 0x0052ea0a, 0x0054e8c0, 0x0055e76c, 0x0056e615, 0x0058e4b2,
+	0x0059e34a, 0x005ae1d9, 0x005ce054, 0x005ddebf, 0x005ddd22, 0x005edb87, 0x005fd9e5, 0x005fd835,
+	0x005fd674, 0x0060d4ad, 0x0060d2e1, 0x0060d10c, 0x0060cf2d, 0x0060cd4e, 0x0060cb60, 0x005fc96c,
+	0x005ec778, 0x005ec580, 0x005dc385, 0x005dc17d, 0x005cbf6a, 0x005bbd51, 0x005abb40, 0x0059b934,
+	0x0058b71c, 0x0057b4fd, 0x0055b2db, 0x0054b0b6, 0x0053ae8f, 0x0051ac6b, 0x0050aa4b, 0x004fa829,
+	0x004da5fc, 0x004ca3cd, 0x004aa1a6, 0x00499f7f, 0x00479d58, 0x00469b32, 0x0044990a, 0x004396e0,
+	0x004194bb, 0x00409299, 0x003e907b, 0x003d8e5c, 0x003c8c3c, 0x003a8a20, 0x00398806, 0x003785f0,
+	0x003683de, 0x003581cf, 0x00337fc5, 0x00327db7, 0x00317bb1, 0x002f79ae, 0x002e77ad, 0x002d75b4,
+	0x002b73bc, 0x002a71c6, 0x00296fd8, 0x00286dee, 0x00276c09, 0x00266a28, 0x00256849, 0x0024666f,
+	0x0023649b, 0x002262cd, 0x00216105, 0x00205f41, 0x001f5d7f, 0x001e5bc4, 0x001d5a0e, 0x001c5860,
+	0x0015ffec, 0x0015ffeb, 0x0015ffe3, 0x0015ffde, 0x0015ffd6, 0x0015ffcc, 0x0015ffc0, 0x0015ffb2,
+	0x0015ffa2, 0x0015ff8f, 0x0015ff7b, 0x0015ff65, 0x0015ff4c, 0x0016ff31, 0x0016ff13, 0x0016feea,
+	0x0017febb, 0x0017fe97, 0x0018fe6a, 0x0018fe30, 0x0019fdfc, 0x0019fdc6, 0x001afd90, 0x001bfd5a,
+	0x001cfd17, 0x001dfcd7, 0x001efc8f, 0x001ffc3a, 0x0021fbeb, 0x0022fb8d, 0x0023fb20, 0x0025fab0,
+	0x0027fa1c, 0x0029f9a8, 0x002af917, 0x002cf87f, 0x002df7f0, 0x002ff753, 0x0031f6b4, 0x0033f617,
+	0x0035f555, 0x0037f48a, 0x0038f3b3, 0x003bf2d9, 0x003df1fb, 0x003ff111, 0x0040f002, 0x0042eeeb,
+	0x0044edec, 0x0046ecdd, 0x0047ebbb, 0x0049ea8b, 0x004be940, 0x004ce7f4, 0x004ee6a0, 0x004fe53b,
+	0x0050e3da, 0x0051e26b, 0x0053e0e5, 0x0054df50, 0x0054ddbd, 0x0055dc21, 0x0056da7e, 0x0056d8ce,
+	0x0057d70c, 0x0057d547, 0x0057d37b, 0x0058d1a7, 0x0057cfc5, 0x0057cde3, 0x0057cbf5, 0x0057ca04,
+	0x0057c80c, 0x0056c612, 0x0056c414, 0x0055c203, 0x0054bfec, 0x0054bdd9, 0x0053bbc2, 0x0052b9b1,
+	0x0051b795, 0x0050b56f, 0x004fb349, 0x004eb120, 0x004daef3, 0x004baccf, 0x004aaaaa, 0x0049a87f,
+	0x0048a64b, 0x0046a418, 0x0045a1ec, 0x00449fc0, 0x00429d94, 0x00419b66, 0x00409938, 0x003e970a,
+	0x003d94e0, 0x003c92b8, 0x003a9093, 0x00398e6c, 0x00388c49, 0x00368a27, 0x00358808, 0x003485ef,
+	0x003283d6, 0x003181c3, 0x00307fae, 0x002f7da0, 0x002d7b95, 0x002c798b, 0x002b7789, 0x002a7589,
+	0x0029738a, 0x00287192, 0x00276fa0, 0x00266db4, 0x00256bcb, 0x002469e5, 0x00236802, 0x00226626,
+	0x0021644f, 0x0020627e, 0x001f60b3, 0x001e5eeb, 0x001d5d27, 0x001c5b69, 0x001b59b2, 0x001b5802,
+	0x0011ffef, 0x0011ffee, 0x0011ffe9, 0x0011ffe2, 0x0011ffdb, 0x0011ffd1, 0x0011ffc6, 0x0011ffb8,
+	0x0011ffa9, 0x0011ff97, 0x0011ff84, 0x0011ff6f, 0x0012ff57, 0x0012ff3e, 0x0012ff21, 0x0012fef9,
+	0x0013fecc, 0x0013feaa, 0x0014fe81, 0x0014fe47, 0x0015fe14, 0x0015fde1, 0x0016fdac, 0x0017fd79,
+	0x0017fd37, 0x0019fcfd, 0x001afcb9, 0x001bfc64, 0x001cfc18, 0x001dfbbd, 0x001efb50, 0x0020fadd,
+	0x0021fa53, 0x0023f9e5, 0x0024f955, 0x0026f8c6, 0x0027f837, 0x0029f7a0, 0x002af704, 0x002df668,
+	0x002ef5a7, 0x0030f4e3, 0x0032f40e, 0x0033f339, 0x0035f261, 0x0037f17c, 0x0039f06e, 0x003aef5d,
+	0x003cee5f, 0x003eed57, 0x0040ec36, 0x0041eb07, 0x0043e9c4, 0x0044e87a, 0x0046e727, 0x0047e5c7,
+	0x0048e46a, 0x0049e2f9, 0x004ae172, 0x004bdfe3, 0x004cde57, 0x004ddcb9, 0x004edb16, 0x004ed964,
+	0x004fd7a1, 0x004fd5de, 0x004fd416, 0x0050d23e, 0x0050d05f, 0x0050ce73, 0x0050cc8b, 0x0050ca9b,
+	0x004fc89f, 0x004fc6a3, 0x004fc49f, 0x004ec28a, 0x004dc072, 0x004dbe60, 0x004cbc45, 0x004bba2e,
+	0x004bb80c, 0x004ab5e2, 0x0049b3b8, 0x0048b189, 0x0047af5b, 0x0046ad33, 0x0045ab0a, 0x0044a8d2,
+	0x0042a69a, 0x0041a466, 0x0040a234, 0x003fa001, 0x003e9dd0, 0x003c9b9a, 0x003b9966, 0x003a9736,
+	0x00399506, 0x003792d7, 0x003690ac, 0x00358e7f, 0x00348c55, 0x00338a30, 0x0031880c, 0x003085ec,
+	0x002f83d1, 0x002e81b5, 0x002d7f9a, 0x002c7d89, 0x002b7b78, 0x0029796c, 0x00287764, 0x0027755d,
+	0x0026735c, 0x0025715f, 0x00246f6a, 0x00236d7a, 0x00226b8d, 0x002169a1, 0x002067bc, 0x001f65de,
+	0x001f6404, 0x001e622f, 0x001d6060, 0x001c5e96, 0x001b5cd0, 0x001a5b11, 0x001a5958, 0x001957a3,
+	0x000efff0, 0x000effef, 0x000effed, 0x000effe6, 0x000effdf, 0x000effd6, 0x000effcb, 0x000effbe,
+	0x000effb0, 0x000eff9f, 0x000eff8d, 0x000eff78, 0x000eff62, 0x000fff4a, 0x000fff2e, 0x000fff08,
+	0x000ffedc, 0x0010febc, 0x0010fe96, 0x0011fe5c, 0x0011fe2c, 0x0011fdfa, 0x0012fdc7, 0x0013fd98,
+	0x0014fd57, 0x0015fd21, 0x0016fcdf, 0x0016fc91, 0x0018fc43, 0x0019fbeb, 0x0019fb7f, 0x001bfb03,
+	0x001cfa86, 0x001efa1e, 0x001ff997, 0x0020f909, 0x0022f87d, 0x0023f7ec, 0x0025f754, 0x0027f6b4,
+	0x0028f5f6, 0x002af53b, 0x002bf46c, 0x002df397, 0x002ff2c5, 0x0031f1e0, 0x0032f0d9, 0x0034efd0,
+	0x0035eecd, 0x0037edce, 0x0039ecb4, 0x003aeb80, 0x003bea45, 0x003de8fd, 0x003ee7a8, 0x003fe650,
+	0x0041e4f5, 0x0042e382, 0x0043e1fd, 0x0044e077, 0x0045deeb, 0x0045dd4f, 0x0046dba9, 0x0047d9f9,
+	0x0047d83a, 0x0048d673, 0x0048d4ae, 0x0048d2d6, 0x0048d0f4, 0x0048cf04, 0x0049cd1f, 0x0049cb2e,
+	0x0048c935, 0x0048c731, 0x0048c525, 0x0047c311, 0x0047c0fb, 0x0046bee3, 0x0046bcc7, 0x0045baa9,
+	0x0045b882, 0x0044b657, 0x0043b426, 0x0042b1f2, 0x0041afc5, 0x0040ad96, 0x003fab64, 0x003ea928,
+	0x003da6eb, 0x003ca4b2, 0x003ba27b, 0x003aa043, 0x00399e0b, 0x00389bcf, 0x00379997, 0x00369762,
+	0x0035952c, 0x003492f6, 0x003290c5, 0x00318e94, 0x00308c62, 0x002f8a38, 0x002e8810, 0x002d85ed,
+	0x002c83c9, 0x002b81a6, 0x002a7f89, 0x00297d70, 0x00287b5f, 0x0027794d, 0x0026773e, 0x00257533,
+	0x0024732e, 0x0023712f, 0x00226f35, 0x00216d41, 0x00206b4f, 0x001f6960, 0x001e6778, 0x001d6595,
+	0x001d63b9, 0x001c61e1, 0x001b600e, 0x001a5e40, 0x001a5c7b, 0x00195aba, 0x001858fd, 0x00175745,
+	0x000bfff2, 0x000bfff0, 0x000bffef, 0x000bffea, 0x000bffe3, 0x000bffda, 0x000bffcf, 0x000bffc3,
+	0x000bffb6, 0x000bffa6, 0x000bff94, 0x000bff81, 0x000cff6c, 0x000cff55, 0x000cff3b, 0x000cff16,
+	0x000cfeec, 0x000dfecd, 0x000dfea9, 0x000efe71, 0x000efe46, 0x000efe17, 0x000ffde3, 0x0010fdb4,
+	0x0010fd75, 0x0011fd42, 0x0012fd04, 0x0013fcbb, 0x0014fc6b, 0x0015fc19, 0x0016fbae, 0x0017fb30,
+	0x0018faba, 0x0019fa54, 0x001bf9d7, 0x001cf94a, 0x001df8c1, 0x001ef834, 0x0020f7a0, 0x0021f6fd,
+	0x0023f649, 0x0024f58e, 0x0026f4c9, 0x0027f3f4, 0x0029f324, 0x002bf240, 0x002cf140, 0x002df03d,
+	0x002fef3c, 0x0031ee41, 0x0032ed2c, 0x0033ebf5, 0x0035eac3, 0x0036e97d, 0x0037e82a, 0x0038e6d9,
+	0x003ae57c, 0x003be40a, 0x003ce289, 0x003de109, 0x003edf7d, 0x003edde3, 0x003fdc3b, 0x0040da89,
+	0x0040d8ce, 0x0041d70a, 0x0041d542, 0x0041d36a, 0x0042d185, 0x0042cf9b, 0x0042cdb3, 0x0042cbc0,
+	0x0042c9c8, 0x0042c7bd, 0x0041c5a7, 0x0041c39a, 0x0041c186, 0x0040bf67, 0x0040bd47, 0x003fbb23,
+	0x003fb8f8, 0x003eb6cb, 0x003eb493, 0x003db25e, 0x003cb02e, 0x003badfa, 0x003aabbb, 0x003aa97f,
+	0x0039a73e, 0x0038a4fd, 0x0037a2c4, 0x0036a085, 0x00359e46, 0x00349c08, 0x003399c9, 0x0032978d,
+	0x00319551, 0x00309316, 0x002f90df, 0x002e8ea8, 0x002d8c72, 0x002c8a41, 0x002b8817, 0x002a85ee,
+	0x002983c0, 0x00288199, 0x00277f7a, 0x00267d5b, 0x00257b44, 0x0024792e, 0x00237719, 0x0022750a,
+	0x00217300, 0x00217100, 0x00206f01, 0x001f6d06, 0x001e6b10, 0x001d6921, 0x001c6734, 0x001c654e,
+	0x001b636e, 0x001a6194, 0x00195fbc, 0x00195def, 0x00185c26, 0x00175a61, 0x001758a2, 0x001656e8,
+	0x0009fff3, 0x0009fff2, 0x0009fff1, 0x0009ffec, 0x0009ffe6, 0x0009ffde, 0x0009ffd4, 0x0009ffc8,
+	0x0009ffbb, 0x0009ffac, 0x0009ff9c, 0x0009ff8a, 0x0009ff76, 0x0009ff60, 0x000aff47, 0x000aff23,
+	0x000afefa, 0x000afedd, 0x000bfebb, 0x000bfe84, 0x000cfe5e, 0x000cfe30, 0x000cfe00, 0x000dfdd0,
+	0x000dfd95, 0x000efd62, 0x000ffd27, 0x0010fce2, 0x0010fc93, 0x0011fc43, 0x0012fbdb, 0x0013fb5c,
+	0x0014faf3, 0x0016fa89, 0x0017fa16, 0x0018f98c, 0x0019f905, 0x001af879, 0x001bf7e8, 0x001df745,
+	0x001ef699, 0x0020f5dd, 0x0021f51f, 0x0022f451, 0x0024f380, 0x0025f2a0, 0x0027f1a9, 0x0028f0a8,
+	0x0029efab, 0x002beeae, 0x002ceda0, 0x002eec73, 0x002feb3d, 0x0030e9f7, 0x0031e8a9, 0x0032e75e,
+	0x0033e5ff, 0x0034e48f, 0x0035e316, 0x0036e197, 0x0037e00f, 0x0038de71, 0x0039dccb, 0x0039db1b,
+	0x003ad960, 0x003ad79f, 0x003bd5d4, 0x003bd3fc, 0x003bd216, 0x003cd030, 0x003cce43, 0x003ccc54,
+	0x003cca59, 0x003cc844, 0x003cc62e, 0x003bc424, 0x003bc20e, 0x003bbfea, 0x003abdc4, 0x003abb9c,
+	0x003ab96f, 0x0039b73c, 0x0038b502, 0x0038b2cd, 0x0037b096, 0x0036ae5b, 0x0036ac17, 0x0035a9d7,
+	0x0034a791, 0x0033a54a, 0x0032a30b, 0x0032a0c9, 0x00319e82, 0x00309c3e, 0x002f99fc, 0x002e97b8,
+	0x002d9576, 0x002c9339, 0x002b90f9, 0x002a8ebc, 0x002a8c83, 0x00298a4c, 0x0028881e, 0x002785ec,
+	0x002683ba, 0x0025818d, 0x00247f6a, 0x00237d49, 0x00227b29, 0x0022790e, 0x002176f6, 0x002074e2,
+	0x001f72d5, 0x001e70d1, 0x001e6ecd, 0x001d6ccc, 0x001c6ad4, 0x001b68e1, 0x001b66f2, 0x001a6508,
+	0x00196324, 0x00186145, 0x00185f6e, 0x00175d9e, 0x00165bd1, 0x00165a09, 0x00155849, 0x0015568d,
+	0x0007fffb, 0x0007fff3, 0x0007fff3, 0x0007ffef, 0x0007ffe8, 0x0007ffe1, 0x0007ffd7, 0x0007ffcd,
+	0x0007ffc0, 0x0007ffb2, 0x0007ffa3, 0x0007ff91, 0x0007ff7e, 0x0007ff6a, 0x0008ff53, 0x0008ff33,
+	0x0008ff09, 0x0008feed, 0x0009fecd, 0x0009fe97, 0x0009fe74, 0x000afe48, 0x000afe1a, 0x000afdeb,
+	0x000bfdb5, 0x000cfd82, 0x000cfd48, 0x000dfd09, 0x000efcbc, 0x000ffc6b, 0x000ffc01, 0x0010fb8c,
+	0x0011fb28, 0x0012faba, 0x0013fa51, 0x0014f9ce, 0x0015f949, 0x0016f8be, 0x0018f830, 0x0019f78d,
+	0x001af6e4, 0x001bf634, 0x001df576, 0x001ef4ae, 0x001ff3d9, 0x0021f2fe, 0x0022f20e, 0x0023f111,
+	0x0024f019, 0x0025ef1b, 0x0027ee0f, 0x0028ecee, 0x0029ebb5, 0x002aea70, 0x002ce92c, 0x002de7df,
+	0x002ee683, 0x002fe516, 0x0030e3a2, 0x0030e225, 0x0031e09a, 0x0032df00, 0x0033dd5a, 0x0033dbab,
+	0x0034d9f6, 0x0034d830, 0x0035d666, 0x0035d48a, 0x0036d2a8, 0x0036d0c6, 0x0036ced4, 0x0036cce4,
+	0x0036cae5, 0x0036c8cb, 0x0036c6b9, 0x0036c4aa, 0x0036c296, 0x0036c06f, 0x0035be40, 0x0035bc16,
+	0x0035b9e7, 0x0034b7ac, 0x0034b573, 0x0033b33c, 0x0032b0fb, 0x0032aeb9, 0x0031ac77, 0x0031aa2d,
+	0x0030a7e3, 0x002fa599, 0x002ea352, 0x002ea10b, 0x002d9ec2, 0x002c9c75, 0x002b9a2f, 0x002b97e4,
+	0x002a959e, 0x0029935a, 0x00289114, 0x00278ed1, 0x00268c92, 0x00268a5c, 0x00258821, 0x002485eb,
+	0x002383b5, 0x00228183, 0x00227f5b, 0x00217d35, 0x00207b10, 0x001f78ee, 0x001e76d2, 0x001e74bc,
+	0x001d72ac, 0x001c70a1, 0x001b6e98, 0x001b6c95, 0x001a6a99, 0x001968a1, 0x001966b0, 0x001864c2,
+	0x001762d9, 0x001760f9, 0x00165f21, 0x00165d4c, 0x00155b7c, 0x001459b2, 0x001457ef, 0x00135634,
+	0x0005fffc, 0x0005fffb, 0x0005fff4, 0x0005fff1, 0x0005ffeb, 0x0005ffe4, 0x0005ffdb, 0x0005ffd1,
+	0x0005ffc5, 0x0005ffb8, 0x0006ffa9, 0x0006ff99, 0x0006ff87, 0x0006ff73, 0x0006ff5e, 0x0006ff43,
+	0x0006ff16, 0x0007fefc, 0x0007fede, 0x0007feaa, 0x0007fe89, 0x0008fe5e, 0x0008fe32, 0x0008fe05,
+	0x0009fdd5, 0x0009fda0, 0x000afd6c, 0x000bfd2f, 0x000bfce2, 0x000cfc93, 0x000dfc24, 0x000dfbba,
+	0x000efb5a, 0x000ffaeb, 0x0010fa89, 0x0011fa0c, 0x0012f988, 0x0013f904, 0x0014f875, 0x0015f7d7,
+	0x0016f72a, 0x0018f686, 0x0019f5cc, 0x001af508, 0x001bf430, 0x001cf359, 0x001df271, 0x001ff17b,
+	0x0020f083, 0x0021ef87, 0x0022ee7d, 0x0023ed65, 0x0024ec2a, 0x0025eae6, 0x0026e9ab, 0x0027e85b,
+	0x0028e700, 0x0029e59b, 0x002ae42a, 0x002be2ae, 0x002ce11f, 0x002ddf8d, 0x002ddde7, 0x002edc39,
+	0x002fda86, 0x002fd8c2, 0x0030d6f6, 0x0030d518, 0x0030d33a, 0x0031d156, 0x0031cf68, 0x0031cd72,
+	0x0031cb6a, 0x0031c955, 0x0031c744, 0x0031c531, 0x0031c31b, 0x0031c0f1, 0x0030bebc, 0x0030bc8e,
+	0x0030ba5c, 0x002fb822, 0x002fb5e6, 0x002fb3a7, 0x002eb161, 0x002eaf1a, 0x002dacd4, 0x002daa86,
+	0x002ca835, 0x002ba5e7, 0x002ba39b, 0x002aa150, 0x00299eff, 0x00299cae, 0x00289a5e, 0x00279812,
+	0x002695c7, 0x00269379, 0x00259131, 0x00248ee7, 0x00248ca7, 0x00238a67, 0x00228827, 0x002185eb,
+	0x002183af, 0x0020817b, 0x001f7f4d, 0x001e7d21, 0x001e7af7, 0x001d78d0, 0x001c76b0, 0x001c7499,
+	0x001b7282, 0x001a7070, 0x001a6e64, 0x00196c5f, 0x00186a5e, 0x00186863, 0x0017666e, 0x0016647c,
+	0x00166291, 0x001560af, 0x00155ed3, 0x00145cfb, 0x00145b28, 0x0013595c, 0x00125798, 0x001255d9,
+	0x0004fffc, 0x0004fffc, 0x0004fff5, 0x0004fff2, 0x0004ffed, 0x0004ffe6, 0x0004ffde, 0x0004ffd4,
+	0x0004ffc9, 0x0004ffbd, 0x0004ffaf, 0x0004ffa0, 0x0004ff8f, 0x0005ff7d, 0x0005ff68, 0x0005ff50,
+	0x0005ff23, 0x0005ff0b, 0x0006feee, 0x0006febb, 0x0006fe9d, 0x0006fe74, 0x0006fe49, 0x0007fe1d,
+	0x0007fdf2, 0x0008fdbc, 0x0008fd8d, 0x0009fd53, 0x0009fd09, 0x000afcb9, 0x000bfc4d, 0x000bfbe8,
+	0x000cfb89, 0x000dfb21, 0x000efabf, 0x000ffa47, 0x000ff9c8, 0x0010f947, 0x0011f8b4, 0x0012f81d,
+	0x0013f770, 0x0014f6d2, 0x0015f61e, 0x0016f55e, 0x0017f489, 0x0018f3b4, 0x001af2d1, 0x001bf1e4,
+	0x001cf0eb, 0x001defef, 0x001eeee8, 0x001fedda, 0x0020ec9f, 0x0021eb5a, 0x0022ea25, 0x0023e8db,
+	0x0024e77f, 0x0025e622, 0x0025e4b4, 0x0026e335, 0x0027e1a8, 0x0028e014, 0x0028de72, 0x0029dccc,
+	0x002adb12, 0x002ad952, 0x002bd77f, 0x002bd5a4, 0x002bd3cd, 0x002cd1e8, 0x002ccff9, 0x002ccdfb,
+	0x002ccbf0, 0x002cc9e4, 0x002cc7cc, 0x002cc5b9, 0x002cc39e, 0x002cc173, 0x002cbf3b, 0x002cbd04,
+	0x002bbad1, 0x002bb898, 0x002bb657, 0x002ab40f, 0x002ab1c6, 0x002aaf7e, 0x0029ad2f, 0x0029aade,
+	0x0028a887, 0x0028a635, 0x0027a3e6, 0x0026a193, 0x00269f3d, 0x00259ce7, 0x00259a90, 0x00249842,
+	0x002395ef, 0x0023939c, 0x0022914b, 0x00218f02, 0x00218cba, 0x00208a73, 0x001f882f, 0x001f85ec,
+	0x001e83ab, 0x001d8175, 0x001d7f40, 0x001c7d0d, 0x001b7add, 0x001b78b3, 0x001a7691, 0x001a7474,
+	0x00197257, 0x00187041, 0x00186e33, 0x00176c28, 0x00166a25, 0x00166826, 0x0015662a, 0x00156436,
+	0x0014624b, 0x00146065, 0x00135e85, 0x00135caa, 0x00125ad6, 0x00125908, 0x00115741, 0x0011557f,
+	0x0003fffe, 0x0003fffc, 0x0003fff9, 0x0003fff4, 0x0003ffef, 0x0003ffe8, 0x0003ffe1, 0x0003ffd8,
+	0x0003ffcd, 0x0003ffc2, 0x0003ffb5, 0x0003ffa6, 0x0003ff97, 0x0003ff85, 0x0004ff72, 0x0004ff5c,
+	0x0004ff30, 0x0004ff19, 0x0004fefe, 0x0004fed0, 0x0005feb0, 0x0005fe89, 0x0005fe61, 0x0005fe35,
+	0x0006fe0e, 0x0006fdd8, 0x0007fdad, 0x0007fd74, 0x0008fd2d, 0x0008fcdc, 0x0009fc72, 0x0009fc19,
+	0x000afbb8, 0x000bfb56, 0x000cfaf6, 0x000cfa81, 0x000dfa0a, 0x000ef986, 0x000ef8f0, 0x0010f861,
+	0x0010f7be, 0x0011f71b, 0x0012f671, 0x0013f5af, 0x0014f4dd, 0x0015f40e, 0x0016f32b, 0x0017f249,
+	0x0018f150, 0x0019f054, 0x001aef55, 0x001bee48, 0x001ced11, 0x001debd2, 0x001eea9a, 0x001fe954,
+	0x001fe7fc, 0x0020e6a4, 0x0021e53a, 0x0022e3b6, 0x0023e22e, 0x0023e09c, 0x0024deff, 0x0024dd59,
+	0x0025db9f, 0x0025d9dd, 0x0026d80c, 0x0026d634, 0x0027d45c, 0x0027d27a, 0x0027d085, 0x0027ce81,
+	0x0028cc7b, 0x0028ca6b, 0x0028c856, 0x0028c63f, 0x0028c41f, 0x0028c1f2, 0x0028bfb8, 0x0027bd7a,
+	0x0027bb49, 0x0027b90f, 0x0027b6c4, 0x0026b476, 0x0026b22f, 0x0026afe1, 0x0025ad8d, 0x0025ab35,
+	0x0025a8d9, 0x0024a685, 0x0024a431, 0x0023a1d8, 0x00239f7a, 0x00229d1d, 0x00229ac7, 0x0021986e,
+	0x00209617, 0x002093bf, 0x001f9169, 0x001f8f1c, 0x001e8ccc, 0x001d8a7f, 0x001d8836, 0x001c85ee,
+	0x001c83a8, 0x001b816c, 0x001b7f35, 0x001a7cf9, 0x00197ac5, 0x00197899, 0x00187673, 0x0018744e,
+	0x0017722d, 0x00167014, 0x00166e01, 0x00156bf3, 0x001569ec, 0x001467e8, 0x001465ea, 0x001363f3,
+	0x00136205, 0x0012601c, 0x00125e37, 0x00115c5a, 0x00115a84, 0x001058b4, 0x001056ea, 0x00105526,
+	0x0002fffe, 0x0002fffe, 0x0002fffa, 0x0002fff5, 0x0002fff1, 0x0002ffeb, 0x0002ffe3, 0x0002ffdb,
+	0x0002ffd1, 0x0002ffc6, 0x0002ffba, 0x0002ffad, 0x0003ff9e, 0x0003ff8e, 0x0003ff7c, 0x0003ff67,
+	0x0003ff3c, 0x0003ff26, 0x0003ff0d, 0x0003fee4, 0x0004fec3, 0x0004fe9d, 0x0004fe7b, 0x0004fe52,
+	0x0005fe28, 0x0005fdf8, 0x0005fdcb, 0x0006fd95, 0x0006fd50, 0x0007fcfc, 0x0007fc97, 0x0008fc44,
+	0x0008fbe3, 0x0009fb8a, 0x000afb2a, 0x000afab8, 0x000bfa48, 0x000cf9c4, 0x000cf932, 0x000df8a2,
+	0x000ef80a, 0x000ff765, 0x0010f6c1, 0x0011f5ff, 0x0011f537, 0x0012f467, 0x0013f385, 0x0014f2ac,
+	0x0015f1b5, 0x0016f0be, 0x0017efc0, 0x0018eeb1, 0x0018ed82, 0x0019ec4b, 0x001aeb0e, 0x001be9cb,
+	0x001ce87d, 0x001ce726, 0x001de5bd, 0x001ee438, 0x001ee2af, 0x001fe121, 0x0020df8d, 0x0020dde4,
+	0x0021dc2b, 0x0021da63, 0x0022d896, 0x0022d6c3, 0x0023d4ed, 0x0023d309, 0x0023d10d, 0x0023cf08,
+	0x0024cd06, 0x0024caf2, 0x0024c8de, 0x0024c6c5, 0x0024c4a0, 0x0024c26e, 0x0024c033, 0x0024bdf6,
+	0x0023bbc0, 0x0023b982, 0x0023b732, 0x0023b4e2, 0x0023b295, 0x0022b045, 0x0022adea, 0x0022ab8b,
+	0x0021a92e, 0x0021a6d8, 0x0020a47a, 0x0020a21d, 0x00209fb7, 0x001f9d58, 0x001f9afc, 0x001e989d,
+	0x001e9640, 0x001d93e2, 0x001d918a, 0x001c8f33, 0x001c8ce0, 0x001b8a8e, 0x001b883c, 0x001a85f0,
+	0x001983a9, 0x00198166, 0x00187f26, 0x00187ce7, 0x00177aaf, 0x0017787f, 0x00167653, 0x0016742a,
+	0x00157203, 0x00156fe7, 0x00146dd1, 0x00146bbf, 0x001369b1, 0x001367aa, 0x001265ab, 0x001263b2,
+	0x001161bf, 0x00115fd1, 0x00105dec, 0x00105c0c, 0x00105a33, 0x000f5860, 0x000f5695, 0x000e54ce,
+	0x0002ffff, 0x0002fffe, 0x0002fffb, 0x0002fff6, 0x0002fff2, 0x0002ffec, 0x0002ffe6, 0x0002ffde,
+	0x0002ffd5, 0x0002ffcb, 0x0002ffbf, 0x0002ffb3, 0x0002ffa5, 0x0002ff96, 0x0002ff85, 0x0002ff72,
+	0x0002ff47, 0x0002ff33, 0x0003ff1c, 0x0003fef6, 0x0003fed5, 0x0003feb4, 0x0003fe92, 0x0003fe6b,
+	0x0004fe42, 0x0004fe15, 0x0004fde8, 0x0005fdb5, 0x0005fd74, 0x0006fd1a, 0x0006fcbf, 0x0006fc6c,
+	0x0007fc0b, 0x0007fbbc, 0x0008fb5c, 0x0009faed, 0x0009fa83, 0x000af9ff, 0x000af974, 0x000bf8de,
+	0x000cf851, 0x000df7b0, 0x000df70c, 0x000ef651, 0x000ff58f, 0x0010f4bd, 0x0010f3e0, 0x0011f30b,
+	0x0012f216, 0x0013f125, 0x0014f028, 0x0014ef1a, 0x0015edf3, 0x0016ecbe, 0x0016eb7f, 0x0017ea44,
+	0x0018e8fb, 0x0019e7a2, 0x001ae63c, 0x001ae4b8, 0x001be332, 0x001be1a6, 0x001ce015, 0x001dde70,
+	0x001ddcb3, 0x001ddae9, 0x001ed921, 0x001ed751, 0x001fd57c, 0x001fd394, 0x001fd191, 0x001fcf94,
+	0x0020cd8f, 0x0020cb79, 0x0020c966, 0x0020c74c, 0x0020c520, 0x0020c2e9, 0x0020c0ae, 0x0020be75,
+	0x0020bc36, 0x0020b9f1, 0x0020b7a2, 0x001fb54e, 0x001fb2fa, 0x001fb0a7, 0x001fae47, 0x001eabe1,
+	0x001ea984, 0x001ea728, 0x001ea4c6, 0x001da25d, 0x001d9ff9, 0x001c9d93, 0x001c9b2f, 0x001c98cd,
+	0x001b9669, 0x001b9408, 0x001a91a8, 0x001a8f4c, 0x00198cf4, 0x00198a9c, 0x00188844, 0x001885f4,
+	0x001783aa, 0x0017815f, 0x00167f17, 0x00167cd6, 0x00157a9b, 0x00157865, 0x00147634, 0x00147405,
+	0x001471dc, 0x00136fba, 0x00136da2, 0x00126b8a, 0x00126978, 0x0011676d, 0x0011656e, 0x00106371,
+	0x00106177, 0x00105f89, 0x000f5da0, 0x000f5bbe, 0x000e59e2, 0x000e580d, 0x000e563e, 0x000d5478,
+	0x0001ffff, 0x0001fffe, 0x0001fffb, 0x0001fff7, 0x0001fff3, 0x0001ffee, 0x0001ffe8, 0x0001ffe1,
+	0x0001ffd8, 0x0001ffcf, 0x0001ffc4, 0x0001ffb9, 0x0001ffac, 0x0001ff9e, 0x0002ff8f, 0x0002ff7d,
+	0x0002ff53, 0x0002ff40, 0x0002ff2a, 0x0002ff06, 0x0002fee6, 0x0002feca, 0x0003fea8, 0x0003fe82,
+	0x0003fe5a, 0x0003fe30, 0x0003fe04, 0x0004fdd7, 0x0004fd95, 0x0005fd3f, 0x0005fce6, 0x0005fc92,
+	0x0006fc3c, 0x0006fbee, 0x0007fb90, 0x0007fb25, 0x0008fabb, 0x0008fa37, 0x0009f9b4, 0x0009f91e,
+	0x000af895, 0x000bf7fb, 0x000bf752, 0x000cf6a4, 0x000df5e3, 0x000df50e, 0x000ef43b, 0x000ff363,
+	0x000ff279, 0x0010f18a, 0x0011f08e, 0x0012ef7e, 0x0012ee5e, 0x0013ed33, 0x0014ebef, 0x0014eab7,
+	0x0015e978, 0x0016e81e, 0x0016e6b8, 0x0017e537, 0x0017e3b2, 0x0018e22d, 0x0019e09c, 0x0019def6,
+	0x001add37, 0x001adb70, 0x001ad9ab, 0x001bd7df, 0x001bd607, 0x001bd41a, 0x001cd21a, 0x001cd01e,
+	0x001cce16, 0x001ccc01, 0x001dc9ed, 0x001dc7cf, 0x001dc59e, 0x001dc364, 0x001dc12d, 0x001dbef2,
+	0x001dbcab, 0x001dba60, 0x001db810, 0x001cb5ba, 0x001cb362, 0x001cb107, 0x001caea4, 0x001bac3b,
+	0x001ba9d9, 0x001ba777, 0x001ba50f, 0x001aa2a1, 0x001aa03a, 0x001a9dce, 0x00199b63, 0x001998fd,
+	0x00199695, 0x0018942b, 0x001891c7, 0x00178f69, 0x00178d08, 0x00178aa8, 0x0016884f, 0x001685fb,
+	0x001583a8, 0x00158158, 0x00147f0c, 0x00147cc6, 0x00147a87, 0x0013784d, 0x00137614, 0x001273e1,
+	0x001271b5, 0x00126f92, 0x00116d71, 0x00116b56, 0x00106940, 0x00106735, 0x00106530, 0x000f632e,
+	0x000f6133, 0x000e5f41, 0x000e5d55, 0x000e5b71, 0x000d5992, 0x000d57b9, 0x000d55eb, 0x000c5422,
+	0x0001ffff, 0x0001ffff, 0x0001fffc, 0x0001fff8, 0x0001fff4, 0x0001fff0, 0x0001ffea, 0x0001ffe3,
+	0x0001ffdb, 0x0001ffd3, 0x0001ffc9, 0x0001ffbe, 0x0001ffb3, 0x0001ffa6, 0x0001ff97, 0x0001ff87,
+	0x0001ff63, 0x0001ff4d, 0x0001ff38, 0x0002ff16, 0x0002fef7, 0x0002fede, 0x0002febc, 0x0002fe98,
+	0x0002fe72, 0x0002fe49, 0x0003fe1f, 0x0003fdf5, 0x0003fdb3, 0x0004fd61, 0x0004fd10, 0x0004fcb8,
+	0x0005fc6d, 0x0005fc1d, 0x0005fbc1, 0x0006fb5a, 0x0006faf1, 0x0007fa75, 0x0007f9f0, 0x0008f95d,
+	0x0008f8d7, 0x0009f843, 0x000af796, 0x000af6f5, 0x000bf635, 0x000bf561, 0x000cf493, 0x000df3bb,
+	0x000df2dd, 0x000ef1ec, 0x000ef0f5, 0x000fefe3, 0x0010eec7, 0x0010eda3, 0x0011ec64, 0x0011eb2a,
+	0x0012e9f3, 0x0013e89a, 0x0013e72d, 0x0014e5b5, 0x0014e434, 0x0015e2b0, 0x0016e122, 0x0016df78,
+	0x0016ddbd, 0x0017dbf7, 0x0017da37, 0x0018d86b, 0x0018d68f, 0x0018d49c, 0x0019d2a6, 0x0019d0a4,
+	0x0019ce99, 0x0019cc89, 0x0019ca73, 0x0019c84f, 0x001ac61a, 0x001ac3e1, 0x001ac1ad, 0x001abf6b,
+	0x001abd20, 0x001abacf, 0x0019b87d, 0x0019b628, 0x0019b3c8, 0x0019b164, 0x0019af01, 0x0019ac9a,
+	0x0018aa2e, 0x0018a7c6, 0x0018a559, 0x0018a2e9, 0x0018a078, 0x00179e09, 0x00179b9a, 0x0017992e,
+	0x001696bf, 0x00169450, 0x001691e8, 0x00158f84, 0x00158d1c, 0x00158ab6, 0x0014885b, 0x00148600,
+	0x001383a7, 0x00138151, 0x00137f02, 0x00127cb8, 0x00127a74, 0x00127833, 0x001175f6, 0x001173bf,
+	0x00107190, 0x00106f67, 0x00106d41, 0x000f6b21, 0x000f690b, 0x000f66fd, 0x000e64f2, 0x000e62eb,
+	0x000e60f0, 0x000d5efb, 0x000d5d0b, 0x000d5b23, 0x000c5941, 0x000c5769, 0x000c5598, 0x000b53cc,
+	0x0001ffff, 0x0001ffff, 0x0001fffc, 0x0001fff9, 0x0001fff5, 0x0001fff1, 0x0001ffec, 0x0001ffe6,
+	0x0001ffdf, 0x0001ffd7, 0x0001ffce, 0x0001ffc4, 0x0001ffb9, 0x0001ffad, 0x0001ffa0, 0x0001ff90,
+	0x0001ff71, 0x0001ff59, 0x0001ff46, 0x0001ff25, 0x0001ff07, 0x0001fef1, 0x0001fed0, 0x0002feb0,
+	0x0002fe8b, 0x0002fe62, 0x0002fe3e, 0x0002fe12, 0x0003fdc8, 0x0003fd82, 0x0003fd38, 0x0003fcdc,
+	0x0004fc9b, 0x0004fc4a, 0x0004fbef, 0x0005fb8e, 0x0005fb23, 0x0006fab0, 0x0006fa2b, 0x0006f9a0,
+	0x0007f914, 0x0008f887, 0x0008f7de, 0x0009f740, 0x0009f687, 0x000af5b4, 0x000af4e8, 0x000bf417,
+	0x000bf33b, 0x000cf24e, 0x000cf157, 0x000df049, 0x000eef30, 0x000eee0b, 0x000fecdc, 0x000feb9c,
+	0x0010ea65, 0x0010e914, 0x0011e7a4, 0x0011e630, 0x0012e4b8, 0x0012e332, 0x0013e1a3, 0x0013dffa,
+	0x0014de41, 0x0014dc7d, 0x0014dac2, 0x0015d8f5, 0x0015d710, 0x0015d524, 0x0016d32f, 0x0016d12a,
+	0x0016cf1f, 0x0016cd11, 0x0016caf9, 0x0016c8cb, 0x0017c697, 0x0017c463, 0x0017c229, 0x0017bfe1,
+	0x0017bd95, 0x0017bb41, 0x0017b8ed, 0x0017b693, 0x0017b42e, 0x0016b1c6, 0x0016af60, 0x0016acf7,
+	0x0016aa83, 0x0016a811, 0x0016a5a5, 0x0015a330, 0x0015a0b6, 0x00159e43, 0x00159bd5, 0x0014995e,
+	0x001496e8, 0x00149476, 0x0014920b, 0x00138f9d, 0x00138d31, 0x00138ac9, 0x00128864, 0x00128605,
+	0x001283a7, 0x0011814c, 0x00117ef8, 0x00117cac, 0x00107a5f, 0x00107819, 0x001075d8, 0x000f739e,
+	0x000f716a, 0x000f6f3c, 0x000e6d12, 0x000e6aef, 0x000e68d7, 0x000d66c2, 0x000d64b4, 0x000d62ab,
+	0x000c60ac, 0x000c5eb5, 0x000c5cc2, 0x000c5ad5, 0x000b58f3, 0x000b5719, 0x000b5545, 0x000a5375,
+	0x0000ffff, 0x0000ffff, 0x0000fffd, 0x0000fffa, 0x0000fff6, 0x0000fff2, 0x0000ffee, 0x0000ffe8,
+	0x0000ffe2, 0x0000ffda, 0x0000ffd2, 0x0000ffc9, 0x0000ffbf, 0x0000ffb4, 0x0001ffa8, 0x0001ff9a,
+	0x0001ff7d, 0x0001ff65, 0x0001ff53, 0x0001ff34, 0x0001ff18, 0x0001ff03, 0x0001fee4, 0x0001fec9,
+	0x0001fea6, 0x0001fe7b, 0x0002fe5a, 0x0002fe2d, 0x0002fde7, 0x0002fda3, 0x0003fd5d, 0x0003fcfd,
+	0x0003fcc5, 0x0003fc7b, 0x0004fc1f, 0x0004fbc2, 0x0004fb52, 0x0005fae6, 0x0005fa6c, 0x0005f9dd,
+	0x0006f953, 0x0006f8c8, 0x0007f82e, 0x0007f78b, 0x0008f6d5, 0x0008f605, 0x0008f536, 0x0009f471,
+	0x0009f394, 0x000af2b2, 0x000bf1b7, 0x000bf0ab, 0x000bef95, 0x000cee7a, 0x000ded4f, 0x000dec0e,
+	0x000dead6, 0x000ee989, 0x000ee81f, 0x000fe6a9, 0x000fe538, 0x0010e3b4, 0x0010e220, 0x0011e07b,
+	0x0011dec1, 0x0011dd08, 0x0012db4a, 0x0012d978, 0x0012d793, 0x0013d5ac, 0x0013d3b5, 0x0013d1af,
+	0x0013cfa6, 0x0014cd9a, 0x0014cb78, 0x0014c947, 0x0014c718, 0x0014c4e4, 0x0014c2a2, 0x0014c059,
+	0x0014be07, 0x0014bbb5, 0x0014b95c, 0x0014b6fb, 0x0014b493, 0x0014b227, 0x0014afbf, 0x0014ad51,
+	0x0014aad8, 0x0013a862, 0x0013a5ef, 0x0013a377, 0x0013a0f5, 0x00139e80, 0x00139c0c, 0x00129990,
+	0x00129712, 0x0012949d, 0x0012922c, 0x00118fb8, 0x00118d47, 0x00118adb, 0x00118870, 0x0010860b,
+	0x001083a8, 0x00108147, 0x000f7ef0, 0x000f7c9d, 0x000f7a4d, 0x000e77ff, 0x000e75bc, 0x000e737f,
+	0x000e7146, 0x000d6f10, 0x000d6ce4, 0x000d6ac1, 0x000c68a0, 0x000c6689, 0x000c6476, 0x000c626c,
+	0x000b606a, 0x000b5e6e, 0x000b5c79, 0x000b5a8a, 0x000a58a5, 0x000a56c9, 0x000a54f1, 0x000a5322,
+	0x0000ffff, 0x0000ffff, 0x0000fffd, 0x0000fffa, 0x0000fff7, 0x0000fff4, 0x0000ffef, 0x0000ffea,
+	0x0000ffe4, 0x0000ffde, 0x0000ffd6, 0x0000ffce, 0x0000ffc5, 0x0000ffbb, 0x0000ffb0, 0x0000ffa3,
+	0x0001ff88, 0x0000ff70, 0x0001ff60, 0x0001ff43, 0x0001ff2c, 0x0001ff15, 0x0001fef7, 0x0001fedf,
+	0x0001febe, 0x0001fe94, 0x0001fe74, 0x0002fe45, 0x0002fe0a, 0x0002fdc5, 0x0002fd83, 0x0002fd26,
+	0x0002fcee, 0x0003fcaa, 0x0003fc4d, 0x0003fbf3, 0x0004fb86, 0x0004fb1b, 0x0004faab, 0x0004fa17,
+	0x0005f98f, 0x0005f905, 0x0006f87b, 0x0006f7d5, 0x0006f721, 0x0007f657, 0x0007f58b, 0x0008f4cb,
+	0x0008f3ed, 0x0009f30f, 0x0009f216, 0x0009f10d, 0x000aeff9, 0x000aeee7, 0x000bedbc, 0x000bec81,
+	0x000beb44, 0x000ce9fa, 0x000ce896, 0x000de726, 0x000de5b4, 0x000ee433, 0x000ee29d, 0x000ee0f9,
+	0x000fdf46, 0x000fdd8f, 0x000fdbd0, 0x0010d9f9, 0x0010d81b, 0x0010d631, 0x0010d43a, 0x0011d234,
+	0x0011d02d, 0x0011ce1a, 0x0011cbf6, 0x0011c9c9, 0x0011c798, 0x0012c560, 0x0012c31b, 0x0012c0ce,
+	0x0012be7c, 0x0012bc27, 0x0012b9ca, 0x0012b763, 0x0012b4f8, 0x0012b28c, 0x0012b01f, 0x0012ada7,
+	0x0011ab2f, 0x0011a8b2, 0x0011a63a, 0x0011a3bb, 0x0011a13a, 0x00119ebe, 0x00119c41, 0x001099c2,
+	0x00109740, 0x001094c3, 0x0010924e, 0x00108fd6, 0x000f8d5d, 0x000f8aeb, 0x000f887e, 0x000f8610,
+	0x000e83a8, 0x000e8146, 0x000e7ee8, 0x000e7c8f, 0x000d7a3a, 0x000d77e9, 0x000d759f, 0x000d735f,
+	0x000c7120, 0x000c6ee7, 0x000c6cb8, 0x000c6a90, 0x000b686d, 0x000b664f, 0x000b643a, 0x000b622f,
+	0x000a6028, 0x000a5e27, 0x000a5c30, 0x000a5a42, 0x0009585a, 0x00095677, 0x0009549f, 0x000952ce,
+	0x0000ffff, 0x0000ffff, 0x0000fffd, 0x0000fffb, 0x0000fff8, 0x0000fff5, 0x0000fff1, 0x0000ffed,
+	0x0000ffe7, 0x0000ffe1, 0x0000ffdb, 0x0000ffd3, 0x0000ffcb, 0x0000ffc2, 0x0000ffb8, 0x0000ffad,
+	0x0000ff92, 0x0000ff7b, 0x0000ff6d, 0x0000ff51, 0x0001ff3f, 0x0001ff26, 0x0001ff0d, 0x0001fef5,
+	0x0001fed5, 0x0001feae, 0x0001fe8d, 0x0001fe59, 0x0001fe28, 0x0002fde6, 0x0002fda7, 0x0002fd4f,
+	0x0002fd15, 0x0002fcd8, 0x0002fc78, 0x0003fc1f, 0x0003fbbb, 0x0003fb50, 0x0004fae7, 0x0004fa54,
+	0x0004f9ca, 0x0004f947, 0x0005f8c5, 0x0005f81f, 0x0005f768, 0x0006f6a5, 0x0006f5dc, 0x0006f520,
+	0x0007f44b, 0x0007f367, 0x0008f275, 0x0008f16b, 0x0008f062, 0x0009ef4c, 0x0009ee29, 0x0009ecf4,
+	0x000aebb0, 0x000aea6a, 0x000be90f, 0x000be7a0, 0x000be62e, 0x000ce4ad, 0x000ce31c, 0x000ce174,
+	0x000ddfcc, 0x000dde12, 0x000ddc50, 0x000dda80, 0x000ed89e, 0x000ed6b2, 0x000ed4bc, 0x000ed2bd,
+	0x000fd0b3, 0x000fce98, 0x000fcc73, 0x000fca4b, 0x000fc819, 0x000fc5dc, 0x000fc393, 0x000fc143,
+	0x0010bef2, 0x0010bc99, 0x0010ba36, 0x0010b7cd, 0x0010b55e, 0x0010b2f0, 0x0010b07b, 0x000fae01,
+	0x000fab85, 0x000fa905, 0x000fa683, 0x000fa401, 0x000fa17f, 0x000f9efb, 0x000f9c77, 0x000f99f5,
+	0x000e976e, 0x000e94e9, 0x000e9270, 0x000e8ff3, 0x000e8d74, 0x000d8afd, 0x000d888c, 0x000d8619,
+	0x000d83aa, 0x000d8142, 0x000c7ee1, 0x000c7c82, 0x000c7a26, 0x000c77d4, 0x000c7587, 0x000b733d,
+	0x000b70fb, 0x000b6ebf, 0x000b6c8d, 0x000a6a60, 0x000a6838, 0x000a6617, 0x000a6400, 0x000a61f0,
+	0x00095fe5, 0x00095de2, 0x00095be9, 0x000959f8, 0x0008580d, 0x00085628, 0x0008544d, 0x0008527c,
+	0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffb, 0x0000fff9, 0x0000fff6, 0x0000fff3, 0x0000ffef,
+	0x0000ffea, 0x0000ffe5, 0x0000ffdf, 0x0000ffd8, 0x0000ffd1, 0x0000ffc9, 0x0000ffc0, 0x0000ffb5,
+	0x0000ff9c, 0x0000ff86, 0x0000ff79, 0x0000ff5f, 0x0000ff4f, 0x0000ff36, 0x0001ff23, 0x0001ff09,
+	0x0001feeb, 0x0001fec8, 0x0001fea4, 0x0001fe72, 0x0001fe42, 0x0001fe05, 0x0001fdc9, 0x0001fd76,
+	0x0002fd3b, 0x0002fd03, 0x0002fca6, 0x0002fc4a, 0x0002fbed, 0x0003fb87, 0x0003fb1e, 0x0003fa91,
+	0x0003f9ff, 0x0004f989, 0x0004f90a, 0x0004f86b, 0x0004f7ad, 0x0005f6ef, 0x0005f633, 0x0005f574,
+	0x0006f4a5, 0x0006f3c1, 0x0006f2d2, 0x0007f1c9, 0x0007f0ca, 0x0007efb6, 0x0008ee91, 0x0008ed5f,
+	0x0008ec21, 0x0009ead6, 0x0009e984, 0x0009e81b, 0x000ae6a6, 0x000ae523, 0x000ae398, 0x000ae1f7,
+	0x000be04c, 0x000bde92, 0x000bdccd, 0x000cdb04, 0x000cd920, 0x000cd734, 0x000cd540, 0x000cd345,
+	0x000dd131, 0x000dcf16, 0x000dccf4, 0x000dcace, 0x000dc895, 0x000dc657, 0x000dc408, 0x000dc1bd,
+	0x000ebf68, 0x000ebd0a, 0x000ebaa1, 0x000eb836, 0x000eb5ca, 0x000eb350, 0x000eb0d9, 0x000eae5b,
+	0x000eabdb, 0x000da955, 0x000da6cf, 0x000da449, 0x000da1c3, 0x000d9f38, 0x000d9cae, 0x000d9a26,
+	0x000d979c, 0x000d9514, 0x000c9292, 0x000c900f, 0x000c8d8e, 0x000c8b0e, 0x000c8897, 0x000c8624,
+	0x000b83ab, 0x000b813f, 0x000b7edb, 0x000b7c75, 0x000b7a15, 0x000b77be, 0x000a756d, 0x000a731e,
+	0x000a70d5, 0x000a6e9a, 0x000a6c62, 0x00096a2f, 0x00096803, 0x000965e2, 0x000963c6, 0x000961b0,
+	0x00085fa3, 0x00085da0, 0x00085ba3, 0x000859ae, 0x000857c0, 0x000755da, 0x000753fe, 0x00075228,
+	0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffc, 0x0000fffa, 0x0000fff7, 0x0000fff4, 0x0000fff1,
+	0x0000ffed, 0x0000ffe8, 0x0000ffe3, 0x0000ffdd, 0x0000ffd7, 0x0000ffd0, 0x0000ffc8, 0x0000ffbe,
+	0x0000ffa6, 0x0000ff99, 0x0000ff85, 0x0000ff6d, 0x0000ff5f, 0x0000ff47, 0x0000ff36, 0x0000ff1c,
+	0x0001ff06, 0x0001fee4, 0x0001feba, 0x0001fe8e, 0x0001fe59, 0x0001fe26, 0x0001fde2, 0x0001fd9e,
+	0x0001fd63, 0x0001fd2a, 0x0002fcd2, 0x0002fc7b, 0x0002fc1a, 0x0002fbbd, 0x0002fb55, 0x0003faca,
+	0x0003fa3a, 0x0003f9cc, 0x0003f94b, 0x0003f8b4, 0x0004f7f0, 0x0004f73a, 0x0004f687, 0x0004f5c7,
+	0x0005f4fa, 0x0005f416, 0x0005f327, 0x0006f22e, 0x0006f12d, 0x0006f01c, 0x0006eef7, 0x0007edcc,
+	0x0007ec8f, 0x0007eb46, 0x0007e9f9, 0x0008e891, 0x0008e71c, 0x0008e59a, 0x0009e411, 0x0009e27b,
+	0x0009e0c6, 0x0009df11, 0x000add53, 0x000adb86, 0x000ad9a1, 0x000ad7b3, 0x000ad5c6, 0x000bd3c5,
+	0x000bd1b1, 0x000bcf96, 0x000bcd75, 0x000bcb4c, 0x000bc915, 0x000bc6cd, 0x000cc481, 0x000cc234,
+	0x000cbfdc, 0x000cbd79, 0x000cbb0d, 0x000cb8a3, 0x000cb62e, 0x000cb3b3, 0x000cb138, 0x000caeb7,
+	0x000cac2e, 0x000ca9a6, 0x000ca71d, 0x000ca492, 0x000ca203, 0x000c9f76, 0x000b9ce6, 0x000b9a56,
+	0x000b97cc, 0x000b953e, 0x000b92b3, 0x000b902d, 0x000b8da5, 0x000b8b22, 0x000a88a6, 0x000a862b,
+	0x000a83b0, 0x000a813d, 0x000a7ed2, 0x000a7c6b, 0x000a7a04, 0x000977a7, 0x00097553, 0x00097301,
+	0x000970b3, 0x00096e72, 0x00096c38, 0x000869ff, 0x000867d0, 0x000865ac, 0x0008638d, 0x00086172,
+	0x00085f62, 0x00075d5d, 0x00075b5e, 0x00075963, 0x00075774, 0x0007558e, 0x000753af, 0x000651d4,
+	0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffc, 0x0000fffb, 0x0000fff8, 0x0000fff6, 0x0000fff3,
+	0x0000ffef, 0x0000ffeb, 0x0000ffe7, 0x0000ffe2, 0x0000ffdc, 0x0000ffd6, 0x0000ffcf, 0x0000ffc7,
+	0x0000ffb0, 0x0000ffa6, 0x0000ff91, 0x0000ff7a, 0x0000ff6e, 0x0000ff57, 0x0000ff49, 0x0000ff2f,
+	0x0000ff1c, 0x0000fefc, 0x0000feca, 0x0001fea8, 0x0001fe76, 0x0001fe49, 0x0001fe04, 0x0001fdcb,
+	0x0001fd8d, 0x0001fd4e, 0x0001fcfc, 0x0001fca9, 0x0002fc4f, 0x0002fbf1, 0x0002fb8a, 0x0002fafc,
+	0x0002fa7e, 0x0002fa0c, 0x0003f98b, 0x0003f8f7, 0x0003f83c, 0x0003f784, 0x0003f6d4, 0x0004f619,
+	0x0004f550, 0x0004f46e, 0x0004f37d, 0x0005f28e, 0x0005f18f, 0x0005f07f, 0x0005ef5d, 0x0005ee32,
+	0x0006ecf9, 0x0006ebbc, 0x0006ea67, 0x0006e905, 0x0007e795, 0x0007e60e, 0x0007e48f, 0x0007e2f9,
+	0x0008e13f, 0x0008df8e, 0x0008ddd6, 0x0008dc01, 0x0008da22, 0x0009d83a, 0x0009d647, 0x0009d445,
+	0x0009d22f, 0x0009d017, 0x0009cdf6, 0x000acbcc, 0x000ac98b, 0x000ac74a, 0x000ac4fa, 0x000ac2ac,
+	0x000ac04c, 0x000abde7, 0x000abb7e, 0x000ab90c, 0x000ab692, 0x000ab416, 0x000ab197, 0x000aaf0d,
+	0x000aac84, 0x000aa9f8, 0x000aa76b, 0x000aa4d8, 0x000aa247, 0x000a9fb3, 0x000a9d1d, 0x000a9a8d,
+	0x000a97f9, 0x000a9566, 0x000a92d8, 0x000a904a, 0x00098dbe, 0x00098b38, 0x000988b4, 0x00098633,
+	0x000983b5, 0x0009813d, 0x00097ecc, 0x00097c5f, 0x000879f5, 0x00087793, 0x00087539, 0x000872e4,
+	0x00087091, 0x00086e4b, 0x00086c0c, 0x000769d1, 0x0007679e, 0x00076575, 0x00076353, 0x00076136,
+	0x00075f22, 0x00075d1a, 0x00065b18, 0x0006591b, 0x00065729, 0x00065541, 0x0006535f, 0x00065184,
+	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000fffd, 0x0000fffb, 0x0000fff9, 0x0000fff7, 0x0000fff5,
+	0x0000fff2, 0x0000ffee, 0x0000ffeb, 0x0000ffe6, 0x0000ffe2, 0x0000ffdd, 0x0000ffd7, 0x0000ffcf,
+	0x0000ffba, 0x0000ffb1, 0x0000ff9d, 0x0000ff87, 0x0000ff7d, 0x0000ff68, 0x0000ff5a, 0x0000ff42,
+	0x0000ff31, 0x0000ff11, 0x0000feda, 0x0000febf, 0x0001fe97, 0x0001fe68, 0x0001fe26, 0x0001fdf6,
+	0x0001fdb3, 0x0001fd72, 0x0001fd24, 0x0001fcd8, 0x0001fc82, 0x0001fc28, 0x0002fbb7, 0x0002fb2e,
+	0x0002fac1, 0x0002fa49, 0x0002f9ce, 0x0002f936, 0x0002f884, 0x0003f7ce, 0x0003f721, 0x0003f66e,
+	0x0003f5a1, 0x0003f4bf, 0x0003f3d9, 0x0004f2eb, 0x0004f1f2, 0x0004f0e1, 0x0004efc0, 0x0004ee99,
+	0x0005ed66, 0x0005ec2d, 0x0005ead6, 0x0005e975, 0x0006e80a, 0x0006e688, 0x0006e507, 0x0006e36f,
+	0x0006e1c1, 0x0006e00a, 0x0007de53, 0x0007dc82, 0x0007daa0, 0x0007d8bd, 0x0007d6c6, 0x0008d4c2,
+	0x0008d2af, 0x0008d096, 0x0008ce79, 0x0008cc41, 0x0008ca09, 0x0008c7c2, 0x0008c576, 0x0008c31f,
+	0x0008c0bc, 0x0009be5a, 0x0009bbec, 0x0009b973, 0x0009b6f7, 0x0009b47c, 0x0009b1f3, 0x0009af66,
+	0x0009acdc, 0x0009aa4b, 0x0009a7b7, 0x0009a521, 0x0009a28a, 0x00099ff0, 0x00099d58, 0x00099ac1,
+	0x00089828, 0x00089591, 0x000892fb, 0x00089069, 0x00088dda, 0x00088b4b, 0x000888c2, 0x0008863b,
+	0x000883ba, 0x0008813e, 0x00087ec5, 0x00077c54, 0x000779e6, 0x00077780, 0x0007751f, 0x000772c5,
+	0x00077071, 0x00076e25, 0x00076be2, 0x000769a3, 0x0006676d, 0x00066540, 0x0006631a, 0x000660fa,
+	0x00065ee4, 0x00065cd8, 0x00065ad2, 0x000658d4, 0x000556df, 0x000554f3, 0x00055310, 0x00055133,
+	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffc, 0x0000fffa, 0x0000fff9, 0x0000fff6,
+	0x0000fff4, 0x0000fff1, 0x0000ffee, 0x0000ffeb, 0x0000ffe7, 0x0000ffe3, 0x0000ffde, 0x0000ffd8,
+	0x0000ffc3, 0x0000ffbc, 0x0000ffa8, 0x0000ff94, 0x0000ff8b, 0x0000ff7e, 0x0000ff6b, 0x0000ff5a,
+	0x0000ff45, 0x0000ff2a, 0x0000fef7, 0x0000fed1, 0x0000feb4, 0x0000fe81, 0x0001fe49, 0x0001fe1c,
+	0x0001fddc, 0x0001fd92, 0x0001fd4b, 0x0001fd07, 0x0001fcb4, 0x0001fc59, 0x0001fbe0, 0x0001fb6e,
+	0x0001fafe, 0x0002fa8b, 0x0002fa09, 0x0002f973, 0x0002f8c7, 0x0002f820, 0x0002f76b, 0x0002f6b9,
+	0x0003f5f5, 0x0003f514, 0x0003f431, 0x0003f346, 0x0003f24e, 0x0003f144, 0x0003f022, 0x0004eeff,
+	0x0004edd1, 0x0004ec9a, 0x0004eb42, 0x0004e9e4, 0x0005e87c, 0x0005e702, 0x0005e57c, 0x0005e3e3,
+	0x0005e23f, 0x0005e088, 0x0005deca, 0x0006dd02, 0x0006db21, 0x0006d937, 0x0006d74a, 0x0006d53f,
+	0x0006d32e, 0x0006d11a, 0x0007cef2, 0x0007ccc0, 0x0007ca80, 0x0007c83f, 0x0007c5ec, 0x0007c391,
+	0x0007c131, 0x0007beca, 0x0007bc57, 0x0007b9dd, 0x0007b760, 0x0007b4dd, 0x0007b251, 0x0007afc4,
+	0x0007ad30, 0x0007aa9a, 0x0007a806, 0x0007a56a, 0x0007a2cb, 0x0007a031, 0x00079d92, 0x00079af5,
+	0x00079857, 0x000795ba, 0x00079321, 0x00079089, 0x00078df3, 0x00078b61, 0x000788cf, 0x00078648,
+	0x000783c0, 0x0007813d, 0x00077ec1, 0x00067c49, 0x000679d9, 0x0006776c, 0x00067507, 0x000672a8,
+	0x00067050, 0x00066e01, 0x00066bb8, 0x00066976, 0x0006673c, 0x0006650c, 0x000562e1, 0x000560bf,
+	0x00055ea6, 0x00055c96, 0x00055a8d, 0x0005588d, 0x00055696, 0x000554a8, 0x000552c1, 0x000550e4,
+	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffd, 0x0000fffc, 0x0000fffa, 0x0000fff8,
+	0x0000fff6, 0x0000fff4, 0x0000fff2, 0x0000ffef, 0x0000ffec, 0x0000ffe9, 0x0000ffe5, 0x0000ffe0,
+	0x0000ffcd, 0x0000ffc7, 0x0000ffbc, 0x0000ffa0, 0x0000ff99, 0x0000ff8f, 0x0000ff7c, 0x0000ff6f,
+	0x0000ff58, 0x0000ff36, 0x0000ff0f, 0x0000fee6, 0x0000fecf, 0x0000fe9e, 0x0000fe6c, 0x0000fe40,
+	0x0001fe09, 0x0001fdac, 0x0001fd6e, 0x0001fd38, 0x0001fced, 0x0001fc85, 0x0001fc0b, 0x0001fbaa,
+	0x0001fb3c, 0x0001fac7, 0x0001fa44, 0x0001f9ad, 0x0002f910, 0x0002f86d, 0x0002f7b5, 0x0002f706,
+	0x0002f642, 0x0002f56c, 0x0002f486, 0x0002f3a3, 0x0003f2ad, 0x0003f1a0, 0x0003f084, 0x0003ef69,
+	0x0003ee3d, 0x0003ecfe, 0x0003ebb1, 0x0003ea54, 0x0004e8ef, 0x0004e775, 0x0004e5f0, 0x0004e45e,
+	0x0004e2b6, 0x0004e104, 0x0004df47, 0x0005dd7d, 0x0005dba0, 0x0005d9b7, 0x0005d7c3, 0x0005d5c0,
+	0x0005d3ac, 0x0005d195, 0x0005cf70, 0x0005cd38, 0x0006cafe, 0x0006c8b6, 0x0006c662, 0x0006c405,
+	0x0006c1a7, 0x0006bf36, 0x0006bcc4, 0x0006ba48, 0x0006b7c7, 0x0006b53b, 0x0006b2b2, 0x0006b01f,
+	0x0006ad85, 0x0006aaef, 0x0006a851, 0x0006a5b2, 0x0006a311, 0x0006a06d, 0x00069dcd, 0x00069b2a,
+	0x00069885, 0x000695e5, 0x00069346, 0x000690a9, 0x00068e0e, 0x00068b75, 0x000688e2, 0x00068651,
+	0x000683c5, 0x0006813e, 0x00067ebc, 0x00067c40, 0x000579ca, 0x00057759, 0x000574ee, 0x0005728d,
+	0x00057030, 0x00056ddc, 0x00056b8e, 0x0005694a, 0x0005670d, 0x000564d6, 0x000562a9, 0x00056085,
+	0x00055e68, 0x00045c55, 0x00045a48, 0x00045847, 0x0004564d, 0x0004545b, 0x00045274, 0x00045094,
+	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffd, 0x0000fffc, 0x0000fffa,
+	0x0000fff9, 0x0000fff7, 0x0000fff6, 0x0000fff4, 0x0000fff2, 0x0000ffef, 0x0000ffec, 0x0000ffe8,
+	0x0000ffd6, 0x0000ffd1, 0x0000ffca, 0x0000ffac, 0x0000ffa7, 0x0000ff9f, 0x0000ff8c, 0x0000ff81,
+	0x0000ff68, 0x0000ff4d, 0x0000ff2c, 0x0000ff03, 0x0000fee6, 0x0000febb, 0x0000fe8c, 0x0000fe62,
+	0x0000fe29, 0x0000fdd6, 0x0000fd98, 0x0001fd62, 0x0001fd1c, 0x0001fca7, 0x0001fc42, 0x0001fbe2,
+	0x0001fb7b, 0x0001fafc, 0x0001fa84, 0x0001f9e8, 0x0001f95c, 0x0001f8b3, 0x0001f802, 0x0001f74c,
+	0x0002f694, 0x0002f5be, 0x0002f4e0, 0x0002f3f9, 0x0002f309, 0x0002f1fd, 0x0002f0e4, 0x0002efcf,
+	0x0002eea5, 0x0003ed66, 0x0003ec1c, 0x0003eac9, 0x0003e95c, 0x0003e7e8, 0x0003e668, 0x0003e4d2,
+	0x0003e32f, 0x0003e17e, 0x0004dfc4, 0x0004ddf6, 0x0004dc1d, 0x0004da34, 0x0004d83e, 0x0004d640,
+	0x0004d42b, 0x0004d211, 0x0004cfeb, 0x0004cdb5, 0x0004cb76, 0x0005c930, 0x0005c6d4, 0x0005c47f,
+	0x0005c215, 0x0005bfa6, 0x0005bd30, 0x0005bab2, 0x0005b829, 0x0005b5a2, 0x0005b30f, 0x0005b078,
+	0x0005adde, 0x0005ab40, 0x0005a89e, 0x0005a5fb, 0x0005a354, 0x0005a0af, 0x00059e06, 0x00059b5e,
+	0x000598b8, 0x0005960f, 0x0005936c, 0x000590c9, 0x00058e29, 0x00058b8b, 0x000588f3, 0x0005865d,
+	0x000583cb, 0x0005813f, 0x00057eb8, 0x00057c38, 0x000579bb, 0x00057747, 0x000574d9, 0x00047271,
+	0x00047010, 0x00046db8, 0x00046b67, 0x0004691d, 0x000466dc, 0x000464a3, 0x00046273, 0x0004604a,
+	0x00045e2a, 0x00045c14, 0x00045a06, 0x00045800, 0x00045604, 0x00045411, 0x00035227, 0x00035045,
+	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffe, 0x0000fffd, 0x0000fffc,
+	0x0000fffb, 0x0000fffa, 0x0000fff9, 0x0000fff8, 0x0000fff7, 0x0000fff5, 0x0000fff3, 0x0000fff0,
+	0x0000ffdf, 0x0000ffdc, 0x0000ffd6, 0x0000ffb9, 0x0000ffb4, 0x0000ffaf, 0x0000ffa2, 0x0000ff92,
+	0x0000ff74, 0x0000ff61, 0x0000ff42, 0x0000ff1e, 0x0000fef6, 0x0000fed6, 0x0000feb4, 0x0000fe85,
+	0x0000fe45, 0x0000fdfd, 0x0000fdbe, 0x0000fd8f, 0x0000fd3f, 0x0001fcdc, 0x0001fc75, 0x0001fc16,
+	0x0001fbb2, 0x0001fb3c, 0x0001faae, 0x0001fa32, 0x0001f99c, 0x0001f8f6, 0x0001f848, 0x0001f79d,
+	0x0001f6e1, 0x0001f60b, 0x0001f539, 0x0001f44c, 0x0001f362, 0x0002f25d, 0x0002f144, 0x0002f033,
+	0x0002ef0a, 0x0002edcc, 0x0002ec8c, 0x0002eb33, 0x0002e9c9, 0x0002e85c, 0x0002e6da, 0x0002e546,
+	0x0003e3a9, 0x0003e1f7, 0x0003e03b, 0x0003de74, 0x0003dc97, 0x0003dab0, 0x0003d8bd, 0x0003d6b9,
+	0x0003d4a9, 0x0003d28d, 0x0003d065, 0x0003ce31, 0x0004cbef, 0x0004c9a6, 0x0004c74e, 0x0004c4f0,
+	0x0004c288, 0x0004c015, 0x0004bd9d, 0x0004bb19, 0x0004b892, 0x0004b604, 0x0004b36c, 0x0004b0d6,
+	0x0004ae32, 0x0004ab93, 0x0004a8ec, 0x0004a644, 0x0004a39a, 0x0004a0ec, 0x00049e42, 0x00049b93,
+	0x000498e7, 0x0004963c, 0x00049392, 0x000490ea, 0x00048e45, 0x00048ba2, 0x00048903, 0x00048669,
+	0x000483d2, 0x00048141, 0x00047eb4, 0x00047c2f, 0x000479ae, 0x00047736, 0x000474c2, 0x00047256,
+	0x00046ff1, 0x00046d94, 0x00046b3f, 0x000468f2, 0x000466ac, 0x00036470, 0x0003623c, 0x00036010,
+	0x00035ded, 0x00035bd4, 0x000359c4, 0x000357bb, 0x000355bd, 0x000353c7, 0x000351db, 0x00034ff7,
+	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000fffe,
+	0x0000fffe, 0x0000fffe, 0x0000fffd, 0x0000fffd, 0x0000fffc, 0x0000fffb, 0x0000fffa, 0x0000fff8,
+	0x0000ffe8, 0x0000ffe6, 0x0000ffe2, 0x0000ffd1, 0x0000ffc1, 0x0000ffbd, 0x0000ffb6, 0x0000ff9c,
+	0x0000ff8b, 0x0000ff73, 0x0000ff5b, 0x0000ff3b, 0x0000ff16, 0x0000fef2, 0x0000fed5, 0x0000fea3,
+	0x0000fe5f, 0x0000fe2b, 0x0000fdf6, 0x0000fda9, 0x0000fd63, 0x0000fd0e, 0x0000fcaa, 0x0000fc49,
+	0x0000fbed, 0x0001fb6b, 0x0001faf3, 0x0001fa6c, 0x0001f9e4, 0x0001f934, 0x0001f899, 0x0001f7eb,
+	0x0001f728, 0x0001f663, 0x0001f586, 0x0001f4a7, 0x0001f3ba, 0x0001f2b9, 0x0001f1a9, 0x0001f093,
+	0x0001ef6c, 0x0001ee37, 0x0001ecf2, 0x0002eba0, 0x0002ea39, 0x0002e8cd, 0x0002e74a, 0x0002e5bc,
+	0x0002e41d, 0x0002e26f, 0x0002e0b6, 0x0002deeb, 0x0002dd13, 0x0002db2b, 0x0002d937, 0x0002d736,
+	0x0002d523, 0x0003d309, 0x0003d0df, 0x0003ceaa, 0x0003cc68, 0x0003ca1c, 0x0003c7c4, 0x0003c563,
+	0x0003c2f9, 0x0003c083, 0x0003be08, 0x0003bb83, 0x0003b8f7, 0x0003b665, 0x0003b3cc, 0x0003b12f,
+	0x0003ae8b, 0x0003abe5, 0x0003a93a, 0x0003a68d, 0x0003a3df, 0x0003a12e, 0x00039e7c, 0x00039bca,
+	0x00039918, 0x00039667, 0x000393b8, 0x0003910b, 0x00038e60, 0x00038bb8, 0x00038915, 0x00038675,
+	0x000383da, 0x00038143, 0x00037eb3, 0x00037c28, 0x000379a2, 0x00037724, 0x000374ac, 0x0003723c,
+	0x00036fd2, 0x00036d72, 0x00036b18, 0x000368c8, 0x0003667d, 0x0003643f, 0x00036206, 0x00035fd8,
+	0x00035db1, 0x00035b95, 0x00035981, 0x00035777, 0x00035575, 0x0003537d, 0x0002518f, 0x00024faa,
+};
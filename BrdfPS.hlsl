@@ -1,4 +1,4 @@
-#include "CommonVars.hlsl"
+#include "CommonVars.hlsli"
 
 struct PSInput
 {
@@ -9,6 +9,8 @@ struct PSInput
 TextureCube Cubemap : register(t0);
 
 // http://blog.selfshadow.com/publications/s2013-shading-course/karis/s2013_pbs_epic_notes_v2.pdf 
+// The game uses a copy baked offline (BrdfLut.cpp mirrors this
+// function - keep the two in step, then rerun BakeBrdfLut)
 float2 IntegrateBRDF(float Roughness, float NoV)
 {
 	float3 V;
@@ -11,6 +11,12 @@ Camera::Camera()
 	//
 	rotAroundX = 0;
 	rotAroundY = 0;
+	inputEnabled = true;
+
+	fieldOfView = 0.25f * 3.1415926535f;
+	aspectRatio = 1;
+	nearClip = 0.1f;
+	farClip = 100.0f;
 }
 
 //load/store camPos, camDir, and both matrices
@@ -34,6 +40,9 @@ void Camera::Update()
 	XMFLOAT3 crossProduct;
 	XMStoreFloat3(&crossProduct, cross);
 
+	if (!inputEnabled)
+		return;
+
 	//keyboard movement code is going here
 	if (GetAsyncKeyState(VK_UP)) //up
 	{
@@ -79,16 +88,22 @@ XMFLOAT4X4 Camera::GetMatrixV()
 	return camViewMatrix;
 }
 
+XMFLOAT3 Camera::GetPosition()
+{
+	return camPos;
+}
+
 void Camera::UpdateProjectionMatrix(unsigned int w, unsigned int h)
 {
 	// Create the Projection matrix
 	// - This should match the window's aspect ratio, and also update anytime
 	//   the window resizes (which is already happening in OnResize() below)
+	aspectRatio = (float)w / h;
 	XMMATRIX P = XMMatrixPerspectiveFovLH(
-		0.25f * 3.1415926535f,		// Field of View Angle
-		(float)w / h,		// Aspect ratio
-		0.1f,						// Near clip plane distance
-		100.0f);					// Far clip plane distance
+		fieldOfView,		// Field of View Angle
+		aspectRatio,		// Aspect ratio
+		nearClip,			// Near clip plane distance
+		farClip);			// Far clip plane distance
 	XMStoreFloat4x4(&camProjMatrix, XMMatrixTranspose(P)); // Transpose for HLSL!
 }
 
@@ -102,6 +117,13 @@ void Camera::UpdateYRotation()
 	rotAroundY += 0.01f;
 }
 
+void Camera::SetPose(XMFLOAT3 position, float pitch, float yaw)
+{
+	camPos = position;
+	rotAroundX = pitch;
+	rotAroundY = yaw;
+}
+
 Camera::~Camera()
 {
 }
@@ -12,12 +12,28 @@ public:
 
 	DirectX::XMFLOAT4X4 GetMatrixP();
 	DirectX::XMFLOAT4X4 GetMatrixV();
+	DirectX::XMFLOAT3 GetPosition();
+
+	// Projection parameters (for fitting shadow cascades)
+	float GetFieldOfView() { return fieldOfView; }
+	float GetAspectRatio() { return aspectRatio; }
+	float GetNearClip() { return nearClip; }
+	float GetFarClip() { return farClip; }
 
 	void UpdateProjectionMatrix(unsigned int w, unsigned int h);
 
 	void UpdateXRotation();
 	void UpdateYRotation();
 
+	// Puts the camera somewhere (e.g. on a CameraPath); pitch
+	// and yaw are its rotations around X and Y
+	void SetPose(DirectX::XMFLOAT3 position, float pitch, float yaw);
+	float GetPitch() { return rotAroundX; }
+	float GetYaw() { return rotAroundY; }
+
+	// Off, the arrow keys (and co.) don't move it
+	void SetInputEnabled(bool enabled) { inputEnabled = enabled; }
+
 	~Camera();
 private:
 	DirectX::XMFLOAT4X4 camProjMatrix;
@@ -28,5 +44,11 @@ private:
 	DirectX::XMFLOAT3 camDir;
 	float rotAroundX;
 	float rotAroundY;
+	bool inputEnabled;
+
+	float fieldOfView;
+	float aspectRatio;
+	float nearClip;
+	float farClip;
 };
 
@@ -0,0 +1,173 @@
+#include "CameraPath.h"
+
+#include <math.h>
+#include <stdio.h>
+
+CameraPath::CameraPath()
+{
+	looping = false;
+}
+
+void CameraPath::AddKey(const CameraKey& key)
+{
+	if (!keys.empty() && key.Time <= keys.back().Time)
+		return;
+	keys.push_back(key);
+}
+
+// Uniform Catmull-Rom between b and c, t in [0, 1]
+static float CatmullRom(float a, float b, float c, float d, float t)
+{
+	float t2 = t * t;
+	float t3 = t2 * t;
+	return 0.5f * ((2 * b) + (c - a) * t + (2 * a - 5 * b + 4 * c - d) * t2 + (3 * b - a - 3 * c + d) * t3);
+}
+
+// The key moved by to - from
+static CameraKey Shift(const CameraKey& key, const CameraKey& to, const CameraKey& from)
+{
+	CameraKey result = key;
+	for (int axis = 0; axis < 3; axis++)
+		result.Position[axis] += to.Position[axis] - from.Position[axis];
+	result.Pitch += to.Pitch - from.Pitch;
+	result.Yaw += to.Yaw - from.Yaw;
+	return result;
+}
+
+// --------------------------------------------------------
+// Finds the segment the time falls in and blends its four
+// surrounding keys.  The ends repeat their last key (or wrap,
+// when looping) so the curve passes through every key.
+// --------------------------------------------------------
+void CameraPath::Sample(float time, CameraKey& result) const
+{
+	if (keys.empty())
+	{
+		CameraKey start = { time, { 0.0f, 0.0f, -5.0f }, 0.0f, 0.0f };
+		result = start;
+		return;
+	}
+
+	int count = (int)keys.size();
+	float duration = GetDuration();
+	float local = time;
+	if (looping && duration > 0)
+	{
+		local = fmodf(time, duration);
+		if (local < 0)
+			local += duration;
+	}
+	local += keys.front().Time;
+
+	if (count == 1 || local <= keys.front().Time || (!looping && local >= keys.back().Time))
+	{
+		result = local <= keys.front().Time ? keys.front() : keys.back();
+		result.Time = time;
+		return;
+	}
+
+	int segment = 0;
+	while (segment + 2 < count && keys[segment + 1].Time <= local)
+		segment++;
+
+	// Looping, the first and last keys are the same place, so
+	// the neighbours past either end come from the other end
+	// (shifted by however far the path turned, as yaw isn't
+	// wrapped).  Otherwise the end keys are repeated.
+	int last = count - 1;
+	const CameraKey& b = keys[segment];
+	const CameraKey& c = keys[segment + 1];
+	CameraKey a = segment > 0 ? keys[segment - 1] : b;
+	CameraKey d = segment + 2 <= last ? keys[segment + 2] : c;
+	if (looping && count > 2)
+	{
+		if (segment == 0)
+			a = Shift(keys[last - 1], keys[0], keys[last]);
+		if (segment + 2 > last)
+			d = Shift(keys[1], keys[last], keys[0]);
+	}
+
+	float t = (local - b.Time) / (c.Time - b.Time);
+	t = t < 0 ? 0 : (t > 1 ? 1 : t);
+
+	result.Time = time;
+	for (int axis = 0; axis < 3; axis++)
+		result.Position[axis] = CatmullRom(a.Position[axis], b.Position[axis], c.Position[axis], d.Position[axis], t);
+	result.Pitch = CatmullRom(a.Pitch, b.Pitch, c.Pitch, d.Pitch, t);
+	result.Yaw = CatmullRom(a.Yaw, b.Yaw, c.Yaw, d.Yaw, t);
+}
+
+bool CameraPath::Load(const char* path)
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "r");
+#else
+	file = fopen(path, "r");
+#endif
+	if (!file)
+		return false;
+
+	keys.clear();
+	char line[256];
+	while (fgets(line, sizeof(line), file))
+	{
+		if (line[0] == '#')
+			continue;
+
+		CameraKey key;
+		if (sscanf(line, "%f %f %f %f %f %f", &key.Time, &key.Position[0], &key.Position[1], &key.Position[2], &key.Pitch, &key.Yaw) == 6)
+			AddKey(key);
+	}
+
+	fclose(file);
+	return !keys.empty();
+}
+
+bool CameraPath::Save(const char* path) const
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "w");
+#else
+	file = fopen(path, "w");
+#endif
+	if (!file)
+		return false;
+
+	fprintf(file, "# time x y z pitch yaw\n");
+	for (size_t k = 0; k < keys.size(); k++)
+	{
+		const CameraKey& key = keys[k];
+		fprintf(file, "%.4f %.4f %.4f %.4f %.4f %.4f\n", key.Time, key.Position[0], key.Position[1], key.Position[2], key.Pitch, key.Yaw);
+	}
+
+	fclose(file);
+	return true;
+}
+
+void CameraPath::MakeOrbit(float radius, float height, float seconds, int keyCount)
+{
+	const float pi = 3.1415926535f;
+
+	keys.clear();
+	keyCount = keyCount > 2 ? keyCount : 3;
+	for (int k = 0; k <= keyCount; k++)
+	{
+		// Starts behind the scene, where Camera does, and goes
+		// round once - the last key is back at the first
+		float angle = 2.0f * pi * k / keyCount;
+		CameraKey key;
+		key.Time = seconds * k / keyCount;
+		key.Position[0] = -radius * sinf(angle);
+		key.Position[1] = height;
+		key.Position[2] = -radius * cosf(angle);
+
+		// Camera turns (0, 0, 1) by pitch, then yaw
+		float horizontal = sqrtf(key.Position[0] * key.Position[0] + key.Position[2] * key.Position[2]);
+		key.Pitch = atan2f(height, horizontal);
+		key.Yaw = angle;
+		keys.push_back(key);
+	}
+	looping = true;
+}
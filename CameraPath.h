@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+// Where the camera is at a point in time.  Pitch and yaw are
+// Camera's rotations around X and Y, in radians.
+struct CameraKey
+{
+	float Time;
+	float Position[3];
+	float Pitch;
+	float Yaw;
+};
+
+// --------------------------------------------------------
+// A camera flight: keys recorded (or written) at increasing
+// times, played back as a Catmull-Rom spline through them, so
+// a benchmark sees the same views every run.
+//
+// Saved as text, a key per line: "time x y z pitch yaw".
+// Lines starting with # are comments.  Yaw isn't wrapped, so
+// a recording that turns all the way round stays smooth.
+// --------------------------------------------------------
+class CameraPath
+{
+public:
+	CameraPath();
+
+	void Clear() { keys.clear(); }
+
+	// Keys must come in time order (ones that don't are ignored)
+	void AddKey(const CameraKey& key);
+	int GetKeyCount() const { return (int)keys.size(); }
+	const CameraKey& GetKey(int key) const { return keys[key]; }
+	float GetDuration() const { return keys.empty() ? 0 : keys.back().Time - keys.front().Time; }
+
+	// Past the end, wrap round to the start instead of stopping
+	void SetLooping(bool looping) { this->looping = looping; }
+
+	// The camera at this time (measured from the first key).
+	// With no keys, it's Camera's starting position.
+	void Sample(float time, CameraKey& result) const;
+
+	bool Load(const char* path);
+	bool Save(const char* path) const;
+
+	// A loop round the middle of the demo scene, looking in
+	// at the centre: keyCount keys over the given seconds
+	void MakeOrbit(float radius, float height, float seconds, int keyCount);
+
+private:
+	std::vector<CameraKey> keys;
+	bool looping;
+};
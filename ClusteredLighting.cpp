@@ -0,0 +1,109 @@
+#include "ClusteredLighting.h"
+
+#include <string.h>
+#include <chrono>
+
+// For the DirectX Math library
+using namespace DirectX;
+
+ClusteredLighting::ClusteredLighting(ID3D11Device* device, ID3D11DeviceContext* context, int maxLights, const LightClusterSettings& settings)
+{
+	this->device = device;
+	this->context = context;
+	this->maxLights = maxLights > 1 ? maxLights : 1;
+	grid = new LightClusterGrid(settings);
+
+	lightsBuffer = 0;
+	rangesBuffer = 0;
+	indicesBuffer = 0;
+	lightsSRV = 0;
+	rangesSRV = 0;
+	indicesSRV = 0;
+
+	memset(&clusterData, 0, sizeof(clusterData));
+	assignMs = 0;
+}
+
+ClusteredLighting::~ClusteredLighting()
+{
+	if (lightsSRV) { lightsSRV->Release(); }
+	if (rangesSRV) { rangesSRV->Release(); }
+	if (indicesSRV) { indicesSRV->Release(); }
+	if (lightsBuffer) { lightsBuffer->Release(); }
+	if (rangesBuffer) { rangesBuffer->Release(); }
+	if (indicesBuffer) { indicesBuffer->Release(); }
+
+	delete grid;
+}
+
+// --------------------------------------------------------
+// Creates the three structured buffers, at their largest
+// --------------------------------------------------------
+bool ClusteredLighting::Init()
+{
+	const LightClusterSettings& settings = grid->GetSettings();
+	return CreateBuffer(sizeof(ClusterLight), maxLights, &lightsBuffer, &lightsSRV)
+		&& CreateBuffer(sizeof(ClusterRange), grid->GetClusterCount(), &rangesBuffer, &rangesSRV)
+		&& CreateBuffer(sizeof(unsigned int), settings.MaxIndices > 1 ? settings.MaxIndices : 1, &indicesBuffer, &indicesSRV);
+}
+
+bool ClusteredLighting::CreateBuffer(unsigned int stride, unsigned int count, ID3D11Buffer** buffer, ID3D11ShaderResourceView** srv)
+{
+	// Dynamic, since it's rewritten every frame
+	D3D11_BUFFER_DESC desc = {};
+	desc.ByteWidth = stride * count;
+	desc.Usage = D3D11_USAGE_DYNAMIC;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+	desc.StructureByteStride = stride;
+	if (FAILED(device->CreateBuffer(&desc, 0, buffer)))
+		return false;
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+	srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+	srvDesc.Buffer.FirstElement = 0;
+	srvDesc.Buffer.NumElements = count;
+	return SUCCEEDED(device->CreateShaderResourceView(*buffer, &srvDesc, srv));
+}
+
+void ClusteredLighting::Upload(ID3D11Buffer* buffer, const void* data, size_t size)
+{
+	if (!buffer || size == 0)
+		return;
+
+	D3D11_MAPPED_SUBRESOURCE mapped;
+	if (FAILED(context->Map(buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+		return;
+	memcpy(mapped.pData, data, size);
+	context->Unmap(buffer, 0);
+}
+
+void ClusteredLighting::Update(const LightClusterCamera& camera, const ClusterLight* lights, int lightCount, int screenWidth, int screenHeight)
+{
+	if (lightCount > maxLights) lightCount = maxLights;
+	if (lightCount < 0) lightCount = 0;
+
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	grid->SetCamera(camera);
+	grid->Assign(lights, lightCount);
+	assignMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+	// Only what was written this frame is uploaded; the shader
+	// never reads past a cluster's count
+	const std::vector<ClusterRange>& ranges = grid->GetRanges();
+	const std::vector<unsigned int>& indices = grid->GetIndices();
+	if (lightCount > 0)
+		Upload(lightsBuffer, lights, lightCount * sizeof(ClusterLight));
+	if (!ranges.empty())
+		Upload(rangesBuffer, &ranges[0], ranges.size() * sizeof(ClusterRange));
+	if (!indices.empty())
+		Upload(indicesBuffer, &indices[0], indices.size() * sizeof(unsigned int));
+
+	const LightClusterSettings& settings = grid->GetSettings();
+	clusterData.clusterCounts = XMUINT3(settings.TilesX, settings.TilesY, settings.Slices);
+	clusterData.clusterTileSize = XMFLOAT2((float)screenWidth / settings.TilesX, (float)screenHeight / settings.TilesY);
+	clusterData.clusterSliceScale = grid->GetSliceScale();
+	clusterData.clusterSliceBias = grid->GetSliceBias();
+}
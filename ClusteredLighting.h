@@ -0,0 +1,63 @@
+#pragma once
+
+#include <d3d11.h>
+
+#include "LightClusterGrid.h"
+#include "ShaderStructs.h"
+
+// --------------------------------------------------------
+// Clustered forward shading: assigns lights to the grid's
+// clusters each frame (see LightClusterGrid) and uploads the
+// results as the structured buffers PixelShader reads when
+// CLUSTERED is on:
+//   ClusteredLights      - Every light (ClusterLight)
+//   ClusterRanges        - Offset and count, per cluster
+//   ClusterLightIndices  - Every cluster's list, end to end
+// plus the clusterData constants to find a pixel's cluster.
+//
+// Uses the immediate context, so it must run on the main thread.
+// --------------------------------------------------------
+class ClusteredLighting
+{
+public:
+	// maxLights - Most lights Update() will upload
+	ClusteredLighting(ID3D11Device* device, ID3D11DeviceContext* context, int maxLights, const LightClusterSettings& settings);
+	~ClusteredLighting();
+
+	bool Init();
+
+	// Assigns and uploads this frame's lights
+	//
+	// camera       - The view the lights are binned in
+	// lights       - World space lights (up to maxLights are used)
+	// screenWidth  - Size of the render target, so the shader
+	// screenHeight   can turn pixels into tiles
+	void Update(const LightClusterCamera& camera, const ClusterLight* lights, int lightCount, int screenWidth, int screenHeight);
+
+	ID3D11ShaderResourceView* GetLightsSRV() { return lightsSRV; }
+	ID3D11ShaderResourceView* GetRangesSRV() { return rangesSRV; }
+	ID3D11ShaderResourceView* GetIndicesSRV() { return indicesSRV; }
+	void GetClusterData(PixelShader_clusterData& data) { data = clusterData; }
+
+	LightClusterGrid* GetGrid() { return grid; }
+	double GetAssignMs() { return assignMs; }	// CPU time of the last Update's assignment
+
+private:
+	ID3D11Device* device;
+	ID3D11DeviceContext* context;
+	int maxLights;
+	LightClusterGrid* grid;
+
+	ID3D11Buffer* lightsBuffer;
+	ID3D11Buffer* rangesBuffer;
+	ID3D11Buffer* indicesBuffer;
+	ID3D11ShaderResourceView* lightsSRV;
+	ID3D11ShaderResourceView* rangesSRV;
+	ID3D11ShaderResourceView* indicesSRV;
+
+	PixelShader_clusterData clusterData;
+	double assignMs;
+
+	bool CreateBuffer(unsigned int stride, unsigned int count, ID3D11Buffer** buffer, ID3D11ShaderResourceView** srv);
+	void Upload(ID3D11Buffer* buffer, const void* data, size_t size);
+};
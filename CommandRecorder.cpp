@@ -0,0 +1,159 @@
+#include "CommandRecorder.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+NullCommandRecordingBackend::NullCommandRecordingBackend(bool parallel)
+{
+	this->parallel = parallel;
+	concurrent = 0;
+	maxConcurrent = 0;
+}
+
+bool NullCommandRecordingBackend::Reserve(int jobCount)
+{
+	recordCounts.assign(jobCount, 0);
+	recorded.assign(jobCount, false);
+	executed.clear();
+	concurrent = 0;
+	maxConcurrent = 0;
+	return parallel;
+}
+
+ID3D11DeviceContext* NullCommandRecordingBackend::BeginJob(int job)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	recordCounts[job]++;
+	concurrent++;
+	maxConcurrent = std::max(maxConcurrent, concurrent);
+	return 0;
+}
+
+void NullCommandRecordingBackend::EndJob(int job)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	recorded[job] = true;
+	concurrent--;
+}
+
+void NullCommandRecordingBackend::ExecuteJob(int job)
+{
+	// Only finished recordings can be played back
+	if (recorded[job])
+		executed.push_back(job);
+	recorded[job] = false;
+}
+
+CommandRecorder::CommandRecorder(CommandRecordingBackend* backend)
+{
+	this->backend = backend;
+	parallel = false;
+	recordMs = 0;
+	executeMs = 0;
+
+	parallelFor = [](int count, const std::function<void(int begin, int end)>& work)
+	{
+		int threadCount = std::max(1, std::min((int)std::thread::hardware_concurrency(), count));
+		std::vector<std::thread> threads;
+		for (int t = 1; t < threadCount; t++)
+			threads.push_back(std::thread(work, count * t / threadCount, count * (t + 1) / threadCount));
+		work(0, count / threadCount);
+		for (size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+	};
+}
+
+void CommandRecorder::Clear()
+{
+	jobs.clear();
+}
+
+int CommandRecorder::AddJob(const char* name, const RecordFunction& record)
+{
+	// Kept by the profiler for frames after this one
+	Job job;
+	job.Name = Profiler::Intern(name);
+	job.Record = record;
+	job.Ms = 0;
+	jobs.push_back(job);
+	return (int)jobs.size() - 1;
+}
+
+void CommandRecorder::RecordJob(int job)
+{
+	PROFILE_SCOPE(jobs[job].Name);
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	ID3D11DeviceContext* context = backend->BeginJob(job);
+	jobs[job].Record(context);
+	backend->EndJob(job);
+	jobs[job].Ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// --------------------------------------------------------
+// Records every job.  If the backend can't record in parallel
+// the jobs go straight to the immediate context one by one,
+// in order, and there's nothing left for Execute() to do.
+// --------------------------------------------------------
+void CommandRecorder::Record()
+{
+	PROFILE_SCOPE("Record");
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+	int jobCount = (int)jobs.size();
+	parallel = backend->Reserve(jobCount);
+	if (parallel)
+	{
+		parallelFor(jobCount, [this](int begin, int end)
+		{
+			for (int job = begin; job < end; job++)
+				RecordJob(job);
+		});
+	}
+	else
+	{
+		for (int job = 0; job < jobCount; job++)
+		{
+			if (playbackHook)
+				playbackHook(job, true);
+			RecordJob(job);
+			if (playbackHook)
+				playbackHook(job, false);
+		}
+	}
+
+	recordMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+void CommandRecorder::Execute()
+{
+	PROFILE_SCOPE("Execute");
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+	if (parallel)
+	{
+		for (int job = 0; job < (int)jobs.size(); job++)
+		{
+			if (playbackHook)
+				playbackHook(job, true);
+			backend->ExecuteJob(job);
+			if (playbackHook)
+				playbackHook(job, false);
+		}
+	}
+
+	executeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+void CommandRecorder::Split(int count, int maxChunks, int minChunkSize, std::vector<std::pair<int, int>>& chunks)
+{
+	chunks.clear();
+	if (count <= 0)
+		return;
+
+	minChunkSize = std::max(minChunkSize, 1);
+	int chunkCount = std::max(1, std::min(maxChunks, count / minChunkSize));
+	for (int c = 0; c < chunkCount; c++)
+		chunks.push_back(std::make_pair(count * c / chunkCount, count * (c + 1) / chunkCount));
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Only passed through here, so D3D isn't needed to build this
+// (or to run it with the null backend)
+struct ID3D11DeviceContext;
+
+// --------------------------------------------------------
+// Where recording jobs get their contexts, and how their
+// results are played back.  For D3D11 (see
+// D3D11CommandRecordingBackend) each job records on its own
+// deferred context into a command list.
+// --------------------------------------------------------
+class CommandRecordingBackend
+{
+public:
+	virtual ~CommandRecordingBackend() {}
+
+	// Gets a context ready for each of this many jobs.  Returns
+	// false if jobs can't record in parallel - they then run one
+	// at a time, in order, straight onto the immediate context.
+	virtual bool Reserve(int jobCount) = 0;
+
+	// On the job's thread: the context to record into, and then
+	// done recording
+	virtual ID3D11DeviceContext* BeginJob(int job) = 0;
+	virtual void EndJob(int job) = 0;
+
+	// On the main thread, in job order: plays back what the job
+	// recorded
+	virtual void ExecuteJob(int job) = 0;
+};
+
+// --------------------------------------------------------
+// A backend with no device, for running a frame's job split
+// headless.  Jobs get a null context, so their work must not
+// touch D3D; this just checks that each job is recorded once
+// and played back in order, and how many recorded at once.
+// --------------------------------------------------------
+class NullCommandRecordingBackend : public CommandRecordingBackend
+{
+public:
+	// parallel - Whether Reserve() lets jobs record in parallel
+	NullCommandRecordingBackend(bool parallel = true);
+
+	bool Reserve(int jobCount);
+	ID3D11DeviceContext* BeginJob(int job);
+	void EndJob(int job);
+	void ExecuteJob(int job);
+
+	// Since the last Reserve()
+	const std::vector<int>& GetRecordCounts() { return recordCounts; }	// Per job
+	const std::vector<int>& GetExecuted() { return executed; }			// Jobs, in execution order
+	int GetMaxConcurrent() { return maxConcurrent; }					// Most jobs recording at once
+
+private:
+	bool parallel;
+	std::mutex mutex;
+	std::vector<int> recordCounts;
+	std::vector<bool> recorded;		// Finished, but not executed yet
+	std::vector<int> executed;
+	int concurrent;
+	int maxConcurrent;
+};
+
+// --------------------------------------------------------
+// Splits a frame's rendering into jobs that record in
+// parallel (say the shadow pass and a few chunks of the main
+// pass), then plays their results back on the main thread in
+// the order the jobs were added - so the frame comes out the
+// same as if it had been drawn in one go.
+//
+// Each job records on its own context and starts with
+// nothing bound, so it must set everything it draws with.
+// Anything per frame that all jobs share (constant buffers
+// written once, clears) should go on the immediate context
+// before Execute().
+// --------------------------------------------------------
+class CommandRecorder
+{
+public:
+	// Records one job on the given context
+	typedef std::function<void(ID3D11DeviceContext* context)> RecordFunction;
+
+	// Runs work(begin, end) over [0, count), in pieces
+	typedef std::function<void(int count, const std::function<void(int begin, int end)>& work)> ParallelFor;
+
+	// Called with begin true, then false, around each job's
+	// commands reaching the immediate context
+	typedef std::function<void(int job, bool begin)> PlaybackHook;
+
+	CommandRecorder(CommandRecordingBackend* backend);
+
+	// Replaces the default (a thread per core, per call)
+	void SetParallelFor(const ParallelFor& parallelFor) { this->parallelFor = parallelFor; }
+
+	// On the main thread, in job order - e.g. to put GPU
+	// timestamps around each job
+	void SetPlaybackHook(const PlaybackHook& hook) { playbackHook = hook; }
+
+	// Building this frame's jobs
+	void Clear();
+	int AddJob(const char* name, const RecordFunction& record);
+
+	// Records every job (in parallel when the backend allows),
+	// then plays them back in order on the calling thread
+	void Record();
+	void Execute();
+
+	// Cuts count items into at most maxChunks runs of at least
+	// minChunkSize items each (fewer only if count is), as
+	// (begin, end) pairs - e.g. entities per main pass job
+	static void Split(int count, int maxChunks, int minChunkSize, std::vector<std::pair<int, int>>& chunks);
+
+	// Stats from the last Record() / Execute()
+	int GetJobCount() { return (int)jobs.size(); }
+	const char* GetJobName(int job) { return jobs[job].Name; }	// Interned (see Profiler)
+	double GetJobMs(int job) { return jobs[job].Ms; }	// Recording time
+	double GetRecordMs() { return recordMs; }			// All jobs, wall clock
+	double GetExecuteMs() { return executeMs; }
+	bool WasParallel() { return parallel; }
+
+private:
+	struct Job
+	{
+		const char* Name;
+		RecordFunction Record;
+		double Ms;
+	};
+
+	CommandRecordingBackend* backend;
+	ParallelFor parallelFor;
+	PlaybackHook playbackHook;
+	std::vector<Job> jobs;
+	bool parallel;
+	double recordMs;
+	double executeMs;
+
+	void RecordJob(int job);
+};
@@ -0,0 +1,328 @@
+// --------------------------------------------------------
+// Offline tool: records frames of jobs through the command
+// recorder (see CommandRecorder) on the null backend, with
+// the job system's worker threads doing the recording, and
+// checks what's played back (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread CommandRecorderCheck.cpp CommandRecorder.cpp JobSystem.cpp Profiler.cpp NullRenderDevice.cpp -o CommandRecorderCheck
+//   ./CommandRecorderCheck
+//
+// Options:
+//   --frames N      Frames recorded (default 500)
+//   --jobs N        Most jobs in a frame (default 48)
+//   --threads N     Job system threads (default 4, so there are
+//                   workers even on a machine with one core)
+//
+// Each job draws into its own null context, a number of
+// commands that depends on the job and the frame, and takes
+// a random time so jobs finish out of order.  Playback (the
+// recorder's playback hook) appends each job's commands to
+// one stream, as D3D11 would play command lists onto the
+// immediate context.  Fails (returns 1) if a job is recorded
+// other than once, if playback isn't in job order, or if the
+// stream's commands differ from what the jobs recorded.  Also
+// runs the one-at-a-time path (a backend that can't record in
+// parallel) and checks CommandRecorder::Split().
+// --------------------------------------------------------
+
+#include "CommandRecorder.h"
+#include "JobSystem.h"
+#include "NullRenderDevice.h"
+#include "Profiler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+static void Check(bool ok, int frame, const char* what)
+{
+	if (!ok)
+	{
+		if (failures < 20)
+			printf("  FAILED (frame %d): %s\n", frame, what);
+		failures++;
+	}
+}
+
+// What job j of a frame records: its buffer's update, then a
+// viewport and some draws tagged with the job (vertex counts)
+static int GetDrawCount(int frame, int job)
+{
+	return 1 + (job * 7 + frame) % 13;
+}
+
+static unsigned int GetTag(int job, int draw)
+{
+	return (unsigned int)(job * 1000 + draw) * 3;
+}
+
+static void RecordJob(NullRenderContext* context, RenderBufferHandle buffer, int frame, int job, int spinMicroseconds)
+{
+	// Take a while, so jobs finish in a different order from
+	// the one they were added in
+	std::chrono::high_resolution_clock::time_point until = std::chrono::high_resolution_clock::now() + std::chrono::microseconds(spinMicroseconds);
+	while (std::chrono::high_resolution_clock::now() < until)
+	{
+	}
+
+	context->UpdateBuffer(buffer, 0, 16 * (job + 1));
+	context->SetViewport(0, 0, 1, 1);
+	int draws = GetDrawCount(frame, job);
+	for (int d = 0; d < draws; d++)
+	{
+		if (d % 2)
+			context->DrawIndexed(GetTag(job, d), 0, 0);
+		else
+			context->Draw(GetTag(job, d), 0);
+	}
+}
+
+// The stream job j should have added
+static void AppendExpected(std::vector<RenderCommand>& stream, RenderBufferHandle buffer, int frame, int job)
+{
+	RenderCommand update = { RENDER_COMMAND_UPDATE_BUFFER, buffer, (unsigned int)(16 * (job + 1)) };
+	RenderCommand viewport = { RENDER_COMMAND_SET_VIEWPORT, 0, 0 };
+	stream.push_back(update);
+	stream.push_back(viewport);
+	int draws = GetDrawCount(frame, job);
+	for (int d = 0; d < draws; d++)
+	{
+		RenderCommand draw = { d % 2 ? RENDER_COMMAND_DRAW_INDEXED : RENDER_COMMAND_DRAW, 0, GetTag(job, d) };
+		stream.push_back(draw);
+	}
+}
+
+static bool SameStream(const std::vector<RenderCommand>& a, const std::vector<RenderCommand>& b)
+{
+	if (a.size() != b.size())
+		return false;
+	for (size_t i = 0; i < a.size(); i++)
+	{
+		if (a[i].Type != b[i].Type || a[i].Handle != b[i].Handle || a[i].Count != b[i].Count)
+			return false;
+	}
+	return true;
+}
+
+static void CheckSplit()
+{
+	printf("Split\n");
+	std::vector<std::pair<int, int>> chunks;
+	for (int count = 0; count < 300; count++)
+	{
+		for (int maxChunks = 1; maxChunks <= 16; maxChunks++)
+		{
+			for (int minChunkSize = 0; minChunkSize <= 40; minChunkSize += 8)
+			{
+				CommandRecorder::Split(count, maxChunks, minChunkSize, chunks);
+				if (count == 0)
+				{
+					Check(chunks.empty(), -1, "Split() of nothing made chunks");
+					continue;
+				}
+
+				bool ok = !chunks.empty() && (int)chunks.size() <= maxChunks && chunks[0].first == 0 && chunks.back().second == count;
+				for (size_t c = 0; c < chunks.size() && ok; c++)
+				{
+					ok = chunks[c].second > chunks[c].first;
+					if (c > 0)
+						ok = ok && chunks[c].first == chunks[c - 1].second;
+					if (chunks.size() > 1)
+						ok = ok && chunks[c].second - chunks[c].first >= minChunkSize;
+				}
+				Check(ok, -1, "Split() chunks don't cover the range in order, within the limits");
+			}
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int frames = 500;
+	int maxJobs = 48;
+	int threads = 4;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--frames") == 0 && hasValue)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--jobs") == 0 && hasValue)
+			maxJobs = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--threads") == 0 && hasValue)
+			threads = atoi(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+	if (frames < 1 || maxJobs < 1 || threads < 1)
+	{
+		printf("Needs a frame, a job and a thread\n");
+		return 2;
+	}
+
+	Profiler::SetThreadName("Main");
+	JobSystem jobSystem(threads - 1);
+
+	NullRenderDevice device;
+	std::vector<NullRenderContext*> contexts;
+	std::vector<RenderBufferHandle> buffers;
+	for (int j = 0; j < maxJobs; j++)
+	{
+		contexts.push_back(device.CreateContext());
+		RenderBufferDesc desc = { RENDER_BUFFER_CONSTANT, RENDER_USAGE_DYNAMIC, 16 * (unsigned int)(j + 1), 0 };
+		buffers.push_back(device.CreateBuffer(desc, 0));
+	}
+
+	std::mt19937 random(42);
+	std::vector<RenderCommand> stream;
+	std::vector<RenderCommand> expected;
+	std::vector<int> hookCalls;
+
+	printf("%d frames of up to %d jobs on %d thread(s)\n", frames, maxJobs, jobSystem.GetThreadCount());
+	for (int pass = 0; pass < 2; pass++)
+	{
+		// Recorded in parallel on the job system, then one at a
+		// time (a backend that can't record in parallel)
+		bool parallel = pass == 0;
+		printf("%s\n", parallel ? "Parallel" : "One at a time");
+		NullCommandRecordingBackend backend(parallel);
+		CommandRecorder recorder(&backend);
+		recorder.SetParallelFor(jobSystem.GetParallelFor());
+
+		recorder.SetPlaybackHook([&](int job, bool begin)
+		{
+			hookCalls.push_back(begin ? job : -1 - job);
+
+			// Where D3D11 would execute the job's command list
+			if (!begin)
+			{
+				const std::vector<RenderCommand>& commands = contexts[job]->GetCommands();
+				stream.insert(stream.end(), commands.begin(), commands.end());
+			}
+		});
+
+		std::set<std::thread::id> recordingThreads;
+		std::mutex threadsLock;
+		int outOfOrderFrames = 0;
+		int maxConcurrent = 0;
+
+		for (int frame = 0; frame < frames; frame++)
+		{
+			int jobCount = 1 + (int)(random() % maxJobs);
+			std::vector<int> spins(jobCount);
+			for (int j = 0; j < jobCount; j++)
+				spins[j] = (int)(random() % 200);
+
+			std::atomic<int> finished(0);
+			std::vector<int> finishOrder(jobCount, -1);
+			recorder.Clear();
+			for (int j = 0; j < jobCount; j++)
+			{
+				contexts[j]->Reset();
+				recorder.AddJob(j % 2 ? "Main pass" : "Shadows", [&, j, frame](ID3D11DeviceContext* context)
+				{
+					// The null backend hands out no D3D context
+					Check(context == 0, frame, "null backend gave a job a context");
+					RecordJob(contexts[j], buffers[j], frame, j, spins[j]);
+					finishOrder[j] = finished.fetch_add(1);
+					std::lock_guard<std::mutex> lock(threadsLock);
+					recordingThreads.insert(std::this_thread::get_id());
+				});
+			}
+
+			stream.clear();
+			hookCalls.clear();
+			recorder.Record();
+			recorder.Execute();
+
+			// Every job recorded once, and the recorder used the
+			// path the backend asked for
+			Check(recorder.WasParallel() == parallel, frame, "recorded on the wrong path");
+			Check(recorder.GetJobCount() == jobCount, frame, "job count");
+			const std::vector<int>& recordCounts = backend.GetRecordCounts();
+			Check((int)recordCounts.size() == jobCount, frame, "backend reserved the wrong number of jobs");
+			for (int j = 0; j < (int)recordCounts.size(); j++)
+				Check(recordCounts[j] == 1, frame, "a job was recorded other than once");
+
+			// Played back in job order, with the hook around each
+			const std::vector<int>& executed = backend.GetExecuted();
+			if (parallel)
+			{
+				Check((int)executed.size() == jobCount, frame, "not every job was played back");
+				for (int j = 0; j < (int)executed.size(); j++)
+					Check(executed[j] == j, frame, "playback out of job order");
+			}
+			else
+				Check(executed.empty(), frame, "one at a time recording left something to play back");
+
+			bool hookOk = (int)hookCalls.size() == jobCount * 2;
+			for (int j = 0; j < jobCount && hookOk; j++)
+				hookOk = hookCalls[j * 2] == j && hookCalls[j * 2 + 1] == -1 - j;
+			Check(hookOk, frame, "playback hook not called around each job, in order");
+
+			// The stream is every job's commands, in job order
+			expected.clear();
+			for (int j = 0; j < jobCount; j++)
+				AppendExpected(expected, buffers[j], frame, j);
+			Check(SameStream(stream, expected), frame, "played back commands differ from what the jobs recorded");
+
+			unsigned int draws = 0;
+			unsigned int updates = 0;
+			for (int j = 0; j < jobCount; j++)
+			{
+				draws += contexts[j]->GetDrawCount();
+				updates += contexts[j]->GetCount(RENDER_COMMAND_UPDATE_BUFFER);
+				Check(contexts[j]->GetDrawCount() == (unsigned int)GetDrawCount(frame, j), frame, "a job's draw count");
+				Check(contexts[j]->GetInvalidHandles() == 0, frame, "a job named a resource that isn't there");
+			}
+			Check(updates == (unsigned int)jobCount, frame, "buffer updates");
+
+			for (int j = 1; j < jobCount; j++)
+			{
+				if (finishOrder[j] < finishOrder[j - 1])
+				{
+					outOfOrderFrames++;
+					break;
+				}
+			}
+			if (!parallel)
+			{
+				for (int j = 0; j < jobCount; j++)
+					Check(finishOrder[j] == j, frame, "one at a time jobs ran out of order");
+			}
+			if (backend.GetMaxConcurrent() > maxConcurrent)
+				maxConcurrent = backend.GetMaxConcurrent();
+
+			Profiler::EndFrame();
+		}
+
+		printf("  %d thread(s) recorded, at most %d job(s) at once, %d frame(s) finished out of order\n",
+			(int)recordingThreads.size(), maxConcurrent, outOfOrderFrames);
+		if (parallel && jobSystem.GetThreadCount() > 1)
+			Check(recordingThreads.size() > 1, frames, "no job was recorded on a worker");
+		if (!parallel)
+			Check(maxConcurrent <= 1, frames, "one at a time jobs recorded together");
+	}
+
+	CheckSplit();
+
+	if (failures > 0)
+	{
+		printf("\nFAILED: %d check(s)\n", failures);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
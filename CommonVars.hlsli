@@ -1,9 +1,6 @@
-//only one thread
-//main will be empty
-[numthreads(1, 1, 1)]
-void main( uint3 DTid : SV_DispatchThreadID )
-{
-}
+// Shared constants and BRDF helpers - included by the pixel shaders
+#ifndef COMMON_VARS_HLSLI
+#define COMMON_VARS_HLSLI
 
 //Constants
 static const float Pi = 3.141592654f;
@@ -98,4 +95,6 @@ float3 ImportanceSampleGGX(float2 Xi, float Roughness, float3 N)
 
 	// Tangent to world space
 	return TangentX * H.x + TangentY * H.y + N * H.z;
-}
\ No newline at end of file
+}
+
+#endif
@@ -0,0 +1,234 @@
+#include "CubemapImage.h"
+
+#include <math.h>
+
+CubemapImage::CubemapImage()
+{
+	size = 0;
+	mipCount = 0;
+}
+
+// --------------------------------------------------------
+// Allocates (and zeroes) every face of every mip
+//
+// size     - Width and height of the top mip's faces
+// mipCount - Number of mips (0 for the full chain)
+// --------------------------------------------------------
+void CubemapImage::Create(int size, int mipCount)
+{
+	int fullChain = 1;
+	while ((size >> fullChain) > 0)
+		fullChain++;
+
+	this->size = size;
+	this->mipCount = (mipCount <= 0 || mipCount > fullChain) ? fullChain : mipCount;
+
+	faces.clear();
+	faces.resize(this->mipCount * 6);
+	for (int mip = 0; mip < this->mipCount; mip++)
+	{
+		int mipSize = GetMipSize(mip);
+		for (int face = 0; face < 6; face++)
+			faces[mip * 6 + face].assign(mipSize * mipSize * 4, 0.0f);
+	}
+}
+
+float* CubemapImage::GetFace(int face, int mip)
+{
+	return &faces[mip * 6 + face][0];
+}
+
+const float* CubemapImage::GetFace(int face, int mip) const
+{
+	return &faces[mip * 6 + face][0];
+}
+
+void CubemapImage::GenerateMips()
+{
+	for (int mip = 1; mip < mipCount; mip++)
+	{
+		int srcSize = GetMipSize(mip - 1);
+		int dstSize = GetMipSize(mip);
+		for (int face = 0; face < 6; face++)
+		{
+			const float* src = GetFace(face, mip - 1);
+			float* dst = GetFace(face, mip);
+			for (int y = 0; y < dstSize; y++)
+			{
+				for (int x = 0; x < dstSize; x++)
+				{
+					int x0 = x * 2, y0 = y * 2;
+					int x1 = x0 + 1 < srcSize ? x0 + 1 : x0;
+					int y1 = y0 + 1 < srcSize ? y0 + 1 : y0;
+					for (int c = 0; c < 4; c++)
+					{
+						dst[(y * dstSize + x) * 4 + c] = 0.25f * (
+							src[(y0 * srcSize + x0) * 4 + c] +
+							src[(y0 * srcSize + x1) * 4 + c] +
+							src[(y1 * srcSize + x0) * 4 + c] +
+							src[(y1 * srcSize + x1) * 4 + c]);
+					}
+				}
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------
+// Maps a direction to a face and UV.  Inverse of the mapping
+// in GetTexelDirection() (and RadMapPS.hlsl's GetNormal)
+// --------------------------------------------------------
+int CubemapImage::GetFaceUV(const float dir[3], float& u, float& v)
+{
+	float ax = fabsf(dir[0]), ay = fabsf(dir[1]), az = fabsf(dir[2]);
+	int face;
+	float sc, tc, ma;
+
+	if (ax >= ay && ax >= az)
+	{
+		ma = ax;
+		if (dir[0] > 0) { face = 0; sc = -dir[2]; tc = -dir[1]; }
+		else			{ face = 1; sc = dir[2];  tc = -dir[1]; }
+	}
+	else if (ay >= az)
+	{
+		ma = ay;
+		if (dir[1] > 0) { face = 2; sc = dir[0]; tc = dir[2]; }
+		else			{ face = 3; sc = dir[0]; tc = -dir[2]; }
+	}
+	else
+	{
+		ma = az;
+		if (dir[2] > 0) { face = 4; sc = dir[0];  tc = -dir[1]; }
+		else			{ face = 5; sc = -dir[0]; tc = -dir[1]; }
+	}
+
+	u = 0.5f * (sc / ma + 1.0f);
+	v = 0.5f * (tc / ma + 1.0f);
+	return face;
+}
+
+void CubemapImage::GetTexelDirection(int face, int x, int y, int faceSize, float dir[3])
+{
+	// Texel center in [-1, 1]
+	float s = 2.0f * (x + 0.5f) / faceSize - 1.0f;
+	float t = 2.0f * (y + 0.5f) / faceSize - 1.0f;
+
+	switch (face)
+	{
+	case 0: dir[0] = 1;  dir[1] = -t; dir[2] = -s; break;
+	case 1: dir[0] = -1; dir[1] = -t; dir[2] = s;  break;
+	case 2: dir[0] = s;  dir[1] = 1;  dir[2] = t;  break;
+	case 3: dir[0] = s;  dir[1] = -1; dir[2] = -t; break;
+	case 4: dir[0] = s;  dir[1] = -t; dir[2] = 1;  break;
+	default: dir[0] = -s; dir[1] = -t; dir[2] = -1; break;
+	}
+
+	float invLength = 1.0f / sqrtf(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+	dir[0] *= invLength;
+	dir[1] *= invLength;
+	dir[2] *= invLength;
+}
+
+// --------------------------------------------------------
+// Exact solid angle of a texel: the area of the texel's corners
+// projected onto the unit sphere
+// http://www.rorydriscoll.com/2012/01/15/cubemap-texel-solid-angle/
+// --------------------------------------------------------
+static float AreaElement(float x, float y)
+{
+	return atan2f(x * y, sqrtf(x * x + y * y + 1));
+}
+
+float CubemapImage::GetTexelSolidAngle(int x, int y, int faceSize)
+{
+	float invSize = 1.0f / faceSize;
+	float x0 = 2.0f * x * invSize - 1.0f;
+	float y0 = 2.0f * y * invSize - 1.0f;
+	float x1 = x0 + 2.0f * invSize;
+	float y1 = y0 + 2.0f * invSize;
+
+	return AreaElement(x0, y0) - AreaElement(x0, y1) - AreaElement(x1, y0) + AreaElement(x1, y1);
+}
+
+void CubemapImage::Sample(const float dir[3], int mip, float rgba[4]) const
+{
+	float u, v;
+	int face = GetFaceUV(dir, u, v);
+	SampleFace(face, u, v, mip, rgba);
+}
+
+void CubemapImage::SampleFace(int face, float u, float v, int mip, float rgba[4]) const
+{
+	int mipSize = GetMipSize(mip);
+	const float* texels = GetFace(face, mip);
+
+	// Bilinear, clamped to the face's edges
+	float fx = u * mipSize - 0.5f;
+	float fy = v * mipSize - 0.5f;
+	if (fx < 0) fx = 0;
+	if (fy < 0) fy = 0;
+	int x0 = (int)fx, y0 = (int)fy;
+	if (x0 > mipSize - 1) x0 = mipSize - 1;
+	if (y0 > mipSize - 1) y0 = mipSize - 1;
+	int x1 = x0 + 1 < mipSize ? x0 + 1 : x0;
+	int y1 = y0 + 1 < mipSize ? y0 + 1 : y0;
+	float tx = fx - x0, ty = fy - y0;
+	if (tx > 1) tx = 1;
+	if (ty > 1) ty = 1;
+
+	const float* t00 = texels + (y0 * mipSize + x0) * 4;
+	const float* t10 = texels + (y0 * mipSize + x1) * 4;
+	const float* t01 = texels + (y1 * mipSize + x0) * 4;
+	const float* t11 = texels + (y1 * mipSize + x1) * 4;
+	for (int c = 0; c < 4; c++)
+	{
+		float top = t00[c] + (t10[c] - t00[c]) * tx;
+		float bottom = t01[c] + (t11[c] - t01[c]) * tx;
+		rgba[c] = top + (bottom - top) * ty;
+	}
+}
+
+void CubemapImage::SampleLevel(const float dir[3], float level, float rgba[4]) const
+{
+	// The face and position are the same on every mip
+	float u, v;
+	int face = GetFaceUV(dir, u, v);
+
+	if (level <= 0)
+	{
+		SampleFace(face, u, v, 0, rgba);
+		return;
+	}
+	if (level >= mipCount - 1)
+	{
+		SampleFace(face, u, v, mipCount - 1, rgba);
+		return;
+	}
+
+	int mip = (int)level;
+	float t = level - mip;
+	float upper[4], lower[4];
+	SampleFace(face, u, v, mip, upper);
+	SampleFace(face, u, v, mip + 1, lower);
+	for (int c = 0; c < 4; c++)
+		rgba[c] = upper[c] + (lower[c] - upper[c]) * t;
+}
+
+float CubemapImage::MaxDifference(const CubemapImage& a, const CubemapImage& b, int mip)
+{
+	float maxDiff = 0;
+	int mipSize = a.GetMipSize(mip);
+	for (int face = 0; face < 6; face++)
+	{
+		const float* ta = a.GetFace(face, mip);
+		const float* tb = b.GetFace(face, mip);
+		for (int i = 0; i < mipSize * mipSize * 4; i++)
+		{
+			float diff = fabsf(ta[i] - tb[i]);
+			if (diff > maxDiff)
+				maxDiff = diff;
+		}
+	}
+	return maxDiff;
+}
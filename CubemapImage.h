@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+
+// --------------------------------------------------------
+// A floating point (RGBA) cubemap with a mip chain, kept in
+// system memory.  This is the CPU side of image based lighting:
+// prefiltering, SH projection and the DDS cache all work on it,
+// without D3D, so they can run (and be checked) anywhere.
+//
+// Faces use the D3D order and orientation (+X, -X, +Y, -Y, +Z,
+// -Z) - the same mapping as GetNormal() in RadMapPS.hlsl.
+// --------------------------------------------------------
+class CubemapImage
+{
+public:
+	CubemapImage();
+
+	void Create(int size, int mipCount);
+	bool IsValid() { return size > 0; }
+
+	int GetSize() const { return size; }
+	int GetMipCount() const { return mipCount; }
+	int GetMipSize(int mip) const { return size >> mip > 0 ? size >> mip : 1; }
+
+	// RGBA texels of one face of one mip, row by row
+	float* GetFace(int face, int mip);
+	const float* GetFace(int face, int mip) const;
+
+	// Fills every mip below the top one with a 2x2 box filter
+	void GenerateMips();
+
+	// Bilinear sample of one mip level in the given direction
+	void Sample(const float dir[3], int mip, float rgba[4]) const;
+
+	// Trilinear sample (fractional mip level, clamped to the chain)
+	void SampleLevel(const float dir[3], float level, float rgba[4]) const;
+
+	// Bilinear sample at a position on one face (u, v in 0-1)
+	void SampleFace(int face, float u, float v, int mip, float rgba[4]) const;
+
+	// Direction through the center of a texel (normalized)
+	static void GetTexelDirection(int face, int x, int y, int faceSize, float dir[3]);
+
+	// Solid angle covered by a texel, in steradians
+	static float GetTexelSolidAngle(int x, int y, int faceSize);
+
+	// Which face a direction hits, and where on it (0-1)
+	static int GetFaceUV(const float dir[3], float& u, float& v);
+
+	// Largest per-channel difference between two images' texels
+	static float MaxDifference(const CubemapImage& a, const CubemapImage& b, int mip);
+
+private:
+	int size;
+	int mipCount;
+	std::vector< std::vector<float> > faces;	// [mip * 6 + face]
+};
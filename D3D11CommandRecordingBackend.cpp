@@ -0,0 +1,76 @@
+#include "D3D11CommandRecordingBackend.h"
+
+D3D11CommandRecordingBackend::D3D11CommandRecordingBackend(ID3D11Device* device, ID3D11DeviceContext* immediate)
+{
+	this->device = device;
+	this->immediate = immediate;
+	deferredFailed = false;
+
+	D3D11_FEATURE_DATA_THREADING threading = {};
+	driverCommandLists = SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading, sizeof(threading)))
+		&& threading.DriverCommandLists;
+}
+
+D3D11CommandRecordingBackend::~D3D11CommandRecordingBackend()
+{
+	for (size_t i = 0; i < commandLists.size(); i++)
+	{
+		if (commandLists[i]) { commandLists[i]->Release(); }
+	}
+	for (size_t i = 0; i < deferredContexts.size(); i++)
+	{
+		if (deferredContexts[i]) { deferredContexts[i]->Release(); }
+	}
+}
+
+// --------------------------------------------------------
+// Makes sure there's a deferred context for every job
+// --------------------------------------------------------
+bool D3D11CommandRecordingBackend::Reserve(int jobCount)
+{
+	if (deferredFailed)
+		return false;
+
+	while ((int)deferredContexts.size() < jobCount)
+	{
+		ID3D11DeviceContext* deferred = 0;
+		if (FAILED(device->CreateDeferredContext(0, &deferred)))
+		{
+			// Don't keep trying every frame
+			deferredFailed = true;
+			return false;
+		}
+		deferredContexts.push_back(deferred);
+		commandLists.push_back(0);
+	}
+	return true;
+}
+
+ID3D11DeviceContext* D3D11CommandRecordingBackend::BeginJob(int job)
+{
+	return deferredFailed ? immediate : deferredContexts[job];
+}
+
+void D3D11CommandRecordingBackend::EndJob(int job)
+{
+	if (deferredFailed)
+		return;
+
+	// FALSE: don't save the deferred context's state for the
+	// next list - every job sets up its own
+	if (commandLists[job]) { commandLists[job]->Release(); }
+	commandLists[job] = 0;
+	deferredContexts[job]->FinishCommandList(FALSE, &commandLists[job]);
+}
+
+void D3D11CommandRecordingBackend::ExecuteJob(int job)
+{
+	if (deferredFailed || !commandLists[job])
+		return;
+
+	// FALSE: leave the immediate context cleared afterwards
+	// rather than paying to save and restore its state
+	immediate->ExecuteCommandList(commandLists[job], FALSE);
+	commandLists[job]->Release();
+	commandLists[job] = 0;
+}
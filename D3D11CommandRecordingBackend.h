@@ -0,0 +1,43 @@
+#pragma once
+
+#include <d3d11.h>
+#include <vector>
+
+#include "CommandRecorder.h"
+
+// --------------------------------------------------------
+// Records each job on its own deferred context into a command
+// list, and executes the lists on the immediate context.
+//
+// Executing a list clears the immediate context's state, so
+// anything that tracks what's bound there (the pipeline state
+// cache) has to be invalidated after CommandRecorder::Execute().
+//
+// If deferred contexts can't be created (e.g. a single
+// threaded device) jobs just record on the immediate context.
+// --------------------------------------------------------
+class D3D11CommandRecordingBackend : public CommandRecordingBackend
+{
+public:
+	D3D11CommandRecordingBackend(ID3D11Device* device, ID3D11DeviceContext* immediate);
+	~D3D11CommandRecordingBackend();
+
+	bool Reserve(int jobCount);
+	ID3D11DeviceContext* BeginJob(int job);
+	void EndJob(int job);
+	void ExecuteJob(int job);
+
+	// Whether the driver records command lists itself (otherwise
+	// the runtime emulates them, still saving the calls' cost)
+	bool HasDriverCommandLists() { return driverCommandLists; }
+
+private:
+	ID3D11Device* device;
+	ID3D11DeviceContext* immediate;
+	bool deferredFailed;
+	bool driverCommandLists;
+
+	// Grown as needed, one per job
+	std::vector<ID3D11DeviceContext*> deferredContexts;
+	std::vector<ID3D11CommandList*> commandLists;
+};
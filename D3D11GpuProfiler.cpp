@@ -0,0 +1,184 @@
+#include "D3D11GpuProfiler.h"
+
+// --------------------------------------------------------
+// Creates every frame's queries up front.  A frame whose
+// queries can't all be created is never timed.
+// --------------------------------------------------------
+D3D11GpuProfiler::D3D11GpuProfiler(ID3D11Device* device, ID3D11DeviceContext* context)
+{
+	this->context = context;
+	current = 0;
+	depth = 0;
+
+	D3D11_QUERY_DESC disjointDesc = {};
+	disjointDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+	D3D11_QUERY_DESC timestampDesc = {};
+	timestampDesc.Query = D3D11_QUERY_TIMESTAMP;
+
+	for (int f = 0; f < FrameCount; f++)
+	{
+		Frame& frame = frames[f];
+		frame.Disjoint = 0;
+		frame.Begin = 0;
+		frame.End = 0;
+		frame.ScopeCount = 0;
+		frame.Index = 0;
+		frame.IssuedMs = 0;
+		frame.Pending = false;
+		for (int s = 0; s < MaxScopes; s++)
+		{
+			frame.Scopes[s].Name = 0;
+			frame.Scopes[s].Depth = 0;
+			frame.Scopes[s].Begin = 0;
+			frame.Scopes[s].End = 0;
+		}
+
+#if PROFILER_ENABLED
+		device->CreateQuery(&disjointDesc, &frame.Disjoint);
+		device->CreateQuery(&timestampDesc, &frame.Begin);
+		device->CreateQuery(&timestampDesc, &frame.End);
+		for (int s = 0; s < MaxScopes; s++)
+		{
+			device->CreateQuery(&timestampDesc, &frame.Scopes[s].Begin);
+			device->CreateQuery(&timestampDesc, &frame.Scopes[s].End);
+		}
+#endif
+	}
+}
+
+D3D11GpuProfiler::~D3D11GpuProfiler()
+{
+	for (int f = 0; f < FrameCount; f++)
+	{
+		Frame& frame = frames[f];
+		if (frame.Disjoint) { frame.Disjoint->Release(); }
+		if (frame.Begin) { frame.Begin->Release(); }
+		if (frame.End) { frame.End->Release(); }
+		for (int s = 0; s < MaxScopes; s++)
+		{
+			if (frame.Scopes[s].Begin) { frame.Scopes[s].Begin->Release(); }
+			if (frame.Scopes[s].End) { frame.Scopes[s].End->Release(); }
+		}
+	}
+}
+
+// --------------------------------------------------------
+// Hands finished frames to the Profiler, then starts timing
+// this one (if its slot's queries are free)
+// --------------------------------------------------------
+void D3D11GpuProfiler::BeginFrame()
+{
+	Collect();
+
+	current = 0;
+	depth = 0;
+	if (!Profiler::IsEnabled())
+		return;
+
+	unsigned long long index = Profiler::GetFrameIndex();
+	Frame& frame = frames[index % FrameCount];
+	if (frame.Pending || !frame.Disjoint || !frame.Begin || !frame.End)
+		return;
+
+	current = &frame;
+	frame.Index = index;
+	frame.ScopeCount = 0;
+	frame.IssuedMs = Profiler::GetTimeMs();
+	context->Begin(frame.Disjoint);
+	context->End(frame.Begin);
+}
+
+void D3D11GpuProfiler::EndFrame()
+{
+	if (!current)
+		return;
+
+	// Anything left open ends with the frame
+	while (depth > 0)
+		EndScope();
+
+	context->End(current->End);
+	context->End(current->Disjoint);
+	current->Pending = true;
+	current = 0;
+}
+
+void D3D11GpuProfiler::BeginScope(const char* name)
+{
+	if (!current)
+		return;
+
+	// Past the limits the scope isn't timed, but still has to
+	// be matched by its EndScope()
+	int index = -1;
+	if (current->ScopeCount < MaxScopes && depth < MaxDepth)
+	{
+		Scope& scope = current->Scopes[current->ScopeCount];
+		if (scope.Begin && scope.End)
+		{
+			index = current->ScopeCount++;
+			scope.Name = name;
+			scope.Depth = depth;
+			context->End(scope.Begin);
+		}
+	}
+
+	if (depth < MaxDepth)
+		openScopes[depth] = index;
+	depth++;
+}
+
+void D3D11GpuProfiler::EndScope()
+{
+	if (!current || depth == 0)
+		return;
+
+	depth--;
+	if (depth < MaxDepth && openScopes[depth] >= 0)
+		context->End(current->Scopes[openScopes[depth]].End);
+}
+
+// --------------------------------------------------------
+// Reads back every frame the GPU has finished, without
+// flushing or waiting.  A disjoint frame (the GPU's clock
+// changed) is thrown away.
+// --------------------------------------------------------
+void D3D11GpuProfiler::Collect()
+{
+	for (int f = 0; f < FrameCount; f++)
+	{
+		Frame& frame = frames[f];
+		if (!frame.Pending)
+			continue;
+
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+		if (context->GetData(frame.Disjoint, &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+			continue;
+
+		// The disjoint query ends last, so everything in it is done
+		UINT64 begin = 0;
+		UINT64 end = 0;
+		bool valid = !disjoint.Disjoint && disjoint.Frequency > 0 &&
+			context->GetData(frame.Begin, &begin, sizeof(begin), 0) == S_OK &&
+			context->GetData(frame.End, &end, sizeof(end), 0) == S_OK;
+		frame.Pending = false;
+		if (!valid)
+			continue;
+
+		// Laid out from when the frame was issued
+		double tickMs = 1000.0 / (double)disjoint.Frequency;
+		for (int s = 0; s < frame.ScopeCount; s++)
+		{
+			UINT64 scopeBegin = 0;
+			UINT64 scopeEnd = 0;
+			if (context->GetData(frame.Scopes[s].Begin, &scopeBegin, sizeof(scopeBegin), 0) != S_OK ||
+				context->GetData(frame.Scopes[s].End, &scopeEnd, sizeof(scopeEnd), 0) != S_OK)
+				continue;
+
+			Profiler::AddGpuScope(frame.Index, frame.Scopes[s].Name, frame.Scopes[s].Depth,
+				frame.IssuedMs + (double)(scopeBegin - begin) * tickMs,
+				frame.IssuedMs + (double)(scopeEnd - begin) * tickMs);
+		}
+		Profiler::SetGpuFrame(frame.Index, frame.IssuedMs, frame.IssuedMs + (double)(end - begin) * tickMs);
+	}
+}
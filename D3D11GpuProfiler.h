@@ -0,0 +1,70 @@
+#pragma once
+
+#include <d3d11.h>
+
+#include "Profiler.h"
+
+// --------------------------------------------------------
+// Times scopes on the GPU with timestamp queries, inside a
+// disjoint query per frame, and hands the results to the
+// Profiler once the GPU has got to them (a few frames later -
+// it never waits).
+//
+// Everything goes on the immediate context, so scopes can
+// only wrap work that reaches it in order - e.g. around each
+// command list as it's executed (see
+// CommandRecorder::SetPlaybackHook).  If a frame's queries
+// are still in flight when their turn comes round again, or a
+// frame opens more than MaxScopes, the extra isn't timed.
+//
+// With PROFILER_ENABLED 0 this issues no queries.
+// --------------------------------------------------------
+class D3D11GpuProfiler
+{
+public:
+	D3D11GpuProfiler(ID3D11Device* device, ID3D11DeviceContext* context);
+	~D3D11GpuProfiler();
+
+	// Around everything the frame sends to the GPU.  The frame
+	// is Profiler::GetFrameIndex() at BeginFrame().
+	void BeginFrame();
+	void EndFrame();
+
+	// Name must outlive the Profiler's kept frames
+	void BeginScope(const char* name);
+	void EndScope();
+
+private:
+	static const int FrameCount = 8;		// Frames whose results can be outstanding
+	static const int MaxScopes = 32;		// Per frame
+	static const int MaxDepth = 8;
+
+	struct Scope
+	{
+		const char* Name;
+		int Depth;
+		ID3D11Query* Begin;
+		ID3D11Query* End;
+	};
+
+	struct Frame
+	{
+		ID3D11Query* Disjoint;
+		ID3D11Query* Begin;
+		ID3D11Query* End;
+		Scope Scopes[MaxScopes];
+		int ScopeCount;
+		unsigned long long Index;
+		double IssuedMs;		// When BeginFrame() ran, on the Profiler's clock
+		bool Pending;
+	};
+
+	ID3D11DeviceContext* context;
+	Frame frames[FrameCount];
+	Frame* current;			// Null if this frame isn't being timed
+
+	int openScopes[MaxDepth];
+	int depth;
+
+	void Collect();
+};
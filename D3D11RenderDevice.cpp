@@ -0,0 +1,568 @@
+#include "D3D11RenderDevice.h"
+
+#include <string.h>
+
+// --------------------------------------------------------
+// Context
+// --------------------------------------------------------
+D3D11RenderContext::D3D11RenderContext(D3D11RenderDevice* device, ID3D11DeviceContext* context)
+{
+	this->device = device;
+	this->context = context;
+}
+
+void D3D11RenderContext::SetPipeline(RenderPipelineHandle pipeline)
+{
+	D3D11RenderDevice::Entry* entry = device->Get(pipeline);
+	if (!entry)
+		return;
+
+	context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	context->IASetInputLayout(entry->InputLayout);
+	context->VSSetShader(entry->VertexShader, 0, 0);
+	context->PSSetShader(entry->PixelShader, 0, 0);
+	context->RSSetState(entry->Rasterizer);
+	context->OMSetDepthStencilState(entry->DepthStencil, 0);
+	context->OMSetBlendState(entry->Blend, 0, 0xFFFFFFFF);
+}
+
+void D3D11RenderContext::SetVertexBuffer(int slot, RenderBufferHandle buffer, unsigned int stride, unsigned int offset)
+{
+	ID3D11Buffer* vertexBuffer = device->GetBuffer(buffer);
+	context->IASetVertexBuffers(slot, 1, &vertexBuffer, &stride, &offset);
+}
+
+void D3D11RenderContext::SetIndexBuffer(RenderBufferHandle buffer)
+{
+	context->IASetIndexBuffer(device->GetBuffer(buffer), DXGI_FORMAT_R32_UINT, 0);
+}
+
+void D3D11RenderContext::SetConstantBuffer(RenderShaderStage stage, int slot, RenderBufferHandle buffer)
+{
+	ID3D11Buffer* constantBuffer = device->GetBuffer(buffer);
+	if (stage == RENDER_SHADER_VERTEX)
+		context->VSSetConstantBuffers(slot, 1, &constantBuffer);
+	else
+		context->PSSetConstantBuffers(slot, 1, &constantBuffer);
+}
+
+void D3D11RenderContext::SetTexture(RenderShaderStage stage, int slot, RenderTextureHandle texture)
+{
+	ID3D11ShaderResourceView* srv = device->GetShaderResourceView(texture);
+	if (stage == RENDER_SHADER_VERTEX)
+		context->VSSetShaderResources(slot, 1, &srv);
+	else
+		context->PSSetShaderResources(slot, 1, &srv);
+}
+
+void D3D11RenderContext::SetSampler(RenderShaderStage stage, int slot, RenderSamplerHandle sampler)
+{
+	ID3D11SamplerState* samplerState = device->GetSampler(sampler);
+	if (stage == RENDER_SHADER_VERTEX)
+		context->VSSetSamplers(slot, 1, &samplerState);
+	else
+		context->PSSetSamplers(slot, 1, &samplerState);
+}
+
+void D3D11RenderContext::UpdateBuffer(RenderBufferHandle buffer, const void* data, unsigned int size)
+{
+	D3D11RenderDevice::Entry* entry = device->Get(buffer);
+	if (!entry || !entry->Buffer)
+		return;
+
+	if (entry->Usage == RENDER_USAGE_DYNAMIC)
+	{
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		if (SUCCEEDED(context->Map(entry->Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+		{
+			memcpy(mapped.pData, data, size);
+			context->Unmap(entry->Buffer, 0);
+		}
+	}
+	else
+	{
+		context->UpdateSubresource(entry->Buffer, 0, 0, data, 0, 0);
+	}
+}
+
+void D3D11RenderContext::UpdateTexture(RenderTextureHandle texture, int slice, const void* data, unsigned int rowPitch)
+{
+	D3D11RenderDevice::Entry* entry = device->Get(texture);
+	if (!entry || !entry->Texture)
+		return;
+
+	D3D11_TEXTURE2D_DESC textureDesc;
+	entry->Texture->GetDesc(&textureDesc);
+	context->UpdateSubresource(entry->Texture, D3D11CalcSubresource(0, slice, textureDesc.MipLevels), 0, data, rowPitch, 0);
+}
+
+void D3D11RenderContext::SetRenderTargets(const RenderTextureHandle* colors, int colorCount, RenderTextureHandle depth, int depthSlice)
+{
+	ID3D11RenderTargetView* rtvs[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {};
+	int count = colorCount < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT ? colorCount : D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT;
+	for (int c = 0; c < count; c++)
+		rtvs[c] = device->GetRenderTargetView(colors[c]);
+	context->OMSetRenderTargets(count, rtvs, device->GetDepthStencilView(depth, depthSlice));
+}
+
+void D3D11RenderContext::SetViewport(float x, float y, float width, float height)
+{
+	D3D11_VIEWPORT viewport = {};
+	viewport.TopLeftX = x;
+	viewport.TopLeftY = y;
+	viewport.Width = width;
+	viewport.Height = height;
+	viewport.MinDepth = 0.0f;
+	viewport.MaxDepth = 1.0f;
+	context->RSSetViewports(1, &viewport);
+}
+
+void D3D11RenderContext::ClearRenderTarget(RenderTextureHandle texture, const float color[4])
+{
+	ID3D11RenderTargetView* rtv = device->GetRenderTargetView(texture);
+	if (rtv)
+		context->ClearRenderTargetView(rtv, color);
+}
+
+void D3D11RenderContext::ClearDepth(RenderTextureHandle texture, float depth, int slice)
+{
+	ID3D11DepthStencilView* dsv = device->GetDepthStencilView(texture, slice);
+	if (dsv)
+		context->ClearDepthStencilView(dsv, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, depth, 0);
+}
+
+void D3D11RenderContext::Draw(unsigned int vertexCount, unsigned int startVertex)
+{
+	context->Draw(vertexCount, startVertex);
+}
+
+void D3D11RenderContext::DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex)
+{
+	context->DrawIndexed(indexCount, startIndex, baseVertex);
+}
+
+// --------------------------------------------------------
+// Device
+// --------------------------------------------------------
+D3D11RenderDevice::D3D11RenderDevice(ID3D11Device* device, ID3D11DeviceContext* immediate)
+	: immediateContext(this, immediate)
+{
+	this->device = device;
+	chunks.reserve(MaxChunks);
+	nextHandle = 1;
+}
+
+D3D11RenderDevice::~D3D11RenderDevice()
+{
+	for (size_t c = 0; c < chunks.size(); c++)
+	{
+		for (unsigned int e = 0; e < ChunkSize; e++)
+			ReleaseEntry(chunks[c][e]);
+		delete[] chunks[c];
+	}
+}
+
+unsigned int D3D11RenderDevice::Add(Entry*& entry)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	entry = 0;
+	if (nextHandle >= ChunkSize * MaxChunks)
+		return 0;
+
+	unsigned int handle = nextHandle++;
+	if (handle / ChunkSize >= chunks.size())
+		chunks.push_back(new Entry[ChunkSize]());
+	entry = &chunks[handle / ChunkSize][handle % ChunkSize];
+	return handle;
+}
+
+D3D11RenderDevice::Entry* D3D11RenderDevice::Get(unsigned int handle)
+{
+	if (handle == 0 || handle >= ChunkSize * MaxChunks)
+		return 0;
+
+	// Only handles that have been handed out get here, and their
+	// chunk went in before they were
+	return &chunks[handle / ChunkSize][handle % ChunkSize];
+}
+
+void D3D11RenderDevice::Release(unsigned int handle)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	Entry* entry = Get(handle);
+	if (entry)
+		ReleaseEntry(*entry);
+}
+
+void D3D11RenderDevice::ReleaseEntry(Entry& entry)
+{
+	for (size_t s = 0; s < entry.DSVs.size(); s++)
+	{
+		if (entry.DSVs[s]) { entry.DSVs[s]->Release(); }
+	}
+	if (entry.Buffer) { entry.Buffer->Release(); }
+	if (entry.Texture) { entry.Texture->Release(); }
+	if (entry.SRV) { entry.SRV->Release(); }
+	if (entry.RTV) { entry.RTV->Release(); }
+	if (entry.VertexShader) { entry.VertexShader->Release(); }
+	if (entry.PixelShader) { entry.PixelShader->Release(); }
+	if (entry.InputLayout) { entry.InputLayout->Release(); }
+	if (entry.Rasterizer) { entry.Rasterizer->Release(); }
+	if (entry.DepthStencil) { entry.DepthStencil->Release(); }
+	if (entry.Blend) { entry.Blend->Release(); }
+	if (entry.Sampler) { entry.Sampler->Release(); }
+	entry = Entry();
+}
+
+RenderBufferHandle D3D11RenderDevice::CreateBuffer(const RenderBufferDesc& desc, const void* initialData)
+{
+	D3D11_BUFFER_DESC bufferDesc = {};
+	bufferDesc.ByteWidth = desc.ByteWidth;
+	switch (desc.Type)
+	{
+	case RENDER_BUFFER_VERTEX:		bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER; break;
+	case RENDER_BUFFER_INDEX:		bufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER; break;
+	case RENDER_BUFFER_CONSTANT:	bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; break;
+	case RENDER_BUFFER_STRUCTURED:
+		bufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+		bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+		bufferDesc.StructureByteStride = desc.Stride;
+		break;
+	}
+	switch (desc.Usage)
+	{
+	case RENDER_USAGE_IMMUTABLE:	bufferDesc.Usage = D3D11_USAGE_IMMUTABLE; break;
+	case RENDER_USAGE_DEFAULT:		bufferDesc.Usage = D3D11_USAGE_DEFAULT; break;
+	case RENDER_USAGE_DYNAMIC:
+		bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+		bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		break;
+	}
+
+	D3D11_SUBRESOURCE_DATA data = {};
+	data.pSysMem = initialData;
+
+	ID3D11Buffer* buffer = 0;
+	if (FAILED(device->CreateBuffer(&bufferDesc, initialData ? &data : 0, &buffer)))
+		return 0;
+
+	Entry* entry;
+	unsigned int handle = Add(entry);
+	if (!entry)
+	{
+		buffer->Release();
+		return 0;
+	}
+	entry->Buffer = buffer;
+	entry->Usage = desc.Usage;
+
+	// Structured buffers are bound like textures (SetTexture)
+	if (desc.Type == RENDER_BUFFER_STRUCTURED && desc.Stride)
+	{
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+		srvDesc.Buffer.NumElements = desc.ByteWidth / desc.Stride;
+		device->CreateShaderResourceView(buffer, &srvDesc, &entry->SRV);
+	}
+	return handle;
+}
+
+// --------------------------------------------------------
+// Formats for the texture itself, and for reading it (depth
+// textures are typeless so they can be read as well)
+// --------------------------------------------------------
+static void GetFormats(RenderFormat format, DXGI_FORMAT& textureFormat, DXGI_FORMAT& srvFormat, DXGI_FORMAT& dsvFormat)
+{
+	dsvFormat = DXGI_FORMAT_UNKNOWN;
+	switch (format)
+	{
+	case RENDER_FORMAT_RGBA16_FLOAT:	textureFormat = srvFormat = DXGI_FORMAT_R16G16B16A16_FLOAT; break;
+	case RENDER_FORMAT_RG16_FLOAT:		textureFormat = srvFormat = DXGI_FORMAT_R16G16_FLOAT; break;
+	case RENDER_FORMAT_R32_FLOAT:		textureFormat = srvFormat = DXGI_FORMAT_R32_FLOAT; break;
+	case RENDER_FORMAT_DEPTH32:
+		textureFormat = DXGI_FORMAT_R32_TYPELESS;
+		srvFormat = DXGI_FORMAT_R32_FLOAT;
+		dsvFormat = DXGI_FORMAT_D32_FLOAT;
+		break;
+	case RENDER_FORMAT_DEPTH24_STENCIL8:
+		textureFormat = DXGI_FORMAT_R24G8_TYPELESS;
+		srvFormat = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
+		dsvFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
+		break;
+	default:							textureFormat = srvFormat = DXGI_FORMAT_R8G8B8A8_UNORM; break;
+	}
+}
+
+RenderTextureHandle D3D11RenderDevice::CreateTexture(const RenderTextureDesc& desc)
+{
+	DXGI_FORMAT textureFormat, srvFormat, dsvFormat;
+	GetFormats(desc.Format, textureFormat, srvFormat, dsvFormat);
+
+	D3D11_TEXTURE2D_DESC textureDesc = {};
+	textureDesc.Width = desc.Width;
+	textureDesc.Height = desc.Height;
+	textureDesc.ArraySize = desc.ArraySize > 0 ? desc.ArraySize : 1;
+	textureDesc.MipLevels = desc.MipLevels > 0 ? desc.MipLevels : 1;
+	textureDesc.Format = textureFormat;
+	textureDesc.SampleDesc.Count = 1;
+	textureDesc.Usage = D3D11_USAGE_DEFAULT;
+	textureDesc.MiscFlags = desc.Cube ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
+	if (desc.BindFlags & RENDER_BIND_SHADER_RESOURCE) textureDesc.BindFlags |= D3D11_BIND_SHADER_RESOURCE;
+	if (desc.BindFlags & RENDER_BIND_RENDER_TARGET) textureDesc.BindFlags |= D3D11_BIND_RENDER_TARGET;
+	if (desc.BindFlags & RENDER_BIND_DEPTH_STENCIL) textureDesc.BindFlags |= D3D11_BIND_DEPTH_STENCIL;
+
+	ID3D11Texture2D* texture = 0;
+	if (FAILED(device->CreateTexture2D(&textureDesc, 0, &texture)))
+		return 0;
+
+	Entry* entry;
+	unsigned int handle = Add(entry);
+	if (!entry)
+	{
+		texture->Release();
+		return 0;
+	}
+	entry->Texture = texture;
+
+	bool isArray = textureDesc.ArraySize > 1;
+	if (desc.BindFlags & RENDER_BIND_SHADER_RESOURCE)
+	{
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = srvFormat;
+		if (desc.Cube)
+		{
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE;
+			srvDesc.TextureCube.MipLevels = textureDesc.MipLevels;
+		}
+		else if (isArray)
+		{
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+			srvDesc.Texture2DArray.MipLevels = textureDesc.MipLevels;
+			srvDesc.Texture2DArray.ArraySize = textureDesc.ArraySize;
+		}
+		else
+		{
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D.MipLevels = textureDesc.MipLevels;
+		}
+		device->CreateShaderResourceView(texture, &srvDesc, &entry->SRV);
+	}
+
+	if (desc.BindFlags & RENDER_BIND_RENDER_TARGET)
+		device->CreateRenderTargetView(texture, 0, &entry->RTV);
+
+	if (desc.BindFlags & RENDER_BIND_DEPTH_STENCIL)
+	{
+		for (UINT s = 0; s < textureDesc.ArraySize; s++)
+		{
+			D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+			dsvDesc.Format = dsvFormat;
+			if (isArray)
+			{
+				dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
+				dsvDesc.Texture2DArray.FirstArraySlice = s;
+				dsvDesc.Texture2DArray.ArraySize = 1;
+			}
+			else
+			{
+				dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
+			}
+
+			ID3D11DepthStencilView* dsv = 0;
+			device->CreateDepthStencilView(texture, &dsvDesc, &dsv);
+			entry->DSVs.push_back(dsv);
+		}
+	}
+
+	return handle;
+}
+
+RenderShaderHandle D3D11RenderDevice::CreateShader(RenderShaderStage stage, const char* name, const void* bytecode, size_t size)
+{
+	ID3D11VertexShader* vertexShader = 0;
+	ID3D11PixelShader* pixelShader = 0;
+	HRESULT hr = stage == RENDER_SHADER_VERTEX ?
+		device->CreateVertexShader(bytecode, size, 0, &vertexShader) :
+		device->CreatePixelShader(bytecode, size, 0, &pixelShader);
+	if (FAILED(hr))
+		return 0;
+
+	Entry* entry;
+	unsigned int handle = Add(entry);
+	if (!entry)
+	{
+		if (vertexShader) { vertexShader->Release(); }
+		if (pixelShader) { pixelShader->Release(); }
+		return 0;
+	}
+	entry->VertexShader = vertexShader;
+	entry->PixelShader = pixelShader;
+	if (vertexShader)
+		entry->Bytecode.assign((const char*)bytecode, (const char*)bytecode + size);
+	return handle;
+}
+
+RenderPipelineHandle D3D11RenderDevice::CreatePipeline(const RenderPipelineDesc& desc)
+{
+	Entry* vertexShader = Get(desc.VertexShader);
+	Entry* pixelShader = Get(desc.PixelShader);
+	if (!vertexShader || !vertexShader->VertexShader)
+		return 0;
+
+	// Slot 0 is a Vertex (Vertex.h) or just its positions
+	const D3D11_INPUT_ELEMENT_DESC vertexElements[] =
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+	};
+	UINT elementCount = desc.Layout == RENDER_LAYOUT_POSITION ? 1 : 3;
+
+	ID3D11InputLayout* inputLayout = 0;
+	if (FAILED(device->CreateInputLayout(vertexElements, elementCount, &vertexShader->Bytecode[0], vertexShader->Bytecode.size(), &inputLayout)))
+		return 0;
+
+	D3D11_RASTERIZER_DESC rasterizerDesc = {};
+	rasterizerDesc.FillMode = D3D11_FILL_SOLID;
+	rasterizerDesc.CullMode = desc.Cull == RENDER_CULL_NONE ? D3D11_CULL_NONE : desc.Cull == RENDER_CULL_FRONT ? D3D11_CULL_FRONT : D3D11_CULL_BACK;
+	rasterizerDesc.DepthClipEnable = TRUE;
+	rasterizerDesc.DepthBias = desc.DepthBias;
+	rasterizerDesc.SlopeScaledDepthBias = desc.SlopeScaledDepthBias;
+
+	const D3D11_COMPARISON_FUNC compares[] = { D3D11_COMPARISON_NEVER, D3D11_COMPARISON_LESS, D3D11_COMPARISON_LESS_EQUAL, D3D11_COMPARISON_ALWAYS };
+	D3D11_DEPTH_STENCIL_DESC depthDesc = {};
+	depthDesc.DepthEnable = desc.DepthTest;
+	depthDesc.DepthWriteMask = desc.DepthWrite ? D3D11_DEPTH_WRITE_MASK_ALL : D3D11_DEPTH_WRITE_MASK_ZERO;
+	depthDesc.DepthFunc = compares[desc.DepthFunc];
+
+	D3D11_BLEND_DESC blendDesc = {};
+	blendDesc.RenderTarget[0].BlendEnable = desc.AlphaBlend;
+	blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+	blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+	blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+	blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+	blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
+	blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+	blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
+	Entry states = Entry();
+	states.InputLayout = inputLayout;
+	device->CreateRasterizerState(&rasterizerDesc, &states.Rasterizer);
+	device->CreateDepthStencilState(&depthDesc, &states.DepthStencil);
+	device->CreateBlendState(&blendDesc, &states.Blend);
+	states.VertexShader = vertexShader->VertexShader;
+	states.VertexShader->AddRef();
+	states.PixelShader = pixelShader ? pixelShader->PixelShader : 0;
+	if (states.PixelShader)
+		states.PixelShader->AddRef();
+
+	Entry* entry;
+	unsigned int handle = Add(entry);
+	if (!entry)
+	{
+		ReleaseEntry(states);
+		return 0;
+	}
+	*entry = states;
+	return handle;
+}
+
+RenderSamplerHandle D3D11RenderDevice::CreateSampler(const RenderSamplerDesc& desc)
+{
+	const D3D11_TEXTURE_ADDRESS_MODE addresses[] = { D3D11_TEXTURE_ADDRESS_WRAP, D3D11_TEXTURE_ADDRESS_CLAMP, D3D11_TEXTURE_ADDRESS_BORDER };
+
+	D3D11_SAMPLER_DESC samplerDesc = {};
+	switch (desc.Filter)
+	{
+	case RENDER_FILTER_POINT:				samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT; break;
+	case RENDER_FILTER_ANISOTROPIC:			samplerDesc.Filter = D3D11_FILTER_ANISOTROPIC; break;
+	case RENDER_FILTER_COMPARISON_LINEAR:	samplerDesc.Filter = D3D11_FILTER_COMPARISON_MIN_MAG_MIP_LINEAR; break;
+	default:								samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR; break;
+	}
+	samplerDesc.AddressU = samplerDesc.AddressV = samplerDesc.AddressW = addresses[desc.Address];
+	samplerDesc.ComparisonFunc = desc.Filter == RENDER_FILTER_COMPARISON_LINEAR ? D3D11_COMPARISON_LESS : D3D11_COMPARISON_NEVER;
+	samplerDesc.MaxAnisotropy = desc.MaxAnisotropy > 0 ? desc.MaxAnisotropy : 1;
+	samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
+	memcpy(samplerDesc.BorderColor, desc.BorderColor, sizeof(samplerDesc.BorderColor));
+
+	ID3D11SamplerState* sampler = 0;
+	if (FAILED(device->CreateSamplerState(&samplerDesc, &sampler)))
+		return 0;
+
+	Entry* entry;
+	unsigned int handle = Add(entry);
+	if (!entry)
+	{
+		sampler->Release();
+		return 0;
+	}
+	entry->Sampler = sampler;
+	return handle;
+}
+
+RenderTextureHandle D3D11RenderDevice::WrapTexture(ID3D11ShaderResourceView* srv, ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv)
+{
+	Entry* entry;
+	unsigned int handle = Add(entry);
+	if (!entry)
+		return 0;
+
+	entry->SRV = srv;
+	entry->RTV = rtv;
+	if (srv) { srv->AddRef(); }
+	if (rtv) { rtv->AddRef(); }
+	if (dsv)
+	{
+		dsv->AddRef();
+		entry->DSVs.push_back(dsv);
+	}
+	return handle;
+}
+
+RenderBufferHandle D3D11RenderDevice::WrapBuffer(ID3D11Buffer* buffer)
+{
+	Entry* entry;
+	unsigned int handle = Add(entry);
+	if (!entry)
+		return 0;
+
+	D3D11_BUFFER_DESC desc;
+	buffer->GetDesc(&desc);
+	buffer->AddRef();
+	entry->Buffer = buffer;
+	entry->Usage = desc.Usage == D3D11_USAGE_DYNAMIC ? RENDER_USAGE_DYNAMIC : RENDER_USAGE_DEFAULT;
+	return handle;
+}
+
+ID3D11Buffer* D3D11RenderDevice::GetBuffer(RenderBufferHandle buffer)
+{
+	Entry* entry = Get(buffer);
+	return entry ? entry->Buffer : 0;
+}
+
+ID3D11ShaderResourceView* D3D11RenderDevice::GetShaderResourceView(RenderTextureHandle texture)
+{
+	Entry* entry = Get(texture);
+	return entry ? entry->SRV : 0;
+}
+
+ID3D11RenderTargetView* D3D11RenderDevice::GetRenderTargetView(RenderTextureHandle texture)
+{
+	Entry* entry = Get(texture);
+	return entry ? entry->RTV : 0;
+}
+
+ID3D11DepthStencilView* D3D11RenderDevice::GetDepthStencilView(RenderTextureHandle texture, int slice)
+{
+	Entry* entry = Get(texture);
+	if (!entry || slice < 0 || slice >= (int)entry->DSVs.size())
+		return 0;
+	return entry->DSVs[slice];
+}
+
+ID3D11SamplerState* D3D11RenderDevice::GetSampler(RenderSamplerHandle sampler)
+{
+	Entry* entry = Get(sampler);
+	return entry ? entry->Sampler : 0;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <d3d11.h>
+#include <mutex>
+#include <vector>
+
+#include "RenderDevice.h"
+
+class D3D11RenderDevice;
+
+// --------------------------------------------------------
+// Issues RenderContext calls to a D3D11 context - the
+// immediate one, or a job's deferred context.  Doesn't own
+// the context, so it's cheap to make one on the stack around
+// whatever context a job was handed.
+// --------------------------------------------------------
+class D3D11RenderContext : public RenderContext
+{
+public:
+	D3D11RenderContext(D3D11RenderDevice* device, ID3D11DeviceContext* context);
+
+	void SetPipeline(RenderPipelineHandle pipeline);
+	void SetVertexBuffer(int slot, RenderBufferHandle buffer, unsigned int stride, unsigned int offset);
+	void SetIndexBuffer(RenderBufferHandle buffer);
+	void SetConstantBuffer(RenderShaderStage stage, int slot, RenderBufferHandle buffer);
+	void SetTexture(RenderShaderStage stage, int slot, RenderTextureHandle texture);
+	void SetSampler(RenderShaderStage stage, int slot, RenderSamplerHandle sampler);
+	void UpdateBuffer(RenderBufferHandle buffer, const void* data, unsigned int size);
+	void UpdateTexture(RenderTextureHandle texture, int slice, const void* data, unsigned int rowPitch);
+	void SetRenderTargets(const RenderTextureHandle* colors, int colorCount, RenderTextureHandle depth, int depthSlice = 0);
+	void SetViewport(float x, float y, float width, float height);
+	void ClearRenderTarget(RenderTextureHandle texture, const float color[4]);
+	void ClearDepth(RenderTextureHandle texture, float depth, int slice = 0);
+	void Draw(unsigned int vertexCount, unsigned int startVertex);
+	void DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex);
+
+	ID3D11DeviceContext* GetContext() { return context; }
+
+private:
+	D3D11RenderDevice* device;
+	ID3D11DeviceContext* context;
+};
+
+// --------------------------------------------------------
+// RenderDevice on D3D11.  Handles index a table of the D3D
+// objects behind them.  The table grows in fixed chunks
+// whose list never reallocates, so contexts on other threads
+// can look handles up without a lock while resources are
+// being created.
+//
+// Code that still talks to D3D11 directly can wrap its
+// objects as handles (WrapTexture, WrapBuffer), or get the
+// objects behind a handle.
+// --------------------------------------------------------
+class D3D11RenderDevice : public RenderDevice
+{
+public:
+	D3D11RenderDevice(ID3D11Device* device, ID3D11DeviceContext* immediate);
+	~D3D11RenderDevice();
+
+	RenderBufferHandle CreateBuffer(const RenderBufferDesc& desc, const void* initialData);
+	RenderTextureHandle CreateTexture(const RenderTextureDesc& desc);
+	RenderShaderHandle CreateShader(RenderShaderStage stage, const char* name, const void* bytecode, size_t size);
+	RenderPipelineHandle CreatePipeline(const RenderPipelineDesc& desc);
+	RenderSamplerHandle CreateSampler(const RenderSamplerDesc& desc);
+
+	void ReleaseBuffer(RenderBufferHandle buffer) { Release(buffer); }
+	void ReleaseTexture(RenderTextureHandle texture) { Release(texture); }
+	void ReleaseShader(RenderShaderHandle shader) { Release(shader); }
+	void ReleasePipeline(RenderPipelineHandle pipeline) { Release(pipeline); }
+	void ReleaseSampler(RenderSamplerHandle sampler) { Release(sampler); }
+
+	RenderContext* GetImmediateContext() { return &immediateContext; }
+
+	// Existing objects as handles (they're AddRef'd)
+	RenderTextureHandle WrapTexture(ID3D11ShaderResourceView* srv, ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv);
+	RenderBufferHandle WrapBuffer(ID3D11Buffer* buffer);
+
+	// The objects behind handles (null if there's no such thing)
+	ID3D11Buffer* GetBuffer(RenderBufferHandle buffer);
+	ID3D11ShaderResourceView* GetShaderResourceView(RenderTextureHandle texture);
+	ID3D11RenderTargetView* GetRenderTargetView(RenderTextureHandle texture);
+	ID3D11DepthStencilView* GetDepthStencilView(RenderTextureHandle texture, int slice = 0);
+	ID3D11SamplerState* GetSampler(RenderSamplerHandle sampler);
+
+private:
+	friend class D3D11RenderContext;
+
+	struct Entry
+	{
+		// Buffers
+		ID3D11Buffer* Buffer;
+		RenderUsage Usage;
+
+		// Textures
+		ID3D11Texture2D* Texture;
+		ID3D11ShaderResourceView* SRV;
+		ID3D11RenderTargetView* RTV;
+		std::vector<ID3D11DepthStencilView*> DSVs;	// One per slice
+
+		// Shaders (vertex shaders keep their bytecode for input layouts)
+		ID3D11VertexShader* VertexShader;
+		ID3D11PixelShader* PixelShader;
+		std::vector<char> Bytecode;
+
+		// Pipelines (the shaders are the shader entries')
+		ID3D11InputLayout* InputLayout;
+		ID3D11RasterizerState* Rasterizer;
+		ID3D11DepthStencilState* DepthStencil;
+		ID3D11BlendState* Blend;
+
+		ID3D11SamplerState* Sampler;
+	};
+
+	static const unsigned int ChunkSize = 1024;
+	static const unsigned int MaxChunks = 256;
+
+	ID3D11Device* device;
+	D3D11RenderContext immediateContext;
+
+	std::mutex mutex;
+	std::vector<Entry*> chunks;		// Reserved up front - never reallocates
+	unsigned int nextHandle;
+
+	unsigned int Add(Entry*& entry);
+	Entry* Get(unsigned int handle);
+	void Release(unsigned int handle);
+	static void ReleaseEntry(Entry& entry);
+};
@@ -0,0 +1,345 @@
+#include "DDSFile.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// File layout structures (see "DDS" in the D3D docs)
+#define DDS_MAGIC					0x20534444 // "DDS "
+#define DDS_FOURCC					0x00000004
+#define DDS_RGB						0x00000040
+#define DDS_CUBEMAP_ALLFACES		0x0000FE00
+#define DDS_RESOURCE_MISC_TEXTURECUBE 0x4
+#define DDS_DIMENSION_TEXTURE2D		3
+
+#define DDS_HEADER_FLAGS_TEXTURE	0x00001007 // CAPS | HEIGHT | WIDTH | PIXELFORMAT
+#define DDS_HEADER_FLAGS_MIPMAP		0x00020000
+#define DDS_SURFACE_FLAGS_TEXTURE	0x00001000
+#define DDS_SURFACE_FLAGS_MIPMAP	0x00400008
+#define DDS_SURFACE_FLAGS_CUBEMAP	0x00000008
+
+// DXGI_FORMAT values we understand
+#define FORMAT_R32G32B32A32_FLOAT	2
+#define FORMAT_R16G16B16A16_FLOAT	10
+#define FORMAT_R8G8B8A8_UNORM		28
+#define FORMAT_B8G8R8A8_UNORM		87
+
+// Legacy D3DFORMAT FourCCs for float formats
+#define D3DFMT_A16B16G16R16F		113
+#define D3DFMT_A32B32G32R32F		116
+
+struct DDSPixelFormat
+{
+	uint32_t size;
+	uint32_t flags;
+	uint32_t fourCC;
+	uint32_t RGBBitCount;
+	uint32_t RBitMask;
+	uint32_t GBitMask;
+	uint32_t BBitMask;
+	uint32_t ABitMask;
+};
+
+struct DDSHeader
+{
+	uint32_t size;
+	uint32_t flags;
+	uint32_t height;
+	uint32_t width;
+	uint32_t pitchOrLinearSize;
+	uint32_t depth;
+	uint32_t mipMapCount;
+	uint32_t reserved1[11];
+	DDSPixelFormat ddspf;
+	uint32_t caps;
+	uint32_t caps2;
+	uint32_t caps3;
+	uint32_t caps4;
+	uint32_t reserved2;
+};
+
+struct DDSHeaderDX10
+{
+	uint32_t dxgiFormat;
+	uint32_t resourceDimension;
+	uint32_t miscFlag;
+	uint32_t arraySize;
+	uint32_t miscFlags2;
+};
+
+static FILE* OpenFile(const char* path, const char* mode)
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, mode);
+#else
+	file = fopen(path, mode);
+#endif
+	return file;
+}
+
+static bool ReadAll(const char* path, std::vector<unsigned char>& data)
+{
+	FILE* file = OpenFile(path, "rb");
+	if (!file)
+		return false;
+
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	data.resize(size > 0 ? size : 0);
+	bool ok = size > 0 && fread(&data[0], 1, size, file) == (size_t)size;
+	fclose(file);
+	return ok;
+}
+
+// --------------------------------------------------------
+// Loads an uncompressed cubemap, including any mips
+//
+// Returns false for anything that isn't a cubemap in one of
+// the supported formats
+// --------------------------------------------------------
+bool DDSFile::LoadCubemap(const char* path, CubemapImage& image)
+{
+	std::vector<unsigned char> file;
+	if (!ReadAll(path, file) || file.size() < 4 + sizeof(DDSHeader))
+		return false;
+
+	uint32_t magic;
+	DDSHeader header;
+	memcpy(&magic, &file[0], 4);
+	memcpy(&header, &file[4], sizeof(DDSHeader));
+	if (magic != DDS_MAGIC || header.size != sizeof(DDSHeader) || header.width != header.height)
+		return false;
+
+	size_t offset = 4 + sizeof(DDSHeader);
+	bool isCube = (header.caps2 & DDS_CUBEMAP_ALLFACES) == DDS_CUBEMAP_ALLFACES;
+
+	// Work out the texel format
+	uint32_t format = 0;
+	if ((header.ddspf.flags & DDS_FOURCC) && header.ddspf.fourCC == 0x30315844) // "DX10"
+	{
+		if (file.size() < offset + sizeof(DDSHeaderDX10))
+			return false;
+
+		DDSHeaderDX10 dx10;
+		memcpy(&dx10, &file[offset], sizeof(DDSHeaderDX10));
+		offset += sizeof(DDSHeaderDX10);
+
+		format = dx10.dxgiFormat;
+		isCube = (dx10.miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE) && dx10.arraySize == 1;
+	}
+	else if (header.ddspf.flags & DDS_FOURCC)
+	{
+		if (header.ddspf.fourCC == D3DFMT_A16B16G16R16F) format = FORMAT_R16G16B16A16_FLOAT;
+		if (header.ddspf.fourCC == D3DFMT_A32B32G32R32F) format = FORMAT_R32G32B32A32_FLOAT;
+	}
+	else if ((header.ddspf.flags & DDS_RGB) && header.ddspf.RGBBitCount == 32)
+	{
+		if (header.ddspf.RBitMask == 0x000000FF) format = FORMAT_R8G8B8A8_UNORM;
+		if (header.ddspf.RBitMask == 0x00FF0000) format = FORMAT_B8G8R8A8_UNORM;
+	}
+
+	size_t texelSize;
+	switch (format)
+	{
+	case FORMAT_R32G32B32A32_FLOAT:	texelSize = 16; break;
+	case FORMAT_R16G16B16A16_FLOAT:	texelSize = 8; break;
+	case FORMAT_R8G8B8A8_UNORM:
+	case FORMAT_B8G8R8A8_UNORM:		texelSize = 4; break;
+	default: return false;
+	}
+	if (!isCube)
+		return false;
+
+	int mipCount = (header.flags & DDS_HEADER_FLAGS_MIPMAP) && header.mipMapCount > 0 ? header.mipMapCount : 1;
+	image.Create(header.width, mipCount);
+	mipCount = image.GetMipCount();
+
+	// Stored face by face, each with its whole mip chain
+	for (int face = 0; face < 6; face++)
+	{
+		for (int mip = 0; mip < mipCount; mip++)
+		{
+			int mipSize = image.GetMipSize(mip);
+			size_t texels = (size_t)mipSize * mipSize;
+			if (offset + texels * texelSize > file.size())
+				return false;
+
+			const unsigned char* src = &file[offset];
+			float* dst = image.GetFace(face, mip);
+			for (size_t i = 0; i < texels; i++)
+			{
+				switch (format)
+				{
+				case FORMAT_R32G32B32A32_FLOAT:
+					memcpy(dst + i * 4, src + i * 16, 16);
+					break;
+				case FORMAT_R16G16B16A16_FLOAT:
+					for (int c = 0; c < 4; c++)
+					{
+						uint16_t half;
+						memcpy(&half, src + i * 8 + c * 2, 2);
+						dst[i * 4 + c] = HalfToFloat(half);
+					}
+					break;
+				case FORMAT_R8G8B8A8_UNORM:
+					for (int c = 0; c < 4; c++)
+						dst[i * 4 + c] = src[i * 4 + c] / 255.0f;
+					break;
+				case FORMAT_B8G8R8A8_UNORM:
+					dst[i * 4 + 0] = src[i * 4 + 2] / 255.0f;
+					dst[i * 4 + 1] = src[i * 4 + 1] / 255.0f;
+					dst[i * 4 + 2] = src[i * 4 + 0] / 255.0f;
+					dst[i * 4 + 3] = src[i * 4 + 3] / 255.0f;
+					break;
+				}
+			}
+			offset += texels * texelSize;
+		}
+	}
+
+	return true;
+}
+
+// --------------------------------------------------------
+// Writes a cubemap (with all of its mips) as half floats
+// --------------------------------------------------------
+bool DDSFile::SaveCubemap(const char* path, const CubemapImage& image)
+{
+	FILE* file = OpenFile(path, "wb");
+	if (!file)
+		return false;
+
+	DDSHeader header;
+	memset(&header, 0, sizeof(header));
+	header.size = sizeof(DDSHeader);
+	header.flags = DDS_HEADER_FLAGS_TEXTURE | DDS_HEADER_FLAGS_MIPMAP;
+	header.width = image.GetSize();
+	header.height = image.GetSize();
+	header.mipMapCount = image.GetMipCount();
+	header.ddspf.size = sizeof(DDSPixelFormat);
+	header.ddspf.flags = DDS_FOURCC;
+	header.ddspf.fourCC = 0x30315844; // "DX10"
+	header.caps = DDS_SURFACE_FLAGS_TEXTURE | DDS_SURFACE_FLAGS_MIPMAP | DDS_SURFACE_FLAGS_CUBEMAP;
+	header.caps2 = DDS_CUBEMAP_ALLFACES;
+
+	DDSHeaderDX10 dx10;
+	memset(&dx10, 0, sizeof(dx10));
+	dx10.dxgiFormat = FORMAT_R16G16B16A16_FLOAT;
+	dx10.resourceDimension = DDS_DIMENSION_TEXTURE2D;
+	dx10.miscFlag = DDS_RESOURCE_MISC_TEXTURECUBE;
+	dx10.arraySize = 1;
+
+	uint32_t magic = DDS_MAGIC;
+	bool ok =
+		fwrite(&magic, 4, 1, file) == 1 &&
+		fwrite(&header, sizeof(header), 1, file) == 1 &&
+		fwrite(&dx10, sizeof(dx10), 1, file) == 1;
+
+	std::vector<uint16_t> halves;
+	for (int face = 0; ok && face < 6; face++)
+	{
+		for (int mip = 0; ok && mip < image.GetMipCount(); mip++)
+		{
+			int mipSize = image.GetMipSize(mip);
+			const float* texels = image.GetFace(face, mip);
+			halves.resize(mipSize * mipSize * 4);
+			for (size_t i = 0; i < halves.size(); i++)
+				halves[i] = FloatToHalf(texels[i]);
+
+			ok = fwrite(&halves[0], sizeof(uint16_t), halves.size(), file) == halves.size();
+		}
+	}
+
+	fclose(file);
+	return ok;
+}
+
+uint16_t DDSFile::FloatToHalf(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, 4);
+
+	uint32_t sign = (bits >> 16) & 0x8000;
+	int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+	uint32_t mantissa = bits & 0x007FFFFF;
+
+	if (((bits >> 23) & 0xFF) == 0xFF)	// Inf / NaN
+		return (uint16_t)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+	if (exponent >= 31)					// Too big - clamp to infinity
+		return (uint16_t)(sign | 0x7C00);
+
+	if (exponent <= 0)
+	{
+		// Denormal (or zero)
+		if (exponent < -10)
+			return (uint16_t)sign;
+		mantissa |= 0x00800000;
+		uint32_t shift = (uint32_t)(14 - exponent);
+		uint32_t half = mantissa >> shift;
+		uint32_t remainder = mantissa & ((1u << shift) - 1);
+		uint32_t halfway = 1u << (shift - 1);
+		if (remainder > halfway || (remainder == halfway && (half & 1)))
+			half++;
+		return (uint16_t)(sign | half);
+	}
+
+	uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+	uint32_t remainder = mantissa & 0x1FFF;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+		half++;	// May carry into the exponent, which is still correct
+	return (uint16_t)(sign | half);
+}
+
+float DDSFile::HalfToFloat(uint16_t value)
+{
+	uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+	uint32_t exponent = (value >> 10) & 0x1F;
+	uint32_t mantissa = value & 0x3FF;
+	uint32_t bits;
+
+	if (exponent == 0)
+	{
+		if (mantissa == 0)
+			bits = sign;
+		else
+		{
+			// Denormal - normalize it
+			exponent = 127 - 15 + 1;
+			while (!(mantissa & 0x400))
+			{
+				mantissa <<= 1;
+				exponent--;
+			}
+			bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+		}
+	}
+	else if (exponent == 31)
+		bits = sign | 0x7F800000 | (mantissa << 13);
+	else
+		bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+
+	float result;
+	memcpy(&result, &bits, 4);
+	return result;
+}
+
+uint64_t DDSFile::Hash(const void* data, size_t size, uint64_t hash)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+uint64_t DDSFile::HashFile(const char* path)
+{
+	std::vector<unsigned char> data;
+	if (!ReadAll(path, data))
+		return 0;
+	return Hash(&data[0], data.size());
+}
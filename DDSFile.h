@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "CubemapImage.h"
+
+// --------------------------------------------------------
+// Minimal DDS reading and writing for the IBL data, without
+// D3D (the runtime loads the results with DDSTextureLoader).
+//
+// Reads uncompressed cubemaps: 8-bit RGBA/BGRA and 16/32-bit
+// float RGBA, legacy or DX10 headers, with or without mips.
+// Writes cubemaps as R16G16B16A16_FLOAT.
+// --------------------------------------------------------
+class DDSFile
+{
+public:
+	static bool LoadCubemap(const char* path, CubemapImage& image);
+	static bool SaveCubemap(const char* path, const CubemapImage& image);
+
+	// Half precision conversions (round to nearest even)
+	static uint16_t FloatToHalf(float value);
+	static float HalfToFloat(uint16_t value);
+
+	// FNV-1a over a whole file, 0 if it can't be read
+	static uint64_t HashFile(const char* path);
+	static uint64_t Hash(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL);
+};
@@ -50,6 +50,13 @@ DXCore::DXCore(
 	// Initialize fields
 	fpsFrameCount = 0;
 	fpsTimeElapsed = 0.0f;
+	targetFps = 60.0;
+	backgroundFps = 15.0;
+	fixedTimeStep = 0;
+	fixedSteps = 0;
+	for (int i = 0; i < FrameQueryCount; i++)
+		frameQueries[i] = 0;
+	gpuProfiler = 0;
 	
 	device = 0;
 	context = 0;
@@ -69,6 +76,11 @@ DXCore::DXCore(
 DXCore::~DXCore()
 {
 	// Release all DirectX resources
+	delete gpuProfiler;
+	for (int i = 0; i < FrameQueryCount; i++)
+	{
+		if (frameQueries[i]) { frameQueries[i]->Release(); }
+	}
 	if (depthStencilView) { depthStencilView->Release(); }
 	if (backBufferRTV) { backBufferRTV->Release();}
 
@@ -353,36 +365,121 @@ HRESULT DXCore::Run()
 	// Give subclass a chance to initialize
 	Init();
 
+	// Sleep() is only as precise as the system timer, which is
+	// ~15ms by default - the pacer needs 1ms
+	timeBeginPeriod(1);
+	CreateFrameQueries();
+	framePacer.SetTargetFps(targetFps);
+	Profiler::SetThreadName("Main");
+#if PROFILER_ENABLED
+	gpuProfiler = new D3D11GpuProfiler(device, context);
+#endif
+
 	// Our overall game and message loop
 	MSG msg = {};
 	while (msg.message != WM_QUIT)
 	{
-		// Determine if there is a message waiting
-		if (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+		// Wait for this frame's turn, then handle everything
+		// that came in meanwhile - as late as possible, so
+		// input is fresh when the frame is simulated
 		{
-			// Translate and dispatch the message
-			// to our custom WindowProc function
-			TranslateMessage(&msg);
-			DispatchMessage(&msg);
+			PROFILE_SCOPE("Wait");
+			framePacer.BeginFrame();
 		}
-		else
 		{
-			// Update timer and title bar (if necessary)
-			UpdateTimer();
-			if(titleBarStats)
-				UpdateTitleBarStats();
+			PROFILE_SCOPE("Input");
+			while (msg.message != WM_QUIT && PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+			{
+				// Translate and dispatch the message
+				// to our custom WindowProc function
+				TranslateMessage(&msg);
+				DispatchMessage(&msg);
+			}
+		}
+		if (msg.message == WM_QUIT)
+			break;
+		framePacer.MarkInputSampled();
 
-			// The game loop
+		// Update timer and title bar (if necessary)
+		UpdateTimer();
+		if(titleBarStats)
+			UpdateTitleBarStats();
+
+		// The game loop
+		{
+			PROFILE_SCOPE("Update");
 			Update(deltaTime, totalTime);
+		}
+		framePacer.MarkSimulated();
+		{
+			PROFILE_SCOPE("Draw");
+			if (gpuProfiler)
+				gpuProfiler->BeginFrame();
 			Draw(deltaTime, totalTime);
+			if (gpuProfiler)
+				gpuProfiler->EndFrame();
+		}
+
+		// Signalled when the GPU gets through this frame
+		ID3D11Query* query = frameQueries[framePacer.GetFrameIndex() % FrameQueryCount];
+		if (query)
+			context->End(query);
+		framePacer.EndFrame();
+		Profiler::EndFrame();
+	}
+
+	timeEndPeriod(1);
+
+#if defined(DEBUG) || defined(_DEBUG)
+	printf("\nFrame pacing: %.2fms average latency, %.2fms average wait, %u frames held back by the GPU\n",
+		framePacer.GetAverageLatencyMs(), framePacer.GetAverageWaitMs(), framePacer.GetFenceWaits());
+	framePacer.WriteChromeTrace("FrameTrace.json");
+
+	// The newest frame the GPU's timings came back for
+	for (unsigned long long frame = Profiler::GetFrameIndex(); frame-- > 0;)
+	{
+		const ProfileFrame* profile = Profiler::GetFrame(frame);
+		if (!profile)
+			break;
+		if (profile->GpuMs >= 0)
+		{
+			Profiler::PrintFrame(*profile);
+			break;
 		}
 	}
+	Profiler::WriteChromeTrace("ProfileTrace.json");
+#endif
 
 	// We'll end up here once we get a WM_QUIT message,
 	// which usually comes from the user closing the window
 	return msg.wParam;
 }
 
+// --------------------------------------------------------
+// Creates the event queries the frame pacer's fence polls.
+// A frame is done once its query has been signalled.
+// --------------------------------------------------------
+void DXCore::CreateFrameQueries()
+{
+	D3D11_QUERY_DESC queryDesc = {};
+	queryDesc.Query = D3D11_QUERY_EVENT;
+	for (int i = 0; i < FrameQueryCount; i++)
+	{
+		if (FAILED(device->CreateQuery(&queryDesc, &frameQueries[i])))
+			return;	// No fence - the pacer then only limits the rate
+	}
+
+	// There must be a query for every frame that can be in flight
+	if (framePacer.GetMaxFramesInFlight() > FrameQueryCount)
+		framePacer.SetMaxFramesInFlight(FrameQueryCount);
+
+	framePacer.SetFrameFence([this](unsigned long long frame)
+	{
+		BOOL done = FALSE;
+		return context->GetData(frameQueries[frame % FrameQueryCount], &done, sizeof(done), 0) == S_OK && done;
+	});
+}
+
 
 // --------------------------------------------------------
 // Sends an OS-level Quit message to our process, which
@@ -405,6 +502,14 @@ void DXCore::UpdateTimer()
 	QueryPerformanceCounter((LARGE_INTEGER*)&now);
 	currentTime = now;
 
+	if (fixedTimeStep > 0)
+	{
+		deltaTime = fixedTimeStep;
+		totalTime = (float)(fixedSteps++ * (double)fixedTimeStep);
+		previousTime = currentTime;
+		return;
+	}
+
 	// Calculate delta time and clamp to zero
 	//  - Could go negative if CPU goes into power save mode 
 	//    or the process itself gets moved to another core
@@ -444,7 +549,14 @@ void DXCore::UpdateTitleBarStats()
 		"    Width: "		<< width <<
 		"    Height: "		<< height <<
 		"    FPS: "			<< fpsFrameCount <<
-		"    Frame Time: "	<< mspf << "ms";
+		"    Frame Time: "	<< mspf << "ms" <<
+		"    Latency: "		<< framePacer.GetAverageLatencyMs() << "ms";
+
+	// Where the time went, from the profiler's last second or so
+	double cpuMs = 0;
+	double gpuMs = 0;
+	if (Profiler::GetAverageMs(fpsFrameCount, cpuMs, gpuMs) && gpuMs >= 0)
+		output << "    GPU: " << gpuMs << "ms";
 
 	// Append the version of DirectX the app is using
 	switch (dxFeatureLevel)
@@ -523,6 +635,11 @@ LRESULT DXCore::ProcessMessage(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lPara
 		PostQuitMessage(0); // Send a quit message to our own program
 		return 0;
 
+	// Slow down while in the background
+	case WM_ACTIVATEAPP:
+		framePacer.SetTargetFps(wParam ? targetFps : backgroundFps);
+		return 0;
+
 	// Prevent beeping when we "alt-enter"
 	case WM_MENUCHAR: 
 		return MAKELRESULT(0, MNC_CLOSE);
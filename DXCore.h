@@ -4,9 +4,13 @@
 #include <d3d11.h>
 #include <string>
 
+#include "FramePacer.h"
+#include "D3D11GpuProfiler.h"
+
 // We can include the correct library files here
 // instead of in Visual Studio settings if we want
 #pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "winmm.lib")	// timeBeginPeriod, for the frame pacer's sleeps
 
 class DXCore
 {
@@ -69,6 +73,22 @@ protected:
 	ID3D11RenderTargetView* backBufferRTV;
 	ID3D11DepthStencilView* depthStencilView;
 
+	// Holds each frame back to the target rate and keeps the
+	// GPU from queueing more than a couple of frames.  Game
+	// marks when its draw calls are submitted.
+	FramePacer framePacer;
+	double targetFps;		// While the window is active (0 = no limit)
+	double backgroundFps;	// While it isn't
+
+	// Seconds every frame is simulated as, whatever it really
+	// took - so a benchmark sees the same frames each run
+	// (0 = real time)
+	float fixedTimeStep;
+
+	// Times the frame's passes on the GPU (see Profiler for the
+	// CPU side).  Null until Run() starts the loop.
+	D3D11GpuProfiler* gpuProfiler;
+
 	// Helper function for allocating a console window
 	void CreateConsoleWindow(int bufferLines, int bufferColumns, int windowLines, int windowColumns);
 
@@ -80,10 +100,17 @@ private:
 	__int64 startTime;
 	__int64 currentTime;
 	__int64 previousTime;
+	unsigned long long fixedSteps;	// Frames simulated with fixedTimeStep
 
 	// FPS calculation
 	int fpsFrameCount;
 	float fpsTimeElapsed;
+
+	// One event query per frame in flight, so the pacer can
+	// tell when the GPU has finished a frame
+	static const int FrameQueryCount = 8;
+	ID3D11Query* frameQueries[FrameQueryCount];
+	void CreateFrameQueries();
 	
 	void UpdateTimer();			// Updates the timer for this frame
 	void UpdateTitleBarStats();	// Puts debug info in the title bar
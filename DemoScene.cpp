@@ -0,0 +1,626 @@
+#include "DemoScene.h"
+#include "Benchmark.h"
+#include "Profiler.h"
+#include "ShadowCascades.h"
+#include "SoftwareShaders.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static const float Pi = 3.1415926535f;
+static const int ShadowResolution = 1024;
+static const int AtlasSize = 1024;
+static const int SpotLightCount = 3;
+
+// --------------------------------------------------------
+// Matrices as XMMATRIX has them: row-major, row vectors
+// --------------------------------------------------------
+struct Matrix
+{
+	float m[16];
+};
+
+static Matrix Identity()
+{
+	Matrix result = {};
+	result.m[0] = result.m[5] = result.m[10] = result.m[15] = 1;
+	return result;
+}
+
+static Matrix Multiply(const Matrix& a, const Matrix& b)
+{
+	Matrix result;
+	for (int r = 0; r < 4; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			result.m[r * 4 + c] = 0;
+			for (int k = 0; k < 4; k++)
+				result.m[r * 4 + c] += a.m[r * 4 + k] * b.m[k * 4 + c];
+		}
+	}
+	return result;
+}
+
+// For HLSL
+static void StoreTransposed(const Matrix& matrix, float out[16])
+{
+	for (int r = 0; r < 4; r++)
+	{
+		for (int c = 0; c < 4; c++)
+			out[c * 4 + r] = matrix.m[r * 4 + c];
+	}
+}
+
+static Matrix Translation(float x, float y, float z)
+{
+	Matrix result = Identity();
+	result.m[12] = x;
+	result.m[13] = y;
+	result.m[14] = z;
+	return result;
+}
+
+static Matrix Scaling(float x, float y, float z)
+{
+	Matrix result = Identity();
+	result.m[0] = x;
+	result.m[5] = y;
+	result.m[10] = z;
+	return result;
+}
+
+static Matrix RotationY(float angle)
+{
+	Matrix result = Identity();
+	result.m[0] = cosf(angle);
+	result.m[2] = -sinf(angle);
+	result.m[8] = sinf(angle);
+	result.m[10] = cosf(angle);
+	return result;
+}
+
+static Matrix RotationZ(float angle)
+{
+	Matrix result = Identity();
+	result.m[0] = cosf(angle);
+	result.m[1] = sinf(angle);
+	result.m[4] = -sinf(angle);
+	result.m[5] = cosf(angle);
+	return result;
+}
+
+static void Normalize(float v[3])
+{
+	float length = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+	for (int axis = 0; axis < 3; axis++)
+		v[axis] /= length;
+}
+
+static void Cross(const float a[3], const float b[3], float result[3])
+{
+	result[0] = a[1] * b[2] - a[2] * b[1];
+	result[1] = a[2] * b[0] - a[0] * b[2];
+	result[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static Matrix LookToLH(const float eye[3], const float direction[3], const float up[3])
+{
+	float zAxis[3] = { direction[0], direction[1], direction[2] };
+	Normalize(zAxis);
+	float xAxis[3];
+	Cross(up, zAxis, xAxis);
+	Normalize(xAxis);
+	float yAxis[3];
+	Cross(zAxis, xAxis, yAxis);
+
+	Matrix result = Identity();
+	const float* axes[3] = { xAxis, yAxis, zAxis };
+	for (int a = 0; a < 3; a++)
+	{
+		for (int r = 0; r < 3; r++)
+			result.m[r * 4 + a] = axes[a][r];
+		result.m[12 + a] = -(axes[a][0] * eye[0] + axes[a][1] * eye[1] + axes[a][2] * eye[2]);
+	}
+	return result;
+}
+
+static Matrix PerspectiveFovLH(float fieldOfView, float aspectRatio, float nearClip, float farClip)
+{
+	float height = 1.0f / tanf(fieldOfView * 0.5f);
+	float range = farClip / (farClip - nearClip);
+	Matrix result = {};
+	result.m[0] = height / aspectRatio;
+	result.m[5] = height;
+	result.m[10] = range;
+	result.m[11] = 1;
+	result.m[14] = -range * nearClip;
+	return result;
+}
+
+// --------------------------------------------------------
+// The cube, read as Mesh reads OBJ files
+// --------------------------------------------------------
+static bool LoadObj(const char* path, std::vector<float>& vertices, std::vector<unsigned int>& indices)
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "r");
+#else
+	file = fopen(path, "r");
+#endif
+	if (!file)
+		return false;
+
+	std::vector<float> positions, normals, uvs;
+	char line[256];
+	while (fgets(line, sizeof(line), file))
+	{
+		float a, b, c;
+		unsigned int i[12];
+		if (line[0] == 'v' && line[1] == 'n' && sscanf(line, "vn %f %f %f", &a, &b, &c) == 3)
+		{
+			normals.push_back(a); normals.push_back(b); normals.push_back(c);
+		}
+		else if (line[0] == 'v' && line[1] == 't' && sscanf(line, "vt %f %f", &a, &b) == 2)
+		{
+			uvs.push_back(a); uvs.push_back(b);
+		}
+		else if (line[0] == 'v' && sscanf(line, "v %f %f %f", &a, &b, &c) == 3)
+		{
+			positions.push_back(a); positions.push_back(b); positions.push_back(c);
+		}
+		else if (line[0] == 'f')
+		{
+			int read = sscanf(line, "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u",
+				&i[0], &i[1], &i[2], &i[3], &i[4], &i[5], &i[6], &i[7], &i[8], &i[9], &i[10], &i[11]);
+			if (read < 9)
+				continue;
+
+			// Quads are split 1-2-3, 1-3-4; UVs are flipped
+			int corners[6] = { 0, 1, 2, 0, 2, 3 };
+			for (int c = 0; c < (read == 12 ? 6 : 3); c++)
+			{
+				const unsigned int* v = &i[corners[c] * 3];
+				vertices.insert(vertices.end(), &positions[(v[0] - 1) * 3], &positions[(v[0] - 1) * 3] + 3);
+				vertices.insert(vertices.end(), &normals[(v[2] - 1) * 3], &normals[(v[2] - 1) * 3] + 3);
+				vertices.push_back(uvs[(v[1] - 1) * 2]);
+				vertices.push_back(1.0f - uvs[(v[1] - 1) * 2 + 1]);
+				indices.push_back((unsigned int)indices.size());
+			}
+		}
+	}
+	fclose(file);
+	return !indices.empty();
+}
+
+DemoScene::DemoScene()
+{
+	device = 0;
+	width = height = 0;
+	stressEntities = 0;
+	indexCount = 0;
+	clusters = 0;
+}
+
+DemoScene::~DemoScene()
+{
+	delete clusters;
+}
+
+void DemoScene::SetParallelFor(const LightClusterGrid::ParallelFor& parallelFor)
+{
+	this->parallelFor = parallelFor;
+	if (clusters)
+		clusters->SetParallelFor(parallelFor);
+}
+
+void DemoScene::MakeTextures()
+{
+	RenderContext* context = device->GetImmediateContext();
+
+	// A two tone checker for the cubes
+	RenderTextureDesc diffuseDesc = { 64, 64, 1, 1, RENDER_FORMAT_RGBA8_UNORM, RENDER_BIND_SHADER_RESOURCE, false };
+	diffuseTexture = device->CreateTexture(diffuseDesc);
+	std::vector<unsigned char> checker(64 * 64 * 4);
+	for (int y = 0; y < 64; y++)
+	{
+		for (int x = 0; x < 64; x++)
+		{
+			bool light = ((x / 8) + (y / 8)) % 2 == 0;
+			unsigned char* texel = &checker[(y * 64 + x) * 4];
+			texel[0] = light ? 230 : 150;
+			texel[1] = light ? 220 : 110;
+			texel[2] = light ? 200 : 80;
+			texel[3] = 255;
+		}
+	}
+	context->UpdateTexture(diffuseTexture, 0, &checker[0], 64 * 4);
+
+	// A sky that goes from the horizon to the zenith, by face
+	// direction (+x, -x, +y, -y, +z, -z)
+	const int skySize = 32;
+	RenderTextureDesc skyDesc = { skySize, skySize, 6, 1, RENDER_FORMAT_RGBA8_UNORM, RENDER_BIND_SHADER_RESOURCE, true };
+	skyTexture = device->CreateTexture(skyDesc);
+	std::vector<unsigned char> face(skySize * skySize * 4);
+	for (int f = 0; f < 6; f++)
+	{
+		for (int y = 0; y < skySize; y++)
+		{
+			for (int x = 0; x < skySize; x++)
+			{
+				float s = (x + 0.5f) / skySize * 2 - 1;
+				float t = (y + 0.5f) / skySize * 2 - 1;
+				float direction[3];
+				switch (f)
+				{
+				case 0: direction[0] = 1; direction[1] = -t; direction[2] = -s; break;
+				case 1: direction[0] = -1; direction[1] = -t; direction[2] = s; break;
+				case 2: direction[0] = s; direction[1] = 1; direction[2] = t; break;
+				case 3: direction[0] = s; direction[1] = -1; direction[2] = -t; break;
+				case 4: direction[0] = s; direction[1] = -t; direction[2] = 1; break;
+				default: direction[0] = -s; direction[1] = -t; direction[2] = -1; break;
+				}
+				Normalize(direction);
+
+				float up = direction[1] > 0 ? direction[1] : 0;
+				unsigned char* texel = &face[(y * skySize + x) * 4];
+				texel[0] = (unsigned char)(255 * (0.85f - 0.6f * up));
+				texel[1] = (unsigned char)(255 * (0.80f - 0.4f * up));
+				texel[2] = (unsigned char)(255 * (0.75f + 0.2f * up));
+				texel[3] = 255;
+			}
+		}
+		context->UpdateTexture(skyTexture, f, &face[0], skySize * 4);
+	}
+}
+
+bool DemoScene::Create(RenderDevice* device, int width, int height, int lightsPerSide, int stressEntities)
+{
+	this->device = device;
+	this->width = width;
+	this->height = height;
+	this->stressEntities = stressEntities > 0 ? stressEntities : 0;
+	worlds.resize(GetEntityCount() * 16);
+
+	std::vector<float> vertices;
+	std::vector<unsigned int> indices;
+	if (!LoadObj("Debug/Assets/Models/cube.obj", vertices, indices))
+	{
+		printf("Can't read Debug/Assets/Models/cube.obj (run from the project directory)\n");
+		return false;
+	}
+	indexCount = (unsigned int)indices.size();
+
+	RenderBufferDesc vertexDesc = { RENDER_BUFFER_VERTEX, RENDER_USAGE_IMMUTABLE, (unsigned int)(vertices.size() * sizeof(float)), 0 };
+	RenderBufferDesc indexDesc = { RENDER_BUFFER_INDEX, RENDER_USAGE_IMMUTABLE, (unsigned int)(indices.size() * sizeof(unsigned int)), 0 };
+	vertexBuffer = device->CreateBuffer(vertexDesc, &vertices[0]);
+	indexBuffer = device->CreateBuffer(indexDesc, &indices[0]);
+
+	RenderBufferDesc constantDesc = { RENDER_BUFFER_CONSTANT, RENDER_USAGE_DYNAMIC, 0, 0 };
+	constantDesc.ByteWidth = sizeof(SoftwareObjectConstants);
+	objectConstants = device->CreateBuffer(constantDesc, 0);
+	constantDesc.ByteWidth = sizeof(SoftwareSkyConstants);
+	skyConstants = device->CreateBuffer(constantDesc, 0);
+	constantDesc.ByteWidth = sizeof(SoftwareLightConstants);
+	lightConstants = device->CreateBuffer(constantDesc, 0);
+	constantDesc.ByteWidth = sizeof(SoftwareShadowConstants);
+	shadowConstants = device->CreateBuffer(constantDesc, 0);
+	constantDesc.ByteWidth = sizeof(SoftwareSpotLightConstants);
+	spotConstants = device->CreateBuffer(constantDesc, 0);
+	constantDesc.ByteWidth = sizeof(SoftwareClusterConstants);
+	clusterConstants = device->CreateBuffer(constantDesc, 0);
+
+	RenderTextureDesc colorDesc = { width, height, 1, 1, RENDER_FORMAT_RGBA8_UNORM, RENDER_BIND_RENDER_TARGET, false };
+	RenderTextureDesc depthDesc = { width, height, 1, 1, RENDER_FORMAT_DEPTH32, RENDER_BIND_DEPTH_STENCIL, false };
+	RenderTextureDesc shadowDesc = { ShadowResolution, ShadowResolution, SHADOW_MAX_CASCADES, 1, RENDER_FORMAT_DEPTH32, RENDER_BIND_DEPTH_STENCIL | RENDER_BIND_SHADER_RESOURCE, false };
+	RenderTextureDesc atlasDesc = { AtlasSize, AtlasSize, 1, 1, RENDER_FORMAT_DEPTH32, RENDER_BIND_DEPTH_STENCIL | RENDER_BIND_SHADER_RESOURCE, false };
+	colorTarget = device->CreateTexture(colorDesc);
+	depthTarget = device->CreateTexture(depthDesc);
+	shadowMap = device->CreateTexture(shadowDesc);
+	spotAtlas = device->CreateTexture(atlasDesc);
+	MakeTextures();
+
+	vertexShader = device->CreateShader(RENDER_SHADER_VERTEX, "VertexShader", 0, 0);
+	pixelShader = device->CreateShader(RENDER_SHADER_PIXEL, "PixelShader", 0, 0);
+	shadowVS = device->CreateShader(RENDER_SHADER_VERTEX, "ShadowVS", 0, 0);
+	skyVS = device->CreateShader(RENDER_SHADER_VERTEX, "SkyVS", 0, 0);
+	skyPS = device->CreateShader(RENDER_SHADER_PIXEL, "SkyPS", 0, 0);
+
+	// Game's pipeline states
+	RenderPipelineDesc opaque = { vertexShader, pixelShader, RENDER_LAYOUT_VERTEX, RENDER_CULL_BACK, true, true, RENDER_COMPARE_LESS, 0, 0.0f, false };
+	RenderPipelineDesc shadow = { shadowVS, 0, RENDER_LAYOUT_VERTEX, RENDER_CULL_BACK, true, true, RENDER_COMPARE_LESS, 1000, 1.0f, false };
+	RenderPipelineDesc sky = { skyVS, skyPS, RENDER_LAYOUT_VERTEX, RENDER_CULL_FRONT, true, true, RENDER_COMPARE_LESS_EQUAL, 0, 0.0f, false };
+	opaquePipeline = device->CreatePipeline(opaque);
+	shadowPipeline = device->CreatePipeline(shadow);
+	skyPipeline = device->CreatePipeline(sky);
+
+	RenderSamplerDesc basic = { RENDER_FILTER_LINEAR, RENDER_ADDRESS_WRAP, { 0, 0, 0, 0 }, 1 };
+	RenderSamplerDesc shadowCompare = { RENDER_FILTER_COMPARISON_LINEAR, RENDER_ADDRESS_BORDER, { 1, 1, 1, 1 }, 1 };
+	basicSampler = device->CreateSampler(basic);
+	shadowSampler = device->CreateSampler(shadowCompare);
+
+	// Game's grid of little lights over the ground
+	lightsPerSide = lightsPerSide > 1 ? lightsPerSide : 2;
+	lights.resize(lightsPerSide * lightsPerSide);
+	lightOrigins.resize(lights.size() * 3);
+	memset(&lights[0], 0, lights.size() * sizeof(ClusterLight));
+	for (int i = 0; i < (int)lights.size(); i++)
+	{
+		int x = i % lightsPerSide;
+		int z = i / lightsPerSide;
+		lightOrigins[i * 3 + 0] = -9.0f + 18.0f * x / (lightsPerSide - 1);
+		lightOrigins[i * 3 + 1] = -0.8f;
+		lightOrigins[i * 3 + 2] = -9.0f + 18.0f * z / (lightsPerSide - 1);
+
+		ClusterLight& light = lights[i];
+		light.Range = 2.0f;
+		light.Color[0] = 0.3f + 0.7f * (x % 3 == 0);
+		light.Color[1] = 0.3f + 0.7f * (x % 3 == 1);
+		light.Color[2] = 0.3f + 0.7f * (z % 2 == 0);
+		light.CosOuterAngle = -1.0f;
+		if (i % 2)
+		{
+			light.Direction[1] = -1.0f;
+			light.CosOuterAngle = cosf(0.6f);
+			light.CosInnerAngle = cosf(0.4f);
+		}
+	}
+
+	LightClusterSettings clusterSettings = LightClusterSettings::Default();
+	clusters = new LightClusterGrid(clusterSettings);
+	if (parallelFor)
+		clusters->SetParallelFor(parallelFor);
+	RenderBufferDesc lightsDesc = { RENDER_BUFFER_STRUCTURED, RENDER_USAGE_DYNAMIC, (unsigned int)(lights.size() * sizeof(ClusterLight)), sizeof(ClusterLight) };
+	RenderBufferDesc rangesDesc = { RENDER_BUFFER_STRUCTURED, RENDER_USAGE_DYNAMIC, (unsigned int)(clusters->GetClusterCount() * sizeof(ClusterRange)), sizeof(ClusterRange) };
+	RenderBufferDesc indicesDesc = { RENDER_BUFFER_STRUCTURED, RENDER_USAGE_DYNAMIC, clusterSettings.MaxIndices * (unsigned int)sizeof(unsigned int), sizeof(unsigned int) };
+	clusterLights = device->CreateBuffer(lightsDesc, 0);
+	clusterRanges = device->CreateBuffer(rangesDesc, 0);
+	clusterIndices = device->CreateBuffer(indicesDesc, 0);
+	return true;
+}
+
+void DemoScene::DrawCubes(RenderContext* context, const float* view, const float* projection)
+{
+	SoftwareObjectConstants constants;
+	Matrix matrix;
+	memcpy(matrix.m, view, sizeof(matrix.m));
+	StoreTransposed(matrix, constants.View);
+	memcpy(matrix.m, projection, sizeof(matrix.m));
+	StoreTransposed(matrix, constants.Projection);
+	for (int e = 0; e < GetEntityCount(); e++)
+	{
+		memcpy(matrix.m, &worlds[e * 16], sizeof(matrix.m));
+		StoreTransposed(matrix, constants.World);
+		context->UpdateBuffer(objectConstants, &constants, sizeof(constants));
+		context->DrawIndexed(indexCount, 0, 0);
+	}
+}
+
+void DemoScene::EndPass()
+{
+	if (passEnd)
+		passEnd();
+}
+
+void DemoScene::Render(float totalTime, const CameraKey* camera)
+{
+	PROFILE_SCOPE("Demo scene");
+	RenderContext* context = device->GetImmediateContext();
+
+	// What the passes use, worked out in the update
+	float aspectRatio = (float)width / height;
+	Matrix view, projection;
+	ShadowCascade cascades[SHADOW_MAX_CASCADES];
+	int cascadeCount;
+	SoftwareSpotLightConstants spotData = {};
+	Matrix spotViews[SpotLightCount], spotProjections[SpotLightCount];
+	{
+		PROFILE_SCOPE("Update");
+
+		// Entities, as Game::Update moves them
+		float sinTime = (sinf(totalTime) + 2.0f) / 10.0f;
+		Matrix entityWorlds[3];
+		entityWorlds[0] = Multiply(Multiply(Scaling(sinTime, sinTime, sinTime), RotationZ(totalTime)), Translation(1.0f, 0.0f, 0.0f));
+		entityWorlds[1] = Translation(0.0f, sinTime, 0.0f);
+		entityWorlds[2] = Multiply(Scaling(10.0f, 0.2f, 10.0f), Translation(0.0f, -1.5f, 0.0f));
+		for (int e = 0; e < 3; e++)
+			memcpy(&worlds[e * 16], entityWorlds[e].m, sizeof(entityWorlds[e].m));
+
+		// Stress cubes, as Entity::Move builds them
+		std::function<void(int begin, int end)> moveStress = [this, totalTime](int begin, int end)
+		{
+			for (int s = begin; s < end; s++)
+			{
+				float position[3], rotation, scale;
+				GetStressEntityTransform(s, totalTime, position, rotation, scale);
+				Matrix world = Multiply(Multiply(Scaling(scale, scale, scale), RotationZ(rotation)), Translation(position[0], position[1], position[2]));
+				memcpy(&worlds[(3 + s) * 16], world.m, sizeof(world.m));
+			}
+		};
+		if (parallelFor)
+			parallelFor(stressEntities, moveStress);
+		else
+			moveStress(0, stressEntities);
+
+		// Camera's defaults, or its pose on the path (it turns
+		// (0, 0, 1) by pitch, then yaw)
+		float eye[3] = { 0, 0, -5 };
+		float forward[3] = { 0, 0, 1 };
+		const float up[3] = { 0, 1, 0 };
+		if (camera)
+		{
+			memcpy(eye, camera->Position, sizeof(eye));
+			forward[0] = sinf(camera->Yaw) * cosf(camera->Pitch);
+			forward[1] = -sinf(camera->Pitch);
+			forward[2] = cosf(camera->Yaw) * cosf(camera->Pitch);
+		}
+		view = LookToLH(eye, forward, up);
+		projection = PerspectiveFovLH(0.25f * Pi, aspectRatio, 0.1f, 100.0f);
+
+		// Lights
+		SoftwareLightConstants lightData = {};
+		const float ambient[4] = { 0.1f, 0.1f, 0.1f, 1.0f };
+		const float blue[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+		const float red[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+		const float lightDirection[3] = { 1.0f, -1.0f, 0.0f };
+		const float secondDirection[3] = { -1.0f, -1.0f, 0.0f };
+		memcpy(lightData.Light.AmbientColor, ambient, sizeof(ambient));
+		memcpy(lightData.Light.DiffuseColor, blue, sizeof(blue));
+		memcpy(lightData.Light.Direction, lightDirection, sizeof(lightDirection));
+		memcpy(lightData.NewLight.AmbientColor, ambient, sizeof(ambient));
+		memcpy(lightData.NewLight.DiffuseColor, red, sizeof(red));
+		memcpy(lightData.NewLight.Direction, secondDirection, sizeof(secondDirection));
+		context->UpdateBuffer(lightConstants, &lightData, sizeof(lightData));
+
+		// Cascades
+		ShadowCamera shadowCamera;
+		memcpy(shadowCamera.View, view.m, sizeof(view.m));
+		shadowCamera.FieldOfView = 0.25f * Pi;
+		shadowCamera.AspectRatio = aspectRatio;
+		shadowCamera.NearClip = 0.1f;
+		shadowCamera.FarClip = 100.0f;
+		ShadowCascadeSettings shadowSettings = ShadowCascadeSettings::Default();
+		shadowSettings.Resolution = ShadowResolution;
+		cascadeCount = ShadowCascades::Fit(shadowCamera, lightDirection, shadowSettings, cascades);
+
+		SoftwareShadowConstants shadowData = {};
+		for (int c = 0; c < cascadeCount; c++)
+		{
+			Matrix viewProjection;
+			memcpy(viewProjection.m, cascades[c].ViewProjection, sizeof(viewProjection.m));
+			StoreTransposed(viewProjection, shadowData.CascadeViewProjection[c]);
+			shadowData.CascadeSplits[c] = cascades[c].SplitFar;
+		}
+		shadowData.CascadeCount = cascadeCount;
+		context->UpdateBuffer(shadowConstants, &shadowData, sizeof(shadowData));
+
+		// Spot lights, a quarter of the atlas each
+		const float spotPositions[SpotLightCount][3] = { { -3.0f, 3.0f, -1.0f }, { 3.0f, 3.0f, -1.0f }, { 0.0f, 3.0f, 3.0f } };
+		const float spotColors[SpotLightCount][4] = { { 1.0f, 0.8f, 0.5f, 1.0f }, { 0.5f, 1.0f, 0.5f, 1.0f }, { 0.8f, 0.6f, 1.0f, 1.0f } };
+		for (int s = 0; s < SpotLightCount; s++)
+		{
+			SoftwareSpotLight& spot = spotData.SpotLights[s];
+			memcpy(spot.DiffuseColor, spotColors[s], sizeof(spot.DiffuseColor));
+			memcpy(spot.Position, spotPositions[s], sizeof(spot.Position));
+			spot.Range = 10.0f;
+			for (int axis = 0; axis < 3; axis++)
+				spot.Direction[axis] = -spotPositions[s][axis];
+			Normalize(spot.Direction);
+			spot.CosOuterAngle = cosf(0.35f);
+			spot.CosInnerAngle = cosf(0.25f);
+
+			const float spotUp[3] = { 0, 1, 0 };
+			spotViews[s] = LookToLH(spot.Position, spot.Direction, spotUp);
+			spotProjections[s] = PerspectiveFovLH(2.0f * acosf(spot.CosOuterAngle), 1.0f, 0.1f, spot.Range);
+			StoreTransposed(Multiply(spotViews[s], spotProjections[s]), spot.ViewProjection);
+			spot.AtlasRect[0] = (s % 2) * 0.5f;
+			spot.AtlasRect[1] = (s / 2) * 0.5f;
+			spot.AtlasRect[2] = spot.AtlasRect[3] = 0.5f;
+		}
+		spotData.SpotLightCount = SpotLightCount;
+		context->UpdateBuffer(spotConstants, &spotData, sizeof(spotData));
+
+		// Clustered lights bob up and down
+		PROFILE_SCOPE("Clustered lights");
+		for (size_t i = 0; i < lights.size(); i++)
+		{
+			const float* origin = &lightOrigins[i * 3];
+			lights[i].Position[0] = origin[0];
+			lights[i].Position[1] = origin[1] + 0.5f * (sinf(totalTime * 1.5f + origin[0] + origin[2]) + 1.0f);
+			lights[i].Position[2] = origin[2];
+		}
+		LightClusterCamera clusterCamera;
+		memcpy(clusterCamera.View, view.m, sizeof(view.m));
+		clusterCamera.FieldOfView = 0.25f * Pi;
+		clusterCamera.AspectRatio = aspectRatio;
+		clusters->SetCamera(clusterCamera);
+		clusters->Assign(&lights[0], (int)lights.size());
+		context->UpdateBuffer(clusterLights, &lights[0], (unsigned int)(lights.size() * sizeof(ClusterLight)));
+		context->UpdateBuffer(clusterRanges, &clusters->GetRanges()[0], (unsigned int)(clusters->GetRanges().size() * sizeof(ClusterRange)));
+		if (!clusters->GetIndices().empty())
+			context->UpdateBuffer(clusterIndices, &clusters->GetIndices()[0], (unsigned int)(clusters->GetIndices().size() * sizeof(unsigned int)));
+
+		const LightClusterSettings& clusterSettings = clusters->GetSettings();
+		SoftwareClusterConstants clusterData = {};
+		clusterData.ClusterCounts[0] = clusterSettings.TilesX;
+		clusterData.ClusterCounts[1] = clusterSettings.TilesY;
+		clusterData.ClusterCounts[2] = clusterSettings.Slices;
+		clusterData.ClusterTileSize[0] = (float)width / clusterSettings.TilesX;
+		clusterData.ClusterTileSize[1] = (float)height / clusterSettings.TilesY;
+		clusterData.ClusterSliceScale = clusters->GetSliceScale();
+		clusterData.ClusterSliceBias = clusters->GetSliceBias();
+		context->UpdateBuffer(clusterConstants, &clusterData, sizeof(clusterData));
+	}
+
+	context->SetVertexBuffer(0, vertexBuffer, 8 * sizeof(float), 0);
+	context->SetIndexBuffer(indexBuffer);
+	context->SetConstantBuffer(RENDER_SHADER_VERTEX, 0, objectConstants);
+
+	// Shadows: a slice per cascade, then the spot lights' tiles
+	{
+		PROFILE_SCOPE("Shadows");
+		context->SetPipeline(shadowPipeline);
+		for (int c = 0; c < cascadeCount; c++)
+		{
+			context->SetRenderTargets(0, 0, shadowMap, c);
+			context->SetViewport(0, 0, (float)ShadowResolution, (float)ShadowResolution);
+			context->ClearDepth(shadowMap, 1.0f, c);
+			DrawCubes(context, cascades[c].View, cascades[c].Projection);
+		}
+		EndPass();
+	}
+
+	{
+		PROFILE_SCOPE("Spot shadows");
+		context->SetRenderTargets(0, 0, spotAtlas);
+		context->ClearDepth(spotAtlas, 1.0f);
+		for (int s = 0; s < SpotLightCount; s++)
+		{
+			const float* rect = spotData.SpotLights[s].AtlasRect;
+			context->SetViewport(rect[0] * AtlasSize, rect[1] * AtlasSize, rect[2] * AtlasSize, rect[3] * AtlasSize);
+			DrawCubes(context, spotViews[s].m, spotProjections[s].m);
+		}
+		EndPass();
+	}
+
+	{
+		PROFILE_SCOPE("Main pass");
+		const float clearColor[4] = { 0.4f, 0.6f, 0.75f, 0.0f };
+		context->SetRenderTargets(&colorTarget, 1, depthTarget);
+		context->SetViewport(0, 0, (float)width, (float)height);
+		context->ClearRenderTarget(colorTarget, clearColor);
+		context->ClearDepth(depthTarget, 1.0f);
+
+		context->SetPipeline(opaquePipeline);
+		context->SetConstantBuffer(RENDER_SHADER_PIXEL, 0, lightConstants);
+		context->SetConstantBuffer(RENDER_SHADER_PIXEL, 3, shadowConstants);
+		context->SetConstantBuffer(RENDER_SHADER_PIXEL, 4, spotConstants);
+		context->SetConstantBuffer(RENDER_SHADER_PIXEL, 5, clusterConstants);
+		context->SetTexture(RENDER_SHADER_PIXEL, 1, diffuseTexture);
+		context->SetTexture(RENDER_SHADER_PIXEL, 2, shadowMap);
+		context->SetTexture(RENDER_SHADER_PIXEL, 4, spotAtlas);
+		context->SetTexture(RENDER_SHADER_PIXEL, 8, clusterLights);
+		context->SetTexture(RENDER_SHADER_PIXEL, 9, clusterRanges);
+		context->SetTexture(RENDER_SHADER_PIXEL, 10, clusterIndices);
+		context->SetSampler(RENDER_SHADER_PIXEL, 0, basicSampler);
+		context->SetSampler(RENDER_SHADER_PIXEL, 1, shadowSampler);
+		DrawCubes(context, view.m, projection.m);
+		EndPass();
+	}
+
+	// Sky, turning slowly
+	{
+		PROFILE_SCOPE("Sky");
+		SoftwareSkyConstants skyData;
+		StoreTransposed(Multiply(RotationY(totalTime * 0.05f), view), skyData.View);
+		StoreTransposed(projection, skyData.Projection);
+		context->UpdateBuffer(skyConstants, &skyData, sizeof(skyData));
+		context->SetPipeline(skyPipeline);
+		context->SetConstantBuffer(RENDER_SHADER_VERTEX, 0, skyConstants);
+		context->SetTexture(RENDER_SHADER_PIXEL, 0, skyTexture);
+		context->DrawIndexed(indexCount, 0, 0);
+		EndPass();
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "CameraPath.h"
+#include "LightClusterGrid.h"
+#include "RenderDevice.h"
+
+// --------------------------------------------------------
+// Game's scene, drawn through a RenderDevice with no D3D or
+// DirectXMath, for the headless tools (golden images and
+// benchmarks): the cube mesh as the two moving cubes and the
+// ground slab, both directional lights with cascaded shadows,
+// the three shadowed spot lights, the grid of clustered
+// lights, fog and the sky.
+//
+// Textures are made here (a checker and a gradient sky), as
+// the game's are JPG / DDS files.  The constant buffers are
+// laid out as SoftwareShaders' ports expect, which is how the
+// HLSL has them.
+//
+// It can be made heavier for benchmarks: more clustered
+// lights, and stress cubes (see GetStressEntityTransform).
+// Each pass is a profiler scope.
+// --------------------------------------------------------
+class DemoScene
+{
+public:
+	DemoScene();
+	~DemoScene();
+
+	// Reads Debug/Assets/Models/cube.obj, so it has to run from
+	// the project directory.  Returns false if it can't.
+	bool Create(RenderDevice* device, int width, int height, int lightsPerSide = 12, int stressEntities = 0);
+
+	// Game::Update and Draw at a time.  With no camera it's
+	// where Camera starts.
+	void Render(float totalTime, const CameraKey* camera = 0);
+
+	// Called at the end of each pass - e.g. to flush a software
+	// device, so its work is timed in the pass that made it
+	void SetPassEndCallback(const std::function<void()>& callback) { passEnd = callback; }
+
+	// Spreads moving the stress cubes and assigning the lights
+	// (e.g. JobSystem::GetParallelFor); by default the cubes are
+	// moved here and the lights on a thread per core
+	void SetParallelFor(const LightClusterGrid::ParallelFor& parallelFor);
+
+	RenderTextureHandle GetColorTarget() { return colorTarget; }
+	int GetEntityCount() { return 3 + stressEntities; }
+	int GetLightCount() { return (int)lights.size(); }
+
+private:
+	RenderDevice* device;
+	int width;
+	int height;
+	int stressEntities;
+	std::function<void()> passEnd;
+	LightClusterGrid::ParallelFor parallelFor;
+
+	unsigned int indexCount;
+	RenderBufferHandle vertexBuffer;
+	RenderBufferHandle indexBuffer;
+	RenderBufferHandle objectConstants;
+	RenderBufferHandle skyConstants;
+	RenderBufferHandle lightConstants;
+	RenderBufferHandle shadowConstants;
+	RenderBufferHandle spotConstants;
+	RenderBufferHandle clusterConstants;
+	RenderBufferHandle clusterLights;
+	RenderBufferHandle clusterRanges;
+	RenderBufferHandle clusterIndices;
+	RenderTextureHandle colorTarget;
+	RenderTextureHandle depthTarget;
+	RenderTextureHandle shadowMap;
+	RenderTextureHandle spotAtlas;
+	RenderTextureHandle diffuseTexture;
+	RenderTextureHandle skyTexture;
+	RenderShaderHandle vertexShader;
+	RenderShaderHandle pixelShader;
+	RenderShaderHandle shadowVS;
+	RenderShaderHandle skyVS;
+	RenderShaderHandle skyPS;
+	RenderPipelineHandle opaquePipeline;
+	RenderPipelineHandle shadowPipeline;
+	RenderPipelineHandle skyPipeline;
+	RenderSamplerHandle basicSampler;
+	RenderSamplerHandle shadowSampler;
+
+	LightClusterGrid* clusters;
+	std::vector<ClusterLight> lights;
+	std::vector<float> lightOrigins;
+
+	// This frame's world matrices (row-major, row vectors)
+	std::vector<float> worlds;
+
+	void MakeTextures();
+	void DrawCubes(RenderContext* context, const float* view, const float* projection);
+	void EndPass();
+};
@@ -0,0 +1,82 @@
+#include "DynamicResolution.h"
+
+#include <math.h>
+
+DynamicResolutionSettings DynamicResolutionSettings::Default()
+{
+	DynamicResolutionSettings settings;
+	settings.TargetMs = 1000.0 / 60.0 * 0.9;	// A 60Hz frame, with room for the rest of it
+	settings.Smoothing = 0.25f;
+	settings.MinScale = 0.5f;
+	settings.MaxScale = 1.0f;
+	settings.ProportionalGain = 0.2f;
+	settings.IntegralGain = 0.05f;
+	settings.Deadband = 0.04f;
+	settings.Step = 1.0f / 64.0f;
+	return settings;
+}
+
+DynamicResolution::DynamicResolution(const DynamicResolutionSettings& settings)
+{
+	this->settings = settings;
+	Reset();
+}
+
+void DynamicResolution::Reset()
+{
+	averageMs = 0;
+	integral = settings.MaxScale * settings.MaxScale;
+	scale = settings.MaxScale;
+}
+
+float DynamicResolution::Update(double gpuMs)
+{
+	if (gpuMs <= 0 || settings.TargetMs <= 0)
+		return scale;
+
+	float minArea = settings.MinScale * settings.MinScale;
+	float maxArea = settings.MaxScale * settings.MaxScale;
+
+	if (averageMs <= 0)
+		averageMs = gpuMs;
+	else
+		averageMs += settings.Smoothing * (gpuMs - averageMs);
+
+	// Positive when there's time to spare.  Way over budget
+	// counts as 1x over, so a hitch can't crash the resolution.
+	float error = (float)(1.0 - averageMs / settings.TargetMs);
+	if (error < -1.0f)
+		error = -1.0f;
+	if (fabsf(error) < settings.Deadband)
+		error = 0.0f;
+
+	integral += settings.IntegralGain * error;
+	if (integral < minArea) integral = minArea;
+	if (integral > maxArea) integral = maxArea;
+
+	float area = integral + settings.ProportionalGain * error;
+	if (area < minArea) area = minArea;
+	if (area > maxArea) area = maxArea;
+
+	float newScale = sqrtf(area);
+	if (settings.Step > 0)
+	{
+		if (fabsf(newScale - scale) < settings.Step)
+			return scale;
+		newScale = floorf(newScale / settings.Step + 0.5f) * settings.Step;
+	}
+	if (newScale < settings.MinScale) newScale = settings.MinScale;
+	if (newScale > settings.MaxScale) newScale = settings.MaxScale;
+	scale = newScale;
+	return scale;
+}
+
+void DynamicResolution::GetRenderSize(int width, int height, int& renderWidth, int& renderHeight)
+{
+	renderWidth = (int)(width * scale + 0.5f);
+	renderHeight = (int)(height * scale + 0.5f);
+	if (renderWidth < 1) renderWidth = 1;
+	if (renderHeight < 1) renderHeight = 1;
+	if (renderWidth > width) renderWidth = width;
+	if (renderHeight > height) renderHeight = height;
+}
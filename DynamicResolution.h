@@ -0,0 +1,63 @@
+#pragma once
+
+// --------------------------------------------------------
+// How dynamic resolution reacts to the GPU's frame time
+// --------------------------------------------------------
+struct DynamicResolutionSettings
+{
+	double TargetMs;		// GPU time per frame to aim for
+	float Smoothing;		// Weight of the newest time in the running average the error's taken from
+	float MinScale;			// Of the window's width and height
+	float MaxScale;
+	float ProportionalGain;	// Area change per unit of error (error = 1 - ms / TargetMs)
+	float IntegralGain;		// ... added up every frame
+	float Deadband;			// Errors smaller than this count as none
+	float Step;				// Scales are rounded to this, so tiny corrections don't resize the frame
+
+	static DynamicResolutionSettings Default();
+};
+
+// --------------------------------------------------------
+// Picks the resolution the scene renders at from measured GPU
+// frame times: a PI controller on the error against a budget.
+//
+// It controls the rendered area (scale squared) rather than
+// the scale, since that's roughly what pixel work costs.  Times
+// are smoothed first, so one noisy frame can't move it.  The
+// integral term carries the area that fits the budget; the
+// proportional term reacts to the latest frame on top of it.
+// The integral is clamped to the area's range, so time spent
+// pinned at a limit doesn't wind it up.  Near the target the
+// error is ignored, and the scale only moves once it's a whole
+// Step away - otherwise it hunts between two steps forever.
+//
+// GPU times come back a few frames late, so the gains are kept
+// low enough to stay stable with that delay.  No clock or
+// device - feed it any series of times (e.g. a synthetic
+// trace, see DynamicResolutionTrace).
+// --------------------------------------------------------
+class DynamicResolution
+{
+public:
+	DynamicResolution(const DynamicResolutionSettings& settings = DynamicResolutionSettings::Default());
+
+	// A frame's GPU time; returns the scale to render at now
+	float Update(double gpuMs);
+
+	// Back to MaxScale (e.g. after a big change of scene)
+	void Reset();
+
+	void SetTargetMs(double ms) { settings.TargetMs = ms; }
+	const DynamicResolutionSettings& GetSettings() { return settings; }
+
+	float GetScale() { return scale; }
+
+	// The scaled size of a width x height target (at least 1x1)
+	void GetRenderSize(int width, int height, int& renderWidth, int& renderHeight);
+
+private:
+	DynamicResolutionSettings settings;
+	double averageMs;	// Smoothed GPU time, 0 before the first
+	float integral;		// Area
+	float scale;
+};
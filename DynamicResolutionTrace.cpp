@@ -0,0 +1,221 @@
+// --------------------------------------------------------
+// Offline tool: runs the dynamic resolution controller (see
+// DynamicResolution) against synthetic GPU timing traces and
+// checks it settles where it should (excluded from the game
+// build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 DynamicResolutionTrace.cpp DynamicResolution.cpp -o DynamicResolutionTrace
+//   ./DynamicResolutionTrace --latency 3 --csv dynres_trace.csv
+//
+// Options: --latency N (frames before a GPU time comes back,
+// at least 1, default 3) and --csv FILE (every frame of every
+// trace).
+//
+// Each trace's GPU time is a fixed part plus a part that
+// scales with the rendered area, optionally with noise, and
+// changes of load part way through.  Fails (returns 1) if a
+// trace doesn't end up within its budget, takes too long to
+// get there, or the scale keeps hunting once it has.
+// --------------------------------------------------------
+
+#include "DynamicResolution.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+// The load from a given frame on
+struct TraceLoad
+{
+	int Frame;
+	double FixedMs;		// Shadows etc. - doesn't scale
+	double PixelMs;		// At full resolution
+};
+
+struct Trace
+{
+	const char* Name;
+	const char* Description;
+	int Frames;
+	double Noise;			// +- this fraction, uniformly
+	TraceLoad Loads[3];
+	int LoadCount;
+	float ExpectedScale;	// Where it should end up (0 = anywhere within budget)
+};
+
+static const Trace Traces[] =
+{
+	{ "light",		"Fits at full resolution",						400, 0.0,	{ { 0, 3.0, 8.0 } }, 1, 1.0f },
+	{ "heavy",		"Has to drop to about 0.68",					400, 0.0,	{ { 0, 4.0, 24.0 } }, 1, 0.0f },
+	{ "noisy",		"Heavy, with +-15% noise",						600, 0.15,	{ { 0, 4.0, 24.0 } }, 1, 0.0f },
+	{ "step",		"Light, a heavy spell, then light again",		900, 0.0,	{ { 0, 3.0, 10.0 }, { 300, 3.0, 30.0 }, { 600, 3.0, 10.0 } }, 3, 1.0f },
+	{ "pinned",		"Too heavy even at MinScale, then light",		600, 0.0,	{ { 0, 4.0, 60.0 }, { 300, 3.0, 8.0 } }, 2, 1.0f },
+};
+
+// A load change has to be dealt with in this many frames
+static const int SettleFrames = 90;
+
+// Once settled, the average GPU time over the last stretch
+// must be within this much of the target (or under it, when
+// even MaxScale is cheap enough)
+static const double BudgetTolerance = 0.05;
+static const int TailFrames = 100;
+static const int AverageFrames = 30;
+
+struct TraceResult
+{
+	float FinalScale;
+	double TailMeanMs;
+	int SettleFrame;		// After the last load change, -1 if never
+	int ScaleChanges;		// Over the tail
+	bool Passed;
+};
+
+static const TraceLoad& LoadAt(const Trace& trace, int frame)
+{
+	int l = 0;
+	while (l + 1 < trace.LoadCount && trace.Loads[l + 1].Frame <= frame)
+		l++;
+	return trace.Loads[l];
+}
+
+static TraceResult RunTrace(const Trace& trace, int latency, FILE* csv)
+{
+	DynamicResolutionSettings settings = DynamicResolutionSettings::Default();
+	DynamicResolution controller(settings);
+	std::mt19937 random(99);
+	std::uniform_real_distribution<double> unit(-1.0, 1.0);
+
+	std::vector<double> gpuMs(trace.Frames);
+	std::vector<float> scales(trace.Frames);
+	for (int frame = 0; frame < trace.Frames; frame++)
+	{
+		// The newest GPU time known is from latency frames ago
+		int measured = frame - latency;
+		if (measured >= 0)
+			controller.Update(gpuMs[measured]);
+
+		float scale = controller.GetScale();
+		const TraceLoad& load = LoadAt(trace, frame);
+		double ms = load.FixedMs + load.PixelMs * scale * scale;
+		ms *= 1.0 + trace.Noise * unit(random);
+		gpuMs[frame] = ms;
+		scales[frame] = scale;
+
+		if (csv)
+			fprintf(csv, "%s,%d,%.4f,%.4f,%.4f\n", trace.Name, frame, scale, ms, settings.TargetMs);
+	}
+
+	TraceResult result;
+	result.FinalScale = scales[trace.Frames - 1];
+
+	double sum = 0;
+	result.ScaleChanges = 0;
+	for (int frame = trace.Frames - TailFrames; frame < trace.Frames; frame++)
+	{
+		sum += gpuMs[frame];
+		if (frame > trace.Frames - TailFrames && scales[frame] != scales[frame - 1])
+			result.ScaleChanges++;
+	}
+	result.TailMeanMs = sum / TailFrames;
+
+	// Settled: from here on the average of the last few frames
+	// is within budget (so noise doesn't count), and at the
+	// expected scale if there is one
+	int lastChange = trace.Loads[trace.LoadCount - 1].Frame;
+	double limit = settings.TargetMs * (1.0 + BudgetTolerance);
+	result.SettleFrame = -1;
+	for (int frame = trace.Frames - 1; frame >= lastChange + AverageFrames - 1; frame--)
+	{
+		double average = 0;
+		for (int f = frame - AverageFrames + 1; f <= frame; f++)
+			average += gpuMs[f] / AverageFrames;
+		bool ok = average <= limit;
+		if (trace.ExpectedScale > 0)
+			ok = ok && scales[frame] == trace.ExpectedScale;
+		if (!ok)
+			break;
+		result.SettleFrame = frame - lastChange;
+	}
+
+	bool withinBudget = result.TailMeanMs <= settings.TargetMs * (1.0 + BudgetTolerance);
+	bool usesBudget = trace.ExpectedScale > 0 || result.TailMeanMs >= settings.TargetMs * (1.0 - BudgetTolerance);
+	bool settled = result.SettleFrame >= 0 && result.SettleFrame <= SettleFrames;
+	bool steady = trace.Noise > 0 ? result.ScaleChanges <= TailFrames / 4 : result.ScaleChanges == 0;
+	result.Passed = withinBudget && usesBudget && settled && steady;
+	return result;
+}
+
+int main(int argc, char* argv[])
+{
+	int latency = 3;
+	const char* csvPath = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--latency") == 0 && hasValue)
+			latency = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--csv") == 0 && hasValue)
+			csvPath = argv[++i];
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+	if (latency < 1)
+	{
+		printf("Latency has to be at least 1 (a frame's own time isn't known while it's drawn)\n");
+		return 2;
+	}
+
+	FILE* csv = 0;
+	if (csvPath)
+	{
+#ifdef _WIN32
+		fopen_s(&csv, csvPath, "w");
+#else
+		csv = fopen(csvPath, "w");
+#endif
+		if (!csv)
+		{
+			printf("Can't write %s\n", csvPath);
+			return 2;
+		}
+		fprintf(csv, "trace,frame,scale,gpu_ms,target_ms\n");
+	}
+
+	DynamicResolutionSettings settings = DynamicResolutionSettings::Default();
+	printf("Target %.2fms, scale %.2f..%.2f, %d frame(s) of latency\n\n", settings.TargetMs, settings.MinScale, settings.MaxScale, latency);
+	printf("%-8s %-44s %7s %10s %8s %8s\n", "trace", "", "scale", "tail mean", "settled", "changes");
+
+	int failed = 0;
+	for (size_t t = 0; t < sizeof(Traces) / sizeof(Traces[0]); t++)
+	{
+		TraceResult result = RunTrace(Traces[t], latency, csv);
+		char settled[16];
+		if (result.SettleFrame >= 0)
+			sprintf(settled, "%d", result.SettleFrame);
+		else
+			sprintf(settled, "never");
+		printf("%-8s %-44s %7.3f %8.2fms %8s %8d  %s\n", Traces[t].Name, Traces[t].Description,
+			result.FinalScale, result.TailMeanMs, settled, result.ScaleChanges, result.Passed ? "ok" : "FAILED");
+		if (!result.Passed)
+			failed++;
+	}
+
+	if (csv)
+		fclose(csv);
+
+	if (failed > 0)
+	{
+		printf("\nFAILED: %d trace(s)\n", failed);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
@@ -1,4 +1,7 @@
 #include "Entity.h"
+#include "ShaderStructs.h"
+
+#include <math.h>
 
 using namespace DirectX;
 
@@ -13,6 +16,8 @@ Entity::Entity(Mesh * mesh, Material * material) //will eventually take a materi
 	posVector = XMFLOAT3(0, 0, 0);
 	rotVector = XMFLOAT3(0, 0, 0);
 	scaleVector = XMFLOAT3(1, 1, 1);
+	boundingCenter = XMFLOAT3(0, 0, 0);
+	boundingRadius = 0;
 }
 
 XMFLOAT4X4 Entity::GetMatrix()
@@ -71,9 +76,17 @@ void Entity::Move()
 	XMStoreFloat4x4(
 		&worldMatrix,
 		XMMatrixTranspose(zaWarudo));
+
+	// The sphere grows with the biggest scale
+	XMFLOAT3 meshCenter = meshingAround->GetBoundingCenter();
+	XMStoreFloat3(&boundingCenter, XMVector3Transform(XMLoadFloat3(&meshCenter), zaWarudo));
+	float scale = fabsf(scaleVector.x);
+	if (fabsf(scaleVector.y) > scale) scale = fabsf(scaleVector.y);
+	if (fabsf(scaleVector.z) > scale) scale = fabsf(scaleVector.z);
+	boundingRadius = meshingAround->GetBoundingRadius() * scale;
 }
 
-void Entity::PrepareMaterial(XMFLOAT4X4 viewMatrix, XMFLOAT4X4 projMatrix, XMFLOAT4X4 shadowView, XMFLOAT4X4 shadowProj)
+void Entity::PrepareMaterial(XMFLOAT4X4 viewMatrix, XMFLOAT4X4 projMatrix, XMFLOAT3 cameraPos, ID3D11DeviceContext *context)
 {
 	SimpleVertexShader* v = girlInAMaterialWorld->GetVertexShader();
 	SimplePixelShader* p = girlInAMaterialWorld->GetPixelShader();
@@ -83,33 +96,37 @@ void Entity::PrepareMaterial(XMFLOAT4X4 viewMatrix, XMFLOAT4X4 projMatrix, XMFLO
 	//  - This is actually a complex process of copying data to a local buffer
 	//    and then copying that entire buffer to the GPU.  
 	//  - The "SimpleShader" class handles all of that for you.
-	v->SetMatrix4x4("world", GetMatrix());
-	v->SetMatrix4x4("view", viewMatrix); //NOW camera's view matrix
-	v->SetMatrix4x4("projection", projMatrix);
-	
-	v->SetMatrix4x4("shadowView", shadowView);
-	v->SetMatrix4x4("shadowProjection", shadowProj);
-
-	// Once you've set all of the data you care to change for
-	// the next draw call, you need to actually send it to the GPU
-	//  - If you skip this, the "SetMatrix" calls above won't make it to the GPU!
-	v->CopyAllBufferData();
-
-	v->SetShader();
-	p->SetShader();
+	//  - The whole cbuffer is filled as one struct (generated from the
+	//    shader, so the layout always matches) and copied in one go
+	//  - It goes straight to the GPU on the context we're drawing
+	//    with, since entities may be recorded on several threads
+	//    at once (see CommandRecorder)
+	VertexShader_externalData data;
+	data.world = GetMatrix();
+	data.view = viewMatrix; //NOW camera's view matrix
+	data.projection = projMatrix;
+	v->CopyBufferData("externalData", &data, sizeof(data), context);
+
+	// The shaders themselves are bound by the material's pipeline state
+
+	// Only variants compiled with IBL have the material buffer
+	if (ShaderPermutation::HasFeature(girlInAMaterialWorld->GetPermutationKey(), PERMUTATION_IBL))
+	{
+		PixelShader_materialData materialData = {};
+		materialData.cameraPos = cameraPos;
+		materialData.roughness = girlInAMaterialWorld->GetRoughness();
+		materialData.metalness = girlInAMaterialWorld->GetMetalness();
+		p->CopyBufferData("materialData", &materialData, sizeof(materialData), context);
+	}
 }
 
-void Entity::Draw(ID3D11DeviceContext *context) //may take camera matrices in later versions...
+void Entity::Draw(RenderContext *context) //may take camera matrices in later versions...
 {
 	//jus do sum drawing sheeit
 	// Set buffers in the input assembler
 	//  - Do this ONCE PER OBJECT you're drawing, since each object might
 	//    have different geometry.
-	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	ID3D11Buffer * temp = meshingAround->GetVertexBuffer();
-	context->IASetVertexBuffers(0, 1, &temp, &stride, &offset);
-	context->IASetIndexBuffer(meshingAround->GetIndexBuffer(), DXGI_FORMAT_R32_UINT, 0);
+	meshingAround->Bind(context);
 
 	// Finally do the actual drawing
 	//  - Do this ONCE PER OBJECT you intend to draw
@@ -124,13 +141,10 @@ void Entity::Draw(ID3D11DeviceContext *context) //may take camera matrices in la
 
 //Shadow will actually be added in Game.cpp
 //we just need some slight restructuring here
-void Entity::DrawWithShadow(ID3D11DeviceContext *context)
+//(depth only, so just the positions - normals and UVs are for shading)
+void Entity::DrawWithShadow(RenderContext *context)
 {
-	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	ID3D11Buffer * temp = meshingAround->GetVertexBuffer();
-	context->IASetVertexBuffers(0, 1, &temp, &stride, &offset);
-	context->IASetIndexBuffer(meshingAround->GetIndexBuffer(), DXGI_FORMAT_R32_UINT, 0);
+	meshingAround->BindPositionStream(context);
 }
 
 Mesh * Entity::GetMesh()
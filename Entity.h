@@ -24,11 +24,16 @@ public:
 
 	void Move();
 
+	// The mesh's bounding sphere in world space, as of the
+	// last Move()
+	DirectX::XMFLOAT3 GetBoundingCenter() { return boundingCenter; }
+	float GetBoundingRadius() { return boundingRadius; }
+
 	//try this, now with shadows
-	void PrepareMaterial(DirectX::XMFLOAT4X4 viewMatrix, DirectX::XMFLOAT4X4 projMatrix, DirectX::XMFLOAT4X4 shadowView, DirectX::XMFLOAT4X4 shadowProj);
+	void PrepareMaterial(DirectX::XMFLOAT4X4 viewMatrix, DirectX::XMFLOAT4X4 projMatrix, DirectX::XMFLOAT3 cameraPos, ID3D11DeviceContext *context);
 	
-	void Draw(ID3D11DeviceContext *context); //this will probably be the hardest part
-	void DrawWithShadow(ID3D11DeviceContext *context); //this will probably be the hardest part
+	void Draw(RenderContext *context); //this will probably be the hardest part
+	void DrawWithShadow(RenderContext *context); //this will probably be the hardest part
 
 	Mesh * GetMesh();
 	
@@ -39,6 +44,8 @@ private:
 	DirectX::XMFLOAT3 posVector;
 	DirectX::XMFLOAT3 rotVector;
 	DirectX::XMFLOAT3 scaleVector;
+	DirectX::XMFLOAT3 boundingCenter;
+	float boundingRadius;
 
 	Mesh * meshingAround;
 
@@ -0,0 +1,339 @@
+#include "EnvironmentCapture.h"
+#include "SphericalHarmonics.h"
+#include "DDSFile.h"
+
+#include <string.h>
+
+// For the DirectX Math library
+using namespace DirectX;
+
+EnvironmentCapture::EnvironmentCapture(ID3D11Device* device, ID3D11DeviceContext* context, IBLPrecompute* precompute, int captureSize, const IBLPrefilterSettings& settings)
+{
+	this->device = device;
+	this->context = context;
+	this->precompute = precompute;
+	this->captureSize = captureSize;
+	this->settings = settings;
+
+	capture = 0;
+	probes[0] = 0;
+	probes[1] = 0;
+	memset(probeIrradiance, 0, sizeof(probeIrradiance));
+
+	fallbackRadiance = 0;
+	memset(&fallbackIrradiance, 0, sizeof(fallbackIrradiance));
+
+	readBack = 0;
+	readBackMip = 0;
+	memset(timings, 0, sizeof(timings));
+
+	scheduler = 0;
+	drawScene = 0;
+}
+
+EnvironmentCapture::~EnvironmentCapture()
+{
+	delete capture;
+	delete probes[0];
+	delete probes[1];
+	if (readBack) { readBack->Release(); }
+
+	for (int i = 0; i < TimingCount; i++)
+	{
+		if (timings[i].Disjoint) { timings[i].Disjoint->Release(); }
+		if (timings[i].Begin) { timings[i].Begin->Release(); }
+		if (timings[i].End) { timings[i].End->Release(); }
+	}
+
+	delete scheduler;
+}
+
+// --------------------------------------------------------
+// Creates the capture target, both probes, the read back
+// texture and the timing queries
+// --------------------------------------------------------
+bool EnvironmentCapture::Init()
+{
+	capture = new IBLCubemap(device, 0, captureSize, true);
+	probes[0] = new IBLCubemap(device, settings.MipCount, settings.Size);
+	probes[1] = new IBLCubemap(device, settings.MipCount, settings.Size);
+	if (!capture->GetShaderResourceView() || !probes[0]->GetShaderResourceView() || !probes[1]->GetShaderResourceView())
+		return false;
+
+	scheduler = new EnvironmentCaptureScheduler(probes[0]->GetMipLevels());
+
+	// Irradiance is very low frequency, so SH comes from a mip
+	// of 16x16 or less
+	while (readBackMip + 1 < capture->GetMipLevels() && (captureSize >> readBackMip) > 16)
+		readBackMip++;
+
+	int readBackSize = captureSize >> readBackMip > 0 ? captureSize >> readBackMip : 1;
+	D3D11_TEXTURE2D_DESC readBackDesc = {};
+	readBackDesc.Width = readBackSize;
+	readBackDesc.Height = readBackSize;
+	readBackDesc.MipLevels = 1;
+	readBackDesc.ArraySize = 6;
+	readBackDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+	readBackDesc.SampleDesc.Count = 1;
+	readBackDesc.Usage = D3D11_USAGE_STAGING;
+	readBackDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+	if (FAILED(device->CreateTexture2D(&readBackDesc, 0, &readBack)))
+		return false;
+
+	// Without queries the steps are just timed on the CPU
+	D3D11_QUERY_DESC disjointDesc = {};
+	disjointDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+	D3D11_QUERY_DESC timestampDesc = {};
+	timestampDesc.Query = D3D11_QUERY_TIMESTAMP;
+	for (int i = 0; i < TimingCount; i++)
+	{
+		device->CreateQuery(&disjointDesc, &timings[i].Disjoint);
+		device->CreateQuery(&timestampDesc, &timings[i].Begin);
+		device->CreateQuery(&timestampDesc, &timings[i].End);
+	}
+
+	return true;
+}
+
+// --------------------------------------------------------
+// Sets the lighting used before the first capture completes
+// (and blended away from when it does)
+//
+// radianceMap - Radiance map (not owned - keep it alive)
+// irradiance  - SH constants for it
+// --------------------------------------------------------
+void EnvironmentCapture::SetFallback(ID3D11ShaderResourceView* radianceMap, const PixelShader_irradianceData& irradiance)
+{
+	fallbackRadiance = radianceMap;
+	fallbackIrradiance = irradiance;
+}
+
+// --------------------------------------------------------
+// Runs this frame's share of the capture (if one is due)
+//
+// deltaTime - Seconds since the last frame
+// drawScene - Draws what the probe should see
+// --------------------------------------------------------
+void EnvironmentCapture::Update(float deltaTime, const DrawFunction& drawScene)
+{
+	CollectTimings();
+
+	this->drawScene = &drawScene;
+	scheduler->Update(deltaTime, [this](const CaptureStep& step, int probe) { return ExecuteStep(step, probe); });
+	this->drawScene = 0;
+}
+
+// --------------------------------------------------------
+// Does one step of a capture.  GPU steps are wrapped in
+// timestamp queries if one is free.
+//
+// Returns true if the step's cost will be reported later
+// --------------------------------------------------------
+bool EnvironmentCapture::ExecuteStep(const CaptureStep& step, int probe)
+{
+	// Find a free timing for anything that runs on the GPU
+	StepTiming* timing = 0;
+	for (int i = 0; i < TimingCount && step.Type != CAPTURE_STEP_PROJECT_SH; i++)
+	{
+		if (!timings[i].Pending && timings[i].Disjoint && timings[i].Begin && timings[i].End)
+		{
+			timing = &timings[i];
+			break;
+		}
+	}
+
+	if (timing)
+	{
+		context->Begin(timing->Disjoint);
+		context->End(timing->Begin);
+	}
+
+	switch (step.Type)
+	{
+	case CAPTURE_STEP_RENDER_FACE:
+		RenderFace(step.Face);
+		break;
+
+	case CAPTURE_STEP_GENERATE_MIPS:
+		context->GenerateMips(capture->GetShaderResourceView());
+		break;
+
+	case CAPTURE_STEP_READ_BACK:
+		for (int face = 0; face < 6; face++)
+		{
+			context->CopySubresourceRegion(
+				readBack, D3D11CalcSubresource(0, face, 1), 0, 0, 0,
+				capture->GetTexture(), D3D11CalcSubresource(readBackMip, face, capture->GetMipLevels()), 0);
+		}
+		break;
+
+	case CAPTURE_STEP_PREFILTER_FACE:
+		precompute->PrefilterFace(probes[probe], step.Face, step.Mip, capture->GetShaderResourceView(), captureSize, settings);
+		break;
+
+	case CAPTURE_STEP_PROJECT_SH:
+		ProjectIrradiance(probe);
+		break;
+
+	default:
+		break;
+	}
+
+	if (!timing)
+		return false;
+
+	context->End(timing->End);
+	context->End(timing->Disjoint);
+	timing->Step = step;
+	timing->Pending = true;
+	return true;
+}
+
+// --------------------------------------------------------
+// Renders the scene into one face of the capture, with a
+// 90 degree view down that face's axis (D3D face order)
+// --------------------------------------------------------
+void EnvironmentCapture::RenderFace(int face)
+{
+	static const XMFLOAT3 forward[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+	static const XMFLOAT3 up[6] = { { 0, 1, 0 }, { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 }, { 0, 1, 0 }, { 0, 1, 0 } };
+
+	XMFLOAT4X4 view;
+	XMFLOAT4X4 projection;
+	XMMATRIX V = XMMatrixLookToLH(XMVectorZero(), XMLoadFloat3(&forward[face]), XMLoadFloat3(&up[face]));
+	XMMATRIX P = XMMatrixPerspectiveFovLH(XM_PIDIV2, 1.0f, 0.1f, 100.0f);
+	XMStoreFloat4x4(&view, XMMatrixTranspose(V)); // Transpose for HLSL!
+	XMStoreFloat4x4(&projection, XMMatrixTranspose(P));
+
+	// Remember what was bound, so the caller's state is untouched
+	ID3D11RenderTargetView* oldRTV = 0;
+	ID3D11DepthStencilView* oldDSV = 0;
+	D3D11_VIEWPORT oldViewport;
+	UINT viewportCount = 1;
+	context->OMGetRenderTargets(1, &oldRTV, &oldDSV);
+	context->RSGetViewports(&viewportCount, &oldViewport);
+
+	D3D11_VIEWPORT viewport = {};
+	viewport.Width = (float)captureSize;
+	viewport.Height = (float)captureSize;
+	viewport.MaxDepth = 1.0f;
+	context->RSSetViewports(1, &viewport);
+
+	const float black[4] = { 0, 0, 0, 0 };
+	ID3D11RenderTargetView* target = capture->surfaces[face]->renderTargets[0];
+	context->OMSetRenderTargets(1, &target, 0);
+	context->ClearRenderTargetView(target, black);
+
+	if (drawScene && *drawScene)
+		(*drawScene)(view, projection);
+
+	context->OMSetRenderTargets(1, &oldRTV, oldDSV);
+	if (viewportCount > 0)
+		context->RSSetViewports(1, &oldViewport);
+	if (oldRTV) { oldRTV->Release(); }
+	if (oldDSV) { oldDSV->Release(); }
+}
+
+// --------------------------------------------------------
+// Projects the read back mip onto SH9 irradiance.  The copy
+// was made many frames ago (the scheduler puts this step at
+// the end of a capture), so mapping it doesn't stall.
+// --------------------------------------------------------
+void EnvironmentCapture::ProjectIrradiance(int probe)
+{
+	D3D11_TEXTURE2D_DESC desc;
+	readBack->GetDesc(&desc);
+
+	CubemapImage image;
+	image.Create(desc.Width, 1);
+	for (int face = 0; face < 6; face++)
+	{
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		UINT subresource = D3D11CalcSubresource(0, face, 1);
+		if (FAILED(context->Map(readBack, subresource, D3D11_MAP_READ, 0, &mapped)))
+			return;
+
+		float* texels = image.GetFace(face, 0);
+		for (unsigned int y = 0; y < desc.Height; y++)
+		{
+			const uint16_t* row = (const uint16_t*)((const unsigned char*)mapped.pData + y * mapped.RowPitch);
+			for (unsigned int x = 0; x < desc.Width * 4; x++)
+				texels[y * desc.Width * 4 + x] = DDSFile::HalfToFloat(row[x]);
+		}
+
+		context->Unmap(readBack, subresource);
+	}
+
+	// Tiny, so one thread is plenty
+	SH9Color sh;
+	SphericalHarmonics::ProjectCubemap(image, 0, sh, false);
+	SphericalHarmonics::ConvolveIrradiance(sh);
+	SphericalHarmonics::GetShaderConstants(sh, (float(*)[4])probeIrradiance[probe].irradianceSH);
+}
+
+// --------------------------------------------------------
+// Hands finished GPU timings to the scheduler
+// --------------------------------------------------------
+void EnvironmentCapture::CollectTimings()
+{
+	for (int i = 0; i < TimingCount; i++)
+	{
+		StepTiming& timing = timings[i];
+		if (!timing.Pending)
+			continue;
+
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+		UINT64 begin = 0;
+		UINT64 end = 0;
+		if (context->GetData(timing.Disjoint, &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+			context->GetData(timing.Begin, &begin, sizeof(begin), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+			context->GetData(timing.End, &end, sizeof(end), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+			continue;
+
+		// A disjoint result means the clock changed - drop it
+		if (!disjoint.Disjoint && disjoint.Frequency > 0)
+			scheduler->ReportStepCost(timing.Step, (double)(end - begin) * 1000.0 / disjoint.Frequency);
+		timing.Pending = false;
+	}
+}
+
+ID3D11ShaderResourceView* EnvironmentCapture::GetRadianceMap()
+{
+	int current = scheduler ? scheduler->GetCurrentProbe() : -1;
+	return current >= 0 ? probes[current]->GetShaderResourceView() : fallbackRadiance;
+}
+
+ID3D11ShaderResourceView* EnvironmentCapture::GetPreviousRadianceMap()
+{
+	int previous = scheduler ? scheduler->GetPreviousProbe() : -1;
+	return previous >= 0 ? probes[previous]->GetShaderResourceView() : fallbackRadiance;
+}
+
+// --------------------------------------------------------
+// SH irradiance blended between the previous and current
+// probes, plus the blend factor for the radiance maps
+// --------------------------------------------------------
+void EnvironmentCapture::GetIrradianceData(PixelShader_irradianceData& data)
+{
+	int current = scheduler ? scheduler->GetCurrentProbe() : -1;
+	int previous = scheduler ? scheduler->GetPreviousProbe() : -1;
+	if (current < 0)
+	{
+		data = fallbackIrradiance;
+		data.radianceBlend = 1;
+		return;
+	}
+
+	// SH is linear, so blending coefficients blends irradiance
+	const PixelShader_irradianceData& from = previous >= 0 ? probeIrradiance[previous] : fallbackIrradiance;
+	const PixelShader_irradianceData& to = probeIrradiance[current];
+	float blend = scheduler->GetBlend();
+	for (int i = 0; i < 9; i++)
+	{
+		XMStoreFloat4(&data.irradianceSH[i], XMVectorLerp(
+			XMLoadFloat4(&from.irradianceSH[i]),
+			XMLoadFloat4(&to.irradianceSH[i]),
+			blend));
+	}
+	data.radianceBlend = blend;
+}
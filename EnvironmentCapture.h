@@ -0,0 +1,95 @@
+#pragma once
+
+#include <d3d11.h>
+#include <DirectXMath.h>
+#include <functional>
+
+#include "EnvironmentCaptureScheduler.h"
+#include "IBLCubemap.h"
+#include "IBLPrecompute.h"
+#include "ShaderStructs.h"
+
+// --------------------------------------------------------
+// Re-captures the environment at run time (e.g. for a moving
+// sky) without a frame spike: the six faces are rendered, the
+// radiance mips prefiltered and the SH irradiance projected a
+// few steps per frame, within a millisecond budget (see
+// EnvironmentCaptureScheduler).
+//
+// The result lives in one of two probes (radiance cubemap +
+// SH9).  When a capture completes it's blended in over the
+// old one: the SH constants are blended here, the radiance
+// maps in PixelShader (PreviousRadianceMap / radianceBlend).
+// Before the first capture the fallback (the startup IBL)
+// stands in as the previous probe.
+//
+// GPU steps are timed with timestamp queries, read back a few
+// frames later, so the budget reflects GPU time rather than
+// the cost of submitting the draws.
+//
+// Uses the immediate context, so it must run on the main thread.
+// --------------------------------------------------------
+class EnvironmentCapture
+{
+public:
+	// Draws the scene (the sky) with a view and projection
+	typedef std::function<void(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection)> DrawFunction;
+
+	// captureSize - Face size the scene is rendered at
+	// settings    - Radiance probe size, mips and sampling
+	EnvironmentCapture(ID3D11Device* device, ID3D11DeviceContext* context, IBLPrecompute* precompute, int captureSize, const IBLPrefilterSettings& settings);
+	~EnvironmentCapture();
+
+	bool Init();
+
+	// What to show until the first capture is done
+	void SetFallback(ID3D11ShaderResourceView* radianceMap, const PixelShader_irradianceData& irradiance);
+
+	// Runs this frame's share of the current capture
+	void Update(float deltaTime, const DrawFunction& drawScene);
+
+	// Blended lighting for PixelShader
+	ID3D11ShaderResourceView* GetRadianceMap();
+	ID3D11ShaderResourceView* GetPreviousRadianceMap();
+	void GetIrradianceData(PixelShader_irradianceData& data);
+
+	EnvironmentCaptureScheduler* GetScheduler() { return scheduler; }
+
+private:
+	ID3D11Device* device;
+	ID3D11DeviceContext* context;
+	IBLPrecompute* precompute;
+	IBLPrefilterSettings settings;
+	int captureSize;
+
+	IBLCubemap* capture;	// The scene, with mips
+	IBLCubemap* probes[2];	// Prefiltered radiance
+	PixelShader_irradianceData probeIrradiance[2];
+
+	ID3D11ShaderResourceView* fallbackRadiance;
+	PixelShader_irradianceData fallbackIrradiance;
+
+	// A small mip of the capture, copied back for SH projection
+	ID3D11Texture2D* readBack;
+	int readBackMip;
+
+	// GPU timings of steps, waiting for their results
+	struct StepTiming
+	{
+		ID3D11Query* Disjoint;
+		ID3D11Query* Begin;
+		ID3D11Query* End;
+		CaptureStep Step;
+		bool Pending;
+	};
+	static const int TimingCount = 8;
+	StepTiming timings[TimingCount];
+
+	EnvironmentCaptureScheduler* scheduler;
+	const DrawFunction* drawScene;
+
+	bool ExecuteStep(const CaptureStep& step, int probe);
+	void RenderFace(int face);
+	void ProjectIrradiance(int probe);
+	void CollectTimings();
+};
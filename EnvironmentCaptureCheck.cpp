@@ -0,0 +1,271 @@
+// --------------------------------------------------------
+// Offline tool: drives the environment capture scheduler
+// (see EnvironmentCaptureScheduler) with a fake clock and
+// fake step costs, and checks how it spreads captures over
+// frames (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 EnvironmentCaptureCheck.cpp EnvironmentCaptureScheduler.cpp -o EnvironmentCaptureCheck
+//   ./EnvironmentCaptureCheck
+//
+// Options: --mips N (radiance mips, default 7), --budget MS
+// (per frame, default 1) and --frames N (per scenario,
+// default 3000).
+//
+// Fails (returns 1) if a capture runs its steps out of order
+// or more than once, if a frame goes over the budget (other
+// than a lone step), if an unmeasured step shares a frame, if
+// a new probe starts before the last one is blended in, or if
+// a capture requested after the sky turns doesn't end up
+// showing the turned sky.
+// --------------------------------------------------------
+
+#include "EnvironmentCaptureScheduler.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static int failures = 0;
+
+static void Check(bool ok, int frame, const char* what)
+{
+	if (!ok)
+	{
+		if (failures < 20)
+			printf("  FAILED (frame %d): %s\n", frame, what);
+		failures++;
+	}
+}
+
+static const float DeltaTime = 1.0f / 60.0f;
+
+// What each step costs, in ms.  The prefilter gets cheaper
+// with each mip, like the real one.
+static double StepCost(const CaptureStep& step)
+{
+	switch (step.Type)
+	{
+	case CAPTURE_STEP_RENDER_FACE:		return 0.3;
+	case CAPTURE_STEP_GENERATE_MIPS:	return 0.1;
+	case CAPTURE_STEP_READ_BACK:		return 0.05;
+	case CAPTURE_STEP_PREFILTER_FACE:	return 0.6 / (1 << step.Mip);
+	case CAPTURE_STEP_PROJECT_SH:		return 0.15;
+	default:							return 0;
+	}
+}
+
+// The fake world: a sky that can be turned, and what each
+// probe's faces were rendered with
+struct World
+{
+	float SkyRotation;
+	float FaceRotation[2][6];
+
+	// GPU steps report their cost a couple of frames late, the
+	// way EnvironmentCapture's timestamp queries do
+	struct PendingCost { CaptureStep Step; double Ms; int Frame; };
+	std::vector<PendingCost> Pending;
+
+	// This frame's steps, as run
+	struct RunStep { CaptureStep Step; double Estimate; };
+	std::vector<RunStep> Frame;
+};
+
+struct Scenario
+{
+	const char* Name;
+	bool GpuTimed;		// Prefilter steps report their cost later
+	float Interval;		// Seconds between automatic captures (0 = only on request)
+	float BlendTime;
+};
+
+static const Scenario Scenarios[] =
+{
+	{ "cpu timed",			false,	0.0f,	1.0f },
+	{ "gpu timed",			true,	0.0f,	1.0f },
+	{ "interval",			false,	2.0f,	0.5f },
+	{ "no blend",			true,	0.0f,	0.0f },
+};
+
+static void RunScenario(const Scenario& scenario, int mipCount, double budget, int frames)
+{
+	double now = 0;
+	EnvironmentCaptureScheduler scheduler(mipCount, [&now]() { return now; });
+	scheduler.SetBudget(budget);
+	scheduler.SetBlendTime(scenario.BlendTime);
+	scheduler.SetInterval(scenario.Interval);
+
+	World world;
+	world.SkyRotation = 0;
+	memset(world.FaceRotation, 0, sizeof(world.FaceRotation));
+
+	unsigned int stepCount = scheduler.GetStepCount();
+	unsigned int expectedStep = 0;
+	unsigned int capturesSeen = 0;
+	unsigned int longestCapture = 0;
+	int lastProbe = -1;
+	int frame = 0;
+
+	EnvironmentCaptureScheduler::StepFunction execute = [&](const CaptureStep& step, int probe)
+	{
+		World::RunStep run = { step, scheduler.GetStepEstimate(step) };
+		world.Frame.push_back(run);
+		if (step.Type == CAPTURE_STEP_RENDER_FACE)
+			world.FaceRotation[probe][step.Face] = world.SkyRotation;
+
+		if (scenario.GpuTimed && step.Type == CAPTURE_STEP_PREFILTER_FACE)
+		{
+			World::PendingCost cost = { step, StepCost(step), frame + 2 };
+			world.Pending.push_back(cost);
+			now += 0.01;	// Just the cost of issuing it
+			return true;
+		}
+
+		now += StepCost(step);
+		return false;
+	};
+
+	// Turn the sky and ask for a capture part way through a
+	// capture, part way through a blend, and while idle
+	int turns[] = { frames / 4, frames / 4 + 3, frames / 2, frames / 2 + 70, 3 * frames / 4 };
+	unsigned int nextTurn = 0;
+	int lastTurnFrame = -1;
+
+	scheduler.RequestCapture();
+	for (frame = 0; frame < frames; frame++)
+	{
+		if (nextTurn < sizeof(turns) / sizeof(turns[0]) && frame == turns[nextTurn])
+		{
+			world.SkyRotation += 0.5f;
+			scheduler.RequestCapture();
+			lastTurnFrame = frame;
+			nextTurn++;
+		}
+
+		bool wasCapturing = scheduler.IsCapturing();
+		unsigned int capturesBefore = scheduler.GetCaptureCount();
+
+		world.Frame.clear();
+		scheduler.Update(DeltaTime, execute);
+
+		for (size_t p = 0; p < world.Pending.size();)
+		{
+			if (world.Pending[p].Frame <= frame)
+			{
+				scheduler.ReportStepCost(world.Pending[p].Step, world.Pending[p].Ms);
+				world.Pending.erase(world.Pending.begin() + p);
+			}
+			else
+				p++;
+		}
+
+		// A capture only starts once the last probe is fully in
+		// (the blend moves on before the capture starts)
+		if (!wasCapturing && !world.Frame.empty())
+		{
+			Check(scheduler.GetBlend() >= 1, frame, "capture started during a blend");
+			Check(expectedStep == 0, frame, "capture started part way through");
+		}
+
+		// Steps run in order, each exactly once per capture
+		for (size_t s = 0; s < world.Frame.size(); s++)
+		{
+			const CaptureStep& step = world.Frame[s].Step;
+			const CaptureStep& expected = scheduler.GetStep(expectedStep % stepCount);
+			Check(step.Type == expected.Type && step.Face == expected.Face && step.Mip == expected.Mip, frame, "step out of order");
+			expectedStep++;
+
+			// Only the first step of a frame may be unmeasured or
+			// need a frame of its own
+			if (s > 0)
+			{
+				Check(world.Frame[s].Estimate >= 0, frame, "unmeasured step shared a frame");
+				Check(!step.NewFrame, frame, "NewFrame step didn't start a frame");
+			}
+		}
+		Check(world.Frame.size() == scheduler.GetLastFrameSteps(), frame, "step count");
+
+		// The per-frame budget holds whenever more than one step ran
+		if (world.Frame.size() > 1)
+			Check(scheduler.GetLastFrameMs() <= budget + 1e-9, frame, "frame over budget");
+
+		// Finished captures flip to the other probe and blend in
+		if (scheduler.GetCaptureCount() != capturesBefore)
+		{
+			Check(expectedStep == stepCount, frame, "capture finished without running every step");
+			expectedStep = 0;
+			capturesSeen++;
+			if (scheduler.GetLastCaptureFrames() > longestCapture)
+				longestCapture = scheduler.GetLastCaptureFrames();
+
+			Check(scheduler.GetCurrentProbe() != lastProbe, frame, "capture didn't flip probes");
+			Check(scheduler.GetPreviousProbe() == lastProbe, frame, "previous probe");
+			Check(scheduler.GetBlend() == (scenario.BlendTime > 0 ? 0.0f : 1.0f), frame, "blend didn't restart");
+			lastProbe = scheduler.GetCurrentProbe();
+		}
+
+		// Well after a turn (a capture already under way, its
+		// blend, then a whole new capture and its blend) every
+		// face shown must have been rendered with the turned sky
+		int settleFrames = 2 * ((int)longestCapture + (int)(scenario.BlendTime / DeltaTime) + 2);
+		if (lastTurnFrame >= 0 && frame == lastTurnFrame + settleFrames && longestCapture > 0)
+		{
+			bool turned = scheduler.GetCurrentProbe() >= 0;
+			for (int face = 0; face < 6 && turned; face++)
+				turned = world.FaceRotation[scheduler.GetCurrentProbe()][face] == world.SkyRotation;
+			Check(turned, frame, "no recapture of the turned sky");
+		}
+	}
+
+	// Every step type ends up with an estimate
+	for (unsigned int s = 0; s < stepCount; s++)
+		Check(scheduler.GetStepEstimate(scheduler.GetStep(s)) >= 0, frames, "step never measured");
+
+	// The first, then at least one for each group of turns
+	Check(capturesSeen >= 4, frames, "too few captures");
+
+	printf("%-10s %8u %12u %10.3fms %10u\n", scenario.Name, capturesSeen, longestCapture, scheduler.GetMaxFrameMs(), stepCount);
+}
+
+int main(int argc, char* argv[])
+{
+	int mipCount = 7;
+	double budget = 1.0;
+	int frames = 3000;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--mips") == 0 && hasValue)
+			mipCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--budget") == 0 && hasValue)
+			budget = atof(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && hasValue)
+			frames = atoi(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+	if (mipCount < 1 || budget <= 0 || frames < 400)
+	{
+		printf("Needs at least 1 mip, a budget and 400 frames\n");
+		return 2;
+	}
+
+	printf("%d mip(s), %.2fms budget, %d frames\n\n", mipCount, budget, frames);
+	printf("%-10s %8s %12s %12s %10s\n", "scenario", "captures", "max frames", "max frame", "steps");
+	for (size_t s = 0; s < sizeof(Scenarios) / sizeof(Scenarios[0]); s++)
+		RunScenario(Scenarios[s], mipCount, budget, frames);
+
+	if (failures > 0)
+	{
+		printf("\nFAILED: %d check(s)\n", failures);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
@@ -0,0 +1,184 @@
+#include "EnvironmentCaptureScheduler.h"
+
+#include <chrono>
+
+// --------------------------------------------------------
+// Builds the step list for a capture
+//
+// mipCount - Radiance mips to prefilter
+// clock    - Current time in milliseconds (default: steady_clock)
+// --------------------------------------------------------
+EnvironmentCaptureScheduler::EnvironmentCaptureScheduler(int mipCount, std::function<double()> clock)
+{
+	this->mipCount = mipCount > 0 ? mipCount : 1;
+	this->clock = clock;
+	if (!this->clock)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		this->clock = [start]()
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+	}
+
+	budgetMs = 1.0;
+	blendTime = 1.0f;
+	interval = 0;
+
+	requested = false;
+	capturing = false;
+	nextStep = 0;
+	captureFrames = 0;
+	sinceCapture = 0;
+
+	currentProbe = -1;
+	previousProbe = -1;
+	blend = 1;
+
+	captureCount = 0;
+	lastCaptureFrames = 0;
+	lastFrameMs = 0;
+	lastFrameSteps = 0;
+	maxFrameMs = 0;
+
+	// The faces, then their mips.  The SH read back is copied
+	// early and only mapped at the very end, frames later, so
+	// mapping it never waits on the GPU.
+	CaptureStep step = {};
+	for (int face = 0; face < 6; face++)
+	{
+		step.Type = CAPTURE_STEP_RENDER_FACE;
+		step.Face = face;
+		steps.push_back(step);
+	}
+
+	step.Type = CAPTURE_STEP_GENERATE_MIPS;
+	step.Face = 0;
+	steps.push_back(step);
+
+	step.Type = CAPTURE_STEP_READ_BACK;
+	steps.push_back(step);
+
+	for (int mip = 0; mip < this->mipCount; mip++)
+	{
+		for (int face = 0; face < 6; face++)
+		{
+			step.Type = CAPTURE_STEP_PREFILTER_FACE;
+			step.Face = face;
+			step.Mip = mip;
+			steps.push_back(step);
+		}
+	}
+
+	step.Type = CAPTURE_STEP_PROJECT_SH;
+	step.Face = 0;
+	step.Mip = 0;
+	step.NewFrame = true;
+	steps.push_back(step);
+
+	estimates.resize(CAPTURE_STEP_TYPE_COUNT * this->mipCount, -1.0);
+}
+
+double& EnvironmentCaptureScheduler::Estimate(const CaptureStep& step)
+{
+	return estimates[step.Type * mipCount + step.Mip];
+}
+
+double EnvironmentCaptureScheduler::GetStepEstimate(const CaptureStep& step)
+{
+	return Estimate(step);
+}
+
+// --------------------------------------------------------
+// Folds a measured cost into a step's estimate.  It rises
+// straight to a slower measurement but only falls slowly, so
+// one quick run doesn't let the next frame overcommit.
+// --------------------------------------------------------
+void EnvironmentCaptureScheduler::ReportStepCost(const CaptureStep& step, double ms)
+{
+	double& estimate = Estimate(step);
+	if (estimate < 0 || ms > estimate)
+		estimate = ms;
+	else
+		estimate = estimate * 0.75 + ms * 0.25;
+}
+
+// --------------------------------------------------------
+// Runs this frame's share of the capture
+//
+// deltaTime - Seconds since the last frame (for the blend
+//             and the capture interval)
+// execute   - Does the work of one step
+// --------------------------------------------------------
+void EnvironmentCaptureScheduler::Update(float deltaTime, const StepFunction& execute)
+{
+	lastFrameMs = 0;
+	lastFrameSteps = 0;
+
+	// Blend the newest probe in
+	if (blend < 1)
+	{
+		blend = blendTime > 0 ? blend + deltaTime / blendTime : 1.0f;
+		if (blend > 1)
+			blend = 1;
+	}
+
+	// Start a capture when asked (or when the interval is up),
+	// once the probe it will overwrite is no longer on screen
+	sinceCapture += deltaTime;
+	if (interval > 0 && sinceCapture >= interval)
+		requested = true;
+	if (!capturing && requested && blend >= 1)
+	{
+		capturing = true;
+		requested = false;
+		nextStep = 0;
+		captureFrames = 0;
+		sinceCapture = 0;
+	}
+
+	if (!capturing)
+		return;
+
+	captureFrames++;
+	int probe = GetTargetProbe();
+	double spent = 0;
+
+	while (nextStep < steps.size())
+	{
+		const CaptureStep& step = steps[nextStep];
+		double estimate = Estimate(step);
+
+		// Anything unmeasured runs alone, at the start of a frame
+		if (lastFrameSteps > 0 && (step.NewFrame || estimate < 0 || spent + estimate > budgetMs))
+			break;
+
+		double start = clock();
+		bool reportsLater = execute(step, probe);
+		double elapsed = clock() - start;
+
+		if (!reportsLater)
+			ReportStepCost(step, elapsed);
+		spent += reportsLater ? (estimate > 0 ? estimate : 0) : elapsed;
+
+		nextStep++;
+		lastFrameSteps++;
+		if (estimate < 0)
+			break;
+	}
+
+	lastFrameMs = spent;
+	if (spent > maxFrameMs)
+		maxFrameMs = spent;
+
+	// Finished - show the new probe and blend it in
+	if (nextStep >= steps.size())
+	{
+		capturing = false;
+		previousProbe = currentProbe;
+		currentProbe = probe;
+		blend = blendTime > 0 ? 0.0f : 1.0f;
+		captureCount++;
+		lastCaptureFrames = captureFrames;
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+// The pieces an environment capture is split into
+enum CaptureStepType
+{
+	CAPTURE_STEP_RENDER_FACE = 0,	// Draw the scene into one face of the capture
+	CAPTURE_STEP_GENERATE_MIPS,		// Mip the capture (for filtered sampling)
+	CAPTURE_STEP_READ_BACK,			// Copy a small mip of the capture for the CPU
+	CAPTURE_STEP_PREFILTER_FACE,	// One face of one radiance mip
+	CAPTURE_STEP_PROJECT_SH,		// Project the read back mip onto SH9
+	CAPTURE_STEP_TYPE_COUNT
+};
+
+struct CaptureStep
+{
+	CaptureStepType Type;
+	int Face;
+	int Mip;
+	bool NewFrame;	// Must start a frame (e.g. it waits on an earlier copy)
+};
+
+// --------------------------------------------------------
+// Spreads an environment capture (render 6 faces, prefilter
+// every radiance mip, project SH irradiance) over as many
+// frames as it takes to stay within a per-frame budget, so a
+// changing sky doesn't cause one huge frame.
+//
+// Two probes are double buffered: a capture writes into the
+// one not being shown, and when it completes the new probe
+// is blended in over BlendTime.  The next capture can only
+// start once that blend is done, since it reuses the probe
+// being blended out.
+//
+// Each step's cost is estimated from earlier runs (per step
+// type and mip).  A step is only added to a frame when its
+// estimate fits in what's left of the budget, and a step
+// with no estimate yet only ever runs first in a frame, so
+// the very first capture can't spike either.  Steps run on
+// the GPU can report their cost later (from timestamp
+// queries); anything else is timed with the clock.
+//
+// Only scheduling lives here - the work itself is a callback
+// and time comes from an injectable clock, so the logic can
+// be driven with a fake clock and no device.
+// --------------------------------------------------------
+class EnvironmentCaptureScheduler
+{
+public:
+	// Runs one step on a probe (0 or 1).  Returns true if the
+	// step's cost will be reported later with ReportStepCost(),
+	// false to have it timed with the clock.
+	typedef std::function<bool(const CaptureStep& step, int probe)> StepFunction;
+
+	// mipCount - Radiance mips to prefilter
+	// clock    - Current time in milliseconds (default: steady_clock)
+	EnvironmentCaptureScheduler(int mipCount, std::function<double()> clock = std::function<double()>());
+
+	void SetBudget(double ms) { budgetMs = ms; }
+	void SetBlendTime(float seconds) { blendTime = seconds; }
+	void SetInterval(float seconds) { interval = seconds; }	// 0 = only on request
+	double GetBudget() { return budgetMs; }
+
+	// Starts a new capture as soon as the current one (and its
+	// blend) is finished
+	void RequestCapture() { requested = true; }
+
+	// Advances the blend and runs as many steps as fit this frame
+	void Update(float deltaTime, const StepFunction& execute);
+
+	// Measured cost of a step that returned true from execute
+	void ReportStepCost(const CaptureStep& step, double ms);
+
+	// Probes: -1 means there isn't one yet (use whatever the
+	// scene had before the first capture)
+	int GetCurrentProbe() { return currentProbe; }
+	int GetPreviousProbe() { return previousProbe; }
+	int GetTargetProbe() { return currentProbe == 0 ? 1 : 0; }
+	float GetBlend() { return blend; }	// 0 = previous probe, 1 = current
+	bool IsCapturing() { return capturing; }
+
+	// The steps of one capture, in order
+	unsigned int GetStepCount() { return (unsigned int)steps.size(); }
+	const CaptureStep& GetStep(unsigned int index) { return steps[index]; }
+	double GetStepEstimate(const CaptureStep& step);	// < 0 = not measured yet
+
+	// Stats
+	unsigned int GetCaptureCount() { return captureCount; }
+	unsigned int GetLastCaptureFrames() { return lastCaptureFrames; }
+	double GetLastFrameMs() { return lastFrameMs; }
+	unsigned int GetLastFrameSteps() { return lastFrameSteps; }
+	double GetMaxFrameMs() { return maxFrameMs; }
+
+private:
+	int mipCount;
+	std::function<double()> clock;
+	std::vector<CaptureStep> steps;
+	std::vector<double> estimates;	// [type * mipCount + mip]
+
+	double budgetMs;
+	float blendTime;
+	float interval;
+
+	bool requested;
+	bool capturing;
+	unsigned int nextStep;
+	unsigned int captureFrames;
+	float sinceCapture;
+
+	int currentProbe;
+	int previousProbe;
+	float blend;
+
+	unsigned int captureCount;
+	unsigned int lastCaptureFrames;
+	double lastFrameMs;
+	unsigned int lastFrameSteps;
+	double maxFrameMs;
+
+	double& Estimate(const CaptureStep& step);
+};
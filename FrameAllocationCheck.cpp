@@ -0,0 +1,111 @@
+// --------------------------------------------------------
+// Offline tool: checks that frames in steady state make no
+// heap allocations (excluded from the game build).  The demo
+// scene (see DemoScene) is drawn on the null device - the
+// CPU side of the game's frame - through the job system,
+// and every operator new is counted (see AllocationCounter).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread FrameAllocationCheck.cpp AllocationCounter.cpp CameraPath.cpp DemoScene.cpp JobSystem.cpp Profiler.cpp NullRenderDevice.cpp ShadowCascades.cpp LightClusterGrid.cpp Benchmark.cpp -o FrameAllocationCheck
+//   ./FrameAllocationCheck
+//
+// Options:
+//   --warmup N      Frames before counting (default 100)
+//   --frames N      Frames counted (default 200)
+//   --stress N      Stress cubes (default 1000)
+//   --threads N     Job system threads (default: one per core)
+//
+// Fails (returns 1) if a counted frame allocates from the
+// heap, listing the first few.  The
+// warm-up has to go past Profiler::FrameCount, as each frame
+// the profiler keeps grows its lists the first time round.
+// --------------------------------------------------------
+
+#include "AllocationCounter.h"
+#include "CameraPath.h"
+#include "DemoScene.h"
+#include "JobSystem.h"
+#include "NullRenderDevice.h"
+#include "Profiler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char* argv[])
+{
+	int warmupFrames = 100;
+	int frames = 200;
+	int stressEntities = 1000;
+	int threads = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--warmup") == 0 && hasValue)
+			warmupFrames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && hasValue)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--stress") == 0 && hasValue)
+			stressEntities = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--threads") == 0 && hasValue)
+			threads = atoi(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+	if (warmupFrames < 0 || frames <= 0 || stressEntities < 0 || threads < 0)
+	{
+		printf("Frames, stress and threads can't be negative\n");
+		return 2;
+	}
+
+	JobSystem jobs(threads > 0 ? threads - 1 : -1);
+	NullRenderDevice device;
+
+	DemoScene scene;
+	scene.SetParallelFor(jobs.GetParallelFor());
+	if (!scene.Create(&device, 1280, 720, 12, stressEntities))
+		return 2;
+
+	CameraPath path;
+	path.MakeOrbit(8.0f, 2.0f, 20.0f, 8);
+
+	printf("%d entities, %d lights, %d thread(s): %d frames after %d warm-up\n",
+		scene.GetEntityCount(), scene.GetLightCount(), jobs.GetThreadCount(), frames, warmupFrames);
+
+	Profiler::SetThreadName("Main");
+	int failedFrames = 0;
+	unsigned long long totalAllocations = 0;
+	for (int frame = 0; frame < warmupFrames + frames; frame++)
+	{
+		unsigned long long before = AllocationCounter::GetCount();
+		float time = frame / 60.0f;
+		CameraKey camera;
+		path.Sample(time, camera);
+		scene.Render(time, &camera);
+		device.GetNullImmediateContext()->Reset();
+		Profiler::EndFrame();
+
+		if (frame < warmupFrames)
+			continue;
+		unsigned long long allocations = AllocationCounter::GetCount() - before;
+		totalAllocations += allocations;
+		if (allocations > 0)
+		{
+			if (failedFrames < 10)
+				printf("Frame %d: %llu heap allocation(s)\n", frame, allocations);
+			failedFrames++;
+		}
+	}
+
+	printf("%llu heap allocation(s) in %d frames\n", totalAllocations, frames);
+	if (failedFrames > 0)
+	{
+		printf("FAILED: %d frame(s) allocated\n", failedFrames);
+		return 1;
+	}
+	printf("Passed\n");
+	return 0;
+}
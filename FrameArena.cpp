@@ -0,0 +1,124 @@
+#include "FrameArena.h"
+
+#include <stdlib.h>
+
+LinearArena::LinearArena(size_t capacity)
+{
+	memory = capacity > 0 ? (char*)malloc(capacity) : 0;
+	this->capacity = memory ? capacity : 0;
+	used = 0;
+	highWater = 0;
+	overflowBytes = 0;
+	overflowCount = 0;
+}
+
+LinearArena::~LinearArena()
+{
+	for (size_t b = 0; b < overflow.size(); b++)
+		free(overflow[b]);
+	free(memory);
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment)
+{
+	if (size == 0)
+		size = 1;
+
+	// Alignments are powers of two
+	size_t start = (used + alignment - 1) & ~(alignment - 1);
+	if (start + size <= capacity)
+	{
+		used = start + size;
+		return memory + start;
+	}
+
+	// Full: from the heap until the next Reset().  malloc is
+	// aligned enough for anything but SIMD types past 16 bytes.
+	void* block = malloc(size);
+	overflow.push_back(block);
+	overflowBytes += size + alignment;
+	overflowCount++;
+	return block;
+}
+
+void LinearArena::Free(void* block, size_t size)
+{
+	// Only the latest, while it's still at the end
+	if ((char*)block + size == memory + used && (char*)block >= memory)
+		used = (char*)block - memory;
+}
+
+void LinearArena::Reset()
+{
+	size_t total = used + overflowBytes;
+	if (total > highWater)
+		highWater = total;
+
+	for (size_t b = 0; b < overflow.size(); b++)
+		free(overflow[b]);
+	overflow.clear();
+
+	// Grown (with some room) so what just overflowed fits
+	if (overflowBytes > 0)
+	{
+		free(memory);
+		capacity = highWater + highWater / 4;
+		memory = (char*)malloc(capacity);
+		if (!memory)
+			capacity = 0;
+	}
+
+	used = 0;
+	overflowBytes = 0;
+}
+
+FrameArena::FrameArena(int framesInFlight, int threadCount, size_t mainCapacity, size_t threadCapacity)
+{
+	if (framesInFlight < 1)
+		framesInFlight = 1;
+	if (framesInFlight > MaxFramesInFlight)
+		framesInFlight = MaxFramesInFlight;
+	if (threadCount < 1)
+		threadCount = 1;
+
+	this->framesInFlight = framesInFlight;
+	this->threadCount = threadCount;
+	current = 0;
+	for (int f = 0; f < framesInFlight; f++)
+	{
+		for (int t = 0; t < threadCount; t++)
+			arenas.push_back(new LinearArena(t == 0 ? mainCapacity : threadCapacity));
+	}
+}
+
+FrameArena::~FrameArena()
+{
+	for (size_t a = 0; a < arenas.size(); a++)
+		delete arenas[a];
+}
+
+void FrameArena::BeginFrame()
+{
+	current = (current + 1) % framesInFlight;
+	for (int t = 0; t < threadCount; t++)
+		arenas[current * threadCount + t]->Reset();
+}
+
+size_t FrameArena::GetHighWater()
+{
+	size_t most = 0;
+	for (size_t a = 0; a < arenas.size(); a++)
+	{
+		if (arenas[a]->GetHighWater() > most)
+			most = arenas[a]->GetHighWater();
+	}
+	return most;
+}
+
+unsigned int FrameArena::GetOverflowCount()
+{
+	unsigned int count = 0;
+	for (size_t a = 0; a < arenas.size(); a++)
+		count += arenas[a]->GetOverflowCount();
+	return count;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------
+// Memory handed out by bumping an offset through one block,
+// and given back all at once by Reset().  Nothing is freed
+// on its own (Free only takes back the latest allocation, so
+// a container growing at the end doesn't waste it).
+//
+// Running out doesn't fail: the rest of the frame's requests
+// come from the heap, and the next Reset() grows the block
+// to the most that was used, so a frame that's been seen
+// once fits after that.
+//
+// Not thread safe - each thread gets its own (see
+// FrameArena).
+// --------------------------------------------------------
+class LinearArena
+{
+public:
+	LinearArena(size_t capacity = 0);
+	~LinearArena();
+
+	void* Allocate(size_t size, size_t alignment = 16);
+	void Free(void* memory, size_t size);
+	void Reset();
+
+	size_t GetUsed() { return used + overflowBytes; }
+	size_t GetCapacity() { return capacity; }
+	size_t GetHighWater() { return highWater; }			// Most used before a Reset()
+	unsigned int GetOverflowCount() { return overflowCount; }	// Heap allocations, ever
+
+private:
+	char* memory;
+	size_t capacity;
+	size_t used;
+	size_t highWater;
+
+	std::vector<void*> overflow;		// From the heap, freed by Reset()
+	size_t overflowBytes;
+	unsigned int overflowCount;
+
+	LinearArena(const LinearArena&);
+	LinearArena& operator=(const LinearArena&);
+};
+
+// --------------------------------------------------------
+// The frame's transient memory: a LinearArena per thread
+// (0 is the main thread; the rest are JobSystem threads, see
+// JobSystem::GetThreadIndex) for each frame in flight.
+// BeginFrame() moves on to the next frame's set and resets
+// it, so what a frame allocates stays valid until as many
+// frames later as there can be in flight - long enough for
+// anything the GPU or a deferred command list reads.
+// --------------------------------------------------------
+class FrameArena
+{
+public:
+	static const int MaxFramesInFlight = 3;
+
+	FrameArena(int framesInFlight, int threadCount, size_t mainCapacity, size_t threadCapacity);
+	~FrameArena();
+
+	void BeginFrame();
+
+	// This frame's arena for a thread
+	LinearArena& Get(int thread = 0) { return *arenas[current * threadCount + thread]; }
+
+	int GetFramesInFlight() { return framesInFlight; }
+	int GetThreadCount() { return threadCount; }
+
+	// Over every frame's arenas
+	size_t GetHighWater();
+	unsigned int GetOverflowCount();
+
+private:
+	int framesInFlight;
+	int threadCount;
+	int current;
+	std::vector<LinearArena*> arenas;	// Frame-major
+};
+
+// --------------------------------------------------------
+// Lets STL containers allocate from a LinearArena.  The
+// container must be gone (or cleared and unused) before the
+// arena is reset.
+// --------------------------------------------------------
+template <typename T>
+class ArenaAllocator
+{
+public:
+	typedef T value_type;
+
+	ArenaAllocator(LinearArena* arena) : arena(arena) {}
+	template <typename U> ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+	T* allocate(size_t count) { return (T*)arena->Allocate(count * sizeof(T), alignof(T)); }
+	void deallocate(T* memory, size_t count) { arena->Free(memory, count * sizeof(T)); }
+
+	LinearArena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.arena == b.arena; }
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.arena != b.arena; }
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>> ArenaString;
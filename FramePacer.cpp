@@ -0,0 +1,303 @@
+#include "FramePacer.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+
+// --------------------------------------------------------
+// Sets up an unlimited pacer (no target rate, no fence)
+//
+// clock - Current time in milliseconds (default: steady_clock)
+// sleep - Sleeps for roughly this many milliseconds, or just
+//         yields for 0 (default: the standard library's)
+// --------------------------------------------------------
+FramePacer::FramePacer(Clock clock, Sleep sleep)
+{
+	this->clock = clock;
+	if (!this->clock)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		this->clock = [start]()
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+	}
+
+	this->sleep = sleep;
+	if (!this->sleep)
+	{
+		this->sleep = [](double ms)
+		{
+			if (ms > 0)
+				std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(ms));
+			else
+				std::this_thread::yield();
+		};
+	}
+
+	targetFps = 0;
+	periodMs = 0;
+	maxFramesInFlight = 2;
+	spinThresholdMs = 2.0;
+	fenceTimeoutMs = 250.0;
+
+	frameIndex = 0;
+	gpuDoneFrames = 0;
+	deadline = -1;
+	for (int i = 0; i < TimelineCount; i++)
+	{
+		FrameTimeline none = { ~0ull, -1, -1, -1, -1, -1, -1, -1 };
+		timelines[i] = none;
+	}
+
+	sleptMs = 0;
+	spunMs = 0;
+	fenceWaits = 0;
+	fenceTimeouts = 0;
+	missedDeadlines = 0;
+}
+
+void FramePacer::SetTargetFps(double fps)
+{
+	targetFps = fps > 0 ? fps : 0;
+	periodMs = targetFps > 0 ? 1000.0 / targetFps : 0;
+	deadline = -1;	// Start the new schedule from the next frame
+}
+
+unsigned long long FramePacer::GetFramesInFlight()
+{
+	return fence ? frameIndex - gpuDoneFrames : 0;
+}
+
+// --------------------------------------------------------
+// Waits for the GPU (if too many frames are queued) and then
+// for this frame's slot at the target rate
+// --------------------------------------------------------
+void FramePacer::BeginFrame()
+{
+	FrameTimeline& timeline = Current();
+	timeline.Frame = frameIndex;
+	timeline.Start = clock();
+	timeline.Paced = -1;
+	timeline.InputSampled = -1;
+	timeline.Simulated = -1;
+	timeline.Submitted = -1;
+	timeline.Presented = -1;
+	timeline.GpuDone = -1;
+
+	WaitForFramesInFlight();
+
+	if (periodMs > 0)
+	{
+		// A frame that ran more than a whole period over doesn't
+		// get its missed slots back - they'd just come in a burst
+		double now = clock();
+		if (deadline < 0 || now > deadline + periodMs)
+		{
+			if (deadline >= 0)
+				missedDeadlines++;
+			deadline = now;
+		}
+
+		WaitUntil(deadline);
+		deadline += periodMs;
+	}
+
+	timeline.Paced = clock();
+}
+
+void FramePacer::MarkInputSampled()
+{
+	Current().InputSampled = clock();
+}
+
+void FramePacer::MarkSimulated()
+{
+	Current().Simulated = clock();
+}
+
+void FramePacer::MarkSubmitted()
+{
+	Current().Submitted = clock();
+}
+
+void FramePacer::EndFrame()
+{
+	Current().Presented = clock();
+	frameIndex++;
+	PollFence();
+}
+
+// --------------------------------------------------------
+// Notes the time of every frame the GPU has finished since
+// the last poll.  Frames finish in order, so it stops at the
+// first one still running.
+// --------------------------------------------------------
+void FramePacer::PollFence()
+{
+	if (!fence)
+		return;
+
+	while (gpuDoneFrames < frameIndex && fence(gpuDoneFrames))
+	{
+		FrameTimeline& timeline = timelines[gpuDoneFrames % TimelineCount];
+		if (timeline.Frame == gpuDoneFrames)
+			timeline.GpuDone = clock();
+		gpuDoneFrames++;
+	}
+}
+
+// --------------------------------------------------------
+// Sleeps until the spin threshold, then spins to the deadline
+// --------------------------------------------------------
+void FramePacer::WaitUntil(double time)
+{
+	for (;;)
+	{
+		double now = clock();
+		double remaining = time - now;
+		if (remaining <= 0)
+			return;
+
+		if (remaining > spinThresholdMs)
+		{
+			sleep(remaining - spinThresholdMs);
+			sleptMs += clock() - now;
+			continue;
+		}
+
+		while (clock() < time)
+		{
+		}
+		spunMs += clock() - now;
+		return;
+	}
+}
+
+// --------------------------------------------------------
+// Holds the CPU back until fewer than MaxFramesInFlight frames
+// are queued on the GPU.  There's no telling when the GPU will
+// finish, so this just yields between polls.
+// --------------------------------------------------------
+void FramePacer::WaitForFramesInFlight()
+{
+	if (!fence)
+		return;
+
+	PollFence();
+	if (frameIndex - gpuDoneFrames < (unsigned long long)maxFramesInFlight)
+		return;
+
+	fenceWaits++;
+	double start = clock();
+	while (frameIndex - gpuDoneFrames >= (unsigned long long)maxFramesInFlight)
+	{
+		if (clock() - start > fenceTimeoutMs)
+		{
+			// Don't hang on a GPU that's never going to answer -
+			// act as if it finished
+			fenceTimeouts++;
+			gpuDoneFrames = frameIndex - maxFramesInFlight + 1;
+			return;
+		}
+
+		sleep(0);
+		PollFence();
+	}
+}
+
+void FramePacer::GetTimelines(std::vector<FrameTimeline>& result)
+{
+	result.clear();
+	unsigned long long first = frameIndex > TimelineCount ? frameIndex - TimelineCount : 0;
+	for (unsigned long long frame = first; frame < frameIndex; frame++)
+		result.push_back(timelines[frame % TimelineCount]);
+}
+
+double FramePacer::GetAverageLatencyMs()
+{
+	std::vector<FrameTimeline> frames;
+	GetTimelines(frames);
+
+	double total = 0;
+	int count = 0;
+	for (size_t i = 0; i < frames.size(); i++)
+	{
+		if (frames[i].GpuDone >= 0 && frames[i].InputSampled >= 0)
+		{
+			total += frames[i].GetLatencyMs();
+			count++;
+		}
+	}
+	return count > 0 ? total / count : 0;
+}
+
+double FramePacer::GetAverageWaitMs()
+{
+	std::vector<FrameTimeline> frames;
+	GetTimelines(frames);
+
+	double total = 0;
+	for (size_t i = 0; i < frames.size(); i++)
+		total += frames[i].GetWaitMs();
+	return frames.empty() ? 0 : total / frames.size();
+}
+
+// --------------------------------------------------------
+// Writes the kept frames as a Chrome trace (chrome://tracing
+// or ui.perfetto.dev): each frame's stages on a CPU track,
+// and the time from Present() to the GPU finishing on a GPU
+// track, so latency shows up as the gap between them
+// --------------------------------------------------------
+bool FramePacer::WriteChromeTrace(const char* path)
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "w");
+#else
+	file = fopen(path, "w");
+#endif
+	if (!file)
+		return false;
+
+	std::vector<FrameTimeline> frames;
+	GetTimelines(frames);
+
+	fprintf(file, "{\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"CPU\"}},\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"GPU (after Present)\"}}");
+
+	for (size_t i = 0; i < frames.size(); i++)
+	{
+		const FrameTimeline& frame = frames[i];
+		struct Stage { const char* Name; double Begin; double End; int Track; };
+		const Stage stages[] =
+		{
+			{ "Wait",		frame.Start,		frame.Paced,		0 },
+			{ "Input",		frame.Paced,		frame.InputSampled,	0 },
+			{ "Simulate",	frame.InputSampled,	frame.Simulated,	0 },
+			{ "Render",		frame.Simulated,	frame.Submitted,	0 },
+			{ "Present",	frame.Submitted,	frame.Presented,	0 },
+			{ "Frame",		frame.Presented,	frame.GpuDone,		1 },
+		};
+
+		// One complete ("X") event per stage, times in microseconds
+		for (int s = 0; s < (int)(sizeof(stages) / sizeof(stages[0])); s++)
+		{
+			if (stages[s].Begin < 0 || stages[s].End < stages[s].Begin)
+				continue;
+			fprintf(file,
+				",\n{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%llu,\"latency_ms\":%.3f}}",
+				stages[s].Name,
+				stages[s].Track,
+				stages[s].Begin * 1000.0,
+				(stages[s].End - stages[s].Begin) * 1000.0,
+				frame.Frame,
+				frame.GetLatencyMs());
+		}
+	}
+
+	fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	fclose(file);
+	return true;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+// When each part of one frame happened, in clock milliseconds.
+// Anything that hasn't happened (yet) is -1.
+struct FrameTimeline
+{
+	unsigned long long Frame;
+	double Start;			// BeginFrame() was called
+	double Paced;			// ... and returned (after waiting)
+	double InputSampled;	// Messages / input read for this frame
+	double Simulated;		// Update() done
+	double Submitted;		// Draw calls done, about to Present
+	double Presented;		// Present() returned
+	double GpuDone;			// First time the frame's fence was seen signalled
+
+	double GetWaitMs() const { return Paced - Start; }
+	double GetLatencyMs() const { return GpuDone >= 0 ? GpuDone - InputSampled : -1; }	// Input to GPU finished
+};
+
+// --------------------------------------------------------
+// Paces the game loop: holds each frame back until its slot
+// at the target rate, and until the GPU has fewer than
+// MaxFramesInFlight frames queued, so the CPU doesn't run
+// ahead (piling up latency) or burn a core spinning.
+//
+// Waiting sleeps until SpinThreshold before the deadline -
+// the OS wakes threads late - then spins the rest of the way.
+// The deadline advances by one period each frame, so pacing
+// doesn't drift, but if a frame runs over by more than a
+// period the schedule restarts from now instead of rushing
+// to catch up.
+//
+// Every frame's timeline (input, simulation, submit, present
+// and GPU completion) is kept in a ring of the last few
+// hundred frames, for latency stats and a Chrome trace.
+//
+// Time, sleeping and the GPU fence are all callbacks, so the
+// pacing can run against a fake clock with no device.
+// --------------------------------------------------------
+class FramePacer
+{
+public:
+	typedef std::function<double()> Clock;					// Current time in milliseconds
+	typedef std::function<void(double ms)> Sleep;			// Sleeps (at least roughly) this long; 0 yields
+	typedef std::function<bool(unsigned long long frame)> FrameFence;	// Has the GPU finished this frame?
+
+	// clock - Default: steady_clock
+	// sleep - Default: std::this_thread::sleep_for / yield
+	FramePacer(Clock clock = Clock(), Sleep sleep = Sleep());
+
+	// 0 = no limit (only frames in flight hold the CPU back)
+	void SetTargetFps(double fps);
+	double GetTargetFps() { return targetFps; }
+
+	// Frames Present()ed but not finished on the GPU before
+	// BeginFrame() waits.  Needs a fence to do anything.
+	void SetMaxFramesInFlight(int frames) { maxFramesInFlight = frames > 0 ? frames : 1; }
+	int GetMaxFramesInFlight() { return maxFramesInFlight; }
+	void SetFrameFence(const FrameFence& fence) { this->fence = fence; }
+
+	// How close to the deadline sleeping stops and spinning starts
+	void SetSpinThreshold(double ms) { spinThresholdMs = ms > 0 ? ms : 0; }
+
+	// Longest BeginFrame() waits on the fence before giving up
+	// (e.g. a lost device), so the loop can never hang
+	void SetFenceTimeout(double ms) { fenceTimeoutMs = ms; }
+
+	// The frame's markers, in order
+	void BeginFrame();			// Waits for the frame's slot
+	void MarkInputSampled();
+	void MarkSimulated();
+	void MarkSubmitted();
+	void EndFrame();			// After Present() (and the frame's fence)
+
+	unsigned long long GetFrameIndex() { return frameIndex; }	// The frame being built
+	unsigned long long GetFramesInFlight();
+
+	// The last completed frames' timelines, oldest first
+	// (GpuDone may still be -1 for the newest ones)
+	void GetTimelines(std::vector<FrameTimeline>& timelines);
+
+	// Stats over the frames GetTimelines() returns
+	double GetAverageLatencyMs();
+	double GetAverageWaitMs();
+
+	// Totals
+	double GetSleptMs() { return sleptMs; }
+	double GetSpunMs() { return spunMs; }
+	unsigned int GetFenceWaits() { return fenceWaits; }		// Frames held back by the GPU
+	unsigned int GetFenceTimeouts() { return fenceTimeouts; }
+	unsigned int GetMissedDeadlines() { return missedDeadlines; }	// Frames that ran over a whole period
+
+	bool WriteChromeTrace(const char* path);
+
+private:
+	Clock clock;
+	Sleep sleep;
+	FrameFence fence;
+
+	double targetFps;
+	double periodMs;
+	int maxFramesInFlight;
+	double spinThresholdMs;
+	double fenceTimeoutMs;
+
+	unsigned long long frameIndex;
+	unsigned long long gpuDoneFrames;	// Frames below this are known to be finished
+	double deadline;					// When the next frame may start (<0 = not yet scheduled)
+
+	static const int TimelineCount = 256;
+	FrameTimeline timelines[TimelineCount];
+	FrameTimeline& Current() { return timelines[frameIndex % TimelineCount]; }
+
+	double sleptMs;
+	double spunMs;
+	unsigned int fenceWaits;
+	unsigned int fenceTimeouts;
+	unsigned int missedDeadlines;
+
+	void PollFence();
+	void WaitUntil(double time);
+	void WaitForFramesInFlight();
+};
@@ -0,0 +1,320 @@
+// --------------------------------------------------------
+// Offline tool: runs the frame pacer (see FramePacer) against
+// a fake clock, a fake sleep that wakes late and a fake GPU,
+// and checks when each frame is let go (excluded from the
+// game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 FramePacerCheck.cpp FramePacer.cpp -o FramePacerCheck
+//   ./FramePacerCheck
+//
+// Options: --frames N (per scenario, default 2000) and --fps N
+// (target rate, default 60).
+//
+// Fails (returns 1) if a frame starts before its deadline or
+// late by more than the clock's resolution, if the pacer
+// drifts, if it spins for longer than the spin threshold or
+// sleeps into it, if a stall isn't followed by a fresh
+// schedule (or a small overrun is), if BeginFrame() returns
+// with MaxFramesInFlight frames still on the GPU, or if a GPU
+// that never finishes holds it up for anything but the fence
+// timeout (250ms by default).
+// --------------------------------------------------------
+
+#include "FramePacer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+static int failures = 0;
+
+static void Check(bool ok, const char* scenario, unsigned long long frame, const char* what, double value)
+{
+	if (!ok)
+	{
+		if (failures < 20)
+			printf("  FAILED (%s, frame %llu): %s (%g)\n", scenario, frame, what, value);
+		failures++;
+	}
+}
+
+// Each read of the clock takes this long, so spinning ends
+static const double Tick = 0.001;
+
+// The fake machine: time, a sleep that wakes up late (but
+// within the spin threshold) and a GPU that runs frames one
+// after another
+struct FakeMachine
+{
+	double Now;
+	std::mt19937 Random;
+	double MaxOversleep;
+
+	// Sleeps asked for during the current wait: when it was
+	// asked and for how long
+	struct SleepCall { double At; double Ms; };
+	std::vector<SleepCall> Sleeps;
+
+	double GpuMs;						// Per frame, 0 = no GPU
+	bool GpuHung;						// Never finishes anything
+	std::vector<double> GpuFinish;		// Per presented frame
+
+	FakeMachine() : Now(0), Random(41), MaxOversleep(1.5), GpuMs(0), GpuHung(false) {}
+
+	double Clock()
+	{
+		Now += Tick;
+		return Now;
+	}
+
+	void Sleep(double ms)
+	{
+		SleepCall call = { Now, ms };
+		Sleeps.push_back(call);
+		if (ms <= 0)
+		{
+			Now += 0.05;	// A yield
+			return;
+		}
+		std::uniform_real_distribution<double> late(0.0, MaxOversleep);
+		Now += ms + late(Random);
+	}
+
+	// The frame just presented goes on the GPU after the one
+	// before it
+	void Present()
+	{
+		double start = GpuFinish.empty() ? Now : GpuFinish.back();
+		if (start < Now)
+			start = Now;
+		GpuFinish.push_back(start + GpuMs);
+	}
+
+	bool Fence(unsigned long long frame)
+	{
+		return !GpuHung && frame < GpuFinish.size() && GpuFinish[(size_t)frame] <= Now;
+	}
+
+	// Frames presented that the GPU hasn't finished
+	int InFlight()
+	{
+		int count = 0;
+		for (size_t f = 0; f < GpuFinish.size(); f++)
+		{
+			if (GpuHung || GpuFinish[f] > Now)
+				count++;
+		}
+		return count;
+	}
+
+	void Work(double ms) { Now += ms; }
+};
+
+struct Scenario
+{
+	const char* Name;
+	double WorkMs;			// CPU time of a frame (plus the odd stall)
+	double GpuMs;			// 0 = no fence
+	int MaxInFlight;
+	bool GpuHung;
+	double FenceTimeout;	// 0 = leave the default
+};
+
+static const Scenario Scenarios[] =
+{
+	{ "paced",			5.0,	0.0,	2,	false,	0 },
+	{ "stalls",			5.0,	0.0,	2,	false,	0 },
+	{ "gpu bound",		2.0,	30.0,	2,	false,	0 },
+	{ "one in flight",	2.0,	30.0,	1,	false,	0 },
+	{ "three in flight",2.0,	30.0,	3,	false,	0 },
+	{ "gpu hung",		2.0,	5.0,	2,	true,	0 },
+	{ "short timeout",	2.0,	5.0,	2,	true,	40.0 },
+};
+
+static void RunScenario(const Scenario& scenario, double fps, int frames)
+{
+	FakeMachine machine;
+	machine.GpuMs = scenario.GpuMs;
+
+	FramePacer pacer([&machine]() { return machine.Clock(); }, [&machine](double ms) { machine.Sleep(ms); });
+	pacer.SetTargetFps(fps);
+	pacer.SetMaxFramesInFlight(scenario.MaxInFlight);
+	if (scenario.GpuMs > 0)
+		pacer.SetFrameFence([&machine](unsigned long long frame) { return machine.Fence(frame); });
+	if (scenario.FenceTimeout > 0)
+		pacer.SetFenceTimeout(scenario.FenceTimeout);
+
+	double period = 1000.0 / fps;
+	double threshold = 2.0;
+	pacer.SetSpinThreshold(threshold);
+	double fenceTimeout = scenario.FenceTimeout > 0 ? scenario.FenceTimeout : 250.0;
+
+	bool stalls = strcmp(scenario.Name, "stalls") == 0;
+	bool gpuBound = scenario.GpuMs > period;
+
+	double scheduleStart = -1;		// Where the current run of deadlines began
+	unsigned long long scheduleFrame = 0;
+	double lastPaced = -1;
+	unsigned int restarts = 0;
+	bool stalledLastFrame = false;
+	bool overranLastFrame = false;
+
+	for (int f = 0; f < frames; f++)
+	{
+		unsigned long long frame = pacer.GetFrameIndex();
+		if (scenario.GpuHung && f == frames / 2)
+			machine.GpuHung = true;
+
+		machine.Sleeps.clear();
+		double sleptBefore = pacer.GetSleptMs();
+		double spunBefore = pacer.GetSpunMs();
+		unsigned int missedBefore = pacer.GetMissedDeadlines();
+		unsigned int timeoutsBefore = pacer.GetFenceTimeouts();
+		double start = machine.Now;
+
+		pacer.BeginFrame();
+		double paced = machine.Now;
+
+		// Never more than the limit still on the GPU
+		if (scenario.GpuMs > 0 && !machine.GpuHung)
+			Check(machine.InFlight() < scenario.MaxInFlight, scenario.Name, frame, "BeginFrame() returned with too many frames in flight", machine.InFlight());
+
+		// A hung GPU holds the frame for the fence timeout, no
+		// more (and no less)
+		if (pacer.GetFenceTimeouts() != timeoutsBefore)
+		{
+			Check(machine.GpuHung, scenario.Name, frame, "fence timed out on a working GPU", 0);
+			double waited = paced - start;
+			Check(waited >= fenceTimeout && waited <= fenceTimeout + period + 1.0, scenario.Name, frame, "hung GPU held the frame for", waited);
+		}
+		if (machine.GpuHung)
+			Check(paced - start <= fenceTimeout + period + 1.0, scenario.Name, frame, "hung GPU held the frame for", paced - start);
+
+		// Sleeps come first and stop short of the spin threshold;
+		// the spin only covers what's left
+		double spun = pacer.GetSpunMs() - spunBefore;
+		Check(spun <= threshold + 0.01, scenario.Name, frame, "spun for longer than the spin threshold", spun);
+		for (size_t s = 0; s < machine.Sleeps.size(); s++)
+		{
+			const FakeMachine::SleepCall& call = machine.Sleeps[s];
+			if (call.Ms > 0 && lastPaced >= 0 && scheduleStart >= 0)
+			{
+				double deadline = scheduleStart + (frame - scheduleFrame) * period;
+				Check(call.At + call.Ms <= deadline - threshold + 0.01, scenario.Name, frame, "slept into the spin threshold", call.At + call.Ms - (deadline - threshold));
+			}
+		}
+		double waitedForSlot = paced - start;
+		if (!gpuBound && !machine.GpuHung && waitedForSlot > threshold + 1.0)
+			Check(pacer.GetSleptMs() > sleptBefore, scenario.Name, frame, "a long wait didn't sleep", waitedForSlot);
+
+		// The schedule restarts only when a frame ran a whole
+		// period over, and then from when it was let go.  (Waiting
+		// on the GPU for that long counts as running over.)
+		bool restarted = pacer.GetMissedDeadlines() != missedBefore;
+		bool heldByGpu = gpuBound || pacer.GetFenceTimeouts() != timeoutsBefore;
+		if (restarted || scheduleStart < 0)
+		{
+			if (restarted && !heldByGpu)
+			{
+				restarts++;
+				Check(stalledLastFrame, scenario.Name, frame, "schedule restarted without a stall", paced - lastPaced);
+				Check(paced - start < 0.1, scenario.Name, frame, "waited after a stall", paced - start);
+			}
+			scheduleStart = paced;
+			scheduleFrame = frame;
+		}
+		else if (overranLastFrame)
+		{
+			// Already past its deadline, but not by a whole period:
+			// goes straight away, keeping the schedule
+			Check(paced - start < 0.1, scenario.Name, frame, "waited after running over", paced - start);
+		}
+		else if (!heldByGpu)
+		{
+			// Let go at the deadline: never early, late only by a
+			// few clock reads, and no drift however many frames in
+			double deadline = scheduleStart + (frame - scheduleFrame) * period;
+			Check(paced >= deadline - 1e-9, scenario.Name, frame, "frame started before its deadline", deadline - paced);
+			Check(paced <= deadline + 0.01, scenario.Name, frame, "frame started late", paced - deadline);
+			if (stalledLastFrame)
+				Check(false, scenario.Name, frame, "no restart after a stall", paced - lastPaced);
+		}
+		lastPaced = paced;
+
+		// The frame itself, now and then running a little over
+		// (catches up) or way over (starts a new schedule)
+		pacer.MarkInputSampled();
+		double work = scenario.WorkMs;
+		stalledLastFrame = false;
+		overranLastFrame = false;
+		if (stalls && f % 97 == 50)
+		{
+			work = period * 3.5;
+			stalledLastFrame = true;
+		}
+		else if (stalls && f % 97 == 20)
+		{
+			work = period * 1.5;
+			overranLastFrame = true;
+		}
+		machine.Work(work * 0.6);
+		pacer.MarkSimulated();
+		machine.Work(work * 0.4);
+		pacer.MarkSubmitted();
+		machine.Present();
+		pacer.EndFrame();
+	}
+
+	if (stalls)
+		Check(restarts == pacer.GetMissedDeadlines() && restarts > 0, scenario.Name, pacer.GetFrameIndex(), "restarts", restarts);
+	if (scenario.GpuMs > 0 && !scenario.GpuHung && gpuBound)
+		Check(pacer.GetFenceWaits() > 0, scenario.Name, pacer.GetFrameIndex(), "a GPU bound loop never waited on the fence", 0);
+	if (scenario.GpuHung)
+		Check(pacer.GetFenceTimeouts() > 0, scenario.Name, pacer.GetFrameIndex(), "a hung GPU never timed out", 0);
+
+	double seconds = machine.Now / 1000.0;
+	printf("%-16s %8.1f %10.2f %10.2f %8u %8u %8u\n", scenario.Name, pacer.GetFrameIndex() / seconds,
+		pacer.GetSleptMs() / pacer.GetFrameIndex(), pacer.GetSpunMs() / pacer.GetFrameIndex(),
+		pacer.GetMissedDeadlines(), pacer.GetFenceWaits(), pacer.GetFenceTimeouts());
+}
+
+int main(int argc, char* argv[])
+{
+	int frames = 2000;
+	double fps = 60;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--frames") == 0 && hasValue)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--fps") == 0 && hasValue)
+			fps = atof(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+	if (frames < 100 || fps < 10 || fps > 150)
+	{
+		printf("Needs at least 100 frames and 10..150 fps\n");
+		return 2;
+	}
+
+	printf("%.0f fps target (%.2fms), %d frames per scenario\n\n", fps, 1000.0 / fps, frames);
+	printf("%-16s %8s %10s %10s %8s %8s %8s\n", "scenario", "fps", "slept/f", "spun/f", "missed", "fence", "timeout");
+	for (size_t s = 0; s < sizeof(Scenarios) / sizeof(Scenarios[0]); s++)
+		RunScenario(Scenarios[s], fps, frames);
+
+	if (failures > 0)
+	{
+		printf("\nFAILED: %d check(s)\n", failures);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
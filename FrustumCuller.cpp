@@ -0,0 +1,46 @@
+#include "FrustumCuller.h"
+
+#include <math.h>
+#include <string.h>
+
+FrustumCuller::FrustumCuller()
+{
+	// Everything's visible until there's a camera
+	memset(planes, 0, sizeof(planes));
+	for (int p = 0; p < 6; p++)
+		planes[p][3] = 1.0f;
+}
+
+// --------------------------------------------------------
+// The planes come straight out of the matrix's columns
+// (Gribb and Hartmann): a point's clip position is p * M, so
+// -w <= x is (column 3 + column 0) . p >= 0, and so on.
+// D3D's near plane is just 0 <= z.
+// --------------------------------------------------------
+void FrustumCuller::SetViewProjection(const float viewProjection[16])
+{
+	const float* m = viewProjection;
+	for (int i = 0; i < 4; i++)
+	{
+		float x = m[i * 4 + 0];
+		float y = m[i * 4 + 1];
+		float z = m[i * 4 + 2];
+		float w = m[i * 4 + 3];
+		planes[0][i] = w + x;
+		planes[1][i] = w - x;
+		planes[2][i] = w + y;
+		planes[3][i] = w - y;
+		planes[4][i] = z;
+		planes[5][i] = w - z;
+	}
+
+	for (int p = 0; p < 6; p++)
+	{
+		float length = sqrtf(planes[p][0] * planes[p][0] + planes[p][1] * planes[p][1] + planes[p][2] * planes[p][2]);
+		if (length > 0)
+		{
+			for (int i = 0; i < 4; i++)
+				planes[p][i] /= length;
+		}
+	}
+}
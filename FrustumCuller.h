@@ -0,0 +1,34 @@
+#pragma once
+
+// --------------------------------------------------------
+// Tests bounding spheres against a camera's frustum, for
+// building the frame's draw list.  The view-projection matrix
+// is row-major with row vectors, like XMMATRIX (not
+// transposed for HLSL), and clips z to [0, 1] as D3D does.
+//
+// Conservative: a sphere near a frustum corner can pass
+// without being inside, but nothing visible is ever culled.
+// --------------------------------------------------------
+class FrustumCuller
+{
+public:
+	FrustumCuller();
+
+	void SetViewProjection(const float viewProjection[16]);
+
+	bool IsVisible(const float center[3], float radius) const
+	{
+		for (int p = 0; p < 6; p++)
+		{
+			const float* plane = planes[p];
+			if (plane[0] * center[0] + plane[1] * center[1] + plane[2] * center[2] + plane[3] < -radius)
+				return false;
+		}
+		return true;
+	}
+
+private:
+	// Left, right, bottom, top, near, far: normalized, with
+	// the inside on the positive side
+	float planes[6][4];
+};
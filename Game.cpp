@@ -1,5 +1,12 @@
 #include "Game.h"
+#include "D3D11CommandRecordingBackend.h"
 #include "Vertex.h"
+#include "ShaderLibraryBaker.h"
+#include "TaskGraph.h"
+#include "SphericalHarmonics.h"
+#include "DDSFile.h"
+#include "BrdfLutData.h"
+#include <thread>
 #include "WICTextureLoader.h"
 #include "DDSTextureLoader.h"
 
@@ -14,7 +21,7 @@ using namespace DirectX;
 //
 // hInstance - the application's OS-level handle (unique ID)
 // --------------------------------------------------------
-Game::Game(HINSTANCE hInstance)
+Game::Game(HINSTANCE hInstance, const BenchmarkSettings& benchmarkSettings)
 	: DXCore( 
 		hInstance,		   // The application's handle
 		"DirectX Game",	   // Text for the window's title bar
@@ -23,8 +30,61 @@ Game::Game(HINSTANCE hInstance)
 		true)			   // Show extra stats (fps) in title bar?
 {
 	// Initialize fields
+	shaderLibrary = 0;
 	vertexShader = 0;
 	pixelShader = 0;
+	pixelPermutations = 0;
+	sceneMaterialKey = ShaderPermutation::MakeKey(2, PERMUTATION_SHADOWS | PERMUTATION_FOG | PERMUTATION_IBL | PERMUTATION_CLUSTERED);
+	pipelineStates = 0;
+	iblPrecompute = 0;
+	radianceSRV = 0;
+	brdfLutSRV = 0;
+	shadowCascadeCount = 0;
+	shadowTexture = 0;
+	staticShadowTexture = 0;
+	shadowAtlas = 0;
+	for (int c = 0; c < SHADOW_MAX_CASCADES; c++)
+	{
+		shadowDSVs[c] = 0;
+		staticShadowDSVs[c] = 0;
+	}
+	environmentCapture = 0;
+	skyRotation = 0;
+	clusteredLighting = 0;
+	recordingBackend = 0;
+	commandRecorder = 0;
+	renderGraphTextures = 0;
+	renderDevice = 0;
+	spotShadowAtlasResource = -1;
+	sceneColorResource = -1;
+	upscaleVS = 0;
+	upscalePS = 0;
+	upscaleSampler = 0;
+	upscalePSO = 0;
+	nextResolutionFrame = 0;
+	renderWidth = 0;
+	renderHeight = 0;
+	jobSystem = 0;
+	frameArena = 0;
+	benchmark = 0;
+	recordingPath = false;
+	recordKeyDown = false;
+	recordStartTime = 0;
+
+	// Benchmarks run flat out, at a fixed time step, so every run
+	// simulates the same frames
+	this->benchmarkSettings = benchmarkSettings;
+	if (benchmarkSettings.Enabled)
+	{
+		const BenchmarkScene* scene = FindBenchmarkScene(benchmarkSettings.Scene.c_str());
+		if (this->benchmarkSettings.StressEntities < 0)
+			this->benchmarkSettings.StressEntities = scene ? scene->StressEntities : 0;
+		this->benchmarkSettings.Backend = "d3d11";
+		fixedTimeStep = benchmarkSettings.TimeStep;
+		targetFps = 0;
+		backgroundFps = 0;
+	}
+	dynamicResolutionEnabled = !benchmarkSettings.Enabled;
 
 #if defined(DEBUG) || defined(_DEBUG)
 	// Do we want a console window?  Probably only in debug mode
@@ -47,8 +107,12 @@ Game::~Game()
 	// will clean up their own internal DirectX stuff
 	delete vertexShader;
 	delete pixelShader;
+	delete pixelPermutations;
 	delete skyVS;
 	delete skyPS;
+	delete upscaleVS;
+	delete upscalePS;
+	delete shaderLibrary;
 
 	//get rid of meshes when done
 	/*delete timmy;
@@ -59,6 +123,10 @@ Game::~Game()
 
 	delete one;
 	delete two;
+	delete three;
+	for (size_t s = 0; s < stressEntities.size(); s++)
+		delete stressEntities[s];
+	delete benchmark;
 
 	delete camNewton;
 
@@ -66,30 +134,60 @@ Game::~Game()
 
 	if (resource) { resource->Release(); }
 	if (freeSamples) { freeSamples->Release(); }
+	if (upscaleSampler) { upscaleSampler->Release(); }
 
 	//sampler->Release(); //come back in
 	//textureSRV->Release();
 	//normalMapSRV->Release();
 	skySRV->Release();
-	skyDepthState->Release();
-	skyRastState->Release();
+	if (radianceSRV) { radianceSRV->Release(); }
+	if (brdfLutSRV) { brdfLutSRV->Release(); }
+	delete environmentCapture;
+	delete iblPrecompute;
+
+#if defined(DEBUG) || defined(_DEBUG)
+	const ShadowCacheStats& shadowStats = shadowCache.GetTotalStats();
+	printf("\nShadow cache: %u static draws saved, %u made, %u dynamic\n", shadowStats.SavedDraws, shadowStats.StaticDraws, shadowStats.DynamicDraws);
+#endif
 
-	shadowDSV->Release();
+	for (int c = 0; c < SHADOW_MAX_CASCADES; c++)
+	{
+		if (shadowDSVs[c]) { shadowDSVs[c]->Release(); }
+		if (staticShadowDSVs[c]) { staticShadowDSVs[c]->Release(); }
+	}
+	if (shadowTexture) { shadowTexture->Release(); }
+	if (staticShadowTexture) { staticShadowTexture->Release(); }
+	delete shadowAtlas;
+	delete clusteredLighting;
+	delete commandRecorder;
+	delete recordingBackend;
+	delete renderGraphTextures;
+	delete frameArena;
+	delete jobSystem;
 	shadowSRV->Release();
-	shadowRasterizer->Release();
 	shadowSampler->Release();
-	rsNoCull->Release();
-	blendState->Release();
 	delete shadowVS;
+
+	// Releases the render states along with the pipeline states
+	delete pipelineStates;
+
+	// Last, since the meshes' buffers live in it
+	delete renderDevice;
 }
 
 // --------------------------------------------------------
 // Called once per program, after DirectX and the window
 // are initialized but before the game loop.
+//
+// Asset loading is split into tasks with explicit dependencies
+// and run on a startup task graph, so independent loads (shaders,
+// textures, meshes, render states) overlap.  The per-task timeline
+// is written to StartupTrace.json (open in chrome://tracing).
 // --------------------------------------------------------
 void Game::Init()
 {
-	shadowMapSize = 1024; //good default size
+	shadowSettings = ShadowCascadeSettings::Default();
+	shadowMapSize = shadowSettings.Resolution; //good default size
 	
 	camNewton = new Camera();
 
@@ -103,67 +201,367 @@ void Game::Init()
 	secondLight.DiffuseColor = XMFLOAT4(1.0f, 0.0f, 0.0f, 1.0f);
 	secondLight.Direction = XMFLOAT3(-1.0f, -1.0f, +0.0f);
 	//
-	/*spotMe.AmbientColor = XMFLOAT4(0.0f, 0.0f, 1.0f, 1.0f);
-	spotMe.Position = XMFLOAT3(1.0f, 0.0f, 0.0f);
-	spotMe.DiffuseIntensity = 2.0f;
-	spotMe.Direction = XMFLOAT3(-1.0f, +0.0f, +0.0f);*/
+	//spot lights around the cubes, shining down on them (each gets
+	//a shadow tile from the atlas - see UpdateSpotLights)
+	const XMFLOAT3 spotPositions[] = { XMFLOAT3(-3.0f, 3.0f, -1.0f), XMFLOAT3(3.0f, 3.0f, -1.0f), XMFLOAT3(0.0f, 3.0f, 3.0f) };
+	const XMFLOAT4 spotColors[] = { XMFLOAT4(1.0f, 0.8f, 0.5f, 1.0f), XMFLOAT4(0.5f, 1.0f, 0.5f, 1.0f), XMFLOAT4(0.8f, 0.6f, 1.0f, 1.0f) };
+	spotLightCount = 3;
+	memset(spotLights, 0, sizeof(spotLights));
+	for (int s = 0; s < spotLightCount; s++)
+	{
+		spotLights[s].DiffuseColor = spotColors[s];
+		spotLights[s].Position = spotPositions[s];
+		spotLights[s].Range = 10.0f;
+		XMStoreFloat3(&spotLights[s].Direction, XMVector3Normalize(XMVectorNegate(XMLoadFloat3(&spotPositions[s]))));
+		spotLights[s].CosOuterAngle = cosf(0.35f);
+		spotLights[s].CosInnerAngle = cosf(0.25f);
+	}
+	//
+	//a grid of little colored lights over the ground, half of
+	//them spots pointing down - too many for the cbuffer, so
+	//they go through the clusters
+	const BenchmarkScene* benchmarkScene = benchmarkSettings.Enabled ? FindBenchmarkScene(benchmarkSettings.Scene.c_str()) : 0;
+	const int sceneLightsPerSide = benchmarkScene ? benchmarkScene->LightsPerSide : 12;
+	sceneLights.resize(sceneLightsPerSide * sceneLightsPerSide);
+	sceneLightOrigins.resize(sceneLights.size());
+	memset(&sceneLights[0], 0, sceneLights.size() * sizeof(ClusterLight));
+	for (int i = 0; i < (int)sceneLights.size(); i++)
+	{
+		int x = i % sceneLightsPerSide;
+		int z = i / sceneLightsPerSide;
+		sceneLightOrigins[i] = XMFLOAT3(-9.0f + 18.0f * x / (sceneLightsPerSide - 1), -0.8f, -9.0f + 18.0f * z / (sceneLightsPerSide - 1));
+
+		ClusterLight& light = sceneLights[i];
+		light.Range = 2.0f;
+		light.Color[0] = 0.3f + 0.7f * (x % 3 == 0);
+		light.Color[1] = 0.3f + 0.7f * (x % 3 == 1);
+		light.Color[2] = 0.3f + 0.7f * (z % 2 == 0);
+		light.CosOuterAngle = -1.0f;
+		if (i % 2)
+		{
+			light.Direction[1] = -1.0f;
+			light.CosOuterAngle = cosf(0.6f);
+			light.CosInnerAngle = cosf(0.4f);
+		}
+	}
+
+	// Everything that draws through the render device needs it,
+	// so it's made before any startup task runs - as is the job
+	// system, which the frame's systems are hooked up to
+	renderDevice = new D3D11RenderDevice(device, context);
+	jobSystem = new JobSystem(benchmarkSettings.Threads > 0 ? benchmarkSettings.Threads - 1 : -1);
+	frameArena = new FrameArena(framePacer.GetMaxFramesInFlight(), jobSystem->GetThreadCount(), 256 * 1024, 64 * 1024);
+
+	// Dynamic resolution aims for most of a frame at the target
+	// rate, leaving the rest for everything that doesn't scale
+	if (targetFps > 0)
+		dynamicResolution.SetTargetMs(1000.0 / targetFps * 0.9);
+
+	// The device is free threaded, so resource creation can happen
+	// on workers.  Anything touching the immediate context (WIC mip
+	// generation, binding to shaders) is pinned to this thread.
+	TaskGraph startup;
+	int shaders		= startup.AddTask("LoadShaders",		[this]() { LoadShaders(); });
+	int diffuse		= startup.AddTask("LoadDiffuseTexture",	[this]() { LoadDiffuseTexture(); }, true);
+	int samplers	= startup.AddTask("CreateSamplers",		[this]() { CreateSamplers(); });
+	int meshes		= startup.AddTask("CreateBasicGeometry",	[this]() { CreateBasicGeometry(); });
+	int material	= startup.AddTask("CreateMaterials",		[this]() { CreateMaterials(); }, true);
+	int entities	= startup.AddTask("CreateEntities",		[this]() { CreateEntities(); });
+	int pipelines	= startup.AddTask("CreatePipelineStates",	[this]() { CreatePipelineStates(); });
+	int sky			= startup.AddTask("LoadSkyTexture",		[this]() { LoadSkyTexture(); });
+	int radiance	= startup.AddTask("PrefilterRadianceMap",	[this]() { PrefilterRadianceMap(); }, true);
+	int irradiance	= startup.AddTask("ProjectIrradiance",	[this]() { ProjectIrradiance(); });
+	int capture		= startup.AddTask("CreateEnvironmentCapture",	[this]() { CreateEnvironmentCapture(); }, true);
+	startup.AddTask("CreateBrdfLut",		[this]() { CreateBrdfLut(); });
+	startup.AddTask("CreateMatrices",		[this]() { CreateMatrices(); });
+	startup.AddTask("CreateShadowMap",		[this]() { CreateShadowMapResources(); });
+	startup.AddTask("CreateClusteredLighting",	[this]() { CreateClusteredLighting(); });
+	startup.AddTask("CreateCommandRecorder",	[this]() { CreateCommandRecorder(); });
+
+	// The material needs both its shaders and its texture
+	startup.AddDependency(material, shaders);
+	startup.AddDependency(material, diffuse);
+	startup.AddDependency(material, samplers);
+	startup.AddDependency(entities, material);
+	startup.AddDependency(entities, meshes);
+	startup.AddDependency(pipelines, material);
+	startup.AddDependency(radiance, sky);
+	startup.AddDependency(capture, radiance);
+	startup.AddDependency(capture, irradiance);
+
+	unsigned int cores = std::thread::hardware_concurrency();
+	startup.Run(cores > 1 ? cores - 1 : 1);
+	startup.WriteChromeTrace("StartupTrace.json");
+
+#if defined(DEBUG) || defined(_DEBUG)
+	// Print the critical path, since that's what bounds startup time
+	std::vector<int> path;
+	double criticalMs = startup.GetCriticalPath(path);
+	printf("\nStartup: %.2fms total, critical path %.2fms:", startup.GetTotalMs(), criticalMs);
+	for (unsigned int i = 0; i < path.size(); i++)
+		printf(" %s%s", startup.GetTaskName(path[i]), i + 1 < path.size() ? " ->" : "\n");
+#endif
+
+	// Materials may have compiled new shader variants - bake them
+	// into the library so the next launch loads them instead.  The
+	// shaders keep their own copy of the bytecode, so the mapping
+	// can be closed before the file is rewritten.
+	if (pixelPermutations->GetCompiledCount() > 0 && !shaderLibraryPath.empty())
+	{
+		shaderLibrary->Close();
+		BakeShaderLibrary(shaderLibraryPath.c_str());
+	}
+
+	// The radiance prefilter drew with its own states, so don't
+	// trust what the pipeline state cache thinks is bound
+	pipelineStates->Invalidate();
+
+	// The primitive topology (triangle list) is part of each
+	// pipeline state, so there's nothing else to set here
 
-	// Helper methods for loading shaders, creating some basic
-	// geometry to draw and some simple camera matrices.
-	//  - You'll be expanding and/or replacing these later
-	LoadShaders();
-	CreateMatrices();
-	CreateBasicGeometry();
+	// Measuring starts after the warmup frames, counted from here
+	if (benchmarkSettings.Enabled)
+	{
+		if (benchmarkSettings.CameraPath.empty())
+			cameraPath.MakeOrbit(8.0f, 2.0f, 20.0f, 8);
+		else if (!cameraPath.Load(benchmarkSettings.CameraPath.c_str()))
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			printf("\nCan't read camera path %s\n", benchmarkSettings.CameraPath.c_str());
+#endif
+			Quit();
+			return;
+		}
+		camNewton->SetInputEnabled(false);
+		benchmark = new BenchmarkRun(benchmarkSettings);
+	}
+}
 
-	//TEXTURE code here (maybe)
+// --------------------------------------------------------
+// Loads the diffuse texture.  Uses the immediate context to
+// generate mips, so this must run on the main thread.
+// --------------------------------------------------------
+void Game::LoadDiffuseTexture()
+{
+	CreateWICTextureFromFile(device, context, L"Debug/Assets/Textures/eric_andre.jpg", 0, &resource);
+}
 
+// --------------------------------------------------------
+// Loads the sky's cube map
+// --------------------------------------------------------
+void Game::LoadSkyTexture()
+{
 	// Load the cube map (without mipmaps!  Don't pass in the context)
 	CreateDDSTextureFromFile(device, L"Debug/Assets/Textures/Ni.dds", 0, &skySRV);
+}
 
-	// Create a rasterizer state so we can render backfaces
-	D3D11_RASTERIZER_DESC rsDesc = {};
-	rsDesc.FillMode = D3D11_FILL_SOLID;
-	rsDesc.CullMode = D3D11_CULL_FRONT;
-	rsDesc.DepthClipEnable = true;
-	device->CreateRasterizerState(&rsDesc, &skyRastState);
-
-	// Create a depth state so that we can accept pixels
-	// at a depth less than or EQUAL TO an existing depth
-	D3D11_DEPTH_STENCIL_DESC dsDesc = {};
-	dsDesc.DepthEnable = true;
-	dsDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ALL;
-	dsDesc.DepthFunc = D3D11_COMPARISON_LESS_EQUAL; // Make sure we can see the sky (at max depth)
-	device->CreateDepthStencilState(&dsDesc, &skyDepthState);
-
-	// Set up a rasterizer state with no culling
-	D3D11_RASTERIZER_DESC rd = {};
-	rd.CullMode = D3D11_CULL_NONE;
-	rd.FillMode = D3D11_FILL_SOLID;
-	rd.DepthClipEnable = true;
-	device->CreateRasterizerState(&rd, &rsNoCull);
-
-	//create description of blend state here (move code if necessary)
-	//blend so as to create transparency on desired object
-	D3D11_BLEND_DESC bd = {};
-	bd.AlphaToCoverageEnable = false;
-	bd.IndependentBlendEnable = false;
-	bd.RenderTarget[0].BlendEnable = true; //we might change it to [1] to get the second object
-	bd.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA; //how to interpret source pixel color, src is NEW color. Option: mode by own alpha val
-	bd.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA; //destination pixel color, already in render target. Option: mod by (1.0-Src pixel alpha)
-	bd.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD; //operation: add
-	bd.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
-	bd.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
-	bd.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
-	bd.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
-	device->CreateBlendState(&bd, &blendState);
+// --------------------------------------------------------
+// Prefilters the sky into the radiance map used for image
+// based specular.  Takes a while, so the result is cached on
+// disk (keyed by the sky's contents and the settings) and
+// later launches just load it.  Renders with the immediate
+// context, so this must run on the main thread.  Skipped if
+// the scene's variant doesn't sample it.
+// --------------------------------------------------------
+void Game::PrefilterRadianceMap()
+{
+	if (!ShaderPermutation::HasFeature(sceneMaterialKey, PERMUTATION_IBL))
+		return;
 
+	iblPrecompute = new IBLPrecompute(device, context);
+	iblPrecompute->LoadShaders();
+
+	IBLPrefilterSettings settings = IBLPrefilterSettings::Default();
+	radianceSRV = iblPrecompute->GetRadianceMap("Debug/Assets/Textures/Ni.dds", skySRV, settings);
+}
+
+// --------------------------------------------------------
+// Projects the sky onto SH9 for diffuse image based lighting.
+// Nine coefficients in a constant buffer replace a whole
+// irradiance cubemap (and a texture fetch per pixel).  Pure
+// CPU work, so it runs on a worker.
+// --------------------------------------------------------
+void Game::ProjectIrradiance()
+{
+	memset(&irradianceData, 0, sizeof(irradianceData));
+	irradianceData.radianceBlend = 1;
+
+	// Fall back to the old irradiance cube if the sky can't be read
+	CubemapImage environment;
+	if (!DDSFile::LoadCubemap("Debug/Assets/Textures/Ni.dds", environment) &&
+		!DDSFile::LoadCubemap("Debug/Assets/Textures/niteIrradiance.dds", environment))
+		return;
+
+	// Irradiance is very low frequency - a 32x32 mip (if there
+	// is one) loses nothing and is far cheaper to project
+	int mip = 0;
+	while (mip + 1 < environment.GetMipCount() && environment.GetMipSize(mip) > 32)
+		mip++;
+
+	SH9Color sh;
+	SphericalHarmonics::ProjectCubemap(environment, mip, sh);
+	SphericalHarmonics::ConvolveIrradiance(sh);
+	SphericalHarmonics::GetShaderConstants(sh, (float(*)[4])irradianceData.irradianceSH);
+}
+
+// --------------------------------------------------------
+// Sets up run time re-capture of the sky, which turns slowly
+// (see Update).  Each capture is spread over several frames
+// at up to 1ms of GPU time each, and fades in over a second.
+// Until the first one is done the startup IBL is used.  Not
+// made at all if the scene's variant has no IBL.  Needs the
+// radiance prefilter's shaders, and creates views with the
+// immediate context, so it runs on the main thread.
+// --------------------------------------------------------
+void Game::CreateEnvironmentCapture()
+{
+	// Only worth it if the scene samples the result, and it
+	// draws with the prefilter's shaders
+	if (!ShaderPermutation::HasFeature(sceneMaterialKey, PERMUTATION_IBL) || !iblPrecompute)
+		return;
+
+	// Filtered and adaptive, but not incremental, since each
+	// face of each mip is drawn as its own step
+	IBLPrefilterSettings settings = IBLPrefilterSettings::Default();
+	settings.Size = 64;
+	settings.Incremental = false;
+
+	environmentCapture = new EnvironmentCapture(device, context, iblPrecompute, 128, settings);
+	if (!environmentCapture->Init())
+	{
+		delete environmentCapture;
+		environmentCapture = 0;
+		return;
+	}
+
+	environmentCapture->SetFallback(radianceSRV, irradianceData);
+
+	EnvironmentCaptureScheduler* scheduler = environmentCapture->GetScheduler();
+	scheduler->SetBudget(1.0);
+	scheduler->SetBlendTime(1.0f);
+	scheduler->SetInterval(2.0f);
+	scheduler->RequestCapture();
+}
+
+// --------------------------------------------------------
+// Creates the split-sum BRDF lookup table from the copy baked
+// into BrdfLutData.h (see BakeBrdfLut.cpp), rather than running
+// BrdfPS's importance sampling every launch
+// --------------------------------------------------------
+void Game::CreateBrdfLut()
+{
+	D3D11_TEXTURE2D_DESC lutDesc = {};
+	lutDesc.Width = BRDF_LUT_SIZE;
+	lutDesc.Height = BRDF_LUT_SIZE;
+	lutDesc.MipLevels = 1;
+	lutDesc.ArraySize = 1;
+	lutDesc.Format = DXGI_FORMAT_R16G16_UNORM;
+	lutDesc.SampleDesc.Count = 1;
+	lutDesc.Usage = D3D11_USAGE_IMMUTABLE;
+	lutDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	D3D11_SUBRESOURCE_DATA lutData = {};
+	lutData.pSysMem = BrdfLutData;
+	lutData.SysMemPitch = BRDF_LUT_SIZE * sizeof(BrdfLutData[0]);
+
+	ID3D11Texture2D* lutTexture = 0;
+	if (FAILED(device->CreateTexture2D(&lutDesc, &lutData, &lutTexture)))
+		return;
+	device->CreateShaderResourceView(lutTexture, 0, &brdfLutSRV);
+	lutTexture->Release();
+}
+
+// --------------------------------------------------------
+// Creates the texture sampler(s) used by materials
+// --------------------------------------------------------
+void Game::CreateSamplers()
+{
+	D3D11_SAMPLER_DESC sampleState = {};
+	sampleState.AddressU = D3D11_TEXTURE_ADDRESS_WRAP; //Other options: Mirror, Clamp, Border, Mirror_Once
+	sampleState.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampleState.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampleState.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR; //trinlinear filtering
+	sampleState.MaxLOD = D3D11_FLOAT32_MAX; //enable mipmapping
+
+	device->CreateSamplerState(&sampleState, &freeSamples);
+	//break point here to verify if it is working
+
+	// Upscaling reads the scene target bilinearly, without
+	// wrapping round to the far edge
+	D3D11_SAMPLER_DESC upscaleState = {};
+	upscaleState.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+	upscaleState.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+	upscaleState.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+	upscaleState.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+	upscaleState.MaxLOD = D3D11_FLOAT32_MAX;
+	device->CreateSamplerState(&upscaleState, &upscaleSampler);
+}
+
+// --------------------------------------------------------
+// Creates the pipeline states (shaders + render states) for
+// each pass.  Needs the shaders and the material's variant.
+// --------------------------------------------------------
+void Game::CreatePipelineStates()
+{
+	pipelineStates = new PipelineStateCache(device, context);
+
+	// Regular opaque objects use their material's shaders
+	PipelineStateDesc opaqueDesc = PipelineStateDesc::Default();
+	opaqueDesc.VertexShader = test->GetVertexShader();
+	opaqueDesc.PixelShader = test->GetPixelShader();
+	test->SetPipelineState(pipelineStates->GetPipelineState(opaqueDesc));
+
+	// Transparent objects: no culling, so we can see their back faces,
+	// and blended so as to create transparency (not used by the scene yet)
+	PipelineStateDesc transparentDesc = opaqueDesc;
+	transparentDesc.Rasterizer.CullMode = D3D11_CULL_NONE;
+	transparentDesc.Blend.RenderTarget[0].BlendEnable = true;
+	transparentDesc.Blend.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA; //how to interpret source pixel color, src is NEW color. Option: mode by own alpha val
+	transparentDesc.Blend.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA; //destination pixel color, already in render target. Option: mod by (1.0-Src pixel alpha)
+	transparentDesc.Blend.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD; //operation: add
+	transparentPSO = pipelineStates->GetPipelineState(transparentDesc);
+
+	// The sky is drawn from the inside, so cull front faces, and
+	// accept pixels at a depth less than or EQUAL TO an existing depth
+	// to make sure we can see the sky (at max depth)
+	PipelineStateDesc skyDesc = PipelineStateDesc::Default();
+	skyDesc.VertexShader = skyVS;
+	skyDesc.PixelShader = skyPS;
+	skyDesc.Rasterizer.CullMode = D3D11_CULL_FRONT;
+	skyDesc.DepthStencil.DepthFunc = D3D11_COMPARISON_LESS_EQUAL;
+	skyPSO = pipelineStates->GetPipelineState(skyDesc);
+
+	// Shadow map: depth only (no pixel shader), with a bias
+	PipelineStateDesc shadowDesc = PipelineStateDesc::Default();
+	shadowDesc.VertexShader = shadowVS;
+	shadowDesc.PixelShader = 0;
+	shadowDesc.Rasterizer.DepthBias = 1000; // Multiplied by (smallest possible value > 0 in depth buffer) to prevent "shadow acne"
+	shadowDesc.Rasterizer.DepthBiasClamp = 0.0f;
+	shadowDesc.Rasterizer.SlopeScaledDepthBias = 1.0f;
+	shadowPSO = pipelineStates->GetPipelineState(shadowDesc);
+
+	// Upscale: one triangle over the whole back buffer, no depth
+	PipelineStateDesc upscaleDesc = PipelineStateDesc::Default();
+	upscaleDesc.VertexShader = upscaleVS;
+	upscaleDesc.PixelShader = upscalePS;
+	upscaleDesc.Rasterizer.CullMode = D3D11_CULL_NONE;
+	upscaleDesc.DepthStencil.DepthEnable = false;
+	upscaleDesc.DepthStencil.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ZERO;
+	upscalePSO = pipelineStates->GetPipelineState(upscaleDesc);
+}
+
+// --------------------------------------------------------
+// Creates the shadow map texture, its views and its sampler
+// --------------------------------------------------------
+void Game::CreateShadowMapResources()
+{
 	//----------What we need for the shadow----------
 
-	//The texture that will become the shadow map
+	//The texture that will become the shadow map - an array, one slice per cascade
 	D3D11_TEXTURE2D_DESC shadowDesc = {};
 	shadowDesc.Width = shadowMapSize;
 	shadowDesc.Height = shadowMapSize;
-	shadowDesc.ArraySize = 1;
+	shadowDesc.ArraySize = shadowSettings.CascadeCount;
 	shadowDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL | D3D11_BIND_SHADER_RESOURCE;
 	shadowDesc.CPUAccessFlags = 0;
 	shadowDesc.Format = DXGI_FORMAT_R32_TYPELESS; //check the graphics debugger for this type of object!
@@ -172,26 +570,41 @@ void Game::Init()
 	shadowDesc.SampleDesc.Count = 1;
 	shadowDesc.SampleDesc.Quality = 0;
 	shadowDesc.Usage = D3D11_USAGE_DEFAULT;
-	ID3D11Texture2D* shadowTexture;
 	device->CreateTexture2D(&shadowDesc, 0, &shadowTexture);
 
-	//Depth Stencil View
-	D3D11_DEPTH_STENCIL_VIEW_DESC shadowDSDesc = {};
-	shadowDSDesc.Format = DXGI_FORMAT_D32_FLOAT;
-	shadowDSDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
-	shadowDSDesc.Texture2D.MipSlice = 0;
-	device->CreateDepthStencilView(shadowTexture, &shadowDSDesc, &shadowDSV);
+	//The static casters' cache - same layout, so slices can be copied across
+	shadowDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+	device->CreateTexture2D(&shadowDesc, 0, &staticShadowTexture);
 
-	//SRV for the shadow map
+	//Depth Stencil View for each cascade's slice
+	for (int c = 0; c < shadowSettings.CascadeCount; c++)
+	{
+		D3D11_DEPTH_STENCIL_VIEW_DESC shadowDSDesc = {};
+		shadowDSDesc.Format = DXGI_FORMAT_D32_FLOAT;
+		shadowDSDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
+		shadowDSDesc.Texture2DArray.MipSlice = 0;
+		shadowDSDesc.Texture2DArray.FirstArraySlice = c;
+		shadowDSDesc.Texture2DArray.ArraySize = 1;
+		device->CreateDepthStencilView(shadowTexture, &shadowDSDesc, &shadowDSVs[c]);
+		device->CreateDepthStencilView(staticShadowTexture, &shadowDSDesc, &staticShadowDSVs[c]);
+	}
+
+	//SRV for the whole array
 	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 	srvDesc.Format = DXGI_FORMAT_R32_FLOAT;
-	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-	srvDesc.Texture2D.MipLevels = 1;
-	srvDesc.Texture2D.MostDetailedMip = 0;
+	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+	srvDesc.Texture2DArray.MipLevels = 1;
+	srvDesc.Texture2DArray.MostDetailedMip = 0;
+	srvDesc.Texture2DArray.FirstArraySlice = 0;
+	srvDesc.Texture2DArray.ArraySize = shadowSettings.CascadeCount;
 	device->CreateShaderResourceView(shadowTexture, &srvDesc, &shadowSRV);
 
-	//Now release reference, since we don't need it
-	shadowTexture->Release();
+	//Kept (not released), since the static cache is copied into it
+
+	//One big texture shared by the spot lights' shadows - it's
+	//redrawn every frame, so the render graph owns the texture
+	//(see BuildRenderGraph)
+	shadowAtlas = new ShadowAtlas(2048, 64, 1024);
 
 	//A special "comparison" sampler state for shadows
 	//This will compare each pixel to a value to see which pixels are "lit" or "unlit"
@@ -206,51 +619,95 @@ void Game::Init()
 	shadowSampDesc.BorderColor[2] = 1.0f;
 	shadowSampDesc.BorderColor[3] = 1.0f;
 	device->CreateSamplerState(&shadowSampDesc, &shadowSampler);
+}
 
-	//Rasterizer state for shadow
-	D3D11_RASTERIZER_DESC shadowRastDesc = {};
-	shadowRastDesc.FillMode = D3D11_FILL_SOLID;
-	shadowRastDesc.CullMode = D3D11_CULL_BACK;
-	shadowRastDesc.DepthClipEnable = true;
-	shadowRastDesc.DepthBias = 1000; // Multiplied by (smallest possible value > 0 in depth buffer) to prevent "shadow acne"
-	shadowRastDesc.DepthBiasClamp = 0.0f;
-	shadowRastDesc.SlopeScaledDepthBias = 1.0f;
-	device->CreateRasterizerState(&shadowRastDesc, &shadowRasterizer);
+// --------------------------------------------------------
+// Creates the cluster grid and its structured buffers.  The
+// grid's depth range matches the camera's clip planes.
+// --------------------------------------------------------
+void Game::CreateClusteredLighting()
+{
+	LightClusterSettings settings = LightClusterSettings::Default();
+	settings.NearClip = camNewton->GetNearClip();
+	settings.FarClip = camNewton->GetFarClip();
+	clusteredLighting = new ClusteredLighting(device, context, (int)sceneLights.size(), settings);
+	clusteredLighting->Init();
+	clusteredLighting->GetGrid()->SetParallelFor(jobSystem->GetParallelFor());
+	memset(&clusterData, 0, sizeof(clusterData));
+}
 
-	// Tell the input assembler stage of the pipeline what kind of
-	// geometric primitives (points, lines or triangles) we want to draw.  
-	// Essentially: "What kind of shape should the GPU draw with our data?"
-	context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+// --------------------------------------------------------
+// Sets up recording the frame on deferred contexts (created
+// when first needed, one per job).  Each job's commands are
+// timed on the GPU as they're played back, as a scope named
+// after its pass.
+// --------------------------------------------------------
+void Game::CreateCommandRecorder()
+{
+	recordingBackend = new D3D11CommandRecordingBackend(device, context);
+	commandRecorder = new CommandRecorder(recordingBackend);
+	commandRecorder->SetParallelFor(jobSystem->GetParallelFor());
+	renderGraphTextures = new RenderGraphTextures(device);
+
+	commandRecorder->SetPlaybackHook([this](int job, bool begin)
+	{
+		if (!gpuProfiler)
+			return;
+		if (begin)
+			gpuProfiler->BeginScope(commandRecorder->GetJobName(job));
+		else
+			gpuProfiler->EndScope();
+	});
 }
 
 // --------------------------------------------------------
-// Loads shaders from compiled shader object (.cso) files using
-// my SimpleShader wrapper for DirectX shader manipulation.
-// - SimpleShader provides helpful methods for sending
-//   data to individual variables on the GPU
+// Loads shaders, preferably from the baked shader library
+// (Shaders.shlib).  The library is a single memory mapped file
+// holding every shader's bytecode plus its reflection data, so
+// startup costs one file open and no D3DReflect calls.
+//
+// If the library is missing (or stale in debug builds) we fall
+// back to the .cso files using my SimpleShader wrapper, then
+// bake a fresh library so the next launch takes the fast path.
 // --------------------------------------------------------
 void Game::LoadShaders()
 {
 	vertexShader = new SimpleVertexShader(device, context);
+	pixelShader = new SimplePixelShader(device, context);
+	skyVS = new SimpleVertexShader(device, context);
+	skyPS = new SimplePixelShader(device, context);
+	shadowVS = new SimpleVertexShader(device, context);
+	upscaleVS = new SimpleVertexShader(device, context);
+	upscalePS = new SimplePixelShader(device, context);
+
+	// Fast path - everything comes out of one file
+	if (LoadShadersFromLibrary())
+	{
+		CreatePermutationCache();
+		return;
+	}
+
 	if (!vertexShader->LoadShaderFile(L"Debug/VertexShader.cso"))
 		vertexShader->LoadShaderFile(L"VertexShader.cso");		
 
-	pixelShader = new SimplePixelShader(device, context);
 	if(!pixelShader->LoadShaderFile(L"Debug/PixelShader.cso"))	
 		pixelShader->LoadShaderFile(L"PixelShader.cso");
 
-	skyVS = new SimpleVertexShader(device, context);
 	if (!skyVS->LoadShaderFile(L"Debug/SkyVS.cso"))
 		skyVS->LoadShaderFile(L"SkyVS.cso");
 
-	skyPS = new SimplePixelShader(device, context);
 	if (!skyPS->LoadShaderFile(L"Debug/SkyPS.cso"))
 		skyPS->LoadShaderFile(L"SkyPS.cso");
 
-	shadowVS = new SimpleVertexShader(device, context);
 	if (!shadowVS->LoadShaderFile(L"Debug/ShadowVS.cso"))
 		shadowVS->LoadShaderFile(L"ShadowVS.cso");
 
+	if (!upscaleVS->LoadShaderFile(L"Debug/UpscaleVS.cso"))
+		upscaleVS->LoadShaderFile(L"UpscaleVS.cso");
+
+	if (!upscalePS->LoadShaderFile(L"Debug/UpscalePS.cso"))
+		upscalePS->LoadShaderFile(L"UpscalePS.cso");
+
 	// You'll notice that the code above attempts to load each
 	// compiled shader file (.cso) from two different relative paths.
 
@@ -261,6 +718,145 @@ void Game::LoadShaders()
 
 	// Checking both paths is the easiest way to ensure both 
 	// scenarios work correctly, although others exist
+
+	CreatePermutationCache();
+
+	// Bake the library next to the .cso files we just used
+	if (ShaderLibraryBaker::GetLastWriteTime(L"Debug/VertexShader.cso") != 0)
+		shaderLibraryPath = "Debug/Shaders.shlib";
+	else
+		shaderLibraryPath = "Shaders.shlib";
+	BakeShaderLibrary(shaderLibraryPath.c_str());
+}
+
+// --------------------------------------------------------
+// Sets up the pixel shader variants.  The build-time .cso is
+// the default permutation; any other feature combination a
+// material asks for is compiled from PixelShader.hlsl (or
+// pulled from the library if it was baked on an earlier run).
+// --------------------------------------------------------
+void Game::CreatePermutationCache()
+{
+	pixelPermutations = new ShaderPermutationCache(device, context, "PixelShader", L"PixelShader.hlsl", shaderLibrary);
+	pixelPermutations->AddPixelShader(ShaderPermutation::GetDefaultKey(), pixelShader);
+}
+
+// --------------------------------------------------------
+// Attempts to load every shader from the baked library
+//
+// Returns true if all shaders were loaded from the library
+// --------------------------------------------------------
+bool Game::LoadShadersFromLibrary()
+{
+	// Same two relative paths as the .cso files (see LoadShaders)
+	shaderLibrary = new ShaderLibrary();
+	if (shaderLibrary->Open("Debug/Shaders.shlib"))
+		shaderLibraryPath = "Debug/Shaders.shlib";
+	else if (shaderLibrary->Open("Shaders.shlib"))
+		shaderLibraryPath = "Shaders.shlib";
+	else
+		return false;
+
+#if defined(DEBUG) || defined(_DEBUG)
+	// While working on shaders, a .cso newer than the library
+	// means the library is stale and needs to be re-baked.  The
+	// .cso files are the ones next to it (see BakeShaderLibrary).
+	std::string dir = shaderLibraryPath.substr(0, shaderLibraryPath.find_last_of('/') + 1);
+	for (unsigned int i = 0; i < shaderLibrary->GetShaderCount(); i++)
+	{
+		const ShaderLibraryShader* record = shaderLibrary->GetShader(i);
+		std::string file = dir + shaderLibrary->GetString(record->Name) + ".cso";
+		std::wstring wideFile(file.begin(), file.end());
+
+		unsigned long long fileTime = ShaderLibraryBaker::GetLastWriteTime(wideFile.c_str());
+		unsigned long long bakedTime = ((unsigned long long)record->SourceTimeHigh << 32) | record->SourceTimeLow;
+		if (fileTime != 0 && fileTime != bakedTime)
+		{
+			shaderLibrary->Close();
+			return false;
+		}
+	}
+#endif
+
+	// A library baked before a shader was added is stale too.
+	// Check up front so we never load half the shaders from it
+	// and the rest from .cso files.
+	static const char* shaderNames[] = { "VertexShader", "PixelShader", "SkyVS", "SkyPS", "ShadowVS", "UpscaleVS", "UpscalePS" };
+	for (unsigned int i = 0; i < sizeof(shaderNames) / sizeof(shaderNames[0]); i++)
+	{
+		if (shaderLibrary->FindShader(shaderNames[i]) < 0)
+		{
+			shaderLibrary->Close();
+			return false;
+		}
+	}
+
+	bool loaded =
+		vertexShader->LoadShaderFromLibrary(shaderLibrary, "VertexShader") &&
+		pixelShader->LoadShaderFromLibrary(shaderLibrary, "PixelShader") &&
+		skyVS->LoadShaderFromLibrary(shaderLibrary, "SkyVS") &&
+		skyPS->LoadShaderFromLibrary(shaderLibrary, "SkyPS") &&
+		shadowVS->LoadShaderFromLibrary(shaderLibrary, "ShadowVS") &&
+		upscaleVS->LoadShaderFromLibrary(shaderLibrary, "UpscaleVS") &&
+		upscalePS->LoadShaderFromLibrary(shaderLibrary, "UpscalePS");
+
+	// Bad bytecode - don't hand a broken library to the permutation
+	// cache or keep it mapped while LoadShaders re-bakes it
+	if (!loaded)
+		shaderLibrary->Close();
+	return loaded;
+}
+
+// --------------------------------------------------------
+// Writes the currently loaded shaders out as a shader library
+//
+// path - Where to write the library
+// --------------------------------------------------------
+void Game::BakeShaderLibrary(const char* path)
+{
+	// Stamp each entry with its .cso time for the staleness check
+	std::string dir = path;
+	dir = dir.substr(0, dir.find_last_of('/') + 1);
+
+	struct { const char* Name; ShaderLibraryStage Stage; ISimpleShader* Shader; } shaders[] =
+	{
+		{ "VertexShader",	SHADER_STAGE_VERTEX,	vertexShader },
+		{ "PixelShader",	SHADER_STAGE_PIXEL,		pixelShader },
+		{ "SkyVS",			SHADER_STAGE_VERTEX,	skyVS },
+		{ "SkyPS",			SHADER_STAGE_PIXEL,		skyPS },
+		{ "ShadowVS",		SHADER_STAGE_VERTEX,	shadowVS },
+		{ "UpscaleVS",		SHADER_STAGE_VERTEX,	upscaleVS },
+		{ "UpscalePS",		SHADER_STAGE_PIXEL,		upscalePS },
+	};
+
+	ShaderLibraryBaker baker;
+	for (unsigned int i = 0; i < sizeof(shaders) / sizeof(shaders[0]); i++)
+	{
+		if (!shaders[i].Shader->IsShaderValid())
+			return;
+
+		std::string file = dir + shaders[i].Name + ".cso";
+		std::wstring wideFile(file.begin(), file.end());
+		baker.AddShaderBlob(
+			shaders[i].Name,
+			shaders[i].Stage,
+			shaders[i].Shader->GetShaderBlob(),
+			ShaderLibraryBaker::GetLastWriteTime(wideFile.c_str()));
+	}
+
+	// Plus any pixel shader variants built so far, stamped with
+	// the .hlsl time instead (they're compiled from source)
+	for (unsigned int i = 0; pixelPermutations && i < pixelPermutations->GetVariantCount(); i++)
+	{
+		std::string name = ShaderPermutation::GetName("PixelShader", pixelPermutations->GetVariantKey(i));
+		baker.AddShaderBlob(
+			name.c_str(),
+			SHADER_STAGE_PIXEL,
+			pixelPermutations->GetVariantShader(i)->GetShaderBlob(),
+			pixelPermutations->GetVariantSourceTime(i));
+	}
+
+	baker.Write(path);
 }
 
 
@@ -306,22 +902,8 @@ void Game::CreateMatrices()
 		100.0f);					// Far clip plane distance
 	XMStoreFloat4x4(&projectionMatrix, XMMatrixTranspose(P)); // Transpose for HLSL!
 
-	//----------Shadow-related matrices (for directional lights)----------
-	
-	//for both matrices, we want to see things from the light's POV, as if
-	//the light is a camera
-	
-	//need a "LookTo" view matrix
-	XMMATRIX shView = XMMatrixLookAtLH(
-		XMVectorSet(0, 20, -20, 0),
-		XMVectorSet(0, 0, 0, 0),
-		XMVectorSet(0, 1, 0, 0));
-	XMStoreFloat4x4(&shadowViewMatrix, XMMatrixTranspose(shView));
-
-	//Orthographic projection matrix
-	//For Spot lights, we need a perspective projection matrix (could be XMMatrixPerspectiveLH()), pass in camera's info
-	XMMATRIX shProj = XMMatrixOrthographicLH(10, 10, 0.1f, 100.0f);
-	XMStoreFloat4x4(&shadowProjectionMatrix, XMMatrixTranspose(shProj));
+	// The shadow matrices follow the camera, so they're fitted
+	// every frame (see UpdateShadowCascades)
 }
 
 
@@ -374,34 +956,64 @@ void Game::CreateBasicGeometry()
 
 	unsigned int indicesThree[] = { 0, 1, 2, 0, 2, 3 };
 
-	//
-	HRESULT result = CreateWICTextureFromFile(device, context, L"Debug/Assets/Textures/eric_andre.jpg", 0, &resource);
-
-	D3D11_SAMPLER_DESC sampleState = {};
-	sampleState.AddressU = D3D11_TEXTURE_ADDRESS_WRAP; //Other options: Mirror, Clamp, Border, Mirror_Once
-	sampleState.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
-	sampleState.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
-	sampleState.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR; //trinlinear filtering
-	sampleState.MaxLOD = D3D11_FLOAT32_MAX; //enable mipmapping
-
-	device->CreateSamplerState(&sampleState, &freeSamples);
-	//break point here to verify if it is working
-
-	pixelShader->SetSamplerState("basicSampler", freeSamples);
-	pixelShader->SetShaderResourceView("diffuseTexture", resource);
-
 	//timmy = new Mesh(vertices, 3, indices, 3, device);
-	timmy = new Mesh("Debug/Assets/Models/cube.obj", device);
-	
-	test = new Material(vertexShader, pixelShader, resource, freeSamples);
+	timmy = new Mesh("Debug/Assets/Models/cube.obj", renderDevice);
 
 	//Create two more shapes. Make vertexes and indices, and then create Mesh objects with those params
 	//wanda = new Mesh(verticesTwo, 3, indicesTwo, 3, device);
 	//cosmo = new Mesh(verticesThree, 4, indicesThree, 6, device);
+}
+
+// --------------------------------------------------------
+// Creates the material(s).  Needs the shaders, the texture and
+// the sampler, and binds them through the immediate context.
+// --------------------------------------------------------
+void Game::CreateMaterials()
+{
+	test = new Material(vertexShader, pixelShader, resource, freeSamples);
+	// Resolves (and if need be builds) the variant here, on the
+	// main thread, rather than in the jobs recording the frame
+	test->SetPermutation(pixelPermutations, sceneMaterialKey);
+
+	SimplePixelShader* ps = test->GetPixelShader();
+	ps->SetSamplerState("basicSampler", freeSamples);
+	ps->SetShaderResourceView("diffuseTexture", resource);
+}
 
+// --------------------------------------------------------
+// Creates the entities, once their meshes and materials exist
+// --------------------------------------------------------
+void Game::CreateEntities()
+{
 	//test entities...have several share one shape
 	one = new Entity(timmy, test);
 	two = new Entity(timmy, test);
+
+	//a flat slab under them to catch their shadows
+	three = new Entity(timmy, test);
+	three->SetPosition(XMFLOAT3(0.0f, -1.5f, 0.0f));
+	three->SetScale(XMFLOAT3(10.0f, 0.2f, 10.0f));
+	three->Move();
+
+	//the ground never moves, so its shadow depth can be cached
+	staticCasters.push_back(three);
+	dynamicCasters.push_back(one);
+	dynamicCasters.push_back(two);
+	shadowCache.SetStaticCasterCount((int)staticCasters.size());
+
+	sceneEntities.push_back(one);
+	sceneEntities.push_back(two);
+	sceneEntities.push_back(three);
+
+	// Benchmark load: spinning cubes, moved in UpdateBenchmark
+	int stressCount = benchmarkSettings.Enabled ? benchmarkSettings.StressEntities : 0;
+	for (int s = 0; s < stressCount; s++)
+	{
+		Entity* stress = new Entity(timmy, test);
+		stressEntities.push_back(stress);
+		dynamicCasters.push_back(stress);
+		sceneEntities.push_back(stress);
+	}
 }
 
 
@@ -434,6 +1046,11 @@ void Game::Update(float deltaTime, float totalTime)
 	if (GetAsyncKeyState(VK_ESCAPE))
 		Quit();
 
+	// The oldest frame's temporaries are done with (the pacer
+	// keeps no more than that many frames in flight)
+	frameArena->BeginFrame();
+	UpdateDynamicResolution();
+
 	// Move the triangle a little
 	float sinTime = (sin(totalTime) + 2.0f) / 10.0f;
 
@@ -449,63 +1066,589 @@ void Game::Update(float deltaTime, float totalTime)
 	//
 	two->SetPosition(posChangeT);
 
-	//Change relevant vectors
-	//Then call "one->Move()"
-	one->Move();
-	two->Move();
+	// Turn the sky slowly, so its lighting has to be re-captured
+	skyRotation += deltaTime * 0.05f;
 
+	UpdateBenchmark(totalTime);
+	UpdateTransforms();
+	UpdatePathRecording(totalTime);
 	camNewton->Update();
+	BuildDrawList();
+	UpdateShadowCascades();
+	UpdateSpotLights();
+	UpdateClusteredLights(totalTime);
+}
+
+// --------------------------------------------------------
+// In benchmark mode: moves the stress cubes and the camera
+// (along its path), and hands the frames that have ended to
+// the run - writing its results and quitting once it has
+// them all
+// --------------------------------------------------------
+void Game::UpdateBenchmark(float totalTime)
+{
+	if (!benchmark)
+		return;
+
+	PROFILE_SCOPE("Stress entities");
+	jobSystem->ParallelFor((int)stressEntities.size(), [this, totalTime](int begin, int end)
+	{
+		for (int s = begin; s < end; s++)
+		{
+			XMFLOAT3 position;
+			float rotation, scale;
+			GetStressEntityTransform(s, totalTime, &position.x, rotation, scale);
+			stressEntities[s]->SetPosition(position);
+			stressEntities[s]->SetRotation(XMFLOAT3(0.0f, 0.0f, rotation));
+			stressEntities[s]->SetScale(XMFLOAT3(scale, scale, scale));
+		}
+	});
+
+	CameraKey key;
+	cameraPath.Sample(totalTime, key);
+	camNewton->SetPose(XMFLOAT3(key.Position), key.Pitch, key.Yaw);
+
+	benchmark->Update();
+	if (!benchmark->IsFinished())
+		return;
+
+	benchmark->WriteResults(benchmarkSettings.Output.c_str());
+#if defined(DEBUG) || defined(_DEBUG)
+	printf("\nBenchmark %s, %d frames:\n", benchmarkSettings.Scene.c_str(), benchmark->GetMeasuredCount());
+	benchmark->PrintSummary();
+#endif
+	delete benchmark;
+	benchmark = 0;
+	Quit();
+}
+
+// --------------------------------------------------------
+// Rebuilds the world matrix (and bounds) of everything that
+// moves, across the job system
+// --------------------------------------------------------
+void Game::UpdateTransforms()
+{
+	PROFILE_SCOPE("Transforms");
+	jobSystem->ParallelFor((int)dynamicCasters.size(), [this](int begin, int end)
+	{
+		for (int e = begin; e < end; e++)
+			dynamicCasters[e]->Move();
+	});
+}
+
+// --------------------------------------------------------
+// Culls sceneEntities against the camera into drawList.  Each
+// chunk of entities is culled by one job into its own list
+// (in that thread's frame arena), and the lists are joined in
+// chunk order, so the draw list keeps sceneEntities' order
+// whichever thread did what.
+// --------------------------------------------------------
+void Game::BuildDrawList()
+{
+	PROFILE_SCOPE("Draw list");
+
+	// The camera's matrices are stored transposed for HLSL
+	XMFLOAT4X4 view = camNewton->GetMatrixV();
+	XMFLOAT4X4 projection = camNewton->GetMatrixP();
+	XMFLOAT4X4 viewProjection;
+	XMStoreFloat4x4(&viewProjection, XMMatrixMultiply(XMMatrixTranspose(XMLoadFloat4x4(&view)), XMMatrixTranspose(XMLoadFloat4x4(&projection))));
+	frustumCuller.SetViewProjection(&viewProjection.m[0][0]);
+
+	CommandRecorder::Split((int)sceneEntities.size(), jobSystem->GetThreadCount() * 4, 64, drawListChunks);
+	int chunkCount = (int)drawListChunks.size();
+	LinearArena& arena = frameArena->Get();
+	Entity*** chunkLists = (Entity***)arena.Allocate(chunkCount * sizeof(Entity**), alignof(Entity**));
+	int* chunkCounts = (int*)arena.Allocate(chunkCount * sizeof(int), alignof(int));
+
+	jobSystem->ParallelFor(chunkCount, [this, chunkLists, chunkCounts](int begin, int end)
+	{
+		LinearArena& threadArena = frameArena->Get(jobSystem->GetThreadIndex());
+		for (int c = begin; c < end; c++)
+		{
+			int first = drawListChunks[c].first;
+			int last = drawListChunks[c].second;
+			Entity** chunkList = (Entity**)threadArena.Allocate((last - first) * sizeof(Entity*), alignof(Entity*));
+			int count = 0;
+			for (int e = first; e < last; e++)
+			{
+				XMFLOAT3 center = sceneEntities[e]->GetBoundingCenter();
+				if (frustumCuller.IsVisible(&center.x, sceneEntities[e]->GetBoundingRadius()))
+					chunkList[count++] = sceneEntities[e];
+			}
+			chunkLists[c] = chunkList;
+			chunkCounts[c] = count;
+		}
+	}, 1);
+
+	drawList.clear();
+	for (int c = 0; c < chunkCount; c++)
+		drawList.insert(drawList.end(), chunkLists[c], chunkLists[c] + chunkCounts[c]);
+}
+
+// --------------------------------------------------------
+// F5 starts recording the camera (a key every tenth of a
+// second) and stops, saving it to CameraPath.txt
+// --------------------------------------------------------
+void Game::UpdatePathRecording(float totalTime)
+{
+	bool keyDown = (GetAsyncKeyState(VK_F5) & 0x8000) != 0;
+	bool pressed = keyDown && !recordKeyDown;
+	recordKeyDown = keyDown;
+
+	if (pressed && recordingPath)
+	{
+		recordedPath.Save("CameraPath.txt");
+		recordingPath = false;
+		return;
+	}
+	if (pressed)
+	{
+		recordedPath.Clear();
+		recordedPath.SetLooping(false);
+		recordStartTime = totalTime;
+		recordingPath = true;
+	}
+	if (!recordingPath)
+		return;
+
+	float time = totalTime - recordStartTime;
+	int keyCount = recordedPath.GetKeyCount();
+	if (keyCount > 0 && time < recordedPath.GetKey(keyCount - 1).Time + 0.1f)
+		return;
+
+	XMFLOAT3 position = camNewton->GetPosition();
+	CameraKey key = { time, { position.x, position.y, position.z }, camNewton->GetPitch(), camNewton->GetYaw() };
+	recordedPath.AddKey(key);
+}
+
+// --------------------------------------------------------
+// Fits the shadow cascades to the camera's frustum (for the
+// main light), and fills in the pixel shader's shadowData
+// --------------------------------------------------------
+void Game::UpdateShadowCascades()
+{
+	PROFILE_SCOPE("Shadow cascades");
+
+	// The camera's matrices are stored transposed for HLSL
+	XMFLOAT4X4 view = camNewton->GetMatrixV();
+	ShadowCamera shadowCamera;
+	XMStoreFloat4x4((XMFLOAT4X4*)shadowCamera.View, XMMatrixTranspose(XMLoadFloat4x4(&view)));
+	shadowCamera.FieldOfView = camNewton->GetFieldOfView();
+	shadowCamera.AspectRatio = camNewton->GetAspectRatio();
+	shadowCamera.NearClip = camNewton->GetNearClip();
+	shadowCamera.FarClip = camNewton->GetFarClip();
+
+	float lightDirection[3] = { dLightful.Direction.x, dLightful.Direction.y, dLightful.Direction.z };
+	shadowCascadeCount = ShadowCascades::Fit(shadowCamera, lightDirection, shadowSettings, shadowCascades);
+
+	memset(&shadowData, 0, sizeof(shadowData));
+	float splits[4] = { 0, 0, 0, 0 };
+	for (int c = 0; c < shadowCascadeCount; c++)
+	{
+		XMMATRIX viewProjection = XMLoadFloat4x4((XMFLOAT4X4*)shadowCascades[c].ViewProjection);
+		XMStoreFloat4x4(&shadowData.cascadeViewProjection[c], XMMatrixTranspose(viewProjection)); // Transpose for HLSL!
+		splits[c] = shadowCascades[c].SplitFar;
+	}
+	shadowData.cascadeSplits = XMFLOAT4(splits);
+	shadowData.cascadeCount = shadowCascadeCount;
+}
+
+// --------------------------------------------------------
+// Gives each spot light a shadow tile sized by how much of
+// the screen it lights, and fills in the pixel shader's
+// spotLightData
+// --------------------------------------------------------
+void Game::UpdateSpotLights()
+{
+	PROFILE_SCOPE("Spot lights");
+
+	XMFLOAT4X4 cameraView = camNewton->GetMatrixV();
+	XMMATRIX V = XMMatrixTranspose(XMLoadFloat4x4(&cameraView));
+
+	spotShadowRequests.clear();
+	for (int s = 0; s < spotLightCount; s++)
+	{
+		const SpotLight& spot = spotLights[s];
+
+		// A sphere around the cone, as seen from the camera
+		// (nothing if it's entirely behind it)
+		XMVECTOR position = XMLoadFloat3(&spot.Position);
+		XMVECTOR direction = XMLoadFloat3(&spot.Direction);
+		XMVECTOR center = XMVectorAdd(position, XMVectorScale(direction, spot.Range * 0.5f));
+		float radius = spot.Range * 0.5f;
+		XMVECTOR viewCenter = XMVector3TransformCoord(center, V);
+
+		ShadowAtlasRequest request;
+		request.Id = s;
+		request.Distance = XMVectorGetX(XMVector3Length(viewCenter));
+		request.ScreenCoverage = XMVectorGetZ(viewCenter) + radius < 0 ? 0 :
+			ShadowAtlas::EstimateScreenCoverage(radius, request.Distance, camNewton->GetFieldOfView());
+		spotShadowRequests.push_back(request);
+
+		// The light's POV: a perspective view down its cone
+		XMVECTOR up = fabsf(spot.Direction.y) > 0.99f ? XMVectorSet(0, 0, 1, 0) : XMVectorSet(0, 1, 0, 0);
+		XMMATRIX view = XMMatrixLookToLH(position, direction, up);
+		XMMATRIX projection = XMMatrixPerspectiveFovLH(2.0f * acosf(spot.CosOuterAngle), 1.0f, 0.1f, spot.Range);
+		XMStoreFloat4x4(&spotShadowViews[s], XMMatrixTranspose(view));
+		XMStoreFloat4x4(&spotShadowProjections[s], XMMatrixTranspose(projection));
+		XMStoreFloat4x4(&spotLights[s].ViewProjection, XMMatrixTranspose(view * projection));
+	}
+
+	shadowAtlas->Update(spotShadowRequests);
+
+	memset(&spotLightData, 0, sizeof(spotLightData));
+	float atlasSize = (float)shadowAtlas->GetAtlasSize();
+	for (int s = 0; s < spotLightCount; s++)
+	{
+		ShadowAtlasTile tile = shadowAtlas->GetTile(s);
+		spotLights[s].AtlasRect = XMFLOAT4(tile.X / atlasSize, tile.Y / atlasSize, tile.Size / atlasSize, tile.Size / atlasSize);
+		spotLightData.spotLights[s] = spotLights[s];
+	}
+	spotLightData.spotLightCount = spotLightCount;
+}
+
+// --------------------------------------------------------
+// Bobs the clustered lights up and down, then bins them into
+// the camera's clusters and fills in the pixel shader's
+// clusterData
+// --------------------------------------------------------
+void Game::UpdateClusteredLights(float totalTime)
+{
+	PROFILE_SCOPE("Clustered lights");
+
+	for (size_t i = 0; i < sceneLights.size(); i++)
+	{
+		const XMFLOAT3& origin = sceneLightOrigins[i];
+		sceneLights[i].Position[0] = origin.x;
+		sceneLights[i].Position[1] = origin.y + 0.5f * (sinf(totalTime * 1.5f + origin.x + origin.z) + 1.0f);
+		sceneLights[i].Position[2] = origin.z;
+	}
+
+	// The camera's matrices are stored transposed for HLSL
+	XMFLOAT4X4 view = camNewton->GetMatrixV();
+	LightClusterCamera clusterCamera;
+	XMStoreFloat4x4((XMFLOAT4X4*)clusterCamera.View, XMMatrixTranspose(XMLoadFloat4x4(&view)));
+	clusterCamera.FieldOfView = camNewton->GetFieldOfView();
+	clusterCamera.AspectRatio = camNewton->GetAspectRatio();
+
+	clusteredLighting->Update(clusterCamera, sceneLights.empty() ? 0 : &sceneLights[0], (int)sceneLights.size(), renderWidth, renderHeight);
+	clusteredLighting->GetClusterData(clusterData);
+}
+
+// --------------------------------------------------------
+// Hands the GPU frame times that have come back (a few frames
+// late) to the dynamic resolution controller, then sizes this
+// frame's scene from its scale.  The clusters are binned for
+// that size, since the main pass's pixels are.
+// --------------------------------------------------------
+void Game::UpdateDynamicResolution()
+{
+	const unsigned long long gpuLatency = 8;	// Frames a GPU time may take to come back
+	unsigned long long ended = Profiler::GetFrameIndex();
+	while (dynamicResolutionEnabled && nextResolutionFrame < ended)
+	{
+		const ProfileFrame* frame = Profiler::GetFrame(nextResolutionFrame);
+		if (frame && frame->GpuMs < 0 && ended - nextResolutionFrame <= gpuLatency)
+			break;	// Its GPU time may still be coming
+		nextResolutionFrame++;
+		if (frame && frame->GpuMs >= 0)
+			dynamicResolution.Update(frame->GpuMs);
+	}
+
+	dynamicResolution.GetRenderSize((int)width, (int)height, renderWidth, renderHeight);
+}
+
+// --------------------------------------------------------
+// The method that will actually render the shadow map - one
+// slice of the array per cascade.  A render graph pass, so
+// the viewport already covers a slice; each slice's depth
+// view is bound here.
+// --------------------------------------------------------
+void Game::RenderShadowMap(ID3D11DeviceContext* commandContext)
+{
+	// Shadow VS, no pixel shader, biased rasterizer
+	PipelineStateCache::Bind(shadowPSO, commandContext);
+
+	float lightDirection[3] = { dLightful.Direction.x, dLightful.Direction.y, dLightful.Direction.z };
+	shadowCache.BeginFrame(lightDirection);
+
+	for (int c = 0; c < shadowCascadeCount; c++)
+	{
+		// The cascade's matrices, from the light's POV
+		XMFLOAT4X4 casterView;
+		XMFLOAT4X4 casterProjection;
+		XMStoreFloat4x4(&casterView, XMMatrixTranspose(XMLoadFloat4x4((XMFLOAT4X4*)shadowCascades[c].View)));
+		XMStoreFloat4x4(&casterProjection, XMMatrixTranspose(XMLoadFloat4x4((XMFLOAT4X4*)shadowCascades[c].Projection)));
+
+		// Static casters: only drawn when the cached depth is out
+		// of date (the light, the ground or the cascade moved)
+		if (shadowCache.NeedsStaticRender(c, shadowCascades[c]))
+		{
+			commandContext->OMSetRenderTargets(0, 0, staticShadowDSVs[c]);
+			commandContext->ClearDepthStencilView(staticShadowDSVs[c], D3D11_CLEAR_DEPTH, 1.0f, 0);
+			DrawShadowCasters(commandContext, staticCasters, casterView, casterProjection);
+			shadowCache.StaticRendered(c, shadowCascades[c]);
+		}
+
+		// Start from the static depth (whole subresource, as
+		// depth copies must be), then add the moving casters
+		commandContext->CopySubresourceRegion(shadowTexture, c, 0, 0, 0, staticShadowTexture, c, 0);
+		commandContext->OMSetRenderTargets(0, 0, shadowDSVs[c]);
+		DrawShadowCasters(commandContext, dynamicCasters, casterView, casterProjection);
+		shadowCache.DynamicRendered((int)dynamicCasters.size());
+	}
 }
 
 // --------------------------------------------------------
-// The method that will actually render the shadow map
+// Renders each spot light's depth into its tile of the atlas.
+// The atlas is a transient in the render graph (bound as the
+// pass's depth buffer), so it starts out as garbage.
 // --------------------------------------------------------
-void Game::RenderShadowMap()
+void Game::RenderSpotShadows(ID3D11DeviceContext* commandContext)
 {
-	// Set up targets
-	context->OMSetRenderTargets(0, 0, shadowDSV);
-	context->ClearDepthStencilView(shadowDSV, D3D11_CLEAR_DEPTH, 1.0f, 0);
-	context->RSSetState(shadowRasterizer);
+	PipelineStateCache::Bind(shadowPSO, commandContext);
+	commandContext->ClearDepthStencilView(renderGraphTextures->GetDepthStencilView(spotShadowAtlasResource), D3D11_CLEAR_DEPTH, 1.0f, 0);
+
+	for (int s = 0; s < spotLightCount; s++)
+	{
+		ShadowAtlasTile tile = shadowAtlas->GetTile(s);
+		if (tile.Size == 0)
+			continue;
+
+		D3D11_VIEWPORT viewport = {};
+		viewport.TopLeftX = (float)tile.X;
+		viewport.TopLeftY = (float)tile.Y;
+		viewport.Width = (float)tile.Size;
+		viewport.Height = (float)tile.Size;
+		viewport.MinDepth = 0.0f;
+		viewport.MaxDepth = 1.0f;
+		commandContext->RSSetViewports(1, &viewport);
+
+		DrawShadowCasters(commandContext, staticCasters, spotShadowViews[s], spotShadowProjections[s]);
+		DrawShadowCasters(commandContext, dynamicCasters, spotShadowViews[s], spotShadowProjections[s]);
+	}
+}
 
-	// Make a viewport to match the render target size
+// --------------------------------------------------------
+// Draws entities' depth into whichever shadow map is bound
+//
+// casters    - The entities to draw
+// view       - The light's view (transposed for HLSL)
+// projection - The light's projection (transposed for HLSL)
+// --------------------------------------------------------
+void Game::DrawShadowCasters(ID3D11DeviceContext* commandContext, const std::vector<Entity*>& casters, const XMFLOAT4X4& view, const XMFLOAT4X4& projection)
+{
+	D3D11RenderContext renderContext(renderDevice, commandContext);
+	ShadowVS_externalData casterData;
+	casterData.view = view;
+	casterData.projection = projection;
+
+	for (size_t e = 0; e < casters.size(); e++)
+	{
+		// Grab the data from the entity's mesh
+		casters[e]->DrawWithShadow(&renderContext);
+		casterData.world = casters[e]->GetMatrix();
+		shadowVS->CopyBufferData("externalData", &casterData, sizeof(casterData), commandContext);
+		// Finally do the actual drawing
+		renderContext.DrawIndexed(casters[e]->GetMesh()->GetIndexCount(), 0, 0);
+	}
+}
+
+// --------------------------------------------------------
+// Draws the sky (turned by skyRotation) to whatever targets
+// are bound - the back buffer, or a face of the environment
+// capture
+//
+// commandContext - Where to draw (binds everything it needs)
+// view           - Camera's view matrix (transposed for HLSL)
+// projection     - Camera's projection matrix (transposed for HLSL)
+// --------------------------------------------------------
+void Game::DrawSky(ID3D11DeviceContext* commandContext, const XMFLOAT4X4& view, const XMFLOAT4X4& projection)
+{
+	// Grab the buffers
+	D3D11RenderContext renderContext(renderDevice, commandContext);
+	timmy->Bind(&renderContext);
+
+	// Sky shaders and render states
+	PipelineStateCache::Bind(skyPSO, commandContext);
+	SkyVS_externalData skyData;
+	XMMATRIX V = XMMatrixTranspose(XMLoadFloat4x4(&view));
+	XMStoreFloat4x4(&skyData.view, XMMatrixTranspose(XMMatrixRotationY(skyRotation) * V));
+	skyData.projection = projection;
+	skyVS->CopyBufferData("externalData", &skyData, sizeof(skyData), commandContext);
+
+	skyPS->SetShaderResourceView("Sky", skySRV, commandContext);
+	skyPS->SetSamplerState("Sampler", freeSamples, commandContext);
+
+	// Actually draw
+	renderContext.DrawIndexed(timmy->GetIndexCount(), 0, 0);
+}
+
+// --------------------------------------------------------
+// The scene passes draw into the top left of the scene target,
+// at this frame's dynamic resolution (the render graph sets a
+// viewport over the whole target)
+// --------------------------------------------------------
+void Game::SetSceneViewport(ID3D11DeviceContext* commandContext)
+{
 	D3D11_VIEWPORT viewport = {};
-	viewport.TopLeftX = 0;
-	viewport.TopLeftY = 0;
-	viewport.Width = (float)shadowMapSize;
-	viewport.Height = (float)shadowMapSize;
+	viewport.Width = (float)renderWidth;
+	viewport.Height = (float)renderHeight;
 	viewport.MinDepth = 0.0f;
 	viewport.MaxDepth = 1.0f;
-	context->RSSetViewports(1, &viewport);
-
-	// Set up our shadow VS shader
-	shadowVS->SetShader();
-	shadowVS->SetMatrix4x4("view", shadowViewMatrix);
-	shadowVS->SetMatrix4x4("projection", shadowProjectionMatrix);
-
-	// Turn off pixel shader
-	context->PSSetShader(0, 0, 0);
-
-	// Grab the data from the first entity's mesh
-	one->DrawWithShadow(context);
-	shadowVS->SetMatrix4x4("world", one->GetMatrix());
-	shadowVS->CopyAllBufferData();
-	// Finally do the actual drawing
-	context->DrawIndexed(one->GetMesh()->GetIndexCount(), 0, 0);
-
-	// Grab the data from the second entity's mesh
-	two->DrawWithShadow(context);
-	shadowVS->SetMatrix4x4("world", two->GetMatrix());
-	shadowVS->CopyAllBufferData();
-	// Finally do the actual drawing
-	context->DrawIndexed(two->GetMesh()->GetIndexCount(), 0, 0);
-	
+	commandContext->RSSetViewports(1, &viewport);
+}
+
+// --------------------------------------------------------
+// Stretches the drawn part of the scene target over the back
+// buffer, filtered bilinearly
+// --------------------------------------------------------
+void Game::Upscale(ID3D11DeviceContext* commandContext)
+{
+	D3D11RenderContext renderContext(renderDevice, commandContext);
+	PipelineStateCache::Bind(upscalePSO, commandContext);
+
+	UpscalePS_upscaleData upscaleData;
+	upscaleData.uvScale = XMFLOAT2((float)renderWidth / width, (float)renderHeight / height);
+	upscaleData.uvMax = XMFLOAT2((renderWidth - 0.5f) / width, (renderHeight - 0.5f) / height);
+	upscalePS->CopyBufferData("upscaleData", &upscaleData, sizeof(upscaleData), commandContext);
+
+	upscalePS->SetShaderResourceView("Scene", renderGraphTextures->GetShaderResourceView(sceneColorResource), commandContext);
+	upscalePS->SetSamplerState("Sampler", upscaleSampler, commandContext);
+
+	// No buffers - the vertex shader makes the triangle
+	renderContext.Draw(3, 0);
+}
 
-	// Change everything back
-	context->OMSetRenderTargets(1, &backBufferRTV, depthStencilView);
-	viewport.Width = (float)width;
-	viewport.Height = (float)height;
-	context->RSSetViewports(1, &viewport);
-	context->RSSetState(0);
+// --------------------------------------------------------
+// Sets up a context for the main pass: the material's
+// pipeline state and every texture and sampler PixelShader
+// reads (the render graph binds the back buffer).  The
+// per-frame constant buffers are written once, on the
+// immediate context (see Draw).
+// --------------------------------------------------------
+void Game::BindMainPass(ID3D11DeviceContext* commandContext)
+{
+	PipelineStateCache::Bind(test->GetPipelineState(), commandContext);
+
+	SimplePixelShader* ps = test->GetPixelShader();
+	ps->SetShaderResourceView("diffuseTexture", test->GetShaderResourceView(), commandContext);
+	ps->SetSamplerState("basicSampler", test->GetSamplerState(), commandContext);
+	ps->SetShaderResourceView("ShadowMap", shadowSRV, commandContext);
+	ps->SetSamplerState("ShadowSampler", shadowSampler, commandContext);
+	ps->SetShaderResourceView("SpotShadowAtlas", renderGraphTextures->GetShaderResourceView(spotShadowAtlasResource), commandContext);
+	ps->SetShaderResourceView("ClusteredLights", clusteredLighting->GetLightsSRV(), commandContext);
+	ps->SetShaderResourceView("ClusterRanges", clusteredLighting->GetRangesSRV(), commandContext);
+	ps->SetShaderResourceView("ClusterLightIndices", clusteredLighting->GetIndicesSRV(), commandContext);
+	ps->SetShaderResourceView("RadianceMap", environmentCapture ? environmentCapture->GetRadianceMap() : radianceSRV, commandContext);
+	ps->SetShaderResourceView("PreviousRadianceMap", environmentCapture ? environmentCapture->GetPreviousRadianceMap() : radianceSRV, commandContext);
+	ps->SetShaderResourceView("IntegrationMap", brdfLutSRV, commandContext);
+}
+
+// --------------------------------------------------------
+// Records a run of the main pass: drawList[begin, end)
+// --------------------------------------------------------
+void Game::DrawEntities(ID3D11DeviceContext* commandContext, int begin, int end)
+{
+	BindMainPass(commandContext);
+	SetSceneViewport(commandContext);
+
+	D3D11RenderContext renderContext(renderDevice, commandContext);
+	for (int e = begin; e < end; e++)
+	{
+		drawList[e]->PrepareMaterial(camNewton->GetMatrixV(), camNewton->GetMatrixP(), camNewton->GetPosition(), commandContext);
+		drawList[e]->Draw(&renderContext);
+	}
+}
+
+// --------------------------------------------------------
+// Declares this frame's passes and what they read and write,
+// then compiles them.  The main pass is split into chunks
+// (each its own pass, so each records in parallel), one per
+// job system thread; they all write the scene target, so they
+// stay in order.  Shadows are only drawn if the material
+// reads them - otherwise the graph culls their passes.  The
+// scene target is window sized (so a new resolution doesn't
+// mean a new texture) and only the upscale writes the back
+// buffer.  Returns false if the passes don't compile (a
+// cycle), in which case there's nothing to run.
+// --------------------------------------------------------
+bool Game::BuildRenderGraph()
+{
+	renderGraph.Clear();
+
+	RenderGraphTextureDesc screenDesc = { (int)width, (int)height, 1, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_BIND_RENDER_TARGET };
+	RenderGraphTextureDesc sceneDesc = { (int)width, (int)height, 1, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE };
+	RenderGraphTextureDesc depthDesc = { (int)width, (int)height, 1, DXGI_FORMAT_D24_UNORM_S8_UINT, D3D11_BIND_DEPTH_STENCIL };
+	RenderGraphTextureDesc shadowDesc = { shadowMapSize, shadowMapSize, shadowSettings.CascadeCount, DXGI_FORMAT_R32_TYPELESS, D3D11_BIND_DEPTH_STENCIL | D3D11_BIND_SHADER_RESOURCE };
+	RenderGraphTextureDesc atlasDesc = { shadowAtlas->GetAtlasSize(), shadowAtlas->GetAtlasSize(), 1, DXGI_FORMAT_R32_TYPELESS, D3D11_BIND_DEPTH_STENCIL | D3D11_BIND_SHADER_RESOURCE };
+
+	int backBuffer = renderGraph.ImportTexture("Back buffer", screenDesc);
+	int depthBuffer = renderGraph.ImportTexture("Depth buffer", depthDesc);
+	int shadowMap = renderGraph.ImportTexture("Shadow map", shadowDesc);	// Kept for the static cache's copies
+	spotShadowAtlasResource = renderGraph.CreateTexture("Spot shadow atlas", atlasDesc);
+	sceneColorResource = renderGraph.CreateTexture("Scene", sceneDesc);
+	renderGraph.MarkOutput(backBuffer);
+
+	int cascades = renderGraph.AddPass("Shadows", [this](ID3D11DeviceContext* commandContext) { RenderShadowMap(commandContext); });
+	renderGraph.Write(cascades, shadowMap);
+
+	int spots = renderGraph.AddPass("Spot shadows", [this](ID3D11DeviceContext* commandContext) { RenderSpotShadows(commandContext); });
+	renderGraph.Write(spots, spotShadowAtlasResource);
+
+	bool shadows = (test->GetPermutationKey() & PERMUTATION_SHADOWS) != 0;
+	CommandRecorder::Split((int)drawList.size(), jobSystem->GetThreadCount(), 1, mainPassChunks);
+	for (size_t c = 0; c < mainPassChunks.size(); c++)
+	{
+		int begin = mainPassChunks[c].first;
+		int end = mainPassChunks[c].second;
+		int mainPass = renderGraph.AddPass("Main pass", [this, begin, end](ID3D11DeviceContext* commandContext) { DrawEntities(commandContext, begin, end); });
+		if (shadows)
+		{
+			renderGraph.Read(mainPass, shadowMap);
+			renderGraph.Read(mainPass, spotShadowAtlasResource);
+		}
+		renderGraph.Write(mainPass, sceneColorResource);
+		renderGraph.Write(mainPass, depthBuffer);
+	}
+
+	int sky = renderGraph.AddPass("Sky", [this](ID3D11DeviceContext* commandContext) { SetSceneViewport(commandContext); DrawSky(commandContext, camNewton->GetMatrixV(), camNewton->GetMatrixP()); });
+	renderGraph.Write(sky, sceneColorResource);
+	renderGraph.Write(sky, depthBuffer);
+
+	int upscale = renderGraph.AddPass("Upscale", [this](ID3D11DeviceContext* commandContext) { Upscale(commandContext); });
+	renderGraph.Read(upscale, sceneColorResource);
+	renderGraph.Write(upscale, backBuffer);
+
+	if (!renderGraph.Compile())
+	{
+#if defined(DEBUG) || defined(_DEBUG)
+		// The graph is the same every frame, so once is enough
+		static bool reported = false;
+		if (!reported)
+		{
+			reported = true;
+			printf("\nRender graph has a cycle, frames skipped:\n");
+			for (int p = 0; p < renderGraph.GetPassCount(); p++)
+			{
+				printf("  %s%s reads", renderGraph.GetPassName(p), renderGraph.IsCulled(p) ? " (culled)" : "");
+				for (size_t i = 0; i < renderGraph.GetReads(p).size(); i++)
+					printf(" %s", renderGraph.GetResourceName(renderGraph.GetReads(p)[i]));
+				printf(", writes");
+				for (size_t i = 0; i < renderGraph.GetWrites(p).size(); i++)
+					printf(" %s", renderGraph.GetResourceName(renderGraph.GetWrites(p)[i]));
+				printf("\n");
+			}
+		}
+#endif
+		return false;
+	}
+
+	renderGraphTextures->Allocate(&renderGraph);
+	renderGraphTextures->Import(backBuffer, 0, backBufferRTV, 0);
+	renderGraphTextures->Import(depthBuffer, 0, 0, depthStencilView);
+	renderGraphTextures->Import(shadowMap, shadowSRV, 0, 0);
+	return true;
 }
 
 // --------------------------------------------------------
@@ -513,33 +1656,43 @@ void Game::RenderShadowMap()
 // --------------------------------------------------------
 void Game::Draw(float deltaTime, float totalTime) //later, uncomment the shadow code
 {
-	//Shadows
-	RenderShadowMap();
-	
+	// This frame's share of re-capturing the sky.  If it drew
+	// anything it did so with its own states, so the pipeline
+	// state cache forgets what it thinks is bound; a frame that
+	// only blends or swaps probes leaves the states alone.
+	if (environmentCapture)
+	{
+		PROFILE_SCOPE("Environment capture");
+		environmentCapture->Update(deltaTime, [this](const XMFLOAT4X4& view, const XMFLOAT4X4& projection) { DrawSky(context, view, projection); });
+		environmentCapture->GetIrradianceData(irradianceData);
+		if (environmentCapture->GetScheduler()->GetLastFrameSteps() > 0)
+			pipelineStates->Invalidate();
+	}
+
 	// Background color (Cornflower Blue in this case) for clearing
 	const float color[4] = {0.4f, 0.6f, 0.75f, 0.0f};
 
-	// Clear the render target and depth buffer (erases what's on the screen)
+	// Clear the depth buffer (the scene target is cleared once
+	// the render graph has made it, below; the upscale covers
+	// the whole back buffer)
 	//  - Do this ONCE PER FRAME
 	//  - At the beginning of Draw (before drawing *anything*)
-	context->ClearRenderTargetView(backBufferRTV, color);
 	context->ClearDepthStencilView(
 		depthStencilView, 
 		D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL,
 		1.0f,
 		0);
 
-	pixelShader->SetData(
-		"light",
-		&dLightful, //same as above?
-		sizeof(DirectionalLight)
-	);
+	// The material picks which compiled variant of PixelShader.hlsl
+	// it uses, so per-frame data goes to that variant
+	SimplePixelShader* ps = test->GetPixelShader();
 
-	pixelShader->SetData(
-		"newLight",
-		&secondLight, //same as above?
-		sizeof(DirectionalLight)
-	);
+	// Both lights go up as one struct matching the cbuffer
+	// (including the padding HLSL puts after each light)
+	PixelShader_externalLight lightData = {};
+	lightData.light = dLightful;
+	lightData.newLight = secondLight;
+	ps->SetBufferData("externalLight", &lightData, sizeof(lightData));
 
 	/*pixelShader->SetData(
 		"spotLight",
@@ -548,59 +1701,69 @@ void Game::Draw(float deltaTime, float totalTime) //later, uncomment the shadow
 	);*/
 
 	//new
-	pixelShader->SetShaderResourceView("ShadowMap", shadowSRV);
-	pixelShader->SetSamplerState("ShadowSampler", shadowSampler);
+	ps->SetBufferData("shadowData", &shadowData, sizeof(shadowData));
+	ps->SetBufferData("spotLightData", &spotLightData, sizeof(spotLightData));
+	ps->SetBufferData("clusterData", &clusterData, sizeof(clusterData));
 
-	pixelShader->CopyAllBufferData();
-	pixelShader->SetShader();
-	
-	one->PrepareMaterial(camNewton->GetMatrixV(), camNewton->GetMatrixP(), shadowViewMatrix, shadowProjectionMatrix);
-	one->Draw(context);
+	// Only variants with IBL have it, and the scene's should
+	if (!ps->SetBufferData("irradianceData", &irradianceData, sizeof(irradianceData)))
+	{
+#if defined(DEBUG) || defined(_DEBUG)
+		static bool reported = false;
+		if (!reported)
+		{
+			reported = true;
+			printf("\nThe scene's pixel shader has no irradianceData - image based lighting is off\n");
+		}
+#endif
+	}
 
-    //
-	
-	two->PrepareMaterial(camNewton->GetMatrixV(), camNewton->GetMatrixP(), shadowViewMatrix, shadowProjectionMatrix);
-	two->Draw(context);
+	// Written once, here, before any of the jobs' lists run
+	ps->CopyAllBufferData();
 
-	// After drawing objects - Draw the sky!
+	// Record the frame in parallel, a job per pass, in the order
+	// the render graph compiled.  The lists are played back in
+	// that order, so the shadow maps are done before the main
+	// pass reads them and the sky only fills what's left.
+	bool compiled;
+	{
+		PROFILE_SCOPE("Render graph");
+		compiled = BuildRenderGraph();
+	}
 
-	// Grab the buffers
-	UINT stride = sizeof(Vertex);
-	UINT offset = 0;
-	ID3D11Buffer* skyVB = timmy->GetVertexBuffer();
-	ID3D11Buffer* skyIB = timmy->GetIndexBuffer();
-	context->IASetVertexBuffers(0, 1, &skyVB, &stride, &offset);
-	context->IASetIndexBuffer(skyIB, DXGI_FORMAT_R32_UINT, 0);
-
-	// Set up shaders
-	skyVS->SetMatrix4x4("view", camNewton->GetMatrixV());
-	skyVS->SetMatrix4x4("projection", camNewton->GetMatrixP());
-	skyVS->CopyAllBufferData();
-	skyVS->SetShader();
-
-	skyPS->SetShaderResourceView("Sky", skySRV);
-	skyPS->CopyAllBufferData();
-	skyPS->SetShader();
-
-	//Shadow matrices, DO NOT NEED THIS CODE
-	//vertexShader->SetMatrix4x4("shadowView", shadowViewMatrix);
-	//vertexShader->SetMatrix4x4("shadowProjection", shadowProjectionMatrix);
-
-	// Set the proper render states
-	context->RSSetState(skyRastState);
-	context->OMSetDepthStencilState(skyDepthState, 0);
+	// Nothing to record or show; the pacer still gets the frame
+	if (!compiled)
+	{
+		framePacer.MarkSubmitted();
+		return;
+	}
+
+	ID3D11RenderTargetView* sceneRTV = renderGraphTextures->GetRenderTargetView(sceneColorResource);
+	if (sceneRTV)
+		context->ClearRenderTargetView(sceneRTV, color);
+	commandRecorder->Clear();
+	const std::vector<int>& passes = renderGraph.GetOrder();
+	for (size_t p = 0; p < passes.size(); p++)
+	{
+		int pass = passes[p];
+		commandRecorder->AddJob(renderGraph.GetPassName(pass), [this, pass](ID3D11DeviceContext* commandContext) { renderGraphTextures->ExecutePass(commandContext, pass); });
+	}
 
-	// Actually draw
-	context->DrawIndexed(timmy->GetIndexCount(), 0, 0);
+	commandRecorder->Record();
+	commandRecorder->Execute();
 
-	// Reset the states! Supposedly this piece of code was missing...but here it is, in the right place
-	context->RSSetState(0);
-	context->OMSetDepthStencilState(0, 0);
-	pixelShader->SetShaderResourceView("ShadowMap", 0); //new
+	// Playing back the lists leaves the immediate context with
+	// nothing bound, but if the jobs had to record straight onto
+	// it the shadow maps would still be bound for reading
+	renderGraphTextures->ApplyUnbinds(context, renderGraph.GetFinalUnbinds());
+	pipelineStates->Invalidate();
 
 	// Present the back buffer to the user
 	//  - Puts the final frame we're drawing into the window so the user can see it
 	//  - Do this exactly ONCE PER FRAME (always at the very end of the frame)
+	//  - No vsync: the frame pacer (see DXCore::Run) sets the rate
+	framePacer.MarkSubmitted();
+	PROFILE_SCOPE("Present");
 	swapChain->Present(0, 0);
 }
 
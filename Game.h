@@ -2,19 +2,37 @@
 
 #include "DXCore.h"
 #include "SimpleShader.h"
+#include "ShaderLibrary.h"
 #include "Mesh.h"
 #include "Entity.h"
 #include "Camera.h"
 #include "Material.h"
+#include "PipelineState.h"
+#include "IBLPrecompute.h"
+#include "EnvironmentCapture.h"
 #include "Lights.h"
+#include "ShadowCascades.h"
+#include "ShadowCache.h"
+#include "ShadowAtlas.h"
+#include "ClusteredLighting.h"
+#include "CommandRecorder.h"
+#include "RenderGraphTextures.h"
+#include "D3D11RenderDevice.h"
+#include "Benchmark.h"
+#include "FrustumCuller.h"
+#include "JobSystem.h"
+#include "FrameArena.h"
+#include "DynamicResolution.h"
+#include "CameraPath.h"
 #include <DirectXMath.h>
+#include <vector>
 
 class Game 
 	: public DXCore
 {
 
 public:
-	Game(HINSTANCE hInstance);
+	Game(HINSTANCE hInstance, const BenchmarkSettings& benchmarkSettings = BenchmarkSettings());
 	~Game();
 
 	// Overridden setup and game loop methods, which
@@ -22,7 +40,23 @@ public:
 	void Init();
 	void OnResize();
 	void Update(float deltaTime, float totalTime);
-	void RenderShadowMap();
+	void UpdateShadowCascades();
+	void UpdateSpotLights();
+	void UpdateClusteredLights(float totalTime);
+	void UpdateDynamicResolution();
+	void UpdateBenchmark(float totalTime);
+	void UpdateTransforms();
+	void BuildDrawList();
+	void UpdatePathRecording(float totalTime);
+	void RenderShadowMap(ID3D11DeviceContext* commandContext);
+	void RenderSpotShadows(ID3D11DeviceContext* commandContext);
+	void DrawShadowCasters(ID3D11DeviceContext* commandContext, const std::vector<Entity*>& casters, const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection);
+	void BindMainPass(ID3D11DeviceContext* commandContext);
+	void DrawEntities(ID3D11DeviceContext* commandContext, int begin, int end);
+	void DrawSky(ID3D11DeviceContext* commandContext, const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection);
+	void SetSceneViewport(ID3D11DeviceContext* commandContext);
+	void Upscale(ID3D11DeviceContext* commandContext);
+	bool BuildRenderGraph();
 	void Draw(float deltaTime, float totalTime);
 
 	// Overridden mouse input helper methods
@@ -36,18 +70,77 @@ private:
 	
 	// Initialization helper methods - feel free to customize, combine, etc.
 	void LoadShaders(); 
+	bool LoadShadersFromLibrary();
+	void BakeShaderLibrary(const char* path);
+	void CreatePermutationCache();
 	void CreateMatrices();
 	void CreateBasicGeometry();
 
+	// Startup tasks (see Init)
+	void LoadDiffuseTexture();
+	void LoadSkyTexture();
+	void PrefilterRadianceMap();
+	void ProjectIrradiance();
+	void CreateBrdfLut();
+	void CreateEnvironmentCapture();
+	void CreateSamplers();
+	void CreatePipelineStates();
+	void CreateShadowMapResources();
+	void CreateClusteredLighting();
+	void CreateCommandRecorder();
+	void CreateMaterials();
+	void CreateEntities();
+
 	// Texture related DX stuff, may not need some of the things
 	ID3D11ShaderResourceView* textureSRV;
 	ID3D11ShaderResourceView* normalMapSRV;
 	ID3D11ShaderResourceView* skySRV;
+	ID3D11ShaderResourceView* radianceSRV;	// Prefiltered sky, one roughness per mip
+	ID3D11ShaderResourceView* brdfLutSRV;	// Split-sum environment BRDF (baked)
 	ID3D11SamplerState* sampler;
 
-	// Render states
-	ID3D11RasterizerState* skyRastState;
-	ID3D11DepthStencilState* skyDepthState;
+	// The frame's fine grained work - moving entities, culling,
+	// light assignment, recording - runs as jobs on this, on
+	// every core (including the main thread)
+	JobSystem* jobSystem;
+
+	// The frame's short-lived memory (lists built and used
+	// within a frame), an arena per job thread, kept for as
+	// many frames as can be in flight
+	FrameArena* frameArena;
+
+	// Meshes and draws go through this (see RenderDevice); the
+	// shaders and states are still set on D3D11 directly
+	D3D11RenderDevice* renderDevice;
+
+	// The frame is recorded as jobs on worker threads (deferred
+	// contexts), then played back in order
+	CommandRecordingBackend* recordingBackend;
+	CommandRecorder* commandRecorder;
+
+	// Rebuilt each frame: the passes, what they read and write,
+	// and the textures only the frame needs
+	RenderGraph renderGraph;
+	RenderGraphTextures* renderGraphTextures;
+	int spotShadowAtlasResource;	// Transient in renderGraph
+	int sceneColorResource;			// Ditto
+
+	// The scene renders into the top left renderWidth x
+	// renderHeight of a window sized target, scaled to keep the
+	// GPU's frame time in budget, then is upscaled to the back
+	// buffer.  Off (full size) when benchmarking.
+	DynamicResolution dynamicResolution;
+	bool dynamicResolutionEnabled;
+	unsigned long long nextResolutionFrame;	// Next Profiler frame whose GPU time it wants
+	int renderWidth;
+	int renderHeight;
+
+	// Pipeline states (shaders + render states) for each pass
+	PipelineStateCache* pipelineStates;
+	PipelineState* skyPSO;
+	PipelineState* shadowPSO;
+	PipelineState* transparentPSO; //will help with transparency
+	PipelineState* upscalePSO;
 
 	//meshes
 	Mesh * timmy;
@@ -57,38 +150,104 @@ private:
 	//Entities
 	Entity * one;
 	Entity * two;
-	Entity * three;
+	Entity * three;	// The ground - never moves
+	std::vector<Entity*> sceneEntities;	// Everything the main pass could draw
+
+	// This frame's main pass: sceneEntities in the camera's view,
+	// in order.  Culled and gathered a chunk per job, then joined.
+	FrustumCuller frustumCuller;
+	std::vector<Entity*> drawList;
+	std::vector<std::pair<int, int>> drawListChunks;	// Ranges of sceneEntities
+	std::vector<std::pair<int, int>> mainPassChunks;	// Ranges of drawList, a recording job each
+
+	// Shadow casters, by whether they move
+	std::vector<Entity*> staticCasters;
+	std::vector<Entity*> dynamicCasters;
 
 	//Camera stuff
 	Camera * camNewton;
 	DirectX::XMFLOAT4X4 holdCamMatrix;
 
+	// Benchmark mode (see BenchmarkSettings): a fixed time step,
+	// the camera flying cameraPath, and the run's results
+	// written out when it's done.  Null when not benchmarking.
+	BenchmarkSettings benchmarkSettings;
+	BenchmarkRun* benchmark;
+	CameraPath cameraPath;
+	std::vector<Entity*> stressEntities;	// Also in sceneEntities and dynamicCasters
+
+	// F5 starts and stops recording the camera's flight, which
+	// is saved to CameraPath.txt (for --path)
+	CameraPath recordedPath;
+	bool recordingPath;
+	bool recordKeyDown;
+	float recordStartTime;
+
 	//Material(s)
 	Material * test;
 
 	//Light(s)
 	DirectionalLight dLightful;
 	DirectionalLight secondLight;
-	//SpotLight spotMe;
+	SpotLight spotLights[MAX_SPOT_LIGHTS];
+	int spotLightCount;
+
+	// Lots of small unshadowed lights, shaded through the
+	// cluster grid (see ClusteredLighting)
+	ClusteredLighting* clusteredLighting;
+	std::vector<ClusterLight> sceneLights;
+	std::vector<DirectX::XMFLOAT3> sceneLightOrigins;	// Where each one bobs around
+	PixelShader_clusterData clusterData;
+
+	// Baked shaders + reflection data (memory mapped, see LoadShaders)
+	ShaderLibrary* shaderLibrary;
+	std::string shaderLibraryPath;
 
 	// Wrappers for DirectX shaders to provide simplified functionality
 	SimpleVertexShader* vertexShader;
 	SimplePixelShader* pixelShader;
+	ShaderPermutationCache* pixelPermutations;	// Variants of pixelShader, by feature key
+	ShaderPermutationKey sceneMaterialKey;		// The scene material's variant (decides what startup makes)
 
 	SimpleVertexShader* skyVS;
 	SimplePixelShader* skyPS;
 
+	SimpleVertexShader* upscaleVS;
+	SimplePixelShader* upscalePS;
+	ID3D11SamplerState* upscaleSampler;	// Bilinear, clamped
+
+	// Image based lighting
+	IBLPrecompute* iblPrecompute;
+	PixelShader_irradianceData irradianceData;	// Sky's diffuse irradiance as SH9
+	EnvironmentCapture* environmentCapture;		// Re-captures the sky as it turns
+	float skyRotation;
+
 	//Things we will need for the Shadow Map
-	int shadowMapSize;
-	ID3D11DepthStencilView* shadowDSV;
+	int shadowMapSize;	// Per cascade
+	ID3D11Texture2D* shadowTexture;
+	ID3D11DepthStencilView* shadowDSVs[SHADOW_MAX_CASCADES];	// One per slice of the array
+
+	// Static casters' depth, copied into the shadow map each frame
+	// and only re-rendered when the cache says so
+	ID3D11Texture2D* staticShadowTexture;
+	ID3D11DepthStencilView* staticShadowDSVs[SHADOW_MAX_CASCADES];
+	ShadowCache shadowCache;
+
+	// Spot lights' shadows share one atlas, a tile per light
+	ShadowAtlas* shadowAtlas;
+	std::vector<ShadowAtlasRequest> spotShadowRequests;	// This frame's, rebuilt each frame
+	DirectX::XMFLOAT4X4 spotShadowViews[MAX_SPOT_LIGHTS];		// Transposed for HLSL
+	DirectX::XMFLOAT4X4 spotShadowProjections[MAX_SPOT_LIGHTS];
+	PixelShader_spotLightData spotLightData;
 	ID3D11ShaderResourceView* shadowSRV;
 	ID3D11SamplerState* shadowSampler;
-	ID3D11RasterizerState* shadowRasterizer;
-	ID3D11RasterizerState* rsNoCull;
-	ID3D11BlendState* blendState; //will help with transparency
 	SimpleVertexShader* shadowVS;
-	DirectX::XMFLOAT4X4 shadowViewMatrix;
-	DirectX::XMFLOAT4X4 shadowProjectionMatrix;
+
+	// Cascades fitted to the camera each frame
+	ShadowCascadeSettings shadowSettings;
+	ShadowCascade shadowCascades[SHADOW_MAX_CASCADES];
+	int shadowCascadeCount;
+	PixelShader_shadowData shadowData;
 
 	// The matrices to go from model space to screen space
 	DirectX::XMFLOAT4X4 worldMatrix;
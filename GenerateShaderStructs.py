@@ -0,0 +1,254 @@
+"""
+Generates ShaderStructs.h from the cbuffer declarations in the .hlsl files.
+
+Every cbuffer becomes a C++ struct named <ShaderFile>_<cbuffer> (plus any
+HLSL structs the cbuffers use), laid out with the HLSL packing rules:
+
+  - Variables are packed into 16 byte registers and may not straddle one
+  - Structs, arrays and matrices start on a new register
+  - Whatever follows a struct or array also starts on a new register
+  - The buffer's size is rounded up to a whole register
+
+Explicit padding members fill the gaps, and every offset and size is
+static_assert'ed, so a layout mismatch is a compile error rather than
+garbage on the GPU.  A cbuffer can then be filled as one struct and
+handed to ISimpleShader::SetBufferData() in a single memcpy.
+
+Run from the project directory (the pre-build step does this):
+    python GenerateShaderStructs.py [projectDir]
+"""
+
+import glob
+import os
+import re
+import sys
+
+OUTPUT = "ShaderStructs.h"
+
+# HLSL type -> (C++ type, size in bytes, needs a new register)
+TYPES = {
+    "float":    ("float", 4, False),
+    "float2":   ("DirectX::XMFLOAT2", 8, False),
+    "float3":   ("DirectX::XMFLOAT3", 12, False),
+    "float4":   ("DirectX::XMFLOAT4", 16, False),
+    "int":      ("int", 4, False),
+    "int2":     ("DirectX::XMINT2", 8, False),
+    "int3":     ("DirectX::XMINT3", 12, False),
+    "int4":     ("DirectX::XMINT4", 16, False),
+    "uint":     ("unsigned int", 4, False),
+    "uint2":    ("DirectX::XMUINT2", 8, False),
+    "uint3":    ("DirectX::XMUINT3", 12, False),
+    "uint4":    ("DirectX::XMUINT4", 16, False),
+    "bool":     ("int", 4, False),  # HLSL bools are 32 bits
+    "matrix":   ("DirectX::XMFLOAT4X4", 64, True),
+    "float4x4": ("DirectX::XMFLOAT4X4", 64, True),
+}
+
+
+class Member:
+    def __init__(self, type_name, name, count):
+        self.type_name = type_name
+        self.name = name
+        self.count = count  # 0 for non-arrays
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    # Declarations inside #if blocks still get a struct - the
+    # layout doesn't depend on which permutation is compiled
+    text = re.sub(r"^\s*#[^\n]*", "", text, flags=re.M)
+    return text
+
+
+def parse_members(body, where):
+    members = []
+    for decl in body.split(";"):
+        decl = decl.strip()
+        if not decl:
+            continue
+        # Drop modifiers we don't care about and any packoffset/semantic
+        decl = re.sub(r"\b(row_major|column_major|const|static)\b", "", decl)
+        decl = decl.split(":")[0].strip()
+        match = re.match(r"^(\w+)\s+(\w+)\s*(?:\[\s*(\d+)\s*\])?$", decl)
+        if not match:
+            raise SyntaxError("%s: can't parse '%s'" % (where, decl))
+        members.append(Member(match.group(1), match.group(2), int(match.group(3) or 0)))
+    return members
+
+
+def parse_file(path, structs, cbuffers):
+    text = strip_comments(open(path).read())
+    shader = os.path.splitext(os.path.basename(path))[0]
+
+    for match in re.finditer(r"\bstruct\s+(\w+)\s*\{(.*?)\}\s*;", text, flags=re.S):
+        name, body = match.group(1), match.group(2)
+        try:
+            members = parse_members(body, "%s: struct %s" % (path, name))
+        except SyntaxError:
+            continue  # Not something a cbuffer could use
+        structs.setdefault(name, []).append((path, members))
+
+    for match in re.finditer(r"\bcbuffer\s+(\w+)\s*(?::\s*register\s*\(\s*b(\d+)\s*\))?\s*\{(.*?)\}\s*;?",
+                             text, flags=re.S):
+        name, register, body = match.group(1), match.group(2), match.group(3)
+        members = parse_members(body, "%s: cbuffer %s" % (path, name))
+        cbuffers.append((shader, name, register, members))
+
+
+class Layout:
+    """Lays out members with the HLSL packing rules, emitting C++ as it goes"""
+
+    def __init__(self, structs):
+        self.structs = structs
+        self.offset = 0
+        self.force_new_register = False
+        self.lines = []
+        self.asserts = []
+        self.padding = 0
+
+    def pad_to(self, offset):
+        if offset > self.offset:
+            self.lines.append("\tfloat _pad%d[%d];" % (self.padding, (offset - self.offset) // 4))
+            self.padding += 1
+            self.offset = offset
+
+    def type_info(self, type_name):
+        if type_name in TYPES:
+            return TYPES[type_name]
+        if type_name in self.structs:
+            return (type_name, struct_size(type_name, self.structs), True)
+        raise SyntaxError("unknown type '%s'" % type_name)
+
+    def add(self, owner, member):
+        cpp_type, size, new_register = self.type_info(member.type_name)
+        is_struct = member.type_name in self.structs
+
+        if member.count:
+            # Every array element takes whole registers, which the C++
+            # side can only match if the element already fills them
+            if size % 16 != 0:
+                raise SyntaxError("%s.%s: arrays of %s don't map to C++ (pad the element to 16 bytes)"
+                                  % (owner, member.name, member.type_name))
+            new_register = True
+            total = size * member.count
+        else:
+            total = size
+
+        start = self.offset
+        register_end = (start // 16 + 1) * 16
+        if new_register or self.force_new_register or (start % 16 != 0 and start + min(total, 16) > register_end):
+            start = align16(start)
+        self.pad_to(start)
+
+        suffix = "[%d]" % member.count if member.count else ""
+        self.lines.append("\t%s %s%s;" % (cpp_type, member.name, suffix))
+        self.asserts.append("static_assert(offsetof(%s, %s) == %d, \"%s.%s offset doesn't match HLSL\");"
+                            % (owner, member.name, start, owner, member.name))
+        self.offset = start + total
+        self.force_new_register = is_struct or member.count > 0
+
+
+def align16(value):
+    return (value + 15) // 16 * 16
+
+
+def struct_size(name, structs):
+    layout = Layout(structs)
+    for member in structs[name]:
+        layout.add(name, member)
+    return layout.offset
+
+
+def used_structs(members, structs, out):
+    for member in members:
+        if member.type_name in structs and member.type_name not in out:
+            used_structs(structs[member.type_name], structs, out)
+            out.append(member.type_name)
+
+
+def generate(project_dir):
+    structs = {}
+    cbuffers = []
+    files = sorted(glob.glob(os.path.join(project_dir, "*.hlsl")) + glob.glob(os.path.join(project_dir, "*.hlsli")))
+    for path in files:
+        parse_file(path, structs, cbuffers)
+
+    # Structs shared by several shaders (e.g. DirectionalLight) must
+    # agree everywhere.  Pipeline structs like VertexToPixel differ
+    # per shader, but they never appear in a cbuffer.
+    def signature(members):
+        return [(m.type_name, m.name, m.count) for m in members]
+
+    found = structs
+    structs = {}
+    for name, definitions in found.items():
+        structs[name] = definitions[0][1]
+
+    needed = []
+    for _, _, _, members in cbuffers:
+        used_structs(members, structs, needed)
+
+    for name in needed:
+        for path, members in found[name][1:]:
+            if signature(members) != signature(structs[name]):
+                raise SyntaxError("struct %s differs between %s and %s" % (name, found[name][0][0], path))
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// --------------------------------------------------------")
+    out.append("// GENERATED by GenerateShaderStructs.py from the cbuffers in")
+    out.append("// the .hlsl files - don't edit by hand, edit the shaders.")
+    out.append("//")
+    out.append("// Each cbuffer is a struct named <ShaderFile>_<cbuffer> with")
+    out.append("// HLSL packing applied, so it can be uploaded in one memcpy")
+    out.append("// with ISimpleShader::SetBufferData().")
+    out.append("// --------------------------------------------------------")
+    out.append("")
+    out.append("#include <stddef.h>")
+    out.append("#include <DirectXMath.h>")
+    out.append("")
+
+    for name in needed:
+        layout = Layout(structs)
+        for member in structs[name]:
+            layout.add(name, member)
+        out.append("struct %s" % name)
+        out.append("{")
+        out.extend(layout.lines)
+        out.append("};")
+        out.extend(layout.asserts)
+        out.append("static_assert(sizeof(%s) == %d, \"%s size doesn't match HLSL\");" % (name, layout.offset, name))
+        out.append("")
+
+    for shader, name, register, members in cbuffers:
+        owner = "%s_%s" % (shader, name)
+        layout = Layout(structs)
+        for member in members:
+            layout.add(owner, member)
+        layout.pad_to(align16(layout.offset))
+
+        where = "%s.hlsl, register(b%s)" % (shader, register) if register else "%s.hlsl" % shader
+        out.append("// cbuffer %s (%s)" % (name, where))
+        out.append("struct %s" % owner)
+        out.append("{")
+        out.extend(layout.lines)
+        out.append("};")
+        out.extend(layout.asserts)
+        out.append("static_assert(sizeof(%s) == %d, \"%s size doesn't match HLSL\");" % (owner, layout.offset, owner))
+        out.append("")
+
+    text = "\n".join(out)
+
+    # Only touch the file when it changes, so it doesn't trigger rebuilds
+    path = os.path.join(project_dir, OUTPUT)
+    if os.path.exists(path) and open(path).read() == text:
+        return
+    with open(path, "w", newline="\n") as f:
+        f.write(text)
+    print("GenerateShaderStructs: wrote %s" % path)
+
+
+if __name__ == "__main__":
+    generate(sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__)))
@@ -0,0 +1,105 @@
+// --------------------------------------------------------
+// Offline tool: the benchmark mode with no window or GPU, so
+// it can run unattended anywhere (excluded from the game
+// build).  The demo scene (see DemoScene) is drawn on the
+// null device - which times the CPU side of a frame - or the
+// software rasterizer, flying the camera path with a fixed
+// time step.
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread HeadlessBenchmark.cpp Benchmark.cpp CameraPath.cpp DemoScene.cpp JobSystem.cpp Profiler.cpp NullRenderDevice.cpp SoftwareRenderDevice.cpp SoftwareShaders.cpp ShadowCascades.cpp LightClusterGrid.cpp AllocationCounter.cpp -o HeadlessBenchmark
+//   ./HeadlessBenchmark --benchmark crowd --frames 500 --out crowd
+//
+// Takes the game's benchmark arguments (see BenchmarkSettings;
+// --benchmark is implied), and --backend null|software.
+// Writes NAME.csv / NAME.json and prints the summary.  Every
+// pass is a series; there's no GPU time.
+// --------------------------------------------------------
+
+#include "Benchmark.h"
+#include "CameraPath.h"
+#include "DemoScene.h"
+#include "JobSystem.h"
+#include "NullRenderDevice.h"
+#include "Profiler.h"
+#include "SoftwareRenderDevice.h"
+
+#include <stdio.h>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+	BenchmarkSettings settings;
+	std::string error;
+	if (!ParseBenchmarkArguments(argc, argv, settings, error))
+	{
+		printf("%s\n", error.c_str());
+		return 2;
+	}
+
+	bool software = settings.Backend == "software";
+	if (!software && settings.Backend != "null")
+	{
+		printf("No backend called %s (null or software)\n", settings.Backend.c_str());
+		return 2;
+	}
+
+	const BenchmarkScene* preset = FindBenchmarkScene(settings.Scene.c_str());
+	int stressEntities = settings.StressEntities >= 0 ? settings.StressEntities : preset->StressEntities;
+	settings.StressEntities = stressEntities;
+
+	CameraPath path;
+	if (settings.CameraPath.empty())
+		path.MakeOrbit(8.0f, 2.0f, 20.0f, 8);
+	else if (!path.Load(settings.CameraPath.c_str()))
+	{
+		printf("Can't read camera path %s\n", settings.CameraPath.c_str());
+		return 2;
+	}
+
+	// Moving the cubes, light assignment and rasterizing tiles
+	// all go through the job system, as in the game
+	JobSystem jobs(settings.Threads > 0 ? settings.Threads - 1 : -1);
+	NullRenderDevice nullDevice;
+	SoftwareRenderDevice softwareDevice;
+	softwareDevice.SetParallelFor(jobs.GetParallelFor());
+	RenderDevice* device = software ? (RenderDevice*)&softwareDevice : (RenderDevice*)&nullDevice;
+
+	DemoScene scene;
+	scene.SetParallelFor(jobs.GetParallelFor());
+	if (!scene.Create(device, settings.Width, settings.Height, preset->LightsPerSide, stressEntities))
+		return 2;
+
+	// So each pass's rasterizing is timed in that pass
+	if (software)
+		scene.SetPassEndCallback([&softwareDevice]() { softwareDevice.GetSoftwareImmediateContext()->Flush(); });
+
+	printf("%s (%s): %d entities, %d lights, %dx%d on the %s device, %d thread(s), %d + %d frames\n",
+		preset->Name, preset->Description, scene.GetEntityCount(), scene.GetLightCount(),
+		settings.Width, settings.Height, settings.Backend.c_str(), jobs.GetThreadCount(), settings.WarmupFrames, settings.Frames);
+
+	Profiler::SetThreadName("Main");
+	BenchmarkRun run(settings);
+	for (int frame = 0; !run.IsFinished(); frame++)
+	{
+		float time = frame * settings.TimeStep;
+		CameraKey camera;
+		path.Sample(time, camera);
+		scene.Render(time, &camera);
+
+		if (!software)
+			nullDevice.GetNullImmediateContext()->Reset();
+		Profiler::EndFrame();
+		run.Update();
+	}
+
+	run.PrintSummary();
+	if (Profiler::GetDroppedCount() > 0)
+		printf("%u profiler scopes were dropped\n", Profiler::GetDroppedCount());
+	if (!run.WriteResults(settings.Output.c_str()))
+	{
+		printf("Can't write %s.csv / .json\n", settings.Output.c_str());
+		return 1;
+	}
+	return 0;
+}
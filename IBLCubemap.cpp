@@ -1,9 +1,28 @@
 #include "IBLCubemap.h"
 
 
-
-IBLCubemap::IBLCubemap(ID3D11Device* device, int mipLevels, int size)
+// --------------------------------------------------------
+// Creates the cubemap texture, its SRV and a render target
+// per face per mip
+//
+// mipLevels    - Number of mips (0 = the full chain down to 1x1)
+// size         - Width and height of each face
+// generateMips - Allow ID3D11DeviceContext::GenerateMips() on it
+// --------------------------------------------------------
+IBLCubemap::IBLCubemap(ID3D11Device* device, int mipLevels, int size, bool generateMips)
 {
+	// Work out how many mips a full chain has
+	int fullChain = 1;
+	while ((size >> fullChain) > 0)
+		fullChain++;
+	if (mipLevels <= 0 || mipLevels > fullChain)
+		mipLevels = fullChain;
+	if (mipLevels > D3D11_REQ_MIP_LEVELS)
+		mipLevels = D3D11_REQ_MIP_LEVELS;
+
+	this->size = size;
+	this->mipLevels = mipLevels;
+
 	D3D11_TEXTURE2D_DESC texDesc;
 
 	texDesc.Width                = size;
@@ -17,24 +36,27 @@ IBLCubemap::IBLCubemap(ID3D11Device* device, int mipLevels, int size)
 	texDesc.BindFlags            = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
 	texDesc.CPUAccessFlags       = 0;
 	texDesc.MiscFlags            = D3D11_RESOURCE_MISC_TEXTURECUBE;
+	if (generateMips)
+		texDesc.MiscFlags |= D3D11_RESOURCE_MISC_GENERATE_MIPS;
 
-	this->surfaces[0] = new IBLCubemapFace(device, this->texture.Get(), texDesc.Format, texDesc.Width, 0, texDesc.MipLevels);
-	this->surfaces[1] = new IBLCubemapFace(device, this->texture.Get(), texDesc.Format, texDesc.Width, 1, texDesc.MipLevels);
-	this->surfaces[2] = new IBLCubemapFace(device, this->texture.Get(), texDesc.Format, texDesc.Width, 2, texDesc.MipLevels);
-	this->surfaces[3] = new IBLCubemapFace(device, this->texture.Get(), texDesc.Format, texDesc.Width, 3, texDesc.MipLevels);
-	this->surfaces[4] = new IBLCubemapFace(device, this->texture.Get(), texDesc.Format, texDesc.Width, 4, texDesc.MipLevels);
-	this->surfaces[5] = new IBLCubemapFace(device, this->texture.Get(), texDesc.Format, texDesc.Width, 5, texDesc.MipLevels);
+	device->CreateTexture2D(&texDesc, 0, this->texture.GetAddressOf());
+
+	for (int face = 0; face < 6; face++)
+		this->surfaces[face] = new IBLCubemapFace(device, this->texture.Get(), texDesc.Format, texDesc.Width, face, texDesc.MipLevels);
 
 	D3D11_SHADER_RESOURCE_VIEW_DESC texShaderResourceViewDesc;
 
 	texShaderResourceViewDesc.Format = texDesc.Format;
 	texShaderResourceViewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE;
-	texShaderResourceViewDesc.Texture2D.MostDetailedMip = 0;
-	texShaderResourceViewDesc.Texture2D.MipLevels = texDesc.MipLevels;
+	texShaderResourceViewDesc.TextureCube.MostDetailedMip = 0;
+	texShaderResourceViewDesc.TextureCube.MipLevels = texDesc.MipLevels;
+
+	device->CreateShaderResourceView(this->texture.Get(), &texShaderResourceViewDesc, this->shaderResourceView.GetAddressOf());
 }
 
 
 IBLCubemap::~IBLCubemap()
 {
-	delete this->surfaces;
+	for (int face = 0; face < 6; face++)
+		delete this->surfaces[face];
 }
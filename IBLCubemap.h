@@ -2,10 +2,15 @@
 #include "IBLCubemapFace.h"
 #include <wrl.h>
 
+// --------------------------------------------------------
+// A renderable cubemap with a full set of mips - the target
+// the radiance prefilter draws into, one face and mip at a
+// time, before it's sampled as a TextureCube
+// --------------------------------------------------------
 class IBLCubemap
 {
 public:
-	IBLCubemap(ID3D11Device* device, int mipLevels, int size);
+	IBLCubemap(ID3D11Device* device, int mipLevels, int size, bool generateMips = false);
 	
 	~IBLCubemap();
 
@@ -16,10 +21,16 @@ public:
 		return this->shaderResourceView.GetAddressOf();
 	};
 
+	ID3D11ShaderResourceView* GetShaderResourceView() { return this->shaderResourceView.Get(); }
+	ID3D11Texture2D* GetTexture() { return this->texture.Get(); }
+	int GetSize() { return this->size; }
+	int GetMipLevels() { return this->mipLevels; }
+
 	IBLCubemapFace* surfaces[6];
 
 private:
 	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> shaderResourceView;
 	Microsoft::WRL::ComPtr<ID3D11Texture2D> texture;
+	int size;
+	int mipLevels;
 };
-
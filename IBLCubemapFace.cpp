@@ -2,6 +2,13 @@
 
 IBLCubemapFace::IBLCubemapFace(ID3D11Device* device, ID3D11Texture2D* texture, DXGI_FORMAT format, int size, int arrayIndex, int mipCount)
 {
+	if (mipCount > D3D11_REQ_MIP_LEVELS)
+		mipCount = D3D11_REQ_MIP_LEVELS;
+	this->mipCount = mipCount;
+
+	for (int mipIndex = 0; mipIndex < D3D11_REQ_MIP_LEVELS; mipIndex++)
+		this->renderTargets[mipIndex] = 0;
+
 	for (int mipIndex = 0; mipIndex < mipCount; mipIndex++)
 	{
 		D3D11_RENDER_TARGET_VIEW_DESC texRenderTargetViewDesc;
@@ -17,11 +24,16 @@ IBLCubemapFace::IBLCubemapFace(ID3D11Device* device, ID3D11Texture2D* texture, D
 		texRenderTargetViewDesc.Texture2DArray.ArraySize                 = 1;
 		texRenderTargetViewDesc.Texture2DArray.FirstArraySlice           = arrayIndex;
 
+		device->CreateRenderTargetView(texture, &texRenderTargetViewDesc, &this->renderTargets[mipIndex]);
    }
 }
 
 
 IBLCubemapFace::~IBLCubemapFace()
 {
-	delete this->renderTargets;
+	for (int mipIndex = 0; mipIndex < this->mipCount; mipIndex++)
+	{
+		if (this->renderTargets[mipIndex])
+			this->renderTargets[mipIndex]->Release();
+	}
 }
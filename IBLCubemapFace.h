@@ -1,6 +1,10 @@
 #pragma once
 #include <d3d11.h>
 
+// --------------------------------------------------------
+// One face of an IBLCubemap, with a render target view for
+// each of its mips (so every mip can be rendered into)
+// --------------------------------------------------------
 class IBLCubemapFace
 {
 public:
@@ -8,6 +12,10 @@ public:
 	
 	~IBLCubemapFace();
 
-	ID3D11RenderTargetView* renderTargets[7];
-};
+	int GetMipCount() { return mipCount; }
+
+	ID3D11RenderTargetView* renderTargets[D3D11_REQ_MIP_LEVELS];
 
+private:
+	int mipCount;
+};
@@ -0,0 +1,460 @@
+#include "IBLPrecompute.h"
+#include "DDSFile.h"
+#include "ShaderStructs.h"
+#include "DDSTextureLoader.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+// Vertex layout RadMapVS expects
+struct QuadVertex
+{
+	float Position[4];
+	float TexCoord[2];
+};
+
+IBLPrecompute::IBLPrecompute(ID3D11Device* device, ID3D11DeviceContext* context)
+{
+	this->device = device;
+	this->context = context;
+
+	radMapVS = 0;
+	radMapPS = 0;
+	quadVB = 0;
+	envSampler = 0;
+
+	lastSource = SOURCE_NONE;
+	lastMs = 0;
+
+	savedRTV = 0;
+	savedDSV = 0;
+	savedViewportCount = 0;
+}
+
+IBLPrecompute::~IBLPrecompute()
+{
+	delete radMapVS;
+	delete radMapPS;
+	if (quadVB) { quadVB->Release(); }
+	if (envSampler) { envSampler->Release(); }
+}
+
+// --------------------------------------------------------
+// Loads the prefilter shaders (same two relative paths as
+// Game::LoadShaders) and creates the full screen quad
+//
+// Returns false if the GPU path can't be used
+// --------------------------------------------------------
+bool IBLPrecompute::LoadShaders()
+{
+	radMapVS = new SimpleVertexShader(device, context);
+	radMapPS = new SimplePixelShader(device, context);
+
+	if (!radMapVS->LoadShaderFile(L"Debug/RadMapVS.cso") &&
+		!radMapVS->LoadShaderFile(L"RadMapVS.cso"))
+		return false;
+
+	if (!radMapPS->LoadShaderFile(L"Debug/RadMapPS.cso") &&
+		!radMapPS->LoadShaderFile(L"RadMapPS.cso"))
+		return false;
+
+	// One quad covering the target, drawn as a triangle strip.
+	// UVs start top left, which is what GetNormal() expects.
+	QuadVertex quad[4] =
+	{
+		{ { -1, +1, 0, 1 }, { 0, 0 } },
+		{ { +1, +1, 0, 1 }, { 1, 0 } },
+		{ { -1, -1, 0, 1 }, { 0, 1 } },
+		{ { +1, -1, 0, 1 }, { 1, 1 } },
+	};
+
+	D3D11_BUFFER_DESC vbd = {};
+	vbd.Usage = D3D11_USAGE_IMMUTABLE;
+	vbd.ByteWidth = sizeof(quad);
+	vbd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+
+	D3D11_SUBRESOURCE_DATA initialVertexData = {};
+	initialVertexData.pSysMem = quad;
+	if (FAILED(device->CreateBuffer(&vbd, &initialVertexData, &quadVB)))
+		return false;
+
+	// Trilinear, for filtered importance sampling
+	D3D11_SAMPLER_DESC sampleState = {};
+	sampleState.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampleState.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampleState.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampleState.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+	sampleState.MaxLOD = D3D11_FLOAT32_MAX;
+	return SUCCEEDED(device->CreateSamplerState(&sampleState, &envSampler));
+}
+
+// --------------------------------------------------------
+// Cache file name for a source and key, e.g.
+//   Assets/Textures/Ni.dds -> Assets/Textures/Ni_radiance_<key>.dds
+// --------------------------------------------------------
+std::string IBLPrecompute::GetCachePath(const char* sourcePath, uint64_t key)
+{
+	std::string path = sourcePath;
+	size_t dot = path.find_last_of('.');
+	size_t slash = path.find_last_of("/\\");
+	if (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+		path.erase(dot);
+
+	char suffix[64];
+	snprintf(suffix, sizeof(suffix), "_radiance_%016llx.dds", (unsigned long long)key);
+	return path + suffix;
+}
+
+// --------------------------------------------------------
+// Gets the radiance map for an environment - from the cache
+// if it's there, otherwise prefiltered (and then cached)
+//
+// sourcePath - The environment's cubemap DDS (hashed for the key)
+// sourceSRV  - The loaded environment, for the GPU path (may be null)
+// settings   - Size, mip count and sample count of the result
+//
+// Returns an SRV the caller must release, or null on failure
+// --------------------------------------------------------
+ID3D11ShaderResourceView* IBLPrecompute::GetRadianceMap(const char* sourcePath, ID3D11ShaderResourceView* sourceSRV, const IBLPrefilterSettings& settings)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	lastSource = SOURCE_NONE;
+
+	uint64_t sourceHash = DDSFile::HashFile(sourcePath);
+	if (sourceHash == 0)
+		return 0;
+
+	std::string cachePath = GetCachePath(sourcePath, IBLPrefilter::GetCacheKey(sourceHash, settings));
+	std::wstring wideCachePath(cachePath.begin(), cachePath.end());
+
+	// Paid for on an earlier launch?
+	ID3D11ShaderResourceView* radianceSRV = 0;
+	if (SUCCEEDED(DirectX::CreateDDSTextureFromFile(device, wideCachePath.c_str(), 0, &radianceSRV)))
+		lastSource = SOURCE_CACHE;
+
+	// Prefilter it now, on the GPU if we can
+	CubemapImage result;
+	if (!radianceSRV && sourceSRV && envSampler)
+	{
+		radianceSRV = PrefilterOnGPU(sourceSRV, settings, result);
+		if (radianceSRV)
+			lastSource = SOURCE_GPU;
+	}
+
+	if (!radianceSRV)
+	{
+		CubemapImage source;
+		if (!DDSFile::LoadCubemap(sourcePath, source))
+			return 0;
+
+		IBLPrefilter::PrefilterRadiance(source, result, settings);
+		radianceSRV = CreateTexture(result);
+		if (radianceSRV)
+			lastSource = SOURCE_CPU;
+	}
+
+	// Cache whatever we just computed
+	if (lastSource == SOURCE_GPU || lastSource == SOURCE_CPU)
+		DDSFile::SaveCubemap(cachePath.c_str(), result);
+
+	lastMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+#if defined(DEBUG) || defined(_DEBUG)
+	const char* how[] = { "failed", "cache", "GPU", "CPU" };
+	printf("\nRadiance map %s: %s, %.2fms", cachePath.c_str(), how[lastSource], lastMs);
+#endif
+
+	return radianceSRV;
+}
+
+// --------------------------------------------------------
+// Renders every mip of every face with RadMapPS, then reads
+// the result back (into result) for the cache.  Mirrors
+// IBLPrefilter::PrefilterRadiance: with Filtered the source
+// needs mips, and with Incremental a mip is drawn from an
+// earlier one (copied out and given its own mips).
+// --------------------------------------------------------
+ID3D11ShaderResourceView* IBLPrecompute::PrefilterOnGPU(ID3D11ShaderResourceView* sourceSRV, const IBLPrefilterSettings& settings, CubemapImage& result)
+{
+	IBLCubemap* target = new IBLCubemap(device, settings.MipCount, settings.Size);
+	if (!target->GetShaderResourceView())
+	{
+		delete target;
+		return 0;
+	}
+
+	BeginDrawing();
+
+	// Filtered sampling reads lower mips of the source, so give
+	// it a full chain if it came without one
+	ID3D11ShaderResourceView* sourceChain = sourceSRV;
+	IBLCubemap* generatedChain = 0;
+	int sourceSize = 0;
+	if (settings.Filtered)
+	{
+		ID3D11Resource* resource = 0;
+		sourceSRV->GetResource(&resource);
+		D3D11_TEXTURE2D_DESC sourceDesc;
+		((ID3D11Texture2D*)resource)->GetDesc(&sourceDesc);
+		resource->Release();
+		sourceSize = sourceDesc.Width;
+
+		if (sourceDesc.MipLevels == 1 && sourceSize > 1)
+		{
+			generatedChain = new IBLCubemap(device, 0, sourceSize, true);
+			for (int face = 0; face < 6; face++)
+				DrawFace(generatedChain, face, 0, sourceSRV, 0, 1, 0);
+			context->OMSetRenderTargets(0, 0, 0);
+			context->GenerateMips(generatedChain->GetShaderResourceView());
+			sourceChain = generatedChain->GetShaderResourceView();
+		}
+	}
+
+	int mipLevels = target->GetMipLevels();
+	for (int mip = 0; mip < mipLevels; mip++)
+	{
+		// Either start from the source, or add the missing blur
+		// to a mip that's already been drawn
+		float roughness = IBLPrefilter::GetMipRoughness(mip, mipLevels);
+		ID3D11ShaderResourceView* from = sourceChain;
+		int fromSize = sourceSize;
+		IBLCubemap* previous = 0;
+		int sourceMip = settings.Incremental ? IBLPrefilter::GetIncrementalSourceMip(mip, mipLevels) : -1;
+		if (sourceMip >= 0)
+		{
+			previous = CopyToChain(target, sourceMip);
+			from = previous->GetShaderResourceView();
+			fromSize = settings.Filtered ? previous->GetSize() : 0;
+			roughness = IBLPrefilter::GetResidualRoughness(roughness, IBLPrefilter::GetMipRoughness(sourceMip, mipLevels));
+		}
+
+		unsigned int sampleCount = roughness > 0 ? IBLPrefilter::GetMipSampleCount(mip, mipLevels, settings) : 1;
+		for (int face = 0; face < 6; face++)
+			DrawFace(target, face, mip, from, roughness, sampleCount, fromSize);
+
+		delete previous;
+	}
+
+	EndDrawing();
+	delete generatedChain;
+
+	ReadBack(target->GetTexture(), result);
+
+	ID3D11ShaderResourceView* radianceSRV = target->GetShaderResourceView();
+	radianceSRV->AddRef();
+	delete target;
+	return radianceSRV;
+}
+
+// --------------------------------------------------------
+// Prefilters a single face of a single mip, for building a
+// radiance map a piece at a time (EnvironmentCapture).  The
+// settings' Incremental flag is ignored - every mip is drawn
+// straight from the source.
+//
+// target     - Radiance map being built
+// source     - The environment, with mips if Filtered
+// sourceSize - Face size of the source's top mip
+// --------------------------------------------------------
+void IBLPrecompute::PrefilterFace(IBLCubemap* target, int face, int mip, ID3D11ShaderResourceView* source, int sourceSize, const IBLPrefilterSettings& settings)
+{
+	BeginDrawing();
+
+	float roughness = IBLPrefilter::GetMipRoughness(mip, target->GetMipLevels());
+	unsigned int sampleCount = roughness > 0 ? IBLPrefilter::GetMipSampleCount(mip, target->GetMipLevels(), settings) : 1;
+	DrawFace(target, face, mip, source, roughness, sampleCount, settings.Filtered ? sourceSize : 0);
+
+	EndDrawing();
+}
+
+// --------------------------------------------------------
+// Remembers the caller's targets (so they're untouched) and
+// sets up default states, the quad and the shaders
+// --------------------------------------------------------
+void IBLPrecompute::BeginDrawing()
+{
+	savedRTV = 0;
+	savedDSV = 0;
+	savedViewportCount = 1;
+	context->OMGetRenderTargets(1, &savedRTV, &savedDSV);
+	context->RSGetViewports(&savedViewportCount, &savedViewport);
+
+	UINT stride = sizeof(QuadVertex);
+	UINT offset = 0;
+	context->IASetVertexBuffers(0, 1, &quadVB, &stride, &offset);
+	context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+	context->RSSetState(0);
+	context->OMSetBlendState(0, 0, 0xFFFFFFFF);
+	context->OMSetDepthStencilState(0, 0);
+
+	radMapVS->SetShader();
+	radMapPS->SetSamplerState("EnvSampler", envSampler);
+}
+
+// --------------------------------------------------------
+// Unbinds the source and puts the caller's targets back
+// --------------------------------------------------------
+void IBLPrecompute::EndDrawing()
+{
+	radMapPS->SetShaderResourceView("cubeMap", 0);
+	context->OMSetRenderTargets(1, &savedRTV, savedDSV);
+	if (savedViewportCount > 0)
+		context->RSSetViewports(1, &savedViewport);
+	if (savedRTV) { savedRTV->Release(); }
+	if (savedDSV) { savedDSV->Release(); }
+	savedRTV = 0;
+	savedDSV = 0;
+}
+
+// --------------------------------------------------------
+// Draws one face of one mip of a cubemap with RadMapPS
+//
+// roughness   - GGX roughness to filter with (0 = a copy)
+// sourceSize  - Face size of the source's top mip, for
+//               filtered sampling (0 = top mip only)
+// --------------------------------------------------------
+void IBLPrecompute::DrawFace(IBLCubemap* cubemap, int face, int mip, ID3D11ShaderResourceView* source, float roughness, unsigned int sampleCount, int sourceSize)
+{
+	int mipSize = cubemap->GetSize() >> mip > 0 ? cubemap->GetSize() >> mip : 1;
+
+	D3D11_VIEWPORT viewport = {};
+	viewport.Width = (float)mipSize;
+	viewport.Height = (float)mipSize;
+	viewport.MaxDepth = 1.0f;
+	context->RSSetViewports(1, &viewport);
+
+	// Unbind the last source first, in case it's this target
+	radMapPS->SetShaderResourceView("cubeMap", 0);
+	context->OMSetRenderTargets(1, &cubemap->surfaces[face]->renderTargets[mip], 0);
+
+	RadMapPS_PSConstants constants = {};
+	constants.Face = (float)face;
+	constants.MipIndex = (float)mip;
+	constants.Roughness = roughness;
+	constants.SampleCount = sampleCount;
+	constants.SourceSize = (float)sourceSize;
+	radMapPS->SetBufferData("PSConstants", &constants, sizeof(constants));
+	radMapPS->SetShaderResourceView("cubeMap", source);
+	radMapPS->SetShader();
+	radMapPS->CopyAllBufferData();
+
+	context->Draw(4, 0);
+}
+
+// --------------------------------------------------------
+// Copies one mip of a cubemap into the top of a new, full
+// mip chain (box filtered by the GPU) - the GPU version of
+// what IBLPrefilter does for incremental filtering
+// --------------------------------------------------------
+IBLCubemap* IBLPrecompute::CopyToChain(IBLCubemap* cubemap, int mip)
+{
+	int mipSize = cubemap->GetSize() >> mip > 0 ? cubemap->GetSize() >> mip : 1;
+	IBLCubemap* chain = new IBLCubemap(device, 0, mipSize, true);
+
+	// The mip may still be bound as a render target
+	context->OMSetRenderTargets(0, 0, 0);
+	for (int face = 0; face < 6; face++)
+	{
+		context->CopySubresourceRegion(
+			chain->GetTexture(), D3D11CalcSubresource(0, face, chain->GetMipLevels()), 0, 0, 0,
+			cubemap->GetTexture(), D3D11CalcSubresource(mip, face, cubemap->GetMipLevels()), 0);
+	}
+
+	context->GenerateMips(chain->GetShaderResourceView());
+	return chain;
+}
+
+// --------------------------------------------------------
+// Copies a half float cubemap back to system memory
+// --------------------------------------------------------
+bool IBLPrecompute::ReadBack(ID3D11Texture2D* texture, CubemapImage& image)
+{
+	D3D11_TEXTURE2D_DESC desc;
+	texture->GetDesc(&desc);
+	desc.Usage = D3D11_USAGE_STAGING;
+	desc.BindFlags = 0;
+	desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+	ID3D11Texture2D* staging = 0;
+	if (FAILED(device->CreateTexture2D(&desc, 0, &staging)))
+		return false;
+	context->CopyResource(staging, texture);
+
+	image.Create(desc.Width, desc.MipLevels);
+	for (int face = 0; face < 6; face++)
+	{
+		for (int mip = 0; mip < (int)desc.MipLevels; mip++)
+		{
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			UINT subresource = D3D11CalcSubresource(mip, face, desc.MipLevels);
+			if (FAILED(context->Map(staging, subresource, D3D11_MAP_READ, 0, &mapped)))
+			{
+				staging->Release();
+				return false;
+			}
+
+			int mipSize = image.GetMipSize(mip);
+			float* texels = image.GetFace(face, mip);
+			for (int y = 0; y < mipSize; y++)
+			{
+				const uint16_t* row = (const uint16_t*)((const unsigned char*)mapped.pData + y * mapped.RowPitch);
+				for (int x = 0; x < mipSize * 4; x++)
+					texels[y * mipSize * 4 + x] = DDSFile::HalfToFloat(row[x]);
+			}
+
+			context->Unmap(staging, subresource);
+		}
+	}
+
+	staging->Release();
+	return true;
+}
+
+// --------------------------------------------------------
+// Uploads a CPU-prefiltered cubemap as a half float texture
+// --------------------------------------------------------
+ID3D11ShaderResourceView* IBLPrecompute::CreateTexture(const CubemapImage& image)
+{
+	int mipCount = image.GetMipCount();
+	std::vector< std::vector<uint16_t> > halves(mipCount * 6);
+	std::vector<D3D11_SUBRESOURCE_DATA> initialData(mipCount * 6);
+
+	for (int face = 0; face < 6; face++)
+	{
+		for (int mip = 0; mip < mipCount; mip++)
+		{
+			int mipSize = image.GetMipSize(mip);
+			const float* texels = image.GetFace(face, mip);
+			std::vector<uint16_t>& data = halves[face * mipCount + mip];
+			data.resize(mipSize * mipSize * 4);
+			for (size_t i = 0; i < data.size(); i++)
+				data[i] = DDSFile::FloatToHalf(texels[i]);
+
+			D3D11_SUBRESOURCE_DATA& sub = initialData[face * mipCount + mip];
+			sub.pSysMem = &data[0];
+			sub.SysMemPitch = mipSize * 4 * sizeof(uint16_t);
+			sub.SysMemSlicePitch = 0;
+		}
+	}
+
+	D3D11_TEXTURE2D_DESC texDesc = {};
+	texDesc.Width = image.GetSize();
+	texDesc.Height = image.GetSize();
+	texDesc.MipLevels = mipCount;
+	texDesc.ArraySize = 6;
+	texDesc.SampleDesc.Count = 1;
+	texDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+	texDesc.Usage = D3D11_USAGE_IMMUTABLE;
+	texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	texDesc.MiscFlags = D3D11_RESOURCE_MISC_TEXTURECUBE;
+
+	ID3D11Texture2D* texture = 0;
+	if (FAILED(device->CreateTexture2D(&texDesc, &initialData[0], &texture)))
+		return 0;
+
+	ID3D11ShaderResourceView* srv = 0;
+	device->CreateShaderResourceView(texture, 0, &srv);
+	texture->Release();
+	return srv;
+}
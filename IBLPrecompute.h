@@ -0,0 +1,81 @@
+#pragma once
+
+#include <d3d11.h>
+#include <string>
+
+#include "CubemapImage.h"
+#include "IBLCubemap.h"
+#include "IBLPrefilter.h"
+#include "SimpleShader.h"
+
+// --------------------------------------------------------
+// Builds the prefiltered radiance cubemap (the PMREM) for an
+// environment, and caches it on disk.
+//
+// The result is saved next to the source as
+//   <source>_radiance_<key>.dds
+// where the key hashes the source file's contents and the
+// prefilter settings, so a changed environment or setting
+// gets a new file and the old one is simply never matched.
+//
+// Without a cache hit the GPU renders each mip of each face
+// with RadMapPS (filtered, incremental and adaptive, as the
+// settings ask); if its shaders aren't available the CPU
+// reference (IBLPrefilter) is used instead.  Both paths read
+// the result back and write the cache file.
+//
+// Uses the immediate context, so it must run on the main thread.
+// --------------------------------------------------------
+class IBLPrecompute
+{
+public:
+	IBLPrecompute(ID3D11Device* device, ID3D11DeviceContext* context);
+	~IBLPrecompute();
+
+	// Loads RadMapVS/RadMapPS and creates the quad and sampler
+	bool LoadShaders();
+
+	// Returns (an AddRef'd) radiance map for the environment
+	//
+	// sourcePath - The environment's cubemap DDS
+	// sourceSRV  - The same environment, already loaded (may be null)
+	ID3D11ShaderResourceView* GetRadianceMap(const char* sourcePath, ID3D11ShaderResourceView* sourceSRV, const IBLPrefilterSettings& settings);
+
+	// One face of one mip of a radiance map, for spreading the
+	// work over several frames (not Incremental)
+	void PrefilterFace(IBLCubemap* target, int face, int mip, ID3D11ShaderResourceView* source, int sourceSize, const IBLPrefilterSettings& settings);
+
+	static std::string GetCachePath(const char* sourcePath, uint64_t key);
+
+	// How the last radiance map was produced (for the console)
+	enum Source { SOURCE_NONE, SOURCE_CACHE, SOURCE_GPU, SOURCE_CPU };
+	Source GetLastSource() { return lastSource; }
+	double GetLastMs() { return lastMs; }
+
+private:
+	ID3D11Device* device;
+	ID3D11DeviceContext* context;
+
+	SimpleVertexShader* radMapVS;
+	SimplePixelShader* radMapPS;
+	ID3D11Buffer* quadVB;
+	ID3D11SamplerState* envSampler;
+
+	Source lastSource;
+	double lastMs;
+
+	// Caller's targets, while drawing
+	ID3D11RenderTargetView* savedRTV;
+	ID3D11DepthStencilView* savedDSV;
+	D3D11_VIEWPORT savedViewport;
+	UINT savedViewportCount;
+
+	void BeginDrawing();
+	void EndDrawing();
+
+	ID3D11ShaderResourceView* PrefilterOnGPU(ID3D11ShaderResourceView* sourceSRV, const IBLPrefilterSettings& settings, CubemapImage& result);
+	void DrawFace(IBLCubemap* cubemap, int face, int mip, ID3D11ShaderResourceView* source, float roughness, unsigned int sampleCount, int sourceSize);
+	IBLCubemap* CopyToChain(IBLCubemap* cubemap, int mip);
+	ID3D11ShaderResourceView* CreateTexture(const CubemapImage& image);
+	bool ReadBack(ID3D11Texture2D* texture, CubemapImage& image);
+};
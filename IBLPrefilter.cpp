@@ -0,0 +1,478 @@
+#include "IBLPrefilter.h"
+#include "DDSFile.h"
+
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define IBL_PREFILTER_SSE
+#endif
+
+static const float Pi = 3.141592654f;
+
+IBLPrefilterSettings IBLPrefilterSettings::Default()
+{
+	IBLPrefilterSettings settings;
+	settings.Size = 128;
+	settings.MipCount = 0;
+	settings.SampleCount = 64;
+	settings.MaxSampleCount = 1024;
+	settings.Filtered = true;
+	settings.Adaptive = true;
+	settings.Incremental = true;
+	settings.ThreadCount = 0;
+	settings.UseSIMD = true;
+	return settings;
+}
+
+IBLPrefilterSettings IBLPrefilterSettings::BruteForce()
+{
+	IBLPrefilterSettings settings = Default();
+	settings.SampleCount = 1024;
+	settings.Filtered = false;
+	settings.Adaptive = false;
+	settings.Incremental = false;
+	return settings;
+}
+
+// Tangent space reflection vectors for one roughness, split
+// into arrays so four can be loaded at once.  Samples below
+// the horizon are dropped up front, and the tail is padded
+// with zero weight entries up to a multiple of four.
+struct SampleSet
+{
+	std::vector<float> X, Y, Z;		// L in tangent space (Z = NoL)
+	std::vector<float> Lod;			// Source mip level per sample
+	float TotalWeight;
+};
+
+// sourceSize - Face size of the source, or 0 to read its top mip only
+static void BuildSampleSet(float roughness, unsigned int sampleCount, int sourceSize, SampleSet& set)
+{
+	set.X.clear();
+	set.Y.clear();
+	set.Z.clear();
+	set.Lod.clear();
+	set.TotalWeight = 0.0000001f;
+
+	float a = roughness * roughness;
+	for (unsigned int i = 0; i < sampleCount; i++)
+	{
+		float xi[2];
+		IBLPrefilter::Hammersley(i, sampleCount, xi);
+
+		// ImportanceSampleGGX, then L = 2 * dot(V, H) * H - V with V = N
+		float phi = 2 * Pi * xi[0];
+		float cosTheta = sqrtf((1 - xi[1]) / (1 + (a * a - 1) * xi[1]));
+		float sinTheta = sqrtf(1 - cosTheta * cosTheta);
+
+		float noL = 2 * cosTheta * cosTheta - 1;
+		if (noL <= 0)
+			continue;
+
+		set.X.push_back(2 * cosTheta * sinTheta * cosf(phi));
+		set.Y.push_back(2 * cosTheta * sinTheta * sinf(phi));
+		set.Z.push_back(noL);
+		set.Lod.push_back(sourceSize > 0 ? IBLPrefilter::GetSampleLod(roughness, cosTheta, sampleCount, sourceSize) : 0.0f);
+		set.TotalWeight += noL;
+	}
+
+	while (set.X.size() % 4 != 0)
+	{
+		set.X.push_back(0);
+		set.Y.push_back(0);
+		set.Z.push_back(0);
+		set.Lod.push_back(0);
+	}
+}
+
+// Tangent frame around N, as built in ImportanceSampleGGX
+static void GetTangentFrame(const float n[3], float tangentX[3], float tangentY[3])
+{
+	float up[3] = { 0, 0, 1 };
+	if (fabsf(n[2]) >= 0.999f)
+	{
+		up[0] = 1;
+		up[2] = 0;
+	}
+
+	tangentX[0] = up[1] * n[2] - up[2] * n[1];
+	tangentX[1] = up[2] * n[0] - up[0] * n[2];
+	tangentX[2] = up[0] * n[1] - up[1] * n[0];
+	float length = sqrtf(tangentX[0] * tangentX[0] + tangentX[1] * tangentX[1] + tangentX[2] * tangentX[2]);
+	for (int c = 0; c < 3; c++)
+		tangentX[c] /= length;
+
+	tangentY[0] = n[1] * tangentX[2] - n[2] * tangentX[1];
+	tangentY[1] = n[2] * tangentX[0] - n[0] * tangentX[2];
+	tangentY[2] = n[0] * tangentX[1] - n[1] * tangentX[0];
+}
+
+// Weighted sum of the environment over one texel's samples
+static void FilterTexel(const CubemapImage& source, const SampleSet& set, const float n[3], bool useSIMD, float rgb[3])
+{
+	float tx[3], ty[3];
+	GetTangentFrame(n, tx, ty);
+
+	float sum[3] = { 0, 0, 0 };
+	unsigned int count = (unsigned int)set.X.size();
+
+	for (unsigned int s = 0; s < count; s += 4)
+	{
+		// Rotate four samples into world space
+		float lx[4], ly[4], lz[4];
+#ifdef IBL_PREFILTER_SSE
+		if (useSIMD)
+		{
+			__m128 x = _mm_loadu_ps(&set.X[s]);
+			__m128 y = _mm_loadu_ps(&set.Y[s]);
+			__m128 z = _mm_loadu_ps(&set.Z[s]);
+			_mm_storeu_ps(lx, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(tx[0]), x), _mm_mul_ps(_mm_set1_ps(ty[0]), y)), _mm_mul_ps(_mm_set1_ps(n[0]), z)));
+			_mm_storeu_ps(ly, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(tx[1]), x), _mm_mul_ps(_mm_set1_ps(ty[1]), y)), _mm_mul_ps(_mm_set1_ps(n[1]), z)));
+			_mm_storeu_ps(lz, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(tx[2]), x), _mm_mul_ps(_mm_set1_ps(ty[2]), y)), _mm_mul_ps(_mm_set1_ps(n[2]), z)));
+		}
+		else
+#endif
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				lx[i] = tx[0] * set.X[s + i] + ty[0] * set.Y[s + i] + n[0] * set.Z[s + i];
+				ly[i] = tx[1] * set.X[s + i] + ty[1] * set.Y[s + i] + n[1] * set.Z[s + i];
+				lz[i] = tx[2] * set.X[s + i] + ty[2] * set.Y[s + i] + n[2] * set.Z[s + i];
+			}
+		}
+
+		// Fetch and weight them (padding has zero weight)
+		for (int i = 0; i < 4; i++)
+		{
+			float weight = set.Z[s + i];
+			if (weight <= 0)
+				continue;
+
+			float l[3] = { lx[i], ly[i], lz[i] };
+			float texel[4];
+			source.SampleLevel(l, set.Lod[s + i], texel);
+			sum[0] += texel[0] * weight;
+			sum[1] += texel[1] * weight;
+			sum[2] += texel[2] * weight;
+		}
+	}
+
+	for (int c = 0; c < 3; c++)
+		rgb[c] = sum[c] / set.TotalWeight;
+}
+
+// Copies one mip of an image into the top of a new full chain
+static void CopyToChain(const CubemapImage& image, int mip, CubemapImage& chain)
+{
+	int size = image.GetMipSize(mip);
+	chain.Create(size, 0);
+	for (int face = 0; face < 6; face++)
+		memcpy(chain.GetFace(face, 0), image.GetFace(face, mip), size * size * 4 * sizeof(float));
+	chain.GenerateMips();
+}
+
+float IBLPrefilter::GetMipRoughness(int mip, int mipCount)
+{
+	return mipCount > 1 ? (float)mip / (mipCount - 1) : 0.0f;
+}
+
+float IBLPrefilter::GetResidualRoughness(float roughness, float previousRoughness)
+{
+	// Alpha (GGX width) is roughness squared
+	float alpha = roughness * roughness;
+	float previousAlpha = previousRoughness * previousRoughness;
+	float residual = alpha * alpha - previousAlpha * previousAlpha;
+	return residual > 0 ? sqrtf(sqrtf(residual)) : 0.0f;
+}
+
+// --------------------------------------------------------
+// Which filtered mip a mip can be built from, or -1 to use
+// the source.  GGX lobes don't convolve into exactly another
+// GGX lobe, so the residual has to dominate: the mip used must
+// be at most 1/8 as wide (in alpha).  Mip 0 is just a copy of
+// the source at lower resolution, so it's never used.
+// --------------------------------------------------------
+int IBLPrefilter::GetIncrementalSourceMip(int mip, int mipCount)
+{
+	float roughness = GetMipRoughness(mip, mipCount);
+	float alpha = roughness * roughness;
+	for (int previous = mip - 1; previous >= 1; previous--)
+	{
+		float previousRoughness = GetMipRoughness(previous, mipCount);
+		if (previousRoughness * previousRoughness * 8 <= alpha)
+			return previous;
+	}
+	return -1;
+}
+
+// --------------------------------------------------------
+// Samples per texel for a mip.  With filtered sampling a mip's
+// error falls as 1 / sqrt(samples) at much the same rate
+// whatever its roughness, while its cost is texels * samples.
+// Minimizing the total error for a given cost then gives
+// samples proportional to 1 / size: the small, rough mips get
+// more samples and the large, glossy ones (where nearly all
+// the work is) get fewer.  Counts double per mip from
+// SampleCount at mip 1, up to MaxSampleCount - powers of two,
+// so the Hammersley set stays balanced.
+// --------------------------------------------------------
+unsigned int IBLPrefilter::GetMipSampleCount(int mip, int mipCount, const IBLPrefilterSettings& settings)
+{
+	if (!settings.Adaptive)
+		return settings.SampleCount;
+
+	if (GetMipRoughness(mip, mipCount) <= 0)
+		return 1;
+
+	unsigned int count = settings.SampleCount;
+	for (int m = 1; m < mip && count < settings.MaxSampleCount; m++)
+		count *= 2;
+	return count < settings.MaxSampleCount ? count : settings.MaxSampleCount;
+}
+
+float IBLPrefilter::GetSampleLod(float roughness, float noH, unsigned int sampleCount, int sourceSize)
+{
+	// GGX D, and the PDF of the reflected direction (V = N, so the
+	// NoH / (4 VoH) Jacobian is just 1 / 4)
+	float alpha = roughness * roughness;
+	float alpha2 = alpha * alpha;
+	float denominator = noH * noH * (alpha2 - 1) + 1;
+	float d = alpha2 / (Pi * denominator * denominator);
+	float pdf = d / 4;
+
+	// Solid angle of this sample vs. one texel of the source
+	float sampleSolidAngle = 1.0f / (sampleCount * pdf + 0.0001f);
+	float texelSolidAngle = 4 * Pi / (6.0f * sourceSize * sourceSize);
+
+	// (The +1 bias often used here measured worse - see WriteErrorReport)
+	float lod = 0.5f * log2f(sampleSolidAngle / texelSolidAngle);
+	return lod > 0 ? lod : 0.0f;
+}
+
+void IBLPrefilter::Hammersley(unsigned int i, unsigned int count, float xi[2])
+{
+	// reversebits()
+	unsigned int bits = i;
+	bits = (bits << 16) | (bits >> 16);
+	bits = ((bits & 0x55555555u) << 1) | ((bits & 0xAAAAAAAAu) >> 1);
+	bits = ((bits & 0x33333333u) << 2) | ((bits & 0xCCCCCCCCu) >> 2);
+	bits = ((bits & 0x0F0F0F0Fu) << 4) | ((bits & 0xF0F0F0F0u) >> 4);
+	bits = ((bits & 0x00FF00FFu) << 8) | ((bits & 0xFF00FF00u) >> 8);
+
+	xi[0] = (float)i / (float)count;
+	xi[1] = bits * 2.3283064365386963e-10f;
+}
+
+// --------------------------------------------------------
+// Prefilters the source environment into every mip of the
+// result, mip N holding roughness N / (mips - 1)
+//
+// source   - The environment (mips are generated if it has none)
+// result   - Receives the prefiltered cubemap
+// settings - Size, mips, sampling and threading
+// --------------------------------------------------------
+void IBLPrefilter::PrefilterRadiance(const CubemapImage& source, CubemapImage& result, const IBLPrefilterSettings& settings)
+{
+	result.Create(settings.Size, settings.MipCount);
+	int mipCount = result.GetMipCount();
+
+	unsigned int threadCount = settings.ThreadCount;
+	if (threadCount == 0)
+		threadCount = std::thread::hardware_concurrency();
+	if (threadCount == 0)
+		threadCount = 1;
+
+	// Filtered sampling reads lower mips of the source
+	const CubemapImage* sourceChain = &source;
+	CubemapImage generatedChain;
+	if (settings.Filtered && source.GetMipCount() == 1 && source.GetSize() > 1)
+	{
+		CopyToChain(source, 0, generatedChain);
+		sourceChain = &generatedChain;
+	}
+
+	for (int mip = 0; mip < mipCount; mip++)
+	{
+		float roughness = GetMipRoughness(mip, mipCount);
+		int mipSize = result.GetMipSize(mip);
+
+		// Either start from the source, or add the missing blur
+		// to a mip that's already been filtered
+		const CubemapImage* from = sourceChain;
+		float filterRoughness = roughness;
+		CubemapImage previous;
+		int sourceMip = settings.Incremental ? GetIncrementalSourceMip(mip, mipCount) : -1;
+		if (sourceMip >= 0)
+		{
+			CopyToChain(result, sourceMip, previous);
+			from = &previous;
+			filterRoughness = GetResidualRoughness(roughness, GetMipRoughness(sourceMip, mipCount));
+		}
+
+		// A perfect mirror is just the environment itself
+		SampleSet set;
+		if (filterRoughness > 0)
+			BuildSampleSet(filterRoughness, GetMipSampleCount(mip, mipCount, settings), settings.Filtered ? from->GetSize() : 0, set);
+
+		// Rows of all six faces, handed out one at a time
+		std::atomic<int> nextRow(0);
+		int rowCount = mipSize * 6;
+
+		auto work = [&]()
+		{
+			for (int row = nextRow++; row < rowCount; row = nextRow++)
+			{
+				int face = row / mipSize;
+				int y = row % mipSize;
+				float* texels = result.GetFace(face, mip) + y * mipSize * 4;
+
+				for (int x = 0; x < mipSize; x++)
+				{
+					float n[3];
+					CubemapImage::GetTexelDirection(face, x, y, mipSize, n);
+
+					float* texel = texels + x * 4;
+					if (filterRoughness > 0)
+						FilterTexel(*from, set, n, settings.UseSIMD, texel);
+					else
+						from->Sample(n, 0, texel);
+					texel[3] = 1;
+				}
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned int t = 1; t < threadCount && t < (unsigned int)rowCount; t++)
+			threads.push_back(std::thread(work));
+		work();
+		for (unsigned int t = 0; t < threads.size(); t++)
+			threads[t].join();
+	}
+}
+
+uint64_t IBLPrefilter::GetCacheKey(uint64_t sourceHash, const IBLPrefilterSettings& settings)
+{
+	// Thread count and SIMD don't change the output
+	uint32_t fields[8] =
+	{
+		IBL_PREFILTER_VERSION,
+		(uint32_t)settings.Size,
+		(uint32_t)settings.MipCount,
+		settings.SampleCount,
+		settings.Adaptive ? settings.MaxSampleCount : 0,
+		settings.Filtered ? 1u : 0u,
+		settings.Adaptive ? 1u : 0u,
+		settings.Incremental ? 1u : 0u
+	};
+
+	uint64_t key = DDSFile::Hash(&sourceHash, sizeof(sourceHash));
+	return DDSFile::Hash(fields, sizeof(fields), key);
+}
+
+// Error of one mip relative to the reference's mean brightness
+static void MeasureError(const CubemapImage& image, const CubemapImage& reference, int mip, double& rmsError, double& maxError)
+{
+	int mipSize = image.GetMipSize(mip);
+	double sumSq = 0, sumReference = 0;
+	maxError = 0;
+	for (int face = 0; face < 6; face++)
+	{
+		const float* a = image.GetFace(face, mip);
+		const float* b = reference.GetFace(face, mip);
+		for (int i = 0; i < mipSize * mipSize; i++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				double error = fabs((double)a[i * 4 + c] - b[i * 4 + c]);
+				sumSq += error * error;
+				sumReference += b[i * 4 + c];
+				if (error > maxError)
+					maxError = error;
+			}
+		}
+	}
+
+	double count = 6.0 * mipSize * mipSize * 3;
+	double mean = sumReference / count;
+	rmsError = sqrt(sumSq / count) / (mean > 0 ? mean : 1);
+	maxError /= (mean > 0 ? mean : 1);
+}
+
+// --------------------------------------------------------
+// Writes a CSV of error vs. samples per texel, for brute
+// force, filtered, filtered + incremental and adaptive
+// (samples = those at mip 1) prefiltering.  Errors are
+// relative to the reference's mean (so 0.01 is 1%).  Rows:
+//   method,samples,mip,roughness,rms_error,max_error,texel_samples,ms
+// with mip "all" summarizing each run.
+// --------------------------------------------------------
+bool IBLPrefilter::WriteErrorReport(const char* path, const CubemapImage& source, int size, unsigned int referenceSamples)
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "w");
+#else
+	file = fopen(path, "w");
+#endif
+	if (!file)
+		return false;
+
+	IBLPrefilterSettings referenceSettings = IBLPrefilterSettings::BruteForce();
+	referenceSettings.Size = size;
+	referenceSettings.SampleCount = referenceSamples;
+
+	CubemapImage reference;
+	PrefilterRadiance(source, reference, referenceSettings);
+	int mipCount = reference.GetMipCount();
+
+	fprintf(file, "method,samples,mip,roughness,rms_error,max_error,texel_samples,ms\n");
+
+	const char* methods[] = { "brute_force", "filtered", "filtered_incremental", "adaptive" };
+	for (int method = 0; method < 4; method++)
+	{
+		for (unsigned int samples = 8; samples <= 1024; samples *= 2)
+		{
+			IBLPrefilterSettings settings = method == 0 ? IBLPrefilterSettings::BruteForce() : IBLPrefilterSettings::Default();
+			settings.Size = size;
+			settings.SampleCount = samples;
+			settings.Incremental = method >= 2;
+			settings.Adaptive = method == 3;
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			CubemapImage result;
+			PrefilterRadiance(source, result, settings);
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			double totalSq = 0, totalMax = 0, totalSamples = 0;
+			for (int mip = 0; mip < mipCount; mip++)
+			{
+				double rmsError, maxError;
+				MeasureError(result, reference, mip, rmsError, maxError);
+				int mipSize = result.GetMipSize(mip);
+				double texelSamples = 6.0 * mipSize * mipSize * (mip > 0 ? GetMipSampleCount(mip, mipCount, settings) : 1);
+
+				fprintf(file, "%s,%u,%d,%.3f,%.6f,%.6f,%.0f,\n",
+					methods[method], samples, mip, GetMipRoughness(mip, mipCount),
+					rmsError, maxError, texelSamples);
+
+				totalSq += rmsError * rmsError;
+				totalMax = maxError > totalMax ? maxError : totalMax;
+				totalSamples += texelSamples;
+			}
+
+			fprintf(file, "%s,%u,all,,%.6f,%.6f,%.0f,%.2f\n",
+				methods[method], samples,
+				sqrt(totalSq / mipCount), totalMax, totalSamples, ms);
+		}
+	}
+
+	fclose(file);
+	return true;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "CubemapImage.h"
+
+// Bump when the prefilter math changes, so old cache files are ignored
+#define IBL_PREFILTER_VERSION	2
+
+// --------------------------------------------------------
+// Parameters of a radiance prefilter - everything that
+// changes the result, so it all goes into the cache key
+// --------------------------------------------------------
+struct IBLPrefilterSettings
+{
+	int Size;					// Top mip's face size
+	int MipCount;				// 0 = full chain; roughness runs 0..1 over the mips
+	unsigned int SampleCount;	// GGX samples per texel (at mip 1 when Adaptive)
+	unsigned int MaxSampleCount;// Most samples a mip may use when Adaptive
+	bool Filtered;				// Filtered importance sampling (source mip from the PDF)
+	bool Adaptive;				// Sample count per mip from roughness and resolution
+	bool Incremental;			// Filter each mip from the one above it
+	unsigned int ThreadCount;	// 0 = one per hardware thread
+	bool UseSIMD;				// Lets the scalar path be checked against the SSE one
+
+	// Filtered, incremental and adaptive
+	static IBLPrefilterSettings Default();
+
+	// The original brute force filter: every mip from the full
+	// resolution source with the same number of samples
+	static IBLPrefilterSettings BruteForce();
+};
+
+// --------------------------------------------------------
+// CPU reference for the split-sum radiance prefilter in
+// RadMapPS.hlsl: the same Hammersley points, the same GGX
+// importance sampling and the same NoL weighting, so the GPU
+// output can be checked against it (and so a cache can be
+// built on a machine without a GPU).
+//
+// The per-mip GGX samples only depend on roughness, so they
+// are worked out once in tangent space; each texel then just
+// rotates them into place, four at a time with SSE.  Rows of
+// texels are shared out between threads.
+//
+// Filtered importance sampling (Krivanek & Colbert, GPU Gems
+// 3 ch. 20) reads each sample from the source mip whose texels
+// cover about the same solid angle as the sample does, so a
+// few dozen samples do the work of a thousand without
+// aliasing, and the samples can be spent where they buy the
+// most (GetMipSampleCount).
+//
+// Incremental filtering starts a mip from an earlier, already
+// blurred one (plus box-filtered mips of it) with the roughness
+// that's left to add, so low mips never touch the full
+// resolution source.
+// --------------------------------------------------------
+class IBLPrefilter
+{
+public:
+	static void PrefilterRadiance(const CubemapImage& source, CubemapImage& result, const IBLPrefilterSettings& settings);
+
+	// Roughness a given mip is filtered for (matches RadMapPS)
+	static float GetMipRoughness(int mip, int mipCount);
+
+	// Roughness that still has to be applied to go from one
+	// GGX blur to a wider one (widths add in alpha squared)
+	static float GetResidualRoughness(float roughness, float previousRoughness);
+
+	// Filtered mip to build a mip from when Incremental (-1 = source)
+	static int GetIncrementalSourceMip(int mip, int mipCount);
+
+	// Samples per texel a mip gets (SampleCount unless Adaptive)
+	static unsigned int GetMipSampleCount(int mip, int mipCount, const IBLPrefilterSettings& settings);
+
+	// Source mip level for one sample: log2 of how many source
+	// texels fit in the solid angle the sample stands for
+	//
+	// noH        - Sample's half vector . N (= VoH, as V = N)
+	// sourceSize - Face size of the mip 0 of the source
+	static float GetSampleLod(float roughness, float noH, unsigned int sampleCount, int sourceSize);
+
+	// Identifies a prefiltered result: the source file's contents
+	// plus every setting that affects the output
+	static uint64_t GetCacheKey(uint64_t sourceHash, const IBLPrefilterSettings& settings);
+
+	// The shader's low discrepancy points (CommonVars.hlsli)
+	static void Hammersley(unsigned int i, unsigned int count, float xi[2]);
+
+	// Error against a high sample count brute force reference for
+	// a range of sample counts, brute force vs. filtered, written
+	// as CSV (see IBLPrefilterReport.cpp)
+	static bool WriteErrorReport(const char* path, const CubemapImage& source, int size, unsigned int referenceSamples);
+};
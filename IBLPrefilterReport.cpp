@@ -0,0 +1,73 @@
+// --------------------------------------------------------
+// Offline tool: measures radiance prefilter error against a
+// brute force reference (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread IBLPrefilterReport.cpp IBLPrefilter.cpp DDSFile.cpp CubemapImage.cpp -o IBLPrefilterReport
+//   ./IBLPrefilterReport Debug/Assets/Textures/Ni.dds 64 8192 prefilter_report.csv
+//
+// Arguments: environment DDS, result size (default 64),
+// reference samples per texel (default 8192) and the CSV to
+// write (default prefilter_report.csv).  The CSV has error and
+// cost per mip for brute force, filtered, filtered +
+// incremental and adaptive prefiltering at 8..1024 samples
+// (see IBLPrefilter::WriteErrorReport); the per-run totals are
+// echoed to the console.
+// --------------------------------------------------------
+
+#include "IBLPrefilter.h"
+#include "DDSFile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		printf("Usage: IBLPrefilterReport <environment.dds> [size] [referenceSamples] [report.csv]\n");
+		return 1;
+	}
+
+	int size = argc > 2 ? atoi(argv[2]) : 64;
+	unsigned int referenceSamples = argc > 3 ? (unsigned int)atoi(argv[3]) : 8192;
+	const char* reportPath = argc > 4 ? argv[4] : "prefilter_report.csv";
+
+	CubemapImage source;
+	if (!DDSFile::LoadCubemap(argv[1], source))
+	{
+		printf("Can't load %s\n", argv[1]);
+		return 1;
+	}
+
+	printf("%s: %dx%d, %d mips -> %dx%d, reference %u samples\n",
+		argv[1], source.GetSize(), source.GetSize(), source.GetMipCount(), size, size, referenceSamples);
+
+	if (!IBLPrefilter::WriteErrorReport(reportPath, source, size, referenceSamples))
+	{
+		printf("Can't write %s\n", reportPath);
+		return 1;
+	}
+
+	// Echo the summary rows
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, reportPath, "r");
+#else
+	file = fopen(reportPath, "r");
+#endif
+	if (!file)
+		return 1;
+
+	char line[256];
+	while (fgets(line, sizeof(line), file))
+	{
+		if (strstr(line, ",all,") || strncmp(line, "method", 6) == 0)
+			printf("%s", line);
+	}
+	fclose(file);
+
+	printf("Wrote %s\n", reportPath);
+	return 0;
+}
@@ -0,0 +1,401 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+
+#include <stdio.h>
+
+// Which system's thread this is, and which of its threads
+static thread_local const JobSystem* currentSystem = 0;
+static thread_local int currentThread = -1;
+
+bool JobSystem::Deque::Push(Job* job)
+{
+	long long b = bottom.load(std::memory_order_relaxed);
+	long long t = top.load(std::memory_order_acquire);
+	if (b - t >= JobCapacity)
+		return false;
+
+	jobs[b & (JobCapacity - 1)].store(job, std::memory_order_relaxed);
+	bottom.store(b + 1, std::memory_order_release);
+	return true;
+}
+
+Job* JobSystem::Deque::Pop()
+{
+	long long b = bottom.load(std::memory_order_relaxed) - 1;
+	bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	long long t = top.load(std::memory_order_relaxed);
+
+	if (t > b)
+	{
+		// Empty
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return 0;
+	}
+
+	Job* job = jobs[b & (JobCapacity - 1)].load(std::memory_order_relaxed);
+	if (t == b)
+	{
+		// The last one - a thief may be after it too
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			job = 0;
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+	return job;
+}
+
+Job* JobSystem::Deque::Steal()
+{
+	long long t = top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	long long b = bottom.load(std::memory_order_acquire);
+	if (t >= b)
+		return 0;
+
+	Job* job = jobs[t & (JobCapacity - 1)].load(std::memory_order_relaxed);
+	if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return 0;	// Lost it to the owner or another thief
+	return job;
+}
+
+JobSystem::JobSystem(int workerCount)
+{
+	if (workerCount < 0)
+	{
+		int cores = (int)std::thread::hardware_concurrency();
+		workerCount = cores > 1 ? cores - 1 : 0;
+	}
+
+	running = true;
+	queued = 0;
+	sleeping = 0;
+	for (int t = 0; t <= workerCount; t++)
+	{
+		ThreadState* state = new ThreadState();
+		for (int j = 0; j < JobCapacity; j++)
+			state->Pool[j].InUse = false;
+		state->NextJob = 0;
+		state->JobCount = 0;
+		state->StealCount = 0;
+		threads.push_back(state);
+	}
+
+	// This thread is 0; the workers only start once every
+	// thread's state exists, as they steal from all of them
+	currentSystem = this;
+	currentThread = 0;
+	for (int t = 1; t <= workerCount; t++)
+		threads[t]->Thread = std::thread(&JobSystem::WorkerLoop, this, t);
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(sleepLock);
+		running = false;
+	}
+	wake.notify_all();
+
+	// Every worker's out before any state goes, as they steal
+	// from each other
+	for (size_t t = 0; t < threads.size(); t++)
+	{
+		if (threads[t]->Thread.joinable())
+			threads[t]->Thread.join();
+	}
+	for (size_t t = 0; t < threads.size(); t++)
+		delete threads[t];
+
+	if (currentSystem == this)
+	{
+		currentSystem = 0;
+		currentThread = -1;
+	}
+}
+
+void JobSystem::WorkerLoop(int thread)
+{
+	currentSystem = this;
+	currentThread = thread;
+
+	char name[32];
+	snprintf(name, sizeof(name), "Job worker %d", thread);
+	Profiler::SetThreadName(name);
+
+	int idle = 0;
+	while (running.load(std::memory_order_relaxed))
+	{
+		Job* job = Take(thread);
+		if (job)
+		{
+			Execute(thread, job);
+			idle = 0;
+			continue;
+		}
+
+		// A frame's jobs come in bursts, so look again for a
+		// while before paying to be woken up
+		if (++idle < IdleSpins)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		idle = 0;
+
+		// Nothing anywhere - sleep until something's pushed.  A
+		// push bumps queued before it looks for sleepers, and
+		// this looks at queued after counting itself as one, so
+		// one of the two sees the other.
+		std::unique_lock<std::mutex> lock(sleepLock);
+		sleeping++;
+		wake.wait(lock, [this]() { return queued.load() > 0 || !running.load(); });
+		sleeping--;
+	}
+}
+
+int JobSystem::GetThreadIndex()
+{
+	return currentSystem == this ? currentThread : -1;
+}
+
+// --------------------------------------------------------
+// Jobs come round-robin from the thread's own ring, so a
+// slot isn't reused until JobCapacity more have been made
+// there.  That's usually long after it ran, but not always
+// (jobs parked on a counter, a burst bigger than the ring),
+// so a slot whose job hasn't run yet isn't handed out - the
+// caller runs the work inline instead, the way a full deque
+// does.
+// --------------------------------------------------------
+Job* JobSystem::Allocate(int thread)
+{
+	ThreadState* state = threads[thread];
+	Job* job = &state->Pool[state->NextJob & (JobCapacity - 1)];
+	state->NextJob++;
+	if (job->InUse.load(std::memory_order_acquire))
+		return 0;
+
+	job->InUse.store(true, std::memory_order_relaxed);
+	job->Range = 0;
+	job->Begin = job->End = job->Grain = 0;
+	job->Counter = 0;
+	return job;
+}
+
+void JobSystem::Push(int thread, Job* job)
+{
+	// A full deque just runs it here
+	if (!threads[thread]->Jobs.Push(job))
+	{
+		Execute(thread, job);
+		return;
+	}
+
+	queued++;
+	if (sleeping.load() > 0)
+	{
+		std::lock_guard<std::mutex> lock(sleepLock);
+		wake.notify_one();
+	}
+}
+
+Job* JobSystem::Take(int thread)
+{
+	Job* job = threads[thread]->Jobs.Pop();
+	if (!job)
+	{
+		// Try everyone else, starting with the next thread
+		int count = (int)threads.size();
+		for (int offset = 1; offset < count && !job; offset++)
+			job = threads[(thread + offset) % count]->Jobs.Steal();
+		if (job)
+			threads[thread]->StealCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (job)
+		queued--;
+	return job;
+}
+
+// --------------------------------------------------------
+// Runs a job.  A ParallelFor piece bigger than its grain
+// pushes its upper half as a new job (for someone to steal)
+// and carries on with the lower half, until it's small
+// enough to just run.
+// --------------------------------------------------------
+void JobSystem::Execute(int thread, Job* job)
+{
+	threads[thread]->JobCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (job->Range)
+	{
+		int begin = job->Begin;
+		int end = job->End;
+		while (end - begin > job->Grain)
+		{
+			// No slot for the upper half: this piece runs it all
+			Job* half = Allocate(thread);
+			if (!half)
+				break;
+
+			int middle = begin + (end - begin) / 2;
+			half->Range = job->Range;
+			half->Begin = middle;
+			half->End = end;
+			half->Grain = job->Grain;
+			half->Counter = job->Counter;
+			job->Counter->count.fetch_add(1, std::memory_order_relaxed);
+			Push(thread, half);
+			end = middle;
+		}
+		(*job->Range)(begin, end);
+	}
+	else
+	{
+		job->Work();
+		job->Work = nullptr;
+	}
+
+	// The slot can be reused from here on
+	JobCounter* counter = job->Counter;
+	job->InUse.store(false, std::memory_order_release);
+	Finish(thread, counter);
+}
+
+// --------------------------------------------------------
+// Counts a job off.  The last one starts whatever was
+// waiting for the counter - it counts down under the lock
+// Run parks jobs under, so none can be parked after it
+// looked.  Wait takes the lock too before returning, so the
+// counter can't go while this still holds it.
+// --------------------------------------------------------
+void JobSystem::Finish(int thread, JobCounter* counter)
+{
+	if (!counter)
+		return;
+
+	int count = counter->count.load(std::memory_order_relaxed);
+	while (count > 1)
+	{
+		if (counter->count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+			return;
+	}
+
+	std::vector<Job*> ready;
+	{
+		std::lock_guard<std::mutex> lock(counter->lock);
+		if (counter->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			ready.swap(counter->waiting);
+	}
+	for (size_t j = 0; j < ready.size(); j++)
+		Push(thread, ready[j]);
+}
+
+void JobSystem::Run(const std::function<void()>& work, JobCounter* counter, JobCounter* dependsOn)
+{
+	int thread = GetThreadIndex();
+	if (thread < 0)
+	{
+		// Not one of ours: there's no deque to put it on
+		while (dependsOn && !dependsOn->IsDone())
+			std::this_thread::yield();
+		work();
+		return;
+	}
+
+	Job* job = Allocate(thread);
+	if (!job)
+	{
+		// Too many unfinished; this one runs here, once it can
+		if (dependsOn)
+			Wait(dependsOn);
+		work();
+		return;
+	}
+
+	job->Work = work;
+	job->Counter = counter;
+	if (counter)
+		counter->count.fetch_add(1, std::memory_order_relaxed);
+
+	if (dependsOn)
+	{
+		// Checked under the lock, so it can't finish in between
+		// (Finish takes the waiting list under the same lock)
+		std::lock_guard<std::mutex> lock(dependsOn->lock);
+		if (!dependsOn->IsDone())
+		{
+			dependsOn->waiting.push_back(job);
+			return;
+		}
+	}
+	Push(thread, job);
+}
+
+void JobSystem::Wait(JobCounter* counter)
+{
+	int thread = GetThreadIndex();
+	while (!counter->IsDone())
+	{
+		Job* job = thread >= 0 ? Take(thread) : 0;
+		if (job)
+			Execute(thread, job);
+		else
+			std::this_thread::yield();
+	}
+
+	// The last Finish may still be letting go of the lock
+	std::lock_guard<std::mutex> lock(counter->lock);
+}
+
+int JobSystem::GetGrainSize(int count, int threadCount)
+{
+	int grain = count / (threadCount * 8);
+	return grain > 1 ? grain : 1;
+}
+
+void JobSystem::ParallelFor(int count, const std::function<void(int begin, int end)>& work, int grainSize)
+{
+	if (count <= 0)
+		return;
+
+	int thread = GetThreadIndex();
+	int grain = grainSize > 0 ? grainSize : GetGrainSize(count, GetThreadCount());
+	if (thread < 0 || threads.size() == 1 || count <= grain)
+	{
+		work(0, count);
+		return;
+	}
+
+	// The whole range is one job, run here; it splits itself
+	Job* job = Allocate(thread);
+	if (!job)
+	{
+		work(0, count);
+		return;
+	}
+
+	JobCounter counter;
+	counter.count = 1;
+	job->Range = &work;
+	job->Begin = 0;
+	job->End = count;
+	job->Grain = grain;
+	job->Counter = &counter;
+	Execute(thread, job);
+	Wait(&counter);
+}
+
+JobSystem::ParallelForFunction JobSystem::GetParallelFor()
+{
+	return [this](int count, const std::function<void(int begin, int end)>& work) { ParallelFor(count, work); };
+}
+
+void JobSystem::ResetStats()
+{
+	for (size_t t = 0; t < threads.size(); t++)
+	{
+		threads[t]->JobCount = 0;
+		threads[t]->StealCount = 0;
+	}
+}
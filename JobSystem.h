@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobCounter;
+
+// A piece of work on a JobSystem deque: a function, or a piece
+// of a ParallelFor's range
+struct Job
+{
+	std::function<void()> Work;
+	const std::function<void(int begin, int end)>* Range;
+	int Begin;
+	int End;
+	int Grain;
+	JobCounter* Counter;
+	std::atomic<bool> InUse;	// From Allocate until it's run
+};
+
+// --------------------------------------------------------
+// How many of a batch of jobs are still to finish.  Jobs can
+// be made to wait for a counter to reach zero before they
+// start (see JobSystem::Run).  A counter must outlive the
+// jobs that count on it, and those waiting for it.
+// --------------------------------------------------------
+class JobCounter
+{
+public:
+	JobCounter() : count(0) {}
+
+	bool IsDone() const { return count.load(std::memory_order_acquire) == 0; }
+	int GetCount() const { return count.load(std::memory_order_acquire); }
+
+private:
+	friend class JobSystem;
+	std::atomic<int> count;
+	std::mutex lock;				// Guards waiting
+	std::vector<Job*> waiting;		// Started when count reaches zero
+};
+
+// --------------------------------------------------------
+// A work-stealing job system for the frame's fine grained
+// work (moving entities, culling, building draw lists, light
+// assignment, recording, rasterizing tiles).
+//
+// Each thread - the one that made it, and its workers - has
+// a Chase-Lev deque: it pushes and pops its own jobs at the
+// bottom, newest first, and idle threads steal the oldest
+// from the top of someone else's.  ParallelFor splits its
+// range in half recursively, pushing one half each time, so
+// the big pieces are what get stolen and the owner keeps
+// working through the small ones it pushed last.
+//
+// A thread that waits (Wait, ParallelFor) runs jobs while it
+// does, so the main thread is never idle and jobs can wait
+// on jobs.  Workers with nothing to do sleep.
+//
+// Only the thread that made the system and its workers can
+// add jobs; on any other thread, work runs inline.  Each
+// thread can have up to JobCapacity jobs unfinished; past
+// that, new ones run inline too.
+// --------------------------------------------------------
+class JobSystem
+{
+public:
+	// Runs work(begin, end) over [0, count), in pieces - the
+	// ParallelFor hook LightClusterGrid, CommandRecorder and
+	// SoftwareRenderDevice take
+	typedef std::function<void(int count, const std::function<void(int begin, int end)>& work)> ParallelForFunction;
+
+	static const int JobCapacity = 4096;	// Per thread (a power of two)
+
+	// workerCount < 0: one per core, less the calling thread
+	JobSystem(int workerCount = -1);
+	~JobSystem();
+
+	int GetWorkerCount() { return (int)threads.size() - 1; }
+	int GetThreadCount() { return (int)threads.size(); }	// Workers and the main thread
+
+	// Runs work on some thread, counted on counter (if any).
+	// With dependsOn, it only starts once that's done.
+	void Run(const std::function<void()>& work, JobCounter* counter, JobCounter* dependsOn = 0);
+
+	// Runs other jobs until the counter's done
+	void Wait(JobCounter* counter);
+
+	// work(begin, end) over [0, count), returning when it's
+	// all done.  Ranges are split down to grainSize items (0 =
+	// picked from count and the thread count).
+	void ParallelFor(int count, const std::function<void(int begin, int end)>& work, int grainSize = 0);
+	ParallelForFunction GetParallelFor();
+
+	// The grain ParallelFor picks: about 8 pieces per thread,
+	// so stealing can even out uneven pieces
+	static int GetGrainSize(int count, int threadCount);
+
+	// The calling thread's index (0 is the thread that made
+	// the system), or -1 if it isn't one of this system's -
+	// e.g. to pick its arena in a FrameArena
+	int GetThreadIndex();
+
+	// Since the last ResetStats(), by thread (0 is the main
+	// thread): jobs run, and how many of those were stolen
+	unsigned int GetJobCount(int thread) { return threads[thread]->JobCount.load(std::memory_order_relaxed); }
+	unsigned int GetStealCount(int thread) { return threads[thread]->StealCount.load(std::memory_order_relaxed); }
+	void ResetStats();
+
+private:
+	// Chase-Lev work-stealing deque, fixed size ("Correct and
+	// efficient work-stealing for weak memory models", Le et
+	// al. 2013).  Only its owner pushes and pops.
+	class Deque
+	{
+	public:
+		Deque() : top(0), bottom(0) {}
+		bool Push(Job* job);	// False if it's full
+		Job* Pop();
+		Job* Steal();
+
+	private:
+		std::atomic<long long> top;
+		std::atomic<long long> bottom;
+		std::atomic<Job*> jobs[JobCapacity];
+	};
+
+	struct ThreadState
+	{
+		Deque Jobs;
+		Job Pool[JobCapacity];		// Ring the thread's jobs are made in
+		unsigned int NextJob;
+		std::atomic<unsigned int> JobCount;
+		std::atomic<unsigned int> StealCount;
+		std::thread Thread;			// Not for the main thread
+	};
+
+	// Times an idle worker looks for jobs before it sleeps
+	static const int IdleSpins = 256;
+
+	std::vector<ThreadState*> threads;
+	std::atomic<bool> running;
+	std::atomic<int> queued;		// Jobs pushed and not yet taken
+	std::atomic<int> sleeping;		// Workers waiting on wake
+	std::mutex sleepLock;
+	std::condition_variable wake;
+
+	void WorkerLoop(int thread);
+	Job* Allocate(int thread);		// 0 if the next slot's job hasn't run yet
+	void Push(int thread, Job* job);
+	Job* Take(int thread);			// Its own job, or a stolen one
+	void Execute(int thread, Job* job);
+	void Finish(int thread, JobCounter* counter);
+};
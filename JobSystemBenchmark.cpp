@@ -0,0 +1,370 @@
+// --------------------------------------------------------
+// Offline tool: how the job system (see JobSystem) scales
+// with cores on the frame work the game spreads over it -
+// moving entities, culling them into a draw list, and
+// clustered light assignment (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread JobSystemBenchmark.cpp JobSystem.cpp FrustumCuller.cpp CommandRecorder.cpp LightClusterGrid.cpp Profiler.cpp -o JobSystemBenchmark
+//   ./JobSystemBenchmark --entities 20000 --frames 200 --csv job_benchmark.csv
+//
+// Options: --entities N (default 20000), --lights N (2000),
+// --frames N (200, after 20 warm-up frames), --max-threads N
+// (default one per core) and --csv FILE.  Each frame is done
+// with plain loops on this thread, then on 1..max threads
+// through a JobSystem; every run's draw list is checked
+// against the plain one.
+// --------------------------------------------------------
+
+#include "CommandRecorder.h"
+#include "FrustumCuller.h"
+#include "JobSystem.h"
+#include "LightClusterGrid.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// What the game keeps per entity for this work, without
+// DirectXMath
+struct BenchmarkEntity
+{
+	float Position[3];
+	float Spin;
+	float Scale;
+	float World[16];		// Row-major, row vectors
+	float Center[3];
+	float Radius;
+};
+
+struct FrameTimes
+{
+	double Transforms;
+	double DrawList;
+	double Lights;
+	double Total;
+};
+
+static const int WarmupFrames = 20;
+static const float FrameStep = 1.0f / 60.0f;
+
+// The cube mesh's bounds: centered, corners at +-0.5
+static const float MeshCenter[3] = { 0.0f, 0.0f, 0.0f };
+static const float MeshRadius = 0.8660254f;
+
+static void MakeEntities(int count, std::vector<BenchmarkEntity>& entities)
+{
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// A field round the camera, so about a quarter is in view
+	entities.resize(count);
+	for (int e = 0; e < count; e++)
+	{
+		BenchmarkEntity& entity = entities[e];
+		memset(&entity, 0, sizeof(entity));
+		entity.Position[0] = (unit(random) * 2 - 1) * 100.0f;
+		entity.Position[1] = (unit(random) * 2 - 1) * 5.0f;
+		entity.Position[2] = (unit(random) * 2 - 1) * 100.0f;
+		entity.Spin = 0.5f + unit(random);
+		entity.Scale = 0.25f + unit(random);
+	}
+}
+
+static void MakeLights(int count, std::vector<ClusterLight>& lights)
+{
+	std::mt19937 random(5678);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	lights.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		ClusterLight& light = lights[i];
+		memset(&light, 0, sizeof(light));
+		float z = 1.0f + 59.0f * unit(random);
+		light.Position[0] = (unit(random) * 2 - 1) * z * 0.7f;
+		light.Position[1] = (unit(random) * 2 - 1) * z * 0.4f;
+		light.Position[2] = z;
+		light.Range = 1.0f + 3.0f * unit(random);
+		light.Color[0] = light.Color[1] = light.Color[2] = 1.0f;
+		light.CosOuterAngle = -1.0f;
+	}
+}
+
+// Entity::Move: scale, spin about y, then translate - and the
+// bounding sphere that goes with it
+static void MoveEntity(BenchmarkEntity& entity, float time)
+{
+	float angle = time * entity.Spin;
+	float c = cosf(angle) * entity.Scale;
+	float s = sinf(angle) * entity.Scale;
+	float* w = entity.World;
+	w[0] = c;		w[1] = 0;				w[2] = -s;		w[3] = 0;
+	w[4] = 0;		w[5] = entity.Scale;	w[6] = 0;		w[7] = 0;
+	w[8] = s;		w[9] = 0;				w[10] = c;		w[11] = 0;
+	w[12] = entity.Position[0];	w[13] = entity.Position[1];	w[14] = entity.Position[2];	w[15] = 1;
+
+	for (int axis = 0; axis < 3; axis++)
+		entity.Center[axis] = MeshCenter[0] * w[axis] + MeshCenter[1] * w[4 + axis] + MeshCenter[2] * w[8 + axis] + w[12 + axis];
+	entity.Radius = MeshRadius * entity.Scale;
+}
+
+// A camera at the origin turning about y, with the game's
+// projection (row-major, row vectors, z to [0, 1])
+static void GetViewProjection(float time, float viewProjection[16], LightClusterCamera& camera)
+{
+	float yaw = time * 0.2f;
+	float c = cosf(yaw);
+	float s = sinf(yaw);
+
+	// The inverse of a rotation about y is its transpose
+	float view[16] =
+	{
+		c, 0, s, 0,
+		0, 1, 0, 0,
+		-s, 0, c, 0,
+		0, 0, 0, 1,
+	};
+
+	float fov = 0.25f * 3.1415926535f;
+	float aspect = 16.0f / 9.0f;
+	float nearZ = 0.1f;
+	float farZ = 100.0f;
+	float yScale = 1.0f / tanf(fov * 0.5f);
+	float projection[16] =
+	{
+		yScale / aspect, 0, 0, 0,
+		0, yScale, 0, 0,
+		0, 0, farZ / (farZ - nearZ), 1,
+		0, 0, -nearZ * farZ / (farZ - nearZ), 0,
+	};
+
+	for (int row = 0; row < 4; row++)
+	{
+		for (int column = 0; column < 4; column++)
+		{
+			float sum = 0;
+			for (int k = 0; k < 4; k++)
+				sum += view[row * 4 + k] * projection[k * 4 + column];
+			viewProjection[row * 4 + column] = sum;
+		}
+	}
+
+	memset(&camera, 0, sizeof(camera));
+	memcpy(camera.View, view, sizeof(view));
+	camera.FieldOfView = fov;
+	camera.AspectRatio = aspect;
+}
+
+static double MsSince(std::chrono::high_resolution_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// --------------------------------------------------------
+// One frame's work, as Game::Update does it: with a job
+// system each step is a ParallelFor, and without one it's
+// plain loops.  The draw list is built in chunks culled in
+// parallel and joined in order, so it's the same either way.
+// --------------------------------------------------------
+static void RunFrame(JobSystem* jobs, float time, std::vector<BenchmarkEntity>& entities, LightClusterGrid& grid,
+	const std::vector<ClusterLight>& lights, std::vector<std::vector<int>>& chunkLists, std::vector<int>& drawList, FrameTimes& times)
+{
+	std::chrono::high_resolution_clock::time_point frameStart = std::chrono::high_resolution_clock::now();
+
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	std::function<void(int, int)> move = [&entities, time](int begin, int end)
+	{
+		for (int e = begin; e < end; e++)
+			MoveEntity(entities[e], time);
+	};
+	if (jobs)
+		jobs->ParallelFor((int)entities.size(), move);
+	else
+		move(0, (int)entities.size());
+	times.Transforms = MsSince(start);
+
+	start = std::chrono::high_resolution_clock::now();
+	float viewProjection[16];
+	LightClusterCamera camera;
+	GetViewProjection(time, viewProjection, camera);
+	FrustumCuller culler;
+	culler.SetViewProjection(viewProjection);
+
+	std::vector<std::pair<int, int>> chunks;
+	CommandRecorder::Split((int)entities.size(), jobs ? jobs->GetThreadCount() * 4 : 1, 64, chunks);
+	if (chunkLists.size() < chunks.size())
+		chunkLists.resize(chunks.size());
+	std::function<void(int, int)> cull = [&](int begin, int end)
+	{
+		for (int c = begin; c < end; c++)
+		{
+			chunkLists[c].clear();
+			for (int e = chunks[c].first; e < chunks[c].second; e++)
+			{
+				if (culler.IsVisible(entities[e].Center, entities[e].Radius))
+					chunkLists[c].push_back(e);
+			}
+		}
+	};
+	if (jobs)
+		jobs->ParallelFor((int)chunks.size(), cull, 1);
+	else
+		cull(0, (int)chunks.size());
+	drawList.clear();
+	for (size_t c = 0; c < chunks.size(); c++)
+		drawList.insert(drawList.end(), chunkLists[c].begin(), chunkLists[c].end());
+	times.DrawList = MsSince(start);
+
+	start = std::chrono::high_resolution_clock::now();
+	grid.SetCamera(camera);
+	grid.Assign(lights.empty() ? 0 : &lights[0], (int)lights.size());
+	times.Lights = MsSince(start);
+
+	times.Total = MsSince(frameStart);
+}
+
+int main(int argc, char* argv[])
+{
+	int entityCount = 20000;
+	int lightCount = 2000;
+	int frames = 200;
+	int maxThreads = (int)std::thread::hardware_concurrency();
+	const char* csvPath = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "--entities" && hasValue)
+			entityCount = atoi(argv[++i]);
+		else if (arg == "--lights" && hasValue)
+			lightCount = atoi(argv[++i]);
+		else if (arg == "--frames" && hasValue)
+			frames = atoi(argv[++i]);
+		else if (arg == "--max-threads" && hasValue)
+			maxThreads = atoi(argv[++i]);
+		else if (arg == "--csv" && hasValue)
+			csvPath = argv[++i];
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", arg.c_str());
+			return 2;
+		}
+	}
+	if (maxThreads <= 0)
+		maxThreads = 1;
+	if (entityCount <= 0 || lightCount < 0 || frames <= 0)
+	{
+		printf("Entities and frames must be positive\n");
+		return 2;
+	}
+
+	FILE* csv = 0;
+	if (csvPath)
+	{
+#ifdef _WIN32
+		fopen_s(&csv, csvPath, "w");
+#else
+		csv = fopen(csvPath, "w");
+#endif
+		if (!csv)
+		{
+			printf("Can't write %s\n", csvPath);
+			return 1;
+		}
+		fprintf(csv, "threads,transforms_ms,draw_list_ms,lights_ms,frame_ms,speedup,efficiency,steals_per_frame,matches_serial\n");
+	}
+
+	std::vector<BenchmarkEntity> entities;
+	MakeEntities(entityCount, entities);
+	std::vector<ClusterLight> lights;
+	MakeLights(lightCount, lights);
+
+	printf("%d entities, %d lights, %d frames (after %d warm-up), up to %d thread(s)\n", entityCount, lightCount, frames, WarmupFrames, maxThreads);
+	printf("%-8s %11s %11s %11s %11s %8s %6s %8s\n", "threads", "transforms", "draw list", "lights", "frame", "speedup", "eff", "steals");
+
+	// The plain loops first (threads 0), then 1..max threads
+	double serialMs = 0;
+	std::vector<std::vector<int>> serialLists;
+	for (int threads = 0; threads <= maxThreads; threads++)
+	{
+		JobSystem* jobs = threads > 0 ? new JobSystem(threads - 1) : 0;
+
+		LightClusterSettings settings = LightClusterSettings::Default();
+		settings.MaxIndices = 1 << 24;
+		LightClusterGrid grid(settings);
+		if (jobs)
+			grid.SetParallelFor(jobs->GetParallelFor());
+		else
+			grid.SetParallelFor([](int count, const std::function<void(int, int)>& work) { work(0, count); });
+
+		std::vector<std::vector<int>> chunkLists;
+		std::vector<int> drawList;
+		FrameTimes sum;
+		memset(&sum, 0, sizeof(sum));
+		bool matches = true;
+		for (int frame = -WarmupFrames; frame < frames; frame++)
+		{
+			if (frame == 0 && jobs)
+				jobs->ResetStats();
+
+			FrameTimes times;
+			float time = (frame + WarmupFrames) * FrameStep;
+			RunFrame(jobs, time, entities, grid, lights, chunkLists, drawList, times);
+			if (frame < 0)
+				continue;
+
+			sum.Transforms += times.Transforms;
+			sum.DrawList += times.DrawList;
+			sum.Lights += times.Lights;
+			sum.Total += times.Total;
+
+			// Every 10th frame's list, to check the others against
+			if (frame % 10 == 0)
+			{
+				if (!jobs)
+					serialLists.push_back(drawList);
+				else if (drawList != serialLists[frame / 10])
+					matches = false;
+			}
+		}
+
+		double steals = 0;
+		if (jobs)
+		{
+			for (int t = 0; t < jobs->GetThreadCount(); t++)
+				steals += jobs->GetStealCount(t);
+			steals /= frames;
+		}
+		delete jobs;
+
+		double frameMs = sum.Total / frames;
+		if (!threads)
+			serialMs = frameMs;
+		double speedup = frameMs > 0 ? serialMs / frameMs : 0;
+		double efficiency = threads > 0 ? speedup / threads : 1;
+
+		char name[16];
+		if (threads > 0)
+			snprintf(name, sizeof(name), "%d", threads);
+		else
+			snprintf(name, sizeof(name), "serial");
+		printf("%-8s %9.3fms %9.3fms %9.3fms %9.3fms %7.2fx %5.0f%% %8.1f%s\n", name,
+			sum.Transforms / frames, sum.DrawList / frames, sum.Lights / frames, frameMs,
+			speedup, efficiency * 100, steals, matches ? "" : "  MISMATCH");
+		if (csv)
+			fprintf(csv, "%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.2f,%d\n", threads,
+				sum.Transforms / frames, sum.DrawList / frames, sum.Lights / frames, frameMs,
+				speedup, efficiency, steals, matches ? 1 : 0);
+	}
+
+	if (csv)
+		fclose(csv);
+	return 0;
+}
@@ -0,0 +1,161 @@
+// --------------------------------------------------------
+// Offline tool: times clustered light assignment (see
+// LightClusterGrid) with 1k-10k lights (excluded from the game
+// build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread LightClusterBenchmark.cpp LightClusterGrid.cpp -o LightClusterBenchmark
+//   ./LightClusterBenchmark 100 cluster_benchmark.csv
+//
+// Arguments: runs per configuration (default 100) and an
+// optional CSV to write.  Lights are scattered through the
+// view (half point, half spot lights, 1-4 units of range) and
+// assigned with SSE on all threads, SSE on one thread and
+// scalar code on one thread.  Every configuration's lists are
+// checked against the scalar ones.
+// --------------------------------------------------------
+
+#include "LightClusterGrid.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+static void MakeLights(int count, std::vector<ClusterLight>& lights)
+{
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	lights.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		ClusterLight& light = lights[i];
+		memset(&light, 0, sizeof(light));
+
+		// Somewhere in the first 60 units of the view (the
+		// camera is at the origin looking down +z)
+		float z = 1.0f + 59.0f * unit(random);
+		light.Position[0] = (unit(random) * 2 - 1) * z * 0.7f;
+		light.Position[1] = (unit(random) * 2 - 1) * z * 0.4f;
+		light.Position[2] = z;
+		light.Range = 1.0f + 3.0f * unit(random);
+		light.Color[0] = light.Color[1] = light.Color[2] = 1.0f;
+		light.CosOuterAngle = -1.0f;
+
+		if (i % 2)
+		{
+			float direction[3] = { unit(random) * 2 - 1, unit(random) * 2 - 1, unit(random) * 2 - 1 };
+			float length = sqrtf(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+			for (int axis = 0; axis < 3; axis++)
+				light.Direction[axis] = length > 0 ? direction[axis] / length : (axis == 2 ? 1.0f : 0.0f);
+			light.CosOuterAngle = cosf(0.2f + 0.6f * unit(random));
+			light.CosInnerAngle = (1.0f + light.CosOuterAngle) * 0.5f;
+		}
+	}
+}
+
+// Every cluster's lists, sorted, for comparing runs
+static void GetLists(LightClusterGrid& grid, std::vector<std::vector<unsigned int>>& lists)
+{
+	lists.resize(grid.GetClusterCount());
+	for (int c = 0; c < grid.GetClusterCount(); c++)
+	{
+		const ClusterRange& range = grid.GetRanges()[c];
+		lists[c].assign(grid.GetIndices().begin() + range.Offset, grid.GetIndices().begin() + range.Offset + range.Count);
+		std::sort(lists[c].begin(), lists[c].end());
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int runs = argc > 1 ? std::max(1, atoi(argv[1])) : 100;
+	const char* csvPath = argc > 2 ? argv[2] : 0;
+
+	FILE* csv = 0;
+	if (csvPath)
+	{
+#ifdef _WIN32
+		fopen_s(&csv, csvPath, "w");
+#else
+		csv = fopen(csvPath, "w");
+#endif
+		if (!csv)
+		{
+			printf("Can't write %s\n", csvPath);
+			return 1;
+		}
+		fprintf(csv, "lights,mode,mean_ms,p95_ms,indices,max_per_cluster,matches_scalar\n");
+	}
+
+	LightClusterCamera camera;
+	memset(&camera, 0, sizeof(camera));
+	camera.View[0] = camera.View[5] = camera.View[10] = camera.View[15] = 1;
+	camera.FieldOfView = 0.25f * 3.1415926535f;
+	camera.AspectRatio = 16.0f / 9.0f;
+
+	struct Mode { const char* Name; bool Simd; bool Threads; };
+	const Mode modes[] =
+	{
+		{ "scalar 1 thread", false, false },
+		{ "sse 1 thread", true, false },
+		{ "sse threads", true, true },
+	};
+	const int lightCounts[] = { 1000, 2000, 5000, 10000 };
+
+	printf("%d runs each, %d clusters\n", runs, LightClusterSettings::Default().TilesX * LightClusterSettings::Default().TilesY * LightClusterSettings::Default().Slices);
+	printf("%8s  %-18s %9s %9s %9s %8s\n", "lights", "mode", "mean ms", "p95 ms", "indices", "max");
+
+	for (int l = 0; l < (int)(sizeof(lightCounts) / sizeof(lightCounts[0])); l++)
+	{
+		std::vector<ClusterLight> lights;
+		MakeLights(lightCounts[l], lights);
+
+		std::vector<std::vector<unsigned int>> reference;
+		for (int m = 0; m < (int)(sizeof(modes) / sizeof(modes[0])); m++)
+		{
+			LightClusterSettings settings = LightClusterSettings::Default();
+			settings.UseSimd = modes[m].Simd;
+			settings.MaxIndices = 1 << 24;	// Never drop, so the lists compare
+			LightClusterGrid grid(settings);
+			if (!modes[m].Threads)
+				grid.SetParallelFor([](int count, const std::function<void(int, int)>& work) { work(0, count); });
+			grid.SetCamera(camera);
+
+			std::vector<double> times;
+			grid.Assign(&lights[0], (int)lights.size());	// Warm up
+			for (int r = 0; r < runs; r++)
+			{
+				std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+				grid.Assign(&lights[0], (int)lights.size());
+				times.push_back(std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+			}
+			std::sort(times.begin(), times.end());
+			double mean = 0;
+			for (size_t t = 0; t < times.size(); t++)
+				mean += times[t];
+			mean /= times.size();
+			double p95 = times[std::min(times.size() - 1, (size_t)(times.size() * 0.95))];
+
+			std::vector<std::vector<unsigned int>> lists;
+			GetLists(grid, lists);
+			if (m == 0)
+				reference = lists;
+			bool matches = lists == reference;
+
+			printf("%8d  %-18s %9.3f %9.3f %9u %8u%s\n", lightCounts[l], modes[m].Name, mean, p95,
+				(unsigned int)grid.GetIndices().size(), grid.GetMaxClusterLights(), matches ? "" : "  MISMATCH");
+			if (csv)
+				fprintf(csv, "%d,%s,%.4f,%.4f,%u,%u,%d\n", lightCounts[l], modes[m].Name, mean, p95,
+					(unsigned int)grid.GetIndices().size(), grid.GetMaxClusterLights(), matches ? 1 : 0);
+		}
+	}
+
+	if (csv)
+		fclose(csv);
+	return 0;
+}
@@ -0,0 +1,487 @@
+#include "LightClusterGrid.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <thread>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define LIGHT_CLUSTER_GRID_SSE
+#endif
+
+// Padding lanes sit far away with no radius, so they never pass
+static const float PadPosition = 1e18f;
+
+LightClusterSettings LightClusterSettings::Default()
+{
+	LightClusterSettings settings;
+	settings.TilesX = 16;
+	settings.TilesY = 9;
+	settings.Slices = 24;
+	settings.NearClip = 0.1f;
+	settings.FarClip = 100.0f;
+	settings.MaxIndices = 16 * 9 * 24 * 64;
+	settings.UseSimd = true;
+	return settings;
+}
+
+void LightClusterGrid::ViewLights::Resize(size_t count)
+{
+	X.resize(count);
+	Y.resize(count);
+	Z.resize(count);
+	Radius.resize(count);
+	DirectionX.resize(count);
+	DirectionY.resize(count);
+	DirectionZ.resize(count);
+	CosAngle.resize(count);
+	SinAngle.resize(count);
+	Index.resize(count);
+}
+
+void LightClusterGrid::ViewLights::Reserve(size_t count)
+{
+	X.reserve(count);
+	Y.reserve(count);
+	Z.reserve(count);
+	Radius.reserve(count);
+	DirectionX.reserve(count);
+	DirectionY.reserve(count);
+	DirectionZ.reserve(count);
+	CosAngle.reserve(count);
+	SinAngle.reserve(count);
+	Index.reserve(count);
+}
+
+void LightClusterGrid::ViewLights::Copy(size_t to, const ViewLights& from, size_t index)
+{
+	X[to] = from.X[index];
+	Y[to] = from.Y[index];
+	Z[to] = from.Z[index];
+	Radius[to] = from.Radius[index];
+	DirectionX[to] = from.DirectionX[index];
+	DirectionY[to] = from.DirectionY[index];
+	DirectionZ[to] = from.DirectionZ[index];
+	CosAngle[to] = from.CosAngle[index];
+	SinAngle[to] = from.SinAngle[index];
+	Index[to] = from.Index[index];
+}
+
+// Fills [count, next multiple of 4) with lanes that never pass
+static void Pad(std::vector<float>& x, std::vector<float>& radius, size_t count)
+{
+	for (size_t i = count; i < ((count + 3) & ~(size_t)3); i++)
+	{
+		x[i] = PadPosition;
+		radius[i] = 0;
+	}
+}
+
+LightClusterGrid::LightClusterGrid(const LightClusterSettings& settings)
+{
+	this->settings = settings;
+	this->settings.TilesX = std::max(settings.TilesX, 1);
+	this->settings.TilesY = std::max(settings.TilesY, 1);
+	this->settings.Slices = std::max(settings.Slices, 1);
+
+	// Slices are spaced exponentially: slice k starts at
+	// near * (far / near) ^ (k / slices)
+	float depthRange = log2f(this->settings.FarClip / this->settings.NearClip);
+	sliceScale = this->settings.Slices / depthRange;
+	sliceBias = -this->settings.Slices * log2f(this->settings.NearClip) / depthRange;
+
+	memset(view, 0, sizeof(view));
+	view[0] = view[5] = view[10] = view[15] = 1;
+	fieldOfView = 0;
+	aspectRatio = 0;
+
+	dropped = 0;
+	maxClusterLights = 0;
+	mostSliceIndices = 0;
+	ranges.resize(GetClusterCount());
+	sliceOutputs.resize(this->settings.Slices);
+
+	// By default, split the work over a thread per core
+	parallelFor = [](int count, const std::function<void(int begin, int end)>& work)
+	{
+		int threadCount = std::max(1, std::min((int)std::thread::hardware_concurrency(), count));
+		std::vector<std::thread> threads;
+		for (int t = 1; t < threadCount; t++)
+			threads.push_back(std::thread(work, count * t / threadCount, count * (t + 1) / threadCount));
+		work(0, count / threadCount);
+		for (size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+	};
+}
+
+float LightClusterGrid::GetSliceDepth(int slice)
+{
+	return settings.NearClip * powf(settings.FarClip / settings.NearClip, (float)slice / settings.Slices);
+}
+
+void LightClusterGrid::GetClusterBounds(int cluster, float minimum[3], float maximum[3])
+{
+	for (int axis = 0; axis < 3; axis++)
+	{
+		minimum[axis] = bounds[cluster * 6 + axis];
+		maximum[axis] = bounds[cluster * 6 + 3 + axis];
+	}
+}
+
+void LightClusterGrid::SetCamera(const LightClusterCamera& camera)
+{
+	memcpy(view, camera.View, sizeof(view));
+	if (camera.FieldOfView != fieldOfView || camera.AspectRatio != aspectRatio || bounds.empty())
+	{
+		fieldOfView = camera.FieldOfView;
+		aspectRatio = camera.AspectRatio;
+		BuildBounds();
+	}
+}
+
+// --------------------------------------------------------
+// View space bounds of every cluster: the AABB of the
+// frustum piece between its tile's edges and its slice's
+// depths, plus a sphere around that
+// --------------------------------------------------------
+void LightClusterGrid::BuildBounds()
+{
+	bounds.resize(GetClusterCount() * 6);
+	spheres.resize(GetClusterCount() * 4);
+
+	float tanY = tanf(fieldOfView * 0.5f);
+	float tanX = tanY * aspectRatio;
+
+	for (int slice = 0; slice < settings.Slices; slice++)
+	{
+		float nearZ = GetSliceDepth(slice);
+		float farZ = GetSliceDepth(slice + 1);
+
+		for (int y = 0; y < settings.TilesY; y++)
+		{
+			// Row 0 is the top of the screen (+y in view space)
+			float top = 1.0f - 2.0f * y / settings.TilesY;
+			float bottom = 1.0f - 2.0f * (y + 1) / settings.TilesY;
+
+			for (int x = 0; x < settings.TilesX; x++)
+			{
+				float left = -1.0f + 2.0f * x / settings.TilesX;
+				float right = -1.0f + 2.0f * (x + 1) / settings.TilesX;
+
+				float* b = &bounds[GetClusterIndex(x, y, slice) * 6];
+				b[0] = std::min(left * tanX * nearZ, left * tanX * farZ);
+				b[1] = std::min(bottom * tanY * nearZ, bottom * tanY * farZ);
+				b[2] = nearZ;
+				b[3] = std::max(right * tanX * nearZ, right * tanX * farZ);
+				b[4] = std::max(top * tanY * nearZ, top * tanY * farZ);
+				b[5] = farZ;
+
+				float* s = &spheres[GetClusterIndex(x, y, slice) * 4];
+				float halfSize[3];
+				for (int axis = 0; axis < 3; axis++)
+				{
+					s[axis] = (b[axis] + b[3 + axis]) * 0.5f;
+					halfSize[axis] = (b[3 + axis] - b[axis]) * 0.5f;
+				}
+				s[3] = sqrtf(halfSize[0] * halfSize[0] + halfSize[1] * halfSize[1] + halfSize[2] * halfSize[2]);
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------
+// Builds every cluster's light list
+//
+// lights     - World space lights
+// lightCount - How many
+// --------------------------------------------------------
+void LightClusterGrid::Assign(const ClusterLight* lights, int lightCount)
+{
+	if (bounds.empty())
+		BuildBounds();
+
+	// Into view space
+	size_t padded = ((size_t)lightCount + 3) & ~(size_t)3;
+	viewLights.Resize(padded);
+	for (int i = 0; i < lightCount; i++)
+	{
+		const ClusterLight& light = lights[i];
+		const float* p = light.Position;
+		const float* d = light.Direction;
+		viewLights.X[i] = p[0] * view[0] + p[1] * view[4] + p[2] * view[8] + view[12];
+		viewLights.Y[i] = p[0] * view[1] + p[1] * view[5] + p[2] * view[9] + view[13];
+		viewLights.Z[i] = p[0] * view[2] + p[1] * view[6] + p[2] * view[10] + view[14];
+		viewLights.Radius[i] = light.Range;
+		viewLights.Index[i] = (unsigned int)i;
+
+		// Point lights get no direction, which no cone test culls
+		bool spot = light.CosOuterAngle > -1.0f;
+		float cosAngle = spot ? light.CosOuterAngle : -1.0f;
+		viewLights.DirectionX[i] = spot ? d[0] * view[0] + d[1] * view[4] + d[2] * view[8] : 0.0f;
+		viewLights.DirectionY[i] = spot ? d[0] * view[1] + d[1] * view[5] + d[2] * view[9] : 0.0f;
+		viewLights.DirectionZ[i] = spot ? d[0] * view[2] + d[1] * view[6] + d[2] * view[10] : 0.0f;
+		viewLights.CosAngle[i] = cosAngle;
+		viewLights.SinAngle[i] = sqrtf(std::max(0.0f, 1.0f - cosAngle * cosAngle));
+	}
+	Pad(viewLights.X, viewLights.Radius, lightCount);
+
+	// Every slice's lists get room for all the lights and the
+	// longest list any slice has made, so they stop growing
+	// (and allocating) once the light count has been seen
+	for (int slice = 0; slice < settings.Slices; slice++)
+	{
+		SliceOutput& output = sliceOutputs[slice];
+		output.SliceLights.Reserve(padded);
+		output.RowLights.Reserve(padded);
+		if (output.Indices.capacity() < mostSliceIndices)
+			output.Indices.reserve(mostSliceIndices + mostSliceIndices / 2);
+	}
+
+	parallelFor(settings.Slices, [this, lightCount](int begin, int end)
+	{
+		for (int slice = begin; slice < end; slice++)
+			AssignSlice(slice, lightCount);
+	});
+
+	// Join the slices' lists up into one
+	dropped = 0;
+	maxClusterLights = 0;
+	unsigned int total = 0;
+	for (int slice = 0; slice < settings.Slices; slice++)
+	{
+		total += (unsigned int)sliceOutputs[slice].Indices.size();
+		mostSliceIndices = std::max(mostSliceIndices, sliceOutputs[slice].Indices.size());
+	}
+	unsigned int kept = std::min(total, settings.MaxIndices);
+	if (indices.capacity() < kept)
+		indices.reserve(std::min(kept + kept / 2, settings.MaxIndices));
+	indices.resize(kept);
+
+	unsigned int offset = 0;
+	int clustersPerSlice = settings.TilesX * settings.TilesY;
+	for (int slice = 0; slice < settings.Slices; slice++)
+	{
+		SliceOutput& output = sliceOutputs[slice];
+		for (int i = 0; i < clustersPerSlice; i++)
+		{
+			ClusterRange range = output.Ranges[i];
+			unsigned int room = settings.MaxIndices - std::min(offset, settings.MaxIndices);
+			unsigned int count = std::min(range.Count, room);
+			if (count > 0)
+				memcpy(&indices[offset], &output.Indices[range.Offset], count * sizeof(unsigned int));
+
+			ranges[slice * clustersPerSlice + i].Offset = offset;
+			ranges[slice * clustersPerSlice + i].Count = count;
+			offset += count;
+			dropped += range.Count - count;
+			maxClusterLights = std::max(maxClusterLights, range.Count);
+		}
+	}
+}
+
+// --------------------------------------------------------
+// Lists the lights for every cluster of one depth slice
+// --------------------------------------------------------
+void LightClusterGrid::AssignSlice(int slice, int lightCount)
+{
+	SliceOutput& output = sliceOutputs[slice];
+	output.Indices.clear();
+	output.Ranges.resize(settings.TilesX * settings.TilesY);
+
+	// The slice's bounds, then only the lights that reach it
+	float sliceMin[3] = { 1e30f, 1e30f, 1e30f };
+	float sliceMax[3] = { -1e30f, -1e30f, -1e30f };
+	for (int i = 0; i < settings.TilesX * settings.TilesY; i++)
+	{
+		const float* b = &bounds[(slice * settings.TilesX * settings.TilesY + i) * 6];
+		for (int axis = 0; axis < 3; axis++)
+		{
+			sliceMin[axis] = std::min(sliceMin[axis], b[axis]);
+			sliceMax[axis] = std::max(sliceMax[axis], b[3 + axis]);
+		}
+	}
+
+	size_t sliceCount;
+	Cull(viewLights, lightCount, sliceMin, sliceMax, settings.UseSimd, output.SliceLights, sliceCount);
+
+	for (int y = 0; y < settings.TilesY; y++)
+	{
+		// Then the lights that reach this row of tiles
+		float rowMin[3] = { 1e30f, 1e30f, 1e30f };
+		float rowMax[3] = { -1e30f, -1e30f, -1e30f };
+		for (int x = 0; x < settings.TilesX; x++)
+		{
+			const float* b = &bounds[GetClusterIndex(x, y, slice) * 6];
+			for (int axis = 0; axis < 3; axis++)
+			{
+				rowMin[axis] = std::min(rowMin[axis], b[axis]);
+				rowMax[axis] = std::max(rowMax[axis], b[3 + axis]);
+			}
+		}
+
+		size_t rowCount = 0;
+		if (sliceCount > 0)
+			Cull(output.SliceLights, sliceCount, rowMin, rowMax, settings.UseSimd, output.RowLights, rowCount);
+
+		for (int x = 0; x < settings.TilesX; x++)
+		{
+			ClusterRange& range = output.Ranges[y * settings.TilesX + x];
+			range.Offset = (unsigned int)output.Indices.size();
+			if (rowCount > 0)
+				TestCluster(output.RowLights, rowCount, GetClusterIndex(x, y, slice), output.Indices);
+			range.Count = (unsigned int)output.Indices.size() - range.Offset;
+		}
+	}
+}
+
+// --------------------------------------------------------
+// Copies the lights whose spheres touch an AABB
+//
+// from, count - Lights to test (padded to a multiple of 4)
+// minimum     - The box
+// maximum
+// useSimd     - Test four at a time with SSE
+// to, kept    - Receives the lights that touch it (padded)
+// --------------------------------------------------------
+void LightClusterGrid::Cull(const ViewLights& from, size_t count, const float minimum[3], const float maximum[3], bool useSimd, ViewLights& to, size_t& kept)
+{
+	to.Resize(((count + 3) & ~(size_t)3));
+	kept = 0;
+
+#ifdef LIGHT_CLUSTER_GRID_SSE
+	if (useSimd)
+	{
+		__m128 zero = _mm_setzero_ps();
+		__m128 minX = _mm_set1_ps(minimum[0]), minY = _mm_set1_ps(minimum[1]), minZ = _mm_set1_ps(minimum[2]);
+		__m128 maxX = _mm_set1_ps(maximum[0]), maxY = _mm_set1_ps(maximum[1]), maxZ = _mm_set1_ps(maximum[2]);
+		for (size_t i = 0; i < count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(&from.X[i]);
+			__m128 y = _mm_loadu_ps(&from.Y[i]);
+			__m128 z = _mm_loadu_ps(&from.Z[i]);
+			__m128 r = _mm_loadu_ps(&from.Radius[i]);
+
+			// Distance from the box on each axis (0 inside)
+			__m128 dx = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minX, x), _mm_sub_ps(x, maxX)));
+			__m128 dy = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minY, y), _mm_sub_ps(y, maxY)));
+			__m128 dz = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minZ, z), _mm_sub_ps(z, maxZ)));
+			__m128 distanceSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			int mask = _mm_movemask_ps(_mm_cmple_ps(distanceSq, _mm_mul_ps(r, r)));
+
+			for (int lane = 0; mask != 0; lane++, mask >>= 1)
+			{
+				if (mask & 1)
+					to.Copy(kept++, from, i + lane);
+			}
+		}
+		Pad(to.X, to.Radius, kept);
+		return;
+	}
+#endif
+
+	for (size_t i = 0; i < count; i++)
+	{
+		float distanceSq = 0;
+		float position[3] = { from.X[i], from.Y[i], from.Z[i] };
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float d = std::max(0.0f, std::max(minimum[axis] - position[axis], position[axis] - maximum[axis]));
+			distanceSq += d * d;
+		}
+		if (distanceSq <= from.Radius[i] * from.Radius[i])
+			to.Copy(kept++, from, i);
+	}
+
+	Pad(to.X, to.Radius, kept);
+}
+
+// --------------------------------------------------------
+// Appends the lights that reach one cluster: the sphere must
+// touch its AABB, and a spot light's cone must touch its
+// bounding sphere (Wronski, "Cull that cone!")
+// --------------------------------------------------------
+void LightClusterGrid::TestCluster(const ViewLights& lights, size_t count, int cluster, std::vector<unsigned int>& out)
+{
+	const float* b = &bounds[cluster * 6];
+	const float* s = &spheres[cluster * 4];
+
+#ifdef LIGHT_CLUSTER_GRID_SSE
+	if (settings.UseSimd)
+	{
+		__m128 zero = _mm_setzero_ps();
+		__m128 minX = _mm_set1_ps(b[0]), minY = _mm_set1_ps(b[1]), minZ = _mm_set1_ps(b[2]);
+		__m128 maxX = _mm_set1_ps(b[3]), maxY = _mm_set1_ps(b[4]), maxZ = _mm_set1_ps(b[5]);
+		__m128 centerX = _mm_set1_ps(s[0]), centerY = _mm_set1_ps(s[1]), centerZ = _mm_set1_ps(s[2]);
+		__m128 sphereRadius = _mm_set1_ps(s[3]);
+
+		for (size_t i = 0; i < count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(&lights.X[i]);
+			__m128 y = _mm_loadu_ps(&lights.Y[i]);
+			__m128 z = _mm_loadu_ps(&lights.Z[i]);
+			__m128 r = _mm_loadu_ps(&lights.Radius[i]);
+
+			// Sphere vs. AABB
+			__m128 dx = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minX, x), _mm_sub_ps(x, maxX)));
+			__m128 dy = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minY, y), _mm_sub_ps(y, maxY)));
+			__m128 dz = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minZ, z), _mm_sub_ps(z, maxZ)));
+			__m128 distanceSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			__m128 pass = _mm_cmple_ps(distanceSq, _mm_mul_ps(r, r));
+			if (_mm_movemask_ps(pass) == 0)
+				continue;
+
+			// Cone vs. sphere
+			__m128 vx = _mm_sub_ps(centerX, x);
+			__m128 vy = _mm_sub_ps(centerY, y);
+			__m128 vz = _mm_sub_ps(centerZ, z);
+			__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+			__m128 along = _mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(vx, _mm_loadu_ps(&lights.DirectionX[i])),
+				_mm_mul_ps(vy, _mm_loadu_ps(&lights.DirectionY[i]))),
+				_mm_mul_ps(vz, _mm_loadu_ps(&lights.DirectionZ[i])));
+			__m128 across = _mm_sqrt_ps(_mm_max_ps(zero, _mm_sub_ps(lengthSq, _mm_mul_ps(along, along))));
+			__m128 closest = _mm_sub_ps(
+				_mm_mul_ps(_mm_loadu_ps(&lights.CosAngle[i]), across),
+				_mm_mul_ps(along, _mm_loadu_ps(&lights.SinAngle[i])));
+
+			__m128 culled = _mm_or_ps(_mm_or_ps(
+				_mm_cmpgt_ps(closest, sphereRadius),
+				_mm_cmpgt_ps(along, _mm_add_ps(sphereRadius, r))),
+				_mm_cmplt_ps(along, _mm_sub_ps(zero, sphereRadius)));
+			int mask = _mm_movemask_ps(_mm_andnot_ps(culled, pass));
+
+			for (int lane = 0; mask != 0; lane++, mask >>= 1)
+			{
+				if (mask & 1)
+					out.push_back(lights.Index[i + lane]);
+			}
+		}
+		return;
+	}
+#endif
+
+	for (size_t i = 0; i < count; i++)
+	{
+		float position[3] = { lights.X[i], lights.Y[i], lights.Z[i] };
+		float r = lights.Radius[i];
+
+		float distanceSq = 0;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float d = std::max(0.0f, std::max(b[axis] - position[axis], position[axis] - b[3 + axis]));
+			distanceSq += d * d;
+		}
+		if (distanceSq > r * r)
+			continue;
+
+		float v[3] = { s[0] - position[0], s[1] - position[1], s[2] - position[2] };
+		float lengthSq = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+		float along = v[0] * lights.DirectionX[i] + v[1] * lights.DirectionY[i] + v[2] * lights.DirectionZ[i];
+		float closest = lights.CosAngle[i] * sqrtf(std::max(0.0f, lengthSq - along * along)) - along * lights.SinAngle[i];
+		if (closest > s[3] || along > s[3] + r || along < -s[3])
+			continue;
+
+		out.push_back(lights.Index[i]);
+	}
+}
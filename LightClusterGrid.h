@@ -0,0 +1,158 @@
+#pragma once
+
+#include <stddef.h>
+#include <functional>
+#include <vector>
+
+// --------------------------------------------------------
+// A point or spot light, as PixelShader's ClusteredLights
+// structured buffer holds it (tightly packed, 48 bytes).
+// Point lights have no direction and CosOuterAngle = -1.
+// --------------------------------------------------------
+struct ClusterLight
+{
+	float Position[3];		// World space
+	float Range;			// Fades out to nothing here
+	float Color[3];
+	float CosOuterAngle;	// Cone edge (-1 = point light)
+	float Direction[3];		// Normalized (0 for point lights)
+	float CosInnerAngle;	// Full brightness inside this
+};
+
+// Where a cluster's lights are in the index list (the
+// ClusterRanges structured buffer)
+struct ClusterRange
+{
+	unsigned int Offset;
+	unsigned int Count;
+};
+
+struct LightClusterSettings
+{
+	int TilesX;				// Screen space tiles across
+	int TilesY;				// ... and down
+	int Slices;				// Depth slices, spaced exponentially
+	float NearClip;			// Where the first slice starts
+	float FarClip;			// Where the last one ends
+	unsigned int MaxIndices;	// Capacity of the index list (lights past it are dropped)
+	bool UseSimd;			// SSE tests, 4 lights at a time (scalar otherwise)
+
+	static LightClusterSettings Default();
+};
+
+// The view the grid covers.  Row-major with row vectors, like
+// XMMATRIX (not transposed for HLSL).
+struct LightClusterCamera
+{
+	float View[16];
+	float FieldOfView;	// Vertical, in radians
+	float AspectRatio;
+};
+
+// --------------------------------------------------------
+// Clustered light assignment, on the CPU and without D3D.
+//
+// The view frustum is cut into a grid of "froxels": TilesX by
+// TilesY screen tiles, each cut into Slices depth ranges that
+// grow exponentially with distance (so clusters stay roughly
+// cube shaped).  Every frame each cluster gets the list of
+// lights that can reach it, and the pixel shader only loops
+// over its own cluster's list.
+//
+// Assignment runs in parallel over depth slices.  Each slice
+// first keeps the lights that overlap it, then each row of
+// tiles the lights that overlap the row, then every cluster
+// tests those against its view space AABB - four lights at a
+// time with SSE.  Spot lights are also tested as cones against
+// the cluster's bounding sphere, so a narrow spot doesn't
+// fill every cluster its range reaches.
+//
+// The result is one compact list of light indices, with an
+// offset and count per cluster.
+// --------------------------------------------------------
+class LightClusterGrid
+{
+public:
+	// Runs work(begin, end) over [0, count), in pieces
+	typedef std::function<void(int count, const std::function<void(int begin, int end)>& work)> ParallelFor;
+
+	LightClusterGrid(const LightClusterSettings& settings);
+
+	// Replaces the default (a thread per core, per call)
+	void SetParallelFor(const ParallelFor& parallelFor) { this->parallelFor = parallelFor; }
+
+	// Sets the view; the clusters' bounds are only rebuilt
+	// when the projection changes
+	void SetCamera(const LightClusterCamera& camera);
+
+	// Builds every cluster's light list
+	void Assign(const ClusterLight* lights, int lightCount);
+
+	int GetClusterCount() { return settings.TilesX * settings.TilesY * settings.Slices; }
+	int GetClusterIndex(int x, int y, int slice) { return (slice * settings.TilesY + y) * settings.TilesX + x; }
+	const LightClusterSettings& GetSettings() { return settings; }
+
+	// Results of the last Assign()
+	const std::vector<ClusterRange>& GetRanges() { return ranges; }
+	const std::vector<unsigned int>& GetIndices() { return indices; }
+	unsigned int GetDroppedCount() { return dropped; }		// Didn't fit in MaxIndices
+	unsigned int GetMaxClusterLights() { return maxClusterLights; }
+
+	// slice = log2(viewDepth) * scale + bias, for the shader
+	float GetSliceScale() { return sliceScale; }
+	float GetSliceBias() { return sliceBias; }
+	float GetSliceDepth(int slice);
+
+	// View space bounds of a cluster
+	void GetClusterBounds(int cluster, float minimum[3], float maximum[3]);
+
+private:
+	LightClusterSettings settings;
+	ParallelFor parallelFor;
+
+	float view[16];
+	float fieldOfView;
+	float aspectRatio;
+	float sliceScale;
+	float sliceBias;
+
+	// Per cluster: view space AABB and bounding sphere
+	std::vector<float> bounds;		// [cluster * 6]: min xyz, max xyz
+	std::vector<float> spheres;		// [cluster * 4]: center xyz, radius
+
+	// The lights in view space, structure of arrays (padded
+	// to a multiple of 4 for SSE)
+	struct ViewLights
+	{
+		std::vector<float> X, Y, Z, Radius;
+		std::vector<float> DirectionX, DirectionY, DirectionZ;
+		std::vector<float> CosAngle, SinAngle;
+		std::vector<unsigned int> Index;
+
+		void Resize(size_t count);
+		void Reserve(size_t count);
+		void Copy(size_t to, const ViewLights& from, size_t index);
+	};
+	ViewLights viewLights;
+
+	// Each slice's lists, before they're joined up
+	struct SliceOutput
+	{
+		std::vector<unsigned int> Indices;
+		std::vector<ClusterRange> Ranges;	// Offsets into Indices
+		ViewLights SliceLights;
+		ViewLights RowLights;
+	};
+	std::vector<SliceOutput> sliceOutputs;
+	size_t mostSliceIndices;		// Longest list a slice has made
+
+	std::vector<ClusterRange> ranges;
+	std::vector<unsigned int> indices;
+	unsigned int dropped;
+	unsigned int maxClusterLights;
+
+	void BuildBounds();
+	void AssignSlice(int slice, int lightCount);
+	static void Cull(const ViewLights& from, size_t count, const float minimum[3], const float maximum[3], bool useSimd, ViewLights& to, size_t& kept);
+	void TestCluster(const ViewLights& lights, size_t count, int cluster, std::vector<unsigned int>& out);
+};
@@ -3,19 +3,9 @@
 #include <d3d11.h>
 #include <DirectXMath.h>
 
-struct DirectionalLight
-{
-	DirectX::XMFLOAT4 AmbientColor;
-	DirectX::XMFLOAT4 DiffuseColor;
-	DirectX::XMFLOAT3 Direction;
-	//float nope;
-};
+// DirectionalLight and SpotLight are generated from PixelShader.hlsl,
+// along with the cbuffers that hold them (see GenerateShaderStructs.py)
+#include "ShaderStructs.h"
 
-/*struct SpotLight //?
-{
-	DirectX::XMFLOAT4 AmbientColor;
-	DirectX::XMFLOAT3 Position;
-	float DiffuseIntensity;
-	DirectX::XMFLOAT3 Direction;
-	float nope;
-};*/
+// Most spot lights PixelShader's spotLightData holds
+#define MAX_SPOT_LIGHTS	4
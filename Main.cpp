@@ -1,6 +1,8 @@
 
 #include <Windows.h>
+#include <stdlib.h>
 #include "Game.h"
+#include "Benchmark.h"
 
 // --------------------------------------------------------
 // Entry point for a graphical (non-console) Windows application
@@ -18,9 +20,19 @@ int WINAPI WinMain(
 	_CrtSetDbgFlag( _CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF );
 #endif
 
+	// "--benchmark [scene]" and co. (see BenchmarkSettings)
+	// run a benchmark instead of the game
+	BenchmarkSettings benchmarkSettings;
+	std::string error;
+	if (!ParseBenchmarkArguments(__argc, __argv, benchmarkSettings, error))
+	{
+		MessageBoxA(NULL, error.c_str(), "Bad arguments", MB_OK | MB_ICONERROR);
+		return 1;
+	}
+
 	// Create the Game object using
 	// the app handle we got from WinMain
-	Game dxGame(hInstance);
+	Game dxGame(hInstance, benchmarkSettings);
 
 	// Result variable for function calls below
 	HRESULT hr = S_OK;
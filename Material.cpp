@@ -8,6 +8,13 @@ Material::Material(SimpleVertexShader* v, SimplePixelShader* p, ID3D11ShaderReso
 	pixelShader = p;
 	view = vw;
 	sample = sm;
+
+	permutationKey = ShaderPermutation::GetDefaultKey();
+	variant = 0;
+	pipelineState = 0;
+
+	roughness = 0.5f;
+	metalness = 0.0f;
 }
 
 SimpleVertexShader* Material::GetVertexShader()
@@ -17,6 +24,10 @@ SimpleVertexShader* Material::GetVertexShader()
 
 SimplePixelShader* Material::GetPixelShader()
 {
+	//The variant compiled for this material's features
+	if (variant)
+		return variant;
+
 	return pixelShader;
 }
 
@@ -30,6 +41,47 @@ ID3D11SamplerState* Material::GetSamplerState()
 	return sample;
 }
 
+void Material::SetPermutation(ShaderPermutationCache * cache, ShaderPermutationKey key)
+{
+	permutationKey = key;
+	variant = cache ? cache->GetPixelShader(key) : 0;
+}
+
+ShaderPermutationKey Material::GetPermutationKey()
+{
+	return permutationKey;
+}
+
+PipelineState * Material::GetPipelineState()
+{
+	return pipelineState;
+}
+
+void Material::SetPipelineState(PipelineState * state)
+{
+	pipelineState = state;
+}
+
+float Material::GetRoughness()
+{
+	return roughness;
+}
+
+float Material::GetMetalness()
+{
+	return metalness;
+}
+
+void Material::SetRoughness(float r)
+{
+	roughness = r;
+}
+
+void Material::SetMetalness(float m)
+{
+	metalness = m;
+}
+
 Material::~Material()
 {
 }
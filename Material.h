@@ -2,6 +2,8 @@
 
 #include "DXCore.h"
 #include "SimpleShader.h"
+#include "ShaderPermutationCache.h"
+#include "PipelineState.h"
 #include <DirectXMath.h>
 
 class Material
@@ -12,6 +14,24 @@ public:
 	SimplePixelShader* GetPixelShader();
 	ID3D11ShaderResourceView* GetShaderResourceView();
 	ID3D11SamplerState* GetSamplerState();
+
+	// Pick the pixel shader variant by feature key.  It's looked
+	// up (and built, if it has to be) right here, so call this on
+	// the thread that owns the cache - GetPixelShader() only
+	// returns what was found, and is safe while recording on
+	// several threads.
+	void SetPermutation(ShaderPermutationCache* cache, ShaderPermutationKey key);
+	ShaderPermutationKey GetPermutationKey();
+
+	// Shaders + render states this material draws with
+	PipelineState* GetPipelineState();
+	void SetPipelineState(PipelineState* state);
+
+	// Surface parameters used by the IBL permutation
+	float GetRoughness();
+	float GetMetalness();
+	void SetRoughness(float r);
+	void SetMetalness(float m);
 	~Material();
 private:
 	// Wrappers for DirectX shaders to provide simplified functionality
@@ -21,5 +41,14 @@ private:
 	//For use with texturing
 	ID3D11ShaderResourceView* view;
 	ID3D11SamplerState* sample;
+
+	//Which variant of the pixel shader to use (see ShaderPermutation)
+	ShaderPermutationKey permutationKey;
+	SimplePixelShader* variant;		// Null if it couldn't be built
+
+	PipelineState* pipelineState;
+
+	float roughness;
+	float metalness;
 };
 
@@ -1,58 +1,42 @@
 #include "Mesh.h"
+#include <stdio.h>
 #include <fstream>
 #include <vector>
 
 using namespace DirectX;
 
-Mesh::Mesh(Vertex vert [], int noVertices, unsigned int indices [], int noIndices, ID3D11Device* device)
+Mesh::Mesh(Vertex vert [], int noVertices, unsigned int indices [], int noIndices, RenderDevice* device, bool positionStream)
 {
+	this->device = device;
+	vertexBuffer = 0;
+	indexBuffer = 0;
+	positionBuffer = 0;
+	wantsPositionStream = positionStream;
 	howManyIndices = noIndices;
+	ComputeBounds(noVertices, vert);
 
-	// Create the VERTEX BUFFER description -----------------------------------
-	// - The description is created on the stack because we only need
-	//    it to create the buffer.  The description is then useless.
-	D3D11_BUFFER_DESC vbd;
-	vbd.Usage = D3D11_USAGE_IMMUTABLE;
-	vbd.ByteWidth = sizeof(Vertex) * noVertices;      // number of vertices in the buffer
-	vbd.BindFlags = D3D11_BIND_VERTEX_BUFFER; // Tells DirectX this is a vertex buffer
-	vbd.CPUAccessFlags = 0;
-	vbd.MiscFlags = 0;
-	vbd.StructureByteStride = 0;
-
-	// Create the proper struct to hold the initial vertex data
-	// - This is how we put the initial data into the buffer
-	D3D11_SUBRESOURCE_DATA initialVertexData;
-	initialVertexData.pSysMem = vert;
-
-	// Actually create the buffer with the initial data
-	// - Once we do this, we'll NEVER CHANGE THE BUFFER AGAIN
-	device->CreateBuffer(&vbd, &initialVertexData, &vertexBuffer);
-
-
-
-	// Create the INDEX BUFFER description ------------------------------------
-	// - The description is created on the stack because we only need
-	//    it to create the buffer.  The description is then useless.
-	D3D11_BUFFER_DESC ibd;
-	ibd.Usage = D3D11_USAGE_IMMUTABLE;
-	ibd.ByteWidth = sizeof(int) * noIndices;       // number of indices in the buffer
-	ibd.BindFlags = D3D11_BIND_INDEX_BUFFER; // Tells DirectX this is an index buffer
-	ibd.CPUAccessFlags = 0;
-	ibd.MiscFlags = 0;
-	ibd.StructureByteStride = 0;
-
-	// Create the proper struct to hold the initial index data
-	// - This is how we put the initial data into the buffer
-	D3D11_SUBRESOURCE_DATA initialIndexData;
-	initialIndexData.pSysMem = indices;
-
-	// Actually create the buffer with the initial data
-	// - Once we do this, we'll NEVER CHANGE THE BUFFER AGAIN
-	device->CreateBuffer(&ibd, &initialIndexData, &indexBuffer);
+	// The vertex and index buffers never change after this
+	RenderBufferDesc vbd = { RENDER_BUFFER_VERTEX, RENDER_USAGE_IMMUTABLE, (unsigned int)(sizeof(Vertex) * noVertices), 0 };
+	vertexBuffer = device->CreateBuffer(vbd, vert);
+
+	RenderBufferDesc ibd = { RENDER_BUFFER_INDEX, RENDER_USAGE_IMMUTABLE, (unsigned int)(sizeof(unsigned int) * noIndices), 0 };
+	indexBuffer = device->CreateBuffer(ibd, indices);
+
+	if (wantsPositionStream)
+		CreatePositionBuffer(noVertices, vert, device);
 }
 
-Mesh::Mesh(char* fileToLoad, ID3D11Device* dev)
+Mesh::Mesh(char* fileToLoad, RenderDevice* dev, bool positionStream)
 {
+	device = dev;
+	howManyIndices = 0;
+	boundingCenter = XMFLOAT3(0, 0, 0);
+	boundingRadius = 0;
+	vertexBuffer = 0;
+	indexBuffer = 0;
+	positionBuffer = 0;
+	wantsPositionStream = positionStream;
+
 	// File input object
 	std::ifstream obj(fileToLoad);
 
@@ -65,7 +49,7 @@ Mesh::Mesh(char* fileToLoad, ID3D11Device* dev)
 	std::vector<XMFLOAT3> normals;       // Normals from the file
 	std::vector<XMFLOAT2> uvs;           // UVs from the file
 	std::vector<Vertex> verts;           // Verts we're assembling
-	std::vector<UINT> indices;           // Indices of these verts
+	std::vector<unsigned int> indices;   // Indices of these verts
 	unsigned int vertCounter = 0;        // Count of vertices/indices
 	char chars[100];                     // String for line reading
 
@@ -199,72 +183,108 @@ Mesh::Mesh(char* fileToLoad, ID3D11Device* dev)
 	CreateBuffer(vertCounter, &verts[0], &indices[0], dev);
 }
 
-ID3D11Buffer * Mesh::GetVertexBuffer()
+RenderBufferHandle Mesh::GetVertexBuffer()
 {
-	//return pointer to vertex buffer object
+	//return the vertex buffer's handle
 	return vertexBuffer;
 }
 
-ID3D11Buffer * Mesh::GetIndexBuffer()
+RenderBufferHandle Mesh::GetIndexBuffer()
 {
-	//return pointer to index buffer object
+	//return the index buffer's handle
 	return indexBuffer;
 }
 
+RenderBufferHandle Mesh::GetPositionBuffer()
+{
+	return positionBuffer;
+}
+
+void Mesh::Bind(RenderContext* context)
+{
+	context->SetVertexBuffer(0, vertexBuffer, sizeof(Vertex), 0);
+	context->SetIndexBuffer(indexBuffer);
+}
+
+void Mesh::BindPositionStream(RenderContext* context)
+{
+	// Same slot and POSITION offset (0) either way, so the input
+	// layout of a position-only vertex shader fits both
+	if (positionBuffer)
+		context->SetVertexBuffer(0, positionBuffer, sizeof(XMFLOAT3), 0);
+	else
+		context->SetVertexBuffer(0, vertexBuffer, sizeof(Vertex), 0);
+	context->SetIndexBuffer(indexBuffer);
+}
+
 int Mesh::GetIndexCount()
 {
 	//return the number of indices this mesh contains
 	return howManyIndices;
 }
 
-void Mesh::CreateBuffer(unsigned int count, Vertex* v, UINT* i, ID3D11Device* device)
+void Mesh::CreateBuffer(unsigned int count, Vertex* v, unsigned int* i, RenderDevice* device)
+{
+	// Both immutable - we'll NEVER CHANGE THE BUFFERS AGAIN
+	RenderBufferDesc vbd = { RENDER_BUFFER_VERTEX, RENDER_USAGE_IMMUTABLE, (unsigned int)(sizeof(Vertex) * count), 0 };
+	vertexBuffer = device->CreateBuffer(vbd, v);
+
+	RenderBufferDesc ibd = { RENDER_BUFFER_INDEX, RENDER_USAGE_IMMUTABLE, (unsigned int)(sizeof(unsigned int) * count), 0 };
+	indexBuffer = device->CreateBuffer(ibd, i);
+
+	if (wantsPositionStream)
+		CreatePositionBuffer(count, v, device);
+	ComputeBounds(count, v);
+}
+
+// --------------------------------------------------------
+// The sphere round the vertices' box: not the tightest, but
+// close for the boxy meshes here
+// --------------------------------------------------------
+void Mesh::ComputeBounds(unsigned int count, Vertex* v)
+{
+	boundingCenter = XMFLOAT3(0, 0, 0);
+	boundingRadius = 0;
+	if (count == 0)
+		return;
+
+	XMVECTOR minimum = XMLoadFloat3(&v[0].Position);
+	XMVECTOR maximum = minimum;
+	for (unsigned int i = 1; i < count; i++)
+	{
+		XMVECTOR position = XMLoadFloat3(&v[i].Position);
+		minimum = XMVectorMin(minimum, position);
+		maximum = XMVectorMax(maximum, position);
+	}
+	XMVECTOR center = XMVectorScale(XMVectorAdd(minimum, maximum), 0.5f);
+	XMStoreFloat3(&boundingCenter, center);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		float distance = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&v[i].Position), center)));
+		if (distance > boundingRadius)
+			boundingRadius = distance;
+	}
+}
+
+// --------------------------------------------------------
+// Copies just the positions out of the vertices into their
+// own buffer, for depth-only passes
+// --------------------------------------------------------
+void Mesh::CreatePositionBuffer(unsigned int count, Vertex* v, RenderDevice* device)
 {
-	// Create the VERTEX BUFFER description -----------------------------------
-	// - The description is created on the stack because we only need
-	//    it to create the buffer.  The description is then useless.
-	D3D11_BUFFER_DESC vbd;
-	vbd.Usage = D3D11_USAGE_IMMUTABLE;
-	vbd.ByteWidth = sizeof(Vertex) * count;      // number of vertices in the buffer
-	vbd.BindFlags = D3D11_BIND_VERTEX_BUFFER; // Tells DirectX this is a vertex buffer
-	vbd.CPUAccessFlags = 0;
-	vbd.MiscFlags = 0;
-	vbd.StructureByteStride = 0;
-
-	// Create the proper struct to hold the initial vertex data
-	// - This is how we put the initial data into the buffer
-	D3D11_SUBRESOURCE_DATA initialVertexData;
-	initialVertexData.pSysMem = v;
-
-	// Actually create the buffer with the initial data
-	// - Once we do this, we'll NEVER CHANGE THE BUFFER AGAIN
-	device->CreateBuffer(&vbd, &initialVertexData, &vertexBuffer);
-
-
-
-	// Create the INDEX BUFFER description ------------------------------------
-	// - The description is created on the stack because we only need
-	//    it to create the buffer.  The description is then useless.
-	D3D11_BUFFER_DESC ibd;
-	ibd.Usage = D3D11_USAGE_IMMUTABLE;
-	ibd.ByteWidth = sizeof(int) * count;       // number of indices in the buffer
-	ibd.BindFlags = D3D11_BIND_INDEX_BUFFER; // Tells DirectX this is an index buffer
-	ibd.CPUAccessFlags = 0;
-	ibd.MiscFlags = 0;
-	ibd.StructureByteStride = 0;
-
-	// Create the proper struct to hold the initial index data
-	// - This is how we put the initial data into the buffer
-	D3D11_SUBRESOURCE_DATA initialIndexData;
-	initialIndexData.pSysMem = i;
-
-	// Actually create the buffer with the initial data
-	// - Once we do this, we'll NEVER CHANGE THE BUFFER AGAIN
-	device->CreateBuffer(&ibd, &initialIndexData, &indexBuffer);
+	std::vector<XMFLOAT3> positions(count);
+	for (unsigned int i = 0; i < count; i++)
+		positions[i] = v[i].Position;
+
+	RenderBufferDesc pbd = { RENDER_BUFFER_VERTEX, RENDER_USAGE_IMMUTABLE, (unsigned int)(sizeof(XMFLOAT3) * count), 0 };
+	positionBuffer = device->CreateBuffer(pbd, &positions[0]);
 }
 
 Mesh::~Mesh()
 {
 	//release stuff here
-	if (vertexBuffer) { vertexBuffer->Release(); }
-	if (indexBuffer) { indexBuffer->Release(); }
+	if (vertexBuffer) { device->ReleaseBuffer(vertexBuffer); }
+	if (indexBuffer) { device->ReleaseBuffer(indexBuffer); }
+	if (positionBuffer) { device->ReleaseBuffer(positionBuffer); }
 }
@@ -1,34 +1,61 @@
 #pragma once
 
-#include "DXCore.h"
+#include "RenderDevice.h"
 #include "Vertex.h"
-#include <d3d11.h>
 #include <DirectXMath.h>
 
+// --------------------------------------------------------
+// Geometry on the GPU: the full interleaved Vertex stream for
+// shading passes, and optionally a tightly packed copy of just
+// the positions (12 bytes a vertex instead of 32) for passes
+// that only need depth - shadows, depth prepasses.  The split
+// is made once, when the mesh is imported.
+//
+// The buffers are created through a RenderDevice, so a mesh
+// works with any backend.
+// --------------------------------------------------------
 class Mesh
 {
 public:
-	Mesh(Vertex vert [], int noVertices, unsigned int indices [], int noIndices, ID3D11Device* device);
-	Mesh(char* fileToLoad, ID3D11Device* dev);
+	// positionStream - Also make the position-only stream
+	Mesh(Vertex vert [], int noVertices, unsigned int indices [], int noIndices, RenderDevice* device, bool positionStream = true);
+	Mesh(char* fileToLoad, RenderDevice* dev, bool positionStream = true);
 
-	ID3D11Buffer * GetVertexBuffer();
-	ID3D11Buffer * GetIndexBuffer();
+	RenderBufferHandle GetVertexBuffer();
+	RenderBufferHandle GetIndexBuffer();
+
+	// Positions only (0 if the mesh has no position stream)
+	RenderBufferHandle GetPositionBuffer();
+
+	// Binds the full vertices and the indices
+	void Bind(RenderContext* context);
+
+	// Binds whatever a depth-only pass needs: the position
+	// stream if there is one, the full vertices otherwise
+	void BindPositionStream(RenderContext* context);
 
 	int GetIndexCount();
 
-	void CreateBuffer(unsigned int count, Vertex* v, UINT* i, ID3D11Device* device);
+	// A sphere round every vertex, in model space (for culling)
+	DirectX::XMFLOAT3 GetBoundingCenter() { return boundingCenter; }
+	float GetBoundingRadius() { return boundingRadius; }
+
+	void CreateBuffer(unsigned int count, Vertex* v, unsigned int* i, RenderDevice* device);
 
 	~Mesh();
 
 private:
-	ID3D11Buffer* vertexBuffer;
-	ID3D11Buffer* indexBuffer;
-
-	//some new things for Image-Based Lighting
-	ID3D11ShaderResourceView* irradianceCubeMap;
-	float metalness;
-	float roughness;
+	RenderDevice* device;
+	RenderBufferHandle vertexBuffer;
+	RenderBufferHandle indexBuffer;
+	RenderBufferHandle positionBuffer;
+	bool wantsPositionStream;
 
 	int howManyIndices;
+	DirectX::XMFLOAT3 boundingCenter;
+	float boundingRadius;
+
+	void CreatePositionBuffer(unsigned int count, Vertex* v, RenderDevice* device);
+	void ComputeBounds(unsigned int count, Vertex* v);
 };
 
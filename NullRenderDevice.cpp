@@ -0,0 +1,222 @@
+#include "NullRenderDevice.h"
+
+#include <string.h>
+
+NullRenderContext::NullRenderContext(NullRenderDevice* device)
+{
+	this->device = device;
+	Reset();
+}
+
+void NullRenderContext::Reset()
+{
+	commands.clear();
+	memset(counts, 0, sizeof(counts));
+	triangles = 0;
+	uploadBytes = 0;
+	invalidHandles = 0;
+}
+
+void NullRenderContext::Record(RenderCommandType type, unsigned int handle, unsigned int count)
+{
+	// 0 (unbinding) is always fine
+	if (handle && !device->IsValid(handle))
+		invalidHandles++;
+
+	RenderCommand command = { type, handle, count };
+	commands.push_back(command);
+	counts[type]++;
+}
+
+void NullRenderContext::SetPipeline(RenderPipelineHandle pipeline)
+{
+	Record(RENDER_COMMAND_SET_PIPELINE, pipeline, 0);
+}
+
+void NullRenderContext::SetVertexBuffer(int slot, RenderBufferHandle buffer, unsigned int /*stride*/, unsigned int /*offset*/)
+{
+	Record(RENDER_COMMAND_SET_VERTEX_BUFFER, buffer, slot);
+}
+
+void NullRenderContext::SetIndexBuffer(RenderBufferHandle buffer)
+{
+	Record(RENDER_COMMAND_SET_INDEX_BUFFER, buffer, 0);
+}
+
+void NullRenderContext::SetConstantBuffer(RenderShaderStage /*stage*/, int slot, RenderBufferHandle buffer)
+{
+	Record(RENDER_COMMAND_SET_CONSTANT_BUFFER, buffer, slot);
+}
+
+void NullRenderContext::SetTexture(RenderShaderStage /*stage*/, int slot, RenderTextureHandle texture)
+{
+	Record(RENDER_COMMAND_SET_TEXTURE, texture, slot);
+}
+
+void NullRenderContext::SetSampler(RenderShaderStage /*stage*/, int slot, RenderSamplerHandle sampler)
+{
+	Record(RENDER_COMMAND_SET_SAMPLER, sampler, slot);
+}
+
+void NullRenderContext::UpdateBuffer(RenderBufferHandle buffer, const void* /*data*/, unsigned int size)
+{
+	Record(RENDER_COMMAND_UPDATE_BUFFER, buffer, size);
+	uploadBytes += size;
+}
+
+void NullRenderContext::UpdateTexture(RenderTextureHandle texture, int slice, const void* /*data*/, unsigned int /*rowPitch*/)
+{
+	Record(RENDER_COMMAND_UPDATE_TEXTURE, texture, slice);
+}
+
+void NullRenderContext::SetRenderTargets(const RenderTextureHandle* colors, int colorCount, RenderTextureHandle depth, int /*depthSlice*/)
+{
+	for (int c = 0; c < colorCount; c++)
+	{
+		if (colors[c] && !device->IsValid(colors[c]))
+			invalidHandles++;
+	}
+	Record(RENDER_COMMAND_SET_RENDER_TARGETS, depth, colorCount);
+}
+
+void NullRenderContext::SetViewport(float /*x*/, float /*y*/, float /*width*/, float /*height*/)
+{
+	Record(RENDER_COMMAND_SET_VIEWPORT, 0, 0);
+}
+
+void NullRenderContext::ClearRenderTarget(RenderTextureHandle texture, const float /*color*/[4])
+{
+	Record(RENDER_COMMAND_CLEAR_RENDER_TARGET, texture, 0);
+}
+
+void NullRenderContext::ClearDepth(RenderTextureHandle texture, float /*depth*/, int slice)
+{
+	Record(RENDER_COMMAND_CLEAR_DEPTH, texture, slice);
+}
+
+void NullRenderContext::Draw(unsigned int vertexCount, unsigned int /*startVertex*/)
+{
+	Record(RENDER_COMMAND_DRAW, 0, vertexCount);
+	triangles += vertexCount / 3;
+}
+
+void NullRenderContext::DrawIndexed(unsigned int indexCount, unsigned int /*startIndex*/, int /*baseVertex*/)
+{
+	Record(RENDER_COMMAND_DRAW_INDEXED, 0, indexCount);
+	triangles += indexCount / 3;
+}
+
+NullRenderDevice::NullRenderDevice()
+{
+	nextHandle = 1;
+	bufferBytes = 0;
+	textureBytes = 0;
+	peakBytes = 0;
+	immediate = new NullRenderContext(this);
+}
+
+NullRenderDevice::~NullRenderDevice()
+{
+	delete immediate;
+	for (size_t c = 0; c < contexts.size(); c++)
+		delete contexts[c];
+}
+
+NullRenderContext* NullRenderDevice::CreateContext()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	contexts.push_back(new NullRenderContext(this));
+	return contexts.back();
+}
+
+unsigned int NullRenderDevice::Add(ResourceKind kind, unsigned long long bytes)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	unsigned int handle = nextHandle++;
+	Resource resource = { kind, bytes };
+	resources[handle] = resource;
+
+	if (kind == RESOURCE_BUFFER)
+		bufferBytes += bytes;
+	else if (kind == RESOURCE_TEXTURE)
+		textureBytes += bytes;
+	if (bufferBytes + textureBytes > peakBytes)
+		peakBytes = bufferBytes + textureBytes;
+	return handle;
+}
+
+void NullRenderDevice::Remove(unsigned int handle)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::map<unsigned int, Resource>::iterator found = resources.find(handle);
+	if (found == resources.end())
+		return;
+
+	if (found->second.Kind == RESOURCE_BUFFER)
+		bufferBytes -= found->second.Bytes;
+	else if (found->second.Kind == RESOURCE_TEXTURE)
+		textureBytes -= found->second.Bytes;
+	resources.erase(found);
+}
+
+bool NullRenderDevice::IsValid(unsigned int handle)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return resources.find(handle) != resources.end();
+}
+
+int NullRenderDevice::GetLiveCount()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return (int)resources.size();
+}
+
+unsigned long long NullRenderDevice::GetTextureSize(const RenderTextureDesc& desc)
+{
+	unsigned long long texelBytes = 4;
+	if (desc.Format == RENDER_FORMAT_RGBA16_FLOAT)
+		texelBytes = 8;
+
+	unsigned long long bytes = 0;
+	int width = desc.Width;
+	int height = desc.Height;
+	int mips = desc.MipLevels > 0 ? desc.MipLevels : 1;
+	for (int m = 0; m < mips; m++)
+	{
+		bytes += (unsigned long long)width * height * texelBytes;
+		width = width > 1 ? width / 2 : 1;
+		height = height > 1 ? height / 2 : 1;
+	}
+	return bytes * (desc.ArraySize > 0 ? desc.ArraySize : 1);
+}
+
+RenderBufferHandle NullRenderDevice::CreateBuffer(const RenderBufferDesc& desc, const void* /*initialData*/)
+{
+	return Add(RESOURCE_BUFFER, desc.ByteWidth);
+}
+
+RenderTextureHandle NullRenderDevice::CreateTexture(const RenderTextureDesc& desc)
+{
+	return Add(RESOURCE_TEXTURE, GetTextureSize(desc));
+}
+
+RenderShaderHandle NullRenderDevice::CreateShader(RenderShaderStage /*stage*/, const char* /*name*/, const void* /*bytecode*/, size_t size)
+{
+	return Add(RESOURCE_SHADER, size);
+}
+
+RenderPipelineHandle NullRenderDevice::CreatePipeline(const RenderPipelineDesc& /*desc*/)
+{
+	return Add(RESOURCE_PIPELINE, 0);
+}
+
+RenderSamplerHandle NullRenderDevice::CreateSampler(const RenderSamplerDesc& /*desc*/)
+{
+	return Add(RESOURCE_SAMPLER, 0);
+}
+
+void NullRenderDevice::ReleaseBuffer(RenderBufferHandle buffer) { Remove(buffer); }
+void NullRenderDevice::ReleaseTexture(RenderTextureHandle texture) { Remove(texture); }
+void NullRenderDevice::ReleaseShader(RenderShaderHandle shader) { Remove(shader); }
+void NullRenderDevice::ReleasePipeline(RenderPipelineHandle pipeline) { Remove(pipeline); }
+void NullRenderDevice::ReleaseSampler(RenderSamplerHandle sampler) { Remove(sampler); }
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "RenderDevice.h"
+
+enum RenderCommandType
+{
+	RENDER_COMMAND_SET_PIPELINE,
+	RENDER_COMMAND_SET_VERTEX_BUFFER,
+	RENDER_COMMAND_SET_INDEX_BUFFER,
+	RENDER_COMMAND_SET_CONSTANT_BUFFER,
+	RENDER_COMMAND_SET_TEXTURE,
+	RENDER_COMMAND_SET_SAMPLER,
+	RENDER_COMMAND_UPDATE_BUFFER,
+	RENDER_COMMAND_UPDATE_TEXTURE,
+	RENDER_COMMAND_SET_RENDER_TARGETS,
+	RENDER_COMMAND_SET_VIEWPORT,
+	RENDER_COMMAND_CLEAR_RENDER_TARGET,
+	RENDER_COMMAND_CLEAR_DEPTH,
+	RENDER_COMMAND_DRAW,
+	RENDER_COMMAND_DRAW_INDEXED,
+
+	RENDER_COMMAND_TYPE_COUNT
+};
+
+// One recorded call.  Handle is the resource it names (the
+// depth target for SetRenderTargets), Count is vertices or
+// indices for draws, bytes for buffer updates, the slice for
+// texture updates and the slot for binds.
+struct RenderCommand
+{
+	RenderCommandType Type;
+	unsigned int Handle;
+	unsigned int Count;
+};
+
+class NullRenderDevice;
+
+// --------------------------------------------------------
+// Records calls instead of drawing.  Each context keeps its
+// own list, so jobs can record on their own contexts in
+// parallel.
+// --------------------------------------------------------
+class NullRenderContext : public RenderContext
+{
+public:
+	NullRenderContext(NullRenderDevice* device);
+
+	void SetPipeline(RenderPipelineHandle pipeline);
+	void SetVertexBuffer(int slot, RenderBufferHandle buffer, unsigned int stride, unsigned int offset);
+	void SetIndexBuffer(RenderBufferHandle buffer);
+	void SetConstantBuffer(RenderShaderStage stage, int slot, RenderBufferHandle buffer);
+	void SetTexture(RenderShaderStage stage, int slot, RenderTextureHandle texture);
+	void SetSampler(RenderShaderStage stage, int slot, RenderSamplerHandle sampler);
+	void UpdateBuffer(RenderBufferHandle buffer, const void* data, unsigned int size);
+	void UpdateTexture(RenderTextureHandle texture, int slice, const void* data, unsigned int rowPitch);
+	void SetRenderTargets(const RenderTextureHandle* colors, int colorCount, RenderTextureHandle depth, int depthSlice = 0);
+	void SetViewport(float x, float y, float width, float height);
+	void ClearRenderTarget(RenderTextureHandle texture, const float color[4]);
+	void ClearDepth(RenderTextureHandle texture, float depth, int slice = 0);
+	void Draw(unsigned int vertexCount, unsigned int startVertex);
+	void DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex);
+
+	// What's been recorded since the last Reset()
+	void Reset();
+	const std::vector<RenderCommand>& GetCommands() { return commands; }
+	unsigned int GetCount(RenderCommandType type) { return counts[type]; }
+	unsigned int GetDrawCount() { return counts[RENDER_COMMAND_DRAW] + counts[RENDER_COMMAND_DRAW_INDEXED]; }
+	unsigned long long GetTriangleCount() { return triangles; }
+	unsigned long long GetUploadBytes() { return uploadBytes; }
+	unsigned int GetInvalidHandles() { return invalidHandles; }	// Calls naming released / unknown resources
+
+private:
+	NullRenderDevice* device;
+	std::vector<RenderCommand> commands;
+	unsigned int counts[RENDER_COMMAND_TYPE_COUNT];
+	unsigned long long triangles;
+	unsigned long long uploadBytes;
+	unsigned int invalidHandles;
+
+	void Record(RenderCommandType type, unsigned int handle, unsigned int count);
+};
+
+// --------------------------------------------------------
+// A device with no GPU behind it: resources are just handles
+// and sizes, and contexts record what's issued.  For running
+// whole frames headless - CPU profiling, counting allocations
+// and draw-count regression checks.
+// --------------------------------------------------------
+class NullRenderDevice : public RenderDevice
+{
+public:
+	NullRenderDevice();
+	~NullRenderDevice();
+
+	RenderBufferHandle CreateBuffer(const RenderBufferDesc& desc, const void* initialData);
+	RenderTextureHandle CreateTexture(const RenderTextureDesc& desc);
+	RenderShaderHandle CreateShader(RenderShaderStage stage, const char* name, const void* bytecode, size_t size);
+	RenderPipelineHandle CreatePipeline(const RenderPipelineDesc& desc);
+	RenderSamplerHandle CreateSampler(const RenderSamplerDesc& desc);
+
+	void ReleaseBuffer(RenderBufferHandle buffer);
+	void ReleaseTexture(RenderTextureHandle texture);
+	void ReleaseShader(RenderShaderHandle shader);
+	void ReleasePipeline(RenderPipelineHandle pipeline);
+	void ReleaseSampler(RenderSamplerHandle sampler);
+
+	RenderContext* GetImmediateContext() { return immediate; }
+	NullRenderContext* GetNullImmediateContext() { return immediate; }
+
+	// Another context to record on (owned by the device)
+	NullRenderContext* CreateContext();
+
+	// Is this a live resource?
+	bool IsValid(unsigned int handle);
+
+	// Live resources and their memory
+	int GetLiveCount();
+	unsigned long long GetBufferBytes() { return bufferBytes; }
+	unsigned long long GetTextureBytes() { return textureBytes; }
+	unsigned long long GetPeakBytes() { return peakBytes; }
+	unsigned int GetCreatedCount() { return nextHandle - 1; }	// Ever
+
+	// Bytes a texture takes (every slice and mip)
+	static unsigned long long GetTextureSize(const RenderTextureDesc& desc);
+
+private:
+	enum ResourceKind
+	{
+		RESOURCE_BUFFER,
+		RESOURCE_TEXTURE,
+		RESOURCE_SHADER,
+		RESOURCE_PIPELINE,
+		RESOURCE_SAMPLER
+	};
+
+	struct Resource
+	{
+		ResourceKind Kind;
+		unsigned long long Bytes;
+	};
+
+	std::mutex mutex;
+	std::map<unsigned int, Resource> resources;
+	unsigned int nextHandle;
+	unsigned long long bufferBytes;
+	unsigned long long textureBytes;
+	unsigned long long peakBytes;
+
+	NullRenderContext* immediate;
+	std::vector<NullRenderContext*> contexts;
+
+	unsigned int Add(ResourceKind kind, unsigned long long bytes);
+	void Remove(unsigned int handle);
+};
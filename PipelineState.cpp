@@ -0,0 +1,310 @@
+#include "PipelineState.h"
+
+#include <string.h>
+
+// --------------------------------------------------------
+// The D3D11 default states (same as CD3D11_*_DESC(D3D11_DEFAULT))
+// with no shaders and a triangle list
+// --------------------------------------------------------
+PipelineStateDesc PipelineStateDesc::Default()
+{
+	PipelineStateDesc desc;
+	memset(&desc, 0, sizeof(desc));
+
+	desc.Rasterizer.FillMode = D3D11_FILL_SOLID;
+	desc.Rasterizer.CullMode = D3D11_CULL_BACK;
+	desc.Rasterizer.DepthClipEnable = true;
+
+	for (unsigned int i = 0; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i++)
+	{
+		desc.Blend.RenderTarget[i].SrcBlend = D3D11_BLEND_ONE;
+		desc.Blend.RenderTarget[i].DestBlend = D3D11_BLEND_ZERO;
+		desc.Blend.RenderTarget[i].BlendOp = D3D11_BLEND_OP_ADD;
+		desc.Blend.RenderTarget[i].SrcBlendAlpha = D3D11_BLEND_ONE;
+		desc.Blend.RenderTarget[i].DestBlendAlpha = D3D11_BLEND_ZERO;
+		desc.Blend.RenderTarget[i].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+		desc.Blend.RenderTarget[i].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+	}
+
+	desc.DepthStencil.DepthEnable = true;
+	desc.DepthStencil.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ALL;
+	desc.DepthStencil.DepthFunc = D3D11_COMPARISON_LESS;
+	desc.DepthStencil.StencilReadMask = D3D11_DEFAULT_STENCIL_READ_MASK;
+	desc.DepthStencil.StencilWriteMask = D3D11_DEFAULT_STENCIL_WRITE_MASK;
+	D3D11_DEPTH_STENCILOP_DESC stencilOp = { D3D11_STENCIL_OP_KEEP, D3D11_STENCIL_OP_KEEP, D3D11_STENCIL_OP_KEEP, D3D11_COMPARISON_ALWAYS };
+	desc.DepthStencil.FrontFace = stencilOp;
+	desc.DepthStencil.BackFace = stencilOp;
+
+	desc.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	return desc;
+}
+
+PipelineState::PipelineState()
+{
+	hash = 0;
+	rasterizerState = 0;
+	blendState = 0;
+	depthStencilState = 0;
+}
+
+PipelineState::~PipelineState()
+{
+	if (rasterizerState) rasterizerState->Release();
+	if (blendState) blendState->Release();
+	if (depthStencilState) depthStencilState->Release();
+}
+
+PipelineStateCache::PipelineStateCache(ID3D11Device* device, ID3D11DeviceContext* context)
+{
+	this->device = device;
+	this->context = context;
+	callsIssued = 0;
+	callsSkipped = 0;
+	Invalidate();
+}
+
+PipelineStateCache::~PipelineStateCache()
+{
+	for (unsigned int i = 0; i < states.size(); i++)
+		delete states[i];
+}
+
+// --------------------------------------------------------
+// Flattens a desc into 32-bit words, field by field.  Going
+// through the fields (rather than hashing the raw structs)
+// keeps struct padding out of the hash and the comparison.
+// --------------------------------------------------------
+void PipelineStateCache::BuildKey(const PipelineStateDesc& desc, std::vector<uint32_t>& key)
+{
+	key.clear();
+
+	uint64_t vs = (uint64_t)(uintptr_t)desc.VertexShader;
+	uint64_t ps = (uint64_t)(uintptr_t)desc.PixelShader;
+	key.push_back((uint32_t)vs);
+	key.push_back((uint32_t)(vs >> 32));
+	key.push_back((uint32_t)ps);
+	key.push_back((uint32_t)(ps >> 32));
+
+	const D3D11_RASTERIZER_DESC& rs = desc.Rasterizer;
+	float biasClamp = rs.DepthBiasClamp;
+	float slopeBias = rs.SlopeScaledDepthBias;
+	uint32_t biasClampBits, slopeBiasBits;
+	memcpy(&biasClampBits, &biasClamp, sizeof(uint32_t));
+	memcpy(&slopeBiasBits, &slopeBias, sizeof(uint32_t));
+	key.push_back(rs.FillMode);
+	key.push_back(rs.CullMode);
+	key.push_back(rs.FrontCounterClockwise ? 1 : 0);
+	key.push_back((uint32_t)rs.DepthBias);
+	key.push_back(biasClampBits);
+	key.push_back(slopeBiasBits);
+	key.push_back(rs.DepthClipEnable ? 1 : 0);
+	key.push_back(rs.ScissorEnable ? 1 : 0);
+	key.push_back(rs.MultisampleEnable ? 1 : 0);
+	key.push_back(rs.AntialiasedLineEnable ? 1 : 0);
+
+	const D3D11_BLEND_DESC& bs = desc.Blend;
+	key.push_back(bs.AlphaToCoverageEnable ? 1 : 0);
+	key.push_back(bs.IndependentBlendEnable ? 1 : 0);
+	unsigned int targets = bs.IndependentBlendEnable ? D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT : 1;
+	for (unsigned int i = 0; i < targets; i++)
+	{
+		const D3D11_RENDER_TARGET_BLEND_DESC& rt = bs.RenderTarget[i];
+		key.push_back(rt.BlendEnable ? 1 : 0);
+		key.push_back(rt.SrcBlend);
+		key.push_back(rt.DestBlend);
+		key.push_back(rt.BlendOp);
+		key.push_back(rt.SrcBlendAlpha);
+		key.push_back(rt.DestBlendAlpha);
+		key.push_back(rt.BlendOpAlpha);
+		key.push_back(rt.RenderTargetWriteMask);
+	}
+
+	const D3D11_DEPTH_STENCIL_DESC& ds = desc.DepthStencil;
+	key.push_back(ds.DepthEnable ? 1 : 0);
+	key.push_back(ds.DepthWriteMask);
+	key.push_back(ds.DepthFunc);
+	key.push_back(ds.StencilEnable ? 1 : 0);
+	key.push_back(ds.StencilReadMask);
+	key.push_back(ds.StencilWriteMask);
+	const D3D11_DEPTH_STENCILOP_DESC* faces[2] = { &ds.FrontFace, &ds.BackFace };
+	for (unsigned int i = 0; i < 2; i++)
+	{
+		key.push_back(faces[i]->StencilFailOp);
+		key.push_back(faces[i]->StencilDepthFailOp);
+		key.push_back(faces[i]->StencilPassOp);
+		key.push_back(faces[i]->StencilFunc);
+	}
+
+	key.push_back(desc.Topology);
+	key.push_back(desc.StencilRef);
+}
+
+// --------------------------------------------------------
+// 64-bit FNV-1a over the key words
+// --------------------------------------------------------
+uint64_t PipelineStateCache::HashKey(const std::vector<uint32_t>& key)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned int i = 0; i < key.size(); i++)
+	{
+		for (unsigned int b = 0; b < 4; b++)
+		{
+			hash ^= (key[i] >> (b * 8)) & 0xFF;
+			hash *= 1099511628211ULL;
+		}
+	}
+	return hash;
+}
+
+// --------------------------------------------------------
+// Finds or creates the pipeline state for a desc
+//
+// Returns null if D3D couldn't create one of the states
+// --------------------------------------------------------
+PipelineState* PipelineStateCache::GetPipelineState(const PipelineStateDesc& desc)
+{
+	std::vector<uint32_t> key;
+	BuildKey(desc, key);
+	uint64_t hash = HashKey(key);
+
+	// Same hash - make sure it's really the same desc
+	std::vector<PipelineState*>& bucket = lookup[hash];
+	for (unsigned int i = 0; i < bucket.size(); i++)
+	{
+		if (bucket[i]->key == key)
+			return bucket[i];
+	}
+
+	PipelineState* state = new PipelineState();
+	state->desc = desc;
+	state->key = key;
+	state->hash = hash;
+
+	// D3D also shares state objects with identical descs, so
+	// states that only differ in shaders don't duplicate these
+	if (FAILED(device->CreateRasterizerState(&desc.Rasterizer, &state->rasterizerState)) ||
+		FAILED(device->CreateBlendState(&desc.Blend, &state->blendState)) ||
+		FAILED(device->CreateDepthStencilState(&desc.DepthStencil, &state->depthStencilState)))
+	{
+		delete state;
+		return 0;
+	}
+
+	bucket.push_back(state);
+	states.push_back(state);
+	return state;
+}
+
+// --------------------------------------------------------
+// Forgets what's bound, so the next Apply() sets everything
+// --------------------------------------------------------
+void PipelineStateCache::Invalidate()
+{
+	valid = false;
+	boundVS = 0;
+	boundPS = 0;
+	boundLayout = 0;
+	boundRasterizer = 0;
+	boundBlend = 0;
+	boundDepthStencil = 0;
+	boundStencilRef = 0;
+	boundTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+}
+
+// --------------------------------------------------------
+// Binds a pipeline state, only issuing calls for what differs
+// from the currently bound one.  A shader's constant buffers
+// are rebound along with the shader, since other shaders may
+// have used the same slots in between.
+// --------------------------------------------------------
+void PipelineStateCache::Apply(PipelineState* state)
+{
+	const PipelineStateDesc& desc = state->desc;
+	SimpleVertexShader* vs = desc.VertexShader;
+	SimplePixelShader* ps = desc.PixelShader;
+	ID3D11InputLayout* layout = vs ? vs->GetInputLayout() : 0;
+
+	if (!valid || vs != boundVS)
+	{
+		context->VSSetShader(vs ? vs->GetDirectXShader() : 0, 0, 0);
+		if (vs) vs->SetConstantBuffers();
+		boundVS = vs;
+		callsIssued++;
+	}
+	else callsSkipped++;
+
+	if (!valid || layout != boundLayout)
+	{
+		context->IASetInputLayout(layout);
+		boundLayout = layout;
+		callsIssued++;
+	}
+	else callsSkipped++;
+
+	if (!valid || ps != boundPS)
+	{
+		context->PSSetShader(ps ? ps->GetDirectXShader() : 0, 0, 0);
+		if (ps) ps->SetConstantBuffers();
+		boundPS = ps;
+		callsIssued++;
+	}
+	else callsSkipped++;
+
+	if (!valid || state->rasterizerState != boundRasterizer)
+	{
+		context->RSSetState(state->rasterizerState);
+		boundRasterizer = state->rasterizerState;
+		callsIssued++;
+	}
+	else callsSkipped++;
+
+	if (!valid || state->blendState != boundBlend)
+	{
+		context->OMSetBlendState(state->blendState, 0, 0xFFFFFFFF);
+		boundBlend = state->blendState;
+		callsIssued++;
+	}
+	else callsSkipped++;
+
+	if (!valid || state->depthStencilState != boundDepthStencil || desc.StencilRef != boundStencilRef)
+	{
+		context->OMSetDepthStencilState(state->depthStencilState, desc.StencilRef);
+		boundDepthStencil = state->depthStencilState;
+		boundStencilRef = desc.StencilRef;
+		callsIssued++;
+	}
+	else callsSkipped++;
+
+	if (!valid || desc.Topology != boundTopology)
+	{
+		context->IASetPrimitiveTopology(desc.Topology);
+		boundTopology = desc.Topology;
+		callsIssued++;
+	}
+	else callsSkipped++;
+
+	valid = true;
+}
+
+// --------------------------------------------------------
+// Binds everything in a state on the given context.  Doesn't
+// touch the cache, so it's safe on any thread with its own
+// context - a deferred context starts with nothing bound, so
+// there's nothing to diff against anyway.
+// --------------------------------------------------------
+void PipelineStateCache::Bind(PipelineState* state, ID3D11DeviceContext* context)
+{
+	const PipelineStateDesc& desc = state->desc;
+	SimpleVertexShader* vs = desc.VertexShader;
+	SimplePixelShader* ps = desc.PixelShader;
+
+	context->VSSetShader(vs ? vs->GetDirectXShader() : 0, 0, 0);
+	if (vs) vs->SetConstantBuffers(context);
+	context->IASetInputLayout(vs ? vs->GetInputLayout() : 0);
+	context->PSSetShader(ps ? ps->GetDirectXShader() : 0, 0, 0);
+	if (ps) ps->SetConstantBuffers(context);
+	context->RSSetState(state->rasterizerState);
+	context->OMSetBlendState(state->blendState, 0, 0xFFFFFFFF);
+	context->OMSetDepthStencilState(state->depthStencilState, desc.StencilRef);
+	context->IASetPrimitiveTopology(desc.Topology);
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <d3d11.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+#include "SimpleShader.h"
+
+// --------------------------------------------------------
+// Everything needed to describe a pipeline state.  Start from
+// PipelineStateDesc::Default() (the D3D11 defaults plus a
+// triangle list) and change what you need.
+// --------------------------------------------------------
+struct PipelineStateDesc
+{
+	SimpleVertexShader* VertexShader;
+	SimplePixelShader* PixelShader;		// Null for depth-only passes
+	D3D11_RASTERIZER_DESC Rasterizer;
+	D3D11_BLEND_DESC Blend;
+	D3D11_DEPTH_STENCIL_DESC DepthStencil;
+	D3D11_PRIMITIVE_TOPOLOGY Topology;
+	UINT StencilRef;
+
+	static PipelineStateDesc Default();
+};
+
+// --------------------------------------------------------
+// An immutable bundle of shaders, input layout, render states
+// and topology.  Only PipelineStateCache creates these, so two
+// identical descriptions always give the same object.
+// --------------------------------------------------------
+class PipelineState
+{
+public:
+	const PipelineStateDesc& GetDesc() { return desc; }
+	uint64_t GetHash() { return hash; }
+
+	SimpleVertexShader* GetVertexShader() { return desc.VertexShader; }
+	SimplePixelShader* GetPixelShader() { return desc.PixelShader; }
+	ID3D11RasterizerState* GetRasterizerState() { return rasterizerState; }
+	ID3D11BlendState* GetBlendState() { return blendState; }
+	ID3D11DepthStencilState* GetDepthStencilState() { return depthStencilState; }
+
+private:
+	friend class PipelineStateCache;
+
+	PipelineState();
+	~PipelineState();
+
+	PipelineStateDesc desc;
+	std::vector<uint32_t> key;	// Flattened desc (hashed and compared)
+	uint64_t hash;
+
+	ID3D11RasterizerState* rasterizerState;
+	ID3D11BlendState* blendState;
+	ID3D11DepthStencilState* depthStencilState;
+};
+
+// --------------------------------------------------------
+// Creates and deduplicates pipeline states, and binds them.
+//
+// Binding is diffed against what this cache last bound, so
+// switching between states that share shaders or render states
+// only issues the calls for the parts that changed.  If other
+// code changes pipeline state behind its back, call
+// Invalidate() so the next Apply() sets everything.
+// --------------------------------------------------------
+class PipelineStateCache
+{
+public:
+	PipelineStateCache(ID3D11Device* device, ID3D11DeviceContext* context);
+	~PipelineStateCache();
+
+	// Returns the existing state for an identical desc, or creates it
+	PipelineState* GetPipelineState(const PipelineStateDesc& desc);
+
+	// Binds the state, skipping anything that's already bound
+	void Apply(PipelineState* state);
+	void Invalidate();
+
+	// Binds all of a state on another context (e.g. a deferred
+	// one recording on a worker), without the cache's diffing
+	static void Bind(PipelineState* state, ID3D11DeviceContext* context);
+
+	// Stats
+	unsigned int GetStateCount() { return (unsigned int)states.size(); }
+	unsigned int GetCallsIssued() { return callsIssued; }
+	unsigned int GetCallsSkipped() { return callsSkipped; }
+	void ResetStats() { callsIssued = 0; callsSkipped = 0; }
+
+private:
+	ID3D11Device* device;
+	ID3D11DeviceContext* context;
+
+	std::unordered_map<uint64_t, std::vector<PipelineState*> > lookup;
+	std::vector<PipelineState*> states;
+
+	// What's currently bound (valid == false means unknown)
+	bool valid;
+	SimpleVertexShader* boundVS;
+	SimplePixelShader* boundPS;
+	ID3D11InputLayout* boundLayout;
+	ID3D11RasterizerState* boundRasterizer;
+	ID3D11BlendState* boundBlend;
+	ID3D11DepthStencilState* boundDepthStencil;
+	UINT boundStencilRef;
+	D3D11_PRIMITIVE_TOPOLOGY boundTopology;
+
+	unsigned int callsIssued;
+	unsigned int callsSkipped;
+
+	static void BuildKey(const PipelineStateDesc& desc, std::vector<uint32_t>& key);
+	static uint64_t HashKey(const std::vector<uint32_t>& key);
+};
@@ -1,4 +1,31 @@
-//#include "CommonVars.hlsl"
+// Permutation features - the C++ side (ShaderPermutation) passes these
+// as defines when it compiles a variant.  The defaults below match the
+// build-time PixelShader.cso, which is what the scene draws with: two
+// directional lights, shadows, fog, image based lighting and clustered
+// lights.
+// Everything a variant doesn't use is compiled out, not branched over.
+#ifndef LIGHT_COUNT
+#define LIGHT_COUNT 2
+#endif
+#ifndef SHADOWS
+#define SHADOWS 1
+#endif
+#ifndef FOG
+#define FOG 1
+#endif
+#ifndef NORMAL_MAP
+#define NORMAL_MAP 0
+#endif
+#ifndef IBL
+#define IBL 1
+#endif
+#ifndef CLUSTERED
+#define CLUSTERED 1
+#endif
+
+#if IBL
+#include "CommonVars.hlsli"
+#endif
 
 // Struct representing the data we expect to receive from earlier pipeline stages
 // - Should match the output of our corresponding vertex shader
@@ -12,7 +39,6 @@ struct VertexToPixel
 	//  |   Name          Semantic
 	//  |    |                |
 	//  v    v                v
-	float4 posForShadow : TEXCOORD0;
 	float4 position		: SV_POSITION;
 	float4 worldSpace   : TEXCOORD1;
 	float3 normal       : NORMAL;
@@ -24,13 +50,60 @@ struct VertexToPixel
 //Globals
 TextureCube Sky            : register(t0);
 Texture2D diffuseTexture   : register(t1);
-Texture2D ShadowMap        : register(t2);
-//TextureCube IrradianceMap  : register(t3);
-//TextureCube RadianceMap    : register(t4); //the PMREM that will be generated in code
-//Texture2D IntegrationMap   : register(t5); //2D LUT used to integrate any BRDF with the PMREM
+#if SHADOWS
+Texture2DArray ShadowMap   : register(t2); //one slice per cascade
+#endif
+#if NORMAL_MAP
+Texture2D NormalMap        : register(t3);
+#endif
+#if SHADOWS
+Texture2D SpotShadowAtlas  : register(t4); //spot lights' shadows, one tile each (ShadowAtlas)
+#endif
+#if IBL
+TextureCube RadianceMap    : register(t5); //the PMREM that will be generated in code
+Texture2D IntegrationMap   : register(t6); //2D LUT used to integrate any BRDF with the PMREM
+TextureCube PreviousRadianceMap : register(t7); //the PMREM being blended out (see EnvironmentCapture)
+#endif
 SamplerState basicSampler  : register(s0);
+#if SHADOWS
 SamplerComparisonState ShadowSampler  : register(s1);
 
+// Cascaded shadow maps, fitted on the CPU each frame (ShadowCascades).
+// Up to SHADOW_MAX_CASCADES (4), nearest first.
+cbuffer shadowData : register(b3)
+{
+	matrix cascadeViewProjection[4];
+	float4 cascadeSplits;	// View space depth where each cascade ends
+	int cascadeCount;
+};
+#endif
+
+#if CLUSTERED
+// Any number of unshadowed point and spot lights, binned into a grid
+// of clusters over the view on the CPU (LightClusterGrid).  Each
+// cluster has a range of ClusterLightIndices, which index ClusteredLights.
+struct ClusteredLight
+{
+	float3 Position;
+	float Range;
+	float3 Color;
+	float CosOuterAngle;	//-1 for point lights
+	float3 Direction;
+	float CosInnerAngle;
+};
+StructuredBuffer<ClusteredLight> ClusteredLights : register(t8);
+StructuredBuffer<uint2> ClusterRanges           : register(t9); //offset, count
+StructuredBuffer<uint> ClusterLightIndices      : register(t10);
+
+cbuffer clusterData : register(b5)
+{
+	uint3 clusterCounts;		// Tiles across, down, and depth slices
+	float clusterSliceScale;	// slice = log2(viewDepth) * scale + bias
+	float2 clusterTileSize;		// In pixels
+	float clusterSliceBias;
+};
+#endif
+
 //A new directional light
 //we don't need semantics
 struct DirectionalLight
@@ -38,19 +111,27 @@ struct DirectionalLight
 	float4 AmbientColor;
 	float4 DiffuseColor;
 	float3 Direction;
-	//float nope;
 };
 
 //NEW light that needs its own shadowing
-/*struct SpotLight
+struct SpotLight
 {
-	float4 AmbientColor;
 	float4 DiffuseColor;
 	float3 Position;
-	float DiffuseIntensity;
-	float3 Direction;
-	float nope;
-};*/
+	float Range;			//light fades out to nothing here
+	float3 Direction;		//normalized
+	float CosOuterAngle;	//cone edge
+	float CosInnerAngle;	//full brightness inside this
+	matrix ViewProjection;	//the light's POV, for its shadow
+	float4 AtlasRect;		//its tile in the atlas, in UVs: xy = corner, zw = size (0 = no shadow)
+};
+
+// Up to MAX_SPOT_LIGHTS (4), see Lights.h
+cbuffer spotLightData : register(b4)
+{
+	SpotLight spotLights[4];
+	int spotLightCount;
+};
 
 // Constant Buffer
 // - Allows us to define a buffer of individual variables 
@@ -68,21 +149,39 @@ cbuffer externalLight : register(b0)
 	//float3 CameraPosition;
 };
 
-/*cbuffer perFrameData : register(b1)
+#if IBL
+cbuffer materialData : register(b1)
 {
 	float3 cameraPos;
-	float metalness;
 	float roughness;
-};*/
+	float metalness;
+};
 
-// Lambertian Reflectance BRDF
-// http://en.wikipedia.org/wiki/Lambertian_reflectance
-/*float3 DirectDiffuseBRDF(float3 diffuseAlbedo, float nDotL)
+// Diffuse irradiance (divided by Pi) of the environment as SH9,
+// with the basis constants already folded in (see SphericalHarmonics).
+// A freshly captured environment fades in: the SH is blended on the
+// CPU, the radiance maps by radianceBlend.
+cbuffer irradianceData : register(b2)
 {
-	return (diffuseAlbedo * nDotL) / Pi;
+	float4 irradianceSH[9];
+	float radianceBlend;	// 0 = PreviousRadianceMap, 1 = RadianceMap
+};
+
+float3 EvaluateIrradianceSH(float3 n)
+{
+	return
+		irradianceSH[0].rgb +
+		irradianceSH[1].rgb * n.y +
+		irradianceSH[2].rgb * n.z +
+		irradianceSH[3].rgb * n.x +
+		irradianceSH[4].rgb * (n.x * n.y) +
+		irradianceSH[5].rgb * (n.y * n.z) +
+		irradianceSH[6].rgb * (3.0f * n.z * n.z - 1.0f) +
+		irradianceSH[7].rgb * (n.x * n.z) +
+		irradianceSH[8].rgb * (n.x * n.x - n.y * n.y);
 }
 
-//Cook-Torrence Microfacet BRDF, where all the functions from CommonVars come together (FIX LATER)
+//Cook-Torrence Microfacet BRDF, where all the functions from CommonVars come together
 //------------------------------------------------------------------------------------------------
 //f = D * F * G / (4 * (N.L) * (N.V))
 // 
@@ -93,11 +192,11 @@ cbuffer externalLight : register(b0)
 //------------------------------------------------------------------------------------------------
 float3 DirectSpecularBRDF(float3 specularAlbedo, float3 positionWS, float3 normal, float3 lightDir)
 {
-	float3 viewDir = normalize(CameraPos - positionWS);
+	float3 viewDir = normalize(cameraPos - positionWS);
 	float3 halfVec = normalize(viewDir + lightDir);
 
 	float nDotH = saturate(dot(normal, halfVec));
-	float nDotL = saturate(dot(normal, lightDir));
+	float nDotL = max(dot(normal, lightDir), 0.0001f);
 	float nDotV = max(dot(normal, viewDir), 0.0001f);
 
 	float alpha2 = roughness * roughness;
@@ -114,7 +213,7 @@ float3 DirectSpecularBRDF(float3 specularAlbedo, float3 positionWS, float3 norma
 	// Smith's approximation.
 	float  G = G_Smith(roughness, nDotV, nDotL);
 
-	return D * F * G; //later to be divide by 4(nDotL)(nDotV)
+	return D * F * G / (4 * nDotL * nDotV) * nDotL;
 }
 
 // ================================================================================================
@@ -123,87 +222,162 @@ float3 DirectSpecularBRDF(float3 specularAlbedo, float3 positionWS, float3 norma
 // ================================================================================================
 float3 ApproximateSpecularIBL(float3 specularAlbedo, float3 reflectDir, float nDotV)
 {
-	// Mip level is in [0, 6] range and roughness is [0, 1].
-	float mipIndex = roughness * 6;
-
-	float3 prefilteredColor = radianceMap.SampleLevel(SamplerAnisotropic, reflectDir, mipIndex);
-	float3 environmentBRDF = integrationMap.Sample(SamplerAnisotropic, float2(roughness, nDotV));
-
-	return prefilteredColor * (specularAlbedo * environmentBRDF.x + environmentBRDF.y);
-}
-
-//Calculates direct lighting for a single directional light source.
-float3 DirectLighting(float3 normal, float3 lightColor, float3 lightPos, float3 diffuseAlbedo, float3 specularAlbedo, float3 positionWS)
-{
-	float3 lighting = 0.0f;
+	// Roughness [0, 1] spans the whole mip chain (see IBLPrecompute)
+	uint width, height, mipCount;
+	RadianceMap.GetDimensions(0, width, height, mipCount);
+	float mipIndex = roughness * (mipCount - 1);
 
-	float3 pixelToLight = lightPos - positionWS;
-	float  lightDist = length(pixelToLight);
-	float3 lightDir = pixelToLight / lightDist; //light's Direction
+	float3 prefilteredColor = RadianceMap.SampleLevel(basicSampler, reflectDir, mipIndex).rgb;
 
-	float nDotL = saturate(dot(normal, lightDir));
-
-	if (nDotL > 0.0f)
+	// Mid-blend, the two maps may have different mip counts
+	if (radianceBlend < 1)
 	{
-		lighting = DirectDiffuseBRDF(diffuseAlbedo, nDotL) + DirectSpecularBRDF(specularAlbedo, positionWS, normal, lightDir);
+		PreviousRadianceMap.GetDimensions(0, width, height, mipCount);
+		float3 previousColor = PreviousRadianceMap.SampleLevel(basicSampler, reflectDir, roughness * (mipCount - 1)).rgb;
+		prefilteredColor = lerp(previousColor, prefilteredColor, radianceBlend);
 	}
+	float2 environmentBRDF = IntegrationMap.Sample(basicSampler, float2(roughness, nDotV)).rg;
 
-	return max(lighting, 0.0f) * lightColor;
+	return prefilteredColor * (specularAlbedo * environmentBRDF.x + environmentBRDF.y);
 }
 
 // ================================================================================================
 // Calculates indirect lighting using a irradiance map and PMREM.
 // ================================================================================================
-float3 IndirectLighting(float roughness, float3 diffuseAlbedo, float3 specularAlbedo, float3 normalWS, float3 positionWS)
+float3 IndirectLighting(float3 diffuseAlbedo, float3 specularAlbedo, float3 normalWS, float3 positionWS)
 {
 	float3 viewDir = normalize(cameraPos - positionWS);
 	float3 reflectDir = normalize(reflect(-viewDir, normalWS));
 	float nDotV = max(dot(normalWS, viewDir), 0.0001f);
 
-	// Sample the indirect diffuse lighting from the irradiance environment map. 
-	float3 indirectDiffuseLighting = irradianceMap.SampleLevel(SamplerAnisotropic, normalWS, 0) * diffuseAlbedo;
+	// Indirect diffuse lighting from the environment's SH irradiance
+	float3 indirectDiffuseLighting = max(EvaluateIrradianceSH(normalWS), 0.0f) * diffuseAlbedo;
 	// Split sum approximation of specular lighting.
 	float3 indirectSpecularLighting = ApproximateSpecularIBL(specularAlbedo, reflectDir, nDotV);
 
 	return indirectDiffuseLighting + indirectSpecularLighting;
-}*/
+}
+#endif
+
+// Diffuse + ambient from one directional light (plus the
+// Cook-Torrance specular term when IBL/PBR is compiled in)
+float4 DirectionalLightColor(DirectionalLight l, float3 normal, float4 surfaceColor, float3 positionWS)
+{
+	//Normalized direction TO the light
+	float3 toLight = -normalize(l.Direction);
+	//Light amount
+	float nDotL = saturate(dot(normal, toLight));
+	float4 result = (l.DiffuseColor * nDotL * surfaceColor) + (l.AmbientColor * surfaceColor);
 
+#if IBL
+	float3 specularAlbedo = lerp(0.04f, surfaceColor.rgb, metalness);
+	result.rgb += DirectSpecularBRDF(specularAlbedo, positionWS, normal, toLight) * l.DiffuseColor.rgb;
+#endif
 
-//Nice read!
-//http://gamedev.stackexchange.com/questions/56897/glsl-light-attenuation-color-and-intensity-formula
-/*float4 calcSpotLight(float4 worldPos, float3 normal, SpotLight spotLight)
+	return result;
+}
+
+#if NORMAL_MAP
+// Perturbs the normal with the normal map.  The mesh has no tangents, so
+// the tangent frame is rebuilt from screen space derivatives of the
+// position and UVs ("cotangent frame", Schuler 2013).
+float3 PerturbNormal(float3 normal, float3 positionWS, float2 uv)
 {
-	//multiply attenuation by intensity
-	//attenuation function: 1.0 / (1.0 + a*dist + b*dist*dist))
-	//float a = 5;
-	//float b = 4;
+	float3 dp1 = ddx(positionWS);
+	float3 dp2 = ddy(positionWS);
+	float2 duv1 = ddx(uv);
+	float2 duv2 = ddy(uv);
+
+	float3 dp2perp = cross(dp2, normal);
+	float3 dp1perp = cross(normal, dp1);
+	float3 tangent = dp2perp * duv1.x + dp1perp * duv2.x;
+	float3 bitangent = dp2perp * duv1.y + dp1perp * duv2.y;
+
+	float invmax = rsqrt(max(dot(tangent, tangent), dot(bitangent, bitangent)));
+	float3x3 TBN = float3x3(tangent * invmax, bitangent * invmax, normal);
+
+	float3 mapped = NormalMap.Sample(basicSampler, uv).xyz * 2 - 1;
+	return normalize(mul(mapped, TBN));
+}
+#endif
 
-	float3 spotLightDirectionToPixel = worldPos - spotLight.Position;
-	//float dist = sqrt(dot(pointLightDirection, pointLightDirection));
-	//dist = max(dist, 9);
-	//float attenuation = 1.0 / (1.0 + a*dist + b*dist*dist);
-	spotLightDirectionToPixel = -normalize(spotLightDirectionToPixel);
+#if SHADOWS
+// How lit a pixel is by a spot light, from the light's tile of the atlas
+float SpotLightShadow(SpotLight l, float3 positionWS)
+{
+	if (l.AtlasRect.z <= 0)
+		return 1.0f;
+
+	// Perspective, so this one needs the divide
+	float4 posForShadow = mul(float4(positionWS, 1.0f), l.ViewProjection);
+	posForShadow.xyz /= posForShadow.w;
+	float2 shadowUV = posForShadow.xy * float2(0.5f, -0.5f) + 0.5f;
+
+	// Into the tile, staying half a texel inside it so filtering
+	// never reaches a neighbouring light's tile
+	uint width, height;
+	SpotShadowAtlas.GetDimensions(width, height);
+	float2 halfTexel = 0.5f / float2(width, height);
+	float2 atlasUV = clamp(l.AtlasRect.xy + shadowUV * l.AtlasRect.zw, l.AtlasRect.xy + halfTexel, l.AtlasRect.xy + l.AtlasRect.zw - halfTexel);
+
+	return SpotShadowAtlas.SampleCmpLevelZero(ShadowSampler, atlasUV, posForShadow.z);
+}
+#endif
 
-	//float temp = attenuation * pointLight.Intensity;
+//Nice read!
+//http://gamedev.stackexchange.com/questions/56897/glsl-light-attenuation-color-and-intensity-formula
+// Diffuse from a point or spot light: fades out over its range, and
+// for spots (cosOuter > -1) over a soft edged cone
+float4 PunctualLightColor(float3 lightPos, float range, float4 color, float3 direction, float cosOuter, float cosInner, float3 normal, float4 surfaceColor, float3 positionWS)
+{
+	float3 toLight = lightPos - positionWS;
+	float dist = length(toLight);
+	toLight /= dist;
 
 	//N dot L
-	float lightAmount = dot(normal, spotLightDirectionToPixel);
-	lightAmount = saturate(lightAmount);
+	float nDotL = saturate(dot(normal, toLight));
+	float cone = cosOuter > -1.0f ? smoothstep(cosOuter, cosInner, dot(-toLight, direction)) : 1.0f;
+	float falloff = saturate(1.0f - dist / range);
+	float attenuation = cone * falloff * falloff;
+	float4 result = color * surfaceColor * (nDotL * attenuation);
+
+#if IBL
+	float3 specularAlbedo = lerp(0.04f, surfaceColor.rgb, metalness);
+	result.rgb += DirectSpecularBRDF(specularAlbedo, positionWS, normal, toLight) * color.rgb * attenuation;
+#endif
+
+	return result;
+}
 
-	//why 
-	float angleFromCenter = max(0.5f, dot(spotLightDirectionToPixel, spotLight.Direction));
-	//raise to a power for a nice "falloff"
-	//multiply diffuse and specular results by this
-	float spotAmount = pow(angleFromCenter, 0.7f);
-	//float spotAmount = smoothstep(100.0f, 100.0f, angleFromCenter);
-	//float spotAmount = 1.0f;
+float4 SpotLightColor(SpotLight l, float3 normal, float4 surfaceColor, float3 positionWS)
+{
+	float4 result = PunctualLightColor(l.Position, l.Range, l.DiffuseColor, l.Direction, l.CosOuterAngle, l.CosInnerAngle, normal, surfaceColor, positionWS);
 
-	float4 scaledDiffuse = spotLight.DiffuseColor * lightAmount * spotAmount;
+#if SHADOWS
+	result *= SpotLightShadow(l, positionWS);
+#endif
 
+	return result;
+}
+
+#if CLUSTERED
+// Every light in this pixel's cluster
+float4 ClusteredLightsColor(float2 pixel, float viewDepth, float3 normal, float4 surfaceColor, float3 positionWS)
+{
+	uint3 cell;
+	cell.xy = min((uint2)(pixel / clusterTileSize), clusterCounts.xy - 1);
+	cell.z = (uint)clamp(log2(max(viewDepth, 0.0001f)) * clusterSliceScale + clusterSliceBias, 0.0f, (float)(clusterCounts.z - 1));
+	uint2 range = ClusterRanges[(cell.z * clusterCounts.y + cell.y) * clusterCounts.x + cell.x];
 
-	//return float4(spotAmount, 0, 0, 0);
-	return scaledDiffuse + spotLight.AmbientColor;
-}*/
+	float4 result = float4(0, 0, 0, 0);
+	for (uint i = 0; i < range.y; i++)
+	{
+		ClusteredLight l = ClusteredLights[ClusterLightIndices[range.x + i]];
+		result += PunctualLightColor(l.Position, l.Range, float4(l.Color, 1), l.Direction, l.CosOuterAngle, l.CosInnerAngle, normal, surfaceColor, positionWS);
+	}
+	return result;
+}
+#endif
 
 // --------------------------------------------------------
 // The entry point (main method) for our pixel shader
@@ -216,59 +390,70 @@ float3 IndirectLighting(float roughness, float3 diffuseAlbedo, float3 specularAl
 // --------------------------------------------------------
 float4 main(VertexToPixel input) : SV_TARGET
 {
-	float3 updated = normalize(input.normal);
-	input.normal = updated;
-
-	//fog-related stuff
-	float dist = 0;
-	float fogFactor = 0;
-	float4 fogColor = float4(0.5, 0.5, 0.5, 1.0); //grey
-
-	//range-based
-	dist = length(input.worldSpace); //mag
-
-	//linear fog
-	fogFactor = (10 - dist) / (10 - 5);
-	fogFactor = clamp(fogFactor, 0.0, 1.0);
+	float3 normal = normalize(input.normal);
+#if NORMAL_MAP
+	normal = PerturbNormal(normal, input.positionWS, input.uv);
+#endif
 
 	//sample the texture
 	float4 surfaceColor = diffuseTexture.Sample(basicSampler, input.uv);
 
-	//NEW
-	//float4 spotL = calcSpotLight(input.worldPos, input.normal, spotLight);
-
-	//Normalized direction TO the light
-	float3 goTowardsTheLight = -normalize(light.Direction);
-	//Light amount
-	float dProduct = saturate(dot(input.normal, goTowardsTheLight)); //used to be a float4
-	//Return final surface color
-	float4 finalResult = (light.DiffuseColor * dProduct * surfaceColor) + (light.AmbientColor * surfaceColor);
+	float4 lighting = float4(0, 0, 0, 0);
+#if LIGHT_COUNT > 0
+	lighting += DirectionalLightColor(light, normal, surfaceColor, input.positionWS);
+#endif
+#if LIGHT_COUNT > 1
+	lighting += DirectionalLightColor(newLight, normal, surfaceColor, input.positionWS);
+#endif
+
+#if IBL
+	lighting.rgb += IndirectLighting(surfaceColor.rgb * (1 - metalness), lerp(0.04f, surfaceColor.rgb, metalness), normal, input.positionWS);
+#endif
+
+#if SHADOWS
+	// Pick the nearest cascade that reaches this pixel's depth
+	// (worldSpace is really view space - see VertexShader)
+	float viewDepth = input.worldSpace.z;
+	int cascade = 0;
+	[unroll]
+	for (int c = 0; c < 3; c++)
+		cascade += (c + 1 < cascadeCount && viewDepth > cascadeSplits[c]) ? 1 : 0;
+
+	// Beyond the last cascade there's no shadow
+	if (viewDepth < cascadeSplits[cascadeCount - 1])
+	{
+		// Figure out this pixel's UV in the SHADOW MAP (orthographic, so no divide)
+		float4 posForShadow = mul(float4(input.positionWS, 1.0f), cascadeViewProjection[cascade]);
+		float2 shadowUV = posForShadow.xy * 0.5f + 0.5f;
+		shadowUV.y = 1.0f - shadowUV.y; // Flip the Y since UV coords and screen coords are different
+
+		// Sample the cascade's slice, comparing with this pixel's depth from the light
+		float shadowAmount = ShadowMap.SampleCmpLevelZero(ShadowSampler, float3(shadowUV, cascade), posForShadow.z);
+		lighting *= shadowAmount;
+	}
+#endif
 
-	//Normalized direction TO the light
-	float3 goToLight = -normalize(newLight.Direction);
-	//Light amount
-	float amount = saturate(dot(input.normal, goToLight)); //used to be a float4
-	//Return final surface color
-	float4 nextResult = (newLight.DiffuseColor * amount * surfaceColor) + (newLight.AmbientColor * surfaceColor);
+	// Spot lights have their own shadows (in the atlas)
+	for (int s = 0; s < spotLightCount; s++)
+		lighting += SpotLightColor(spotLights[s], normal, surfaceColor, input.positionWS);
 
-	// Shadow map calculation
-	// Figure out this pixel's UV in the SHADOW MAP
-	float2 shadowUV = input.posForShadow.xy / input.posForShadow.w * 0.5f + 0.5f;
-	shadowUV.y = 1.0f - shadowUV.y; // Flip the Y since UV coords and screen coords are different
+#if CLUSTERED
+	lighting += ClusteredLightsColor(input.position.xy, input.worldSpace.z, normal, surfaceColor, input.positionWS);
+#endif
 
-	// Calculate this pixel's actual depth from the light
-	float depthFromLight = input.posForShadow.z / input.posForShadow.w;
+#if FOG
+	//fog-related stuff
+	float4 fogColor = float4(0.5, 0.5, 0.5, 1.0); //grey
 
-	// Sample the shadow map
-	float shadowAmount = ShadowMap.SampleCmpLevelZero(ShadowSampler, shadowUV, depthFromLight);
+	//range-based
+	float dist = length(input.worldSpace); //mag
 
-	//return finalResult + nextResult;
-	float4 tempResult = finalResult + nextResult;
-	float4 myAss = tempResult * shadowAmount;
+	//linear fog
+	float fogFactor = (10 - dist) / (10 - 5);
+	fogFactor = clamp(fogFactor, 0.0, 1.0);
 
-	float4 finalColor = lerp(fogColor, myAss, fogFactor);
-	return finalColor;
+	lighting = lerp(fogColor, lighting, fogFactor);
+#endif
 
-	//return spotL;
-	
-}
\ No newline at end of file
+	return lighting;
+}
@@ -0,0 +1,540 @@
+#include "Profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+
+// One thread's scopes, waiting for EndFrame().  Only the owning
+// thread writes entries and moves Write; only EndFrame() moves
+// Read, so neither side needs a lock.
+struct Profiler::ThreadRing
+{
+	struct Entry
+	{
+		const char* Name;
+		long long Begin;
+		long long End;
+		unsigned long long Frame;
+		int Depth;
+	};
+
+	Entry Entries[RingSize];
+	std::atomic<unsigned int> Write;
+	std::atomic<unsigned int> Read;
+	std::atomic<unsigned int> Dropped;
+	std::atomic<bool> Released;		// Its thread has exited, so it can go to a new one
+	int Depth;						// Owning thread only
+	int Track;
+	std::string Name;				// Under the state's mutex
+};
+
+struct Profiler::State
+{
+	std::mutex Mutex;				// Rings and their names
+	std::vector<ThreadRing*> Rings;
+
+	std::mutex InternMutex;
+	std::set<std::string> Interned;
+
+	long long Epoch;
+	double TickMs;
+
+	ProfileFrame Frames[FrameCount];
+	unsigned long long Ended;		// Frames below this have ended
+	double LastEndMs;
+
+	std::vector<int> SortScratch;
+	size_t MostEvents;				// In any frame, so every frame's lists can be that big
+};
+
+std::atomic<bool> Profiler::enabled(true);
+std::atomic<unsigned long long> Profiler::frameIndex(0);
+
+namespace
+{
+	// Hands the ring back when its thread exits
+	template<typename Ring>
+	struct RingOwner
+	{
+		Ring* ring;
+		RingOwner() : ring(0) {}
+		~RingOwner() { if (ring) ring->Released.store(true, std::memory_order_release); }
+	};
+
+	const int MaxTreeDepth = 64;
+}
+
+// --------------------------------------------------------
+// Never destroyed, so threads can still hand back their rings
+// while the program shuts down
+// --------------------------------------------------------
+Profiler::State& Profiler::GetState()
+{
+	static State* state = 0;
+	static std::once_flag once;
+	std::call_once(once, []()
+	{
+		state = new State();
+		state->Epoch = GetTicks();
+		state->TickMs = (double)std::chrono::steady_clock::period::num * 1000.0 / std::chrono::steady_clock::period::den;
+		state->Ended = 0;
+		state->LastEndMs = 0;
+		state->MostEvents = 0;
+		for (int f = 0; f < FrameCount; f++)
+		{
+			state->Frames[f].Frame = ~0ull;
+			state->Frames[f].GpuMs = -1;
+		}
+	});
+	return *state;
+}
+
+long long Profiler::GetTicks()
+{
+	return (long long)std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+double Profiler::GetTimeMs()
+{
+	State& state = GetState();
+	return (GetTicks() - state.Epoch) * state.TickMs;
+}
+
+void Profiler::SetEnabled(bool enabled)
+{
+	Profiler::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::IsEnabled()
+{
+	return enabled.load(std::memory_order_relaxed);
+}
+
+unsigned long long Profiler::GetFrameIndex()
+{
+	return frameIndex.load(std::memory_order_relaxed);
+}
+
+const char* Profiler::Intern(const char* name)
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.InternMutex);
+	return state.Interned.insert(name).first->c_str();
+}
+
+// --------------------------------------------------------
+// The calling thread's ring, made (or taken over from a
+// thread that's gone) on first use
+// --------------------------------------------------------
+Profiler::ThreadRing* Profiler::GetThreadRing()
+{
+	static thread_local RingOwner<ThreadRing> owner;
+	if (owner.ring)
+		return owner.ring;
+
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	ThreadRing* ring = 0;
+	for (size_t r = 0; r < state.Rings.size() && !ring; r++)
+	{
+		if (state.Rings[r]->Released.load(std::memory_order_acquire))
+			ring = state.Rings[r];
+	}
+	if (!ring)
+	{
+		ring = new ThreadRing();
+		ring->Write.store(0);
+		ring->Read.store(0);
+		ring->Dropped.store(0);
+		ring->Track = (int)state.Rings.size();
+		state.Rings.push_back(ring);
+	}
+
+	char name[32];
+	snprintf(name, sizeof(name), "Thread %d", ring->Track);
+	ring->Name = name;
+	ring->Depth = 0;
+	ring->Released.store(false, std::memory_order_relaxed);
+
+	owner.ring = ring;
+	return ring;
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+	ThreadRing* ring = GetThreadRing();
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+	ring->Name = name;
+}
+
+const char* Profiler::GetTrackName(int track)
+{
+	if (track < 0)
+		return "GPU";
+
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+	return track < (int)state.Rings.size() ? state.Rings[track]->Name.c_str() : "";
+}
+
+Profiler::ThreadRing* Profiler::BeginScope()
+{
+	ThreadRing* ring = GetThreadRing();
+	ring->Depth++;
+	return ring;
+}
+
+// --------------------------------------------------------
+// Ends a scope on the calling thread.  If EndFrame() hasn't
+// made room, the scope is dropped rather than waiting.
+// --------------------------------------------------------
+void Profiler::Record(ThreadRing* ring, const char* name, long long begin, unsigned long long frame)
+{
+	long long end = GetTicks();
+	int depth = --ring->Depth;
+
+	unsigned int write = ring->Write.load(std::memory_order_relaxed);
+	if (write - ring->Read.load(std::memory_order_acquire) >= (unsigned int)RingSize)
+	{
+		ring->Dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	ThreadRing::Entry& entry = ring->Entries[write % RingSize];
+	entry.Name = name;
+	entry.Begin = begin;
+	entry.End = end;
+	entry.Frame = frame;
+	entry.Depth = depth;
+	ring->Write.store(write + 1, std::memory_order_release);
+}
+
+unsigned int Profiler::GetDroppedCount()
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	unsigned int dropped = 0;
+	for (size_t r = 0; r < state.Rings.size(); r++)
+		dropped += state.Rings[r]->Dropped.load(std::memory_order_relaxed);
+	return dropped;
+}
+
+// --------------------------------------------------------
+// Merges a frame's scopes into its tree.  On each track, a
+// scope's parent is the one it's nested in (by depth and
+// time); if that was dropped it goes at the top level.
+// --------------------------------------------------------
+static void BuildTree(ProfileFrame& frame, std::vector<int>& order)
+{
+	const std::vector<ProfileEvent>& events = frame.Events;
+	frame.Nodes.clear();
+
+	order.resize(events.size());
+	for (size_t e = 0; e < events.size(); e++)
+		order[e] = (int)e;
+	std::sort(order.begin(), order.end(), [&events](int a, int b)
+	{
+		if (events[a].Track != events[b].Track)
+			return events[a].Track < events[b].Track;
+		if (events[a].BeginMs != events[b].BeginMs)
+			return events[a].BeginMs < events[b].BeginMs;
+		return events[a].Depth < events[b].Depth;
+	});
+
+	int stack[MaxTreeDepth];
+	double stackEnd[MaxTreeDepth];
+	int stackSize = 0;
+	int track = 0;
+	for (size_t o = 0; o < order.size(); o++)
+	{
+		const ProfileEvent& event = events[order[o]];
+		if (o == 0 || event.Track != track)
+		{
+			track = event.Track;
+			stackSize = 0;
+		}
+
+		int depth = std::min(std::max(event.Depth, 0), MaxTreeDepth - 1);
+		int parent = -1;
+		if (depth > 0 && depth <= stackSize && stackEnd[depth - 1] >= event.EndMs)
+			parent = stack[depth - 1];
+
+		// Same name under the same parent: another call of that node
+		int node = -1;
+		for (int n = parent + 1; n < (int)frame.Nodes.size() && node < 0; n++)
+		{
+			const ProfileNode& other = frame.Nodes[n];
+			if (other.Parent == parent && other.Track == event.Track && strcmp(other.Name, event.Name) == 0)
+				node = n;
+		}
+		if (node < 0)
+		{
+			ProfileNode added;
+			added.Name = event.Name;
+			added.Track = event.Track;
+			added.Parent = parent;
+			added.Depth = parent >= 0 ? frame.Nodes[parent].Depth + 1 : 0;
+			added.Calls = 0;
+			added.Ms = 0;
+			frame.Nodes.push_back(added);
+			node = (int)frame.Nodes.size() - 1;
+		}
+		frame.Nodes[node].Calls++;
+		frame.Nodes[node].Ms += event.EndMs - event.BeginMs;
+
+		stack[depth] = node;
+		stackEnd[depth] = event.EndMs;
+		stackSize = depth + 1;
+	}
+}
+
+// --------------------------------------------------------
+// Closes the frame, and moves every thread's finished scopes
+// into the frames they started in.  Scopes started after the
+// new frame began are left for the next call.
+// --------------------------------------------------------
+void Profiler::EndFrame()
+{
+	State& state = GetState();
+	std::lock_guard<std::mutex> lock(state.Mutex);
+
+	unsigned long long frame = frameIndex.load(std::memory_order_relaxed);
+	double now = (GetTicks() - state.Epoch) * state.TickMs;
+	frameIndex.store(frame + 1, std::memory_order_relaxed);
+
+	ProfileFrame& current = state.Frames[frame % FrameCount];
+	current.Frame = frame;
+	current.BeginMs = state.LastEndMs;
+	current.EndMs = now;
+	current.GpuMs = -1;
+	current.Events.clear();
+
+	// Sized up front (with room to vary) to the busiest frame
+	// yet, rather than each frame kept growing on its own - so
+	// steady frames don't allocate
+	if (current.Events.capacity() < state.MostEvents)
+	{
+		current.Events.reserve(state.MostEvents + state.MostEvents / 2);
+		current.Nodes.reserve(state.MostEvents + state.MostEvents / 2);
+	}
+	state.LastEndMs = now;
+	state.Ended = frame + 1;
+
+	// Frames before this one that got late scopes (from threads
+	// still running at their end) need their trees rebuilt
+	unsigned long long oldestLate = frame;
+
+	for (size_t r = 0; r < state.Rings.size(); r++)
+	{
+		ThreadRing* ring = state.Rings[r];
+		unsigned int read = ring->Read.load(std::memory_order_relaxed);
+		unsigned int write = ring->Write.load(std::memory_order_acquire);
+		for (; read != write; read++)
+		{
+			const ThreadRing::Entry& entry = ring->Entries[read % RingSize];
+			if (entry.Frame > frame)
+				break;
+			if (frame - entry.Frame >= (unsigned long long)FrameCount)
+				continue;	// Its frame isn't kept any more
+
+			ProfileFrame& target = state.Frames[entry.Frame % FrameCount];
+			if (target.Frame != entry.Frame)
+				continue;
+
+			ProfileEvent event;
+			event.Name = entry.Name;
+			event.Track = ring->Track;
+			event.Depth = entry.Depth;
+			event.BeginMs = (entry.Begin - state.Epoch) * state.TickMs;
+			event.EndMs = (entry.End - state.Epoch) * state.TickMs;
+			target.Events.push_back(event);
+			oldestLate = std::min(oldestLate, entry.Frame);
+		}
+		ring->Read.store(read, std::memory_order_release);
+	}
+
+	for (unsigned long long f = oldestLate; f <= frame; f++)
+	{
+		ProfileFrame& built = state.Frames[f % FrameCount];
+		if (built.Frame != f)
+			continue;
+		BuildTree(built, state.SortScratch);
+		state.MostEvents = std::max(state.MostEvents, built.Events.size());
+	}
+}
+
+const ProfileFrame* Profiler::GetFrame(unsigned long long frame)
+{
+	State& state = GetState();
+	if (frame >= state.Ended || state.Ended - frame > (unsigned long long)FrameCount)
+		return 0;
+	return &state.Frames[frame % FrameCount];
+}
+
+bool Profiler::GetAverageMs(int frameCount, double& cpuMs, double& gpuMs)
+{
+	State& state = GetState();
+	unsigned long long count = std::min((unsigned long long)std::max(frameCount, 0), std::min(state.Ended, (unsigned long long)FrameCount));
+
+	double cpuTotal = 0;
+	double gpuTotal = 0;
+	int gpuFrames = 0;
+	for (unsigned long long f = state.Ended - count; f < state.Ended; f++)
+	{
+		const ProfileFrame& frame = state.Frames[f % FrameCount];
+		cpuTotal += frame.GetMs();
+		if (frame.GpuMs >= 0)
+		{
+			gpuTotal += frame.GpuMs;
+			gpuFrames++;
+		}
+	}
+
+	cpuMs = count > 0 ? cpuTotal / count : 0;
+	gpuMs = gpuFrames > 0 ? gpuTotal / gpuFrames : -1;
+	return count > 0;
+}
+
+void Profiler::AddGpuScope(unsigned long long frame, const char* name, int depth, double beginMs, double endMs)
+{
+	ProfileFrame* target = (ProfileFrame*)GetFrame(frame);
+	if (!target)
+		return;
+
+	ProfileEvent event;
+	event.Name = name;
+	event.Track = -1;
+	event.Depth = depth;
+	event.BeginMs = beginMs;
+	event.EndMs = endMs;
+	target->Events.push_back(event);
+}
+
+// --------------------------------------------------------
+// The GPU's time for a frame, once all its scopes are in
+// --------------------------------------------------------
+void Profiler::SetGpuFrame(unsigned long long frame, double beginMs, double endMs)
+{
+	ProfileFrame* target = (ProfileFrame*)GetFrame(frame);
+	if (!target)
+		return;
+
+	target->GpuMs = endMs - beginMs;
+	BuildTree(*target, GetState().SortScratch);
+}
+
+double ProfileFrame::GetScopeMs(const char* name, bool gpu) const
+{
+	double ms = 0;
+	for (size_t n = 0; n < Nodes.size(); n++)
+	{
+		if ((Nodes[n].Track < 0) == gpu && strcmp(Nodes[n].Name, name) == 0)
+			ms += Nodes[n].Ms;
+	}
+	return ms;
+}
+
+static void PrintNode(const ProfileFrame& frame, int node)
+{
+	const ProfileNode& n = frame.Nodes[node];
+	printf("%*s%-*s %8.3fms", 2 + n.Depth * 2, "", 32 - n.Depth * 2, n.Name, n.Ms);
+	if (n.Calls > 1)
+		printf("  (%d calls)", n.Calls);
+	printf("\n");
+
+	for (int child = node + 1; child < (int)frame.Nodes.size(); child++)
+	{
+		if (frame.Nodes[child].Parent == node)
+			PrintNode(frame, child);
+	}
+}
+
+void Profiler::PrintFrame(const ProfileFrame& frame)
+{
+	printf("Frame %llu: %.3fms", frame.Frame, frame.GetMs());
+	if (frame.GpuMs >= 0)
+		printf(", %.3fms on the GPU", frame.GpuMs);
+	printf("\n");
+
+	int track = 0;
+	for (int node = 0; node < (int)frame.Nodes.size(); node++)
+	{
+		if (frame.Nodes[node].Parent >= 0)
+			continue;
+		if (node == 0 || frame.Nodes[node].Track != track)
+		{
+			track = frame.Nodes[node].Track;
+			printf(" %s\n", GetTrackName(track));
+		}
+		PrintNode(frame, node);
+	}
+}
+
+// --------------------------------------------------------
+// Writes the kept frames as a Chrome trace (chrome://tracing
+// or ui.perfetto.dev).  The GPU's scopes are placed from when
+// their frame's first query was issued, so their lengths are
+// right but they start a little early.
+// --------------------------------------------------------
+bool Profiler::WriteChromeTrace(const char* path)
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "w");
+#else
+	file = fopen(path, "w");
+#endif
+	if (!file)
+		return false;
+
+	State& state = GetState();
+
+	// Track ids: 0 the frames, 1 the GPU, then a thread each
+	fprintf(file, "{\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}},\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"GPU\"}}");
+	{
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		for (size_t r = 0; r < state.Rings.size(); r++)
+		{
+			fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+				state.Rings[r]->Track + 2, state.Rings[r]->Name.c_str());
+		}
+	}
+
+	unsigned long long count = std::min(state.Ended, (unsigned long long)FrameCount);
+	for (unsigned long long f = state.Ended - count; f < state.Ended; f++)
+	{
+		const ProfileFrame& frame = state.Frames[f % FrameCount];
+		fprintf(file,
+			",\n{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%llu,\"gpu_ms\":%.3f}}",
+			frame.BeginMs * 1000.0,
+			frame.GetMs() * 1000.0,
+			frame.Frame,
+			frame.GpuMs);
+
+		for (size_t e = 0; e < frame.Events.size(); e++)
+		{
+			const ProfileEvent& event = frame.Events[e];
+			fprintf(file,
+				",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%llu}}",
+				event.Name,
+				event.Track < 0 ? "gpu" : "cpu",
+				event.Track < 0 ? 1 : event.Track + 2,
+				event.BeginMs * 1000.0,
+				(event.EndMs - event.BeginMs) * 1000.0,
+				frame.Frame);
+		}
+	}
+
+	fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	fclose(file);
+	return true;
+}
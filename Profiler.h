@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+// Scopes are compiled in unless this is defined as 0 (e.g.
+// /DPROFILER_ENABLED=0), in which case PROFILE_SCOPE is
+// nothing at all
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// One timed scope, in Profiler::GetTimeMs() milliseconds
+struct ProfileEvent
+{
+	const char* Name;
+	int Track;			// Thread (see Profiler::GetTrackName), or -1 for the GPU
+	int Depth;			// Scopes it's nested in, on its track
+	double BeginMs;
+	double EndMs;
+};
+
+// A frame's scopes merged into a tree: scopes with the same
+// name under the same parent (on the same track) become one
+// node.  Children come after their parent.
+struct ProfileNode
+{
+	const char* Name;
+	int Track;
+	int Parent;			// -1 for a track's top level
+	int Depth;
+	int Calls;
+	double Ms;			// All calls, children included
+};
+
+struct ProfileFrame
+{
+	unsigned long long Frame;
+	double BeginMs;		// The previous EndFrame()
+	double EndMs;
+	double GpuMs;		// Start to end on the GPU, -1 until it's known (a few frames late)
+
+	std::vector<ProfileEvent> Events;
+	std::vector<ProfileNode> Nodes;
+
+	double GetMs() const { return EndMs - BeginMs; }
+
+	// Total of every node with this name on the CPU (any
+	// thread) or the GPU track, 0 if there's none
+	double GetScopeMs(const char* name, bool gpu) const;
+};
+
+class ProfileScope;
+
+// --------------------------------------------------------
+// Scoped timing markers.  PROFILE_SCOPE("Name") times the rest
+// of the enclosing block, on any thread.
+//
+// Each thread writes its scopes to its own ring buffer - just
+// a clock read at each end and a store, no locks - and the
+// main thread drains every ring at EndFrame(), sorting the
+// scopes into the frame they started in.  The last FrameCount
+// frames are kept, as raw scopes (for a Chrome trace) and
+// merged into a tree (for per-pass numbers).  GPU timings
+// (see D3D11GpuProfiler) are added to their frame when the
+// GPU gets to them.
+//
+// A full ring drops scopes (and counts them) rather than
+// waiting.  Names must outlive the kept frames - literals, or
+// Intern() for anything built at run time.
+// --------------------------------------------------------
+class Profiler
+{
+public:
+	static const int FrameCount = 64;		// Frames kept
+	static const int RingSize = 4096;		// Scopes a thread can have waiting for EndFrame()
+
+	// Turns recording on and off at run time (on by default)
+	static void SetEnabled(bool enabled);
+	static bool IsEnabled();
+
+	// Names the calling thread's track in traces
+	static void SetThreadName(const char* name);
+	static const char* GetTrackName(int track);
+
+	// A copy of the name that lives as long as the program
+	static const char* Intern(const char* name);
+
+	// Milliseconds since the profiler's first use
+	static double GetTimeMs();
+
+	// Closes the frame (everything since the last call) and
+	// starts the next.  Main thread.
+	static void EndFrame();
+	static unsigned long long GetFrameIndex();	// The frame being recorded
+
+	// A kept frame, or null if it's too old or not ended yet
+	static const ProfileFrame* GetFrame(unsigned long long frame);
+
+	// Averages over the last frameCount ended frames (GPU over
+	// those with a GPU time yet, -1 if none has).  Returns false
+	// if no frame has ended.
+	static bool GetAverageMs(int frameCount, double& cpuMs, double& gpuMs);
+
+	// Main thread: a GPU scope or a whole GPU frame, in
+	// GetTimeMs() milliseconds
+	static void AddGpuScope(unsigned long long frame, const char* name, int depth, double beginMs, double endMs);
+	static void SetGpuFrame(unsigned long long frame, double beginMs, double endMs);
+
+	// Scopes lost to full rings, in total
+	static unsigned int GetDroppedCount();
+
+	// A frame's tree, indented, to stdout
+	static void PrintFrame(const ProfileFrame& frame);
+
+	// Every kept frame: a track per thread, the GPU's, and the
+	// frames themselves
+	static bool WriteChromeTrace(const char* path);
+
+private:
+	friend class ProfileScope;
+	struct ThreadRing;
+	struct State;
+
+	static State& GetState();
+	static ThreadRing* GetThreadRing();
+	static ThreadRing* BeginScope();	// The calling thread's ring, a level deeper
+	static void Record(ThreadRing* ring, const char* name, long long begin, unsigned long long frame);
+	static long long GetTicks();
+
+	static std::atomic<bool> enabled;
+	static std::atomic<unsigned long long> frameIndex;
+};
+
+// --------------------------------------------------------
+// Times its own lifetime (see PROFILE_SCOPE)
+// --------------------------------------------------------
+class ProfileScope
+{
+public:
+	ProfileScope(const char* name)
+	{
+		ring = Profiler::enabled.load(std::memory_order_relaxed) ? Profiler::BeginScope() : 0;
+		if (ring)
+		{
+			this->name = name;
+			frame = Profiler::frameIndex.load(std::memory_order_relaxed);
+			begin = Profiler::GetTicks();
+		}
+	}
+
+	~ProfileScope()
+	{
+		if (ring)
+			Profiler::Record(ring, name, begin, frame);
+	}
+
+private:
+	Profiler::ThreadRing* ring;
+	const char* name;
+	long long begin;
+	unsigned long long frame;
+
+	ProfileScope(const ProfileScope&);
+	ProfileScope& operator=(const ProfileScope&);
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name)
+#endif
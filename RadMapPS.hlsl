@@ -1,10 +1,12 @@
-#include "CommonVars.hlsl"
+#include "CommonVars.hlsli"
 
 cbuffer PSConstants: register(b0)
 {
-	float2 halfPixel;
 	float Face;
 	float MipIndex;
+	float Roughness;	// Set per mip by IBLPrecompute (the chain length varies)
+	uint SampleCount;
+	float SourceSize;	// Face size of cubeMap's top mip (0 = read the top mip only)
 };
 
 struct PSInput //like all PS, match output of VS
@@ -14,6 +16,7 @@ struct PSInput //like all PS, match output of VS
 };
 
 TextureCube cubeMap  :  register(t0);
+SamplerState EnvSampler : register(s0);
 
 float3 GetNormal(uint face, float2 uv)
 {
@@ -46,6 +49,25 @@ float3 GetNormal(uint face, float2 uv)
 	return normalize(dir);
 }
 
+// Filtered importance sampling (GPU Gems 3, ch. 20): read each
+// sample from the mip whose texels cover about the solid angle
+// the sample stands for.  Matches IBLPrefilter::GetSampleLod.
+float GetSampleLod(float NoH)
+{
+	if (SourceSize <= 0 || Roughness <= 0)
+		return 0;
+
+	// GGX D, and the PDF of L (V = N, so the Jacobian is 1 / 4)
+	float a = Roughness * Roughness;
+	float a2 = a * a;
+	float d = NoH * NoH * (a2 - 1) + 1;
+	float pdf = a2 / (Pi * d * d) / 4;
+
+	float sampleSolidAngle = 1.0f / (SampleCount * pdf + 0.0001f);
+	float texelSolidAngle = 4 * Pi / (6.0f * SourceSize * SourceSize);
+	return max(0.5f * log2(sampleSolidAngle / texelSolidAngle), 0);
+}
+
 //We solve the radiance integral using the Split-Sum approximation
 //This will solve the first of two sums, by Pre-Filtering the Environment Map
 // http://blog.selfshadow.com/publications/s2013-shading-course/karis/s2013_pbs_epic_notes_v2.pdf 
@@ -59,18 +81,16 @@ float3 PrefilterEnvMap(float Roughness, float3 R, TextureCube EnvMap)
 	float3 V = R;
 	float3 PrefilteredColor = 0;
 
-	const uint NumSamples = 1024;
-
-	for (uint i = 0; i < NumSamples; i++)
+	for (uint i = 0; i < SampleCount; i++)
 	{
-		float2 Xi = Hammersley(i, NumSamples);
+		float2 Xi = Hammersley(i, SampleCount);
 		float3 H = ImportanceSampleGGX(Xi, Roughness, N);
 		float3 L = 2 * dot(V, H) * H - V;
 		float NoL = saturate(dot(N, L));
 
 		if (NoL > 0)
 		{
-			PrefilteredColor += EnvMap.SampleLevel(SamplerAnisotropic, L, 0).rgb * NoL;
+			PrefilteredColor += EnvMap.SampleLevel(EnvSampler, L, GetSampleLod(saturate(dot(N, H)))).rgb * NoL;
 			TotalWeight += NoL;
 		}
 	}
@@ -80,8 +100,8 @@ float3 PrefilterEnvMap(float Roughness, float3 R, TextureCube EnvMap)
 
 float4 main(PSInput input) : SV_TARGET
 {
-	//float3 normal = GetNormal(Face, input.TexCoord);
-	float  roughness = saturate(MipIndex / 6.0f); // Mip level is in [0, 6] range and roughness is [0, 1]
+	// The reflection vector through this texel of the face being drawn
+	float3 normal = GetNormal((uint)Face, input.TexCoord);
 
-	return float4(PrefilterEnvMap(roughness, 1.0, cubeMap), 1);
+	return float4(PrefilterEnvMap(saturate(Roughness), normal, cubeMap), 1);
 }
\ No newline at end of file
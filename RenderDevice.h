@@ -0,0 +1,197 @@
+#pragma once
+
+#include <stddef.h>
+
+// --------------------------------------------------------
+// A thin, API-neutral layer over the GPU: buffers, textures,
+// shaders, pipeline state and draws.  Resources are plain
+// handles (0 = none), so nothing here needs D3D, and the same
+// frame can be issued to D3D11 (D3D11RenderDevice), recorded
+// headless (NullRenderDevice) or rasterized on the CPU
+// (SoftwareRenderDevice).
+// --------------------------------------------------------
+
+typedef unsigned int RenderBufferHandle;
+typedef unsigned int RenderTextureHandle;
+typedef unsigned int RenderShaderHandle;
+typedef unsigned int RenderPipelineHandle;
+typedef unsigned int RenderSamplerHandle;
+
+enum RenderBufferType
+{
+	RENDER_BUFFER_VERTEX,
+	RENDER_BUFFER_INDEX,		// 32 bit indices
+	RENDER_BUFFER_CONSTANT,
+	RENDER_BUFFER_STRUCTURED
+};
+
+enum RenderUsage
+{
+	RENDER_USAGE_IMMUTABLE,		// Initial data only
+	RENDER_USAGE_DEFAULT,		// Updated now and then
+	RENDER_USAGE_DYNAMIC		// Rewritten (whole) every frame
+};
+
+struct RenderBufferDesc
+{
+	RenderBufferType Type;
+	RenderUsage Usage;
+	unsigned int ByteWidth;
+	unsigned int Stride;		// Structured buffers' element size
+};
+
+enum RenderFormat
+{
+	RENDER_FORMAT_RGBA8_UNORM,
+	RENDER_FORMAT_RGBA16_FLOAT,
+	RENDER_FORMAT_RG16_FLOAT,
+	RENDER_FORMAT_R32_FLOAT,
+	RENDER_FORMAT_DEPTH32,				// Depth that can also be read as R32_FLOAT
+	RENDER_FORMAT_DEPTH24_STENCIL8
+};
+
+enum RenderBindFlags
+{
+	RENDER_BIND_SHADER_RESOURCE	= 1 << 0,
+	RENDER_BIND_RENDER_TARGET	= 1 << 1,
+	RENDER_BIND_DEPTH_STENCIL	= 1 << 2
+};
+
+struct RenderTextureDesc
+{
+	int Width;
+	int Height;
+	int ArraySize;		// Slices (6 for a cube)
+	int MipLevels;
+	RenderFormat Format;
+	unsigned int BindFlags;	// RenderBindFlags
+	bool Cube;
+};
+
+enum RenderShaderStage
+{
+	RENDER_SHADER_VERTEX,
+	RENDER_SHADER_PIXEL
+};
+
+// How vertex buffer slot 0 is laid out (see Vertex.h)
+enum RenderVertexLayout
+{
+	RENDER_LAYOUT_VERTEX,		// Position, normal, UV
+	RENDER_LAYOUT_POSITION		// Position only (a mesh's position stream)
+};
+
+enum RenderCullMode
+{
+	RENDER_CULL_NONE,
+	RENDER_CULL_BACK,
+	RENDER_CULL_FRONT
+};
+
+enum RenderCompare
+{
+	RENDER_COMPARE_NEVER,
+	RENDER_COMPARE_LESS,
+	RENDER_COMPARE_LESS_EQUAL,
+	RENDER_COMPARE_ALWAYS
+};
+
+struct RenderPipelineDesc
+{
+	RenderShaderHandle VertexShader;
+	RenderShaderHandle PixelShader;		// 0 for depth only
+	RenderVertexLayout Layout;
+	RenderCullMode Cull;
+	bool DepthTest;
+	bool DepthWrite;
+	RenderCompare DepthFunc;
+	int DepthBias;
+	float SlopeScaledDepthBias;
+	bool AlphaBlend;
+};
+
+enum RenderFilter
+{
+	RENDER_FILTER_POINT,
+	RENDER_FILTER_LINEAR,
+	RENDER_FILTER_ANISOTROPIC,
+	RENDER_FILTER_COMPARISON_LINEAR		// Shadow map compare (less)
+};
+
+enum RenderAddress
+{
+	RENDER_ADDRESS_WRAP,
+	RENDER_ADDRESS_CLAMP,
+	RENDER_ADDRESS_BORDER
+};
+
+struct RenderSamplerDesc
+{
+	RenderFilter Filter;
+	RenderAddress Address;
+	float BorderColor[4];
+	int MaxAnisotropy;
+};
+
+// --------------------------------------------------------
+// Where commands go.  One per thread: the immediate context,
+// or one per recording job (see CommandRecorder).
+// --------------------------------------------------------
+class RenderContext
+{
+public:
+	virtual ~RenderContext() {}
+
+	virtual void SetPipeline(RenderPipelineHandle pipeline) = 0;
+	virtual void SetVertexBuffer(int slot, RenderBufferHandle buffer, unsigned int stride, unsigned int offset) = 0;
+	virtual void SetIndexBuffer(RenderBufferHandle buffer) = 0;
+	virtual void SetConstantBuffer(RenderShaderStage stage, int slot, RenderBufferHandle buffer) = 0;
+	// Binds a texture, or a structured buffer (any handle that
+	// can be read as a shader resource)
+	virtual void SetTexture(RenderShaderStage stage, int slot, RenderTextureHandle texture) = 0;
+	virtual void SetSampler(RenderShaderStage stage, int slot, RenderSamplerHandle sampler) = 0;
+
+	// Replaces a constant or dynamic buffer's contents
+	virtual void UpdateBuffer(RenderBufferHandle buffer, const void* data, unsigned int size) = 0;
+
+	// Replaces a slice's top mip, in the texture's own format
+	// (bytes for RGBA8, halves for 16 bit floats, and so on)
+	virtual void UpdateTexture(RenderTextureHandle texture, int slice, const void* data, unsigned int rowPitch) = 0;
+
+	// depthSlice picks a slice of an array depth texture
+	virtual void SetRenderTargets(const RenderTextureHandle* colors, int colorCount, RenderTextureHandle depth, int depthSlice = 0) = 0;
+	virtual void SetViewport(float x, float y, float width, float height) = 0;
+	virtual void ClearRenderTarget(RenderTextureHandle texture, const float color[4]) = 0;
+	virtual void ClearDepth(RenderTextureHandle texture, float depth, int slice = 0) = 0;
+
+	virtual void Draw(unsigned int vertexCount, unsigned int startVertex) = 0;
+	virtual void DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex) = 0;
+};
+
+// --------------------------------------------------------
+// Creates and destroys resources.  Creation may happen on any
+// thread (startup runs it on workers).
+// --------------------------------------------------------
+class RenderDevice
+{
+public:
+	virtual ~RenderDevice() {}
+
+	// initialData may be null (except for immutable buffers)
+	virtual RenderBufferHandle CreateBuffer(const RenderBufferDesc& desc, const void* initialData) = 0;
+	virtual RenderTextureHandle CreateTexture(const RenderTextureDesc& desc) = 0;
+
+	// name identifies the shader to backends that can't run
+	// bytecode (e.g. "VertexShader" for VertexShader.cso)
+	virtual RenderShaderHandle CreateShader(RenderShaderStage stage, const char* name, const void* bytecode, size_t size) = 0;
+	virtual RenderPipelineHandle CreatePipeline(const RenderPipelineDesc& desc) = 0;
+	virtual RenderSamplerHandle CreateSampler(const RenderSamplerDesc& desc) = 0;
+
+	virtual void ReleaseBuffer(RenderBufferHandle buffer) = 0;
+	virtual void ReleaseTexture(RenderTextureHandle texture) = 0;
+	virtual void ReleaseShader(RenderShaderHandle shader) = 0;
+	virtual void ReleasePipeline(RenderPipelineHandle pipeline) = 0;
+	virtual void ReleaseSampler(RenderSamplerHandle sampler) = 0;
+
+	virtual RenderContext* GetImmediateContext() = 0;
+};
@@ -0,0 +1,452 @@
+#include "RenderGraph.h"
+
+#include <algorithm>
+
+bool RenderGraphTextureDesc::operator==(const RenderGraphTextureDesc& other) const
+{
+	return Width == other.Width &&
+		Height == other.Height &&
+		ArraySize == other.ArraySize &&
+		Format == other.Format &&
+		BindFlags == other.BindFlags;
+}
+
+RenderGraph::RenderGraph() : scratch(ScratchSize)
+{
+	passCount = 0;
+	resourceCount = 0;
+}
+
+// --------------------------------------------------------
+// The passes and resources stay allocated (with their lists'
+// room) for the next frame to fill in again, so a frame that
+// builds the same graph doesn't allocate
+// --------------------------------------------------------
+void RenderGraph::Clear()
+{
+	for (int p = 0; p < passCount; p++)
+		passes[p].Execute = nullptr;
+	resourceCount = 0;
+	passCount = 0;
+	order.clear();
+	physicalDescs.clear();
+	finalUnbinds.clear();
+}
+
+int RenderGraph::CreateTexture(const char* name, const RenderGraphTextureDesc& desc)
+{
+	if (resourceCount == (int)resources.size())
+		resources.push_back(Resource());
+
+	Resource& resource = resources[resourceCount];
+	resource.Name = name;
+	resource.Desc = desc;
+	resource.Imported = false;
+	resource.Output = false;
+	resource.FirstUse = -1;
+	resource.LastUse = -1;
+	resource.Physical = -1;
+	return resourceCount++;
+}
+
+int RenderGraph::ImportTexture(const char* name, const RenderGraphTextureDesc& desc)
+{
+	int resource = CreateTexture(name, desc);
+	resources[resource].Imported = true;
+	return resource;
+}
+
+void RenderGraph::MarkOutput(int resource)
+{
+	resources[resource].Output = true;
+}
+
+int RenderGraph::AddPass(const char* name, const ExecuteFunction& execute)
+{
+	if (passCount == (int)passes.size())
+		passes.push_back(Pass());
+
+	Pass& pass = passes[passCount];
+	pass.Name = name;
+	pass.Execute = execute;
+	pass.Reads.clear();
+	pass.Writes.clear();
+	pass.SideEffects = false;
+	pass.Culled = false;
+	pass.DependsOn.clear();
+	pass.After.clear();
+	pass.Unbinds.clear();
+	return passCount++;
+}
+
+void RenderGraph::Read(int pass, int resource)
+{
+	passes[pass].Reads.push_back(resource);
+}
+
+void RenderGraph::Write(int pass, int resource)
+{
+	passes[pass].Writes.push_back(resource);
+}
+
+void RenderGraph::SetSideEffects(int pass)
+{
+	passes[pass].SideEffects = true;
+}
+
+int RenderGraph::GetCulledCount()
+{
+	int culled = 0;
+	for (int p = 0; p < passCount; p++)
+	{
+		if (passes[p].Culled)
+			culled++;
+	}
+	return culled;
+}
+
+void RenderGraph::Execute(int pass, ID3D11DeviceContext* context)
+{
+	if (passes[pass].Execute)
+		passes[pass].Execute(context);
+}
+
+bool RenderGraph::Compile()
+{
+	order.clear();
+	physicalDescs.clear();
+	finalUnbinds.clear();
+	scratch.Reset();
+	for (int p = 0; p < passCount; p++)
+	{
+		passes[p].DependsOn.clear();
+		passes[p].After.clear();
+		passes[p].Unbinds.clear();
+	}
+
+	FindDependencies();
+	Cull();
+	if (!Sort())
+		return false;
+	AssignPhysical();
+	FindUnbinds();
+	return true;
+}
+
+// --------------------------------------------------------
+// Walks the passes in the order they were added, following
+// each resource's writes: a read depends on the write before
+// it, a write depends on the write it replaces and has to
+// wait for everything that read the old contents.  Reads
+// with no write before them wait for the first write after.
+// --------------------------------------------------------
+void RenderGraph::FindDependencies()
+{
+	ArenaAllocator<int> allocator(&scratch);
+	ArenaVector<int> lastWriter(resourceCount, -1, allocator);
+	ArenaVector<ArenaVector<int>> readersSinceWrite(resourceCount, ArenaVector<int>(allocator), allocator);
+	ArenaVector<ArenaVector<int>> waitingReaders(resourceCount, ArenaVector<int>(allocator), allocator);
+
+	for (int p = 0; p < passCount; p++)
+	{
+		Pass& pass = passes[p];
+
+		for (size_t i = 0; i < pass.Reads.size(); i++)
+		{
+			int r = pass.Reads[i];
+			if (lastWriter[r] >= 0)
+			{
+				pass.DependsOn.push_back(lastWriter[r]);
+				readersSinceWrite[r].push_back(p);
+			}
+			else
+			{
+				waitingReaders[r].push_back(p);
+			}
+		}
+
+		for (size_t i = 0; i < pass.Writes.size(); i++)
+		{
+			int w = pass.Writes[i];
+			if (lastWriter[w] >= 0 && lastWriter[w] != p)
+				pass.DependsOn.push_back(lastWriter[w]);
+
+			for (size_t q = 0; q < readersSinceWrite[w].size(); q++)
+			{
+				if (readersSinceWrite[w][q] != p)
+					pass.After.push_back(readersSinceWrite[w][q]);
+			}
+
+			// Readers of the old contents are dealt with; this
+			// write's readers start with the ones waiting for it
+			readersSinceWrite[w].clear();
+			for (size_t q = 0; q < waitingReaders[w].size(); q++)
+			{
+				int reader = waitingReaders[w][q];
+				if (reader != p)
+				{
+					passes[reader].DependsOn.push_back(p);
+					readersSinceWrite[w].push_back(reader);
+				}
+			}
+			waitingReaders[w].clear();
+			lastWriter[w] = p;
+		}
+	}
+
+	for (int p = 0; p < passCount; p++)
+	{
+		std::vector<int>& dependsOn = passes[p].DependsOn;
+		std::sort(dependsOn.begin(), dependsOn.end());
+		dependsOn.erase(std::unique(dependsOn.begin(), dependsOn.end()), dependsOn.end());
+	}
+}
+
+// --------------------------------------------------------
+// Keeps the passes with side effects or writing an output,
+// and everything they depend on
+// --------------------------------------------------------
+void RenderGraph::Cull()
+{
+	ArenaAllocator<int> allocator(&scratch);
+	ArenaVector<int> needed(allocator);
+	needed.reserve(passCount);
+	for (int p = 0; p < passCount; p++)
+	{
+		passes[p].Culled = true;
+
+		bool root = passes[p].SideEffects;
+		for (size_t i = 0; i < passes[p].Writes.size(); i++)
+			root = root || resources[passes[p].Writes[i]].Output;
+
+		if (root)
+		{
+			passes[p].Culled = false;
+			needed.push_back(p);
+		}
+	}
+
+	while (!needed.empty())
+	{
+		int p = needed.back();
+		needed.pop_back();
+		for (size_t i = 0; i < passes[p].DependsOn.size(); i++)
+		{
+			int dependency = passes[p].DependsOn[i];
+			if (passes[dependency].Culled)
+			{
+				passes[dependency].Culled = false;
+				needed.push_back(dependency);
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------
+// Orders the kept passes so each runs after everything it
+// depends on.  Ties go to the pass added first, so the order
+// only moves away from the one passes were added in where it
+// has to.
+// --------------------------------------------------------
+bool RenderGraph::Sort()
+{
+	ArenaAllocator<int> allocator(&scratch);
+	ArenaVector<int> waitingOn(passCount, 0, allocator);
+	ArenaVector<ArenaVector<int>> unlocks(passCount, ArenaVector<int>(allocator), allocator);
+	ArenaVector<int> before(allocator);
+	int keptCount = 0;
+
+	for (int p = 0; p < passCount; p++)
+	{
+		if (passes[p].Culled)
+			continue;
+		keptCount++;
+
+		before.assign(passes[p].DependsOn.begin(), passes[p].DependsOn.end());
+		before.insert(before.end(), passes[p].After.begin(), passes[p].After.end());
+		std::sort(before.begin(), before.end());
+		before.erase(std::unique(before.begin(), before.end()), before.end());
+
+		for (size_t i = 0; i < before.size(); i++)
+		{
+			if (passes[before[i]].Culled)
+				continue;
+			waitingOn[p]++;
+			unlocks[before[i]].push_back(p);
+		}
+	}
+
+	ArenaVector<char> done(passCount, 0, ArenaAllocator<char>(&scratch));
+	while ((int)order.size() < keptCount)
+	{
+		int next = -1;
+		for (int p = 0; p < passCount; p++)
+		{
+			if (!passes[p].Culled && !done[p] && waitingOn[p] == 0)
+			{
+				next = p;
+				break;
+			}
+		}
+
+		// Everything left is waiting on something else left
+		if (next < 0)
+		{
+			order.clear();
+			return false;
+		}
+
+		done[next] = true;
+		order.push_back(next);
+		for (size_t i = 0; i < unlocks[next].size(); i++)
+			waitingOn[unlocks[next][i]]--;
+	}
+
+	return true;
+}
+
+// --------------------------------------------------------
+// Works out when each resource is used, then hands transients
+// physical slots in order of first use: a slot is reused when
+// its last user finished before this one starts and the descs
+// match, otherwise a new one is made
+// --------------------------------------------------------
+void RenderGraph::AssignPhysical()
+{
+	for (int r = 0; r < resourceCount; r++)
+	{
+		resources[r].FirstUse = -1;
+		resources[r].LastUse = -1;
+		resources[r].Physical = -1;
+	}
+
+	for (int position = 0; position < (int)order.size(); position++)
+	{
+		const Pass& pass = passes[order[position]];
+		for (int use = 0; use < 2; use++)
+		{
+			const std::vector<int>& used = use == 0 ? pass.Reads : pass.Writes;
+			for (size_t i = 0; i < used.size(); i++)
+			{
+				Resource& resource = resources[used[i]];
+				if (resource.FirstUse < 0)
+					resource.FirstUse = position;
+				resource.LastUse = position;
+			}
+		}
+	}
+
+	ArenaAllocator<int> allocator(&scratch);
+	ArenaVector<int> transients(allocator);
+	transients.reserve(resourceCount);
+	for (int r = 0; r < resourceCount; r++)
+	{
+		if (!resources[r].Imported && resources[r].FirstUse >= 0)
+			transients.push_back(r);
+	}
+
+	// Ties stay in the order they were created (std::stable_sort
+	// would want a buffer from the heap)
+	std::sort(transients.begin(), transients.end(), [this](int a, int b)
+	{
+		if (resources[a].FirstUse != resources[b].FirstUse)
+			return resources[a].FirstUse < resources[b].FirstUse;
+		return a < b;
+	});
+
+	ArenaVector<int> physicalLastUse(allocator);
+	physicalLastUse.reserve(transients.size());
+	for (size_t t = 0; t < transients.size(); t++)
+	{
+		Resource& resource = resources[transients[t]];
+		for (int slot = 0; slot < (int)physicalDescs.size(); slot++)
+		{
+			if (physicalLastUse[slot] < resource.FirstUse && physicalDescs[slot] == resource.Desc)
+			{
+				resource.Physical = slot;
+				break;
+			}
+		}
+
+		if (resource.Physical < 0)
+		{
+			resource.Physical = (int)physicalDescs.size();
+			physicalDescs.push_back(resource.Desc);
+			physicalLastUse.push_back(-1);
+		}
+		physicalLastUse[resource.Physical] = resource.LastUse;
+	}
+}
+
+// Resources that alias the same slot are one texture as far as
+// binding goes
+int RenderGraph::GetBindingKey(int resource)
+{
+	if (resources[resource].Imported || resources[resource].Physical < 0)
+		return resource;
+	return resourceCount + resources[resource].Physical;
+}
+
+// --------------------------------------------------------
+// Plays the order through, tracking what's bound: a pass
+// binds its writes as the targets (replacing the last pass's)
+// and its reads as SRVs (which stay bound until something
+// unbinds them)
+// --------------------------------------------------------
+void RenderGraph::FindUnbinds()
+{
+	int keyCount = resourceCount + (int)physicalDescs.size();
+	ArenaAllocator<int> allocator(&scratch);
+	ArenaVector<int> boundAsSrv(keyCount, -1, allocator);
+	ArenaVector<int> boundAsTarget(keyCount, -1, allocator);
+
+	for (size_t position = 0; position < order.size(); position++)
+	{
+		Pass& pass = passes[order[position]];
+
+		for (size_t i = 0; i < pass.Writes.size(); i++)
+		{
+			int key = GetBindingKey(pass.Writes[i]);
+			if (boundAsSrv[key] >= 0)
+			{
+				RenderGraphUnbind unbind = { boundAsSrv[key], RENDER_GRAPH_SRV };
+				pass.Unbinds.push_back(unbind);
+				boundAsSrv[key] = -1;
+			}
+		}
+
+		// (Not what the pass also writes: that stays a target)
+		for (size_t i = 0; i < pass.Reads.size(); i++)
+		{
+			int key = GetBindingKey(pass.Reads[i]);
+			if (boundAsTarget[key] >= 0 && std::find(pass.Writes.begin(), pass.Writes.end(), pass.Reads[i]) == pass.Writes.end())
+			{
+				RenderGraphUnbind unbind = { boundAsTarget[key], RENDER_GRAPH_TARGET };
+				pass.Unbinds.push_back(unbind);
+				boundAsTarget[key] = -1;
+			}
+		}
+
+		std::fill(boundAsTarget.begin(), boundAsTarget.end(), -1);
+		for (size_t i = 0; i < pass.Writes.size(); i++)
+			boundAsTarget[GetBindingKey(pass.Writes[i])] = pass.Writes[i];
+
+		// Something read and written by the same pass (say a depth
+		// test against a buffer it also writes) is bound as a target
+		for (size_t i = 0; i < pass.Reads.size(); i++)
+		{
+			int key = GetBindingKey(pass.Reads[i]);
+			if (boundAsTarget[key] < 0)
+				boundAsSrv[key] = pass.Reads[i];
+		}
+	}
+
+	for (int key = 0; key < keyCount; key++)
+	{
+		if (boundAsSrv[key] >= 0)
+		{
+			RenderGraphUnbind unbind = { boundAsSrv[key], RENDER_GRAPH_SRV };
+			finalUnbinds.push_back(unbind);
+		}
+	}
+}
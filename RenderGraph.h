@@ -0,0 +1,175 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "FrameArena.h"
+
+// Only passed through to the passes, so D3D isn't needed to
+// build this (or to compile graphs headless)
+struct ID3D11DeviceContext;
+
+// What a virtual texture needs to be.  Format and BindFlags are
+// a DXGI_FORMAT and D3D11_BIND_* flags, but they're only
+// compared here - two textures can share memory only if every
+// field matches.
+struct RenderGraphTextureDesc
+{
+	int Width;
+	int Height;
+	int ArraySize;
+	unsigned int Format;
+	unsigned int BindFlags;
+
+	bool operator==(const RenderGraphTextureDesc& other) const;
+	bool operator!=(const RenderGraphTextureDesc& other) const { return !(*this == other); }
+};
+
+// How a pass uses a resource: read through an SRV, or written
+// as a render target / depth buffer
+enum RenderGraphBinding
+{
+	RENDER_GRAPH_SRV,
+	RENDER_GRAPH_TARGET
+};
+
+// A binding left over from an earlier pass that has to go
+// before the next pass runs (D3D11 won't let one texture be
+// an SRV and a target at the same time)
+struct RenderGraphUnbind
+{
+	int Resource;
+	RenderGraphBinding Binding;
+};
+
+// --------------------------------------------------------
+// A frame described as passes that read and write virtual
+// textures, compiled into the order to run them in.
+//
+// Each frame: create (transient) or import (owned elsewhere -
+// the back buffer, caches kept across frames) the textures,
+// add passes and declare what each reads and writes, mark
+// what the frame has to produce, then Compile():
+//  - Passes nothing needs are culled: only passes with side
+//    effects and those writing an output are roots, and only
+//    what they (transitively) read is kept
+//  - The rest are ordered so every read comes after the write
+//    it depends on and before the next write
+//  - Each transient gets a physical slot.  Transients whose
+//    lifetimes don't overlap share a slot when their descs
+//    match, so they alias the same memory
+//  - Before each pass, the SRVs it's about to write over and
+//    the targets it's about to read are unbound; whatever is
+//    still bound as an SRV at the end is unbound after the
+//    last pass
+//
+// A read refers to the latest write declared before it, or,
+// if there's none, to the first write declared after it - so
+// passes can be added in any order when each texture has one
+// writer.
+//
+// This is all CPU bookkeeping; creating the physical textures
+// and applying unbinds is up to the caller (see
+// RenderGraphTextures for D3D11).  Building the same graph
+// every frame doesn't allocate: passes and resources are kept
+// for reuse, and Compile()'s working lists come from an arena.
+// --------------------------------------------------------
+class RenderGraph
+{
+public:
+	// Records the pass on the given context
+	typedef std::function<void(ID3D11DeviceContext* context)> ExecuteFunction;
+
+	RenderGraph();
+
+	// Forgets every resource and pass (start of a frame)
+	void Clear();
+
+	// Resources - return a handle
+	int CreateTexture(const char* name, const RenderGraphTextureDesc& desc);
+	int ImportTexture(const char* name, const RenderGraphTextureDesc& desc);
+	void MarkOutput(int resource);		// The frame must produce this (e.g. the back buffer)
+
+	// Passes - AddPass returns a handle for declaring its uses
+	int AddPass(const char* name, const ExecuteFunction& execute);
+	void Read(int pass, int resource);
+	void Write(int pass, int resource);
+	void SetSideEffects(int pass);		// Never culled
+
+	// Returns false (and runs nothing) if the passes' reads and
+	// writes form a cycle
+	bool Compile();
+
+	// Results of the last Compile()
+	const std::vector<int>& GetOrder() { return order; }		// Passes to run, in order
+	bool IsCulled(int pass) { return passes[pass].Culled; }
+	const std::vector<RenderGraphUnbind>& GetUnbinds(int pass) { return passes[pass].Unbinds; }	// Before the pass
+	const std::vector<RenderGraphUnbind>& GetFinalUnbinds() { return finalUnbinds; }				// After the last pass
+	int GetFirstUse(int resource) { return resources[resource].FirstUse; }	// Positions in GetOrder(), -1 if unused
+	int GetLastUse(int resource) { return resources[resource].LastUse; }
+	int GetPhysical(int resource) { return resources[resource].Physical; }	// Slot, -1 if imported or unused
+	int GetPhysicalCount() { return (int)physicalDescs.size(); }
+	const RenderGraphTextureDesc& GetPhysicalDesc(int physical) { return physicalDescs[physical]; }
+	int GetCulledCount();
+
+	// Runs a compiled pass's function
+	void Execute(int pass, ID3D11DeviceContext* context);
+
+	int GetPassCount() { return passCount; }
+	const char* GetPassName(int pass) { return passes[pass].Name.c_str(); }
+	const std::vector<int>& GetReads(int pass) { return passes[pass].Reads; }
+	const std::vector<int>& GetWrites(int pass) { return passes[pass].Writes; }
+
+	int GetResourceCount() { return resourceCount; }
+	const char* GetResourceName(int resource) { return resources[resource].Name.c_str(); }
+	const RenderGraphTextureDesc& GetDesc(int resource) { return resources[resource].Desc; }
+	bool IsImported(int resource) { return resources[resource].Imported; }
+
+private:
+	struct Resource
+	{
+		std::string Name;
+		RenderGraphTextureDesc Desc;
+		bool Imported;
+		bool Output;
+
+		int FirstUse;
+		int LastUse;
+		int Physical;
+	};
+
+	struct Pass
+	{
+		std::string Name;
+		ExecuteFunction Execute;
+		std::vector<int> Reads;
+		std::vector<int> Writes;
+		bool SideEffects;
+
+		std::vector<int> DependsOn;	// Passes whose results this reads (or writes over)
+		std::vector<int> After;		// Passes that only have to run first (they read what this writes)
+		bool Culled;
+		std::vector<RenderGraphUnbind> Unbinds;
+	};
+
+	static const size_t ScratchSize = 16 * 1024;	// To start with; it grows to fit
+
+	// Only the first resourceCount / passCount are this frame's
+	std::vector<Resource> resources;
+	std::vector<Pass> passes;
+	int resourceCount;
+	int passCount;
+	LinearArena scratch;
+
+	std::vector<int> order;
+	std::vector<RenderGraphTextureDesc> physicalDescs;
+	std::vector<RenderGraphUnbind> finalUnbinds;
+
+	void FindDependencies();
+	void Cull();
+	bool Sort();
+	void AssignPhysical();
+	void FindUnbinds();
+	int GetBindingKey(int resource);
+};
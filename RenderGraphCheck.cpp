@@ -0,0 +1,654 @@
+// --------------------------------------------------------
+// Offline tool: compiles hand made and random render graphs
+// (see RenderGraph) and checks what Compile() decides
+// (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 RenderGraphCheck.cpp RenderGraph.cpp FrameArena.cpp -o RenderGraphCheck
+//   ./RenderGraphCheck
+//
+// Options: --graphs N (random graphs, default 20000) and
+// --seed N (default 43).
+//
+// Every graph is checked against the rules in RenderGraph.h,
+// worked out here the long way: which write each read refers
+// to, which passes are kept, and whether what's kept has a
+// cycle.  Fails (returns 1) if a pass nothing needs is kept
+// (or a needed one culled), if the order breaks a dependency
+// or isn't the one that keeps to the order passes were added
+// in wherever it can, if a cycle compiles (or a graph without
+// one doesn't), if two textures share a slot with different
+// descs or overlapping lifetimes, or if playing the order
+// through with the unbinds applied ever leaves a texture
+// bound as an SRV and a target at once (or something bound
+// after the last pass, or an unbind of something that wasn't
+// bound).  Building the same graph again after Clear() has to
+// compile the same way and run the same functions.
+// --------------------------------------------------------
+
+#include "RenderGraph.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+static int failures = 0;
+
+static void Check(bool ok, const char* graph, const char* what)
+{
+	if (!ok)
+	{
+		if (failures < 20)
+			printf("  FAILED (%s): %s\n", graph, what);
+		failures++;
+	}
+}
+
+// A graph as plain lists, so it can be built more than once
+struct GraphSpec
+{
+	struct Texture { RenderGraphTextureDesc Desc; bool Imported; bool Output; };
+	struct PassSpec { std::vector<int> Reads; std::vector<int> Writes; bool SideEffects; };
+	std::vector<Texture> Textures;
+	std::vector<PassSpec> Passes;
+};
+
+// Passes' functions note what ran here
+static std::vector<int> ran;
+
+static void Build(const GraphSpec& spec, RenderGraph& graph)
+{
+	graph.Clear();
+	for (size_t t = 0; t < spec.Textures.size(); t++)
+	{
+		const GraphSpec::Texture& texture = spec.Textures[t];
+		int resource = texture.Imported ? graph.ImportTexture("Imported", texture.Desc) : graph.CreateTexture("Transient", texture.Desc);
+		if (texture.Output)
+			graph.MarkOutput(resource);
+	}
+	for (size_t p = 0; p < spec.Passes.size(); p++)
+	{
+		int index = (int)p;
+		int pass = graph.AddPass("Pass", [index](ID3D11DeviceContext*) { ran.push_back(index); });
+		for (size_t i = 0; i < spec.Passes[p].Reads.size(); i++)
+			graph.Read(pass, spec.Passes[p].Reads[i]);
+		for (size_t i = 0; i < spec.Passes[p].Writes.size(); i++)
+			graph.Write(pass, spec.Passes[p].Writes[i]);
+		if (spec.Passes[p].SideEffects)
+			graph.SetSideEffects(pass);
+	}
+}
+
+static bool Contains(const std::vector<int>& list, int value)
+{
+	for (size_t i = 0; i < list.size(); i++)
+	{
+		if (list[i] == value)
+			return true;
+	}
+	return false;
+}
+
+// --------------------------------------------------------
+// The rules, the long way round.  A read refers to the last
+// write before its pass or, failing that, the first write
+// after it (none if that's its own pass).  A pass needs what
+// its reads refer to and the write each of its writes
+// replaces; it also has to wait for the readers of what it
+// replaces.
+// --------------------------------------------------------
+struct Expected
+{
+	std::vector<bool> Kept;
+	std::vector<std::vector<int>> Needs;	// Per pass: passes that must be kept (and run) first
+	std::vector<std::vector<int>> Before;	// Per pass: every pass that has to run first
+	bool HasCycle;
+	std::vector<int> Order;					// Empty if there's a cycle
+};
+
+static int GetProducer(const GraphSpec& spec, int pass, int resource)
+{
+	for (int q = pass - 1; q >= 0; q--)
+	{
+		if (Contains(spec.Passes[q].Writes, resource))
+			return q;
+	}
+	for (int q = pass; q < (int)spec.Passes.size(); q++)
+	{
+		if (Contains(spec.Passes[q].Writes, resource))
+			return q == pass ? -1 : q;
+	}
+	return -1;
+}
+
+static void Work(const GraphSpec& spec, Expected& expected)
+{
+	int passCount = (int)spec.Passes.size();
+	expected.Needs.assign(passCount, std::vector<int>());
+	expected.Before.assign(passCount, std::vector<int>());
+
+	for (int p = 0; p < passCount; p++)
+	{
+		for (size_t i = 0; i < spec.Passes[p].Reads.size(); i++)
+		{
+			int producer = GetProducer(spec, p, spec.Passes[p].Reads[i]);
+			if (producer >= 0)
+				expected.Needs[p].push_back(producer);
+		}
+
+		for (size_t i = 0; i < spec.Passes[p].Writes.size(); i++)
+		{
+			int resource = spec.Passes[p].Writes[i];
+			int replaced = -1;
+			for (int q = p - 1; q >= 0 && replaced < 0; q--)
+			{
+				if (Contains(spec.Passes[q].Writes, resource))
+					replaced = q;
+			}
+			if (replaced < 0)
+				continue;
+
+			expected.Needs[p].push_back(replaced);
+			for (int q = 0; q < passCount; q++)
+			{
+				if (q != p && Contains(spec.Passes[q].Reads, resource) && GetProducer(spec, q, resource) == replaced)
+					expected.Before[p].push_back(q);
+			}
+		}
+		expected.Before[p].insert(expected.Before[p].end(), expected.Needs[p].begin(), expected.Needs[p].end());
+	}
+
+	// Kept: the roots and everything they need
+	expected.Kept.assign(passCount, false);
+	std::vector<int> stack;
+	for (int p = 0; p < passCount; p++)
+	{
+		bool root = spec.Passes[p].SideEffects;
+		for (size_t i = 0; i < spec.Passes[p].Writes.size(); i++)
+			root = root || spec.Textures[spec.Passes[p].Writes[i]].Output;
+		if (root)
+		{
+			expected.Kept[p] = true;
+			stack.push_back(p);
+		}
+	}
+	while (!stack.empty())
+	{
+		int p = stack.back();
+		stack.pop_back();
+		for (size_t i = 0; i < expected.Needs[p].size(); i++)
+		{
+			int q = expected.Needs[p][i];
+			if (!expected.Kept[q])
+			{
+				expected.Kept[q] = true;
+				stack.push_back(q);
+			}
+		}
+	}
+
+	// The order: over and over, the first pass added that's kept,
+	// not placed yet, and has everything it waits for placed
+	std::vector<bool> placed(passCount, false);
+	int keptCount = 0;
+	for (int p = 0; p < passCount; p++)
+		keptCount += expected.Kept[p] ? 1 : 0;
+
+	expected.Order.clear();
+	expected.HasCycle = false;
+	while ((int)expected.Order.size() < keptCount)
+	{
+		int next = -1;
+		for (int p = 0; p < passCount && next < 0; p++)
+		{
+			if (!expected.Kept[p] || placed[p])
+				continue;
+			bool ready = true;
+			for (size_t i = 0; i < expected.Before[p].size() && ready; i++)
+			{
+				int q = expected.Before[p][i];
+				ready = q == p || !expected.Kept[q] || placed[q];
+			}
+			if (ready)
+				next = p;
+		}
+		if (next < 0)
+		{
+			expected.HasCycle = true;
+			expected.Order.clear();
+			return;
+		}
+		placed[next] = true;
+		expected.Order.push_back(next);
+	}
+}
+
+// Textures that share a slot are one texture when binding
+static int GetBindingKey(RenderGraph& graph, int resource)
+{
+	int physical = graph.GetPhysical(resource);
+	return physical < 0 ? resource : graph.GetResourceCount() + physical;
+}
+
+// --------------------------------------------------------
+// Plays the compiled order through the way D3D11 binds: each
+// pass's unbinds, then its writes replace the targets and its
+// reads (not also written) are bound as SRVs, which stay bound
+// until unbound
+// --------------------------------------------------------
+static void CheckBinding(RenderGraph& graph, const char* name)
+{
+	int keyCount = graph.GetResourceCount() + graph.GetPhysicalCount();
+	std::vector<int> srv(keyCount, -1);
+	std::vector<int> target(keyCount, -1);
+	const std::vector<int>& order = graph.GetOrder();
+
+	for (size_t position = 0; position < order.size(); position++)
+	{
+		int pass = order[position];
+		const std::vector<int>& reads = graph.GetReads(pass);
+		const std::vector<int>& writes = graph.GetWrites(pass);
+
+		const std::vector<RenderGraphUnbind>& unbinds = graph.GetUnbinds(pass);
+		for (size_t u = 0; u < unbinds.size(); u++)
+		{
+			std::vector<int>& bound = unbinds[u].Binding == RENDER_GRAPH_SRV ? srv : target;
+			int key = GetBindingKey(graph, unbinds[u].Resource);
+			Check(bound[key] == unbinds[u].Resource, name, "unbind of something that isn't bound");
+			bound[key] = -1;
+		}
+
+		for (size_t i = 0; i < writes.size(); i++)
+			Check(srv[GetBindingKey(graph, writes[i])] < 0, name, "pass writes a texture still bound as an SRV");
+		for (size_t i = 0; i < reads.size(); i++)
+		{
+			if (!Contains(writes, reads[i]))
+				Check(target[GetBindingKey(graph, reads[i])] < 0, name, "pass reads a texture still bound as a target");
+		}
+
+		std::fill(target.begin(), target.end(), -1);
+		for (size_t i = 0; i < writes.size(); i++)
+			target[GetBindingKey(graph, writes[i])] = writes[i];
+		for (size_t i = 0; i < reads.size(); i++)
+		{
+			int key = GetBindingKey(graph, reads[i]);
+			if (target[key] < 0)
+				srv[key] = reads[i];
+		}
+	}
+
+	const std::vector<RenderGraphUnbind>& finalUnbinds = graph.GetFinalUnbinds();
+	for (size_t u = 0; u < finalUnbinds.size(); u++)
+	{
+		int key = GetBindingKey(graph, finalUnbinds[u].Resource);
+		Check(finalUnbinds[u].Binding == RENDER_GRAPH_SRV, name, "final unbind of a target");
+		Check(srv[key] == finalUnbinds[u].Resource, name, "final unbind of something that isn't bound");
+		srv[key] = -1;
+	}
+	for (int key = 0; key < keyCount; key++)
+		Check(srv[key] < 0, name, "SRV still bound after the last pass");
+}
+
+// Lifetimes and slots: a transient used in the order has a
+// slot with its desc, and slot mates never overlap
+static void CheckAliasing(RenderGraph& graph, const char* name, int& aliased)
+{
+	const std::vector<int>& order = graph.GetOrder();
+	int resourceCount = graph.GetResourceCount();
+	for (int r = 0; r < resourceCount; r++)
+	{
+		int first = -1;
+		int last = -1;
+		for (int position = 0; position < (int)order.size(); position++)
+		{
+			if (Contains(graph.GetReads(order[position]), r) || Contains(graph.GetWrites(order[position]), r))
+			{
+				if (first < 0)
+					first = position;
+				last = position;
+			}
+		}
+		Check(graph.GetFirstUse(r) == first && graph.GetLastUse(r) == last, name, "lifetime");
+
+		int physical = graph.GetPhysical(r);
+		if (graph.IsImported(r) || first < 0)
+		{
+			Check(physical < 0, name, "imported or unused texture got a slot");
+			continue;
+		}
+		Check(physical >= 0 && physical < graph.GetPhysicalCount(), name, "used transient without a slot");
+		if (physical < 0 || physical >= graph.GetPhysicalCount())
+			continue;
+		Check(graph.GetPhysicalDesc(physical) == graph.GetDesc(r), name, "slot's desc differs from its texture's");
+
+		for (int other = r + 1; other < resourceCount; other++)
+		{
+			if (graph.GetPhysical(other) != physical || graph.IsImported(other))
+				continue;
+			aliased++;
+			Check(graph.GetDesc(other) == graph.GetDesc(r), name, "textures with different descs share a slot");
+			Check(graph.GetLastUse(other) < graph.GetFirstUse(r) || graph.GetLastUse(r) < graph.GetFirstUse(other), name,
+				"textures with overlapping lifetimes share a slot");
+		}
+	}
+}
+
+// Compiles the graph twice over (the second time reusing the
+// graph's passes and resources) and checks it against the
+// rules.  Returns whether it compiled.
+static bool CheckGraph(const GraphSpec& spec, RenderGraph& graph, const char* name, int& aliased)
+{
+	Expected expected;
+	Work(spec, expected);
+
+	Build(spec, graph);
+	bool compiled = graph.Compile();
+	Check(compiled == !expected.HasCycle, name, compiled ? "compiled with a cycle" : "didn't compile without a cycle");
+	if (!compiled)
+	{
+		Check(graph.GetOrder().empty(), name, "failed compile left an order");
+		return false;
+	}
+
+	for (int p = 0; p < graph.GetPassCount(); p++)
+		Check(graph.IsCulled(p) == !expected.Kept[p], name, expected.Kept[p] ? "needed pass culled" : "pass nothing needs kept");
+	Check(graph.GetOrder() == expected.Order, name, "order isn't the first one added wherever it can be");
+
+	const std::vector<int>& order = graph.GetOrder();
+	for (size_t position = 0; position < order.size(); position++)
+	{
+		const std::vector<int>& before = expected.Before[order[position]];
+		for (size_t i = 0; i < before.size(); i++)
+		{
+			bool placedFirst = false;
+			for (size_t earlier = 0; earlier < position; earlier++)
+				placedFirst = placedFirst || order[earlier] == before[i];
+			Check(placedFirst || before[i] == order[position] || !expected.Kept[before[i]], name, "pass runs before one it waits for");
+		}
+	}
+
+	CheckAliasing(graph, name, aliased);
+	CheckBinding(graph, name);
+
+	// Again, reusing what the last build left
+	std::vector<int> firstOrder = graph.GetOrder();
+	std::vector<int> firstPhysical;
+	for (int r = 0; r < graph.GetResourceCount(); r++)
+		firstPhysical.push_back(graph.GetPhysical(r));
+
+	Build(spec, graph);
+	Check(graph.Compile(), name, "didn't compile the second time");
+	Check(graph.GetOrder() == firstOrder, name, "second compile ordered differently");
+	for (int r = 0; r < graph.GetResourceCount(); r++)
+		Check(graph.GetPhysical(r) == firstPhysical[r], name, "second compile assigned different slots");
+
+	ran.clear();
+	for (size_t position = 0; position < firstOrder.size(); position++)
+		graph.Execute(firstOrder[position], 0);
+	Check(ran == firstOrder, name, "Execute() ran the wrong passes' functions");
+	return true;
+}
+
+static const RenderGraphTextureDesc ColorDesc = { 256, 256, 1, 28, 0x28 };		// R8G8B8A8_UNORM, target + SRV
+static const RenderGraphTextureDesc OtherBindDesc = { 256, 256, 1, 28, 0x20 };	// Only the bind flags differ
+static const RenderGraphTextureDesc DepthDesc = { 256, 256, 1, 45, 0x40 };
+
+static int AddTexture(GraphSpec& spec, const RenderGraphTextureDesc& desc, bool imported, bool output)
+{
+	GraphSpec::Texture texture = { desc, imported, output };
+	spec.Textures.push_back(texture);
+	return (int)spec.Textures.size() - 1;
+}
+
+static int AddPass(GraphSpec& spec, std::vector<int> reads, std::vector<int> writes, bool sideEffects)
+{
+	GraphSpec::PassSpec pass = { reads, writes, sideEffects };
+	spec.Passes.push_back(pass);
+	return (int)spec.Passes.size() - 1;
+}
+
+static bool SameUnbinds(const std::vector<RenderGraphUnbind>& unbinds, const std::vector<RenderGraphUnbind>& expected)
+{
+	if (unbinds.size() != expected.size())
+		return false;
+	for (size_t u = 0; u < unbinds.size(); u++)
+	{
+		if (unbinds[u].Resource != expected[u].Resource || unbinds[u].Binding != expected[u].Binding)
+			return false;
+	}
+	return true;
+}
+
+// --------------------------------------------------------
+// Graphs small enough to know the answer to
+// --------------------------------------------------------
+static void CheckHandMade(RenderGraph& graph)
+{
+	int aliased = 0;
+
+	// Culling: only what the back buffer and a side effect need
+	{
+		printf("Culling\n");
+		GraphSpec spec;
+		int back = AddTexture(spec, ColorDesc, true, true);
+		int unread = AddTexture(spec, ColorDesc, false, false);
+		int shadow = AddTexture(spec, DepthDesc, false, false);
+		int deadHead = AddTexture(spec, ColorDesc, false, false);
+		int deadTail = AddTexture(spec, ColorDesc, false, false);
+		AddPass(spec, {}, { unread }, false);			// 0: nothing reads it
+		AddPass(spec, {}, { shadow }, false);			// 1
+		AddPass(spec, { shadow }, { back }, false);		// 2: writes the output
+		AddPass(spec, {}, { deadHead }, false);			// 3: only feeds 4
+		AddPass(spec, { deadHead }, { deadTail }, false);	// 4: nothing reads it
+		AddPass(spec, { back }, {}, true);				// 5: a read back
+		CheckGraph(spec, graph, "culling", aliased);
+		Check(graph.GetOrder() == std::vector<int>({ 1, 2, 5 }), "culling", "order");
+		Check(graph.GetCulledCount() == 3, "culling", "culled count");
+		Check(graph.GetPhysical(unread) < 0 && graph.GetPhysical(deadHead) < 0, "culling", "culled pass's texture got a slot");
+	}
+
+	// Order: readers added before their writers move after them;
+	// everything else keeps the order it was added in
+	{
+		printf("Order\n");
+		GraphSpec spec;
+		int back = AddTexture(spec, ColorDesc, true, true);
+		int x = AddTexture(spec, ColorDesc, false, false);
+		int y = AddTexture(spec, ColorDesc, false, false);
+		AddPass(spec, { x, y }, { back }, false);	// 0: waits for 1 and 2
+		AddPass(spec, {}, { y }, false);			// 1
+		AddPass(spec, {}, { x }, false);			// 2
+		AddPass(spec, {}, {}, true);				// 3: independent
+		CheckGraph(spec, graph, "order", aliased);
+		Check(graph.GetOrder() == std::vector<int>({ 1, 2, 0, 3 }), "order", "order");
+	}
+
+	// Overwriting: the second writer waits for the first one's
+	// readers
+	{
+		printf("Overwrite\n");
+		GraphSpec spec;
+		int history = AddTexture(spec, ColorDesc, false, false);
+		int first = AddTexture(spec, ColorDesc, true, true);
+		int second = AddTexture(spec, ColorDesc, true, true);
+		AddPass(spec, {}, { second }, false);				// 0: independent
+		AddPass(spec, {}, { history }, false);				// 1
+		AddPass(spec, {}, { history }, false);				// 2: replaces 1's
+		AddPass(spec, { history }, { second }, false);		// 3: reads 2's
+		AddPass(spec, { history }, { first }, false);		// 4: reads 2's
+		CheckGraph(spec, graph, "overwrite", aliased);
+		Check(graph.GetOrder() == std::vector<int>({ 0, 1, 2, 3, 4 }), "overwrite", "order");
+	}
+
+	// Cycles: one between kept passes fails, one between culled
+	// passes doesn't matter
+	{
+		printf("Cycles\n");
+		GraphSpec spec;
+		int back = AddTexture(spec, ColorDesc, true, true);
+		int x = AddTexture(spec, ColorDesc, false, false);
+		int y = AddTexture(spec, ColorDesc, false, false);
+		AddPass(spec, { x }, { y }, false);			// 0: reads 1's x
+		AddPass(spec, { y }, { x }, false);			// 1: reads 0's y
+		AddPass(spec, {}, { back }, false);			// 2
+		CheckGraph(spec, graph, "culled cycle", aliased);
+		Check(graph.GetOrder() == std::vector<int>({ 2 }), "culled cycle", "order");
+
+		spec.Passes[2].Reads.push_back(y);
+		Check(!CheckGraph(spec, graph, "kept cycle", aliased), "kept cycle", "compiled");
+	}
+
+	// Aliasing: a chain of same-desc textures alternates between
+	// two slots; one whose bind flags differ gets its own.  Also
+	// the unbinds this needs, one by one.
+	{
+		printf("Aliasing and unbinds\n");
+		GraphSpec spec;
+		int back = AddTexture(spec, ColorDesc, true, true);
+		int t0 = AddTexture(spec, ColorDesc, false, false);
+		int t1 = AddTexture(spec, ColorDesc, false, false);
+		int t2 = AddTexture(spec, ColorDesc, false, false);
+		int t3 = AddTexture(spec, OtherBindDesc, false, false);
+		int unused = AddTexture(spec, ColorDesc, false, false);
+		AddPass(spec, {}, { t0 }, false);			// 0
+		AddPass(spec, { t0 }, { t1 }, false);		// 1
+		AddPass(spec, { t1 }, { t2 }, false);		// 2
+		AddPass(spec, { t2 }, { t3 }, false);		// 3
+		AddPass(spec, { t3 }, { back }, false);		// 4
+		int before = aliased;
+		CheckGraph(spec, graph, "aliasing", aliased);
+		Check(aliased > before, "aliasing", "nothing shared a slot");
+		Check(graph.GetPhysical(t0) == 0 && graph.GetPhysical(t1) == 1 && graph.GetPhysical(t2) == 0 && graph.GetPhysical(t3) == 2,
+			"aliasing", "slots");
+		Check(graph.GetPhysicalCount() == 3, "aliasing", "slot count");
+		Check(graph.GetPhysical(back) < 0 && graph.GetPhysical(unused) < 0, "aliasing", "imported or unused texture got a slot");
+
+		RenderGraphUnbind t0Target = { t0, RENDER_GRAPH_TARGET };
+		RenderGraphUnbind t0Srv = { t0, RENDER_GRAPH_SRV };
+		RenderGraphUnbind t1Target = { t1, RENDER_GRAPH_TARGET };
+		RenderGraphUnbind t1Srv = { t1, RENDER_GRAPH_SRV };
+		RenderGraphUnbind t2Target = { t2, RENDER_GRAPH_TARGET };
+		RenderGraphUnbind t2Srv = { t2, RENDER_GRAPH_SRV };
+		RenderGraphUnbind t3Target = { t3, RENDER_GRAPH_TARGET };
+		RenderGraphUnbind t3Srv = { t3, RENDER_GRAPH_SRV };
+		Check(graph.GetUnbinds(0).empty(), "aliasing", "first pass unbinds");
+		Check(SameUnbinds(graph.GetUnbinds(1), { t0Target }), "aliasing", "pass 1 unbinds");
+		Check(SameUnbinds(graph.GetUnbinds(2), { t0Srv, t1Target }), "aliasing", "pass 2 unbinds (t2 is t0's memory)");
+		Check(SameUnbinds(graph.GetUnbinds(3), { t2Target }), "aliasing", "pass 3 unbinds");
+		Check(SameUnbinds(graph.GetUnbinds(4), { t3Target }), "aliasing", "pass 4 unbinds");
+		Check(SameUnbinds(graph.GetFinalUnbinds(), { t2Srv, t1Srv, t3Srv }), "aliasing", "final unbinds");
+	}
+
+	// A depth buffer tested against and written by one pass is a
+	// target, not an SRV; a later pass sampling it unbinds it
+	{
+		printf("Read and write\n");
+		GraphSpec spec;
+		int back = AddTexture(spec, ColorDesc, true, true);
+		int depth = AddTexture(spec, DepthDesc, true, false);
+		int scene = AddTexture(spec, ColorDesc, false, false);
+		AddPass(spec, {}, { depth }, false);					// 0: prepass
+		AddPass(spec, { depth }, { scene, depth }, false);		// 1
+		AddPass(spec, { scene, depth }, { back }, false);		// 2
+		CheckGraph(spec, graph, "read and write", aliased);
+		Check(graph.GetUnbinds(1).empty(), "read and write", "pass 1 unbound its own depth buffer");
+		RenderGraphUnbind sceneTarget = { scene, RENDER_GRAPH_TARGET };
+		RenderGraphUnbind depthTarget = { depth, RENDER_GRAPH_TARGET };
+		Check(SameUnbinds(graph.GetUnbinds(2), { sceneTarget, depthTarget }), "read and write", "pass 2 unbinds");
+	}
+}
+
+// --------------------------------------------------------
+// Random graphs: a few textures (some imported, some outputs,
+// a few descs so some can alias) and passes reading and
+// writing them at random
+// --------------------------------------------------------
+static void CheckRandom(RenderGraph& graph, int graphs, unsigned int seed)
+{
+	printf("Random\n");
+	std::mt19937 random(seed);
+	const RenderGraphTextureDesc descs[] = { ColorDesc, OtherBindDesc, DepthDesc };
+	int compiled = 0;
+	int cycles = 0;
+	int culled = 0;
+	int aliased = 0;
+
+	for (int g = 0; g < graphs; g++)
+	{
+		GraphSpec spec;
+		int textureCount = 1 + (int)(random() % 10);
+		for (int t = 0; t < textureCount; t++)
+			AddTexture(spec, descs[random() % 3], random() % 4 == 0, random() % 5 == 0);
+
+		int passCount = 1 + (int)(random() % 12);
+		for (int p = 0; p < passCount; p++)
+		{
+			std::vector<int> reads;
+			std::vector<int> writes;
+			int readCount = (int)(random() % 4);
+			int writeCount = (int)(random() % 3);
+			for (int i = 0; i < readCount; i++)
+			{
+				int t = (int)(random() % textureCount);
+				if (!Contains(reads, t))
+					reads.push_back(t);
+			}
+			for (int i = 0; i < writeCount; i++)
+			{
+				int t = (int)(random() % textureCount);
+				if (!Contains(writes, t))
+					writes.push_back(t);
+			}
+			AddPass(spec, reads, writes, random() % 8 == 0);
+		}
+
+		char name[32];
+		snprintf(name, sizeof(name), "random %d", g);
+		if (CheckGraph(spec, graph, name, aliased))
+		{
+			compiled++;
+			culled += graph.GetCulledCount();
+		}
+		else
+			cycles++;
+	}
+
+	printf("  %d graph(s): %d compiled, %d with cycles, %d pass(es) culled, %d texture pair(s) aliased\n",
+		graphs, compiled, cycles, culled, aliased);
+	Check(compiled > 0 && cycles > 0 && culled > 0 && aliased > 0, "random", "didn't cover compiling, cycles, culling and aliasing");
+}
+
+int main(int argc, char* argv[])
+{
+	int graphs = 20000;
+	unsigned int seed = 43;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--graphs") == 0 && hasValue)
+			graphs = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--seed") == 0 && hasValue)
+			seed = (unsigned int)atoi(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	// One graph for everything, so each build reuses what the
+	// last one left behind
+	RenderGraph graph;
+	CheckHandMade(graph);
+	CheckRandom(graph, graphs, seed);
+
+	if (failures > 0)
+	{
+		printf("\nFAILED: %d check(s)\n", failures);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
@@ -0,0 +1,306 @@
+#include "RenderGraphTextures.h"
+
+RenderGraphTextures::RenderGraphTextures(ID3D11Device* device)
+{
+	this->device = device;
+	graph = 0;
+}
+
+RenderGraphTextures::~RenderGraphTextures()
+{
+	for (size_t s = 0; s < slots.size(); s++)
+		ReleaseSlot(slots[s]);
+}
+
+// --------------------------------------------------------
+// Views of a typeless depth format: what the SRV reads it as
+// and what the depth view writes it as
+// --------------------------------------------------------
+static void GetViewFormats(DXGI_FORMAT format, DXGI_FORMAT& srvFormat, DXGI_FORMAT& dsvFormat)
+{
+	srvFormat = format;
+	dsvFormat = format;
+	switch (format)
+	{
+	case DXGI_FORMAT_R32_TYPELESS:
+		srvFormat = DXGI_FORMAT_R32_FLOAT;
+		dsvFormat = DXGI_FORMAT_D32_FLOAT;
+		break;
+	case DXGI_FORMAT_R24G8_TYPELESS:
+		srvFormat = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
+		dsvFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
+		break;
+	case DXGI_FORMAT_R16_TYPELESS:
+		srvFormat = DXGI_FORMAT_R16_UNORM;
+		dsvFormat = DXGI_FORMAT_D16_UNORM;
+		break;
+	default:
+		break;
+	}
+}
+
+bool RenderGraphTextures::CreateSlot(Slot& slot, const RenderGraphTextureDesc& desc)
+{
+	slot.Desc = desc;
+	slot.Texture = 0;
+	slot.SRV = 0;
+	slot.RTV = 0;
+	slot.DSVs.clear();
+
+	D3D11_TEXTURE2D_DESC textureDesc = {};
+	textureDesc.Width = desc.Width;
+	textureDesc.Height = desc.Height;
+	textureDesc.ArraySize = desc.ArraySize;
+	textureDesc.MipLevels = 1;
+	textureDesc.Format = (DXGI_FORMAT)desc.Format;
+	textureDesc.SampleDesc.Count = 1;
+	textureDesc.Usage = D3D11_USAGE_DEFAULT;
+	textureDesc.BindFlags = desc.BindFlags;
+	if (FAILED(device->CreateTexture2D(&textureDesc, 0, &slot.Texture)))
+		return false;
+
+	DXGI_FORMAT srvFormat;
+	DXGI_FORMAT dsvFormat;
+	GetViewFormats((DXGI_FORMAT)desc.Format, srvFormat, dsvFormat);
+	bool isArray = desc.ArraySize > 1;
+
+	if (desc.BindFlags & D3D11_BIND_SHADER_RESOURCE)
+	{
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = srvFormat;
+		if (isArray)
+		{
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+			srvDesc.Texture2DArray.MipLevels = 1;
+			srvDesc.Texture2DArray.ArraySize = desc.ArraySize;
+		}
+		else
+		{
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D.MipLevels = 1;
+		}
+		device->CreateShaderResourceView(slot.Texture, &srvDesc, &slot.SRV);
+	}
+
+	if (desc.BindFlags & D3D11_BIND_RENDER_TARGET)
+		device->CreateRenderTargetView(slot.Texture, 0, &slot.RTV);
+
+	if (desc.BindFlags & D3D11_BIND_DEPTH_STENCIL)
+	{
+		for (int s = 0; s < desc.ArraySize; s++)
+		{
+			D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+			dsvDesc.Format = dsvFormat;
+			if (isArray)
+			{
+				dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DARRAY;
+				dsvDesc.Texture2DArray.FirstArraySlice = s;
+				dsvDesc.Texture2DArray.ArraySize = 1;
+			}
+			else
+			{
+				dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
+			}
+
+			ID3D11DepthStencilView* dsv = 0;
+			device->CreateDepthStencilView(slot.Texture, &dsvDesc, &dsv);
+			slot.DSVs.push_back(dsv);
+		}
+	}
+
+	return true;
+}
+
+void RenderGraphTextures::ReleaseSlot(Slot& slot)
+{
+	for (size_t s = 0; s < slot.DSVs.size(); s++)
+	{
+		if (slot.DSVs[s]) { slot.DSVs[s]->Release(); }
+	}
+	slot.DSVs.clear();
+	if (slot.RTV) { slot.RTV->Release(); }
+	if (slot.SRV) { slot.SRV->Release(); }
+	if (slot.Texture) { slot.Texture->Release(); }
+	slot.RTV = 0;
+	slot.SRV = 0;
+	slot.Texture = 0;
+}
+
+// --------------------------------------------------------
+// Matches this frame's physical slots with the textures kept
+// from earlier frames (spare ones are kept too, for when the
+// graph grows back)
+// --------------------------------------------------------
+bool RenderGraphTextures::Allocate(RenderGraph* graph)
+{
+	this->graph = graph;
+
+	bool succeeded = true;
+	for (int p = 0; p < graph->GetPhysicalCount(); p++)
+	{
+		const RenderGraphTextureDesc& desc = graph->GetPhysicalDesc(p);
+		if (p < (int)slots.size() && slots[p].Texture && slots[p].Desc == desc)
+			continue;
+
+		if (p < (int)slots.size())
+			ReleaseSlot(slots[p]);
+		else
+			slots.push_back(Slot());
+
+		if (!CreateSlot(slots[p], desc))
+		{
+			ReleaseSlot(slots[p]);
+			succeeded = false;
+		}
+	}
+
+	Imported none = { 0, 0, 0, 0 };
+	imports.assign(graph->GetResourceCount(), none);
+	return succeeded;
+}
+
+void RenderGraphTextures::Import(int resource, ID3D11ShaderResourceView* srv, ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv)
+{
+	Imported& imported = imports[resource];
+	imported.SRV = srv;
+	imported.RTV = rtv;
+	imported.DSV = dsv;
+
+	// The views hold the resource, so the reference can go
+	ID3D11View* view = srv ? (ID3D11View*)srv : rtv ? (ID3D11View*)rtv : (ID3D11View*)dsv;
+	imported.Resource = 0;
+	if (view)
+	{
+		view->GetResource(&imported.Resource);
+		imported.Resource->Release();
+	}
+}
+
+ID3D11ShaderResourceView* RenderGraphTextures::GetShaderResourceView(int resource)
+{
+	if (graph->IsImported(resource))
+		return imports[resource].SRV;
+	int physical = graph->GetPhysical(resource);
+	return physical >= 0 ? slots[physical].SRV : 0;
+}
+
+ID3D11RenderTargetView* RenderGraphTextures::GetRenderTargetView(int resource)
+{
+	if (graph->IsImported(resource))
+		return imports[resource].RTV;
+	int physical = graph->GetPhysical(resource);
+	return physical >= 0 ? slots[physical].RTV : 0;
+}
+
+ID3D11DepthStencilView* RenderGraphTextures::GetDepthStencilView(int resource, int slice)
+{
+	if (graph->IsImported(resource))
+		return slice == 0 ? imports[resource].DSV : 0;
+	int physical = graph->GetPhysical(resource);
+	if (physical < 0 || slice < 0 || slice >= (int)slots[physical].DSVs.size())
+		return 0;
+	return slots[physical].DSVs[slice];
+}
+
+ID3D11Resource* RenderGraphTextures::GetResource(int resource)
+{
+	if (graph->IsImported(resource))
+		return imports[resource].Resource;
+	int physical = graph->GetPhysical(resource);
+	return physical >= 0 ? slots[physical].Texture : 0;
+}
+
+// --------------------------------------------------------
+// Finds where each resource is bound by asking the context
+// (and comparing the textures behind the views), so it works
+// whichever slot or slice view the pass bound it through
+// --------------------------------------------------------
+void RenderGraphTextures::ApplyUnbinds(ID3D11DeviceContext* context, const std::vector<RenderGraphUnbind>& unbinds)
+{
+	for (size_t u = 0; u < unbinds.size(); u++)
+	{
+		ID3D11Resource* target = GetResource(unbinds[u].Resource);
+		if (!target)
+			continue;
+
+		if (unbinds[u].Binding == RENDER_GRAPH_SRV)
+		{
+			ID3D11ShaderResourceView* bound[SrvSlotsChecked] = {};
+			context->PSGetShaderResources(0, SrvSlotsChecked, bound);
+			for (int s = 0; s < SrvSlotsChecked; s++)
+			{
+				if (!bound[s])
+					continue;
+
+				ID3D11Resource* boundResource = 0;
+				bound[s]->GetResource(&boundResource);
+				if (boundResource == target)
+				{
+					ID3D11ShaderResourceView* none = 0;
+					context->PSSetShaderResources(s, 1, &none);
+				}
+				boundResource->Release();
+				bound[s]->Release();
+			}
+		}
+		else
+		{
+			ID3D11RenderTargetView* boundRTVs[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {};
+			ID3D11DepthStencilView* boundDSV = 0;
+			context->OMGetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, boundRTVs, &boundDSV);
+
+			bool found = false;
+			for (int t = 0; t <= D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; t++)
+			{
+				ID3D11View* view = t < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT ? (ID3D11View*)boundRTVs[t] : (ID3D11View*)boundDSV;
+				if (!view)
+					continue;
+
+				ID3D11Resource* boundResource = 0;
+				view->GetResource(&boundResource);
+				found = found || boundResource == target;
+				boundResource->Release();
+				view->Release();
+			}
+
+			if (found)
+				context->OMSetRenderTargets(0, 0, 0);
+		}
+	}
+}
+
+void RenderGraphTextures::BindTargets(ID3D11DeviceContext* context, int pass)
+{
+	const std::vector<int>& writes = graph->GetWrites(pass);
+
+	ID3D11RenderTargetView* rtvs[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {};
+	UINT rtvCount = 0;
+	ID3D11DepthStencilView* dsv = 0;
+	for (size_t w = 0; w < writes.size(); w++)
+	{
+		ID3D11RenderTargetView* rtv = GetRenderTargetView(writes[w]);
+		if (rtv && rtvCount < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT)
+			rtvs[rtvCount++] = rtv;
+		else if (!dsv)
+			dsv = GetDepthStencilView(writes[w]);
+	}
+	context->OMSetRenderTargets(rtvCount, rtvs, dsv);
+
+	if (!writes.empty())
+	{
+		const RenderGraphTextureDesc& desc = graph->GetDesc(writes[0]);
+		D3D11_VIEWPORT viewport = {};
+		viewport.Width = (float)desc.Width;
+		viewport.Height = (float)desc.Height;
+		viewport.MinDepth = 0.0f;
+		viewport.MaxDepth = 1.0f;
+		context->RSSetViewports(1, &viewport);
+	}
+}
+
+void RenderGraphTextures::ExecutePass(ID3D11DeviceContext* context, int pass)
+{
+	ApplyUnbinds(context, graph->GetUnbinds(pass));
+	BindTargets(context, pass);
+	graph->Execute(pass, context);
+}
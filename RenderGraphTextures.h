@@ -0,0 +1,85 @@
+#pragma once
+
+#include <d3d11.h>
+#include <vector>
+
+#include "RenderGraph.h"
+
+// --------------------------------------------------------
+// The D3D11 textures behind a compiled RenderGraph: one per
+// physical slot, shared by every transient aliased to it, plus
+// the views of whatever the frame imported.
+//
+// D3D11 has no placed resources, so transients only alias
+// when their descs match exactly (they then share a texture).
+// Slots' textures are kept from frame to frame and only remade
+// when a slot's desc changes.
+//
+// Depth formats are given typeless (e.g. R32_TYPELESS) so the
+// texture can have both a depth view and an SRV.
+// --------------------------------------------------------
+class RenderGraphTextures
+{
+public:
+	RenderGraphTextures(ID3D11Device* device);
+	~RenderGraphTextures();
+
+	// After graph->Compile(): makes sure every physical slot has
+	// a texture, and forgets last frame's imports
+	bool Allocate(RenderGraph* graph);
+
+	// The views an imported resource is used through (not owned
+	// - they have to outlive the frame)
+	void Import(int resource, ID3D11ShaderResourceView* srv, ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv);
+
+	// Any resource, imported or transient (null if it has no such
+	// view, or was culled away).  Transient arrays have a depth
+	// view per slice.
+	ID3D11ShaderResourceView* GetShaderResourceView(int resource);
+	ID3D11RenderTargetView* GetRenderTargetView(int resource);
+	ID3D11DepthStencilView* GetDepthStencilView(int resource, int slice = 0);
+
+	// Unbinds what the graph says has to go (pixel shader SRVs and
+	// output targets), wherever it's bound on this context
+	void ApplyUnbinds(ID3D11DeviceContext* context, const std::vector<RenderGraphUnbind>& unbinds);
+
+	// Binds the pass's writes as the render targets (and depth
+	// buffer), with a viewport covering the first of them
+	void BindTargets(ID3D11DeviceContext* context, int pass);
+
+	// Applies the pass's unbinds, binds its targets, then runs
+	// it (passes drawing to slices or tiles set their own)
+	void ExecutePass(ID3D11DeviceContext* context, int pass);
+
+	int GetTextureCount() { return (int)slots.size(); }
+
+private:
+	struct Slot
+	{
+		RenderGraphTextureDesc Desc;
+		ID3D11Texture2D* Texture;
+		ID3D11ShaderResourceView* SRV;
+		ID3D11RenderTargetView* RTV;
+		std::vector<ID3D11DepthStencilView*> DSVs;	// One per slice
+	};
+
+	struct Imported
+	{
+		ID3D11ShaderResourceView* SRV;
+		ID3D11RenderTargetView* RTV;
+		ID3D11DepthStencilView* DSV;
+		ID3D11Resource* Resource;	// What the views are of (not referenced)
+	};
+
+	ID3D11Device* device;
+	RenderGraph* graph;
+	std::vector<Slot> slots;
+	std::vector<Imported> imports;
+
+	// Pixel shader slots checked for SRVs to unbind
+	static const int SrvSlotsChecked = 16;
+
+	bool CreateSlot(Slot& slot, const RenderGraphTextureDesc& desc);
+	void ReleaseSlot(Slot& slot);
+	ID3D11Resource* GetResource(int resource);
+};
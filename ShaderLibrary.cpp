@@ -0,0 +1,480 @@
+#include "ShaderLibrary.h"
+
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// --------------------------------------------------------
+// Constructor - starts out empty, call Open() or Load()
+// --------------------------------------------------------
+ShaderLibrary::ShaderLibrary()
+{
+	data = 0;
+	size = 0;
+	header = 0;
+	fileHandle = 0;
+	mappingHandle = 0;
+	mappedView = 0;
+}
+
+ShaderLibrary::~ShaderLibrary()
+{
+	Close();
+}
+
+// --------------------------------------------------------
+// Memory maps a library file and validates it
+//
+// path - The .shlib file to open
+//
+// Returns true if the file exists and is a valid library
+// --------------------------------------------------------
+bool ShaderLibrary::Open(const char* path)
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+	if (mapping == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == 0)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	mappedView = view;
+	size_t mappedSize = (size_t)fileSize.QuadPart;
+#else
+	int file = open(path, O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat fileStat;
+	if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* view = mmap(0, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (view == MAP_FAILED)
+		return false;
+
+	mappedView = view;
+	size_t mappedSize = (size_t)fileStat.st_size;
+#endif
+
+	// Mapping worked, so now just treat it like any other buffer
+	data = (const unsigned char*)mappedView;
+	size = mappedSize;
+	if (!Validate())
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+// --------------------------------------------------------
+// Uses an existing buffer as the library.  The buffer must
+// outlive this object (nothing is copied).
+// --------------------------------------------------------
+bool ShaderLibrary::Load(const void* buffer, size_t bufferSize)
+{
+	Close();
+
+	data = (const unsigned char*)buffer;
+	size = bufferSize;
+	if (!Validate())
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+// --------------------------------------------------------
+// Unmaps the file (if any) and resets the view
+// --------------------------------------------------------
+void ShaderLibrary::Close()
+{
+#ifdef _WIN32
+	if (mappedView) { UnmapViewOfFile(mappedView); }
+	if (mappingHandle) { CloseHandle((HANDLE)mappingHandle); }
+	if (fileHandle) { CloseHandle((HANDLE)fileHandle); }
+#else
+	if (mappedView) { munmap(mappedView, size); }
+#endif
+
+	data = 0;
+	size = 0;
+	header = 0;
+	fileHandle = 0;
+	mappingHandle = 0;
+	mappedView = 0;
+}
+
+// --------------------------------------------------------
+// Checks that every table, string and bytecode range in the
+// library lies inside the buffer, so lookups never need to
+// bounds check again
+// --------------------------------------------------------
+bool ShaderLibrary::Validate()
+{
+	header = 0;
+	if (data == 0 || size < sizeof(ShaderLibraryHeader))
+		return false;
+
+	const ShaderLibraryHeader* h = (const ShaderLibraryHeader*)data;
+	if (h->Magic != SHADER_LIBRARY_MAGIC || h->Version != SHADER_LIBRARY_VERSION || h->FileSize != size)
+		return false;
+
+	// Each table must fit in the file (64 bit math avoids overflow)
+	struct { uint32_t Offset; uint32_t Count; size_t Stride; } tables[] =
+	{
+		{ h->ShaderOffset,		h->ShaderCount,		sizeof(ShaderLibraryShader) },
+		{ h->BufferOffset,		h->BufferCount,		sizeof(ShaderLibraryBuffer) },
+		{ h->VariableOffset,	h->VariableCount,	sizeof(ShaderLibraryVariable) },
+		{ h->ResourceOffset,	h->ResourceCount,	sizeof(ShaderLibraryResource) },
+		{ h->InputOffset,		h->InputCount,		sizeof(ShaderLibraryInput) },
+		{ h->StringTableOffset,	h->StringTableSize,	1 },
+	};
+	for (unsigned int t = 0; t < sizeof(tables) / sizeof(tables[0]); t++)
+	{
+		if (tables[t].Offset % 4 != 0 && tables[t].Stride != 1)
+			return false;
+		unsigned long long end = (unsigned long long)tables[t].Offset + (unsigned long long)tables[t].Count * tables[t].Stride;
+		if (end > size)
+			return false;
+	}
+
+	// String table must be terminated so GetString() can't run off the end
+	if (h->StringTableSize == 0 || data[h->StringTableOffset + h->StringTableSize - 1] != 0)
+		return false;
+
+	// Check every name and range inside the tables
+	const ShaderLibraryShader* shaders = (const ShaderLibraryShader*)(data + h->ShaderOffset);
+	for (unsigned int s = 0; s < h->ShaderCount; s++)
+	{
+		const ShaderLibraryShader& sh = shaders[s];
+		if (sh.Name >= h->StringTableSize) return false;
+		if (sh.Stage > SHADER_STAGE_COMPUTE) return false;
+		if ((unsigned long long)sh.BytecodeOffset + sh.BytecodeSize > size) return false;
+		if ((unsigned long long)sh.FirstBuffer + sh.BufferCount > h->BufferCount) return false;
+		if ((unsigned long long)sh.FirstTexture + sh.TextureCount > h->ResourceCount) return false;
+		if ((unsigned long long)sh.FirstSampler + sh.SamplerCount > h->ResourceCount) return false;
+		if ((unsigned long long)sh.FirstInput + sh.InputCount > h->InputCount) return false;
+	}
+
+	const ShaderLibraryBuffer* buffers = (const ShaderLibraryBuffer*)(data + h->BufferOffset);
+	for (unsigned int b = 0; b < h->BufferCount; b++)
+	{
+		if (buffers[b].Name >= h->StringTableSize) return false;
+		if ((unsigned long long)buffers[b].FirstVariable + buffers[b].VariableCount > h->VariableCount) return false;
+	}
+
+	const ShaderLibraryVariable* variables = (const ShaderLibraryVariable*)(data + h->VariableOffset);
+	for (unsigned int v = 0; v < h->VariableCount; v++)
+		if (variables[v].Name >= h->StringTableSize) return false;
+
+	const ShaderLibraryResource* resources = (const ShaderLibraryResource*)(data + h->ResourceOffset);
+	for (unsigned int r = 0; r < h->ResourceCount; r++)
+		if (resources[r].Name >= h->StringTableSize) return false;
+
+	const ShaderLibraryInput* inputs = (const ShaderLibraryInput*)(data + h->InputOffset);
+	for (unsigned int i = 0; i < h->InputCount; i++)
+		if (inputs[i].SemanticName >= h->StringTableSize) return false;
+
+	// All good
+	header = h;
+	return true;
+}
+
+// --------------------------------------------------------
+// Finds a shader by name, returning its index or -1
+// --------------------------------------------------------
+int ShaderLibrary::FindShader(const char* name)
+{
+	if (!header) return -1;
+
+	for (unsigned int s = 0; s < header->ShaderCount; s++)
+	{
+		if (strcmp(GetString(GetShader(s)->Name), name) == 0)
+			return (int)s;
+	}
+
+	return -1;
+}
+
+// --------------------------------------------------------
+// Table accessors - each returns null for a bad index
+// --------------------------------------------------------
+const ShaderLibraryShader* ShaderLibrary::GetShader(unsigned int index)
+{
+	if (!header || index >= header->ShaderCount) return 0;
+	return (const ShaderLibraryShader*)(data + header->ShaderOffset) + index;
+}
+
+const ShaderLibraryBuffer* ShaderLibrary::GetBuffer(unsigned int index)
+{
+	if (!header || index >= header->BufferCount) return 0;
+	return (const ShaderLibraryBuffer*)(data + header->BufferOffset) + index;
+}
+
+const ShaderLibraryVariable* ShaderLibrary::GetVariable(unsigned int index)
+{
+	if (!header || index >= header->VariableCount) return 0;
+	return (const ShaderLibraryVariable*)(data + header->VariableOffset) + index;
+}
+
+const ShaderLibraryResource* ShaderLibrary::GetResource(unsigned int index)
+{
+	if (!header || index >= header->ResourceCount) return 0;
+	return (const ShaderLibraryResource*)(data + header->ResourceOffset) + index;
+}
+
+const ShaderLibraryInput* ShaderLibrary::GetInput(unsigned int index)
+{
+	if (!header || index >= header->InputCount) return 0;
+	return (const ShaderLibraryInput*)(data + header->InputOffset) + index;
+}
+
+const void* ShaderLibrary::GetBytecode(const ShaderLibraryShader* shader)
+{
+	if (!header || !shader) return 0;
+	return data + shader->BytecodeOffset;
+}
+
+const char* ShaderLibrary::GetString(uint32_t offset)
+{
+	if (!header || offset >= header->StringTableSize) return "";
+	return (const char*)(data + header->StringTableOffset + offset);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// ------ LIBRARY WRITER ------------------------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+
+// --------------------------------------------------------
+// Queues a shader to be written
+// --------------------------------------------------------
+void ShaderLibraryWriter::AddShader(const ShaderLibraryShaderDesc& shader)
+{
+	shaders.push_back(shader);
+}
+
+// Helper for appending a null terminated string and returning its offset
+static uint32_t AddString(std::vector<char>& table, const std::string& str)
+{
+	uint32_t offset = (uint32_t)table.size();
+	table.insert(table.end(), str.begin(), str.end());
+	table.push_back(0);
+	return offset;
+}
+
+// Helper for copying a POD table into the output
+template<typename T>
+static void WriteTable(std::vector<unsigned char>& out, uint32_t offset, const std::vector<T>& table)
+{
+	if (!table.empty())
+		memcpy(&out[offset], &table[0], sizeof(T) * table.size());
+}
+
+// Rounds up to the given power of two alignment
+static uint32_t AlignUp(uint32_t value, uint32_t alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// --------------------------------------------------------
+// Flattens all queued shaders into the archive format
+//
+// out - Receives the complete file contents
+// --------------------------------------------------------
+bool ShaderLibraryWriter::Serialize(std::vector<unsigned char>& out)
+{
+	std::vector<ShaderLibraryShader> shaderTable;
+	std::vector<ShaderLibraryBuffer> bufferTable;
+	std::vector<ShaderLibraryVariable> variableTable;
+	std::vector<ShaderLibraryResource> resourceTable;
+	std::vector<ShaderLibraryInput> inputTable;
+	std::vector<char> strings;
+
+	// Offset 0 is the empty string
+	strings.push_back(0);
+
+	for (unsigned int s = 0; s < shaders.size(); s++)
+	{
+		const ShaderLibraryShaderDesc& desc = shaders[s];
+
+		ShaderLibraryShader sh = {};
+		sh.Name = AddString(strings, desc.Name);
+		sh.Stage = desc.Stage;
+		sh.BytecodeSize = (uint32_t)desc.Bytecode.size();
+		sh.SourceTimeLow = (uint32_t)(desc.SourceTime & 0xFFFFFFFF);
+		sh.SourceTimeHigh = (uint32_t)(desc.SourceTime >> 32);
+
+		sh.FirstBuffer = (uint32_t)bufferTable.size();
+		sh.BufferCount = (uint32_t)desc.Buffers.size();
+		for (unsigned int b = 0; b < desc.Buffers.size(); b++)
+		{
+			ShaderLibraryBuffer buf;
+			buf.Name = AddString(strings, desc.Buffers[b].Name);
+			buf.Size = desc.Buffers[b].Size;
+			buf.BindIndex = desc.Buffers[b].BindIndex;
+			buf.FirstVariable = (uint32_t)variableTable.size();
+			buf.VariableCount = (uint32_t)desc.Buffers[b].Variables.size();
+			bufferTable.push_back(buf);
+
+			for (unsigned int v = 0; v < desc.Buffers[b].Variables.size(); v++)
+			{
+				ShaderLibraryVariable var;
+				var.Name = AddString(strings, desc.Buffers[b].Variables[v].Name);
+				var.ByteOffset = desc.Buffers[b].Variables[v].ByteOffset;
+				var.Size = desc.Buffers[b].Variables[v].Size;
+				variableTable.push_back(var);
+			}
+		}
+
+		sh.FirstTexture = (uint32_t)resourceTable.size();
+		sh.TextureCount = (uint32_t)desc.Textures.size();
+		for (unsigned int t = 0; t < desc.Textures.size(); t++)
+		{
+			ShaderLibraryResource res;
+			res.Name = AddString(strings, desc.Textures[t].Name);
+			res.BindIndex = desc.Textures[t].BindIndex;
+			resourceTable.push_back(res);
+		}
+
+		sh.FirstSampler = (uint32_t)resourceTable.size();
+		sh.SamplerCount = (uint32_t)desc.Samplers.size();
+		for (unsigned int t = 0; t < desc.Samplers.size(); t++)
+		{
+			ShaderLibraryResource res;
+			res.Name = AddString(strings, desc.Samplers[t].Name);
+			res.BindIndex = desc.Samplers[t].BindIndex;
+			resourceTable.push_back(res);
+		}
+
+		sh.FirstInput = (uint32_t)inputTable.size();
+		sh.InputCount = (uint32_t)desc.Inputs.size();
+		for (unsigned int i = 0; i < desc.Inputs.size(); i++)
+		{
+			ShaderLibraryInput in;
+			in.SemanticName = AddString(strings, desc.Inputs[i].SemanticName);
+			in.SemanticIndex = desc.Inputs[i].SemanticIndex;
+			in.Mask = desc.Inputs[i].Mask;
+			in.ComponentType = desc.Inputs[i].ComponentType;
+			inputTable.push_back(in);
+		}
+
+		shaderTable.push_back(sh);
+	}
+
+	// Lay out the file
+	ShaderLibraryHeader header = {};
+	header.Magic = SHADER_LIBRARY_MAGIC;
+	header.Version = SHADER_LIBRARY_VERSION;
+
+	uint32_t offset = sizeof(ShaderLibraryHeader);
+	header.ShaderCount = (uint32_t)shaderTable.size();
+	header.ShaderOffset = offset;
+	offset += header.ShaderCount * sizeof(ShaderLibraryShader);
+	header.BufferCount = (uint32_t)bufferTable.size();
+	header.BufferOffset = offset;
+	offset += header.BufferCount * sizeof(ShaderLibraryBuffer);
+	header.VariableCount = (uint32_t)variableTable.size();
+	header.VariableOffset = offset;
+	offset += header.VariableCount * sizeof(ShaderLibraryVariable);
+	header.ResourceCount = (uint32_t)resourceTable.size();
+	header.ResourceOffset = offset;
+	offset += header.ResourceCount * sizeof(ShaderLibraryResource);
+	header.InputCount = (uint32_t)inputTable.size();
+	header.InputOffset = offset;
+	offset += header.InputCount * sizeof(ShaderLibraryInput);
+	header.StringTableSize = (uint32_t)strings.size();
+	header.StringTableOffset = offset;
+	offset += header.StringTableSize;
+
+	// Bytecode goes last, each blob aligned for the driver's benefit
+	for (unsigned int s = 0; s < shaderTable.size(); s++)
+	{
+		offset = AlignUp(offset, 16);
+		shaderTable[s].BytecodeOffset = offset;
+		offset += shaderTable[s].BytecodeSize;
+	}
+	header.FileSize = offset;
+
+	// Copy everything into the output
+	out.assign(offset, 0);
+	memcpy(&out[0], &header, sizeof(header));
+	WriteTable(out, header.ShaderOffset, shaderTable);
+	WriteTable(out, header.BufferOffset, bufferTable);
+	WriteTable(out, header.VariableOffset, variableTable);
+	WriteTable(out, header.ResourceOffset, resourceTable);
+	WriteTable(out, header.InputOffset, inputTable);
+	memcpy(&out[header.StringTableOffset], &strings[0], strings.size());
+	for (unsigned int s = 0; s < shaderTable.size(); s++)
+	{
+		if (!shaders[s].Bytecode.empty())
+			memcpy(&out[shaderTable[s].BytecodeOffset], &shaders[s].Bytecode[0], shaders[s].Bytecode.size());
+	}
+
+	return true;
+}
+
+// --------------------------------------------------------
+// Serializes and writes the library to disk
+// --------------------------------------------------------
+bool ShaderLibraryWriter::WriteToFile(const char* path)
+{
+	std::vector<unsigned char> out;
+	if (!Serialize(out))
+		return false;
+
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "wb");
+#else
+	file = fopen(path, "wb");
+#endif
+	if (!file)
+		return false;
+
+	size_t written = fwrite(&out[0], 1, out.size(), file);
+	fclose(file);
+	return written == out.size();
+}
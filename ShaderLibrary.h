@@ -0,0 +1,209 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------
+// Shader library archive
+//
+// One file holding the bytecode of every shader plus a flat,
+// pre-serialized copy of the reflection data SimpleShader
+// needs (constant buffers, variables, SRVs, samplers and the
+// vertex input signature).  Everything is plain 32-bit fields
+// and string table offsets, so the file can be memory mapped
+// and read in place without D3D (and without D3DReflect).
+//
+// Layout:
+//   ShaderLibraryHeader
+//   ShaderLibraryShader[ShaderCount]
+//   ShaderLibraryBuffer[BufferCount]
+//   ShaderLibraryVariable[VariableCount]
+//   ShaderLibraryResource[ResourceCount]  (SRVs and samplers)
+//   ShaderLibraryInput[InputCount]
+//   String table (null terminated names)
+//   Bytecode blobs (16 byte aligned)
+// --------------------------------------------------------
+
+#define SHADER_LIBRARY_MAGIC	0x42494C53 // "SLIB"
+#define SHADER_LIBRARY_VERSION	1
+
+// Which pipeline stage a shader in the library belongs to
+enum ShaderLibraryStage
+{
+	SHADER_STAGE_VERTEX = 0,
+	SHADER_STAGE_PIXEL,
+	SHADER_STAGE_DOMAIN,
+	SHADER_STAGE_HULL,
+	SHADER_STAGE_GEOMETRY,
+	SHADER_STAGE_COMPUTE
+};
+
+struct ShaderLibraryHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t FileSize;
+
+	uint32_t ShaderCount;
+	uint32_t ShaderOffset;
+	uint32_t BufferCount;
+	uint32_t BufferOffset;
+	uint32_t VariableCount;
+	uint32_t VariableOffset;
+	uint32_t ResourceCount;
+	uint32_t ResourceOffset;
+	uint32_t InputCount;
+	uint32_t InputOffset;
+	uint32_t StringTableSize;
+	uint32_t StringTableOffset;
+};
+
+struct ShaderLibraryShader
+{
+	uint32_t Name;				// String table offset
+	uint32_t Stage;				// ShaderLibraryStage
+	uint32_t BytecodeOffset;	// From the start of the file
+	uint32_t BytecodeSize;
+	uint32_t SourceTimeLow;		// Last write time of the .cso this
+	uint32_t SourceTimeHigh;	// entry was baked from (staleness check)
+	uint32_t FirstBuffer;
+	uint32_t BufferCount;
+	uint32_t FirstTexture;		// Index into the resource table
+	uint32_t TextureCount;
+	uint32_t FirstSampler;		// Index into the resource table
+	uint32_t SamplerCount;
+	uint32_t FirstInput;
+	uint32_t InputCount;
+};
+
+struct ShaderLibraryBuffer
+{
+	uint32_t Name;
+	uint32_t Size;
+	uint32_t BindIndex;
+	uint32_t FirstVariable;
+	uint32_t VariableCount;
+};
+
+struct ShaderLibraryVariable
+{
+	uint32_t Name;
+	uint32_t ByteOffset;
+	uint32_t Size;
+};
+
+struct ShaderLibraryResource
+{
+	uint32_t Name;
+	uint32_t BindIndex;
+};
+
+struct ShaderLibraryInput
+{
+	uint32_t SemanticName;
+	uint32_t SemanticIndex;
+	uint32_t Mask;				// Component mask from the input signature
+	uint32_t ComponentType;		// D3D_REGISTER_COMPONENT_TYPE value
+};
+
+// --------------------------------------------------------
+// Read-only view of a shader library, either memory mapped
+// from disk or pointed at a buffer the caller owns
+// --------------------------------------------------------
+class ShaderLibrary
+{
+public:
+	ShaderLibrary();
+	~ShaderLibrary();
+
+	bool Open(const char* path);
+	bool Load(const void* data, size_t size);
+	void Close();
+
+	bool IsValid() { return header != 0; }
+
+	unsigned int GetShaderCount() { return header ? header->ShaderCount : 0; }
+	int FindShader(const char* name);
+
+	const ShaderLibraryShader* GetShader(unsigned int index);
+	const ShaderLibraryBuffer* GetBuffer(unsigned int index);
+	const ShaderLibraryVariable* GetVariable(unsigned int index);
+	const ShaderLibraryResource* GetResource(unsigned int index);
+	const ShaderLibraryInput* GetInput(unsigned int index);
+
+	const void* GetBytecode(const ShaderLibraryShader* shader);
+	const char* GetString(uint32_t offset);
+
+private:
+	const unsigned char* data;
+	size_t size;
+	const ShaderLibraryHeader* header;
+
+	// Platform mapping handles (null when Load() was used)
+	void* fileHandle;
+	void* mappingHandle;
+	void* mappedView;
+
+	bool Validate();
+};
+
+// --------------------------------------------------------
+// Plain description of one shader, used to build a library.
+// Filled from D3D reflection by the baker, but the writer
+// itself knows nothing about D3D.
+// --------------------------------------------------------
+struct ShaderLibraryVariableDesc
+{
+	std::string Name;
+	unsigned int ByteOffset;
+	unsigned int Size;
+};
+
+struct ShaderLibraryBufferDesc
+{
+	std::string Name;
+	unsigned int Size;
+	unsigned int BindIndex;
+	std::vector<ShaderLibraryVariableDesc> Variables;
+};
+
+struct ShaderLibraryResourceDesc
+{
+	std::string Name;
+	unsigned int BindIndex;
+};
+
+struct ShaderLibraryInputDesc
+{
+	std::string SemanticName;
+	unsigned int SemanticIndex;
+	unsigned int Mask;
+	unsigned int ComponentType;
+};
+
+struct ShaderLibraryShaderDesc
+{
+	std::string Name;
+	ShaderLibraryStage Stage;
+	unsigned long long SourceTime;
+	std::vector<unsigned char> Bytecode;
+	std::vector<ShaderLibraryBufferDesc> Buffers;
+	std::vector<ShaderLibraryResourceDesc> Textures;
+	std::vector<ShaderLibraryResourceDesc> Samplers;
+	std::vector<ShaderLibraryInputDesc> Inputs;
+};
+
+// --------------------------------------------------------
+// Serializes shader descriptions into the archive format
+// --------------------------------------------------------
+class ShaderLibraryWriter
+{
+public:
+	void AddShader(const ShaderLibraryShaderDesc& shader);
+	bool Serialize(std::vector<unsigned char>& out);
+	bool WriteToFile(const char* path);
+
+private:
+	std::vector<ShaderLibraryShaderDesc> shaders;
+};
@@ -0,0 +1,141 @@
+#include "ShaderLibraryBaker.h"
+
+// --------------------------------------------------------
+// Reads a .cso file and adds it to the library
+//
+// name    - The name the shader will be looked up by
+// stage   - Which pipeline stage the shader is for
+// csoFile - The compiled shader file
+//
+// Returns true if the file was read and reflected
+// --------------------------------------------------------
+bool ShaderLibraryBaker::AddShaderFile(const char* name, ShaderLibraryStage stage, LPCWSTR csoFile)
+{
+	ID3DBlob* blob = 0;
+	if (D3DReadFileToBlob(csoFile, &blob) != S_OK)
+		return false;
+
+	bool result = AddShaderBlob(name, stage, blob, GetLastWriteTime(csoFile));
+	blob->Release();
+	return result;
+}
+
+// --------------------------------------------------------
+// Reflects compiled shader code and adds it to the library
+//
+// name       - The name the shader will be looked up by
+// stage      - Which pipeline stage the shader is for
+// blob       - The compiled shader code
+// sourceTime - Last write time of the source (0 if unknown)
+// --------------------------------------------------------
+bool ShaderLibraryBaker::AddShaderBlob(const char* name, ShaderLibraryStage stage, ID3DBlob* blob, unsigned long long sourceTime)
+{
+	ID3D11ShaderReflection* refl = 0;
+	HRESULT hr = D3DReflect(
+		blob->GetBufferPointer(),
+		blob->GetBufferSize(),
+		IID_ID3D11ShaderReflection,
+		(void**)&refl);
+	if (hr != S_OK)
+		return false;
+
+	D3D11_SHADER_DESC shaderDesc;
+	refl->GetDesc(&shaderDesc);
+
+	ShaderLibraryShaderDesc desc;
+	desc.Name = name;
+	desc.Stage = stage;
+	desc.SourceTime = sourceTime;
+	desc.Bytecode.assign(
+		(unsigned char*)blob->GetBufferPointer(),
+		(unsigned char*)blob->GetBufferPointer() + blob->GetBufferSize());
+
+	// Textures and samplers, in binding order (same as SimpleShader)
+	for (unsigned int r = 0; r < shaderDesc.BoundResources; r++)
+	{
+		D3D11_SHADER_INPUT_BIND_DESC resourceDesc;
+		refl->GetResourceBindingDesc(r, &resourceDesc);
+
+		ShaderLibraryResourceDesc res;
+		res.Name = resourceDesc.Name;
+		res.BindIndex = resourceDesc.BindPoint;
+
+		if (resourceDesc.Type == D3D_SIT_TEXTURE)
+			desc.Textures.push_back(res);
+		else if (resourceDesc.Type == D3D_SIT_SAMPLER)
+			desc.Samplers.push_back(res);
+	}
+
+	// Constant buffers and their variables
+	for (unsigned int b = 0; b < shaderDesc.ConstantBuffers; b++)
+	{
+		ID3D11ShaderReflectionConstantBuffer* cb = refl->GetConstantBufferByIndex(b);
+		D3D11_SHADER_BUFFER_DESC bufferDesc;
+		cb->GetDesc(&bufferDesc);
+
+		D3D11_SHADER_INPUT_BIND_DESC bindDesc;
+		refl->GetResourceBindingDescByName(bufferDesc.Name, &bindDesc);
+
+		ShaderLibraryBufferDesc buf;
+		buf.Name = bufferDesc.Name;
+		buf.Size = bufferDesc.Size;
+		buf.BindIndex = bindDesc.BindPoint;
+
+		for (unsigned int v = 0; v < bufferDesc.Variables; v++)
+		{
+			D3D11_SHADER_VARIABLE_DESC varDesc;
+			cb->GetVariableByIndex(v)->GetDesc(&varDesc);
+
+			ShaderLibraryVariableDesc var;
+			var.Name = varDesc.Name;
+			var.ByteOffset = varDesc.StartOffset;
+			var.Size = varDesc.Size;
+			buf.Variables.push_back(var);
+		}
+
+		desc.Buffers.push_back(buf);
+	}
+
+	// Input signature (only meaningful for vertex shaders)
+	if (stage == SHADER_STAGE_VERTEX)
+	{
+		for (unsigned int i = 0; i < shaderDesc.InputParameters; i++)
+		{
+			D3D11_SIGNATURE_PARAMETER_DESC paramDesc;
+			refl->GetInputParameterDesc(i, &paramDesc);
+
+			ShaderLibraryInputDesc in;
+			in.SemanticName = paramDesc.SemanticName;
+			in.SemanticIndex = paramDesc.SemanticIndex;
+			in.Mask = paramDesc.Mask;
+			in.ComponentType = paramDesc.ComponentType;
+			desc.Inputs.push_back(in);
+		}
+	}
+
+	refl->Release();
+	writer.AddShader(desc);
+	return true;
+}
+
+// --------------------------------------------------------
+// Writes every added shader out as a single library file
+// --------------------------------------------------------
+bool ShaderLibraryBaker::Write(const char* path)
+{
+	return writer.WriteToFile(path);
+}
+
+// --------------------------------------------------------
+// Gets a file's last write time, or 0 if it doesn't exist.
+// Used to tell when a baked library is older than its .cso's.
+// --------------------------------------------------------
+unsigned long long ShaderLibraryBaker::GetLastWriteTime(LPCWSTR file)
+{
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	if (!GetFileAttributesExW(file, GetFileExInfoStandard, &attributes))
+		return 0;
+
+	return ((unsigned long long)attributes.ftLastWriteTime.dwHighDateTime << 32) |
+		attributes.ftLastWriteTime.dwLowDateTime;
+}
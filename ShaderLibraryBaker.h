@@ -0,0 +1,25 @@
+#pragma once
+
+#include <d3d11.h>
+#include <d3dcompiler.h>
+
+#include "ShaderLibrary.h"
+
+// --------------------------------------------------------
+// Builds a shader library from compiled shader (.cso) files.
+// This is the only place that runs D3DReflect for the library;
+// at runtime the reflection tables are read straight from the
+// baked file.
+// --------------------------------------------------------
+class ShaderLibraryBaker
+{
+public:
+	bool AddShaderFile(const char* name, ShaderLibraryStage stage, LPCWSTR csoFile);
+	bool AddShaderBlob(const char* name, ShaderLibraryStage stage, ID3DBlob* blob, unsigned long long sourceTime);
+	bool Write(const char* path);
+
+	static unsigned long long GetLastWriteTime(LPCWSTR file);
+
+private:
+	ShaderLibraryWriter writer;
+};
@@ -0,0 +1,398 @@
+// --------------------------------------------------------
+// Offline tool: round-trips a shader library (see
+// ShaderLibrary) through the writer and the memory mapped
+// reader, then feeds the reader broken files (excluded from
+// the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 ShaderLibraryCheck.cpp ShaderLibrary.cpp -o ShaderLibraryCheck
+//   ./ShaderLibraryCheck
+//
+// Options: --file PATH (where the library is written, default
+// ShaderLibraryCheck.shlib) and --flips N (randomly corrupted
+// copies, default 20000).
+//
+// Fails (returns 1) if any table read back differs from what
+// was written, if a truncated or corrupted file is accepted,
+// or if a corrupted file that is accepted has a name or range
+// pointing outside the file.
+// --------------------------------------------------------
+
+#include "ShaderLibrary.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+static int failures = 0;
+
+static void Check(bool ok, const char* what)
+{
+	if (!ok)
+	{
+		printf("  FAILED: %s\n", what);
+		failures++;
+	}
+}
+
+// A few shaders covering every table, plus one with nothing
+// but bytecode
+static std::vector<ShaderLibraryShaderDesc> MakeShaders()
+{
+	std::vector<ShaderLibraryShaderDesc> shaders(3);
+
+	ShaderLibraryShaderDesc& vs = shaders[0];
+	vs.Name = "VertexShader";
+	vs.Stage = SHADER_STAGE_VERTEX;
+	vs.SourceTime = 0x01D2345678ABCDEFull;
+	vs.Bytecode.resize(333);
+	for (size_t i = 0; i < vs.Bytecode.size(); i++)
+		vs.Bytecode[i] = (unsigned char)(i * 7 + 1);
+	ShaderLibraryBufferDesc perObject = { "perObject", 192, 0, {} };
+	perObject.Variables.push_back({ "world", 0, 64 });
+	perObject.Variables.push_back({ "view", 64, 64 });
+	perObject.Variables.push_back({ "projection", 128, 64 });
+	vs.Buffers.push_back(perObject);
+	vs.Inputs.push_back({ "POSITION", 0, 0x7, 3 });
+	vs.Inputs.push_back({ "NORMAL", 0, 0x7, 3 });
+	vs.Inputs.push_back({ "TEXCOORD", 0, 0x3, 3 });
+
+	ShaderLibraryShaderDesc& ps = shaders[1];
+	ps.Name = "PixelShader";
+	ps.Stage = SHADER_STAGE_PIXEL;
+	ps.SourceTime = 42;
+	ps.Bytecode.resize(1000);
+	for (size_t i = 0; i < ps.Bytecode.size(); i++)
+		ps.Bytecode[i] = (unsigned char)(255 - i);
+	ShaderLibraryBufferDesc lights = { "lights", 64, 0, {} };
+	lights.Variables.push_back({ "dirLight", 0, 48 });
+	lights.Variables.push_back({ "lightCount", 48, 4 });
+	ps.Buffers.push_back(lights);
+	ShaderLibraryBufferDesc material = { "material", 16, 2, {} };
+	material.Variables.push_back({ "tint", 0, 16 });
+	ps.Buffers.push_back(material);
+	ps.Textures.push_back({ "diffuseTexture", 0 });
+	ps.Textures.push_back({ "shadowMap", 4 });
+	ps.Samplers.push_back({ "basicSampler", 0 });
+	ps.Samplers.push_back({ "shadowSampler", 1 });
+
+	ShaderLibraryShaderDesc& cs = shaders[2];
+	cs.Name = "PrefilterCS";
+	cs.Stage = SHADER_STAGE_COMPUTE;
+	cs.SourceTime = 0;
+	cs.Bytecode.resize(17, 0xCC);
+
+	return shaders;
+}
+
+// Everything the library says about a shader has to match the
+// description it was written from
+static bool ShaderMatches(ShaderLibrary& library, const ShaderLibraryShaderDesc& desc)
+{
+	int index = library.FindShader(desc.Name.c_str());
+	if (index < 0)
+		return false;
+	const ShaderLibraryShader* sh = library.GetShader((unsigned int)index);
+	if (!sh || desc.Name != library.GetString(sh->Name) || sh->Stage != (uint32_t)desc.Stage)
+		return false;
+
+	unsigned long long sourceTime = ((unsigned long long)sh->SourceTimeHigh << 32) | sh->SourceTimeLow;
+	if (sourceTime != desc.SourceTime)
+		return false;
+	if (sh->BytecodeSize != desc.Bytecode.size() || sh->BytecodeOffset % 16 != 0)
+		return false;
+	if (!desc.Bytecode.empty() && memcmp(library.GetBytecode(sh), &desc.Bytecode[0], desc.Bytecode.size()) != 0)
+		return false;
+
+	if (sh->BufferCount != desc.Buffers.size())
+		return false;
+	for (unsigned int b = 0; b < sh->BufferCount; b++)
+	{
+		const ShaderLibraryBuffer* buf = library.GetBuffer(sh->FirstBuffer + b);
+		const ShaderLibraryBufferDesc& bufDesc = desc.Buffers[b];
+		if (!buf || bufDesc.Name != library.GetString(buf->Name) || buf->Size != bufDesc.Size ||
+			buf->BindIndex != bufDesc.BindIndex || buf->VariableCount != bufDesc.Variables.size())
+			return false;
+		for (unsigned int v = 0; v < buf->VariableCount; v++)
+		{
+			const ShaderLibraryVariable* var = library.GetVariable(buf->FirstVariable + v);
+			const ShaderLibraryVariableDesc& varDesc = bufDesc.Variables[v];
+			if (!var || varDesc.Name != library.GetString(var->Name) ||
+				var->ByteOffset != varDesc.ByteOffset || var->Size != varDesc.Size)
+				return false;
+		}
+	}
+
+	if (sh->TextureCount != desc.Textures.size() || sh->SamplerCount != desc.Samplers.size())
+		return false;
+	for (unsigned int t = 0; t < sh->TextureCount; t++)
+	{
+		const ShaderLibraryResource* res = library.GetResource(sh->FirstTexture + t);
+		if (!res || desc.Textures[t].Name != library.GetString(res->Name) || res->BindIndex != desc.Textures[t].BindIndex)
+			return false;
+	}
+	for (unsigned int s = 0; s < sh->SamplerCount; s++)
+	{
+		const ShaderLibraryResource* res = library.GetResource(sh->FirstSampler + s);
+		if (!res || desc.Samplers[s].Name != library.GetString(res->Name) || res->BindIndex != desc.Samplers[s].BindIndex)
+			return false;
+	}
+
+	if (sh->InputCount != desc.Inputs.size())
+		return false;
+	for (unsigned int i = 0; i < sh->InputCount; i++)
+	{
+		const ShaderLibraryInput* in = library.GetInput(sh->FirstInput + i);
+		const ShaderLibraryInputDesc& inDesc = desc.Inputs[i];
+		if (!in || inDesc.SemanticName != library.GetString(in->SemanticName) || in->SemanticIndex != inDesc.SemanticIndex ||
+			in->Mask != inDesc.Mask || in->ComponentType != inDesc.ComponentType)
+			return false;
+	}
+
+	return true;
+}
+
+// True if the name is terminated before the end of the file
+static bool NameEnds(const char* name, const unsigned char* end)
+{
+	return memchr(name, 0, end - (const unsigned char*)name) != 0;
+}
+
+// For libraries that were accepted: every name must end
+// inside the file and every index must resolve, which is what
+// Validate() promises the rest of the reader
+static bool StaysInBounds(ShaderLibrary& library, const unsigned char* data, size_t size)
+{
+	const unsigned char* end = data + size;
+	for (unsigned int s = 0; s < library.GetShaderCount(); s++)
+	{
+		const ShaderLibraryShader* sh = library.GetShader(s);
+		if (!sh || !NameEnds(library.GetString(sh->Name), end))
+			return false;
+		const unsigned char* bytecode = (const unsigned char*)library.GetBytecode(sh);
+		if (bytecode < data || bytecode + sh->BytecodeSize > end)
+			return false;
+		for (unsigned int b = 0; b < sh->BufferCount; b++)
+		{
+			const ShaderLibraryBuffer* buf = library.GetBuffer(sh->FirstBuffer + b);
+			if (!buf || !NameEnds(library.GetString(buf->Name), end))
+				return false;
+			for (unsigned int v = 0; v < buf->VariableCount; v++)
+			{
+				const ShaderLibraryVariable* var = library.GetVariable(buf->FirstVariable + v);
+				if (!var || !NameEnds(library.GetString(var->Name), end))
+					return false;
+			}
+		}
+		for (unsigned int t = 0; t < sh->TextureCount + sh->SamplerCount; t++)
+		{
+			unsigned int first = t < sh->TextureCount ? sh->FirstTexture + t : sh->FirstSampler + (t - sh->TextureCount);
+			const ShaderLibraryResource* res = library.GetResource(first);
+			if (!res || !NameEnds(library.GetString(res->Name), end))
+				return false;
+		}
+		for (unsigned int i = 0; i < sh->InputCount; i++)
+		{
+			const ShaderLibraryInput* in = library.GetInput(sh->FirstInput + i);
+			if (!in || !NameEnds(library.GetString(in->SemanticName), end))
+				return false;
+		}
+	}
+	return true;
+}
+
+// A copy of the library with one header or table field replaced
+struct Corruption
+{
+	const char* Name;
+	size_t Offset;		// Of the uint32_t to overwrite
+	uint32_t Value;
+};
+
+static void Poke(std::vector<unsigned char>& file, size_t offset, uint32_t value)
+{
+	memcpy(&file[offset], &value, sizeof(value));
+}
+
+int main(int argc, char* argv[])
+{
+	const char* path = "ShaderLibraryCheck.shlib";
+	int flips = 20000;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--file") == 0 && hasValue)
+			path = argv[++i];
+		else if (strcmp(argv[i], "--flips") == 0 && hasValue)
+			flips = atoi(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	std::vector<ShaderLibraryShaderDesc> shaders = MakeShaders();
+	ShaderLibraryWriter writer;
+	for (size_t s = 0; s < shaders.size(); s++)
+		writer.AddShader(shaders[s]);
+
+	std::vector<unsigned char> file;
+	if (!writer.Serialize(file) || !writer.WriteToFile(path))
+	{
+		printf("Can't write %s\n", path);
+		return 2;
+	}
+	printf("Library: %d shader(s), %d bytes\n", (int)shaders.size(), (int)file.size());
+
+	// Round trip, both mapped from disk and from memory
+	printf("Round trip\n");
+	{
+		ShaderLibrary library;
+		Check(library.Open(path), "Open() rejected the file the writer made");
+		Check(library.IsValid(), "not valid after Open()");
+		Check(library.GetShaderCount() == shaders.size(), "shader count (mapped)");
+		for (size_t s = 0; s < shaders.size(); s++)
+			Check(ShaderMatches(library, shaders[s]), "shader differs from its description (mapped)");
+		Check(library.FindShader("NoSuchShader") == -1, "found a shader that isn't there");
+		Check(library.GetShader(library.GetShaderCount()) == 0, "GetShader() past the end");
+		library.Close();
+		Check(!library.IsValid() && library.FindShader("VertexShader") == -1, "still valid after Close()");
+
+		Check(library.Load(&file[0], file.size()), "Load() rejected the serialized library");
+		for (size_t s = 0; s < shaders.size(); s++)
+			Check(ShaderMatches(library, shaders[s]), "shader differs from its description (loaded)");
+	}
+
+	// Every shorter prefix must be rejected, whether or not the
+	// header's FileSize is patched to match it
+	printf("Truncated\n");
+	{
+		ShaderLibrary library;
+		int accepted = 0;
+		for (size_t length = 0; length < file.size(); length++)
+		{
+			std::vector<unsigned char> prefix(file.begin(), file.begin() + length);
+			if (library.Load(prefix.empty() ? 0 : &prefix[0], prefix.size()))
+				accepted++;
+			if (length >= sizeof(ShaderLibraryHeader))
+			{
+				Poke(prefix, offsetof(ShaderLibraryHeader, FileSize), (uint32_t)length);
+				if (library.Load(&prefix[0], prefix.size()))
+					accepted++;
+			}
+		}
+		Check(accepted == 0, "a truncated library was accepted");
+
+		// And through the file mapping
+		std::vector<unsigned char> half(file.begin(), file.begin() + file.size() / 2);
+		FILE* out = 0;
+#ifdef _WIN32
+		fopen_s(&out, path, "wb");
+#else
+		out = fopen(path, "wb");
+#endif
+		if (out)
+		{
+			fwrite(&half[0], 1, half.size(), out);
+			fclose(out);
+		}
+		Check(!library.Open(path), "Open() accepted a truncated file");
+		remove(path);
+		Check(!library.Open(path), "Open() accepted a missing file");
+	}
+
+	// Targeted corruptions, one field each
+	printf("Corrupted\n");
+	{
+		const ShaderLibraryHeader* h = (const ShaderLibraryHeader*)&file[0];
+		size_t shader0 = h->ShaderOffset;
+		size_t shader1 = h->ShaderOffset + sizeof(ShaderLibraryShader);
+		size_t buffer0 = h->BufferOffset;
+		Corruption corruptions[] =
+		{
+			{ "magic",						offsetof(ShaderLibraryHeader, Magic),				0x12345678 },
+			{ "version",					offsetof(ShaderLibraryHeader, Version),				SHADER_LIBRARY_VERSION + 1 },
+			{ "file size",					offsetof(ShaderLibraryHeader, FileSize),			h->FileSize + 1 },
+			{ "shader table past the end",	offsetof(ShaderLibraryHeader, ShaderOffset),		h->FileSize },
+			{ "shader count overflow",		offsetof(ShaderLibraryHeader, ShaderCount),			0xFFFFFFFF },
+			{ "misaligned buffer table",	offsetof(ShaderLibraryHeader, BufferOffset),		h->BufferOffset + 2 },
+			{ "variable count too big",		offsetof(ShaderLibraryHeader, VariableCount),		(uint32_t)(h->FileSize / sizeof(ShaderLibraryVariable) + 1) },
+			{ "input table past the end",	offsetof(ShaderLibraryHeader, InputOffset),			h->FileSize - 4 },
+			{ "empty string table",			offsetof(ShaderLibraryHeader, StringTableSize),		0 },
+			{ "unterminated string table",	offsetof(ShaderLibraryHeader, StringTableSize),		h->StringTableSize - 1 },
+			{ "string table past the end",	offsetof(ShaderLibraryHeader, StringTableOffset),	h->FileSize - h->StringTableSize + 1 },
+			{ "shader name",				shader0 + offsetof(ShaderLibraryShader, Name),		h->StringTableSize },
+			{ "shader stage",				shader0 + offsetof(ShaderLibraryShader, Stage),		SHADER_STAGE_COMPUTE + 1 },
+			{ "bytecode past the end",		shader1 + offsetof(ShaderLibraryShader, BytecodeOffset), h->FileSize - 1 },
+			{ "bytecode size",				shader1 + offsetof(ShaderLibraryShader, BytecodeSize), 0xFFFFFFF0 },
+			{ "buffer range",				shader1 + offsetof(ShaderLibraryShader, BufferCount), h->BufferCount },
+			{ "texture range",				shader1 + offsetof(ShaderLibraryShader, FirstTexture), h->ResourceCount },
+			{ "sampler range",				shader1 + offsetof(ShaderLibraryShader, SamplerCount), h->ResourceCount + 1 },
+			{ "input range",				shader0 + offsetof(ShaderLibraryShader, FirstInput), 0xFFFFFFFF },
+			{ "buffer name",				buffer0 + offsetof(ShaderLibraryBuffer, Name),		0x7FFFFFFF },
+			{ "variable range",				buffer0 + offsetof(ShaderLibraryBuffer, FirstVariable), h->VariableCount },
+			{ "variable name",				h->VariableOffset + offsetof(ShaderLibraryVariable, Name), h->StringTableSize + 5 },
+			{ "resource name",				h->ResourceOffset + offsetof(ShaderLibraryResource, Name), h->StringTableSize },
+			{ "input name",					h->InputOffset + offsetof(ShaderLibraryInput, SemanticName), 0xFFFFFFFF },
+		};
+
+		ShaderLibrary library;
+		for (size_t c = 0; c < sizeof(corruptions) / sizeof(corruptions[0]); c++)
+		{
+			std::vector<unsigned char> copy = file;
+			Poke(copy, corruptions[c].Offset, corruptions[c].Value);
+			if (library.Load(&copy[0], copy.size()))
+			{
+				printf("  accepted: %s\n", corruptions[c].Name);
+				Check(false, "a corrupted library was accepted");
+			}
+		}
+
+		// The string table's last byte is its terminator
+		std::vector<unsigned char> copy = file;
+		copy[h->StringTableOffset + h->StringTableSize - 1] = 'x';
+		Check(!library.Load(&copy[0], copy.size()), "accepted a string table without its terminator");
+	}
+
+	// Random byte flips in the header and tables.  Some land on
+	// harmless bytes (a bind index, a name's letters) and are
+	// accepted - those must still never point outside the file.
+	printf("Random flips\n");
+	{
+		const ShaderLibraryHeader* h = (const ShaderLibraryHeader*)&file[0];
+		size_t tablesEnd = h->StringTableOffset + h->StringTableSize;
+		std::mt19937 random(26);
+		std::uniform_int_distribution<size_t> position(0, tablesEnd - 1);
+		std::uniform_int_distribution<int> byte(0, 255);
+
+		ShaderLibrary library;
+		int accepted = 0;
+		int outOfBounds = 0;
+		for (int f = 0; f < flips; f++)
+		{
+			std::vector<unsigned char> copy = file;
+			int count = 1 + f % 4;
+			for (int b = 0; b < count; b++)
+				copy[position(random)] = (unsigned char)byte(random);
+			if (!library.Load(&copy[0], copy.size()))
+				continue;
+			accepted++;
+			if (!StaysInBounds(library, &copy[0], copy.size()))
+				outOfBounds++;
+		}
+		printf("  %d of %d accepted\n", accepted, flips);
+		Check(outOfBounds == 0, "an accepted library points outside the file");
+	}
+
+	if (failures > 0)
+	{
+		printf("\nFAILED: %d check(s)\n", failures);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
@@ -0,0 +1,68 @@
+#include "ShaderPermutation.h"
+
+#include <stdio.h>
+
+// --------------------------------------------------------
+// Builds a key from a light count and feature flags
+//
+// lightCount - Directional lights to evaluate (clamped to
+//              PERMUTATION_MAX_LIGHTS)
+// features   - ShaderPermutationFeature flags
+// --------------------------------------------------------
+ShaderPermutationKey ShaderPermutation::MakeKey(unsigned int lightCount, unsigned int features)
+{
+	if (lightCount > PERMUTATION_MAX_LIGHTS)
+		lightCount = PERMUTATION_MAX_LIGHTS;
+
+	return (lightCount & PERMUTATION_LIGHT_COUNT_MASK) | (features & PERMUTATION_FEATURE_MASK);
+}
+
+unsigned int ShaderPermutation::GetLightCount(ShaderPermutationKey key)
+{
+	return key & PERMUTATION_LIGHT_COUNT_MASK;
+}
+
+bool ShaderPermutation::HasFeature(ShaderPermutationKey key, ShaderPermutationFeature feature)
+{
+	return (key & feature) != 0;
+}
+
+ShaderPermutationKey ShaderPermutation::GetDefaultKey()
+{
+	// Must match the #ifndef defaults at the top of PixelShader.hlsl
+	return MakeKey(2, PERMUTATION_SHADOWS | PERMUTATION_FOG | PERMUTATION_IBL | PERMUTATION_CLUSTERED);
+}
+
+void ShaderPermutation::GetDefines(ShaderPermutationKey key, std::vector<ShaderDefine>& defines)
+{
+	struct { const char* Name; ShaderPermutationFeature Feature; } features[] =
+	{
+		{ "SHADOWS",	PERMUTATION_SHADOWS },
+		{ "FOG",		PERMUTATION_FOG },
+		{ "NORMAL_MAP",	PERMUTATION_NORMAL_MAP },
+		{ "IBL",		PERMUTATION_IBL },
+		{ "CLUSTERED",	PERMUTATION_CLUSTERED },
+	};
+
+	defines.clear();
+
+	ShaderDefine lights;
+	lights.Name = "LIGHT_COUNT";
+	lights.Value = std::to_string(GetLightCount(key));
+	defines.push_back(lights);
+
+	for (unsigned int i = 0; i < sizeof(features) / sizeof(features[0]); i++)
+	{
+		ShaderDefine define;
+		define.Name = features[i].Name;
+		define.Value = HasFeature(key, features[i].Feature) ? "1" : "0";
+		defines.push_back(define);
+	}
+}
+
+std::string ShaderPermutation::GetName(const char* baseName, ShaderPermutationKey key)
+{
+	char suffix[16];
+	snprintf(suffix, sizeof(suffix), "#%02x", key);
+	return std::string(baseName) + suffix;
+}
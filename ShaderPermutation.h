@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------
+// Shader permutation keys
+//
+// A key is a small bit field describing which features a
+// pixel shader variant is compiled with.  Each feature maps
+// to a preprocessor define in PixelShader.hlsl, so unused
+// features are compiled out instead of branched over.
+//
+//   Bits 0-1  LIGHT_COUNT (0 - PERMUTATION_MAX_LIGHTS)
+//   Bit  2    SHADOWS
+//   Bit  3    FOG
+//   Bit  4    NORMAL_MAP
+//   Bit  5    IBL
+//   Bit  6    CLUSTERED (point/spot lights from the cluster grid)
+// --------------------------------------------------------
+typedef unsigned int ShaderPermutationKey;
+
+#define PERMUTATION_LIGHT_COUNT_MASK	0x3
+#define PERMUTATION_MAX_LIGHTS			2
+
+enum ShaderPermutationFeature
+{
+	PERMUTATION_SHADOWS		= 1 << 2,
+	PERMUTATION_FOG			= 1 << 3,
+	PERMUTATION_NORMAL_MAP	= 1 << 4,
+	PERMUTATION_IBL			= 1 << 5,
+	PERMUTATION_CLUSTERED	= 1 << 6,
+
+	PERMUTATION_FEATURE_MASK = PERMUTATION_SHADOWS | PERMUTATION_FOG | PERMUTATION_NORMAL_MAP | PERMUTATION_IBL | PERMUTATION_CLUSTERED
+};
+
+// One preprocessor define, as passed to the shader compiler
+struct ShaderDefine
+{
+	std::string Name;
+	std::string Value;
+};
+
+class ShaderPermutation
+{
+public:
+	static ShaderPermutationKey MakeKey(unsigned int lightCount, unsigned int features);
+	static unsigned int GetLightCount(ShaderPermutationKey key);
+	static bool HasFeature(ShaderPermutationKey key, ShaderPermutationFeature feature);
+
+	// The variant PixelShader.hlsl compiles to with no defines
+	static ShaderPermutationKey GetDefaultKey();
+
+	// Every define for the key (features that are off are
+	// passed as 0 so the shader's defaults never kick in)
+	static void GetDefines(ShaderPermutationKey key, std::vector<ShaderDefine>& defines);
+
+	// Name a variant is stored under in the shader library,
+	// e.g. "PixelShader#0e"
+	static std::string GetName(const char* baseName, ShaderPermutationKey key);
+};
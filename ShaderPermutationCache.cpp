@@ -0,0 +1,166 @@
+#include "ShaderPermutationCache.h"
+#include "ShaderLibraryBaker.h"
+
+#include <stdio.h>
+
+// --------------------------------------------------------
+// Constructor
+//
+// device     - Used to create the shaders
+// context    - Passed on to each SimplePixelShader
+// baseName   - Library name prefix for the variants
+// sourceFile - The .hlsl to compile variants from
+// library    - Baked variants are looked up here (may be null)
+// --------------------------------------------------------
+ShaderPermutationCache::ShaderPermutationCache(
+	ID3D11Device* device,
+	ID3D11DeviceContext* context,
+	const char* baseName,
+	LPCWSTR sourceFile,
+	ShaderLibrary* library)
+{
+	this->device = device;
+	this->context = context;
+	this->baseName = baseName;
+	this->sourceFile = sourceFile;
+	this->library = library;
+	compiledCount = 0;
+}
+
+ShaderPermutationCache::~ShaderPermutationCache()
+{
+	for (unsigned int i = 0; i < variants.size(); i++)
+		delete variants[i].Shader;
+}
+
+void ShaderPermutationCache::AddPixelShader(ShaderPermutationKey key, SimplePixelShader* shader)
+{
+	lookup[key] = shader;
+}
+
+// --------------------------------------------------------
+// Gets the variant for a key, building it if this is the
+// first time it's been asked for
+// --------------------------------------------------------
+SimplePixelShader* ShaderPermutationCache::GetPixelShader(ShaderPermutationKey key)
+{
+	std::unordered_map<ShaderPermutationKey, SimplePixelShader*>::iterator it = lookup.find(key);
+	if (it != lookup.end())
+		return it->second;
+
+	// Check the source first, so an edited .hlsl isn't shadowed
+	// by an old variant in the library
+	unsigned long long sourceTime = ShaderLibraryBaker::GetLastWriteTime(sourceFile.c_str());
+
+	SimplePixelShader* shader = LoadFromLibrary(key, sourceTime);
+	if (!shader)
+	{
+		shader = Compile(key);
+		if (shader)
+			compiledCount++;
+	}
+
+	// Remember failures too, so we don't retry every frame
+	lookup[key] = shader;
+	if (shader)
+	{
+		Variant variant;
+		variant.Key = key;
+		variant.Shader = shader;
+		variant.SourceTime = sourceTime;
+		variants.push_back(variant);
+	}
+
+	return shader;
+}
+
+// --------------------------------------------------------
+// Loads a previously baked variant
+//
+// sourceTime - Current time of the .hlsl (0 if it isn't around,
+//              e.g. running the .exe directly)
+// --------------------------------------------------------
+SimplePixelShader* ShaderPermutationCache::LoadFromLibrary(ShaderPermutationKey key, unsigned long long sourceTime)
+{
+	if (!library || !library->IsValid())
+		return 0;
+
+	std::string name = ShaderPermutation::GetName(baseName.c_str(), key);
+	int index = library->FindShader(name.c_str());
+	if (index < 0)
+		return 0;
+
+	const ShaderLibraryShader* record = library->GetShader(index);
+	unsigned long long bakedTime = ((unsigned long long)record->SourceTimeHigh << 32) | record->SourceTimeLow;
+	if (sourceTime != 0 && sourceTime != bakedTime)
+		return 0;
+
+	SimplePixelShader* shader = new SimplePixelShader(device, context);
+	if (!shader->LoadShaderFromLibrary(library, name.c_str()))
+	{
+		delete shader;
+		return 0;
+	}
+
+	return shader;
+}
+
+// --------------------------------------------------------
+// Compiles the .hlsl with the key's defines
+// --------------------------------------------------------
+SimplePixelShader* ShaderPermutationCache::Compile(ShaderPermutationKey key)
+{
+	std::vector<ShaderDefine> defines;
+	ShaderPermutation::GetDefines(key, defines);
+
+	// D3D wants a null terminated array of name/value pairs
+	std::vector<D3D_SHADER_MACRO> macros;
+	for (unsigned int i = 0; i < defines.size(); i++)
+	{
+		D3D_SHADER_MACRO macro = { defines[i].Name.c_str(), defines[i].Value.c_str() };
+		macros.push_back(macro);
+	}
+	D3D_SHADER_MACRO end = { 0, 0 };
+	macros.push_back(end);
+
+	UINT flags = D3DCOMPILE_ENABLE_STRICTNESS | D3DCOMPILE_OPTIMIZATION_LEVEL3;
+#if defined(DEBUG) || defined(_DEBUG)
+	flags |= D3DCOMPILE_DEBUG;
+#endif
+
+	ID3DBlob* code = 0;
+	ID3DBlob* errors = 0;
+	HRESULT hr = D3DCompileFromFile(
+		sourceFile.c_str(),
+		&macros[0],
+		D3D_COMPILE_STANDARD_FILE_INCLUDE,
+		"main",
+		"ps_5_0",
+		flags,
+		0,
+		&code,
+		&errors);
+
+	if (errors)
+	{
+#if defined(DEBUG) || defined(_DEBUG)
+		printf("\n%s variant %02x:\n%s", baseName.c_str(), key, (const char*)errors->GetBufferPointer());
+#endif
+		errors->Release();
+	}
+
+	if (FAILED(hr))
+		return 0;
+
+	SimplePixelShader* shader = new SimplePixelShader(device, context);
+	bool loaded = shader->LoadShaderBlob(code);
+	code->Release();
+
+	if (!loaded)
+	{
+		delete shader;
+		return 0;
+	}
+
+	return shader;
+}
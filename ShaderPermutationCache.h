@@ -0,0 +1,69 @@
+#pragma once
+
+#include <d3d11.h>
+#include <unordered_map>
+#include <vector>
+
+#include "ShaderPermutation.h"
+#include "SimpleShader.h"
+
+// --------------------------------------------------------
+// Compiled pixel shader variants of one .hlsl file, keyed by
+// ShaderPermutationKey.  Materials look their variant up here
+// when their key is set (see Material::SetPermutation); a
+// variant is built the first time its key is asked for and
+// reused from then on.  Not thread safe - only the main
+// thread asks, never the recording jobs.
+//
+// Variants come from (in order):
+//   - Shaders registered up front (e.g. the build-time .cso)
+//   - The shader library, under ShaderPermutation::GetName()
+//   - Compiling the .hlsl source with the key's defines
+// --------------------------------------------------------
+class ShaderPermutationCache
+{
+public:
+	ShaderPermutationCache(
+		ID3D11Device* device,
+		ID3D11DeviceContext* context,
+		const char* baseName,
+		LPCWSTR sourceFile,
+		ShaderLibrary* library);
+	~ShaderPermutationCache();
+
+	// Registers an existing shader for a key (not owned)
+	void AddPixelShader(ShaderPermutationKey key, SimplePixelShader* shader);
+
+	// Finds or builds the variant, null if it couldn't be built
+	SimplePixelShader* GetPixelShader(ShaderPermutationKey key);
+
+	// Variants this cache built itself, for baking into the library
+	unsigned int GetVariantCount() { return (unsigned int)variants.size(); }
+	ShaderPermutationKey GetVariantKey(unsigned int index) { return variants[index].Key; }
+	SimplePixelShader* GetVariantShader(unsigned int index) { return variants[index].Shader; }
+	unsigned long long GetVariantSourceTime(unsigned int index) { return variants[index].SourceTime; }
+
+	// How many variants had to be compiled from source this run
+	unsigned int GetCompiledCount() { return compiledCount; }
+
+private:
+	struct Variant
+	{
+		ShaderPermutationKey Key;
+		SimplePixelShader* Shader;
+		unsigned long long SourceTime;
+	};
+
+	ID3D11Device* device;
+	ID3D11DeviceContext* context;
+	std::string baseName;
+	std::wstring sourceFile;
+	ShaderLibrary* library;
+
+	std::unordered_map<ShaderPermutationKey, SimplePixelShader*> lookup;
+	std::vector<Variant> variants;
+	unsigned int compiledCount;
+
+	SimplePixelShader* LoadFromLibrary(ShaderPermutationKey key, unsigned long long sourceTime);
+	SimplePixelShader* Compile(ShaderPermutationKey key);
+};
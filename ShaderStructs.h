@@ -0,0 +1,194 @@
+#pragma once
+
+// --------------------------------------------------------
+// GENERATED by GenerateShaderStructs.py from the cbuffers in
+// the .hlsl files - don't edit by hand, edit the shaders.
+//
+// Each cbuffer is a struct named <ShaderFile>_<cbuffer> with
+// HLSL packing applied, so it can be uploaded in one memcpy
+// with ISimpleShader::SetBufferData().
+// --------------------------------------------------------
+
+#include <stddef.h>
+#include <DirectXMath.h>
+
+struct SpotLight
+{
+	DirectX::XMFLOAT4 DiffuseColor;
+	DirectX::XMFLOAT3 Position;
+	float Range;
+	DirectX::XMFLOAT3 Direction;
+	float CosOuterAngle;
+	float CosInnerAngle;
+	float _pad0[3];
+	DirectX::XMFLOAT4X4 ViewProjection;
+	DirectX::XMFLOAT4 AtlasRect;
+};
+static_assert(offsetof(SpotLight, DiffuseColor) == 0, "SpotLight.DiffuseColor offset doesn't match HLSL");
+static_assert(offsetof(SpotLight, Position) == 16, "SpotLight.Position offset doesn't match HLSL");
+static_assert(offsetof(SpotLight, Range) == 28, "SpotLight.Range offset doesn't match HLSL");
+static_assert(offsetof(SpotLight, Direction) == 32, "SpotLight.Direction offset doesn't match HLSL");
+static_assert(offsetof(SpotLight, CosOuterAngle) == 44, "SpotLight.CosOuterAngle offset doesn't match HLSL");
+static_assert(offsetof(SpotLight, CosInnerAngle) == 48, "SpotLight.CosInnerAngle offset doesn't match HLSL");
+static_assert(offsetof(SpotLight, ViewProjection) == 64, "SpotLight.ViewProjection offset doesn't match HLSL");
+static_assert(offsetof(SpotLight, AtlasRect) == 128, "SpotLight.AtlasRect offset doesn't match HLSL");
+static_assert(sizeof(SpotLight) == 144, "SpotLight size doesn't match HLSL");
+
+struct DirectionalLight
+{
+	DirectX::XMFLOAT4 AmbientColor;
+	DirectX::XMFLOAT4 DiffuseColor;
+	DirectX::XMFLOAT3 Direction;
+};
+static_assert(offsetof(DirectionalLight, AmbientColor) == 0, "DirectionalLight.AmbientColor offset doesn't match HLSL");
+static_assert(offsetof(DirectionalLight, DiffuseColor) == 16, "DirectionalLight.DiffuseColor offset doesn't match HLSL");
+static_assert(offsetof(DirectionalLight, Direction) == 32, "DirectionalLight.Direction offset doesn't match HLSL");
+static_assert(sizeof(DirectionalLight) == 44, "DirectionalLight size doesn't match HLSL");
+
+// cbuffer shadowData (PixelShader.hlsl, register(b3))
+struct PixelShader_shadowData
+{
+	DirectX::XMFLOAT4X4 cascadeViewProjection[4];
+	DirectX::XMFLOAT4 cascadeSplits;
+	int cascadeCount;
+	float _pad0[3];
+};
+static_assert(offsetof(PixelShader_shadowData, cascadeViewProjection) == 0, "PixelShader_shadowData.cascadeViewProjection offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_shadowData, cascadeSplits) == 256, "PixelShader_shadowData.cascadeSplits offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_shadowData, cascadeCount) == 272, "PixelShader_shadowData.cascadeCount offset doesn't match HLSL");
+static_assert(sizeof(PixelShader_shadowData) == 288, "PixelShader_shadowData size doesn't match HLSL");
+
+// cbuffer clusterData (PixelShader.hlsl, register(b5))
+struct PixelShader_clusterData
+{
+	DirectX::XMUINT3 clusterCounts;
+	float clusterSliceScale;
+	DirectX::XMFLOAT2 clusterTileSize;
+	float clusterSliceBias;
+	float _pad0[1];
+};
+static_assert(offsetof(PixelShader_clusterData, clusterCounts) == 0, "PixelShader_clusterData.clusterCounts offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_clusterData, clusterSliceScale) == 12, "PixelShader_clusterData.clusterSliceScale offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_clusterData, clusterTileSize) == 16, "PixelShader_clusterData.clusterTileSize offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_clusterData, clusterSliceBias) == 24, "PixelShader_clusterData.clusterSliceBias offset doesn't match HLSL");
+static_assert(sizeof(PixelShader_clusterData) == 32, "PixelShader_clusterData size doesn't match HLSL");
+
+// cbuffer spotLightData (PixelShader.hlsl, register(b4))
+struct PixelShader_spotLightData
+{
+	SpotLight spotLights[4];
+	int spotLightCount;
+	float _pad0[3];
+};
+static_assert(offsetof(PixelShader_spotLightData, spotLights) == 0, "PixelShader_spotLightData.spotLights offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_spotLightData, spotLightCount) == 576, "PixelShader_spotLightData.spotLightCount offset doesn't match HLSL");
+static_assert(sizeof(PixelShader_spotLightData) == 592, "PixelShader_spotLightData size doesn't match HLSL");
+
+// cbuffer externalLight (PixelShader.hlsl, register(b0))
+struct PixelShader_externalLight
+{
+	DirectionalLight light;
+	float _pad0[1];
+	DirectionalLight newLight;
+	float _pad1[1];
+};
+static_assert(offsetof(PixelShader_externalLight, light) == 0, "PixelShader_externalLight.light offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_externalLight, newLight) == 48, "PixelShader_externalLight.newLight offset doesn't match HLSL");
+static_assert(sizeof(PixelShader_externalLight) == 96, "PixelShader_externalLight size doesn't match HLSL");
+
+// cbuffer materialData (PixelShader.hlsl, register(b1))
+struct PixelShader_materialData
+{
+	DirectX::XMFLOAT3 cameraPos;
+	float roughness;
+	float metalness;
+	float _pad0[3];
+};
+static_assert(offsetof(PixelShader_materialData, cameraPos) == 0, "PixelShader_materialData.cameraPos offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_materialData, roughness) == 12, "PixelShader_materialData.roughness offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_materialData, metalness) == 16, "PixelShader_materialData.metalness offset doesn't match HLSL");
+static_assert(sizeof(PixelShader_materialData) == 32, "PixelShader_materialData size doesn't match HLSL");
+
+// cbuffer irradianceData (PixelShader.hlsl, register(b2))
+struct PixelShader_irradianceData
+{
+	DirectX::XMFLOAT4 irradianceSH[9];
+	float radianceBlend;
+	float _pad0[3];
+};
+static_assert(offsetof(PixelShader_irradianceData, irradianceSH) == 0, "PixelShader_irradianceData.irradianceSH offset doesn't match HLSL");
+static_assert(offsetof(PixelShader_irradianceData, radianceBlend) == 144, "PixelShader_irradianceData.radianceBlend offset doesn't match HLSL");
+static_assert(sizeof(PixelShader_irradianceData) == 160, "PixelShader_irradianceData size doesn't match HLSL");
+
+// cbuffer PSConstants (RadMapPS.hlsl, register(b0))
+struct RadMapPS_PSConstants
+{
+	float Face;
+	float MipIndex;
+	float Roughness;
+	unsigned int SampleCount;
+	float SourceSize;
+	float _pad0[3];
+};
+static_assert(offsetof(RadMapPS_PSConstants, Face) == 0, "RadMapPS_PSConstants.Face offset doesn't match HLSL");
+static_assert(offsetof(RadMapPS_PSConstants, MipIndex) == 4, "RadMapPS_PSConstants.MipIndex offset doesn't match HLSL");
+static_assert(offsetof(RadMapPS_PSConstants, Roughness) == 8, "RadMapPS_PSConstants.Roughness offset doesn't match HLSL");
+static_assert(offsetof(RadMapPS_PSConstants, SampleCount) == 12, "RadMapPS_PSConstants.SampleCount offset doesn't match HLSL");
+static_assert(offsetof(RadMapPS_PSConstants, SourceSize) == 16, "RadMapPS_PSConstants.SourceSize offset doesn't match HLSL");
+static_assert(sizeof(RadMapPS_PSConstants) == 32, "RadMapPS_PSConstants size doesn't match HLSL");
+
+// cbuffer VSConstants (RadMapVS.hlsl)
+struct RadMapVS_VSConstants
+{
+	DirectX::XMFLOAT2 HalfPixel;
+	float Face;
+	float MipIndex;
+};
+static_assert(offsetof(RadMapVS_VSConstants, HalfPixel) == 0, "RadMapVS_VSConstants.HalfPixel offset doesn't match HLSL");
+static_assert(offsetof(RadMapVS_VSConstants, Face) == 8, "RadMapVS_VSConstants.Face offset doesn't match HLSL");
+static_assert(offsetof(RadMapVS_VSConstants, MipIndex) == 12, "RadMapVS_VSConstants.MipIndex offset doesn't match HLSL");
+static_assert(sizeof(RadMapVS_VSConstants) == 16, "RadMapVS_VSConstants size doesn't match HLSL");
+
+// cbuffer externalData (ShadowVS.hlsl, register(b0))
+struct ShadowVS_externalData
+{
+	DirectX::XMFLOAT4X4 world;
+	DirectX::XMFLOAT4X4 view;
+	DirectX::XMFLOAT4X4 projection;
+};
+static_assert(offsetof(ShadowVS_externalData, world) == 0, "ShadowVS_externalData.world offset doesn't match HLSL");
+static_assert(offsetof(ShadowVS_externalData, view) == 64, "ShadowVS_externalData.view offset doesn't match HLSL");
+static_assert(offsetof(ShadowVS_externalData, projection) == 128, "ShadowVS_externalData.projection offset doesn't match HLSL");
+static_assert(sizeof(ShadowVS_externalData) == 192, "ShadowVS_externalData size doesn't match HLSL");
+
+// cbuffer externalData (SkyVS.hlsl, register(b0))
+struct SkyVS_externalData
+{
+	DirectX::XMFLOAT4X4 view;
+	DirectX::XMFLOAT4X4 projection;
+};
+static_assert(offsetof(SkyVS_externalData, view) == 0, "SkyVS_externalData.view offset doesn't match HLSL");
+static_assert(offsetof(SkyVS_externalData, projection) == 64, "SkyVS_externalData.projection offset doesn't match HLSL");
+static_assert(sizeof(SkyVS_externalData) == 128, "SkyVS_externalData size doesn't match HLSL");
+
+// cbuffer upscaleData (UpscalePS.hlsl, register(b0))
+struct UpscalePS_upscaleData
+{
+	DirectX::XMFLOAT2 uvScale;
+	DirectX::XMFLOAT2 uvMax;
+};
+static_assert(offsetof(UpscalePS_upscaleData, uvScale) == 0, "UpscalePS_upscaleData.uvScale offset doesn't match HLSL");
+static_assert(offsetof(UpscalePS_upscaleData, uvMax) == 8, "UpscalePS_upscaleData.uvMax offset doesn't match HLSL");
+static_assert(sizeof(UpscalePS_upscaleData) == 16, "UpscalePS_upscaleData size doesn't match HLSL");
+
+// cbuffer externalData (VertexShader.hlsl, register(b0))
+struct VertexShader_externalData
+{
+	DirectX::XMFLOAT4X4 world;
+	DirectX::XMFLOAT4X4 view;
+	DirectX::XMFLOAT4X4 projection;
+};
+static_assert(offsetof(VertexShader_externalData, world) == 0, "VertexShader_externalData.world offset doesn't match HLSL");
+static_assert(offsetof(VertexShader_externalData, view) == 64, "VertexShader_externalData.view offset doesn't match HLSL");
+static_assert(offsetof(VertexShader_externalData, projection) == 128, "VertexShader_externalData.projection offset doesn't match HLSL");
+static_assert(sizeof(VertexShader_externalData) == 192, "VertexShader_externalData size doesn't match HLSL");
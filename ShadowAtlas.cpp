@@ -0,0 +1,367 @@
+#include "ShadowAtlas.h"
+
+#include <algorithm>
+#include <math.h>
+
+// How far (in powers of two) a light's wanted size may drift
+// past its current tile before the tile is resized, so lights
+// near a boundary don't flip sizes (and re-pack) every frame
+static const float SizeHysteresis = 0.25f;
+
+ShadowAtlas::ShadowAtlas(int atlasSize, int minTileSize, int maxTileSize)
+{
+	this->atlasSize = RoundUpToPowerOfTwo(atlasSize);
+	this->minTileSize = std::min(RoundUpToPowerOfTwo(minTileSize), this->atlasSize);
+	this->maxTileSize = std::max(std::min(RoundUpToPowerOfTwo(maxTileSize), this->atlasSize), this->minTileSize);
+
+	levelCount = 1;
+	while ((this->atlasSize >> (levelCount - 1)) > this->minTileSize)
+		levelCount++;
+
+	budget = this->atlasSize * this->atlasSize;
+	budgetChanged = false;
+	distanceWeight = 0.1f;
+
+	repackCount = 0;
+	lastPlacedTiles = 0;
+
+	freeLists.resize(levelCount);
+	Reset();
+}
+
+int ShadowAtlas::RoundUpToPowerOfTwo(int value)
+{
+	int result = 1;
+	while (result < value)
+		result <<= 1;
+	return result;
+}
+
+int ShadowAtlas::GetLevel(int size)
+{
+	int level = 0;
+	while (level < levelCount - 1 && (atlasSize >> level) > size)
+		level++;
+	return level;
+}
+
+void ShadowAtlas::Reset()
+{
+	for (size_t level = 0; level < freeLists.size(); level++)
+		freeLists[level].clear();
+
+	ShadowAtlasTile whole = { 0, 0, atlasSize };
+	freeLists[0].push_back(whole);
+	tiles.clear();
+}
+
+bool ShadowAtlas::Allocate(int size, ShadowAtlasTile& tile)
+{
+	size = RoundUpToPowerOfTwo(size);
+	if (size > atlasSize)
+		return false;
+	return AllocateLevel(GetLevel(size), tile);
+}
+
+// --------------------------------------------------------
+// Takes a free tile of a level, splitting a bigger one if
+// there isn't one
+// --------------------------------------------------------
+bool ShadowAtlas::AllocateLevel(int level, ShadowAtlasTile& tile)
+{
+	std::vector<ShadowAtlasTile>& freeList = freeLists[level];
+	if (!freeList.empty())
+	{
+		tile = freeList.back();
+		freeList.pop_back();
+		return true;
+	}
+
+	ShadowAtlasTile parent;
+	if (level == 0 || !AllocateLevel(level - 1, parent))
+		return false;
+
+	// Keep the first quarter, the other three become free.  The
+	// next one handed out is the quarter beside this one.
+	int half = parent.Size / 2;
+	ShadowAtlasTile quarters[4] =
+	{
+		{ parent.X, parent.Y, half },
+		{ parent.X + half, parent.Y, half },
+		{ parent.X, parent.Y + half, half },
+		{ parent.X + half, parent.Y + half, half },
+	};
+	for (int i = 3; i >= 1; i--)
+		freeList.push_back(quarters[i]);
+
+	tile = quarters[0];
+	return true;
+}
+
+// --------------------------------------------------------
+// Returns a tile, merging it with its three siblings (and so
+// on up the tree) when they're all free
+// --------------------------------------------------------
+void ShadowAtlas::Free(const ShadowAtlasTile& tile)
+{
+	if (tile.Size <= 0)
+		return;
+
+	int level = GetLevel(tile.Size);
+	std::vector<ShadowAtlasTile>& freeList = freeLists[level];
+	if (level == 0)
+	{
+		freeList.push_back(tile);
+		return;
+	}
+
+	int parentSize = tile.Size * 2;
+	int parentX = tile.X - tile.X % parentSize;
+	int parentY = tile.Y - tile.Y % parentSize;
+
+	int siblings[3];
+	int found = 0;
+	for (size_t i = 0; i < freeList.size() && found < 3; i++)
+	{
+		int x = freeList[i].X - parentX;
+		int y = freeList[i].Y - parentY;
+		if (x >= 0 && x < parentSize && y >= 0 && y < parentSize)
+			siblings[found++] = (int)i;
+	}
+
+	if (found < 3)
+	{
+		freeList.push_back(tile);
+		return;
+	}
+
+	// Remove from the back, so the other indices stay valid
+	std::sort(siblings, siblings + 3);
+	for (int i = 2; i >= 0; i--)
+	{
+		freeList[siblings[i]] = freeList.back();
+		freeList.pop_back();
+	}
+
+	ShadowAtlasTile parent = { parentX, parentY, parentSize };
+	Free(parent);
+}
+
+void ShadowAtlas::SetBudget(int texels)
+{
+	int area = atlasSize * atlasSize;
+	texels = std::max(0, std::min(texels, area));
+	if (texels != budget)
+	{
+		budget = texels;
+		budgetChanged = true;
+	}
+}
+
+float ShadowAtlas::GetPriority(const ShadowAtlasRequest& request)
+{
+	return request.ScreenCoverage / (1.0f + std::max(request.Distance, 0.0f) * distanceWeight);
+}
+
+// --------------------------------------------------------
+// The tile size a light's coverage calls for
+//
+// request     - The light
+// currentSize - Its tile now (0 if none), which it keeps
+//               unless the wanted size has clearly moved on
+// --------------------------------------------------------
+int ShadowAtlas::GetWantedSize(const ShadowAtlasRequest& request, int currentSize)
+{
+	if (request.ScreenCoverage <= 0)
+		return 0;
+
+	// The shadow's detail should follow the light's size on
+	// screen: full screen gets the largest tile
+	float wanted = maxTileSize * sqrtf(std::min(request.ScreenCoverage, 1.0f));
+	float level = log2f(std::max(wanted, 1.0f));
+	float minLevel = log2f((float)minTileSize);
+	float maxLevel = log2f((float)maxTileSize);
+	level = std::max(minLevel, std::min(level, maxLevel));
+
+	if (currentSize > 0)
+	{
+		float current = log2f((float)currentSize);
+		if (level > current - 1 - SizeHysteresis && level <= current + SizeHysteresis)
+			return currentSize;
+	}
+
+	return 1 << (int)ceilf(level - 0.0001f);
+}
+
+ShadowAtlasTile ShadowAtlas::GetTile(int id)
+{
+	std::map<int, ShadowAtlasTile>::iterator found = tiles.find(id);
+	if (found != tiles.end())
+		return found->second;
+
+	ShadowAtlasTile none = { 0, 0, 0 };
+	return none;
+}
+
+void ShadowAtlas::Update(const std::vector<ShadowAtlasRequest>& requests)
+{
+	size_t count = requests.size();
+	sizes.resize(count);
+	for (size_t i = 0; i < count; i++)
+		sizes[i] = GetWantedSize(requests[i], GetTile(requests[i].Id).Size);
+
+	// Over budget: halve whichever tile has the least priority
+	// for its area, until everything fits
+	for (;;)
+	{
+		long long total = 0;
+		for (size_t i = 0; i < count; i++)
+			total += (long long)sizes[i] * sizes[i];
+		if (total <= budget)
+			break;
+
+		int cheapest = -1;
+		float cheapestValue = 0;
+		for (size_t i = 0; i < count; i++)
+		{
+			if (sizes[i] == 0)
+				continue;
+			float value = GetPriority(requests[i]) / ((float)sizes[i] * sizes[i]);
+			if (cheapest < 0 || value < cheapestValue)
+			{
+				cheapest = (int)i;
+				cheapestValue = value;
+			}
+		}
+		sizes[cheapest] = sizes[cheapest] / 2 >= minTileSize ? sizes[cheapest] / 2 : 0;
+	}
+
+	if (budgetChanged)
+	{
+		budgetChanged = false;
+		Repack(requests);
+		return;
+	}
+
+	// Keep the tiles that are still the right size, free the
+	// rest - in place, so a frame where nothing changes doesn't
+	// allocate
+	for (std::map<int, ShadowAtlasTile>::iterator it = tiles.begin(); it != tiles.end();)
+	{
+		bool keep = false;
+		for (size_t i = 0; i < count && !keep; i++)
+			keep = requests[i].Id == it->first && sizes[i] == it->second.Size;
+		if (keep)
+			++it;
+		else
+		{
+			Free(it->second);
+			it = tiles.erase(it);
+		}
+	}
+
+	toPlace.clear();
+	for (size_t i = 0; i < count; i++)
+	{
+		if (sizes[i] > 0 && tiles.find(requests[i].Id) == tiles.end())
+			toPlace.push_back(i);
+	}
+
+	// Place the others around them, largest first (ties in
+	// request order)
+	SortBySize(toPlace);
+	for (size_t i = 0; i < toPlace.size(); i++)
+	{
+		ShadowAtlasTile tile;
+		if (!Allocate(sizes[toPlace[i]], tile))
+		{
+			// Too fragmented - start over
+			Repack(requests);
+			return;
+		}
+		tiles[requests[toPlace[i]].Id] = tile;
+	}
+	lastPlacedTiles = (unsigned int)toPlace.size();
+}
+
+// --------------------------------------------------------
+// Places every tile from scratch, largest first.  The sizes
+// fit the budget (at most the atlas), so this can't fail.
+// --------------------------------------------------------
+void ShadowAtlas::Repack(const std::vector<ShadowAtlasRequest>& requests)
+{
+	Reset();
+
+	std::vector<size_t>& order = toPlace;
+	order.clear();
+	for (size_t i = 0; i < requests.size(); i++)
+	{
+		if (sizes[i] > 0)
+			order.push_back(i);
+	}
+	SortBySize(order);
+
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		ShadowAtlasTile tile;
+		if (Allocate(sizes[order[i]], tile))
+			tiles[requests[order[i]].Id] = tile;
+	}
+
+	repackCount++;
+	lastPlacedTiles = (unsigned int)order.size();
+}
+
+// Largest first, ties by index (std::stable_sort would want a
+// buffer from the heap)
+void ShadowAtlas::SortBySize(std::vector<size_t>& indices)
+{
+	std::sort(indices.begin(), indices.end(), [this](size_t a, size_t b)
+	{
+		if (sizes[a] != sizes[b])
+			return sizes[a] > sizes[b];
+		return a < b;
+	});
+}
+
+float ShadowAtlas::EstimateScreenCoverage(float radius, float distance, float fieldOfView)
+{
+	if (distance <= radius)
+		return 1.0f;
+
+	// Angular radius of the sphere, as a fraction of half the
+	// screen's height, then the area of that circle
+	float projected = radius / (sqrtf(distance * distance - radius * radius) * tanf(fieldOfView * 0.5f));
+	float coverage = 3.14159265f * projected * projected * 0.25f;
+	return std::min(coverage, 1.0f);
+}
+
+int ShadowAtlas::GetFreeTexels()
+{
+	int free = 0;
+	for (size_t level = 0; level < freeLists.size(); level++)
+	{
+		int size = atlasSize >> level;
+		free += (int)freeLists[level].size() * size * size;
+	}
+	return free;
+}
+
+int ShadowAtlas::GetLargestFreeTile()
+{
+	for (size_t level = 0; level < freeLists.size(); level++)
+	{
+		if (!freeLists[level].empty())
+			return atlasSize >> level;
+	}
+	return 0;
+}
+
+float ShadowAtlas::GetFragmentation()
+{
+	int free = GetFreeTexels();
+	if (free == 0)
+		return 0;
+	int largest = GetLargestFreeTile();
+	return 1.0f - (float)largest * largest / free;
+}
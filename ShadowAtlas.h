@@ -0,0 +1,116 @@
+#pragma once
+
+#include <stddef.h>
+#include <map>
+#include <vector>
+
+// A square region of the atlas, in texels.  Size 0 means the
+// light got no tile (no shadow this frame).
+struct ShadowAtlasTile
+{
+	int X;
+	int Y;
+	int Size;
+};
+
+// One shadowed light asking for a tile
+struct ShadowAtlasRequest
+{
+	int Id;					// The caller's name for the light (stable across frames)
+	float ScreenCoverage;	// Fraction of the screen its volume covers, 0..1
+	float Distance;			// From the camera
+};
+
+// --------------------------------------------------------
+// Hands out square, power of two tiles of one big shadow
+// depth texture, so any number of shadowed lights (spot
+// lights, say) can share it.
+//
+// Allocation is a quadtree, kept as a free list per level (a
+// buddy allocator): a tile is split into four to make smaller
+// ones, and four free siblings merge back into their parent.
+//
+// Each frame Update() sizes every light's tile from its
+// screen coverage (a light filling the screen gets the
+// largest tile), then shrinks tiles - lowest priority per
+// texel first - until they all fit the texel budget.
+// Priority is coverage, reduced with distance so nearby
+// lights keep their detail.  Lights whose size didn't change
+// keep their tile where it is, and the rest are allocated
+// around them, largest first.  If the tree is too fragmented
+// for that, or the budget changed, everything is re-packed
+// from scratch - largest first, power of two squares always
+// pack perfectly, so a re-pack never fails.
+//
+// CPU only - the caller renders each light into its tile.
+// --------------------------------------------------------
+class ShadowAtlas
+{
+public:
+	// atlasSize   - Width and height of the texture (power of two)
+	// minTileSize - Smallest tile handed out (power of two)
+	// maxTileSize - Largest tile handed out (power of two)
+	ShadowAtlas(int atlasSize, int minTileSize, int maxTileSize);
+
+	// The quadtree itself.  Sizes are rounded up to a power of two.
+	bool Allocate(int size, ShadowAtlasTile& tile);
+	void Free(const ShadowAtlasTile& tile);
+	void Reset();	// Frees everything (including Update's tiles)
+
+	// Texels all tiles together may use (at most the atlas'
+	// area).  A change re-packs on the next Update().
+	void SetBudget(int texels);
+	int GetBudget() { return budget; }
+
+	// How much a light's priority falls per unit of distance
+	void SetDistanceWeight(float weight) { distanceWeight = weight; }
+
+	// Sizes and places every light's tile for this frame.
+	// Lights missing from requests lose their tile.
+	void Update(const std::vector<ShadowAtlasRequest>& requests);
+
+	// This frame's tile for a light (Size 0 if it has none)
+	ShadowAtlasTile GetTile(int id);
+
+	// Size a light would get with no budget to share
+	int GetWantedSize(const ShadowAtlasRequest& request, int currentSize);
+	float GetPriority(const ShadowAtlasRequest& request);
+
+	// Fraction of the screen's height^2 covered by a sphere
+	// (e.g. around a spot light's cone), for ScreenCoverage
+	static float EstimateScreenCoverage(float radius, float distance, float fieldOfView);
+
+	int GetAtlasSize() { return atlasSize; }
+	int GetFreeTexels();
+	int GetLargestFreeTile();
+	float GetFragmentation();	// 1 - largest free tile / free area (0 = not fragmented)
+
+	// Stats
+	unsigned int GetRepackCount() { return repackCount; }
+	unsigned int GetLastPlacedTiles() { return lastPlacedTiles; }	// Tiles (re)placed by the last Update
+
+private:
+	int atlasSize;
+	int minTileSize;
+	int maxTileSize;
+	int levelCount;		// Level 0 is the whole atlas
+	int budget;
+	bool budgetChanged;
+	float distanceWeight;
+
+	std::vector<std::vector<ShadowAtlasTile>> freeLists;	// Per level
+	std::map<int, ShadowAtlasTile> tiles;					// Per light
+
+	unsigned int repackCount;
+	unsigned int lastPlacedTiles;
+
+	// Update's working lists, kept so it doesn't allocate
+	std::vector<int> sizes;			// Per request
+	std::vector<size_t> toPlace;	// Requests to place, in order
+
+	int GetLevel(int size);
+	bool AllocateLevel(int level, ShadowAtlasTile& tile);
+	void Repack(const std::vector<ShadowAtlasRequest>& requests);	// With sizes
+	void SortBySize(std::vector<size_t>& indices);
+	static int RoundUpToPowerOfTwo(int value);
+};
@@ -0,0 +1,247 @@
+// --------------------------------------------------------
+// Offline tool: churns the shadow atlas (see ShadowAtlas)
+// with random lights and budgets for many frames and checks
+// its tiles every frame (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 ShadowAtlasCheck.cpp ShadowAtlas.cpp -o ShadowAtlasCheck
+//   ./ShadowAtlasCheck
+//
+// Options:
+//   --frames N      Frames of churn (default 200000)
+//   --lights N      Lights that come and go (default 48)
+//   --atlas N       Atlas size (default 4096)
+//   --seed N        Random seed (default 38)
+//
+// Fails (returns 1) if tiles overlap, leave the atlas or
+// aren't aligned power of two squares, if free and used
+// texels don't add up to the atlas, if the tiles go over the
+// budget, if a light that didn't change moves (or tiles are
+// placed when nothing has changed for two frames), or if the
+// free lists don't merge back into the whole atlas once every
+// light has gone.  Prints the fragmentation the churn leaves.
+// --------------------------------------------------------
+
+#include "ShadowAtlas.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+static int failures = 0;
+
+static void Check(bool ok, int frame, const char* what)
+{
+	if (!ok)
+	{
+		if (failures < 20)
+			printf("  FAILED (frame %d): %s\n", frame, what);
+		failures++;
+	}
+}
+
+static bool Overlap(const ShadowAtlasTile& a, const ShadowAtlasTile& b)
+{
+	return a.X < b.X + b.Size && b.X < a.X + a.Size && a.Y < b.Y + b.Size && b.Y < a.Y + a.Size;
+}
+
+int main(int argc, char* argv[])
+{
+	int frames = 200000;
+	int lightCount = 48;
+	int atlasSize = 4096;
+	unsigned int seed = 38;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--frames") == 0 && hasValue)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--lights") == 0 && hasValue)
+			lightCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--atlas") == 0 && hasValue)
+			atlasSize = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--seed") == 0 && hasValue)
+			seed = (unsigned int)atoi(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+	if (frames < 1 || lightCount < 1 || atlasSize < 256)
+	{
+		printf("Needs a frame, a light and an atlas of at least 256\n");
+		return 2;
+	}
+
+	const int minTileSize = 64;
+	const int maxTileSize = atlasSize / 4;
+	ShadowAtlas atlas(atlasSize, minTileSize, maxTileSize);
+	long long area = (long long)atlas.GetAtlasSize() * atlas.GetAtlasSize();
+
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// Every light, whether or not it's asking this frame
+	struct Light { ShadowAtlasRequest Request; bool Active; };
+	std::vector<Light> lights(lightCount);
+	for (int l = 0; l < lightCount; l++)
+	{
+		lights[l].Request.Id = 1000 + l * 7;
+		lights[l].Request.ScreenCoverage = unit(random) * unit(random);
+		lights[l].Request.Distance = unit(random) * 50;
+		lights[l].Active = unit(random) < 0.5f;
+	}
+
+	std::vector<ShadowAtlasRequest> requests;
+	std::vector<ShadowAtlasTile> previous(lightCount);
+	std::vector<ShadowAtlasTile> used;
+	double fragmentationSum = 0;
+	float worstFragmentation = 0;
+	unsigned int budgetChanges = 0;
+	bool changedLastFrame = true;
+
+	for (int frame = 0; frame < frames; frame++)
+	{
+		// Now and then the budget moves (as quality settings
+		// would), sometimes below a single smallest tile
+		bool budgetChanged = frame % 997 == 0;
+		if (budgetChanged)
+		{
+			float fraction = unit(random);
+			int budget = fraction < 0.05f ? minTileSize * minTileSize - 1 : (int)(area * (0.1f + 0.9f * fraction));
+			atlas.SetBudget(budget);
+			budgetChanges++;
+		}
+
+		// A few lights move, come or go; the rest hold still.  Two
+		// frames in ten nothing changes.
+		bool stillFrame = frame % 10 >= 8;
+		if (!stillFrame)
+		{
+			int changes = 1 + (int)(unit(random) * 4);
+			for (int c = 0; c < changes; c++)
+			{
+				Light& light = lights[(size_t)(unit(random) * lightCount) % lightCount];
+				float roll = unit(random);
+				if (roll < 0.15f)
+					light.Active = !light.Active;
+				else if (roll < 0.2f)
+					light.Request.ScreenCoverage = 0;
+				else
+				{
+					light.Request.ScreenCoverage += (unit(random) - 0.5f) * 0.2f;
+					if (light.Request.ScreenCoverage < 0) light.Request.ScreenCoverage = unit(random) * 0.05f;
+					if (light.Request.ScreenCoverage > 1) light.Request.ScreenCoverage = 1;
+					light.Request.Distance = unit(random) * 50;
+				}
+			}
+		}
+
+		requests.clear();
+		for (int l = 0; l < lightCount; l++)
+		{
+			if (lights[l].Active)
+				requests.push_back(lights[l].Request);
+		}
+
+		unsigned int repacksBefore = atlas.GetRepackCount();
+		atlas.Update(requests);
+		bool repacked = atlas.GetRepackCount() != repacksBefore;
+
+		// Every tile is an aligned power of two square inside the
+		// atlas, within the size limits, and no two overlap
+		used.clear();
+		long long usedTexels = 0;
+		for (int l = 0; l < lightCount; l++)
+		{
+			ShadowAtlasTile tile = atlas.GetTile(lights[l].Request.Id);
+			if (!lights[l].Active)
+			{
+				Check(tile.Size == 0, frame, "a light that stopped asking kept its tile");
+				previous[l] = tile;
+				continue;
+			}
+			if (tile.Size == 0)
+			{
+				previous[l] = tile;
+				continue;
+			}
+
+			Check((tile.Size & (tile.Size - 1)) == 0, frame, "tile isn't a power of two");
+			Check(tile.Size >= minTileSize && tile.Size <= maxTileSize, frame, "tile outside the size limits");
+			Check(tile.X % tile.Size == 0 && tile.Y % tile.Size == 0, frame, "tile isn't aligned to its size");
+			Check(tile.X >= 0 && tile.Y >= 0 && tile.X + tile.Size <= atlasSize && tile.Y + tile.Size <= atlasSize, frame, "tile outside the atlas");
+			for (size_t u = 0; u < used.size(); u++)
+				Check(!Overlap(tile, used[u]), frame, "tiles overlap");
+			used.push_back(tile);
+			usedTexels += (long long)tile.Size * tile.Size;
+
+			// Unless everything was re-packed, a light whose tile
+			// size stayed the same keeps it where it was
+			if (!repacked && previous[l].Size == tile.Size)
+				Check(previous[l].X == tile.X && previous[l].Y == tile.Y, frame, "an unchanged light moved");
+			previous[l] = tile;
+		}
+
+		// Nothing lost or counted twice, and within the budget
+		Check(usedTexels + atlas.GetFreeTexels() == area, frame, "free and used texels don't add up to the atlas");
+		Check(usedTexels <= atlas.GetBudget(), frame, "tiles over the budget");
+
+		int largest = atlas.GetLargestFreeTile();
+		Check((long long)largest * largest <= atlas.GetFreeTexels(), frame, "largest free tile bigger than the free area");
+		float fragmentation = atlas.GetFragmentation();
+		Check(fragmentation >= 0 && fragmentation < 1, frame, "fragmentation out of range");
+		fragmentationSum += fragmentation;
+		if (fragmentation > worstFragmentation)
+			worstFragmentation = fragmentation;
+
+		// Squeezing tiles into the budget can settle differently
+		// for a frame after a change (sizes start from the tiles
+		// the lights have now), but the second frame in a row
+		// where neither the lights nor the budget changed places
+		// nothing
+		bool changed = !stillFrame || budgetChanged;
+		if (!changed && !changedLastFrame && !repacked)
+			Check(atlas.GetLastPlacedTiles() == 0, frame, "a still frame re-placed tiles");
+		changedLastFrame = changed;
+	}
+
+	printf("%d frames, %d lights, %dx%d atlas: %u repacks, %u budget changes\n",
+		frames, lightCount, atlasSize, atlasSize, atlas.GetRepackCount(), budgetChanges);
+	printf("Fragmentation: %.3f average, %.3f worst\n", fragmentationSum / frames, worstFragmentation);
+
+	// After all that churn, once every light has gone the free
+	// tiles merge all the way back into the whole atlas
+	requests.clear();
+	atlas.Update(requests);
+	Check(atlas.GetFreeTexels() == area, frames, "texels missing once every light has gone");
+	Check(atlas.GetLargestFreeTile() == atlas.GetAtlasSize(), frames, "free tiles didn't merge back into the atlas");
+	Check(atlas.GetFragmentation() == 0, frames, "fragmented with nothing allocated");
+
+	// And the allocator on its own: fill with the smallest tiles,
+	// free every other one (worst case), then the rest
+	atlas.Reset();
+	std::vector<ShadowAtlasTile> small;
+	ShadowAtlasTile tile;
+	while (atlas.Allocate(minTileSize, tile))
+		small.push_back(tile);
+	Check((long long)small.size() * minTileSize * minTileSize == area, frames, "smallest tiles don't fill the atlas");
+	for (size_t t = 0; t < small.size(); t += 2)
+		atlas.Free(small[t]);
+	printf("Checkerboard fragmentation: %.3f\n", atlas.GetFragmentation());
+	Check(atlas.GetLargestFreeTile() == minTileSize && atlas.GetFragmentation() > 0.99f, frames, "checkerboard fragmentation");
+	for (size_t t = 1; t < small.size(); t += 2)
+		atlas.Free(small[t]);
+	Check(atlas.GetLargestFreeTile() == atlas.GetAtlasSize() && atlas.GetFragmentation() == 0, frames, "checkerboard didn't merge back");
+
+	if (failures > 0)
+	{
+		printf("\nFAILED: %d check(s)\n", failures);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
@@ -0,0 +1,113 @@
+#include "ShadowCache.h"
+
+#include <string.h>
+
+ShadowCache::ShadowCache()
+{
+	memset(entries, 0, sizeof(entries));
+	for (int c = 0; c < SHADOW_MAX_CASCADES; c++)
+		entries[c].LastInvalidation = SHADOW_CACHE_EMPTY;
+
+	lightDirection[0] = lightDirection[1] = lightDirection[2] = 0;
+	hasLight = false;
+	staticVersion = 1;
+	staticCasterCount = 0;
+
+	memset(&frame, 0, sizeof(frame));
+	memset(&total, 0, sizeof(total));
+}
+
+void ShadowCache::InvalidateStatic()
+{
+	staticVersion++;
+}
+
+void ShadowCache::SetStaticCasterCount(int count)
+{
+	if (count != staticCasterCount)
+	{
+		staticCasterCount = count;
+		InvalidateStatic();
+	}
+}
+
+// --------------------------------------------------------
+// Resets this frame's counters.  If the light turned, every
+// cascade's light space changed with it.
+// --------------------------------------------------------
+void ShadowCache::BeginFrame(const float lightDirection[3])
+{
+	memset(&frame, 0, sizeof(frame));
+
+	if (!hasLight || memcmp(this->lightDirection, lightDirection, sizeof(this->lightDirection)) != 0)
+	{
+		for (int c = 0; c < SHADOW_MAX_CASCADES; c++)
+		{
+			if (entries[c].Valid)
+			{
+				entries[c].Valid = false;
+				entries[c].LastInvalidation = SHADOW_CACHE_LIGHT_CHANGED;
+			}
+		}
+		memcpy(this->lightDirection, lightDirection, sizeof(this->lightDirection));
+		hasLight = true;
+	}
+}
+
+// --------------------------------------------------------
+// Checks a cascade's cache against this frame's fit
+//
+// cascade - Which cascade
+// fit     - Its matrices this frame
+//
+// Returns true if the static casters must be drawn again
+// --------------------------------------------------------
+bool ShadowCache::NeedsStaticRender(int cascade, const ShadowCascade& fit)
+{
+	Entry& entry = entries[cascade];
+
+	// Exact compares are fine: a snapped fit of an unchanged
+	// view comes out bit for bit the same
+	ShadowCacheInvalidation reason = SHADOW_CACHE_VALID;
+	if (!entry.Valid)
+		reason = entry.LastInvalidation == SHADOW_CACHE_VALID ? SHADOW_CACHE_EMPTY : entry.LastInvalidation;
+	else if (entry.StaticVersion != staticVersion)
+		reason = SHADOW_CACHE_STATIC_CHANGED;
+	else if (memcmp(entry.ViewProjection, fit.ViewProjection, sizeof(entry.ViewProjection)) != 0)
+		reason = SHADOW_CACHE_CASCADE_MOVED;
+
+	entry.LastInvalidation = reason;
+	frame.Invalidations[reason]++;
+	total.Invalidations[reason]++;
+
+	if (reason != SHADOW_CACHE_VALID)
+	{
+		entry.Valid = false;
+		return true;
+	}
+
+	frame.CachedCascades++;
+	total.CachedCascades++;
+	frame.SavedDraws += staticCasterCount;
+	total.SavedDraws += staticCasterCount;
+	return false;
+}
+
+void ShadowCache::StaticRendered(int cascade, const ShadowCascade& fit)
+{
+	Entry& entry = entries[cascade];
+	entry.Valid = true;
+	entry.StaticVersion = staticVersion;
+	memcpy(entry.ViewProjection, fit.ViewProjection, sizeof(entry.ViewProjection));
+
+	frame.RenderedCascades++;
+	total.RenderedCascades++;
+	frame.StaticDraws += staticCasterCount;
+	total.StaticDraws += staticCasterCount;
+}
+
+void ShadowCache::DynamicRendered(int casterCount)
+{
+	frame.DynamicDraws += casterCount;
+	total.DynamicDraws += casterCount;
+}
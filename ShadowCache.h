@@ -0,0 +1,87 @@
+#pragma once
+
+#include "ShadowCascades.h"
+
+// Why a cascade's static depth had to be (re)rendered
+enum ShadowCacheInvalidation
+{
+	SHADOW_CACHE_VALID = 0,			// Reused - nothing changed
+	SHADOW_CACHE_EMPTY,				// Never rendered
+	SHADOW_CACHE_LIGHT_CHANGED,		// The light turned
+	SHADOW_CACHE_STATIC_CHANGED,	// A static caster moved, or the set changed
+	SHADOW_CACHE_CASCADE_MOVED,		// The cascade's box moved (the camera moved)
+	SHADOW_CACHE_INVALIDATION_COUNT
+};
+
+struct ShadowCacheStats
+{
+	unsigned int StaticDraws;		// Static casters drawn (re-rendering the cache)
+	unsigned int DynamicDraws;		// Moving casters drawn on top
+	unsigned int SavedDraws;		// Static casters not drawn, thanks to the cache
+	unsigned int CachedCascades;	// Cascades copied from the cache
+	unsigned int RenderedCascades;	// Cascades whose cache was re-rendered
+	unsigned int Invalidations[SHADOW_CACHE_INVALIDATION_COUNT];
+};
+
+// --------------------------------------------------------
+// Keeps track of which cascades' static shadow depth is still
+// good, so static casters are only drawn when something they
+// depend on changes.
+//
+// The static depth of each cascade lives in its own texture.
+// Each frame a cascade either copies it into the live shadow
+// map (and only the moving casters are drawn on top), or - if
+// the light, the static set or the cascade's box changed -
+// re-renders it first.  Cascades are texel snapped (see
+// ShadowCascades), so their boxes only change when the camera
+// moves a texel or turns, and a still camera costs no static
+// draws at all.
+//
+// Only the bookkeeping lives here; the caller does the
+// drawing and copying.
+// --------------------------------------------------------
+class ShadowCache
+{
+public:
+	ShadowCache();
+
+	// A static caster moved, or one was added or removed
+	void InvalidateStatic();
+	void SetStaticCasterCount(int count);	// Invalidates when it changes
+	int GetStaticCasterCount() { return staticCasterCount; }
+
+	// Starts a frame's counters, and checks the light
+	void BeginFrame(const float lightDirection[3]);
+
+	// Whether a cascade's static depth must be re-rendered this
+	// frame (before copying it).  Counts the draws either way.
+	bool NeedsStaticRender(int cascade, const ShadowCascade& fit);
+
+	// The cascade's static depth has been re-rendered for fit
+	void StaticRendered(int cascade, const ShadowCascade& fit);
+
+	// Moving casters drawn into a cascade this frame
+	void DynamicRendered(int casterCount);
+
+	ShadowCacheInvalidation GetLastInvalidation(int cascade) { return entries[cascade].LastInvalidation; }
+	const ShadowCacheStats& GetFrameStats() { return frame; }
+	const ShadowCacheStats& GetTotalStats() { return total; }
+
+private:
+	struct Entry
+	{
+		bool Valid;
+		unsigned int StaticVersion;
+		float ViewProjection[16];
+		ShadowCacheInvalidation LastInvalidation;
+	};
+	Entry entries[SHADOW_MAX_CASCADES];
+
+	float lightDirection[3];
+	bool hasLight;
+	unsigned int staticVersion;
+	int staticCasterCount;
+
+	ShadowCacheStats frame;
+	ShadowCacheStats total;
+};
@@ -0,0 +1,284 @@
+#include "ShadowCascades.h"
+
+#include <math.h>
+#include <string.h>
+
+ShadowCascadeSettings ShadowCascadeSettings::Default()
+{
+	ShadowCascadeSettings settings;
+	settings.CascadeCount = SHADOW_MAX_CASCADES;
+	settings.Lambda = 0.75f;
+	settings.ShadowDistance = 50.0f;
+	settings.CasterDistance = 20.0f;
+	settings.Resolution = 1024;
+	return settings;
+}
+
+// --------------------------------------------------------
+// Splits the view and fits a cascade to each slice
+//
+// camera         - The view being shadowed
+// lightDirection - Direction the light travels (need not be unit)
+// settings       - Split scheme, distances and resolution
+// cascades       - Receives the cascades, nearest first
+//
+// Returns the number of cascades filled in
+// --------------------------------------------------------
+int ShadowCascades::Fit(const ShadowCamera& camera, const float lightDirection[3], const ShadowCascadeSettings& settings, ShadowCascade cascades[SHADOW_MAX_CASCADES])
+{
+	int count = settings.CascadeCount;
+	if (count < 1)
+		count = 1;
+	if (count > SHADOW_MAX_CASCADES)
+		count = SHADOW_MAX_CASCADES;
+
+	float farClip = settings.ShadowDistance < camera.FarClip ? settings.ShadowDistance : camera.FarClip;
+	float splits[SHADOW_MAX_CASCADES + 1];
+	ComputeSplits(camera.NearClip, farClip, count, settings.Lambda, splits);
+
+	for (int c = 0; c < count; c++)
+	{
+		float corners[8][3];
+		GetFrustumCorners(camera, splits[c], splits[c + 1], corners);
+		float diameter = GetSliceDiameter(camera, splits[c], splits[c + 1]);
+		FitCascade(corners, diameter, lightDirection, settings.Resolution, settings.CasterDistance, cascades[c]);
+		cascades[c].SplitNear = splits[c];
+		cascades[c].SplitFar = splits[c + 1];
+	}
+
+	return count;
+}
+
+void ShadowCascades::ComputeSplits(float nearClip, float farClip, int count, float lambda, float splits[SHADOW_MAX_CASCADES + 1])
+{
+	splits[0] = nearClip;
+	for (int i = 1; i < count; i++)
+	{
+		float fraction = (float)i / count;
+		float logSplit = nearClip * powf(farClip / nearClip, fraction);
+		float uniformSplit = nearClip + (farClip - nearClip) * fraction;
+		splits[i] = lambda * logSplit + (1 - lambda) * uniformSplit;
+	}
+	splits[count] = farClip;
+}
+
+void ShadowCascades::GetFrustumCorners(const ShadowCamera& camera, float splitNear, float splitFar, float corners[8][3])
+{
+	float world[16];
+	InvertRigid(camera.View, world);
+
+	float tanY = tanf(camera.FieldOfView * 0.5f);
+	float tanX = tanY * camera.AspectRatio;
+	const float cornerX[4] = { -1, 1, 1, -1 };
+	const float cornerY[4] = { 1, 1, -1, -1 };
+
+	for (int plane = 0; plane < 2; plane++)
+	{
+		float z = plane == 0 ? splitNear : splitFar;
+		for (int i = 0; i < 4; i++)
+		{
+			float viewPoint[3] = { cornerX[i] * tanX * z, cornerY[i] * tanY * z, z };
+			float worldPoint[4];
+			TransformPoint(world, viewPoint, worldPoint);
+			memcpy(corners[plane * 4 + i], worldPoint, sizeof(float) * 3);
+		}
+	}
+}
+
+// --------------------------------------------------------
+// The longest diagonal of a slice, which bounds its width
+// from any direction.  Measured in view space, so it only
+// depends on the slice's shape: worked out from the world
+// space corners, rounding changes it a little as the camera
+// moves, and every snapped texel with it.
+// --------------------------------------------------------
+float ShadowCascades::GetSliceDiameter(const ShadowCamera& camera, float splitNear, float splitFar)
+{
+	float tanY = tanf(camera.FieldOfView * 0.5f);
+	float tanX = tanY * camera.AspectRatio;
+	const float cornerX[4] = { -1, 1, 1, -1 };
+	const float cornerY[4] = { 1, 1, -1, -1 };
+
+	float corners[8][3];
+	for (int plane = 0; plane < 2; plane++)
+	{
+		float z = plane == 0 ? splitNear : splitFar;
+		for (int i = 0; i < 4; i++)
+		{
+			corners[plane * 4 + i][0] = cornerX[i] * tanX * z;
+			corners[plane * 4 + i][1] = cornerY[i] * tanY * z;
+			corners[plane * 4 + i][2] = z;
+		}
+	}
+
+	float diameter = 0;
+	for (int a = 0; a < 8; a++)
+	{
+		for (int b = a + 1; b < 8; b++)
+		{
+			float dx = corners[a][0] - corners[b][0];
+			float dy = corners[a][1] - corners[b][1];
+			float dz = corners[a][2] - corners[b][2];
+			float length = sqrtf(dx * dx + dy * dy + dz * dz);
+			if (length > diameter)
+				diameter = length;
+		}
+	}
+	return diameter;
+}
+
+// --------------------------------------------------------
+// Fits a stable orthographic box around a frustum slice
+//
+// corners        - The slice's world space corners
+// diameter       - The slice's longest diagonal (GetSliceDiameter)
+// lightDirection - Direction the light travels
+// resolution     - Texels across the cascade's map
+// casterDistance - Extra depth toward the light, for casters
+// cascade        - Receives the matrices and texel size
+// --------------------------------------------------------
+void ShadowCascades::FitCascade(const float corners[8][3], float diameter, const float lightDirection[3], int resolution, float casterDistance, ShadowCascade& cascade)
+{
+	GetLightView(lightDirection, cascade.View);
+
+	// Bounds of the slice in light space
+	float minimum[3] = { 1e30f, 1e30f, 1e30f };
+	float maximum[3] = { -1e30f, -1e30f, -1e30f };
+	for (int i = 0; i < 8; i++)
+	{
+		float light[4];
+		TransformPoint(cascade.View, corners[i], light);
+		for (int axis = 0; axis < 3; axis++)
+		{
+			if (light[axis] < minimum[axis]) minimum[axis] = light[axis];
+			if (light[axis] > maximum[axis]) maximum[axis] = light[axis];
+		}
+	}
+
+	// Two texels of slack, so snapping can't cut the slice off
+	int texels = resolution > 2 ? resolution : 3;
+	float texelSize = diameter / (texels - 2);
+	float size = texelSize * texels;
+	cascade.TexelSize = texelSize;
+
+	// Center the box on the slice, then move it to whole texels
+	float left = (minimum[0] + maximum[0] - size) * 0.5f;
+	float bottom = (minimum[1] + maximum[1] - size) * 0.5f;
+	if (texelSize > 0)
+	{
+		left = floorf(left / texelSize) * texelSize;
+		bottom = floorf(bottom / texelSize) * texelSize;
+	}
+	float right = left + size;
+	float top = bottom + size;
+
+	float nearZ = minimum[2] - casterDistance;
+	float farZ = maximum[2];
+	if (farZ - nearZ < 0.001f)
+		farZ = nearZ + 0.001f;
+
+	// XMMatrixOrthographicOffCenterLH
+	float* p = cascade.Projection;
+	memset(p, 0, sizeof(float) * 16);
+	p[0] = 2 / (right - left);
+	p[5] = 2 / (top - bottom);
+	p[10] = 1 / (farZ - nearZ);
+	p[12] = (left + right) / (left - right);
+	p[13] = (top + bottom) / (bottom - top);
+	p[14] = nearZ / (nearZ - farZ);
+	p[15] = 1;
+
+	Multiply(cascade.View, cascade.Projection, cascade.ViewProjection);
+}
+
+void ShadowCascades::GetLightView(const float lightDirection[3], float view[16])
+{
+	// XMMatrixLookToLH from the origin
+	float z[3] = { lightDirection[0], lightDirection[1], lightDirection[2] };
+	float length = sqrtf(z[0] * z[0] + z[1] * z[1] + z[2] * z[2]);
+	if (length <= 0)
+	{
+		z[0] = 0; z[1] = -1; z[2] = 0;
+		length = 1;
+	}
+	for (int i = 0; i < 3; i++)
+		z[i] /= length;
+
+	// Any up will do, as long as it isn't parallel to the light
+	float up[3] = { 0, 1, 0 };
+	if (fabsf(z[1]) > 0.99f)
+	{
+		up[1] = 0;
+		up[2] = 1;
+	}
+
+	float x[3] = { up[1] * z[2] - up[2] * z[1], up[2] * z[0] - up[0] * z[2], up[0] * z[1] - up[1] * z[0] };
+	length = sqrtf(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+	for (int i = 0; i < 3; i++)
+		x[i] /= length;
+
+	float y[3] = { z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0] };
+
+	for (int i = 0; i < 3; i++)
+	{
+		view[i * 4 + 0] = x[i];
+		view[i * 4 + 1] = y[i];
+		view[i * 4 + 2] = z[i];
+		view[i * 4 + 3] = 0;
+	}
+	view[12] = 0;
+	view[13] = 0;
+	view[14] = 0;
+	view[15] = 1;
+}
+
+void ShadowCascades::Multiply(const float a[16], const float b[16], float result[16])
+{
+	float temp[16];
+	for (int row = 0; row < 4; row++)
+	{
+		for (int column = 0; column < 4; column++)
+		{
+			temp[row * 4 + column] =
+				a[row * 4 + 0] * b[0 * 4 + column] +
+				a[row * 4 + 1] * b[1 * 4 + column] +
+				a[row * 4 + 2] * b[2 * 4 + column] +
+				a[row * 4 + 3] * b[3 * 4 + column];
+		}
+	}
+	memcpy(result, temp, sizeof(temp));
+}
+
+// Inverse of a rotation + translation (like a view matrix)
+void ShadowCascades::InvertRigid(const float m[16], float result[16])
+{
+	float temp[16];
+	for (int row = 0; row < 3; row++)
+	{
+		for (int column = 0; column < 3; column++)
+			temp[row * 4 + column] = m[column * 4 + row];
+		temp[row * 4 + 3] = 0;
+	}
+
+	for (int column = 0; column < 3; column++)
+	{
+		temp[12 + column] = -(
+			m[12] * temp[0 * 4 + column] +
+			m[13] * temp[1 * 4 + column] +
+			m[14] * temp[2 * 4 + column]);
+	}
+	temp[15] = 1;
+	memcpy(result, temp, sizeof(temp));
+}
+
+void ShadowCascades::TransformPoint(const float m[16], const float point[3], float result[4])
+{
+	for (int column = 0; column < 4; column++)
+	{
+		result[column] =
+			point[0] * m[0 * 4 + column] +
+			point[1] * m[1 * 4 + column] +
+			point[2] * m[2 * 4 + column] +
+			m[3 * 4 + column];
+	}
+}
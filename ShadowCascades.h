@@ -0,0 +1,88 @@
+#pragma once
+
+// Most cascades the shaders support (PixelShader's shadowData)
+#define SHADOW_MAX_CASCADES	4
+
+// --------------------------------------------------------
+// How the view is split into cascades
+// --------------------------------------------------------
+struct ShadowCascadeSettings
+{
+	int CascadeCount;		// 1..SHADOW_MAX_CASCADES
+	float Lambda;			// Split scheme: 0 = uniform, 1 = logarithmic
+	float ShadowDistance;	// Shadows end here (clamped to the far plane)
+	float CasterDistance;	// How far toward the light a caster may be beyond its slice
+	int Resolution;			// Width and height of each cascade's map
+
+	static ShadowCascadeSettings Default();
+};
+
+// --------------------------------------------------------
+// The camera a set of cascades covers.  Matrices here are
+// row-major with row vectors, like XMMATRIX (not transposed
+// for HLSL).
+// --------------------------------------------------------
+struct ShadowCamera
+{
+	float View[16];		// World to view, rotation + translation only
+	float FieldOfView;	// Vertical, in radians
+	float AspectRatio;
+	float NearClip;
+	float FarClip;
+};
+
+struct ShadowCascade
+{
+	float SplitNear;			// View space depth range it covers
+	float SplitFar;
+	float View[16];				// World to light space
+	float Projection[16];		// Light space to clip (orthographic)
+	float ViewProjection[16];
+	float TexelSize;			// World units per shadow map texel
+};
+
+// --------------------------------------------------------
+// Cascaded shadow map fitting, on the CPU and without D3D.
+//
+// The view is split with the "practical" scheme (Zhang et
+// al., Parallel-Split Shadow Maps): a blend of logarithmic
+// splits, which keep texel density even across depth, and
+// uniform ones, which stop the near cascades from being tiny.
+//
+// Each slice of the frustum gets an orthographic box around
+// its corners, in a light space that doesn't move with the
+// camera.  The box is always as wide as the slice's longest
+// diagonal (plus two texels), which doesn't change as the
+// camera turns (it's measured in view space, so rounding
+// doesn't change it either), and its corner is snapped to
+// whole texels - so as the camera moves and turns, shadow
+// edges stay put instead of shimmering.  Depth covers the slice plus
+// CasterDistance toward the light, for casters outside it.
+// --------------------------------------------------------
+class ShadowCascades
+{
+public:
+	// Fits every cascade.  Returns the number of cascades.
+	static int Fit(const ShadowCamera& camera, const float lightDirection[3], const ShadowCascadeSettings& settings, ShadowCascade cascades[SHADOW_MAX_CASCADES]);
+
+	// Split depths, splits[0] = near ... splits[count] = far
+	static void ComputeSplits(float nearClip, float farClip, int count, float lambda, float splits[SHADOW_MAX_CASCADES + 1]);
+
+	// World space corners of part of the view frustum (near
+	// face then far face, each clockwise from top left)
+	static void GetFrustumCorners(const ShadowCamera& camera, float splitNear, float splitFar, float corners[8][3]);
+
+	// Longest diagonal of part of the view frustum
+	static float GetSliceDiameter(const ShadowCamera& camera, float splitNear, float splitFar);
+
+	// Fits one cascade around a slice's corners
+	static void FitCascade(const float corners[8][3], float diameter, const float lightDirection[3], int resolution, float casterDistance, ShadowCascade& cascade);
+
+	// The light's view, looking along its direction from the origin
+	static void GetLightView(const float lightDirection[3], float view[16]);
+
+	// Small matrix helpers (row vectors, like XMMATRIX)
+	static void Multiply(const float a[16], const float b[16], float result[16]);
+	static void InvertRigid(const float m[16], float result[16]);
+	static void TransformPoint(const float m[16], const float point[3], float result[4]);
+};
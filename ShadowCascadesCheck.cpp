@@ -0,0 +1,263 @@
+// --------------------------------------------------------
+// Offline tool: checks cascaded shadow map fitting (see
+// ShadowCascades) against random cameras and lights
+// (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 ShadowCascadesCheck.cpp ShadowCascades.cpp -o ShadowCascadesCheck
+//   ./ShadowCascadesCheck
+//
+// Options: --views N (random cameras, default 2000) and
+// --moves N (small camera moves per camera, default 50).
+//
+// Fails (returns 1) if the splits at lambda 0 and 1 aren't
+// uniform and logarithmic, if a cascade doesn't contain its
+// slice of the frustum (and CasterDistance toward the light),
+// or if moving or turning the camera slides shadow texels by
+// anything other than whole texels.
+// --------------------------------------------------------
+
+#include "ShadowCascades.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+
+static int failures = 0;
+
+// Float rounding a few hundred units from the origin moves
+// things by a few hundredths of a texel; a real slide (the
+// box not snapping) is anything up to half a texel
+static const double SlideTolerance = 0.05;
+
+static void Check(bool ok, const char* what, double value)
+{
+	if (!ok)
+	{
+		if (failures < 20)
+			printf("  FAILED: %s (%g)\n", what, value);
+		failures++;
+	}
+}
+
+// A view matrix looking along forward from position
+static void MakeCamera(const float position[3], const float forward[3], float fov, float aspect, float nearClip, float farClip, ShadowCamera& camera)
+{
+	ShadowCascades::GetLightView(forward, camera.View);
+	for (int column = 0; column < 3; column++)
+	{
+		camera.View[12 + column] = -(
+			position[0] * camera.View[0 * 4 + column] +
+			position[1] * camera.View[1 * 4 + column] +
+			position[2] * camera.View[2 * 4 + column]);
+	}
+	camera.FieldOfView = fov;
+	camera.AspectRatio = aspect;
+	camera.NearClip = nearClip;
+	camera.FarClip = farClip;
+}
+
+static void CheckSplits()
+{
+	printf("Splits\n");
+	const float nearClip = 0.1f;
+	const float farClip = 100.0f;
+	for (int count = 1; count <= SHADOW_MAX_CASCADES; count++)
+	{
+		float uniform[SHADOW_MAX_CASCADES + 1];
+		float logarithmic[SHADOW_MAX_CASCADES + 1];
+		ShadowCascades::ComputeSplits(nearClip, farClip, count, 0.0f, uniform);
+		ShadowCascades::ComputeSplits(nearClip, farClip, count, 1.0f, logarithmic);
+
+		for (int i = 0; i <= count; i++)
+		{
+			double fraction = (double)i / count;
+			double expectedUniform = nearClip + (farClip - nearClip) * fraction;
+			double expectedLog = nearClip * pow(farClip / nearClip, fraction);
+			Check(fabs(uniform[i] - expectedUniform) <= 1e-4 * expectedUniform, "lambda 0 isn't uniform", uniform[i]);
+			Check(fabs(logarithmic[i] - expectedLog) <= 1e-4 * expectedLog, "lambda 1 isn't logarithmic", logarithmic[i]);
+		}
+
+		// Logarithmic splits keep each slice's far/near ratio the same
+		for (int i = 1; i < count; i++)
+		{
+			double ratio = logarithmic[i + 1] / logarithmic[i];
+			double firstRatio = logarithmic[1] / logarithmic[0];
+			Check(fabs(ratio - firstRatio) <= 1e-3 * firstRatio, "logarithmic slices have different ratios", ratio);
+		}
+
+		// Anything in between sits between the two, in order
+		for (int step = 1; step < 10; step++)
+		{
+			float lambda = step / 10.0f;
+			float splits[SHADOW_MAX_CASCADES + 1];
+			ShadowCascades::ComputeSplits(nearClip, farClip, count, lambda, splits);
+			Check(splits[0] == nearClip && splits[count] == farClip, "splits don't start at near and end at far", splits[count]);
+			for (int i = 1; i <= count; i++)
+			{
+				Check(splits[i] > splits[i - 1], "splits out of order", splits[i]);
+				if (i < count)
+					Check(splits[i] <= uniform[i] && splits[i] >= logarithmic[i], "split outside the uniform..log range", splits[i]);
+			}
+		}
+	}
+}
+
+// Where a world point lands in a cascade's map, in texels,
+// plus its depth (0..1 inside the box)
+static void ToTexels(const ShadowCascade& cascade, int resolution, const float point[3], double texel[3])
+{
+	float clip[4];
+	ShadowCascades::TransformPoint(cascade.ViewProjection, point, clip);
+	texel[0] = (clip[0] * 0.5 + 0.5) * resolution;
+	texel[1] = (0.5 - clip[1] * 0.5) * resolution;
+	texel[2] = clip[2];
+}
+
+static double FractionOfTexel(double value)
+{
+	return fabs(value - floor(value + 0.5));
+}
+
+static void CheckFitting(int views, int moves)
+{
+	printf("Fitting\n");
+	std::mt19937 random(36);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+	double worstOutside = 0;
+	double worstSlide = 0;
+	for (int v = 0; v < views; v++)
+	{
+		ShadowCascadeSettings settings = ShadowCascadeSettings::Default();
+		settings.CascadeCount = 1 + v % SHADOW_MAX_CASCADES;
+		settings.Lambda = (unit(random) + 1) * 0.5f;
+		settings.Resolution = v % 2 ? 1024 : 512;
+
+		float position[3] = { unit(random) * 200, unit(random) * 20, unit(random) * 200 };
+		float forward[3] = { unit(random), unit(random) * 0.8f, unit(random) };
+		float light[3] = { unit(random), -0.2f - fabsf(unit(random)), unit(random) };
+		if (v % 50 == 0)
+		{
+			// Straight down, where the light view picks another up
+			light[0] = 0;
+			light[1] = -1;
+			light[2] = 0;
+		}
+
+		ShadowCamera camera;
+		float fov = 0.5f + fabsf(unit(random)) * 1.0f;
+		MakeCamera(position, forward, fov, 16.0f / 9.0f, 0.1f, 100.0f, camera);
+
+		ShadowCascade cascades[SHADOW_MAX_CASCADES];
+		int count = ShadowCascades::Fit(camera, light, settings, cascades);
+		Check(count == settings.CascadeCount, "cascade count", count);
+
+		// Each cascade contains its slice, and the casters behind it
+		float lightLength = sqrtf(light[0] * light[0] + light[1] * light[1] + light[2] * light[2]);
+		for (int c = 0; c < count; c++)
+		{
+			float corners[8][3];
+			ShadowCascades::GetFrustumCorners(camera, cascades[c].SplitNear, cascades[c].SplitFar, corners);
+			for (int i = 0; i < 8; i++)
+			{
+				float caster[3];
+				for (int axis = 0; axis < 3; axis++)
+					caster[axis] = corners[i][axis] - light[axis] / lightLength * settings.CasterDistance * 0.999f;
+
+				double texel[3];
+				ToTexels(cascades[c], settings.Resolution, corners[i], texel);
+				double outside = 0;
+				for (int axis = 0; axis < 2; axis++)
+				{
+					if (-texel[axis] > outside) outside = -texel[axis];
+					if (texel[axis] - settings.Resolution > outside) outside = texel[axis] - settings.Resolution;
+				}
+				if (outside > worstOutside)
+					worstOutside = outside;
+				Check(outside <= 0, "slice corner outside its cascade (texels)", outside);
+				Check(texel[2] >= -1e-4 && texel[2] <= 1 + 1e-4, "slice corner outside the depth range", texel[2]);
+
+				ToTexels(cascades[c], settings.Resolution, caster, texel);
+				Check(texel[2] >= -1e-4, "caster toward the light clipped", texel[2]);
+			}
+		}
+
+		// Move the camera a fraction of a texel at a time, and turn
+		// it a little: the width of every cascade stays put and a
+		// fixed point in the world only ever moves by whole texels
+		float probe[3] = { position[0] + forward[0] * 5, position[1] + forward[1] * 5, position[2] + forward[2] * 5 };
+		double before[SHADOW_MAX_CASCADES][3];
+		for (int c = 0; c < count; c++)
+			ToTexels(cascades[c], settings.Resolution, probe, before[c]);
+
+		float moved[3] = { position[0], position[1], position[2] };
+		float turned[3] = { forward[0], forward[1], forward[2] };
+		for (int m = 0; m < moves; m++)
+		{
+			float step = cascades[0].TexelSize * 0.3f;
+			for (int axis = 0; axis < 3; axis++)
+				moved[axis] += unit(random) * step;
+			if (m % 5 == 4)
+			{
+				turned[0] += unit(random) * 0.02f;
+				turned[2] += unit(random) * 0.02f;
+			}
+
+			ShadowCamera next;
+			MakeCamera(moved, turned, fov, 16.0f / 9.0f, 0.1f, 100.0f, next);
+			ShadowCascade nextCascades[SHADOW_MAX_CASCADES];
+			ShadowCascades::Fit(next, light, settings, nextCascades);
+
+			for (int c = 0; c < count; c++)
+			{
+				Check(fabsf(nextCascades[c].TexelSize - cascades[c].TexelSize) <= 1e-5f * cascades[c].TexelSize,
+					"texel size changed as the camera moved", nextCascades[c].TexelSize / cascades[c].TexelSize);
+
+				double after[3];
+				ToTexels(nextCascades[c], settings.Resolution, probe, after);
+				for (int axis = 0; axis < 2; axis++)
+				{
+					double slide = FractionOfTexel(after[axis] - before[c][axis]);
+					if (slide > worstSlide)
+						worstSlide = slide;
+					Check(slide <= SlideTolerance, "shadow texels slid by part of a texel", slide);
+				}
+			}
+		}
+	}
+
+	printf("  Worst corner outside: %.4f texels, worst sub-texel slide: %.4f texels\n", worstOutside, worstSlide);
+}
+
+int main(int argc, char* argv[])
+{
+	int views = 2000;
+	int moves = 50;
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--views") == 0 && hasValue)
+			views = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--moves") == 0 && hasValue)
+			moves = atoi(argv[++i]);
+		else
+		{
+			printf("Unknown argument (or missing value): %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	CheckSplits();
+	CheckFitting(views, moves);
+
+	if (failures > 0)
+	{
+		printf("\nFAILED: %d check(s)\n", failures);
+		return 1;
+	}
+	printf("\nPassed\n");
+	return 0;
+}
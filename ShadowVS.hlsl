@@ -7,6 +7,8 @@ cbuffer externalData : register(b0)
 };
 
 // Struct representing a single vertex worth of data
+// - Just the position, so it can read a mesh's packed
+//   position stream (see Mesh::BindPositionStream)
 struct VertexShaderInput
 {
 	float3 position		: POSITION;
@@ -17,6 +17,9 @@ ISimpleShader::ISimpleShader(ID3D11Device* device, ID3D11DeviceContext* context)
 	constantBufferCount = 0;
 	constantBuffers = 0;
 	shaderBlob = 0;
+	shaderValid = false;
+	library = 0;
+	libraryShader = 0;
 }
 
 // --------------------------------------------------------
@@ -45,6 +48,7 @@ void ISimpleShader::CleanUp()
 	if (constantBuffers)
 	{
 		delete[] constantBuffers;
+		constantBuffers = 0;
 		constantBufferCount = 0;
 	}
 
@@ -54,7 +58,9 @@ void ISimpleShader::CleanUp()
 	for (unsigned int i = 0; i < samplerStates.size(); i++)
 		delete samplerStates[i];
 
-	// Clean up tables
+	// Clean up tables (a reload, or the destructor, runs this again)
+	shaderResourceViews.clear();
+	samplerStates.clear();
 	varTable.clear();
 	cbTable.clear();
 	samplerTable.clear();
@@ -73,12 +79,41 @@ void ISimpleShader::CleanUp()
 bool ISimpleShader::LoadShaderFile(LPCWSTR shaderFile)
 {
 	// Load the shader to a blob and ensure it worked
-	HRESULT hr = D3DReadFileToBlob(shaderFile, &shaderBlob);
+	ID3DBlob* newBlob = 0;
+	HRESULT hr = D3DReadFileToBlob(shaderFile, &newBlob);
 	if (hr != S_OK)
 	{
 		return false;
 	}
 
+	// Hand it to the common path, which keeps its own reference
+	bool result = LoadShaderBlob(newBlob);
+	newBlob->Release();
+	return result;
+}
+
+// --------------------------------------------------------
+// Creates the shader from already compiled bytecode (for instance
+// the output of D3DCompile) and builds the variable table using
+// shader reflection.
+//
+// blob - Compiled shader code.  The shader AddRefs it, so the
+//        caller still releases its own reference.
+// 
+// Returns true if shader is loaded properly, false otherwise
+// --------------------------------------------------------
+bool ISimpleShader::LoadShaderBlob(ID3DBlob* blob)
+{
+	if (!blob)
+	{
+		return false;
+	}
+
+	// Replace any previously loaded code (the shader may be reloaded)
+	blob->AddRef();
+	if (shaderBlob) { shaderBlob->Release(); }
+	shaderBlob = blob;
+
 	// Create the shader - Calls an overloaded version of this abstract
 	// method in the appropriate child class
 	shaderValid = CreateShader(shaderBlob);
@@ -116,27 +151,11 @@ bool ISimpleShader::LoadShaderFile(LPCWSTR shaderFile)
 		switch (resourceDesc.Type)
 		{
 		case D3D_SIT_TEXTURE: // A texture resource
-		{
-			// Create the SRV wrapper
-			SimpleSRV* srv = new SimpleSRV();
-			srv->BindIndex = resourceDesc.BindPoint;	// Shader bind point
-			srv->Index = shaderResourceViews.size();	// Raw index
-
-			textureTable.insert(std::pair<std::string, SimpleSRV*>(resourceDesc.Name, srv));
-			shaderResourceViews.push_back(srv);
-		}
+			AddShaderResourceView(resourceDesc.Name, resourceDesc.BindPoint);
 			break;
 
 		case D3D_SIT_SAMPLER: // A sampler resource
-		{
-			// Create the sampler wrapper
-			SimpleSampler* samp = new SimpleSampler();
-			samp->BindIndex = resourceDesc.BindPoint;	// Shader bind point
-			samp->Index = samplerStates.size();			// Raw index
-
-			samplerTable.insert(std::pair<std::string, SimpleSampler*>(resourceDesc.Name, samp));
-			samplerStates.push_back(samp);
-		}
+			AddSampler(resourceDesc.Name, resourceDesc.BindPoint);
 			break;
 		}
 	}
@@ -157,25 +176,8 @@ bool ISimpleShader::LoadShaderFile(LPCWSTR shaderFile)
 		D3D11_SHADER_INPUT_BIND_DESC bindDesc;
 		refl->GetResourceBindingDescByName(bufferDesc.Name, &bindDesc);
 		
-		// Set up the buffer and put its pointer in the table
-		constantBuffers[b].BindIndex = bindDesc.BindPoint;
-		constantBuffers[b].Name = bufferDesc.Name;
-		cbTable.insert(std::pair<std::string, SimpleConstantBuffer*>(bufferDesc.Name, &constantBuffers[b]));
-
-		// Create this constant buffer
-		D3D11_BUFFER_DESC newBuffDesc;
-		newBuffDesc.Usage = D3D11_USAGE_DEFAULT;
-		newBuffDesc.ByteWidth = bufferDesc.Size;
-		newBuffDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-		newBuffDesc.CPUAccessFlags = 0;
-		newBuffDesc.MiscFlags = 0;
-		newBuffDesc.StructureByteStride = 0;
-		device->CreateBuffer(&newBuffDesc, 0, &constantBuffers[b].ConstantBuffer);
-
-		// Set up the data buffer for this constant buffer
-		constantBuffers[b].Size = bufferDesc.Size;
-		constantBuffers[b].LocalDataBuffer = new unsigned char[bufferDesc.Size];
-		ZeroMemory(constantBuffers[b].LocalDataBuffer, bufferDesc.Size);
+		// Set up the buffer, its local data and its table entry
+		CreateConstantBuffer(b, bufferDesc.Name, bufferDesc.Size, bindDesc.BindPoint);
 
 		// Loop through all variables in this buffer
 		for (unsigned int v = 0; v < bufferDesc.Variables; v++)
@@ -208,6 +210,139 @@ bool ISimpleShader::LoadShaderFile(LPCWSTR shaderFile)
 	return true;
 }
 
+// --------------------------------------------------------
+// Loads the specified shader from a baked shader library.  The
+// library already holds the reflection data, so this skips
+// D3DReflect entirely and just fills in the tables.
+//
+// library    - An open shader library
+// shaderName - The name the shader was baked under
+//
+// Returns true if shader is loaded properly, false otherwise
+// --------------------------------------------------------
+bool ISimpleShader::LoadShaderFromLibrary(ShaderLibrary* library, const char* shaderName)
+{
+	// Find the shader in the library
+	int index = library->FindShader(shaderName);
+	if (index < 0)
+		return false;
+	const ShaderLibraryShader* record = library->GetShader(index);
+
+	// Copy the bytecode into a blob so GetShaderBlob() keeps working
+	if (shaderBlob) { shaderBlob->Release(); shaderBlob = 0; }
+	HRESULT hr = D3DCreateBlob(record->BytecodeSize, &shaderBlob);
+	if (hr != S_OK)
+		return false;
+	memcpy(shaderBlob->GetBufferPointer(), library->GetBytecode(record), record->BytecodeSize);
+
+	// Create the shader, letting the derived class know the
+	// reflection data is coming from the library
+	this->library = library;
+	this->libraryShader = record;
+	shaderValid = CreateShader(shaderBlob);
+	this->library = 0;
+	this->libraryShader = 0;
+	if (!shaderValid)
+	{
+		return false;
+	}
+
+	// Bound resources
+	for (unsigned int t = 0; t < record->TextureCount; t++)
+	{
+		const ShaderLibraryResource* res = library->GetResource(record->FirstTexture + t);
+		AddShaderResourceView(library->GetString(res->Name), res->BindIndex);
+	}
+
+	for (unsigned int s = 0; s < record->SamplerCount; s++)
+	{
+		const ShaderLibraryResource* res = library->GetResource(record->FirstSampler + s);
+		AddSampler(library->GetString(res->Name), res->BindIndex);
+	}
+
+	// Constant buffers and their variables
+	constantBufferCount = record->BufferCount;
+	constantBuffers = new SimpleConstantBuffer[constantBufferCount];
+	for (unsigned int b = 0; b < constantBufferCount; b++)
+	{
+		const ShaderLibraryBuffer* buf = library->GetBuffer(record->FirstBuffer + b);
+		CreateConstantBuffer(b, library->GetString(buf->Name), buf->Size, buf->BindIndex);
+
+		for (unsigned int v = 0; v < buf->VariableCount; v++)
+		{
+			const ShaderLibraryVariable* var = library->GetVariable(buf->FirstVariable + v);
+
+			SimpleShaderVariable varStruct;
+			varStruct.ConstantBufferIndex = b;
+			varStruct.ByteOffset = var->ByteOffset;
+			varStruct.Size = var->Size;
+
+			varTable.insert(std::pair<std::string, SimpleShaderVariable>(library->GetString(var->Name), varStruct));
+			constantBuffers[b].Variables.push_back(varStruct);
+		}
+	}
+
+	return true;
+}
+
+// --------------------------------------------------------
+// Creates the D3D buffer and local data for a constant buffer
+// and adds it to the name table
+//
+// index     - Slot in the constantBuffers array
+// name      - The buffer's name in the shader
+// size      - Size of the buffer in bytes
+// bindIndex - The register the buffer is bound to
+// --------------------------------------------------------
+void ISimpleShader::CreateConstantBuffer(unsigned int index, std::string name, unsigned int size, unsigned int bindIndex)
+{
+	SimpleConstantBuffer* cb = &constantBuffers[index];
+	cb->BindIndex = bindIndex;
+	cb->Name = name;
+	cbTable.insert(std::pair<std::string, SimpleConstantBuffer*>(name, cb));
+
+	// Create this constant buffer
+	D3D11_BUFFER_DESC newBuffDesc;
+	newBuffDesc.Usage = D3D11_USAGE_DEFAULT;
+	newBuffDesc.ByteWidth = size;
+	newBuffDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	newBuffDesc.CPUAccessFlags = 0;
+	newBuffDesc.MiscFlags = 0;
+	newBuffDesc.StructureByteStride = 0;
+	device->CreateBuffer(&newBuffDesc, 0, &cb->ConstantBuffer);
+
+	// Set up the data buffer for this constant buffer
+	cb->Size = size;
+	cb->LocalDataBuffer = new unsigned char[size];
+	ZeroMemory(cb->LocalDataBuffer, size);
+}
+
+// --------------------------------------------------------
+// Creates the SRV wrapper and adds it to the name table
+// --------------------------------------------------------
+void ISimpleShader::AddShaderResourceView(std::string name, unsigned int bindIndex)
+{
+	SimpleSRV* srv = new SimpleSRV();
+	srv->BindIndex = bindIndex;					// Shader bind point
+	srv->Index = shaderResourceViews.size();	// Raw index
+
+	textureTable.insert(std::pair<std::string, SimpleSRV*>(name, srv));
+	shaderResourceViews.push_back(srv);
+}
+
+// --------------------------------------------------------
+// Creates the sampler wrapper and adds it to the name table
+// --------------------------------------------------------
+void ISimpleShader::AddSampler(std::string name, unsigned int bindIndex)
+{
+	SimpleSampler* samp = new SimpleSampler();
+	samp->BindIndex = bindIndex;			// Shader bind point
+	samp->Index = samplerStates.size();		// Raw index
+
+	samplerTable.insert(std::pair<std::string, SimpleSampler*>(name, samp));
+	samplerStates.push_back(samp);
+}
+
 // --------------------------------------------------------
 // Helper for looking up a variable by name and also
 // verifying that it is the requested size
@@ -215,10 +350,10 @@ bool ISimpleShader::LoadShaderFile(LPCWSTR shaderFile)
 // name - the name of the variable to look for
 // size - the size of the variable (for verification), or -1 to bypass
 // --------------------------------------------------------
-SimpleShaderVariable* ISimpleShader::FindVariable(std::string name, int size)
+SimpleShaderVariable* ISimpleShader::FindVariable(const char* name, int size)
 {
 	// Look for the key
-	std::unordered_map<std::string, SimpleShaderVariable>::iterator result =
+	SimpleNameTable<SimpleShaderVariable>::iterator result =
 		varTable.find(name);
 
 	// Did we find the key?
@@ -239,10 +374,10 @@ SimpleShaderVariable* ISimpleShader::FindVariable(std::string name, int size)
 // --------------------------------------------------------
 // Helper for looking up a constant buffer by name
 // --------------------------------------------------------
-SimpleConstantBuffer* ISimpleShader::FindConstantBuffer(std::string name)
+SimpleConstantBuffer* ISimpleShader::FindConstantBuffer(const char* name)
 {
 	// Look for the key
-	std::unordered_map<std::string, SimpleConstantBuffer*>::iterator result =
+	SimpleNameTable<SimpleConstantBuffer*>::iterator result =
 		cbTable.find(name);
 
 	// Did we find the key?
@@ -323,7 +458,7 @@ void ISimpleShader::CopyBufferData(unsigned int index)
 //              Useful for updating more frequently-changing
 //              variables without having to re-copy all buffers.
 // --------------------------------------------------------
-void ISimpleShader::CopyBufferData(std::string bufferName)
+void ISimpleShader::CopyBufferData(const char* bufferName)
 {
 	// Ensure the shader is valid
 	if (!shaderValid) return;
@@ -349,7 +484,7 @@ void ISimpleShader::CopyBufferData(std::string bufferName)
 // Returns true if data is copied, false if variable doesn't 
 // exist or sizes don't match
 // --------------------------------------------------------
-bool ISimpleShader::SetData(std::string name, const void* data, unsigned int size)
+bool ISimpleShader::SetData(const char* name, const void* data, unsigned int size)
 {
 	// Look for the variable and verify
 	SimpleShaderVariable* var = FindVariable(name, size);
@@ -366,10 +501,58 @@ bool ISimpleShader::SetData(std::string name, const void* data, unsigned int siz
 	return true;
 }
 
+// --------------------------------------------------------
+// Sets an entire constant buffer's local data in one copy, from
+// a struct with the same layout (the generated ShaderStructs.h
+// structs match their cbuffers exactly)
+//
+// bufferName - The name of the cbuffer in the shader
+// data       - The buffer's new contents
+// size       - The size of the data (this must match the buffer's size)
+//
+// Returns true if data is copied, false if the buffer doesn't
+// exist or sizes don't match
+// --------------------------------------------------------
+bool ISimpleShader::SetBufferData(const char* bufferName, const void* data, unsigned int size)
+{
+	SimpleConstantBuffer* cb = FindConstantBuffer(bufferName);
+	if (cb == 0 || cb->Size != size)
+		return false;
+
+	memcpy(cb->LocalDataBuffer, data, size);
+	return true;
+}
+
+// --------------------------------------------------------
+// Copies a whole constant buffer's data straight to the GPU
+// buffer on the given context, without going through (or
+// changing) the local copy.  Only reads the shader, so it's
+// safe from several recording threads at once.
+//
+// bufferName - The name of the constant buffer in the shader
+// data       - The struct to copy (see ShaderStructs.h)
+// size       - Its size (must match the buffer's)
+// context    - Context to record the copy on
+//
+// Returns true if data is copied, false if the buffer doesn't
+// exist or sizes don't match
+// --------------------------------------------------------
+bool ISimpleShader::CopyBufferData(const char* bufferName, const void* data, unsigned int size, ID3D11DeviceContext* context)
+{
+	if (!shaderValid) return false;
+
+	SimpleConstantBuffer* cb = FindConstantBuffer(bufferName);
+	if (cb == 0 || cb->Size != size)
+		return false;
+
+	context->UpdateSubresource(cb->ConstantBuffer, 0, 0, data, 0, 0);
+	return true;
+}
+
 // --------------------------------------------------------
 // Sets INTEGER data
 // --------------------------------------------------------
-bool ISimpleShader::SetInt(std::string name, int data)
+bool ISimpleShader::SetInt(const char* name, int data)
 {
 	return this->SetData(name, (void*)(&data), sizeof(int));
 }
@@ -377,7 +560,7 @@ bool ISimpleShader::SetInt(std::string name, int data)
 // --------------------------------------------------------
 // Sets a FLOAT variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetFloat(std::string name, float data)
+bool ISimpleShader::SetFloat(const char* name, float data)
 {
 	return this->SetData(name, (void*)(&data), sizeof(float));
 }
@@ -385,7 +568,7 @@ bool ISimpleShader::SetFloat(std::string name, float data)
 // --------------------------------------------------------
 // Sets a FLOAT2 variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetFloat2(std::string name, const float data[2])
+bool ISimpleShader::SetFloat2(const char* name, const float data[2])
 {
 	return this->SetData(name, (void*)data, sizeof(float) * 2);
 }
@@ -393,7 +576,7 @@ bool ISimpleShader::SetFloat2(std::string name, const float data[2])
 // --------------------------------------------------------
 // Sets a FLOAT2 variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetFloat2(std::string name, const DirectX::XMFLOAT2 data)
+bool ISimpleShader::SetFloat2(const char* name, const DirectX::XMFLOAT2 data)
 {
 	return this->SetData(name, &data, sizeof(float) * 2);
 }
@@ -401,7 +584,7 @@ bool ISimpleShader::SetFloat2(std::string name, const DirectX::XMFLOAT2 data)
 // --------------------------------------------------------
 // Sets a FLOAT3 variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetFloat3(std::string name, const float data[3])
+bool ISimpleShader::SetFloat3(const char* name, const float data[3])
 {
 	return this->SetData(name, (void*)data, sizeof(float) * 3);
 }
@@ -409,7 +592,7 @@ bool ISimpleShader::SetFloat3(std::string name, const float data[3])
 // --------------------------------------------------------
 // Sets a FLOAT3 variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetFloat3(std::string name, const DirectX::XMFLOAT3 data)
+bool ISimpleShader::SetFloat3(const char* name, const DirectX::XMFLOAT3 data)
 {
 	return this->SetData(name, &data, sizeof(float) * 3);
 }
@@ -417,7 +600,7 @@ bool ISimpleShader::SetFloat3(std::string name, const DirectX::XMFLOAT3 data)
 // --------------------------------------------------------
 // Sets a FLOAT4 variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetFloat4(std::string name, const float data[4])
+bool ISimpleShader::SetFloat4(const char* name, const float data[4])
 {
 	return this->SetData(name, (void*)data, sizeof(float) * 4);
 }
@@ -425,7 +608,7 @@ bool ISimpleShader::SetFloat4(std::string name, const float data[4])
 // --------------------------------------------------------
 // Sets a FLOAT4 variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetFloat4(std::string name, const DirectX::XMFLOAT4 data)
+bool ISimpleShader::SetFloat4(const char* name, const DirectX::XMFLOAT4 data)
 {
 	return this->SetData(name, &data, sizeof(float) * 4);
 }
@@ -433,7 +616,7 @@ bool ISimpleShader::SetFloat4(std::string name, const DirectX::XMFLOAT4 data)
 // --------------------------------------------------------
 // Sets a MATRIX (4x4) variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetMatrix4x4(std::string name, const float data[16])
+bool ISimpleShader::SetMatrix4x4(const char* name, const float data[16])
 {
 	return this->SetData(name, (void*)data, sizeof(float) * 16);
 }
@@ -441,7 +624,7 @@ bool ISimpleShader::SetMatrix4x4(std::string name, const float data[16])
 // --------------------------------------------------------
 // Sets a MATRIX (4x4) variable by name in the local data buffer
 // --------------------------------------------------------
-bool ISimpleShader::SetMatrix4x4(std::string name, const DirectX::XMFLOAT4X4 data)
+bool ISimpleShader::SetMatrix4x4(const char* name, const DirectX::XMFLOAT4X4 data)
 {
 	return this->SetData(name, &data, sizeof(float) * 16);
 }
@@ -449,7 +632,7 @@ bool ISimpleShader::SetMatrix4x4(std::string name, const DirectX::XMFLOAT4X4 dat
 // --------------------------------------------------------
 // Gets info about a shader variable, if it exists
 // --------------------------------------------------------
-const SimpleShaderVariable* ISimpleShader::GetVariableInfo(std::string name)
+const SimpleShaderVariable* ISimpleShader::GetVariableInfo(const char* name)
 {
 	return FindVariable(name, -1);
 }
@@ -459,10 +642,10 @@ const SimpleShaderVariable* ISimpleShader::GetVariableInfo(std::string name)
 //
 // name - the name of the SRV
 // --------------------------------------------------------
-const SimpleSRV* ISimpleShader::GetShaderResourceViewInfo(std::string name)
+const SimpleSRV* ISimpleShader::GetShaderResourceViewInfo(const char* name)
 {
 	// Look for the key
-	std::unordered_map<std::string, SimpleSRV*>::iterator result =
+	SimpleNameTable<SimpleSRV*>::iterator result =
 		textureTable.find(name);
 
 	// Did we find the key?
@@ -494,10 +677,10 @@ const SimpleSRV* ISimpleShader::GetShaderResourceViewInfo(unsigned int index)
 // 
 // name - the name of the sampler
 // --------------------------------------------------------
-const SimpleSampler* ISimpleShader::GetSamplerInfo(std::string name)
+const SimpleSampler* ISimpleShader::GetSamplerInfo(const char* name)
 {
 	// Look for the key
-	std::unordered_map<std::string, SimpleSampler*>::iterator result =
+	SimpleNameTable<SimpleSampler*>::iterator result =
 		samplerTable.find(name);
 
 	// Did we find the key?
@@ -547,7 +730,7 @@ unsigned int ISimpleShader::GetBufferSize(unsigned int index)
 // Gets info about a particular constant buffer 
 // by name, if it exists
 // --------------------------------------------------------
-const SimpleConstantBuffer * ISimpleShader::GetBufferInfo(std::string name)
+const SimpleConstantBuffer * ISimpleShader::GetBufferInfo(const char* name)
 {
 	return FindConstantBuffer(name);
 }
@@ -651,6 +834,25 @@ bool SimpleVertexShader::CreateShader(ID3DBlob* shaderBlob)
 	if (inputLayout)
 		return true;
 
+	// Library shaders already carry their input signature
+	std::vector<ShaderLibraryInputDesc> inputs;
+	if (libraryShader)
+	{
+		for (unsigned int i = 0; i < libraryShader->InputCount; i++)
+		{
+			const ShaderLibraryInput* in = library->GetInput(libraryShader->FirstInput + i);
+
+			ShaderLibraryInputDesc desc;
+			desc.SemanticName = library->GetString(in->SemanticName);
+			desc.SemanticIndex = in->SemanticIndex;
+			desc.Mask = in->Mask;
+			desc.ComponentType = in->ComponentType;
+			inputs.push_back(desc);
+		}
+
+		return CreateInputLayout(shaderBlob, inputs);
+	}
+
 	// Vertex shader was created successfully, so we now use the
 	// shader code to re-reflect and create an input layout that 
 	// matches what the vertex shader expects.  Code adapted from:
@@ -668,13 +870,44 @@ bool SimpleVertexShader::CreateShader(ID3DBlob* shaderBlob)
 	D3D11_SHADER_DESC shaderDesc;
 	refl->GetDesc(&shaderDesc);
 
-	// Read input layout description from shader info
-	std::vector<D3D11_INPUT_ELEMENT_DESC> inputLayoutDesc;
+	// Read input signature from shader info
 	for (unsigned int i = 0; i< shaderDesc.InputParameters; i++)
 	{
 		D3D11_SIGNATURE_PARAMETER_DESC paramDesc;
 		refl->GetInputParameterDesc(i, &paramDesc);
 
+		ShaderLibraryInputDesc desc;
+		desc.SemanticName = paramDesc.SemanticName;
+		desc.SemanticIndex = paramDesc.SemanticIndex;
+		desc.Mask = paramDesc.Mask;
+		desc.ComponentType = paramDesc.ComponentType;
+		inputs.push_back(desc);
+	}
+
+	// All done, clean up
+	refl->Release();
+	return CreateInputLayout(shaderBlob, inputs);
+}
+
+// --------------------------------------------------------
+// Creates an input layout matching the vertex shader's
+// input signature
+//
+// shaderBlob - The shader's compiled code
+// inputs     - The input signature, from reflection or a library
+// --------------------------------------------------------
+bool SimpleVertexShader::CreateInputLayout(ID3DBlob* shaderBlob, const std::vector<ShaderLibraryInputDesc>& inputs)
+{
+	// Read input layout description from the signature
+	std::vector<D3D11_INPUT_ELEMENT_DESC> inputLayoutDesc;
+	for (unsigned int i = 0; i < inputs.size(); i++)
+	{
+		const ShaderLibraryInputDesc& paramDesc = inputs[i];
+
+		// System values (e.g. SV_VertexID) don't come from a buffer
+		if (paramDesc.SemanticName.compare(0, 3, "SV_") == 0)
+			continue;
+
 		// Check the semantic name for "_PER_INSTANCE"
 		std::string perInstanceStr = "_PER_INSTANCE";
 		std::string sem = paramDesc.SemanticName;
@@ -685,7 +918,7 @@ bool SimpleVertexShader::CreateShader(ID3DBlob* shaderBlob)
 
 		// Fill out input element desc
 		D3D11_INPUT_ELEMENT_DESC elementDesc;
-		elementDesc.SemanticName = paramDesc.SemanticName;
+		elementDesc.SemanticName = paramDesc.SemanticName.c_str();
 		elementDesc.SemanticIndex = paramDesc.SemanticIndex;
 		elementDesc.InputSlot = 0;
 		elementDesc.AlignedByteOffset = D3D11_APPEND_ALIGNED_ELEMENT;
@@ -732,6 +965,10 @@ bool SimpleVertexShader::CreateShader(ID3DBlob* shaderBlob)
 		inputLayoutDesc.push_back(elementDesc);
 	}
 
+	// Nothing to read from vertex buffers, so no layout at all
+	if (inputLayoutDesc.empty())
+		return true;
+
 	// Try to create Input Layout
 	HRESULT hr = device->CreateInputLayout(
 		&inputLayoutDesc[0], 
@@ -740,8 +977,6 @@ bool SimpleVertexShader::CreateShader(ID3DBlob* shaderBlob)
 		shaderBlob->GetBufferSize(),
 		&inputLayout);
 
-	// All done, clean up
-	refl->Release();
 	return true;
 }
 
@@ -759,9 +994,23 @@ void SimpleVertexShader::SetShaderAndCBs()
 	deviceContext->VSSetShader(shader, 0, 0);
 
 	// Set the constant buffers
+	SetConstantBuffers();
+}
+
+// --------------------------------------------------------
+// Sets this shader's constant buffers without touching the
+// shader itself
+//
+// context - Where to bind them (null for the shader's own)
+// --------------------------------------------------------
+void SimpleVertexShader::SetConstantBuffers(ID3D11DeviceContext* context)
+{
+	if (!shaderValid) return;
+	if (!context) context = deviceContext;
+
 	for (unsigned int i = 0; i < constantBufferCount; i++)
 	{
-		deviceContext->VSSetConstantBuffers(
+		context->VSSetConstantBuffers(
 			constantBuffers[i].BindIndex,
 			1,
 			&constantBuffers[i].ConstantBuffer);
@@ -776,7 +1025,7 @@ void SimpleVertexShader::SetShaderAndCBs()
 //
 // Returns true if a texture of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleVertexShader::SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv)
+bool SimpleVertexShader::SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv)
 {
 	// Look for the variable and verify
 	const SimpleSRV* srvInfo = GetShaderResourceViewInfo(name);
@@ -798,7 +1047,7 @@ bool SimpleVertexShader::SetShaderResourceView(std::string name, ID3D11ShaderRes
 //
 // Returns true if a sampler of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleVertexShader::SetSamplerState(std::string name, ID3D11SamplerState* samplerState)
+bool SimpleVertexShader::SetSamplerState(const char* name, ID3D11SamplerState* samplerState)
 {
 	// Look for the variable and verify
 	const SimpleSampler* sampInfo = GetSamplerInfo(name);
@@ -880,9 +1129,23 @@ void SimplePixelShader::SetShaderAndCBs()
 	deviceContext->PSSetShader(shader, 0, 0);
 
 	// Set the constant buffers
+	SetConstantBuffers();
+}
+
+// --------------------------------------------------------
+// Sets this shader's constant buffers without touching the
+// shader itself
+//
+// context - Where to bind them (null for the shader's own)
+// --------------------------------------------------------
+void SimplePixelShader::SetConstantBuffers(ID3D11DeviceContext* context)
+{
+	if (!shaderValid) return;
+	if (!context) context = deviceContext;
+
 	for (unsigned int i = 0; i < constantBufferCount; i++)
 	{
-		deviceContext->PSSetConstantBuffers(
+		context->PSSetConstantBuffers(
 			constantBuffers[i].BindIndex,
 			1,
 			&constantBuffers[i].ConstantBuffer);
@@ -897,7 +1160,12 @@ void SimplePixelShader::SetShaderAndCBs()
 //
 // Returns true if a texture of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimplePixelShader::SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv)
+bool SimplePixelShader::SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv)
+{
+	return SetShaderResourceView(name, srv, deviceContext);
+}
+
+bool SimplePixelShader::SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv, ID3D11DeviceContext* context)
 {
 	// Look for the variable and verify
 	const SimpleSRV* srvInfo = GetShaderResourceViewInfo(name);
@@ -905,7 +1173,7 @@ bool SimplePixelShader::SetShaderResourceView(std::string name, ID3D11ShaderReso
 		return false;
 
 	// Set the shader resource view
-	deviceContext->PSSetShaderResources(srvInfo->BindIndex, 1, &srv);
+	context->PSSetShaderResources(srvInfo->BindIndex, 1, &srv);
 
 	// Success
 	return true;
@@ -919,7 +1187,12 @@ bool SimplePixelShader::SetShaderResourceView(std::string name, ID3D11ShaderReso
 //
 // Returns true if a sampler of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimplePixelShader::SetSamplerState(std::string name, ID3D11SamplerState* samplerState)
+bool SimplePixelShader::SetSamplerState(const char* name, ID3D11SamplerState* samplerState)
+{
+	return SetSamplerState(name, samplerState, deviceContext);
+}
+
+bool SimplePixelShader::SetSamplerState(const char* name, ID3D11SamplerState* samplerState, ID3D11DeviceContext* context)
 {
 	// Look for the variable and verify
 	const SimpleSampler* sampInfo = GetSamplerInfo(name);
@@ -927,7 +1200,7 @@ bool SimplePixelShader::SetSamplerState(std::string name, ID3D11SamplerState* sa
 		return false;
 
 	// Set the shader resource view
-	deviceContext->PSSetSamplers(sampInfo->BindIndex, 1, &samplerState);
+	context->PSSetSamplers(sampInfo->BindIndex, 1, &samplerState);
 
 	// Success
 	return true;
@@ -1020,7 +1293,7 @@ void SimpleDomainShader::SetShaderAndCBs()
 //
 // Returns true if a texture of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleDomainShader::SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv)
+bool SimpleDomainShader::SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv)
 {
 	// Look for the variable and verify
 	const SimpleSRV* srvInfo = GetShaderResourceViewInfo(name);
@@ -1042,7 +1315,7 @@ bool SimpleDomainShader::SetShaderResourceView(std::string name, ID3D11ShaderRes
 //
 // Returns true if a sampler of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleDomainShader::SetSamplerState(std::string name, ID3D11SamplerState* samplerState)
+bool SimpleDomainShader::SetSamplerState(const char* name, ID3D11SamplerState* samplerState)
 {
 	// Look for the variable and verify
 	const SimpleSampler* sampInfo = GetSamplerInfo(name);
@@ -1142,7 +1415,7 @@ void SimpleHullShader::SetShaderAndCBs()
 //
 // Returns true if a texture of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleHullShader::SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv)
+bool SimpleHullShader::SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv)
 {
 	// Look for the variable and verify
 	const SimpleSRV* srvInfo = GetShaderResourceViewInfo(name);
@@ -1164,7 +1437,7 @@ bool SimpleHullShader::SetShaderResourceView(std::string name, ID3D11ShaderResou
 //
 // Returns true if a sampler of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleHullShader::SetSamplerState(std::string name, ID3D11SamplerState* samplerState)
+bool SimpleHullShader::SetSamplerState(const char* name, ID3D11SamplerState* samplerState)
 {
 	// Look for the variable and verify
 	const SimpleSampler* sampInfo = GetSamplerInfo(name);
@@ -1386,7 +1659,7 @@ void SimpleGeometryShader::SetShaderAndCBs()
 //
 // Returns true if a texture of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleGeometryShader::SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv)
+bool SimpleGeometryShader::SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv)
 {
 	// Look for the variable and verify
 	const SimpleSRV* srvInfo = GetShaderResourceViewInfo(name);
@@ -1408,7 +1681,7 @@ bool SimpleGeometryShader::SetShaderResourceView(std::string name, ID3D11ShaderR
 //
 // Returns true if a sampler of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleGeometryShader::SetSamplerState(std::string name, ID3D11SamplerState* samplerState)
+bool SimpleGeometryShader::SetSamplerState(const char* name, ID3D11SamplerState* samplerState)
 {
 	// Look for the variable and verify
 	const SimpleSampler* sampInfo = GetSamplerInfo(name);
@@ -1624,7 +1897,7 @@ void SimpleComputeShader::DispatchByThreads(unsigned int threadsX, unsigned int
 //
 // Returns true if a texture of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleComputeShader::SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv)
+bool SimpleComputeShader::SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv)
 {
 	// Look for the variable and verify
 	const SimpleSRV* srvInfo = GetShaderResourceViewInfo(name);
@@ -1646,7 +1919,7 @@ bool SimpleComputeShader::SetShaderResourceView(std::string name, ID3D11ShaderRe
 //
 // Returns true if a sampler of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleComputeShader::SetSamplerState(std::string name, ID3D11SamplerState* samplerState)
+bool SimpleComputeShader::SetSamplerState(const char* name, ID3D11SamplerState* samplerState)
 {
 	// Look for the variable and verify
 	const SimpleSampler* sampInfo = GetSamplerInfo(name);
@@ -1669,7 +1942,7 @@ bool SimpleComputeShader::SetSamplerState(std::string name, ID3D11SamplerState*
 //
 // Returns true if a UAV of the given name was found, false otherwise
 // --------------------------------------------------------
-bool SimpleComputeShader::SetUnorderedAccessView(std::string name, ID3D11UnorderedAccessView * uav, unsigned int appendConsumeOffset)
+bool SimpleComputeShader::SetUnorderedAccessView(const char* name, ID3D11UnorderedAccessView * uav, unsigned int appendConsumeOffset)
 {
 	// Look for the variable and verify
 	unsigned int bindIndex = GetUnorderedAccessViewIndex(name);
@@ -1686,10 +1959,10 @@ bool SimpleComputeShader::SetUnorderedAccessView(std::string name, ID3D11Unorder
 // --------------------------------------------------------
 // Gets the index of the specified UAV (or -1)
 // --------------------------------------------------------
-int SimpleComputeShader::GetUnorderedAccessViewIndex(std::string name)
+int SimpleComputeShader::GetUnorderedAccessViewIndex(const char* name)
 {
 	// Look for the key
-	std::unordered_map<std::string, unsigned int>::iterator result =
+	SimpleNameTable<unsigned int>::iterator result =
 		uavTable.find(name);
 
 	// Did we find the key?
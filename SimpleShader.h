@@ -6,10 +6,21 @@
 #include <d3dcompiler.h>
 #include <DirectXMath.h>
 
-#include <unordered_map>
+#include <functional>
+#include <map>
 #include <vector>
 #include <string>
 
+#include "ShaderLibrary.h"
+
+// --------------------------------------------------------
+// Name -> info tables.  Ordered with a transparent compare
+// so a lookup by const char* doesn't build a std::string
+// (the Set...() calls happen every draw).
+// --------------------------------------------------------
+template <typename T>
+using SimpleNameTable = std::map<std::string, T, std::less<>>;
+
 // --------------------------------------------------------
 // Used by simple shaders to store information about
 // specific variables in constant buffers
@@ -66,6 +77,8 @@ public:
 	// Initialization method (since we can't invoke derived class
 	// overrides in the base class constructor)
 	bool LoadShaderFile(LPCWSTR shaderFile);
+	bool LoadShaderBlob(ID3DBlob* blob);
+	bool LoadShaderFromLibrary(ShaderLibrary* library, const char* shaderName);
 
 	// Simple helpers
 	bool IsShaderValid() { return shaderValid; }
@@ -74,41 +87,49 @@ public:
 	void SetShader();
 	void CopyAllBufferData();
 	void CopyBufferData(unsigned int index);
-	void CopyBufferData(std::string bufferName);
+	void CopyBufferData(const char* bufferName);
 
 	// Sets arbitrary shader data
-	bool SetData(std::string name, const void* data, unsigned int size);
-
-	bool SetInt(std::string name, int data);
-	bool SetFloat(std::string name, float data);
-	bool SetFloat2(std::string name, const float data[2]);
-	bool SetFloat2(std::string name, const DirectX::XMFLOAT2 data);
-	bool SetFloat3(std::string name, const float data[3]);
-	bool SetFloat3(std::string name, const DirectX::XMFLOAT3 data);
-	bool SetFloat4(std::string name, const float data[4]);
-	bool SetFloat4(std::string name, const DirectX::XMFLOAT4 data);
-	bool SetMatrix4x4(std::string name, const float data[16]);
-	bool SetMatrix4x4(std::string name, const DirectX::XMFLOAT4X4 data);
+	bool SetData(const char* name, const void* data, unsigned int size);
+
+	// Sets a whole constant buffer at once (see ShaderStructs.h)
+	bool SetBufferData(const char* bufferName, const void* data, unsigned int size);
+
+	// Copies data straight into a constant buffer on any context
+	// (e.g. a deferred one), leaving the local copy alone - so
+	// jobs recording on different threads can share a shader
+	bool CopyBufferData(const char* bufferName, const void* data, unsigned int size, ID3D11DeviceContext* context);
+
+	bool SetInt(const char* name, int data);
+	bool SetFloat(const char* name, float data);
+	bool SetFloat2(const char* name, const float data[2]);
+	bool SetFloat2(const char* name, const DirectX::XMFLOAT2 data);
+	bool SetFloat3(const char* name, const float data[3]);
+	bool SetFloat3(const char* name, const DirectX::XMFLOAT3 data);
+	bool SetFloat4(const char* name, const float data[4]);
+	bool SetFloat4(const char* name, const DirectX::XMFLOAT4 data);
+	bool SetMatrix4x4(const char* name, const float data[16]);
+	bool SetMatrix4x4(const char* name, const DirectX::XMFLOAT4X4 data);
 
 	// Setting shader resources
-	virtual bool SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv) = 0;
-	virtual bool SetSamplerState(std::string name, ID3D11SamplerState* samplerState) = 0;
+	virtual bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv) = 0;
+	virtual bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState) = 0;
 
 	// Getting data about variables and resources
-	const SimpleShaderVariable* GetVariableInfo(std::string name);
+	const SimpleShaderVariable* GetVariableInfo(const char* name);
 	
-	const SimpleSRV* GetShaderResourceViewInfo(std::string name);
+	const SimpleSRV* GetShaderResourceViewInfo(const char* name);
 	const SimpleSRV* GetShaderResourceViewInfo(unsigned int index);
 	unsigned int GetShaderResourceViewCount() { return textureTable.size(); }
 	
-	const SimpleSampler* GetSamplerInfo(std::string name);
+	const SimpleSampler* GetSamplerInfo(const char* name);
 	const SimpleSampler* GetSamplerInfo(unsigned int index);
 	unsigned int GetSamplerCount() { return samplerTable.size(); }
 
 	// Get data about constant buffers
 	unsigned int GetBufferCount();
 	unsigned int GetBufferSize(unsigned int index);
-	const SimpleConstantBuffer* GetBufferInfo(std::string name);
+	const SimpleConstantBuffer* GetBufferInfo(const char* name);
 	const SimpleConstantBuffer* GetBufferInfo(unsigned int index);
 	
 	// Misc getters
@@ -128,10 +149,15 @@ protected:
 	SimpleConstantBuffer*		constantBuffers; // For index-based lookup
 	std::vector<SimpleSRV*>		shaderResourceViews;
 	std::vector<SimpleSampler*>	samplerStates;
-	std::unordered_map<std::string, SimpleConstantBuffer*> cbTable;
-	std::unordered_map<std::string, SimpleShaderVariable> varTable;
-	std::unordered_map<std::string, SimpleSRV*> textureTable;
-	std::unordered_map<std::string, SimpleSampler*> samplerTable;
+	SimpleNameTable<SimpleConstantBuffer*> cbTable;
+	SimpleNameTable<SimpleShaderVariable> varTable;
+	SimpleNameTable<SimpleSRV*> textureTable;
+	SimpleNameTable<SimpleSampler*> samplerTable;
+
+	// Set only while loading from a shader library, so derived
+	// classes can skip their own reflection in CreateShader()
+	ShaderLibrary* library;
+	const ShaderLibraryShader* libraryShader;
 
 	// Pure virtual functions for dealing with shader types
 	virtual bool CreateShader(ID3DBlob* shaderBlob) = 0;
@@ -140,8 +166,13 @@ protected:
 	virtual void CleanUp();
 
 	// Helpers for finding data by name
-	SimpleShaderVariable* FindVariable(std::string name, int size);
-	SimpleConstantBuffer* FindConstantBuffer(std::string name);
+	SimpleShaderVariable* FindVariable(const char* name, int size);
+	SimpleConstantBuffer* FindConstantBuffer(const char* name);
+
+	// Shared by the reflection and library load paths
+	void CreateConstantBuffer(unsigned int index, std::string name, unsigned int size, unsigned int bindIndex);
+	void AddShaderResourceView(std::string name, unsigned int bindIndex);
+	void AddSampler(std::string name, unsigned int bindIndex);
 };
 
 // --------------------------------------------------------
@@ -157,8 +188,13 @@ public:
 	ID3D11InputLayout* GetInputLayout() { return inputLayout; }
 	bool GetPerInstanceCompatible() { return perInstanceCompatible; }
 
-	bool SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv);
-	bool SetSamplerState(std::string name, ID3D11SamplerState* samplerState);
+	bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv);
+	bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState);
+
+	// Binds just the constant buffers (for when the shader itself
+	// is set by something else, e.g. a pipeline state), on the
+	// shader's own context unless another is given
+	void SetConstantBuffers(ID3D11DeviceContext* context = 0);
 
 protected:
 	bool perInstanceCompatible;
@@ -167,6 +203,9 @@ protected:
 	bool CreateShader(ID3DBlob* shaderBlob);
 	void SetShaderAndCBs();
 	void CleanUp();
+
+	// Builds the input layout from (semantic, index, mask, type) tuples
+	bool CreateInputLayout(ID3DBlob* shaderBlob, const std::vector<ShaderLibraryInputDesc>& inputs);
 };
 
 
@@ -180,8 +219,17 @@ public:
 	~SimplePixelShader();
 	ID3D11PixelShader* GetDirectXShader() { return shader; }
 
-	bool SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv);
-	bool SetSamplerState(std::string name, ID3D11SamplerState* samplerState);
+	bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv);
+	bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState);
+
+	// The same, on another context (e.g. a deferred one)
+	bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv, ID3D11DeviceContext* context);
+	bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState, ID3D11DeviceContext* context);
+
+	// Binds just the constant buffers (for when the shader itself
+	// is set by something else, e.g. a pipeline state), on the
+	// shader's own context unless another is given
+	void SetConstantBuffers(ID3D11DeviceContext* context = 0);
 
 protected:
 	ID3D11PixelShader* shader;
@@ -200,8 +248,8 @@ public:
 	~SimpleDomainShader();
 	ID3D11DomainShader* GetDirectXShader() { return shader; }
 
-	bool SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv);
-	bool SetSamplerState(std::string name, ID3D11SamplerState* samplerState);
+	bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv);
+	bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState);
 
 protected:
 	ID3D11DomainShader* shader;
@@ -220,8 +268,8 @@ public:
 	~SimpleHullShader();
 	ID3D11HullShader* GetDirectXShader() { return shader; }
 
-	bool SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv);
-	bool SetSamplerState(std::string name, ID3D11SamplerState* samplerState);
+	bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv);
+	bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState);
 
 protected:
 	ID3D11HullShader* shader;
@@ -240,8 +288,8 @@ public:
 	~SimpleGeometryShader();
 	ID3D11GeometryShader* GetDirectXShader() { return shader; }
 
-	bool SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv);
-	bool SetSamplerState(std::string name, ID3D11SamplerState* samplerState);
+	bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv);
+	bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState);
 
 	bool CreateCompatibleStreamOutBuffer(ID3D11Buffer** buffer, int vertexCount);
 
@@ -279,15 +327,15 @@ public:
 	void DispatchByGroups(unsigned int groupsX, unsigned int groupsY, unsigned int groupsZ);
 	void DispatchByThreads(unsigned int threadsX, unsigned int threadsY, unsigned int threadsZ);
 
-	bool SetShaderResourceView(std::string name, ID3D11ShaderResourceView* srv);
-	bool SetSamplerState(std::string name, ID3D11SamplerState* samplerState);
-	bool SetUnorderedAccessView(std::string name, ID3D11UnorderedAccessView* uav, unsigned int appendConsumeOffset = -1);
+	bool SetShaderResourceView(const char* name, ID3D11ShaderResourceView* srv);
+	bool SetSamplerState(const char* name, ID3D11SamplerState* samplerState);
+	bool SetUnorderedAccessView(const char* name, ID3D11UnorderedAccessView* uav, unsigned int appendConsumeOffset = -1);
 
-	int GetUnorderedAccessViewIndex(std::string name);
+	int GetUnorderedAccessViewIndex(const char* name);
 
 protected:
 	ID3D11ComputeShader* shader;
-	std::unordered_map<std::string, unsigned int> uavTable;
+	SimpleNameTable<unsigned int> uavTable;
 
 	unsigned int threadsX;
 	unsigned int threadsY;
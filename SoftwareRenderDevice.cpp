@@ -0,0 +1,899 @@
+#include "SoftwareRenderDevice.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SOFTWARE_RENDER_SSE
+#endif
+
+// The ports read whole cbuffers, even past the end of a
+// smaller buffer - so constant buffers are at least this big,
+// and unbound slots read this many zeroes
+static const unsigned int MinConstantBytes = 1024;
+static const unsigned char zeroConstants[MinConstantBytes] = {};
+
+// Vertices are snapped to 1/16th of a pixel
+static const float SubpixelSteps = 16.0f;
+
+// Clipping the near and far planes adds up to two vertices
+static const int MaxClipVertices = 5;
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int GetChannels(RenderFormat format)
+{
+	switch (format)
+	{
+	case RENDER_FORMAT_RGBA8_UNORM:
+	case RENDER_FORMAT_RGBA16_FLOAT:	return 4;
+	case RENDER_FORMAT_RG16_FLOAT:		return 2;
+	default:							return 1;
+	}
+}
+
+static float HalfToFloat(unsigned short half)
+{
+	int exponent = (half >> 10) & 0x1F;
+	int mantissa = half & 0x3FF;
+	float value;
+	if (exponent == 0)
+		value = ldexpf((float)mantissa, -24);
+	else if (exponent == 31)
+		value = mantissa ? NAN : INFINITY;
+	else
+		value = ldexpf((float)(mantissa | 0x400), exponent - 25);
+	return (half & 0x8000) ? -value : value;
+}
+
+// --------------------------------------------------------
+// Context
+// --------------------------------------------------------
+SoftwareRenderContext::SoftwareRenderContext(SoftwareRenderDevice* device)
+{
+	this->device = device;
+	pipeline = 0;
+	vertexBuffer = 0;
+	vertexStride = 0;
+	vertexOffset = 0;
+	indexBuffer = 0;
+	memset(constants, 0, sizeof(constants));
+	memset(resources, 0, sizeof(resources));
+	memset(samplers, 0, sizeof(samplers));
+	colorTarget = 0;
+	depthTarget = 0;
+	depthSlice = 0;
+	memset(viewport, 0, sizeof(viewport));
+	tilesX = 0;
+	tilesY = 0;
+}
+
+void SoftwareRenderContext::SetPipeline(RenderPipelineHandle pipeline)
+{
+	this->pipeline = pipeline;
+}
+
+void SoftwareRenderContext::SetVertexBuffer(int slot, RenderBufferHandle buffer, unsigned int stride, unsigned int offset)
+{
+	// Only slot 0 has anything in the layouts
+	if (slot != 0)
+		return;
+	vertexBuffer = buffer;
+	vertexStride = stride;
+	vertexOffset = offset;
+}
+
+void SoftwareRenderContext::SetIndexBuffer(RenderBufferHandle buffer)
+{
+	indexBuffer = buffer;
+}
+
+void SoftwareRenderContext::SetConstantBuffer(RenderShaderStage stage, int slot, RenderBufferHandle buffer)
+{
+	if (slot >= 0 && slot < SOFTWARE_MAX_CONSTANT_BUFFERS)
+		constants[stage][slot] = buffer;
+}
+
+void SoftwareRenderContext::SetTexture(RenderShaderStage stage, int slot, RenderTextureHandle texture)
+{
+	if (slot >= 0 && slot < SOFTWARE_MAX_RESOURCES)
+		resources[stage][slot] = texture;
+}
+
+void SoftwareRenderContext::SetSampler(RenderShaderStage stage, int slot, RenderSamplerHandle sampler)
+{
+	if (slot >= 0 && slot < SOFTWARE_MAX_SAMPLERS)
+		samplers[stage][slot] = sampler;
+}
+
+void SoftwareRenderContext::UpdateBuffer(RenderBufferHandle buffer, const void* data, unsigned int size)
+{
+	SoftwareRenderDevice::Entry* entry = device->Get(buffer);
+	if (!entry || entry->Resource.IsTexture)
+		return;
+
+	// Queued draws copied their constants, but read structured
+	// buffers in place
+	if (entry->Resource.BufferDesc.Type == RENDER_BUFFER_STRUCTURED)
+		Flush();
+
+	std::vector<unsigned char>& bytes = entry->Resource.Bytes;
+	memcpy(&bytes[0], data, size < bytes.size() ? size : bytes.size());
+}
+
+void SoftwareRenderContext::UpdateTexture(RenderTextureHandle texture, int slice, const void* data, unsigned int rowPitch)
+{
+	SoftwareRenderDevice::Entry* entry = device->Get(texture);
+	if (!entry || !entry->Resource.IsTexture)
+		return;
+	SoftwareResource& resource = entry->Resource;
+	if (slice < 0 || slice >= resource.TextureDesc.ArraySize)
+		return;
+
+	Flush();
+
+	for (int y = 0; y < resource.TextureDesc.Height; y++)
+	{
+		const unsigned char* row = (const unsigned char*)data + (size_t)y * rowPitch;
+		for (int x = 0; x < resource.TextureDesc.Width; x++)
+		{
+			float* texel = resource.GetTexel(x, y, slice);
+			for (int c = 0; c < resource.Channels; c++)
+			{
+				switch (resource.TextureDesc.Format)
+				{
+				case RENDER_FORMAT_RGBA8_UNORM:
+					texel[c] = row[x * 4 + c] / 255.0f;
+					break;
+				case RENDER_FORMAT_RGBA16_FLOAT:
+				case RENDER_FORMAT_RG16_FLOAT:
+					texel[c] = HalfToFloat(((const unsigned short*)row)[x * resource.Channels + c]);
+					break;
+				case RENDER_FORMAT_DEPTH24_STENCIL8:
+					texel[c] = (((const unsigned int*)row)[x] & 0xFFFFFF) / 16777215.0f;
+					break;
+				default:
+					texel[c] = ((const float*)row)[x];
+					break;
+				}
+			}
+		}
+	}
+}
+
+void SoftwareRenderContext::SetRenderTargets(const RenderTextureHandle* colors, int colorCount, RenderTextureHandle depth, int depthSlice)
+{
+	Flush();
+
+	SoftwareRenderDevice::Entry* color = colorCount > 0 ? device->Get(colors[0]) : 0;
+	SoftwareRenderDevice::Entry* depthEntry = device->Get(depth);
+	colorTarget = color && color->Resource.IsTexture ? &color->Resource : 0;
+	depthTarget = depthEntry && depthEntry->Resource.IsTexture ? &depthEntry->Resource : 0;
+	this->depthSlice = depthTarget && depthSlice < depthTarget->TextureDesc.ArraySize ? depthSlice : 0;
+
+	// Both have to be the same size
+	if (colorTarget && depthTarget &&
+		(colorTarget->TextureDesc.Width != depthTarget->TextureDesc.Width || colorTarget->TextureDesc.Height != depthTarget->TextureDesc.Height))
+		depthTarget = 0;
+
+	SetTargetSize();
+}
+
+void SoftwareRenderContext::SetTargetSize()
+{
+	SoftwareResource* target = colorTarget ? colorTarget : depthTarget;
+	tilesX = target ? (target->TextureDesc.Width + TileSize - 1) / TileSize : 0;
+	tilesY = target ? (target->TextureDesc.Height + TileSize - 1) / TileSize : 0;
+	if (bins.size() < (size_t)(tilesX * tilesY))
+	{
+		bins.resize(tilesX * tilesY);
+		tileStats.resize(tilesX * tilesY);
+	}
+}
+
+void SoftwareRenderContext::SetViewport(float x, float y, float width, float height)
+{
+	viewport[0] = x;
+	viewport[1] = y;
+	viewport[2] = width;
+	viewport[3] = height;
+}
+
+void SoftwareRenderContext::ClearRenderTarget(RenderTextureHandle texture, const float color[4])
+{
+	SoftwareRenderDevice::Entry* entry = device->Get(texture);
+	if (!entry || !entry->Resource.IsTexture)
+		return;
+
+	Flush();
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	SoftwareResource& resource = entry->Resource;
+	bool unorm = resource.TextureDesc.Format == RENDER_FORMAT_RGBA8_UNORM;
+	float value[4];
+	for (int c = 0; c < 4; c++)
+		value[c] = unorm ? (color[c] < 0 ? 0 : color[c] > 1 ? 1 : color[c]) : color[c];
+
+	for (size_t t = 0; t < resource.Texels.size(); t += resource.Channels)
+		memcpy(&resource.Texels[t], value, sizeof(float) * resource.Channels);
+
+	device->stats.ClearMs += MillisecondsSince(start);
+}
+
+void SoftwareRenderContext::ClearDepth(RenderTextureHandle texture, float depth, int slice)
+{
+	SoftwareRenderDevice::Entry* entry = device->Get(texture);
+	if (!entry || !entry->Resource.IsTexture)
+		return;
+	SoftwareResource& resource = entry->Resource;
+	if (slice < 0 || slice >= resource.TextureDesc.ArraySize)
+		return;
+
+	Flush();
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	size_t sliceTexels = (size_t)resource.TextureDesc.Width * resource.TextureDesc.Height * resource.Channels;
+	std::fill(resource.Texels.begin() + slice * sliceTexels, resource.Texels.begin() + (slice + 1) * sliceTexels, depth);
+
+	device->stats.ClearMs += MillisecondsSince(start);
+}
+
+void SoftwareRenderContext::Draw(unsigned int vertexCount, unsigned int startVertex)
+{
+	Submit(0, vertexCount, startVertex, 0);
+}
+
+void SoftwareRenderContext::DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex)
+{
+	SoftwareRenderDevice::Entry* entry = device->Get(indexBuffer);
+	if (!entry || entry->Resource.IsTexture)
+		return;
+
+	// Indices past the end of the buffer draw nothing
+	unsigned int available = (unsigned int)(entry->Resource.Bytes.size() / sizeof(unsigned int));
+	if (startIndex >= available)
+		return;
+	if (indexCount > available - startIndex)
+		indexCount = available - startIndex;
+	Submit((const unsigned int*)&entry->Resource.Bytes[0], indexCount, startIndex, baseVertex);
+}
+
+// --------------------------------------------------------
+// Shades a draw's vertices and queues its triangles
+// --------------------------------------------------------
+void SoftwareRenderContext::Submit(const unsigned int* indices, unsigned int count, unsigned int start, int baseVertex)
+{
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	SoftwareRenderStats& stats = device->stats;
+	stats.Draws++;
+
+	SoftwareRenderDevice::Entry* pipelineEntry = device->Get(pipeline);
+	SoftwareRenderDevice::Entry* buffer = device->Get(vertexBuffer);
+	if (!pipelineEntry || !buffer || buffer->Resource.IsTexture || !tilesX || count < 3)
+		return;
+
+	// Shaders without ports don't draw
+	const RenderPipelineDesc& pipelineDesc = pipelineEntry->Pipeline;
+	SoftwareRenderDevice::Entry* vertexShader = device->Get(pipelineDesc.VertexShader);
+	SoftwareRenderDevice::Entry* pixelShader = device->Get(pipelineDesc.PixelShader);
+	if (!vertexShader || !vertexShader->Shader || !vertexShader->Shader->Vertex)
+		return;
+	if (pipelineDesc.PixelShader && (!pixelShader || !pixelShader->Shader || !pixelShader->Shader->Pixel))
+		return;
+
+	// What each stage sees: the vertex shader runs now, so
+	// reads constants in place; the pixel shader's are copied
+	SoftwareBindings bindings[2];
+	DrawRecord draw;
+	for (int stage = 0; stage < 2; stage++)
+	{
+		for (int slot = 0; slot < SOFTWARE_MAX_CONSTANT_BUFFERS; slot++)
+		{
+			SoftwareRenderDevice::Entry* entry = device->Get(constants[stage][slot]);
+			bool bound = entry && !entry->Resource.IsTexture;
+			bindings[stage].Constants[slot] = bound ? &entry->Resource.Bytes[0] : zeroConstants;
+
+			if (stage == RENDER_SHADER_PIXEL)
+			{
+				draw.ConstantOffsets[slot] = ~0u;
+				if (bound)
+				{
+					draw.ConstantOffsets[slot] = (unsigned int)constantStore.size();
+					constantStore.insert(constantStore.end(), entry->Resource.Bytes.begin(), entry->Resource.Bytes.end());
+				}
+			}
+		}
+		for (int slot = 0; slot < SOFTWARE_MAX_RESOURCES; slot++)
+		{
+			SoftwareRenderDevice::Entry* entry = device->Get(resources[stage][slot]);
+			bindings[stage].Resources[slot] = entry ? &entry->Resource : 0;
+		}
+		for (int slot = 0; slot < SOFTWARE_MAX_SAMPLERS; slot++)
+		{
+			SoftwareRenderDevice::Entry* entry = device->Get(samplers[stage][slot]);
+			bindings[stage].Samplers[slot] = entry ? &entry->Sampler : 0;
+		}
+	}
+
+	int varyingCount = vertexShader->Shader->VaryingCount;
+	draw.PixelShader = pipelineDesc.PixelShader ? pixelShader->Shader->Pixel : 0;
+	draw.Bindings = bindings[RENDER_SHADER_PIXEL];
+	draw.VaryingCount = varyingCount;
+	draw.DepthTest = pipelineDesc.DepthTest;
+	draw.DepthWrite = pipelineDesc.DepthWrite;
+	draw.DepthFunc = pipelineDesc.DepthFunc;
+	draw.AlphaBlend = pipelineDesc.AlphaBlend;
+	draws.push_back(draw);
+	int drawIndex = (int)draws.size() - 1;
+
+	// The range of vertices the draw uses, shaded as they're
+	// first needed
+	long long first = (long long)start + baseVertex;
+	long long last = first + count - 1;
+	if (indices)
+	{
+		first = last = (long long)indices[start] + baseVertex;
+		for (unsigned int i = start; i < start + count; i++)
+		{
+			long long vertex = (long long)indices[i] + baseVertex;
+			first = vertex < first ? vertex : first;
+			last = vertex > last ? vertex : last;
+		}
+	}
+	if (first < 0)
+		return;
+
+	const std::vector<unsigned char>& vertexBytes = buffer->Resource.Bytes;
+	unsigned int layoutBytes = (pipelineDesc.Layout == RENDER_LAYOUT_POSITION ? 3 : 8) * sizeof(float);
+	int vertexFloats = 4 + varyingCount;
+	size_t rangeCount = (size_t)(last - first + 1);
+	shadedVertices.resize(rangeCount * vertexFloats);
+	shadedValid.assign(rangeCount, 0);
+
+	size_t firstTriangle = triangles.size();
+	for (unsigned int i = 0; i + 2 < count; i += 3)
+	{
+		const float* corners[3];
+		bool valid = true;
+		for (int corner = 0; corner < 3 && valid; corner++)
+		{
+			long long vertex = indices ? (long long)indices[start + i + corner] + baseVertex : first + i + corner;
+			size_t slot = (size_t)(vertex - first);
+			float* shaded = &shadedVertices[slot * vertexFloats];
+			if (!shadedValid[slot])
+			{
+				// Vertices past the end of the buffer draw nothing
+				size_t offset = vertexOffset + (size_t)vertex * vertexStride;
+				if (offset + layoutBytes > vertexBytes.size())
+				{
+					valid = false;
+					break;
+				}
+
+				float input[8];
+				memcpy(input, &vertexBytes[offset], layoutBytes);
+				vertexShader->Shader->Vertex(bindings[RENDER_SHADER_VERTEX], input, shaded, shaded + 4);
+				shadedValid[slot] = 1;
+				stats.Vertices++;
+			}
+			corners[corner] = shaded;
+		}
+
+		stats.Triangles++;
+		if (valid)
+			AddTriangle(corners, 3, varyingCount, pipelineDesc, drawIndex);
+		else
+			stats.TrianglesCulled++;
+	}
+
+	std::chrono::steady_clock::time_point binning = std::chrono::steady_clock::now();
+	stats.VertexMs += std::chrono::duration<double, std::milli>(binning - begin).count();
+
+	// Into every tile their bounds touch
+	for (size_t t = firstTriangle; t < triangles.size(); t++)
+	{
+		const Triangle& triangle = triangles[t];
+		for (int tileY = triangle.MinY / TileSize; tileY <= triangle.MaxY / TileSize; tileY++)
+		{
+			for (int tileX = triangle.MinX / TileSize; tileX <= triangle.MaxX / TileSize; tileX++)
+			{
+				bins[tileY * tilesX + tileX].push_back((unsigned int)t);
+				stats.TileTriangles++;
+			}
+		}
+	}
+	stats.BinMs += MillisecondsSince(binning);
+}
+
+// --------------------------------------------------------
+// Clips a triangle to the near and far planes, and queues
+// what's left as screen space triangles
+// --------------------------------------------------------
+void SoftwareRenderContext::AddTriangle(const float* vertices[], int vertexCount, int varyingCount, const RenderPipelineDesc& pipelineDesc, int draw)
+{
+	SoftwareRenderStats& stats = device->stats;
+	int vertexFloats = 4 + varyingCount;
+
+	float polygons[2][MaxClipVertices][4 + SOFTWARE_MAX_VARYINGS];
+	const float* polygon[MaxClipVertices];
+	int count = vertexCount;
+
+	bool inside = true;
+	for (int v = 0; v < vertexCount; v++)
+	{
+		polygon[v] = vertices[v];
+		inside = inside && vertices[v][2] >= 0 && vertices[v][2] <= vertices[v][3];
+	}
+
+	// Near (z >= 0), then far (z <= w)
+	if (!inside)
+	{
+		for (int plane = 0; plane < 2; plane++)
+		{
+			float (*output)[4 + SOFTWARE_MAX_VARYINGS] = polygons[plane];
+			int outputCount = 0;
+			for (int v = 0; v < count; v++)
+			{
+				const float* a = polygon[v];
+				const float* b = polygon[(v + 1) % count];
+				float distanceA = plane == 0 ? a[2] : a[3] - a[2];
+				float distanceB = plane == 0 ? b[2] : b[3] - b[2];
+
+				if (distanceA >= 0)
+					memcpy(output[outputCount++], a, sizeof(float) * vertexFloats);
+				if ((distanceA >= 0) != (distanceB >= 0))
+				{
+					float t = distanceA / (distanceA - distanceB);
+					for (int f = 0; f < vertexFloats; f++)
+						output[outputCount][f] = a[f] + (b[f] - a[f]) * t;
+					outputCount++;
+				}
+			}
+
+			count = outputCount;
+			if (count < 3)
+			{
+				stats.TrianglesCulled++;
+				return;
+			}
+			for (int v = 0; v < count; v++)
+				polygon[v] = output[v];
+		}
+	}
+
+	// To pixels (snapped), with the varyings divided by w for
+	// perspective correct interpolation
+	float x[MaxClipVertices], y[MaxClipVertices], z[MaxClipVertices], invW[MaxClipVertices];
+	unsigned int varyings[MaxClipVertices];
+	for (int v = 0; v < count; v++)
+	{
+		if (polygon[v][3] <= 0)
+		{
+			stats.TrianglesCulled++;
+			return;
+		}
+		invW[v] = 1.0f / polygon[v][3];
+		x[v] = floorf(((polygon[v][0] * invW[v]) * 0.5f + 0.5f) * viewport[2] * SubpixelSteps + viewport[0] * SubpixelSteps + 0.5f) / SubpixelSteps;
+		y[v] = floorf(((polygon[v][1] * invW[v]) * -0.5f + 0.5f) * viewport[3] * SubpixelSteps + viewport[1] * SubpixelSteps + 0.5f) / SubpixelSteps;
+		z[v] = polygon[v][2] * invW[v];
+
+		varyings[v] = (unsigned int)varyingStore.size();
+		for (int f = 0; f < varyingCount; f++)
+			varyingStore.push_back(polygon[v][4 + f] * invW[v]);
+	}
+
+	// The pixels the viewport and target allow
+	const SoftwareResource* target = colorTarget ? colorTarget : depthTarget;
+	int scissorMinX = viewport[0] > 0 ? (int)viewport[0] : 0;
+	int scissorMinY = viewport[1] > 0 ? (int)viewport[1] : 0;
+	int scissorMaxX = (int)ceilf(viewport[0] + viewport[2]) - 1;
+	int scissorMaxY = (int)ceilf(viewport[1] + viewport[3]) - 1;
+	scissorMaxX = scissorMaxX < target->TextureDesc.Width - 1 ? scissorMaxX : target->TextureDesc.Width - 1;
+	scissorMaxY = scissorMaxY < target->TextureDesc.Height - 1 ? scissorMaxY : target->TextureDesc.Height - 1;
+
+	// A fan over what clipping left
+	for (int v = 1; v + 1 < count; v++)
+	{
+		int corners[3] = { 0, v, v + 1 };
+		Triangle triangle;
+		for (int corner = 0; corner < 3; corner++)
+		{
+			triangle.X[corner] = x[corners[corner]];
+			triangle.Y[corner] = y[corners[corner]];
+			triangle.Z[corner] = z[corners[corner]];
+			triangle.InvW[corner] = invW[corners[corner]];
+			triangle.Varyings[corner] = varyings[corners[corner]];
+		}
+
+		// Clockwise on screen (positive here) is the front
+		float area = (triangle.X[1] - triangle.X[0]) * (triangle.Y[2] - triangle.Y[0]) - (triangle.X[2] - triangle.X[0]) * (triangle.Y[1] - triangle.Y[0]);
+		if (area == 0 ||
+			(pipelineDesc.Cull == RENDER_CULL_BACK && area < 0) ||
+			(pipelineDesc.Cull == RENDER_CULL_FRONT && area > 0))
+		{
+			stats.TrianglesCulled++;
+			continue;
+		}
+
+		// Wound so the edge functions are positive inside
+		if (area < 0)
+		{
+			std::swap(triangle.X[1], triangle.X[2]);
+			std::swap(triangle.Y[1], triangle.Y[2]);
+			std::swap(triangle.Z[1], triangle.Z[2]);
+			std::swap(triangle.InvW[1], triangle.InvW[2]);
+			std::swap(triangle.Varyings[1], triangle.Varyings[2]);
+			area = -area;
+		}
+		triangle.Area = area;
+
+		// Depth bias, as D3D does it for float depth
+		if (pipelineDesc.DepthBias || pipelineDesc.SlopeScaledDepthBias)
+		{
+			float dzdx = ((triangle.Z[1] - triangle.Z[0]) * (triangle.Y[2] - triangle.Y[0]) - (triangle.Z[2] - triangle.Z[0]) * (triangle.Y[1] - triangle.Y[0])) / area;
+			float dzdy = ((triangle.Z[2] - triangle.Z[0]) * (triangle.X[1] - triangle.X[0]) - (triangle.Z[1] - triangle.Z[0]) * (triangle.X[2] - triangle.X[0])) / area;
+			float maxSlope = fabsf(dzdx) > fabsf(dzdy) ? fabsf(dzdx) : fabsf(dzdy);
+
+			float maxZ = std::max(fabsf(triangle.Z[0]), std::max(fabsf(triangle.Z[1]), fabsf(triangle.Z[2])));
+			int exponent = 0;
+			frexpf(maxZ, &exponent);
+			float unit = maxZ > 0 ? ldexpf(1.0f, exponent - 1 - 23) : 0.0f;
+
+			float bias = pipelineDesc.DepthBias * unit + pipelineDesc.SlopeScaledDepthBias * maxSlope;
+			for (int corner = 0; corner < 3; corner++)
+				triangle.Z[corner] += bias;
+		}
+
+		// Pixels whose centres may be inside
+		float minX = std::min(triangle.X[0], std::min(triangle.X[1], triangle.X[2]));
+		float maxX = std::max(triangle.X[0], std::max(triangle.X[1], triangle.X[2]));
+		float minY = std::min(triangle.Y[0], std::min(triangle.Y[1], triangle.Y[2]));
+		float maxY = std::max(triangle.Y[0], std::max(triangle.Y[1], triangle.Y[2]));
+		triangle.MinX = std::max(scissorMinX, (int)ceilf(minX - 0.5f));
+		triangle.MaxX = std::min(scissorMaxX, (int)floorf(maxX - 0.5f));
+		triangle.MinY = std::max(scissorMinY, (int)ceilf(minY - 0.5f));
+		triangle.MaxY = std::min(scissorMaxY, (int)floorf(maxY - 0.5f));
+		if (triangle.MinX > triangle.MaxX || triangle.MinY > triangle.MaxY)
+		{
+			stats.TrianglesCulled++;
+			continue;
+		}
+
+		triangle.Draw = draw;
+		triangles.push_back(triangle);
+	}
+}
+
+// --------------------------------------------------------
+// Draws the queue, a job per tile
+// --------------------------------------------------------
+void SoftwareRenderContext::Flush()
+{
+	if (triangles.empty())
+	{
+		draws.clear();
+		varyingStore.clear();
+		constantStore.clear();
+		return;
+	}
+
+	// The pixel shaders' constants, now their copies are in place
+	for (size_t d = 0; d < draws.size(); d++)
+	{
+		for (int slot = 0; slot < SOFTWARE_MAX_CONSTANT_BUFFERS; slot++)
+		{
+			unsigned int offset = draws[d].ConstantOffsets[slot];
+			draws[d].Bindings.Constants[slot] = offset == ~0u ? zeroConstants : &constantStore[offset];
+		}
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	int tileCount = tilesX * tilesY;
+	device->parallelFor(tileCount, [this](int begin, int end)
+	{
+		for (int tile = begin; tile < end; tile++)
+		{
+			TileStats& tileStat = tileStats[tile];
+			memset(&tileStat, 0, sizeof(tileStat));
+			if (bins[tile].empty())
+				continue;
+
+			std::chrono::steady_clock::time_point tileStart = std::chrono::steady_clock::now();
+			RasterizeTile(tile);
+			tileStat.Ms = MillisecondsSince(tileStart);
+		}
+	});
+
+	SoftwareRenderStats& stats = device->stats;
+	stats.RasterMs += MillisecondsSince(start);
+	stats.Flushes++;
+	for (int tile = 0; tile < tileCount; tile++)
+	{
+		stats.TileMs += tileStats[tile].Ms;
+		stats.MaxTileMs = tileStats[tile].Ms > stats.MaxTileMs ? tileStats[tile].Ms : stats.MaxTileMs;
+		stats.PixelsCovered += tileStats[tile].Covered;
+		stats.PixelsShaded += tileStats[tile].Shaded;
+		bins[tile].clear();
+	}
+
+	draws.clear();
+	triangles.clear();
+	varyingStore.clear();
+	constantStore.clear();
+}
+
+void SoftwareRenderContext::RasterizeTile(int tile)
+{
+	TileStats& tileStat = tileStats[tile];
+	int tileMinX = (tile % tilesX) * TileSize;
+	int tileMinY = (tile / tilesX) * TileSize;
+
+	const std::vector<unsigned int>& bin = bins[tile];
+	for (size_t b = 0; b < bin.size(); b++)
+	{
+		const Triangle& triangle = triangles[bin[b]];
+		const DrawRecord& draw = draws[triangle.Draw];
+
+		int minX = std::max(triangle.MinX, tileMinX);
+		int maxX = std::min(triangle.MaxX, tileMinX + TileSize - 1);
+		int minY = std::max(triangle.MinY, tileMinY);
+		int maxY = std::min(triangle.MaxY, tileMinY + TileSize - 1);
+
+		// Edge e is opposite corner e.  Each is measured from the
+		// same end whichever triangle it's in, so triangles
+		// sharing an edge agree exactly on which pixels it splits
+		float edgeA[3], edgeB[3], edgeX[3], edgeY[3];
+		bool topLeft[3];
+		for (int e = 0; e < 3; e++)
+		{
+			int from = (e + 1) % 3;
+			int to = (e + 2) % 3;
+			edgeA[e] = triangle.Y[from] - triangle.Y[to];
+			edgeB[e] = triangle.X[to] - triangle.X[from];
+			bool fromFirst = triangle.X[from] < triangle.X[to] || (triangle.X[from] == triangle.X[to] && triangle.Y[from] < triangle.Y[to]);
+			edgeX[e] = fromFirst ? triangle.X[from] : triangle.X[to];
+			edgeY[e] = fromFirst ? triangle.Y[from] : triangle.Y[to];
+
+			// Pixel centres exactly on the edge belong to the
+			// triangle on its right / below
+			topLeft[e] = edgeA[e] > 0 || (edgeA[e] == 0 && edgeB[e] > 0);
+		}
+		float invArea = 1.0f / triangle.Area;
+
+		const float* varyings[3] = { &varyingStore[triangle.Varyings[0]], &varyingStore[triangle.Varyings[1]], &varyingStore[triangle.Varyings[2]] };
+		float interpolated[SOFTWARE_MAX_VARYINGS];
+
+		for (int y = minY; y <= maxY; y++)
+		{
+			float pixelY = y + 0.5f;
+			for (int x = minX; x <= maxX; x += 4)
+			{
+				// Coverage of four pixels
+				float edges[3][4];
+				int mask;
+#ifdef SOFTWARE_RENDER_SSE
+				__m128 pixelX = _mm_add_ps(_mm_set1_ps((float)x), _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f));
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (int e = 0; e < 3; e++)
+				{
+					__m128 value = _mm_add_ps(
+						_mm_mul_ps(_mm_set1_ps(edgeA[e]), _mm_sub_ps(pixelX, _mm_set1_ps(edgeX[e]))),
+						_mm_set1_ps(edgeB[e] * (pixelY - edgeY[e])));
+					_mm_storeu_ps(edges[e], value);
+					__m128 passed = topLeft[e] ? _mm_cmpge_ps(value, _mm_setzero_ps()) : _mm_cmpgt_ps(value, _mm_setzero_ps());
+					inside = _mm_and_ps(inside, passed);
+				}
+				mask = _mm_movemask_ps(inside);
+#else
+				mask = 0;
+				for (int p = 0; p < 4; p++)
+				{
+					bool inside = true;
+					for (int e = 0; e < 3; e++)
+					{
+						edges[e][p] = edgeA[e] * ((x + p + 0.5f) - edgeX[e]) + edgeB[e] * (pixelY - edgeY[e]);
+						inside = inside && (topLeft[e] ? edges[e][p] >= 0 : edges[e][p] > 0);
+					}
+					mask |= inside ? 1 << p : 0;
+				}
+#endif
+				// Not past the triangle's bounds
+				if (maxX - x < 3)
+					mask &= (1 << (maxX - x + 1)) - 1;
+				if (!mask)
+					continue;
+
+				for (int p = 0; p < 4; p++)
+				{
+					if (!(mask & (1 << p)))
+						continue;
+					tileStat.Covered++;
+
+					float b0 = edges[0][p] * invArea;
+					float b1 = edges[1][p] * invArea;
+					float b2 = edges[2][p] * invArea;
+					float depth = triangle.Z[0] * b0 + triangle.Z[1] * b1 + triangle.Z[2] * b2;
+
+					float* storedDepth = depthTarget ? depthTarget->GetTexel(x + p, y, depthSlice) : 0;
+					if (storedDepth && draw.DepthTest)
+					{
+						bool passed;
+						switch (draw.DepthFunc)
+						{
+						case RENDER_COMPARE_NEVER:		passed = false; break;
+						case RENDER_COMPARE_LESS:		passed = depth < *storedDepth; break;
+						case RENDER_COMPARE_LESS_EQUAL:	passed = depth <= *storedDepth; break;
+						default:						passed = true; break;
+						}
+						if (!passed)
+							continue;
+					}
+
+					if (draw.PixelShader && colorTarget)
+					{
+						float oneOverW = triangle.InvW[0] * b0 + triangle.InvW[1] * b1 + triangle.InvW[2] * b2;
+						float w = 1.0f / oneOverW;
+						for (int f = 0; f < draw.VaryingCount; f++)
+							interpolated[f] = (varyings[0][f] * b0 + varyings[1][f] * b1 + varyings[2][f] * b2) * w;
+
+						float position[4] = { x + p + 0.5f, pixelY, depth, w };
+						float color[4];
+						draw.PixelShader(draw.Bindings, position, interpolated, color);
+
+						float* texel = colorTarget->GetTexel(x + p, y, 0);
+						if (draw.AlphaBlend)
+						{
+							for (int c = 0; c < 3; c++)
+								color[c] = color[c] * color[3] + texel[c] * (1 - color[3]);
+						}
+						if (colorTarget->TextureDesc.Format == RENDER_FORMAT_RGBA8_UNORM)
+						{
+							for (int c = 0; c < 4; c++)
+								color[c] = color[c] < 0 ? 0 : color[c] > 1 ? 1 : color[c];
+						}
+						memcpy(texel, color, sizeof(float) * colorTarget->Channels);
+					}
+
+					if (storedDepth && draw.DepthTest && draw.DepthWrite)
+						*storedDepth = depth;
+					tileStat.Shaded++;
+				}
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------
+// Device
+// --------------------------------------------------------
+SoftwareRenderDevice::SoftwareRenderDevice()
+{
+	nextHandle = 1;
+	memset(&stats, 0, sizeof(stats));
+	immediate = new SoftwareRenderContext(this);
+
+	// By default, split the work over a thread per core
+	parallelFor = [](int count, const std::function<void(int begin, int end)>& work)
+	{
+		int threadCount = std::max(1, std::min((int)std::thread::hardware_concurrency(), count));
+		std::vector<std::thread> threads;
+		for (int t = 1; t < threadCount; t++)
+			threads.push_back(std::thread(work, count * t / threadCount, count * (t + 1) / threadCount));
+		work(0, count / threadCount);
+		for (size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+	};
+}
+
+SoftwareRenderDevice::~SoftwareRenderDevice()
+{
+	delete immediate;
+	for (std::map<unsigned int, Entry*>::iterator entry = entries.begin(); entry != entries.end(); ++entry)
+		delete entry->second;
+}
+
+void SoftwareRenderDevice::ResetStats()
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+unsigned int SoftwareRenderDevice::Add(Entry* entry)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	unsigned int handle = nextHandle++;
+	entries[handle] = entry;
+	return handle;
+}
+
+SoftwareRenderDevice::Entry* SoftwareRenderDevice::Get(unsigned int handle)
+{
+	if (!handle)
+		return 0;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	std::map<unsigned int, Entry*>::iterator found = entries.find(handle);
+	return found == entries.end() ? 0 : found->second;
+}
+
+void SoftwareRenderDevice::Release(unsigned int handle)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::map<unsigned int, Entry*>::iterator found = entries.find(handle);
+	if (found == entries.end())
+		return;
+	delete found->second;
+	entries.erase(found);
+}
+
+const SoftwareResource* SoftwareRenderDevice::GetResource(unsigned int handle)
+{
+	Entry* entry = Get(handle);
+	return entry ? &entry->Resource : 0;
+}
+
+RenderBufferHandle SoftwareRenderDevice::CreateBuffer(const RenderBufferDesc& desc, const void* initialData)
+{
+	if (!desc.ByteWidth)
+		return 0;
+
+	Entry* entry = new Entry();
+	entry->Resource.IsTexture = false;
+	entry->Resource.BufferDesc = desc;
+	entry->Resource.Bytes.resize(desc.Type == RENDER_BUFFER_CONSTANT && desc.ByteWidth < MinConstantBytes ? MinConstantBytes : desc.ByteWidth);
+	if (initialData)
+		memcpy(&entry->Resource.Bytes[0], initialData, desc.ByteWidth);
+	return Add(entry);
+}
+
+RenderTextureHandle SoftwareRenderDevice::CreateTexture(const RenderTextureDesc& desc)
+{
+	if (desc.Width <= 0 || desc.Height <= 0)
+		return 0;
+
+	Entry* entry = new Entry();
+	SoftwareResource& resource = entry->Resource;
+	resource.IsTexture = true;
+	resource.TextureDesc = desc;
+	resource.TextureDesc.ArraySize = desc.ArraySize > 0 ? desc.ArraySize : 1;
+	resource.Channels = GetChannels(desc.Format);
+	resource.Texels.assign((size_t)desc.Width * desc.Height * resource.TextureDesc.ArraySize * resource.Channels, 0.0f);
+	return Add(entry);
+}
+
+RenderShaderHandle SoftwareRenderDevice::CreateShader(RenderShaderStage stage, const char* name, const void* /*bytecode*/, size_t /*size*/)
+{
+	// Still a handle without a port, so creation goes on as
+	// usual - it just won't draw
+	Entry* entry = new Entry();
+	const SoftwareShader* shader = FindSoftwareShader(name);
+	entry->Shader = shader && shader->Stage == stage ? shader : 0;
+
+#if defined(DEBUG) || defined(_DEBUG)
+	if (!entry->Shader)
+		printf("No software port of shader %s\n", name ? name : "(unnamed)");
+#endif
+	return Add(entry);
+}
+
+RenderPipelineHandle SoftwareRenderDevice::CreatePipeline(const RenderPipelineDesc& desc)
+{
+	Entry* entry = new Entry();
+	entry->Pipeline = desc;
+	return Add(entry);
+}
+
+RenderSamplerHandle SoftwareRenderDevice::CreateSampler(const RenderSamplerDesc& desc)
+{
+	Entry* entry = new Entry();
+	entry->Sampler = desc;
+	return Add(entry);
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "RenderDevice.h"
+#include "SoftwareShaders.h"
+
+// --------------------------------------------------------
+// Where the software rasterizer's time went, since the last
+// ResetStats().  Raster is wall time for the tile jobs; Tile
+// adds up each job's own time, so Tile / Raster is how well
+// the tiles spread over the threads.
+// --------------------------------------------------------
+struct SoftwareRenderStats
+{
+	double VertexMs;		// Vertex shading, clipping and triangle setup
+	double BinMs;			// Sorting triangles into tiles
+	double RasterMs;		// Rasterizing, depth testing and pixel shading
+	double TileMs;
+	double MaxTileMs;		// The slowest tile job
+	double ClearMs;
+
+	unsigned long long Draws;
+	unsigned long long Vertices;		// Shaded
+	unsigned long long Triangles;		// Submitted
+	unsigned long long TrianglesCulled;	// Back faces, clipped away, no area
+	unsigned long long TileTriangles;	// Triangle / tile pairs binned
+	unsigned long long PixelsCovered;
+	unsigned long long PixelsShaded;	// Passed the depth test
+	unsigned int Flushes;
+};
+
+class SoftwareRenderDevice;
+
+// --------------------------------------------------------
+// Rasterizes on the CPU.  Draws are shaded and set up as
+// they're issued, and their triangles binned into 64x64
+// pixel tiles.  The tiles are drawn when the queue is
+// flushed - on a change of render targets, a clear, an upload
+// or a Flush() - one job per tile, each pixel's triangles in
+// the order they were drawn, so the result doesn't depend on
+// how many threads ran it.
+//
+// Coverage is tested four pixels at a time with SSE (scalar
+// elsewhere), against edge functions with the top-left rule.
+// Only the first color target is drawn to.
+// --------------------------------------------------------
+class SoftwareRenderContext : public RenderContext
+{
+public:
+	SoftwareRenderContext(SoftwareRenderDevice* device);
+
+	void SetPipeline(RenderPipelineHandle pipeline);
+	void SetVertexBuffer(int slot, RenderBufferHandle buffer, unsigned int stride, unsigned int offset);
+	void SetIndexBuffer(RenderBufferHandle buffer);
+	void SetConstantBuffer(RenderShaderStage stage, int slot, RenderBufferHandle buffer);
+	void SetTexture(RenderShaderStage stage, int slot, RenderTextureHandle texture);
+	void SetSampler(RenderShaderStage stage, int slot, RenderSamplerHandle sampler);
+	void UpdateBuffer(RenderBufferHandle buffer, const void* data, unsigned int size);
+	void UpdateTexture(RenderTextureHandle texture, int slice, const void* data, unsigned int rowPitch);
+	void SetRenderTargets(const RenderTextureHandle* colors, int colorCount, RenderTextureHandle depth, int depthSlice = 0);
+	void SetViewport(float x, float y, float width, float height);
+	void ClearRenderTarget(RenderTextureHandle texture, const float color[4]);
+	void ClearDepth(RenderTextureHandle texture, float depth, int slice = 0);
+	void Draw(unsigned int vertexCount, unsigned int startVertex);
+	void DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex);
+
+	// Draws everything queued
+	void Flush();
+
+private:
+	// A draw's state, as the tile jobs need it
+	struct DrawRecord
+	{
+		SoftwarePixelShader PixelShader;
+		SoftwareBindings Bindings;
+		unsigned int ConstantOffsets[SOFTWARE_MAX_CONSTANT_BUFFERS];	// Into constantStore (~0 = not bound)
+		int VaryingCount;
+		bool DepthTest;
+		bool DepthWrite;
+		RenderCompare DepthFunc;
+		bool AlphaBlend;
+	};
+
+	// In pixels, wound so the edge functions are positive inside
+	struct Triangle
+	{
+		float X[3];
+		float Y[3];
+		float Z[3];
+		float InvW[3];
+		unsigned int Varyings[3];	// Into varyingStore, already divided by w
+		float Area;
+		int MinX, MinY, MaxX, MaxY;	// Pixels it may cover, inside the viewport
+		int Draw;
+	};
+
+	struct TileStats
+	{
+		double Ms;
+		unsigned long long Covered;
+		unsigned long long Shaded;
+	};
+
+	static const int TileSize = 64;
+
+	SoftwareRenderDevice* device;
+
+	// Bound state (handles are looked up when drawing)
+	RenderPipelineHandle pipeline;
+	RenderBufferHandle vertexBuffer;
+	unsigned int vertexStride;
+	unsigned int vertexOffset;
+	RenderBufferHandle indexBuffer;
+	RenderBufferHandle constants[2][SOFTWARE_MAX_CONSTANT_BUFFERS];
+	unsigned int resources[2][SOFTWARE_MAX_RESOURCES];
+	RenderSamplerHandle samplers[2][SOFTWARE_MAX_SAMPLERS];
+	SoftwareResource* colorTarget;
+	SoftwareResource* depthTarget;
+	int depthSlice;
+	float viewport[4];
+
+	// The queue
+	std::vector<DrawRecord> draws;
+	std::vector<Triangle> triangles;
+	std::vector<float> varyingStore;
+	std::vector<unsigned char> constantStore;
+	std::vector<std::vector<unsigned int>> bins;
+	int tilesX;
+	int tilesY;
+
+	// Scratch for shading a draw's vertices
+	std::vector<float> shadedVertices;
+	std::vector<unsigned char> shadedValid;
+
+	std::vector<TileStats> tileStats;
+
+	void SetTargetSize();
+	void Submit(const unsigned int* indices, unsigned int count, unsigned int start, int baseVertex);
+	void AddTriangle(const float* vertices[], int vertexCount, int varyingCount, const RenderPipelineDesc& pipelineDesc, int draw);
+	void RasterizeTile(int tile);
+};
+
+// --------------------------------------------------------
+// A RenderDevice that draws on the CPU (see
+// SoftwareRenderContext), for headless regression images
+// and as a fallback with no GPU.  Shaders aren't compiled:
+// they're mapped by name to C++ ports (SoftwareShaders), and
+// ones without a port don't draw.
+//
+// There's one context, the immediate one.  The tile jobs go
+// through a parallel-for, by default a thread per core.
+// --------------------------------------------------------
+class SoftwareRenderDevice : public RenderDevice
+{
+public:
+	// Runs work(begin, end) over [0, count), in pieces
+	typedef std::function<void(int count, const std::function<void(int begin, int end)>& work)> ParallelFor;
+
+	SoftwareRenderDevice();
+	~SoftwareRenderDevice();
+
+	// Replaces the default (a thread per core, per call)
+	void SetParallelFor(const ParallelFor& parallelFor) { this->parallelFor = parallelFor; }
+
+	RenderBufferHandle CreateBuffer(const RenderBufferDesc& desc, const void* initialData);
+	RenderTextureHandle CreateTexture(const RenderTextureDesc& desc);
+	RenderShaderHandle CreateShader(RenderShaderStage stage, const char* name, const void* bytecode, size_t size);
+	RenderPipelineHandle CreatePipeline(const RenderPipelineDesc& desc);
+	RenderSamplerHandle CreateSampler(const RenderSamplerDesc& desc);
+
+	void ReleaseBuffer(RenderBufferHandle buffer) { Release(buffer); }
+	void ReleaseTexture(RenderTextureHandle texture) { Release(texture); }
+	void ReleaseShader(RenderShaderHandle shader) { Release(shader); }
+	void ReleasePipeline(RenderPipelineHandle pipeline) { Release(pipeline); }
+	void ReleaseSampler(RenderSamplerHandle sampler) { Release(sampler); }
+
+	RenderContext* GetImmediateContext() { return immediate; }
+	SoftwareRenderContext* GetSoftwareImmediateContext() { return immediate; }
+
+	// A texture's or buffer's contents (flush first)
+	const SoftwareResource* GetResource(unsigned int handle);
+
+	const SoftwareRenderStats& GetStats() { return stats; }
+	void ResetStats();
+
+private:
+	friend class SoftwareRenderContext;
+
+	struct Entry
+	{
+		SoftwareResource Resource;
+		const SoftwareShader* Shader;
+		RenderPipelineDesc Pipeline;
+		RenderSamplerDesc Sampler;
+	};
+
+	std::mutex mutex;
+	std::map<unsigned int, Entry*> entries;
+	unsigned int nextHandle;
+
+	SoftwareRenderContext* immediate;
+	ParallelFor parallelFor;
+	SoftwareRenderStats stats;
+
+	unsigned int Add(Entry* entry);
+	Entry* Get(unsigned int handle);
+	void Release(unsigned int handle);
+};
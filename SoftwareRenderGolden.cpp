@@ -0,0 +1,185 @@
+// --------------------------------------------------------
+// Offline tool: renders the demo scene with the software
+// rasterizer (SoftwareRenderDevice) and checks it against
+// golden images, with no GPU (excluded from the game build).
+//
+// Build and run from the project directory, e.g.
+//   g++ -O2 -pthread SoftwareRenderGolden.cpp DemoScene.cpp JobSystem.cpp SoftwareRenderDevice.cpp SoftwareShaders.cpp ShadowCascades.cpp LightClusterGrid.cpp Benchmark.cpp Profiler.cpp AllocationCounter.cpp -o SoftwareRenderGolden
+//   ./SoftwareRenderGolden
+//
+// Options:
+//   --update        Write the golden images instead of checking them
+//   --golden DIR    Where they are (default Golden)
+//   --size WxH      Image size (default 320x180)
+//   --threads N     Job system threads (default: one per core)
+//   --runs N        Renders of each frame, for timing (default 1)
+//
+// The scene is DemoScene (Game's, without D3D), from where
+// the camera starts, at a few fixed times.
+//
+// A frame fails if more than 0.1% of its pixels are off by
+// more than 2/255; it's written next to the golden image as
+// <name>_actual.ppm.  Every render prints its per-stage times.
+// --------------------------------------------------------
+
+#include "DemoScene.h"
+#include "JobSystem.h"
+#include "SoftwareRenderDevice.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------
+// Images
+// --------------------------------------------------------
+static bool WritePpm(const char* path, const std::vector<unsigned char>& rgb, int width, int height)
+{
+	FILE* file = fopen(path, "wb");
+	if (!file)
+		return false;
+	fprintf(file, "P6\n%d %d\n255\n", width, height);
+	fwrite(&rgb[0], 1, rgb.size(), file);
+	fclose(file);
+	return true;
+}
+
+static bool ReadPpm(const char* path, std::vector<unsigned char>& rgb, int& width, int& height)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file)
+		return false;
+
+	int maximum = 0;
+	bool read = fscanf(file, "P6 %d %d %d", &width, &height, &maximum) == 3 && maximum == 255 && fgetc(file) != EOF;
+	if (read)
+	{
+		rgb.resize((size_t)width * height * 3);
+		read = fread(&rgb[0], 1, rgb.size(), file) == rgb.size();
+	}
+	fclose(file);
+	return read;
+}
+
+static void PrintStats(const char* name, const SoftwareRenderStats& stats)
+{
+	double total = stats.VertexMs + stats.BinMs + stats.RasterMs + stats.ClearMs;
+	printf("%-10s %8.2f ms  vertex %6.2f  bin %6.2f  raster %7.2f (tiles %7.2f, slowest %5.2f)  clear %5.2f  |  %llu tris (%llu culled), %llu tile tris, %.2f Mpix covered, %.2f Mpix passed depth (%.1f Mpix/s)\n",
+		name, total, stats.VertexMs, stats.BinMs, stats.RasterMs, stats.TileMs, stats.MaxTileMs, stats.ClearMs,
+		stats.Triangles, stats.TrianglesCulled, stats.TileTriangles,
+		stats.PixelsCovered / 1e6, stats.PixelsShaded / 1e6, stats.RasterMs > 0 ? stats.PixelsShaded / (stats.RasterMs * 1e3) : 0.0);
+}
+
+int main(int argc, char* argv[])
+{
+	bool update = false;
+	std::string goldenDirectory = "Golden";
+	int width = 320;
+	int height = 180;
+	int threads = 0;
+	int runs = 1;
+	for (int a = 1; a < argc; a++)
+	{
+		if (strcmp(argv[a], "--update") == 0)
+			update = true;
+		else if (strcmp(argv[a], "--golden") == 0 && a + 1 < argc)
+			goldenDirectory = argv[++a];
+		else if (strcmp(argv[a], "--size") == 0 && a + 1 < argc)
+			sscanf(argv[++a], "%dx%d", &width, &height);
+		else if (strcmp(argv[a], "--threads") == 0 && a + 1 < argc)
+			threads = atoi(argv[++a]);
+		else if (strcmp(argv[a], "--runs") == 0 && a + 1 < argc)
+			runs = std::max(1, atoi(argv[++a]));
+		else
+		{
+			printf("Unknown option %s\n", argv[a]);
+			return 2;
+		}
+	}
+	if (width <= 0 || height <= 0)
+	{
+		printf("Bad --size\n");
+		return 2;
+	}
+
+	JobSystem jobs(threads > 0 ? threads - 1 : -1);
+	SoftwareRenderDevice device;
+	device.SetParallelFor(jobs.GetParallelFor());
+
+	DemoScene scene;
+	scene.SetParallelFor(jobs.GetParallelFor());
+	if (!scene.Create(&device, width, height))
+		return 2;
+	printf("%dx%d, %d thread(s)\n", width, height, jobs.GetThreadCount());
+
+	const float times[] = { 0.0f, 1.0f, 2.5f };
+	int failures = 0;
+	for (size_t f = 0; f < sizeof(times) / sizeof(times[0]); f++)
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "scene_%dx%d_t%.1f", width, height, times[f]);
+
+		for (int run = 0; run < runs; run++)
+		{
+			device.ResetStats();
+			scene.Render(times[f]);
+			device.GetSoftwareImmediateContext()->Flush();
+			PrintStats(name, device.GetStats());
+		}
+
+		// To 8 bit RGB
+		const SoftwareResource* color = device.GetResource(scene.GetColorTarget());
+		std::vector<unsigned char> actual((size_t)width * height * 3);
+		for (int p = 0; p < width * height; p++)
+		{
+			for (int c = 0; c < 3; c++)
+				actual[p * 3 + c] = (unsigned char)(color->Texels[p * 4 + c] * 255.0f + 0.5f);
+		}
+
+		std::string goldenPath = goldenDirectory + "/" + name + ".ppm";
+		if (update)
+		{
+			if (!WritePpm(goldenPath.c_str(), actual, width, height))
+			{
+				printf("Can't write %s\n", goldenPath.c_str());
+				failures++;
+			}
+			continue;
+		}
+
+		std::vector<unsigned char> golden;
+		int goldenWidth, goldenHeight;
+		if (!ReadPpm(goldenPath.c_str(), golden, goldenWidth, goldenHeight) || goldenWidth != width || goldenHeight != height)
+		{
+			printf("  no golden image %s (make them with --update)\n", goldenPath.c_str());
+			failures++;
+			continue;
+		}
+
+		int different = 0;
+		int largest = 0;
+		for (int p = 0; p < width * height; p++)
+		{
+			int difference = 0;
+			for (int c = 0; c < 3; c++)
+				difference = std::max(difference, abs((int)actual[p * 3 + c] - (int)golden[p * 3 + c]));
+			different += difference > 2 ? 1 : 0;
+			largest = std::max(largest, difference);
+		}
+
+		bool passed = different <= width * height / 1000;
+		printf("  %s: %d pixels differ (largest by %d)\n", passed ? "ok" : "FAILED", different, largest);
+		if (!passed)
+		{
+			std::string actualPath = goldenDirectory + "/" + name + "_actual.ppm";
+			WritePpm(actualPath.c_str(), actual, width, height);
+			failures++;
+		}
+	}
+
+	return failures ? 1 : 0;
+}
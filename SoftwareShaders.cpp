@@ -0,0 +1,450 @@
+#include "SoftwareShaders.h"
+
+#include <math.h>
+#include <string.h>
+
+// What unbound samplers read with
+static const RenderSamplerDesc defaultSampler = { RENDER_FILTER_LINEAR, RENDER_ADDRESS_CLAMP, { 0, 0, 0, 0 }, 1 };
+
+// --------------------------------------------------------
+// Texel fetches, with the sampler's addressing
+// --------------------------------------------------------
+static bool Address(RenderAddress address, int size, int& coordinate)
+{
+	if (coordinate >= 0 && coordinate < size)
+		return true;
+
+	switch (address)
+	{
+	case RENDER_ADDRESS_WRAP:
+		coordinate %= size;
+		if (coordinate < 0)
+			coordinate += size;
+		return true;
+	case RENDER_ADDRESS_CLAMP:
+		coordinate = coordinate < 0 ? 0 : size - 1;
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Missing channels read as (0, 0, 0, 1), as in D3D
+static void Fetch(const SoftwareResource* texture, const RenderSamplerDesc* sampler, int x, int y, int slice, float result[4])
+{
+	if (!Address(sampler->Address, texture->TextureDesc.Width, x) || !Address(sampler->Address, texture->TextureDesc.Height, y))
+	{
+		memcpy(result, sampler->BorderColor, sizeof(float) * 4);
+		return;
+	}
+
+	const float* texel = texture->GetTexel(x, y, slice);
+	result[0] = texel[0];
+	result[1] = texture->Channels > 1 ? texel[1] : 0.0f;
+	result[2] = texture->Channels > 2 ? texel[2] : 0.0f;
+	result[3] = texture->Channels > 3 ? texel[3] : 1.0f;
+}
+
+void SampleTexture2D(const SoftwareResource* texture, const RenderSamplerDesc* sampler, float u, float v, int slice, float result[4])
+{
+	if (!texture || !texture->IsTexture || texture->Texels.empty())
+	{
+		memset(result, 0, sizeof(float) * 4);
+		return;
+	}
+	if (!sampler)
+		sampler = &defaultSampler;
+
+	int width = texture->TextureDesc.Width;
+	int height = texture->TextureDesc.Height;
+	if (sampler->Filter == RENDER_FILTER_POINT)
+	{
+		Fetch(texture, sampler, (int)floorf(u * width), (int)floorf(v * height), slice, result);
+		return;
+	}
+
+	// Bilinear (anisotropic filtering falls back to this too)
+	float x = u * width - 0.5f;
+	float y = v * height - 0.5f;
+	float x0 = floorf(x);
+	float y0 = floorf(y);
+	float fx = x - x0;
+	float fy = y - y0;
+
+	float corners[4][4];
+	Fetch(texture, sampler, (int)x0, (int)y0, slice, corners[0]);
+	Fetch(texture, sampler, (int)x0 + 1, (int)y0, slice, corners[1]);
+	Fetch(texture, sampler, (int)x0, (int)y0 + 1, slice, corners[2]);
+	Fetch(texture, sampler, (int)x0 + 1, (int)y0 + 1, slice, corners[3]);
+	for (int c = 0; c < 4; c++)
+	{
+		float top = corners[0][c] + (corners[1][c] - corners[0][c]) * fx;
+		float bottom = corners[2][c] + (corners[3][c] - corners[2][c]) * fx;
+		result[c] = top + (bottom - top) * fy;
+	}
+}
+
+void SampleTextureCube(const SoftwareResource* texture, const RenderSamplerDesc* sampler, const float direction[3], float result[4])
+{
+	// The face of the largest axis, with D3D's orientations
+	float x = direction[0], y = direction[1], z = direction[2];
+	float ax = fabsf(x), ay = fabsf(y), az = fabsf(z);
+	int face;
+	float s, t, major;
+	if (ax >= ay && ax >= az)
+	{
+		face = x >= 0 ? 0 : 1;
+		s = x >= 0 ? -z : z;
+		t = -y;
+		major = ax;
+	}
+	else if (ay >= az)
+	{
+		face = y >= 0 ? 2 : 3;
+		s = x;
+		t = y >= 0 ? z : -z;
+		major = ay;
+	}
+	else
+	{
+		face = z >= 0 ? 4 : 5;
+		s = z >= 0 ? x : -x;
+		t = -y;
+		major = az;
+	}
+
+	if (major <= 0)
+	{
+		memset(result, 0, sizeof(float) * 4);
+		return;
+	}
+
+	// Each face on its own (no filtering across the seams)
+	RenderSamplerDesc faceSampler = sampler ? *sampler : defaultSampler;
+	faceSampler.Address = RENDER_ADDRESS_CLAMP;
+	SampleTexture2D(texture, &faceSampler, (s / major + 1) * 0.5f, (t / major + 1) * 0.5f, face, result);
+}
+
+float SampleTextureCompare(const SoftwareResource* texture, const RenderSamplerDesc* sampler, float u, float v, int slice, float reference)
+{
+	if (!texture || !texture->IsTexture || texture->Texels.empty())
+		return 0.0f;
+	if (!sampler)
+		sampler = &defaultSampler;
+
+	float x = u * texture->TextureDesc.Width - 0.5f;
+	float y = v * texture->TextureDesc.Height - 0.5f;
+	float x0 = floorf(x);
+	float y0 = floorf(y);
+	float fx = x - x0;
+	float fy = y - y0;
+
+	// Compare, then filter the results
+	float passed[4];
+	for (int corner = 0; corner < 4; corner++)
+	{
+		float depth[4];
+		Fetch(texture, sampler, (int)x0 + (corner & 1), (int)y0 + (corner >> 1), slice, depth);
+		passed[corner] = reference < depth[0] ? 1.0f : 0.0f;
+	}
+	float top = passed[0] + (passed[1] - passed[0]) * fx;
+	float bottom = passed[2] + (passed[3] - passed[2]) * fx;
+	return top + (bottom - top) * fy;
+}
+
+// --------------------------------------------------------
+// HLSL helpers
+// --------------------------------------------------------
+
+// mul(v, m) for a matrix as the game uploads it (transposed,
+// so each float4 in memory is a column of the HLSL matrix)
+static void Transform(const float v[4], const float* m, float result[4])
+{
+	for (int c = 0; c < 4; c++)
+		result[c] = v[0] * m[c * 4 + 0] + v[1] * m[c * 4 + 1] + v[2] * m[c * 4 + 2] + v[3] * m[c * 4 + 3];
+}
+
+static float Dot3(const float a[3], const float b[3])
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static float Saturate(float value)
+{
+	return value < 0 ? 0 : value > 1 ? 1 : value;
+}
+
+static float Clamp(float value, float minimum, float maximum)
+{
+	return value < minimum ? minimum : value > maximum ? maximum : value;
+}
+
+static float SmoothStep(float minimum, float maximum, float value)
+{
+	float t = Saturate((value - minimum) / (maximum - minimum));
+	return t * t * (3 - 2 * t);
+}
+
+// --------------------------------------------------------
+// VertexShader.hlsl
+//
+// Varyings: worldSpace (really view space) 0-3, normal 4-6,
+// positionWS 7-9, uv 10-11
+// --------------------------------------------------------
+static void VertexShaderMain(const SoftwareBindings& bindings, const float* vertex, float position[4], float* varyings)
+{
+	const SoftwareObjectConstants* data = (const SoftwareObjectConstants*)bindings.Constants[0];
+
+	float local[4] = { vertex[0], vertex[1], vertex[2], 1.0f };
+	float world[4];
+	Transform(local, data->World, world);
+	Transform(world, data->View, varyings);
+	Transform(varyings, data->Projection, position);
+
+	// mul(normal, (float3x3)world)
+	for (int c = 0; c < 3; c++)
+		varyings[4 + c] = vertex[3] * data->World[c * 4 + 0] + vertex[4] * data->World[c * 4 + 1] + vertex[5] * data->World[c * 4 + 2];
+
+	varyings[7] = world[0];
+	varyings[8] = world[1];
+	varyings[9] = world[2];
+	varyings[10] = vertex[6];
+	varyings[11] = vertex[7];
+}
+
+// --------------------------------------------------------
+// ShadowVS.hlsl
+// --------------------------------------------------------
+static void ShadowVertexShaderMain(const SoftwareBindings& bindings, const float* vertex, float position[4], float* /*varyings*/)
+{
+	const SoftwareObjectConstants* data = (const SoftwareObjectConstants*)bindings.Constants[0];
+
+	float local[4] = { vertex[0], vertex[1], vertex[2], 1.0f };
+	float world[4], view[4];
+	Transform(local, data->World, world);
+	Transform(world, data->View, view);
+	Transform(view, data->Projection, position);
+}
+
+// --------------------------------------------------------
+// SkyVS.hlsl
+//
+// Varyings: uvw 0-2
+// --------------------------------------------------------
+static void SkyVertexShaderMain(const SoftwareBindings& bindings, const float* vertex, float position[4], float* varyings)
+{
+	const SoftwareSkyConstants* data = (const SoftwareSkyConstants*)bindings.Constants[0];
+
+	// The view without its translation (_41, _42, _43)
+	float viewNoMove[16];
+	memcpy(viewNoMove, data->View, sizeof(viewNoMove));
+	viewNoMove[3] = viewNoMove[7] = viewNoMove[11] = 0;
+
+	float local[4] = { vertex[0], vertex[1], vertex[2], 1.0f };
+	float view[4];
+	Transform(local, viewNoMove, view);
+	Transform(view, data->Projection, position);
+
+	// At max depth
+	position[2] = position[3];
+
+	varyings[0] = vertex[0];
+	varyings[1] = vertex[1];
+	varyings[2] = vertex[2];
+}
+
+// --------------------------------------------------------
+// SkyPS.hlsl
+// --------------------------------------------------------
+static void SkyPixelShaderMain(const SoftwareBindings& bindings, const float /*position*/[4], const float* varyings, float color[4])
+{
+	SampleTextureCube(bindings.Resources[0], bindings.Samplers[0], varyings, color);
+}
+
+// --------------------------------------------------------
+// PixelShader.hlsl, as PixelShader.cso is built: two
+// directional lights, shadows, fog and clustered lights
+// (no normal map or IBL)
+// --------------------------------------------------------
+static void AddDirectionalLight(const SoftwareDirectionalLight& light, const float normal[3], const float surface[4], float lighting[4])
+{
+	float length = sqrtf(Dot3(light.Direction, light.Direction));
+	float toLight[3];
+	for (int axis = 0; axis < 3; axis++)
+		toLight[axis] = length > 0 ? -light.Direction[axis] / length : 0.0f;
+
+	float nDotL = Saturate(Dot3(normal, toLight));
+	for (int c = 0; c < 4; c++)
+		lighting[c] += light.DiffuseColor[c] * nDotL * surface[c] + light.AmbientColor[c] * surface[c];
+}
+
+static void AddPunctualLight(const float lightPosition[3], float range, const float color[4], const float direction[3], float cosOuter, float cosInner,
+	const float normal[3], const float surface[4], const float positionWS[3], float scale, float lighting[4])
+{
+	float toLight[3] = { lightPosition[0] - positionWS[0], lightPosition[1] - positionWS[1], lightPosition[2] - positionWS[2] };
+	float dist = sqrtf(Dot3(toLight, toLight));
+	if (dist <= 0)
+		return;
+	for (int axis = 0; axis < 3; axis++)
+		toLight[axis] /= dist;
+
+	float nDotL = Saturate(Dot3(normal, toLight));
+	float cone = cosOuter > -1.0f ? SmoothStep(cosOuter, cosInner, -Dot3(toLight, direction)) : 1.0f;
+	float falloff = Saturate(1.0f - dist / range);
+	float attenuation = cone * falloff * falloff;
+	for (int c = 0; c < 4; c++)
+		lighting[c] += color[c] * surface[c] * (nDotL * attenuation) * scale;
+}
+
+static float SpotLightShadow(const SoftwareBindings& bindings, const SoftwareSpotLight& light, const float positionWS[3])
+{
+	if (light.AtlasRect[2] <= 0)
+		return 1.0f;
+
+	float world[4] = { positionWS[0], positionWS[1], positionWS[2], 1.0f };
+	float posForShadow[4];
+	Transform(world, light.ViewProjection, posForShadow);
+	for (int axis = 0; axis < 3; axis++)
+		posForShadow[axis] /= posForShadow[3];
+	float shadowU = posForShadow[0] * 0.5f + 0.5f;
+	float shadowV = posForShadow[1] * -0.5f + 0.5f;
+
+	const SoftwareResource* atlas = bindings.Resources[4];
+	if (!atlas)
+		return 0.0f;
+	float halfTexelU = 0.5f / atlas->TextureDesc.Width;
+	float halfTexelV = 0.5f / atlas->TextureDesc.Height;
+	float atlasU = Clamp(light.AtlasRect[0] + shadowU * light.AtlasRect[2], light.AtlasRect[0] + halfTexelU, light.AtlasRect[0] + light.AtlasRect[2] - halfTexelU);
+	float atlasV = Clamp(light.AtlasRect[1] + shadowV * light.AtlasRect[3], light.AtlasRect[1] + halfTexelV, light.AtlasRect[1] + light.AtlasRect[3] - halfTexelV);
+
+	return SampleTextureCompare(atlas, bindings.Samplers[1], atlasU, atlasV, 0, posForShadow[2]);
+}
+
+static void AddClusteredLights(const SoftwareBindings& bindings, const float pixel[2], float viewDepth, const float normal[3], const float surface[4], const float positionWS[3], float lighting[4])
+{
+	const SoftwareClusterConstants* data = (const SoftwareClusterConstants*)bindings.Constants[5];
+	const SoftwareResource* lightBuffer = bindings.Resources[8];
+	const SoftwareResource* rangeBuffer = bindings.Resources[9];
+	const SoftwareResource* indexBuffer = bindings.Resources[10];
+	if (!lightBuffer || !rangeBuffer || !indexBuffer || !data->ClusterCounts[0] || !data->ClusterCounts[1] || !data->ClusterCounts[2])
+		return;
+
+	unsigned int cell[3];
+	for (int axis = 0; axis < 2; axis++)
+	{
+		float tile = pixel[axis] / data->ClusterTileSize[axis];
+		cell[axis] = tile < data->ClusterCounts[axis] - 1 ? (unsigned int)tile : data->ClusterCounts[axis] - 1;
+	}
+	float depth = viewDepth > 0.0001f ? viewDepth : 0.0001f;
+	cell[2] = (unsigned int)Clamp(log2f(depth) * data->ClusterSliceScale + data->ClusterSliceBias, 0.0f, (float)(data->ClusterCounts[2] - 1));
+
+	// Reads past the end of a buffer get nothing, as on the GPU
+	size_t cluster = ((size_t)cell[2] * data->ClusterCounts[1] + cell[1]) * data->ClusterCounts[0] + cell[0];
+	if ((cluster + 1) * sizeof(ClusterRange) > rangeBuffer->Bytes.size())
+		return;
+	const ClusterRange& range = ((const ClusterRange*)&rangeBuffer->Bytes[0])[cluster];
+
+	const unsigned int* indices = (const unsigned int*)&indexBuffer->Bytes[0];
+	const ClusterLight* lights = (const ClusterLight*)&lightBuffer->Bytes[0];
+	size_t indexCount = indexBuffer->Bytes.size() / sizeof(unsigned int);
+	size_t lightCount = lightBuffer->Bytes.size() / sizeof(ClusterLight);
+	for (unsigned int i = 0; i < range.Count && range.Offset + i < indexCount; i++)
+	{
+		unsigned int index = indices[range.Offset + i];
+		if (index >= lightCount)
+			continue;
+
+		const ClusterLight& light = lights[index];
+		float color[4] = { light.Color[0], light.Color[1], light.Color[2], 1.0f };
+		AddPunctualLight(light.Position, light.Range, color, light.Direction, light.CosOuterAngle, light.CosInnerAngle, normal, surface, positionWS, 1.0f, lighting);
+	}
+}
+
+static void PixelShaderMain(const SoftwareBindings& bindings, const float position[4], const float* varyings, float color[4])
+{
+	const SoftwareLightConstants* lights = (const SoftwareLightConstants*)bindings.Constants[0];
+	const SoftwareShadowConstants* shadowData = (const SoftwareShadowConstants*)bindings.Constants[3];
+	const SoftwareSpotLightConstants* spotLightData = (const SoftwareSpotLightConstants*)bindings.Constants[4];
+
+	const float* worldSpace = varyings;
+	const float* positionWS = varyings + 7;
+
+	float normal[3] = { varyings[4], varyings[5], varyings[6] };
+	float normalLength = sqrtf(Dot3(normal, normal));
+	for (int axis = 0; axis < 3; axis++)
+		normal[axis] = normalLength > 0 ? normal[axis] / normalLength : 0.0f;
+
+	// Sample the texture
+	float surface[4];
+	SampleTexture2D(bindings.Resources[1], bindings.Samplers[0], varyings[10], varyings[11], 0, surface);
+
+	float lighting[4] = { 0, 0, 0, 0 };
+	AddDirectionalLight(lights->Light, normal, surface, lighting);
+	AddDirectionalLight(lights->NewLight, normal, surface, lighting);
+
+	// Pick the nearest cascade that reaches this pixel's depth
+	float viewDepth = worldSpace[2];
+	int cascadeCount = shadowData->CascadeCount < 4 ? shadowData->CascadeCount : 4;
+	if (cascadeCount > 0)
+	{
+		int cascade = 0;
+		for (int c = 0; c < 3; c++)
+			cascade += (c + 1 < cascadeCount && viewDepth > shadowData->CascadeSplits[c]) ? 1 : 0;
+
+		// Beyond the last cascade there's no shadow
+		if (viewDepth < shadowData->CascadeSplits[cascadeCount - 1])
+		{
+			// Orthographic, so no divide
+			float world[4] = { positionWS[0], positionWS[1], positionWS[2], 1.0f };
+			float posForShadow[4];
+			Transform(world, shadowData->CascadeViewProjection[cascade], posForShadow);
+			float shadowU = posForShadow[0] * 0.5f + 0.5f;
+			float shadowV = 1.0f - (posForShadow[1] * 0.5f + 0.5f);
+
+			float shadowAmount = SampleTextureCompare(bindings.Resources[2], bindings.Samplers[1], shadowU, shadowV, cascade, posForShadow[2]);
+			for (int c = 0; c < 4; c++)
+				lighting[c] *= shadowAmount;
+		}
+	}
+
+	// Spot lights have their own shadows (in the atlas)
+	for (int s = 0; s < spotLightData->SpotLightCount && s < 4; s++)
+	{
+		const SoftwareSpotLight& light = spotLightData->SpotLights[s];
+		float shadow = SpotLightShadow(bindings, light, positionWS);
+		AddPunctualLight(light.Position, light.Range, light.DiffuseColor, light.Direction, light.CosOuterAngle, light.CosInnerAngle, normal, surface, positionWS, shadow, lighting);
+	}
+
+	AddClusteredLights(bindings, position, viewDepth, normal, surface, positionWS, lighting);
+
+	// Linear fog on the (view space) distance, to grey
+	static const float fogColor[4] = { 0.5f, 0.5f, 0.5f, 1.0f };
+	float dist = sqrtf(worldSpace[0] * worldSpace[0] + worldSpace[1] * worldSpace[1] + worldSpace[2] * worldSpace[2] + worldSpace[3] * worldSpace[3]);
+	float fogFactor = Clamp((10 - dist) / (10 - 5), 0.0f, 1.0f);
+	for (int c = 0; c < 4; c++)
+		color[c] = fogColor[c] + (lighting[c] - fogColor[c]) * fogFactor;
+}
+
+// --------------------------------------------------------
+// The ports, by the names the shaders are created with
+// --------------------------------------------------------
+static const SoftwareShader shaders[] =
+{
+	{ "VertexShader",	RENDER_SHADER_VERTEX,	VertexShaderMain,		0,					12 },
+	{ "ShadowVS",		RENDER_SHADER_VERTEX,	ShadowVertexShaderMain,	0,					0 },
+	{ "SkyVS",			RENDER_SHADER_VERTEX,	SkyVertexShaderMain,	0,					3 },
+	{ "PixelShader",	RENDER_SHADER_PIXEL,	0,						PixelShaderMain,	0 },
+	{ "SkyPS",			RENDER_SHADER_PIXEL,	0,						SkyPixelShaderMain,	0 },
+};
+
+const SoftwareShader* FindSoftwareShader(const char* name)
+{
+	if (!name)
+		return 0;
+	for (size_t s = 0; s < sizeof(shaders) / sizeof(shaders[0]); s++)
+	{
+		if (strcmp(shaders[s].Name, name) == 0)
+			return &shaders[s];
+	}
+	return 0;
+}
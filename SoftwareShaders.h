@@ -0,0 +1,166 @@
+#pragma once
+
+#include <vector>
+
+#include "LightClusterGrid.h"
+#include "RenderDevice.h"
+
+// What a shader can have bound (per stage)
+#define SOFTWARE_MAX_CONSTANT_BUFFERS	8	// b0-b7
+#define SOFTWARE_MAX_RESOURCES			16	// t0-t15
+#define SOFTWARE_MAX_SAMPLERS			4	// s0-s3
+
+// Floats passed from a vertex shader to a pixel shader
+#define SOFTWARE_MAX_VARYINGS			16
+
+// --------------------------------------------------------
+// A buffer or texture in CPU memory.  Textures keep their top
+// mip only, as floats (Channels a texel, slice after slice),
+// whatever their format - there's no mip selection to feed.
+// --------------------------------------------------------
+struct SoftwareResource
+{
+	bool IsTexture;
+
+	// Buffers
+	RenderBufferDesc BufferDesc;
+	std::vector<unsigned char> Bytes;
+
+	// Textures
+	RenderTextureDesc TextureDesc;
+	int Channels;
+	std::vector<float> Texels;
+
+	float* GetTexel(int x, int y, int slice) { return &Texels[(((size_t)slice * TextureDesc.Height + y) * TextureDesc.Width + x) * Channels]; }
+	const float* GetTexel(int x, int y, int slice) const { return &Texels[(((size_t)slice * TextureDesc.Height + y) * TextureDesc.Width + x) * Channels]; }
+};
+
+// What one shader stage sees for a draw (null = nothing bound)
+struct SoftwareBindings
+{
+	const unsigned char* Constants[SOFTWARE_MAX_CONSTANT_BUFFERS];
+	const SoftwareResource* Resources[SOFTWARE_MAX_RESOURCES];
+	const RenderSamplerDesc* Samplers[SOFTWARE_MAX_SAMPLERS];
+};
+
+// One vertex (the pipeline layout's floats) to a clip space
+// position and the varyings
+typedef void (*SoftwareVertexShader)(const SoftwareBindings& bindings, const float* vertex, float position[4], float* varyings);
+
+// One pixel: position is SV_POSITION (the pixel's centre,
+// depth and 1/w), varyings are perspective correct
+typedef void (*SoftwarePixelShader)(const SoftwareBindings& bindings, const float position[4], const float* varyings, float color[4]);
+
+// --------------------------------------------------------
+// A C++ port of one of the project's shaders, found by the
+// name the game creates it with (e.g. "VertexShader" for
+// VertexShader.cso).  The ports are of the default
+// permutations and have to be kept in step with the HLSL.
+// --------------------------------------------------------
+struct SoftwareShader
+{
+	const char* Name;
+	RenderShaderStage Stage;
+	SoftwareVertexShader Vertex;
+	SoftwarePixelShader Pixel;
+	int VaryingCount;		// Vertex shaders' outputs
+};
+
+// Null if there's no port of that shader
+const SoftwareShader* FindSoftwareShader(const char* name);
+
+// --------------------------------------------------------
+// Texture reads, as the D3D11 samplers do them (without mips)
+// --------------------------------------------------------
+void SampleTexture2D(const SoftwareResource* texture, const RenderSamplerDesc* sampler, float u, float v, int slice, float result[4]);
+void SampleTextureCube(const SoftwareResource* texture, const RenderSamplerDesc* sampler, const float direction[3], float result[4]);
+
+// SampleCmpLevelZero with a LESS comparison: the fraction of
+// the (bilinear) footprint whose depth is past reference
+float SampleTextureCompare(const SoftwareResource* texture, const RenderSamplerDesc* sampler, float u, float v, int slice, float reference);
+
+// --------------------------------------------------------
+// The ports' constant buffers.  Same layouts as the HLSL
+// cbuffers (see ShaderStructs.h, which can't be used here as
+// it's DirectXMath), with matrices as the game uploads them -
+// transposed.
+// --------------------------------------------------------
+
+// VertexShader and ShadowVS, b0
+struct SoftwareObjectConstants
+{
+	float World[16];
+	float View[16];
+	float Projection[16];
+};
+
+// SkyVS, b0
+struct SoftwareSkyConstants
+{
+	float View[16];
+	float Projection[16];
+};
+
+struct SoftwareDirectionalLight
+{
+	float AmbientColor[4];
+	float DiffuseColor[4];
+	float Direction[3];
+	float _pad0;
+};
+
+// PixelShader, b0
+struct SoftwareLightConstants
+{
+	SoftwareDirectionalLight Light;
+	SoftwareDirectionalLight NewLight;
+};
+
+// PixelShader, b3
+struct SoftwareShadowConstants
+{
+	float CascadeViewProjection[4][16];
+	float CascadeSplits[4];
+	int CascadeCount;
+	float _pad0[3];
+};
+
+struct SoftwareSpotLight
+{
+	float DiffuseColor[4];
+	float Position[3];
+	float Range;
+	float Direction[3];
+	float CosOuterAngle;
+	float CosInnerAngle;
+	float _pad0[3];
+	float ViewProjection[16];
+	float AtlasRect[4];
+};
+
+// PixelShader, b4
+struct SoftwareSpotLightConstants
+{
+	SoftwareSpotLight SpotLights[4];
+	int SpotLightCount;
+	float _pad0[3];
+};
+
+// PixelShader, b5
+struct SoftwareClusterConstants
+{
+	unsigned int ClusterCounts[3];
+	float ClusterSliceScale;
+	float ClusterTileSize[2];
+	float ClusterSliceBias;
+	float _pad0;
+};
+
+static_assert(sizeof(SoftwareObjectConstants) == 192, "SoftwareObjectConstants size doesn't match HLSL");
+static_assert(sizeof(SoftwareSkyConstants) == 128, "SoftwareSkyConstants size doesn't match HLSL");
+static_assert(sizeof(SoftwareLightConstants) == 96, "SoftwareLightConstants size doesn't match HLSL");
+static_assert(sizeof(SoftwareShadowConstants) == 288, "SoftwareShadowConstants size doesn't match HLSL");
+static_assert(sizeof(SoftwareSpotLight) == 144, "SoftwareSpotLight size doesn't match HLSL");
+static_assert(sizeof(SoftwareSpotLightConstants) == 592, "SoftwareSpotLightConstants size doesn't match HLSL");
+static_assert(sizeof(SoftwareClusterConstants) == 32, "SoftwareClusterConstants size doesn't match HLSL");
+static_assert(sizeof(ClusterLight) == 48, "ClusterLight doesn't match the shader's ClusteredLight");
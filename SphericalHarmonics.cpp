@@ -0,0 +1,277 @@
+#include "SphericalHarmonics.h"
+
+#include <math.h>
+#include <thread>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SPHERICAL_HARMONICS_SSE
+#endif
+
+static const float Pi = 3.141592654f;
+
+// Basis normalization constants
+static const float SH_C0 = 0.282094792f;	// 1 / (2 sqrt(Pi))
+static const float SH_C1 = 0.488602512f;	// sqrt(3 / (4 Pi))
+static const float SH_C2 = 1.092548431f;	// sqrt(15 / (4 Pi))
+static const float SH_C3 = 0.315391565f;	// sqrt(5 / (16 Pi))
+static const float SH_C4 = 0.546274215f;	// sqrt(15 / (16 Pi))
+
+// Each face's direction is Major + s * SAxis + t * TAxis for s, t
+// in [-1, 1] across the face - the mapping of GetNormal()
+struct FaceAxes
+{
+	float Major[3];
+	float SAxis[3];
+	float TAxis[3];
+};
+
+static const FaceAxes Faces[6] =
+{
+	{ { +1, 0, 0 }, { 0, 0, -1 }, { 0, -1, 0 } },
+	{ { -1, 0, 0 }, { 0, 0, +1 }, { 0, -1, 0 } },
+	{ { 0, +1, 0 }, { +1, 0, 0 }, { 0, 0, +1 } },
+	{ { 0, -1, 0 }, { +1, 0, 0 }, { 0, 0, -1 } },
+	{ { 0, 0, +1 }, { +1, 0, 0 }, { 0, -1, 0 } },
+	{ { 0, 0, -1 }, { -1, 0, 0 }, { 0, -1, 0 } },
+};
+
+void SH9Color::Clear()
+{
+	for (int i = 0; i < 9; i++)
+		Coefficients[i][0] = Coefficients[i][1] = Coefficients[i][2] = 0;
+}
+
+void SH9Color::Add(const SH9Color& other)
+{
+	for (int i = 0; i < 9; i++)
+		for (int c = 0; c < 3; c++)
+			Coefficients[i][c] += other.Coefficients[i][c];
+}
+
+void SH9Color::Scale(float factor)
+{
+	for (int i = 0; i < 9; i++)
+		for (int c = 0; c < 3; c++)
+			Coefficients[i][c] *= factor;
+}
+
+void SphericalHarmonics::EvaluateBasis(const float dir[3], float basis[9])
+{
+	float x = dir[0], y = dir[1], z = dir[2];
+	basis[0] = SH_C0;
+	basis[1] = SH_C1 * y;
+	basis[2] = SH_C1 * z;
+	basis[3] = SH_C1 * x;
+	basis[4] = SH_C2 * x * y;
+	basis[5] = SH_C2 * y * z;
+	basis[6] = SH_C3 * (3 * z * z - 1);
+	basis[7] = SH_C2 * x * z;
+	basis[8] = SH_C4 * (x * x - y * y);
+}
+
+void SphericalHarmonics::Evaluate(const SH9Color& sh, const float dir[3], float rgb[3])
+{
+	float basis[9];
+	EvaluateBasis(dir, basis);
+	for (int c = 0; c < 3; c++)
+	{
+		rgb[c] = 0;
+		for (int i = 0; i < 9; i++)
+			rgb[c] += sh.Coefficients[i][c] * basis[i];
+	}
+}
+
+// Adds one texel (unnormalized s, t on the face) to the sums
+static void AccumulateTexel(const FaceAxes& axes, float s, float t, const float* texel, SH9Color& sum, float& weightSum)
+{
+	float dir[3];
+	for (int c = 0; c < 3; c++)
+		dir[c] = axes.Major[c] + s * axes.SAxis[c] + t * axes.TAxis[c];
+
+	// Differential solid angle of a texel on the unit cube
+	// (the constant 4 / size^2 is dropped - see ProjectFace)
+	float lengthSq = 1 + s * s + t * t;
+	float invLength = 1.0f / sqrtf(lengthSq);
+	float weight = invLength / lengthSq;
+	for (int c = 0; c < 3; c++)
+		dir[c] *= invLength;
+
+	float basis[9];
+	SphericalHarmonics::EvaluateBasis(dir, basis);
+	for (int i = 0; i < 9; i++)
+	{
+		float b = basis[i] * weight;
+		sum.Coefficients[i][0] += texel[0] * b;
+		sum.Coefficients[i][1] += texel[1] * b;
+		sum.Coefficients[i][2] += texel[2] * b;
+	}
+	weightSum += weight;
+}
+
+// Sums one face's projection (and its total weight)
+static void ProjectFace(const CubemapImage& environment, int mip, int face, bool useSIMD, SH9Color& sum, float& weightSum)
+{
+	sum.Clear();
+	weightSum = 0;
+
+	const FaceAxes& axes = Faces[face];
+	int size = environment.GetMipSize(mip);
+	const float* texels = environment.GetFace(face, mip);
+	float step = 2.0f / size;
+
+	for (int y = 0; y < size; y++)
+	{
+		float t = (y + 0.5f) * step - 1.0f;
+		const float* row = texels + y * size * 4;
+		int x = 0;
+
+#ifdef SPHERICAL_HARMONICS_SSE
+		if (useSIMD)
+		{
+			// Four texels per iteration; the sums stay in registers
+			// until the end of the row
+			__m128 acc[9][3];
+			for (int i = 0; i < 9; i++)
+				acc[i][0] = acc[i][1] = acc[i][2] = _mm_setzero_ps();
+			__m128 accWeight = _mm_setzero_ps();
+
+			__m128 tv = _mm_set1_ps(t);
+			__m128 one = _mm_set1_ps(1.0f);
+			for (; x + 4 <= size; x += 4)
+			{
+				__m128 sv = _mm_set_ps(
+					(x + 3.5f) * step - 1.0f, (x + 2.5f) * step - 1.0f,
+					(x + 1.5f) * step - 1.0f, (x + 0.5f) * step - 1.0f);
+
+				__m128 lengthSq = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(sv, sv), _mm_mul_ps(tv, tv)));
+				__m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSq));
+				__m128 weight = _mm_div_ps(invLength, lengthSq);
+
+				__m128 d[3];
+				for (int c = 0; c < 3; c++)
+				{
+					__m128 v = _mm_add_ps(_mm_set1_ps(axes.Major[c]),
+						_mm_add_ps(_mm_mul_ps(sv, _mm_set1_ps(axes.SAxis[c])), _mm_mul_ps(tv, _mm_set1_ps(axes.TAxis[c]))));
+					d[c] = _mm_mul_ps(v, invLength);
+				}
+
+				__m128 basis[9];
+				basis[0] = _mm_set1_ps(SH_C0);
+				basis[1] = _mm_mul_ps(_mm_set1_ps(SH_C1), d[1]);
+				basis[2] = _mm_mul_ps(_mm_set1_ps(SH_C1), d[2]);
+				basis[3] = _mm_mul_ps(_mm_set1_ps(SH_C1), d[0]);
+				basis[4] = _mm_mul_ps(_mm_set1_ps(SH_C2), _mm_mul_ps(d[0], d[1]));
+				basis[5] = _mm_mul_ps(_mm_set1_ps(SH_C2), _mm_mul_ps(d[1], d[2]));
+				basis[6] = _mm_mul_ps(_mm_set1_ps(SH_C3), _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(3.0f), _mm_mul_ps(d[2], d[2])), one));
+				basis[7] = _mm_mul_ps(_mm_set1_ps(SH_C2), _mm_mul_ps(d[0], d[2]));
+				basis[8] = _mm_mul_ps(_mm_set1_ps(SH_C4), _mm_sub_ps(_mm_mul_ps(d[0], d[0]), _mm_mul_ps(d[1], d[1])));
+
+				// Transpose the four RGBA texels into R, G and B lanes
+				__m128 t0 = _mm_loadu_ps(row + x * 4 + 0);
+				__m128 t1 = _mm_loadu_ps(row + x * 4 + 4);
+				__m128 t2 = _mm_loadu_ps(row + x * 4 + 8);
+				__m128 t3 = _mm_loadu_ps(row + x * 4 + 12);
+				_MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+
+				__m128 r = _mm_mul_ps(t0, weight);
+				__m128 g = _mm_mul_ps(t1, weight);
+				__m128 b = _mm_mul_ps(t2, weight);
+				for (int i = 0; i < 9; i++)
+				{
+					acc[i][0] = _mm_add_ps(acc[i][0], _mm_mul_ps(r, basis[i]));
+					acc[i][1] = _mm_add_ps(acc[i][1], _mm_mul_ps(g, basis[i]));
+					acc[i][2] = _mm_add_ps(acc[i][2], _mm_mul_ps(b, basis[i]));
+				}
+				accWeight = _mm_add_ps(accWeight, weight);
+			}
+
+			float lanes[4];
+			for (int i = 0; i < 9; i++)
+			{
+				for (int c = 0; c < 3; c++)
+				{
+					_mm_storeu_ps(lanes, acc[i][c]);
+					sum.Coefficients[i][c] += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+				}
+			}
+			_mm_storeu_ps(lanes, accWeight);
+			weightSum += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+		}
+#endif
+
+		// Whatever's left (or everything, without SSE)
+		for (; x < size; x++)
+			AccumulateTexel(axes, (x + 0.5f) * step - 1.0f, t, row + x * 4, sum, weightSum);
+	}
+}
+
+// --------------------------------------------------------
+// Projects one mip of an environment onto SH9
+//
+// environment - Radiance cubemap (RGB used, alpha ignored)
+// mip         - Which mip to read; a small one (16-32 texels)
+//               is plenty for irradiance and much faster
+// result      - Receives the radiance coefficients
+// --------------------------------------------------------
+void SphericalHarmonics::ProjectCubemap(const CubemapImage& environment, int mip, SH9Color& result, bool threads, bool useSIMD)
+{
+	SH9Color faceSums[6];
+	float faceWeights[6];
+
+	if (threads)
+	{
+		// One thread per face; this thread takes the first
+		std::thread workers[5];
+		for (int face = 1; face < 6; face++)
+			workers[face - 1] = std::thread(ProjectFace, std::cref(environment), mip, face, useSIMD, std::ref(faceSums[face]), std::ref(faceWeights[face]));
+		ProjectFace(environment, mip, 0, useSIMD, faceSums[0], faceWeights[0]);
+		for (int w = 0; w < 5; w++)
+			workers[w].join();
+	}
+	else
+	{
+		for (int face = 0; face < 6; face++)
+			ProjectFace(environment, mip, face, useSIMD, faceSums[face], faceWeights[face]);
+	}
+
+	// Reduce in a fixed order so the result doesn't depend on timing
+	result.Clear();
+	float weightSum = 0;
+	for (int face = 0; face < 6; face++)
+	{
+		result.Add(faceSums[face]);
+		weightSum += faceWeights[face];
+	}
+
+	// The weights should total 4 Pi; normalizing by their actual
+	// sum also absorbs the dropped 4 / size^2 and rounding
+	result.Scale(4 * Pi / weightSum);
+}
+
+void SphericalHarmonics::ConvolveIrradiance(SH9Color& sh)
+{
+	// Clamped cosine lobe per band (Pi, 2Pi/3, Pi/4), divided by Pi
+	static const float band[9] =
+	{
+		1.0f,
+		2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f,
+		0.25f, 0.25f, 0.25f, 0.25f, 0.25f
+	};
+
+	for (int i = 0; i < 9; i++)
+		for (int c = 0; c < 3; c++)
+			sh.Coefficients[i][c] *= band[i];
+}
+
+void SphericalHarmonics::GetShaderConstants(const SH9Color& sh, float constants[9][4])
+{
+	static const float scale[9] = { SH_C0, SH_C1, SH_C1, SH_C1, SH_C2, SH_C2, SH_C3, SH_C2, SH_C4 };
+
+	for (int i = 0; i < 9; i++)
+	{
+		for (int c = 0; c < 3; c++)
+			constants[i][c] = sh.Coefficients[i][c] * scale[i];
+		constants[i][3] = 0;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CubemapImage.h"
+
+// --------------------------------------------------------
+// Nine RGB spherical harmonic coefficients (bands 0-2),
+// ordered Y00, Y1-1, Y10, Y11, Y2-2, Y2-1, Y20, Y21, Y22
+// --------------------------------------------------------
+struct SH9Color
+{
+	float Coefficients[9][3];
+
+	void Clear();
+	void Add(const SH9Color& other);
+	void Scale(float factor);
+};
+
+// --------------------------------------------------------
+// Projects an environment cubemap onto SH9 and turns it into
+// diffuse irradiance, replacing a prefiltered irradiance
+// cubemap with 9 RGB values in a constant buffer.
+//
+// Projection weights every texel by its solid angle.  Each
+// face is summed on its own thread (four texels at a time
+// with SSE) and the six partial sums are added at the end.
+// --------------------------------------------------------
+class SphericalHarmonics
+{
+public:
+	// Radiance projection of one mip of an environment
+	//
+	// threads - false runs every face on the calling thread
+	// useSIMD - false forces the scalar path (for checking)
+	static void ProjectCubemap(const CubemapImage& environment, int mip, SH9Color& result, bool threads = true, bool useSIMD = true);
+
+	// Convolves radiance with the clamped cosine lobe and divides
+	// by Pi, giving the Lambert diffuse term for a white surface
+	static void ConvolveIrradiance(SH9Color& sh);
+
+	// The real SH basis functions for a (unit) direction
+	static void EvaluateBasis(const float dir[3], float basis[9]);
+
+	// Reconstructs the function in a direction
+	static void Evaluate(const SH9Color& sh, const float dir[3], float rgb[3]);
+
+	// Packs coefficients for the pixel shader's irradianceSH[9],
+	// with the basis constants folded in so the shader only has
+	// to evaluate the polynomial (see EvaluateIrradianceSH)
+	static void GetShaderConstants(const SH9Color& sh, float constants[9][4]);
+};
@@ -0,0 +1,300 @@
+#include "TaskGraph.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+
+TaskGraph::TaskGraph()
+{
+	workerCount = 0;
+	totalMs = 0;
+}
+
+TaskGraph::~TaskGraph()
+{
+}
+
+// --------------------------------------------------------
+// Adds a task to the graph
+//
+// name           - Shown in the timeline
+// work           - The function to run
+// mainThreadOnly - Task must run on the thread calling Run()
+//                  (e.g. anything using the immediate context)
+//
+// Returns the task's handle, for use with AddDependency()
+// --------------------------------------------------------
+int TaskGraph::AddTask(const char* name, std::function<void()> work, bool mainThreadOnly)
+{
+	Task task;
+	task.Name = name;
+	task.Work = work;
+	task.MainThreadOnly = mainThreadOnly;
+	task.DependencyCount = 0;
+	task.StartMs = 0;
+	task.EndMs = 0;
+	task.Thread = 0;
+
+	tasks.push_back(task);
+	return (int)tasks.size() - 1;
+}
+
+// --------------------------------------------------------
+// Makes one task wait for another to finish
+//
+// task      - The task that waits
+// dependsOn - The task that must finish first
+// --------------------------------------------------------
+void TaskGraph::AddDependency(int task, int dependsOn)
+{
+	tasks[dependsOn].Dependents.push_back(task);
+	tasks[task].DependencyCount++;
+}
+
+// --------------------------------------------------------
+// Checks for dependency cycles (Kahn's algorithm) - a cycle
+// would leave tasks waiting forever
+// --------------------------------------------------------
+bool TaskGraph::HasCycle()
+{
+	std::vector<unsigned int> pending(tasks.size());
+	std::vector<int> ready;
+	for (unsigned int i = 0; i < tasks.size(); i++)
+	{
+		pending[i] = tasks[i].DependencyCount;
+		if (pending[i] == 0)
+			ready.push_back(i);
+	}
+
+	unsigned int visited = 0;
+	while (!ready.empty())
+	{
+		int t = ready.back();
+		ready.pop_back();
+		visited++;
+
+		for (unsigned int d = 0; d < tasks[t].Dependents.size(); d++)
+		{
+			int dependent = tasks[t].Dependents[d];
+			if (--pending[dependent] == 0)
+				ready.push_back(dependent);
+		}
+	}
+
+	return visited != tasks.size();
+}
+
+// --------------------------------------------------------
+// Runs the whole graph.  The calling thread takes part: it
+// runs every main-thread-only task and helps with the rest
+// while it would otherwise be waiting.
+//
+// workerCount - Number of extra threads to start
+// --------------------------------------------------------
+bool TaskGraph::Run(unsigned int workerCount)
+{
+	if (HasCycle())
+		return false;
+
+	this->workerCount = workerCount;
+
+	// Shared scheduling state
+	std::mutex lock;
+	std::condition_variable wake;
+	std::deque<int> workerReady;	// Any thread may take these
+	std::deque<int> mainReady;		// Main thread only
+	std::vector<unsigned int> pending(tasks.size());
+	unsigned int remaining = (unsigned int)tasks.size();
+
+	for (unsigned int i = 0; i < tasks.size(); i++)
+	{
+		pending[i] = tasks[i].DependencyCount;
+		if (pending[i] == 0)
+			(tasks[i].MainThreadOnly ? mainReady : workerReady).push_back(i);
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::function<double()> nowMs = [&start]()
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	};
+
+	// The loop each thread runs until the graph is finished
+	std::function<void(unsigned int)> threadLoop = [&](unsigned int threadIndex)
+	{
+		bool isMain = (threadIndex == 0);
+		std::unique_lock<std::mutex> guard(lock);
+
+		while (remaining > 0)
+		{
+			// Grab the next task this thread is allowed to run
+			int t = -1;
+			if (isMain && !mainReady.empty())
+			{
+				t = mainReady.front();
+				mainReady.pop_front();
+			}
+			else if (!workerReady.empty())
+			{
+				t = workerReady.front();
+				workerReady.pop_front();
+			}
+
+			if (t < 0)
+			{
+				wake.wait(guard);
+				continue;
+			}
+
+			// Run it without holding the lock
+			guard.unlock();
+			tasks[t].Thread = threadIndex;
+			tasks[t].StartMs = nowMs();
+			if (tasks[t].Work)
+				tasks[t].Work();
+			tasks[t].EndMs = nowMs();
+			guard.lock();
+
+			// Release anything that was waiting on this task
+			for (unsigned int d = 0; d < tasks[t].Dependents.size(); d++)
+			{
+				int dependent = tasks[t].Dependents[d];
+				if (--pending[dependent] == 0)
+					(tasks[dependent].MainThreadOnly ? mainReady : workerReady).push_back(dependent);
+			}
+
+			remaining--;
+			wake.notify_all();
+		}
+	};
+
+	// Start the workers, then join in on this thread
+	std::vector<std::thread> workers;
+	for (unsigned int w = 0; w < workerCount; w++)
+		workers.push_back(std::thread(threadLoop, w + 1));
+
+	threadLoop(0);
+
+	for (unsigned int w = 0; w < workers.size(); w++)
+		workers[w].join();
+
+	totalMs = nowMs();
+	return true;
+}
+
+// --------------------------------------------------------
+// Finds the chain of dependent tasks with the largest total
+// duration - the part of startup worth optimizing
+//
+// path - Receives the tasks on the critical path, in order
+//
+// Returns the length of the path in milliseconds
+// --------------------------------------------------------
+double TaskGraph::GetCriticalPath(std::vector<int>& path)
+{
+	path.clear();
+	if (tasks.empty())
+		return 0;
+
+	// Process tasks in dependency order (tasks that ran
+	// earlier can't depend on tasks that started later)
+	std::vector<unsigned int> pending(tasks.size());
+	std::vector<int> order;
+	for (unsigned int i = 0; i < tasks.size(); i++)
+	{
+		pending[i] = tasks[i].DependencyCount;
+		if (pending[i] == 0)
+			order.push_back(i);
+	}
+	for (unsigned int o = 0; o < order.size(); o++)
+	{
+		int t = order[o];
+		for (unsigned int d = 0; d < tasks[t].Dependents.size(); d++)
+		{
+			int dependent = tasks[t].Dependents[d];
+			if (--pending[dependent] == 0)
+				order.push_back(dependent);
+		}
+	}
+
+	// Longest path ending at each task
+	std::vector<double> longest(tasks.size(), 0);
+	std::vector<int> previous(tasks.size(), -1);
+	int last = order.empty() ? 0 : order[0];
+	for (unsigned int o = 0; o < order.size(); o++)
+	{
+		int t = order[o];
+		longest[t] += tasks[t].EndMs - tasks[t].StartMs;
+		if (longest[t] > longest[last])
+			last = t;
+
+		for (unsigned int d = 0; d < tasks[t].Dependents.size(); d++)
+		{
+			int dependent = tasks[t].Dependents[d];
+			if (longest[t] > longest[dependent])
+			{
+				longest[dependent] = longest[t];
+				previous[dependent] = t;
+			}
+		}
+	}
+
+	// Walk back from the end of the longest chain
+	for (int t = last; t >= 0; t = previous[t])
+		path.insert(path.begin(), t);
+
+	return longest[last];
+}
+
+// --------------------------------------------------------
+// Writes the timeline as a Chrome trace (JSON object format).
+// Tasks on the critical path are tagged in their args.
+// --------------------------------------------------------
+bool TaskGraph::WriteChromeTrace(const char* path)
+{
+	FILE* file = 0;
+#ifdef _WIN32
+	fopen_s(&file, path, "w");
+#else
+	file = fopen(path, "w");
+#endif
+	if (!file)
+		return false;
+
+	std::vector<int> critical;
+	GetCriticalPath(critical);
+	std::vector<bool> onCriticalPath(tasks.size(), false);
+	for (unsigned int c = 0; c < critical.size(); c++)
+		onCriticalPath[critical[c]] = true;
+
+	fprintf(file, "{\"traceEvents\":[\n");
+
+	// Name the threads so the timeline is readable
+	for (unsigned int t = 0; t <= workerCount; t++)
+	{
+		if (t == 0)
+			fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Main\"}},\n");
+		else
+			fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Worker %u\"}},\n", t, t);
+	}
+
+	// One complete ("X") event per task, times in microseconds
+	for (unsigned int i = 0; i < tasks.size(); i++)
+	{
+		fprintf(file,
+			"{\"name\":\"%s\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"critical\":%s}}%s\n",
+			tasks[i].Name.c_str(),
+			tasks[i].Thread,
+			tasks[i].StartMs * 1000.0,
+			(tasks[i].EndMs - tasks[i].StartMs) * 1000.0,
+			onCriticalPath[i] ? "true" : "false",
+			i + 1 < tasks.size() ? "," : "");
+	}
+
+	fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+	fclose(file);
+	return true;
+}
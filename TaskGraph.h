@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------
+// A one-shot graph of tasks with explicit dependencies, run
+// across worker threads plus the calling ("main") thread.
+//
+// Used for startup: independent loads run concurrently, and
+// tasks that must touch the immediate context can be pinned
+// to the main thread.  Every task's start/end time and thread
+// are recorded so the run can be exported as a Chrome trace
+// (chrome://tracing or ui.perfetto.dev).
+// --------------------------------------------------------
+class TaskGraph
+{
+public:
+	TaskGraph();
+	~TaskGraph();
+
+	// Building the graph
+	int AddTask(const char* name, std::function<void()> work, bool mainThreadOnly = false);
+	void AddDependency(int task, int dependsOn);
+
+	// Runs every task, blocking until all are done.  Returns false
+	// (without running anything) if the dependencies contain a cycle.
+	bool Run(unsigned int workerCount);
+
+	// Timeline results (valid after Run)
+	unsigned int GetTaskCount() { return (unsigned int)tasks.size(); }
+	const char* GetTaskName(int task) { return tasks[task].Name.c_str(); }
+	double GetTaskStartMs(int task) { return tasks[task].StartMs; }
+	double GetTaskEndMs(int task) { return tasks[task].EndMs; }
+	unsigned int GetTaskThread(int task) { return tasks[task].Thread; }
+	double GetTotalMs() { return totalMs; }
+
+	// Longest dependency chain, by measured duration
+	double GetCriticalPath(std::vector<int>& path);
+
+	bool WriteChromeTrace(const char* path);
+
+private:
+	struct Task
+	{
+		std::string Name;
+		std::function<void()> Work;
+		bool MainThreadOnly;
+		std::vector<int> Dependents;
+		unsigned int DependencyCount;
+
+		// Filled in while running
+		double StartMs;
+		double EndMs;
+		unsigned int Thread;	// 0 is the main thread, workers are 1..N
+	};
+
+	std::vector<Task> tasks;
+	unsigned int workerCount;
+	double totalMs;
+
+	bool HasCycle();
+};
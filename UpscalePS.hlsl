@@ -0,0 +1,25 @@
+// The scene, drawn into the top left of a window sized target
+Texture2D Scene			: register(t0);
+SamplerState Sampler	: register(s0);
+
+// Constant Buffer for external (C++) data
+cbuffer upscaleData : register(b0)
+{
+	float2 uvScale;		// Rendered size / target size
+	float2 uvMax;		// The last rendered texel's center, so filtering doesn't pick up what's past it
+};
+
+// Defines the input to this pixel shader
+// - Should match the output of our corresponding vertex shader
+struct VertexToPixel
+{
+	float4 position		: SV_POSITION;
+	float2 uv			: TEXCOORD;
+};
+
+// Entry point for this pixel shader
+float4 main(VertexToPixel input) : SV_TARGET
+{
+	float2 uv = min(input.uv * uvScale, uvMax);
+	return Scene.SampleLevel(Sampler, uv, 0);
+}
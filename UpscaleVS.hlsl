@@ -0,0 +1,21 @@
+// Out of the vertex shader (and eventually input to the PS)
+struct VertexToPixel
+{
+	float4 position		: SV_POSITION;
+	float2 uv			: TEXCOORD;
+};
+
+// --------------------------------------------------------
+// One triangle covering the whole target, from the vertex
+// index alone - no vertex or index buffer is bound
+// --------------------------------------------------------
+VertexToPixel main(uint id : SV_VertexID)
+{
+	VertexToPixel output;
+
+	// (0,0), (2,0), (0,2) in UV space
+	output.uv = float2((id << 1) & 2, id & 2);
+	output.position = float4(output.uv * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);
+
+	return output;
+}
@@ -10,9 +10,6 @@ cbuffer externalData : register(b0)
 	matrix world;
 	matrix view;
 	matrix projection;
-
-	matrix shadowView;
-	matrix shadowProjection;
 };
 
 // Struct representing a single vertex worth of data
@@ -45,8 +42,6 @@ struct VertexToPixel
 	//  |   Name          Semantic
 	//  |    |                |
 	//  v    v                v
-	float4 posForShadow : TEXCOORD0;
-	//may need a "dirForShadow" for Spot Light
 	float4 position		: SV_POSITION;	// XYZW position (System Value Position)
 	float4 worldSpace   : TEXCOORD1; //fog
 	float3 normal       : NORMAL;
@@ -99,9 +94,8 @@ VertexToPixel main( VertexShaderInput input )
 	//UVs
 	output.uv = input.uv;
 
-	// Do shadow map calc
-	matrix shadowWVP = mul(mul(world, shadowView), shadowProjection);
-	output.posForShadow = mul(float4(input.position, 1), shadowWVP);
+	// Shadows are looked up per pixel from positionWS, since the
+	// cascade depends on the pixel's depth (see PixelShader)
 
 	// Whatever we return will make its way through the pipeline to the
 	// next programmable stage we're using (the pixel shader for now)